@@ -78,6 +78,30 @@
 
 #define MBEDTLS_MPI_MAX_BITS                              ( 8 * MBEDTLS_MPI_MAX_SIZE )    /**< Maximum number of bits for usable MPIs. */
 
+#if !defined(MBEDTLS_MPI_KARATSUBA_THRESHOLD)
+/*
+ * Minimum size, in limbs, of both operands of mbedtls_mpi_mul_mpi() for
+ * Karatsuba multiplication to be used instead of schoolbook multiplication.
+ * Also the size below which the Karatsuba recursion stops.
+ * Minimum value: 4. Default: 32 (2048-bit operands with 64-bit limbs).
+ *
+ * The best value depends on the CPU and on the multiply-accumulate code
+ * used (see bn_mul.h). Use the "mpi" benchmark to tune it.
+ */
+#define MBEDTLS_MPI_KARATSUBA_THRESHOLD                   32        /**< Minimum number of limbs for Karatsuba. */
+#endif /* !MBEDTLS_MPI_KARATSUBA_THRESHOLD */
+
+#if !defined(MBEDTLS_MPI_GEN_PRIME_THREADS)
+/*
+ * Number of threads mbedtls_mpi_gen_prime() uses to screen candidates
+ * (including the calling thread). Values above 1 require
+ * MBEDTLS_THREADING_PTHREAD. Default: 1.
+ *
+ * The primes found for a given RNG output do not depend on this value.
+ */
+#define MBEDTLS_MPI_GEN_PRIME_THREADS                     1         /**< Threads used for prime generation. */
+#endif /* !MBEDTLS_MPI_GEN_PRIME_THREADS */
+
 /*
  * When reading from files with mbedtls_mpi_read_file() and writing to files with
  * mbedtls_mpi_write_file() the buffer should have space
@@ -184,6 +208,20 @@ typedef struct
 }
 mbedtls_mpi;
 
+/**
+ * \brief          Reduction context for a fixed modulus N: holds the
+ *                 Barrett and Montgomery constants so that repeated
+ *                 operations mod N do not recompute them
+ */
+typedef struct
+{
+    mbedtls_mpi N;          /*!<  the modulus, with n = # of used limbs     */
+    mbedtls_mpi mu;         /*!<  floor( 2^(2 * biL * N.n) / N )            */
+    mbedtls_mpi RR;         /*!<  R^2 mod N, R = 2^(biL * N.n) (odd N only) */
+    mbedtls_mpi_uint mm;    /*!<  -N^-1 mod 2^biL (odd N only)              */
+}
+mbedtls_mpi_mod_ctx;
+
 /**
  * \brief           Initialize one MPI (make internal references valid)
  *                  This just makes it ready to be set or freed,
@@ -423,6 +461,18 @@ int mbedtls_mpi_write_file( const char *p, const mbedtls_mpi *X, int radix, FILE
  */
 int mbedtls_mpi_read_binary( mbedtls_mpi *X, const unsigned char *buf, size_t buflen );
 
+/**
+ * \brief          Import X from unsigned binary data, little endian
+ *
+ * \param X        Destination MPI
+ * \param buf      Input buffer
+ * \param buflen   Input buffer size
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_ALLOC_FAILED if memory allocation failed
+ */
+int mbedtls_mpi_read_binary_le( mbedtls_mpi *X, const unsigned char *buf, size_t buflen );
+
 /**
  * \brief          Export X into unsigned binary data, big endian.
  *                 Always fills the whole buffer, which will start with zeros
@@ -437,6 +487,20 @@ int mbedtls_mpi_read_binary( mbedtls_mpi *X, const unsigned char *buf, size_t bu
  */
 int mbedtls_mpi_write_binary( const mbedtls_mpi *X, unsigned char *buf, size_t buflen );
 
+/**
+ * \brief          Export X into unsigned binary data, little endian.
+ *                 Always fills the whole buffer, which will end with zeros
+ *                 if the number is smaller.
+ *
+ * \param X        Source MPI
+ * \param buf      Output buffer
+ * \param buflen   Output buffer size
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_BUFFER_TOO_SMALL if buf isn't large enough
+ */
+int mbedtls_mpi_write_binary_le( const mbedtls_mpi *X, unsigned char *buf, size_t buflen );
+
 /**
  * \brief          Left-shift: X <<= count
  *
@@ -714,6 +778,173 @@ int mbedtls_mpi_gcd( mbedtls_mpi *G, const mbedtls_mpi *A, const mbedtls_mpi *B
  */
 int mbedtls_mpi_inv_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *N );
 
+/**
+ * \brief          Modular inverse for an odd modulus: X = A^-1 mod N
+ *
+ * \param X        Destination MPI
+ * \param A        Left-hand MPI
+ * \param N        Right-hand MPI, must be odd
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_ALLOC_FAILED if memory allocation failed,
+ *                 MBEDTLS_ERR_MPI_BAD_INPUT_DATA if N is <= 1 or even,
+ *                 MBEDTLS_ERR_MPI_NOT_ACCEPTABLE if A has no inverse mod N.
+ *
+ * \note           This uses a binary extended GCD whose sequence of
+ *                 operations only depends on the size of N, not on the
+ *                 value of A once reduced mod N. mbedtls_mpi_inv_mod()
+ *                 calls it for odd moduli.
+ */
+int mbedtls_mpi_inv_mod_odd( mbedtls_mpi *X, const mbedtls_mpi *A,
+                             const mbedtls_mpi *N );
+
+/**
+ * \brief          Modular inverse for a prime modulus: X = A^-1 mod P,
+ *                 computed as A^(P-2) mod P
+ *
+ * \param X        Destination MPI
+ * \param A        Left-hand MPI
+ * \param P        Right-hand MPI, must be an odd prime
+ * \param _RR      Speed-up MPI used for recalculations, as in
+ *                 mbedtls_mpi_exp_mod()
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_ALLOC_FAILED if memory allocation failed,
+ *                 MBEDTLS_ERR_MPI_BAD_INPUT_DATA if P is <= 2 or even,
+ *                 MBEDTLS_ERR_MPI_NOT_ACCEPTABLE if A is 0 mod P.
+ *
+ * \note           The primality of P is not checked: the result is
+ *                 meaningless if P is not prime. With _RR kept across calls,
+ *                 this is usually faster than mbedtls_mpi_inv_mod_odd()
+ *                 for large primes.
+ */
+int mbedtls_mpi_inv_mod_prime( mbedtls_mpi *X, const mbedtls_mpi *A,
+                               const mbedtls_mpi *P, mbedtls_mpi *_RR );
+
+/**
+ * \brief          Initialize a modulus context
+ *
+ * \param ctx      Context to initialize
+ */
+void mbedtls_mpi_mod_init( mbedtls_mpi_mod_ctx *ctx );
+
+/**
+ * \brief          Free the components of a modulus context
+ *
+ * \param ctx      Context to free
+ */
+void mbedtls_mpi_mod_free( mbedtls_mpi_mod_ctx *ctx );
+
+/**
+ * \brief          Set up a modulus context for the modulus N: precompute
+ *                 the Barrett constant, and for odd N the Montgomery
+ *                 constants
+ *
+ * \param ctx      Context to set up (initialized, possibly already set up)
+ * \param N        Modulus, must be positive
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_ALLOC_FAILED if memory allocation failed,
+ *                 MBEDTLS_ERR_MPI_BAD_INPUT_DATA if N is <= 0
+ */
+int mbedtls_mpi_mod_setup( mbedtls_mpi_mod_ctx *ctx, const mbedtls_mpi *N );
+
+/**
+ * \brief          Reduction: X = A mod N, 0 <= X < N
+ *
+ * \param X        Destination MPI
+ * \param A        MPI to reduce, of any sign and size
+ * \param ctx      Modulus context
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_ALLOC_FAILED if memory allocation failed
+ *
+ * \note           When |A| < N^2, as for the product of two reduced
+ *                 values, this uses Barrett reduction and no division.
+ */
+int mbedtls_mpi_mod_reduce( mbedtls_mpi *X, const mbedtls_mpi *A,
+                            const mbedtls_mpi_mod_ctx *ctx );
+
+/**
+ * \brief          Montgomery reduction: X = A * R^-1 mod N, 0 <= X < N,
+ *                 with R = 2^(biL * n) for an N of n limbs
+ *
+ * \param X        Destination MPI
+ * \param A        MPI to reduce, 0 <= A < R^2 (for example the product
+ *                 of two values less than N)
+ * \param ctx      Modulus context, set up for an odd N
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_ALLOC_FAILED if memory allocation failed,
+ *                 MBEDTLS_ERR_MPI_BAD_INPUT_DATA if N is even or A is out
+ *                 of range
+ *
+ * \note           With values kept in Montgomery form x R mod N, this is
+ *                 the reduction that follows each multiplication. A value
+ *                 enters that form as the reduction of x * ctx->RR and
+ *                 leaves it as the reduction of x R.
+ */
+int mbedtls_mpi_mod_montred( mbedtls_mpi *X, const mbedtls_mpi *A,
+                             const mbedtls_mpi_mod_ctx *ctx );
+
+/**
+ * \brief          Modular multiplication: X = A * B mod N
+ *
+ * \param X        Destination MPI
+ * \param A        Left-hand MPI
+ * \param B        Right-hand MPI
+ * \param ctx      Modulus context
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_ALLOC_FAILED if memory allocation failed
+ */
+int mbedtls_mpi_mod_mul( mbedtls_mpi *X, const mbedtls_mpi *A,
+                         const mbedtls_mpi *B, const mbedtls_mpi_mod_ctx *ctx );
+
+/**
+ * \brief          Modular squaring: X = A^2 mod N
+ *
+ * \param X        Destination MPI
+ * \param A        MPI to square
+ * \param ctx      Modulus context
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_ALLOC_FAILED if memory allocation failed
+ */
+int mbedtls_mpi_mod_sqr( mbedtls_mpi *X, const mbedtls_mpi *A,
+                         const mbedtls_mpi_mod_ctx *ctx );
+
+/**
+ * \brief          Modular exponentiation: X = A^E mod N, with the
+ *                 precomputed Montgomery constants
+ *
+ * \param X        Destination MPI
+ * \param A        Left-hand MPI
+ * \param E        Exponent MPI
+ * \param ctx      Modulus context, set up for an odd N
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_ALLOC_FAILED if memory allocation failed,
+ *                 MBEDTLS_ERR_MPI_BAD_INPUT_DATA if N is even or E is negative
+ */
+int mbedtls_mpi_mod_exp( mbedtls_mpi *X, const mbedtls_mpi *A,
+                         const mbedtls_mpi *E, const mbedtls_mpi_mod_ctx *ctx );
+
+/**
+ * \brief          Modular inverse: X = A^-1 mod N
+ *
+ * \param X        Destination MPI
+ * \param A        MPI to invert
+ * \param ctx      Modulus context
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_MPI_ALLOC_FAILED if memory allocation failed,
+ *                 MBEDTLS_ERR_MPI_BAD_INPUT_DATA if N is <= 1,
+ *                 MBEDTLS_ERR_MPI_NOT_ACCEPTABLE if A has no inverse mod N.
+ */
+int mbedtls_mpi_mod_inv( mbedtls_mpi *X, const mbedtls_mpi *A,
+                         const mbedtls_mpi_mod_ctx *ctx );
+
 /**
  * \brief          Miller-Rabin primality test
  *
@@ -732,6 +963,12 @@ int mbedtls_mpi_is_prime( const mbedtls_mpi *X,
 /**
  * \brief          Prime number generation
  *
+ * \note           Large candidates are sieved a window at a time and
+ *                 screened on MBEDTLS_MPI_GEN_PRIME_THREADS threads before
+ *                 the probabilistic test. For a given output of f_rng the
+ *                 result does not depend on the number of threads, and
+ *                 f_rng is only ever called from the calling thread.
+ *
  * \param X        Destination MPI
  * \param nbits    Required size of X in bits
  *                 ( 3 <= nbits <= MBEDTLS_MPI_MAX_BITS )
@@ -182,6 +182,58 @@
         : "rax", "rdx", "r8"                \
     );
 
+/*
+ * BMI2/ADX variant (Broadwell and later), only to be used after checking
+ * CPUID at runtime, see mpi_mul_hlp(). MULX leaves the flags untouched, so
+ * the carries of "lo + previous hi" (ADCX: CF only) and of "+ d[i]" (ADOX:
+ * OF only) run on two independent chains. Pointers are moved with LEA,
+ * which doesn't touch the flags either, and both chains are folded into c
+ * in MULADDC_X_STOP.
+ */
+#define MULADDC_X_INIT                          \
+    asm(                                        \
+        "xorq   %%r8, %%r8                \n\t"
+
+#define MULADDC_X_LIMB( off )                   \
+        "mulxq  " #off "(%%rsi), %%rax, %%r9 \n\t" \
+        "adcxq  %%rcx, %%rax              \n\t" \
+        "adoxq  " #off "(%%rdi), %%rax    \n\t" \
+        "movq   %%rax, " #off "(%%rdi)    \n\t" \
+        "movq   %%r9, %%rcx               \n\t"
+
+#define MULADDC_X1_CORE                         \
+        MULADDC_X_LIMB( 0 )                     \
+        "leaq   8(%%rsi), %%rsi           \n\t" \
+        "leaq   8(%%rdi), %%rdi           \n\t"
+
+#define MULADDC_X4_CORE                         \
+        MULADDC_X_LIMB( 0 )                     \
+        MULADDC_X_LIMB( 8 )                     \
+        MULADDC_X_LIMB( 16 )                    \
+        MULADDC_X_LIMB( 24 )                    \
+        "leaq   32(%%rsi), %%rsi          \n\t" \
+        "leaq   32(%%rdi), %%rdi          \n\t"
+
+#define MULADDC_X8_CORE                         \
+        MULADDC_X_LIMB( 0 )                     \
+        MULADDC_X_LIMB( 8 )                     \
+        MULADDC_X_LIMB( 16 )                    \
+        MULADDC_X_LIMB( 24 )                    \
+        MULADDC_X_LIMB( 32 )                    \
+        MULADDC_X_LIMB( 40 )                    \
+        MULADDC_X_LIMB( 48 )                    \
+        MULADDC_X_LIMB( 56 )                    \
+        "leaq   64(%%rsi), %%rsi          \n\t" \
+        "leaq   64(%%rdi), %%rdi          \n\t"
+
+#define MULADDC_X_STOP                          \
+        "adcxq  %%r8, %%rcx               \n\t" \
+        "adoxq  %%r8, %%rcx               \n\t" \
+        : "+c" (c), "+D" (d), "+S" (s)          \
+        : "d" (b)                               \
+        : "rax", "r8", "r9", "cc", "memory"     \
+    );
+
 #endif /* AMD64 */
 
 #if defined(__mc68020__) || defined(__mcpu32__)
@@ -117,6 +117,27 @@
 #error "MBEDTLS_ECP_C defined, but not all prerequisites"
 #endif
 
+#if defined(MBEDTLS_ECP_POOL_C) && !defined(MBEDTLS_ECP_C)
+#error "MBEDTLS_ECP_POOL_C defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_ECP_RESTARTABLE) &&                           \
+    ( !defined(MBEDTLS_ECP_C) ||                                   \
+      defined(MBEDTLS_ECP_ALT) ||                                  \
+      defined(MBEDTLS_ECP_INTERNAL_ALT) ||                         \
+      defined(MBEDTLS_ECDH_GEN_PUBLIC_ALT) ||                      \
+      defined(MBEDTLS_ECDH_COMPUTE_SHARED_ALT) ||                  \
+      defined(MBEDTLS_ECDSA_SIGN_ALT) ||                           \
+      defined(MBEDTLS_ECDSA_VERIFY_ALT) ||                         \
+      defined(MBEDTLS_ECDSA_GENKEY_ALT) )
+#error "MBEDTLS_ECP_RESTARTABLE defined, but not all prerequisites"
+#endif
+
+#if defined(MBEDTLS_ED25519_C) &&                                  \
+    ( !defined(MBEDTLS_BIGNUM_C) || !defined(MBEDTLS_SHA512_C) )
+#error "MBEDTLS_ED25519_C defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_ENTROPY_C) && (!defined(MBEDTLS_SHA512_C) &&      \
                                     !defined(MBEDTLS_SHA256_C))
 #error "MBEDTLS_ENTROPY_C defined, but not all prerequisites"
@@ -602,6 +623,11 @@
 #define MBEDTLS_THREADING_IMPL
 #endif
 
+#if defined(MBEDTLS_MPI_GEN_PRIME_THREADS) && MBEDTLS_MPI_GEN_PRIME_THREADS > 1 && \
+    !defined(MBEDTLS_THREADING_PTHREAD)
+#error "MBEDTLS_MPI_GEN_PRIME_THREADS > 1 defined, but not all prerequisites"
+#endif
+
 #if defined(MBEDTLS_THREADING_ALT)
 #if !defined(MBEDTLS_THREADING_C) || defined(MBEDTLS_THREADING_IMPL)
 #error "MBEDTLS_THREADING_ALT defined, but not all prerequisites"
@@ -558,6 +558,7 @@
 #define MBEDTLS_ECP_DP_BP384R1_ENABLED
 #define MBEDTLS_ECP_DP_BP512R1_ENABLED
 #define MBEDTLS_ECP_DP_CURVE25519_ENABLED
+#define MBEDTLS_ECP_DP_CURVE448_ENABLED
 
 /**
  * \def MBEDTLS_ECP_NIST_OPTIM
@@ -570,6 +571,123 @@
  */
 #define MBEDTLS_ECP_NIST_OPTIM
 
+/**
+ * \def MBEDTLS_ECP_P256_FAST
+ *
+ * Enable the dedicated secp256r1 backend: fixed-size 64-bit limbs,
+ * Montgomery-domain field arithmetic and a precomputed table for the
+ * generator. mbedtls_ecp_mul() and mbedtls_ecp_muladd(), hence ECDH and
+ * ECDSA, use it automatically for secp256r1. It runs in constant time and
+ * makes these operations several times faster, for about 2 KB of tables.
+ *
+ * Module:  library/ecp_p256.c
+ *
+ * Requires: MBEDTLS_ECP_C, MBEDTLS_ECP_DP_SECP256R1_ENABLED
+ *
+ * Comment this macro to use the generic code for secp256r1.
+ */
+#define MBEDTLS_ECP_P256_FAST
+
+/**
+ * \def MBEDTLS_ECP_P384_FAST
+ *
+ * Enable the dedicated secp384r1 backend: the same design as
+ * MBEDTLS_ECP_P256_FAST with six 64-bit limbs, Montgomery-domain field
+ * arithmetic and a precomputed table for the generator.
+ * mbedtls_ecp_mul() and mbedtls_ecp_muladd(), hence ECDH and ECDSA, use it
+ * automatically for secp384r1. It runs in constant time, for about 3 KB of
+ * tables. Restartable operations (see MBEDTLS_ECP_RESTARTABLE) keep using
+ * the generic code while restart is enabled.
+ *
+ * Module:  library/ecp_p384.c
+ *
+ * Requires: MBEDTLS_ECP_C, MBEDTLS_ECP_DP_SECP384R1_ENABLED
+ *
+ * Comment this macro to use the generic code for secp384r1.
+ */
+#define MBEDTLS_ECP_P384_FAST
+
+/**
+ * \def MBEDTLS_ECP_X25519_FAST
+ *
+ * Enable the dedicated Curve25519 backend: a constant-time X25519 ladder
+ * (RFC 7748) on five 51-bit limbs. mbedtls_ecp_mul(), hence ECDH, uses it
+ * automatically for Curve25519 instead of the generic ladder. It is fastest
+ * with a 128-bit integer type and falls back to portable 64-bit code
+ * otherwise.
+ *
+ * Module:  library/ecp_x25519.c
+ *
+ * Requires: MBEDTLS_ECP_C, MBEDTLS_ECP_DP_CURVE25519_ENABLED
+ *
+ * Comment this macro to use the generic code for Curve25519.
+ */
+#define MBEDTLS_ECP_X25519_FAST
+
+/**
+ * \def MBEDTLS_ECP_X448_FAST
+ *
+ * Enable the dedicated Curve448 backend: a constant-time X448 ladder
+ * (RFC 7748) on eight 56-bit limbs, reducing with the special form of
+ * p = 2^448 - 2^224 - 1. mbedtls_ecp_mul(), hence ECDH, uses it
+ * automatically for Curve448 instead of the generic ladder. Like
+ * MBEDTLS_ECP_X25519_FAST, it is fastest with a 128-bit integer type.
+ *
+ * Module:  library/ecp_x448.c
+ *
+ * Requires: MBEDTLS_ECP_C, MBEDTLS_ECP_DP_CURVE448_ENABLED
+ *
+ * Comment this macro to use the generic code for Curve448.
+ */
+#define MBEDTLS_ECP_X448_FAST
+
+/**
+ * \def MBEDTLS_ECP_SECP256K1_GLV
+ *
+ * Use the GLV endomorphism of secp256k1: every scalar is split into two
+ * half-length ones, which roughly halves the number of point doublings.
+ * mbedtls_ecp_muladd(), hence ECDSA verification, always benefits;
+ * mbedtls_ecp_mul() does for points other than the generator (ECDH), the
+ * generator having its own precomputed table. Restartable operations
+ * (see MBEDTLS_ECP_RESTARTABLE) keep using the generic code.
+ *
+ * Requires: MBEDTLS_ECP_C, MBEDTLS_ECP_DP_SECP256K1_ENABLED
+ *
+ * Comment this macro to use the generic code for secp256k1.
+ */
+#define MBEDTLS_ECP_SECP256K1_GLV
+
+/**
+ * \def MBEDTLS_ECP_RESTARTABLE
+ *
+ * Enable "non-blocking" ECC operations that can return early and be resumed.
+ *
+ * This allows various functions to pause by returning
+ * #MBEDTLS_ERR_ECP_IN_PROGRESS (or, for functions in the SSL module,
+ * #MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS) and then be called later again in
+ * order to further progress and eventually complete their operation. This is
+ * controlled through mbedtls_ecp_set_max_ops() which limits the maximum
+ * number of ECC operations a function may perform before pausing; see
+ * mbedtls_ecp_set_max_ops() for more information.
+ *
+ * This is useful in non-threaded environments such as event loops, where a
+ * long computation on a large curve would otherwise delay everything else.
+ *
+ * The dedicated secp256r1, Curve25519 and Curve448 backends
+ * (MBEDTLS_ECP_P256_FAST, MBEDTLS_ECP_X25519_FAST, MBEDTLS_ECP_X448_FAST)
+ * are not restartable: operations on these curves always complete in one
+ * call.
+ *
+ * Requires: MBEDTLS_ECP_C
+ *
+ * \warning This option cannot be used with MBEDTLS_ECP_ALT,
+ * MBEDTLS_ECP_INTERNAL_ALT, or any of the MBEDTLS_ECDH_xxx_ALT and
+ * MBEDTLS_ECDSA_xxx_ALT options.
+ *
+ * Uncomment this macro to enable restartable ECC operations.
+ */
+//#define MBEDTLS_ECP_RESTARTABLE
+
 /**
  * \def MBEDTLS_ECDSA_DETERMINISTIC
  *
@@ -883,6 +1001,18 @@
  */
 #define MBEDTLS_GENPRIME
 
+/**
+ * \def MBEDTLS_MPI_MONTMUL_UNROLLED
+ *
+ * Enable Montgomery multiplication and squaring routines specialised for
+ * moduli of 16, 24, 32, 48 and 64 limbs (1024 to 4096 bits with 64-bit
+ * limbs), used by mbedtls_mpi_exp_mod(). This speeds up RSA and DHM with
+ * the common key sizes, at the cost of a few kilobytes of code.
+ *
+ * Comment this macro to use the generic routines for all sizes.
+ */
+#define MBEDTLS_MPI_MONTMUL_UNROLLED
+
 /**
  * \def MBEDTLS_FS_IO
  *
@@ -958,6 +1088,28 @@
  */
 //#define MBEDTLS_ENTROPY_NV_SEED
 
+/**
+ * \def MBEDTLS_DRBG_FORK_SAFETY
+ *
+ * Make the CTR_DRBG and HMAC_DRBG modules detect a fork() automatically.
+ *
+ * When a context is used in a process other than the one that last seeded
+ * or used it, the process must be a child that inherited a copy of the
+ * parent's state. The context then mixes child-specific data (process IDs
+ * and high-resolution timestamps) into its state before generating output,
+ * so that children never share a DRBG state with their parent or siblings,
+ * without paying for a full reseed from the entropy source on the first
+ * request. Since that data is largely predictable, the child's following
+ * request reseeds from the entropy source (and fails if that fails).
+ *
+ * Requires: POSIX getpid(), getppid() and clock_gettime()
+ *
+ * \note This costs one getpid() call per random generation request.
+ *
+ * Uncomment this macro to enable automatic fork detection in the DRBGs.
+ */
+//#define MBEDTLS_DRBG_FORK_SAFETY
+
 /**
  * \def MBEDTLS_MEMORY_DEBUG
  *
@@ -1919,6 +2071,33 @@
  */
 #define MBEDTLS_ECP_C
 
+/**
+ * \def MBEDTLS_ECP_POOL_C
+ *
+ * Enable the pool of precomputed ephemeral EC values (ECDHE keypairs and
+ * ECDSA nonces), see \c mbedtls_ssl_conf_ecp_pool().
+ *
+ * Module:  library/ecp_pool.c
+ * Caller:  library/ssl_srv.c
+ *
+ * Requires: MBEDTLS_ECP_C
+ */
+#define MBEDTLS_ECP_POOL_C
+
+/**
+ * \def MBEDTLS_ED25519_C
+ *
+ * Enable Ed25519 signatures (RFC 8032).
+ *
+ * Module:  library/ed25519.c
+ * Caller:  library/pk_wrap.c
+ *
+ * This module shares the field arithmetic of library/ecp_x25519.c.
+ *
+ * Requires: MBEDTLS_BIGNUM_C, MBEDTLS_SHA512_C
+ */
+#define MBEDTLS_ED25519_C
+
 /**
  * \def MBEDTLS_ENTROPY_C
  *
@@ -2605,6 +2784,8 @@
 /* MPI / BIGNUM options */
 //#define MBEDTLS_MPI_WINDOW_SIZE            6 /**< Maximum windows size used. */
 //#define MBEDTLS_MPI_MAX_SIZE            1024 /**< Maximum number of bytes for usable MPIs. */
+//#define MBEDTLS_MPI_KARATSUBA_THRESHOLD   32 /**< Minimum number of limbs for Karatsuba multiplication. */
+//#define MBEDTLS_MPI_GEN_PRIME_THREADS      1 /**< Threads used by mbedtls_mpi_gen_prime(), >1 requires MBEDTLS_THREADING_PTHREAD. */
 
 /* CTR_DRBG options */
 //#define MBEDTLS_CTR_DRBG_ENTROPY_LEN               48 /**< Amount of entropy used per seed by default (48 with SHA-512, 32 with SHA-256) */
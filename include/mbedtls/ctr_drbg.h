@@ -103,6 +103,10 @@ typedef struct
 
     void *p_entropy;            /*!<  context for the entropy function */
 
+#if defined(MBEDTLS_DRBG_FORK_SAFETY)
+    long pid;                   /*!<  process that last used the context */
+#endif
+
 #if defined(MBEDTLS_THREADING_C)
     mbedtls_threading_mutex_t mutex;
 #endif
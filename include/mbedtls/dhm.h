@@ -155,7 +155,7 @@ typedef struct
     mbedtls_mpi GX;     /*!<  self = G^X mod P  */
     mbedtls_mpi GY;     /*!<  peer = G^Y mod P  */
     mbedtls_mpi K;      /*!<  key = GY^X mod P  */
-    mbedtls_mpi RP;     /*!<  cached R^2 mod P  */
+    mbedtls_mpi_mod_ctx P_mod;  /*!<  cached constants mod P  */
     mbedtls_mpi Vi;     /*!<  blinding value    */
     mbedtls_mpi Vf;     /*!<  un-blinding value */
     mbedtls_mpi pX;     /*!<  previous X        */
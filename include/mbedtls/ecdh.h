@@ -52,6 +52,10 @@ typedef struct
     mbedtls_ecp_point Vi;       /*!<  blinding value (for later)                    */
     mbedtls_ecp_point Vf;       /*!<  un-blinding value (for later)                 */
     mbedtls_mpi _d;             /*!<  previous d (for later)                        */
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    int restart_enabled;        /*!<  enable restartable EC computations?           */
+    mbedtls_ecp_restart_ctx rs; /*!<  restart context for EC computations           */
+#endif
 }
 mbedtls_ecdh_context;
 
@@ -109,6 +113,22 @@ void mbedtls_ecdh_init( mbedtls_ecdh_context *ctx );
  */
 void mbedtls_ecdh_free( mbedtls_ecdh_context *ctx );
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+/**
+ * \brief           Enable restartable EC computations for this context.
+ *                  (Default: disabled.)
+ *
+ * \sa              \c mbedtls_ecp_set_max_ops()
+ *
+ * \note            It is not possible to safely disable restartable
+ *                  computations once enabled, except by free-ing the context,
+ *                  which cancels possible in-progress operations.
+ *
+ * \param ctx       ECDH context
+ */
+void mbedtls_ecdh_enable_restart( mbedtls_ecdh_context *ctx );
+#endif /* MBEDTLS_ECP_RESTARTABLE */
+
 /**
  * \brief           Generate a public key and a TLS ServerKeyExchange payload.
  *                  (First function used by a TLS server for ECDHE.)
@@ -123,13 +143,33 @@ void mbedtls_ecdh_free( mbedtls_ecdh_context *ctx );
  * \note            This function assumes that ctx->grp has already been
  *                  properly set (for example using mbedtls_ecp_group_load).
  *
- * \return          0 if successful, or an MBEDTLS_ERR_ECP_XXX error code
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_ECP_IN_PROGRESS if maximum number of
+ *                  operations was reached: see \c mbedtls_ecp_set_max_ops()
+ *                  (only when restart was enabled with
+ *                  \c mbedtls_ecdh_enable_restart()),
+ *                  or another MBEDTLS_ERR_ECP_XXX error code
  */
 int mbedtls_ecdh_make_params( mbedtls_ecdh_context *ctx, size_t *olen,
                       unsigned char *buf, size_t blen,
                       int (*f_rng)(void *, unsigned char *, size_t),
                       void *p_rng );
 
+/**
+ * \brief           Write a TLS ServerKeyExchange payload for the public key
+ *                  already present in ctx->Q, for example one taken from a
+ *                  pool of precomputed keys (see \c ecp_pool.h).
+ *
+ * \param ctx       ECDH context, with grp, d and Q set
+ * \param olen      number of chars written
+ * \param buf       destination buffer
+ * \param blen      length of buffer
+ *
+ * \return          0 if successful, or an MBEDTLS_ERR_ECP_XXX error code
+ */
+int mbedtls_ecdh_write_params( mbedtls_ecdh_context *ctx, size_t *olen,
+                               unsigned char *buf, size_t blen );
+
 /**
  * \brief           Parse and procress a TLS ServerKeyExhange payload.
  *                  (First function used by a TLS client for ECDHE.)
@@ -169,7 +209,12 @@ int mbedtls_ecdh_get_params( mbedtls_ecdh_context *ctx, const mbedtls_ecp_keypai
  * \param f_rng     RNG function
  * \param p_rng     RNG parameter
  *
- * \return          0 if successful, or an MBEDTLS_ERR_ECP_XXX error code
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_ECP_IN_PROGRESS if maximum number of
+ *                  operations was reached: see \c mbedtls_ecp_set_max_ops()
+ *                  (only when restart was enabled with
+ *                  \c mbedtls_ecdh_enable_restart()),
+ *                  or another MBEDTLS_ERR_ECP_XXX error code
  */
 int mbedtls_ecdh_make_public( mbedtls_ecdh_context *ctx, size_t *olen,
                       unsigned char *buf, size_t blen,
@@ -200,7 +245,12 @@ int mbedtls_ecdh_read_public( mbedtls_ecdh_context *ctx,
  * \param f_rng     RNG function, see notes for \c mbedtls_ecdh_compute_shared()
  * \param p_rng     RNG parameter
  *
- * \return          0 if successful, or an MBEDTLS_ERR_ECP_XXX error code
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_ECP_IN_PROGRESS if maximum number of
+ *                  operations was reached: see \c mbedtls_ecp_set_max_ops()
+ *                  (only when restart was enabled with
+ *                  \c mbedtls_ecdh_enable_restart()),
+ *                  or another MBEDTLS_ERR_ECP_XXX error code
  */
 int mbedtls_ecdh_calc_secret( mbedtls_ecdh_context *ctx, size_t *olen,
                       unsigned char *buf, size_t blen,
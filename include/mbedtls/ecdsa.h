@@ -51,6 +51,53 @@
  */
 typedef mbedtls_ecp_keypair mbedtls_ecdsa_context;
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+
+/**
+ * \brief           Internal restart context for ecdsa_verify()
+ *
+ * \note            Opaque struct, defined in ecdsa.c
+ */
+typedef struct mbedtls_ecdsa_restart_ver mbedtls_ecdsa_restart_ver_ctx;
+
+/**
+ * \brief           Internal restart context for ecdsa_sign()
+ *
+ * \note            Opaque struct, defined in ecdsa.c
+ */
+typedef struct mbedtls_ecdsa_restart_sig mbedtls_ecdsa_restart_sig_ctx;
+
+#if defined(MBEDTLS_ECDSA_DETERMINISTIC)
+/**
+ * \brief           Internal restart context for ecdsa_sign_det()
+ *
+ * \note            Opaque struct, defined in ecdsa.c
+ */
+typedef struct mbedtls_ecdsa_restart_det mbedtls_ecdsa_restart_det_ctx;
+#endif
+
+/**
+ * \brief           General context for resuming ECDSA operations
+ */
+typedef struct
+{
+    mbedtls_ecp_restart_ctx ecp;        /*!<  base context for ECP restart and
+                                              shared administrative info    */
+    mbedtls_ecdsa_restart_ver_ctx *ver; /*!<  ecdsa_verify() sub-context    */
+    mbedtls_ecdsa_restart_sig_ctx *sig; /*!<  ecdsa_sign() sub-context      */
+#if defined(MBEDTLS_ECDSA_DETERMINISTIC)
+    mbedtls_ecdsa_restart_det_ctx *det; /*!<  ecdsa_sign_det() sub-context  */
+#endif
+}
+mbedtls_ecdsa_restart_ctx;
+
+#else /* MBEDTLS_ECP_RESTARTABLE */
+
+/* Now we can declare functions that take a pointer to that */
+typedef void mbedtls_ecdsa_restart_ctx;
+
+#endif /* MBEDTLS_ECP_RESTARTABLE */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -105,6 +152,34 @@ int mbedtls_ecdsa_sign_det( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi
                     mbedtls_md_type_t md_alg );
 #endif /* MBEDTLS_ECDSA_DETERMINISTIC */
 
+/**
+ * \brief           Compute ECDSA signature of a previously hashed message,
+ *                  using a nonce prepared in advance.
+ *
+ * \param grp       ECP group
+ * \param s         Second output integer (the first one is r)
+ * \param d         Private signing key
+ * \param buf       Message hash
+ * \param blen      Length of buf
+ * \param k_inv     Inverse of the nonce k modulo the group order
+ * \param r         x coordinate of kG modulo the group order
+ *
+ * \note            This does no scalar multiplication, it only completes
+ *                  the signature (SEC1 4.1.3 steps 5-6). The nonce must come
+ *                  from a trustworthy source such as
+ *                  \c mbedtls_ecp_pool_take_nonce(), and must never be used
+ *                  twice: doing so reveals the private key.
+ *
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_ECP_BAD_INPUT_DATA if k_inv or r is out of
+ *                  range, MBEDTLS_ERR_ECP_RANDOM_FAILED if this nonce yields
+ *                  s = 0 (pick another one),
+ *                  or a MBEDTLS_ERR_ECP_XXX or MBEDTLS_MPI_XXX error code
+ */
+int mbedtls_ecdsa_sign_with_nonce( mbedtls_ecp_group *grp, mbedtls_mpi *s,
+                    const mbedtls_mpi *d, const unsigned char *buf, size_t blen,
+                    const mbedtls_mpi *k_inv, const mbedtls_mpi *r );
+
 /**
  * \brief           Verify ECDSA signature of a previously hashed message
  *
@@ -127,6 +202,42 @@ int mbedtls_ecdsa_verify( mbedtls_ecp_group *grp,
                   const unsigned char *buf, size_t blen,
                   const mbedtls_ecp_point *Q, const mbedtls_mpi *r, const mbedtls_mpi *s);
 
+/**
+ * \brief           Verify several ECDSA signatures of previously hashed
+ *                  messages at once
+ *
+ * \param grp       ECP group
+ * \param count     Number of signatures
+ * \param buf       Array of count message hashes
+ * \param blen      Array of count hash lengths
+ * \param Q         Array of count public keys to use for verification
+ * \param r         Array of count first integers of the signatures
+ * \param s         Array of count second integers of the signatures
+ * \param results   Array of count ints receiving the result of
+ *                  \c mbedtls_ecdsa_verify() for each signature, or NULL
+ *
+ * \note            Each signature is still checked on its own, so that
+ *                  results tells exactly which ones are invalid, but the
+ *                  inversions of s modulo the group order are shared, and
+ *                  so are the inversions that bring the points computed
+ *                  in step 5 back to affine coordinates. This makes each
+ *                  verification noticeably cheaper than with
+ *                  \c mbedtls_ecdsa_verify() as soon as a few signatures
+ *                  are verified together. Public keys may be repeated.
+ *
+ * \return          0 if all signatures are valid,
+ *                  MBEDTLS_ERR_ECP_VERIFY_FAILED if at least one of them
+ *                  is invalid (see results for details),
+ *                  or another MBEDTLS_ERR_ECP_XXX or MBEDTLS_MPI_XXX error
+ *                  code if the verification could not be completed (in which
+ *                  case the contents of results are unspecified)
+ */
+int mbedtls_ecdsa_verify_batch( mbedtls_ecp_group *grp, size_t count,
+                  const unsigned char *buf[], const size_t blen[],
+                  const mbedtls_ecp_point *Q[],
+                  const mbedtls_mpi r[], const mbedtls_mpi s[],
+                  int results[] );
+
 /**
  * \brief           Compute ECDSA signature and write it to buffer,
  *                  serialized as defined in RFC 4492 page 20.
@@ -162,6 +273,61 @@ int mbedtls_ecdsa_write_signature( mbedtls_ecdsa_context *ctx, mbedtls_md_type_t
                            int (*f_rng)(void *, unsigned char *, size_t),
                            void *p_rng );
 
+/**
+ * \brief           Compute ECDSA signature and write it to buffer,
+ *                  serialized as defined in RFC 4492 page 20.
+ *                  Restartable version of \c mbedtls_ecdsa_write_signature()
+ *
+ * \note            Performs the same job as \c mbedtls_ecdsa_write_signature(),
+ *                  but can return early and restart according to the limit
+ *                  set with \c mbedtls_ecp_set_max_ops() to reduce blocking.
+ *
+ * \param ctx       ECDSA context
+ * \param md_alg    Algorithm that was used to hash the message
+ * \param hash      Message hash
+ * \param hlen      Length of hash
+ * \param sig       Buffer that will hold the signature
+ * \param slen      Length of the signature written
+ * \param f_rng     RNG function
+ * \param p_rng     RNG parameter
+ * \param rs_ctx    Restart context (NULL to disable restart)
+ *
+ * \return          Same as \c mbedtls_ecdsa_write_signature(), or
+ *                  MBEDTLS_ERR_ECP_IN_PROGRESS if maximum number of
+ *                  operations was reached: see \c mbedtls_ecp_set_max_ops().
+ */
+int mbedtls_ecdsa_write_signature_restartable( mbedtls_ecdsa_context *ctx,
+                           mbedtls_md_type_t md_alg,
+                           const unsigned char *hash, size_t hlen,
+                           unsigned char *sig, size_t *slen,
+                           int (*f_rng)(void *, unsigned char *, size_t),
+                           void *p_rng,
+                           mbedtls_ecdsa_restart_ctx *rs_ctx );
+
+/**
+ * \brief           Compute ECDSA signature with a nonce prepared in advance
+ *                  and write it to buffer, serialized as defined in
+ *                  RFC 4492 page 20.
+ *
+ * \note            Same as \c mbedtls_ecdsa_write_signature(), except for the
+ *                  origin of the nonce, see \c mbedtls_ecdsa_sign_with_nonce().
+ *
+ * \param ctx       ECDSA context
+ * \param hash      Message hash
+ * \param hlen      Length of hash
+ * \param k_inv     Inverse of the nonce k modulo the group order
+ * \param r         x coordinate of kG modulo the group order
+ * \param sig       Buffer that will hold the signature
+ * \param slen      Length of the signature written
+ *
+ * \return          Same as \c mbedtls_ecdsa_sign_with_nonce(), or
+ *                  an MBEDTLS_ERR_ASN1_XXX error code
+ */
+int mbedtls_ecdsa_write_signature_with_nonce( mbedtls_ecdsa_context *ctx,
+                           const unsigned char *hash, size_t hlen,
+                           const mbedtls_mpi *k_inv, const mbedtls_mpi *r,
+                           unsigned char *sig, size_t *slen );
+
 #if defined(MBEDTLS_ECDSA_DETERMINISTIC)
 #if ! defined(MBEDTLS_DEPRECATED_REMOVED)
 #if defined(MBEDTLS_DEPRECATED_WARNING)
@@ -227,6 +393,29 @@ int mbedtls_ecdsa_read_signature( mbedtls_ecdsa_context *ctx,
                           const unsigned char *hash, size_t hlen,
                           const unsigned char *sig, size_t slen );
 
+/**
+ * \brief           Restartable read and verify an ECDSA signature
+ *
+ * \note            Performs the same job as \c mbedtls_ecdsa_read_signature(),
+ *                  but can return early and restart according to the limit
+ *                  set with \c mbedtls_ecp_set_max_ops() to reduce blocking.
+ *
+ * \param ctx       ECDSA context
+ * \param hash      Message hash
+ * \param hlen      Size of hash
+ * \param sig       Signature to read and verify
+ * \param slen      Size of sig
+ * \param rs_ctx    Restart context (NULL to disable restart)
+ *
+ * \return          Same as \c mbedtls_ecdsa_read_signature(), or
+ *                  MBEDTLS_ERR_ECP_IN_PROGRESS if maximum number of
+ *                  operations was reached: see \c mbedtls_ecp_set_max_ops().
+ */
+int mbedtls_ecdsa_read_signature_restartable( mbedtls_ecdsa_context *ctx,
+                          const unsigned char *hash, size_t hlen,
+                          const unsigned char *sig, size_t slen,
+                          mbedtls_ecdsa_restart_ctx *rs_ctx );
+
 /**
  * \brief           Generate an ECDSA keypair on the given curve
  *
@@ -265,6 +454,18 @@ void mbedtls_ecdsa_init( mbedtls_ecdsa_context *ctx );
  */
 void mbedtls_ecdsa_free( mbedtls_ecdsa_context *ctx );
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+/**
+ * \brief           Initialize a restart context
+ */
+void mbedtls_ecdsa_restart_init( mbedtls_ecdsa_restart_ctx *ctx );
+
+/**
+ * \brief           Free the components of a restart context
+ */
+void mbedtls_ecdsa_restart_free( mbedtls_ecdsa_restart_ctx *ctx );
+#endif /* MBEDTLS_ECP_RESTARTABLE */
+
 #ifdef __cplusplus
 }
 #endif
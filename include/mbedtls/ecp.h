@@ -36,6 +36,8 @@
 #define MBEDTLS_ERR_ECP_RANDOM_FAILED                     -0x4D00  /**< Generation of random value, such as (ephemeral) key, failed. */
 #define MBEDTLS_ERR_ECP_INVALID_KEY                       -0x4C80  /**< Invalid private or public key. */
 #define MBEDTLS_ERR_ECP_SIG_LEN_MISMATCH                  -0x4C00  /**< Signature is valid but shorter than the user-supplied length. */
+#define MBEDTLS_ERR_ECP_POOL_EMPTY                        -0x4B80  /**< No precomputed value of the requested kind is available. */
+#define MBEDTLS_ERR_ECP_IN_PROGRESS                       -0x4B00  /**< Operation in progress, call again with the same parameters to continue. */
 
 #if !defined(MBEDTLS_ECP_ALT)
 /*
@@ -74,14 +76,23 @@ typedef enum
     MBEDTLS_ECP_DP_SECP192K1,      /*!< 192-bits "Koblitz" curve */
     MBEDTLS_ECP_DP_SECP224K1,      /*!< 224-bits "Koblitz" curve */
     MBEDTLS_ECP_DP_SECP256K1,      /*!< 256-bits "Koblitz" curve */
+    MBEDTLS_ECP_DP_CURVE448,       /*!< Curve448                 */
 } mbedtls_ecp_group_id;
 
 /**
  * Number of supported curves (plus one for NONE).
- *
- * (Montgomery curves excluded for now.)
  */
-#define MBEDTLS_ECP_DP_MAX     12
+#define MBEDTLS_ECP_DP_MAX     14
+
+/**
+ * Curve types
+ */
+typedef enum
+{
+    MBEDTLS_ECP_TYPE_NONE = 0,
+    MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS,    /* y^2 = x^3 + a x + b      */
+    MBEDTLS_ECP_TYPE_MONTGOMERY,           /* y^2 = x^3 + a x^2 + x    */
+} mbedtls_ecp_curve_type;
 
 /**
  * Curve information for use by other modules
@@ -116,7 +127,7 @@ mbedtls_ecp_point;
  *
  * We consider two types of curves equations:
  * 1. Short Weierstrass y^2 = x^3 + A x + B     mod P   (SEC1 + RFC 4492)
- * 2. Montgomery,       y^2 = x^3 + A x^2 + x   mod P   (Curve25519 + draft)
+ * 2. Montgomery,       y^2 = x^3 + A x^2 + x   mod P   (Curve25519, Curve448)
  * In both cases, a generator G for a prime-order subgroup is fixed. In the
  * short weierstrass, this subgroup is actually the whole curve, and its
  * cardinal is denoted by N.
@@ -128,12 +139,21 @@ mbedtls_ecp_point;
  * the quantity actually used in the formulas. Also, nbits is not the size of N
  * but the required size for private keys.
  *
- * If modp is NULL, reduction modulo P is done using a generic algorithm.
+ * If modp is NULL, reduction modulo P is done using a generic algorithm:
+ * Montgomery reduction with the constants in P_mod for the built-in curves,
+ * which then keep their field elements in Montgomery form x R mod P during
+ * computations (mont_one, mont_A and mont_B hold 1, A and B in that form;
+ * with MBEDTLS_ECP_INTERNAL_ALT they are unset and Barrett reduction is
+ * used instead), or a plain division when P_mod is not set up.
  * Otherwise, it must point to a function that takes an mbedtls_mpi in the range
  * 0..2^(2*pbits)-1 and transforms it in-place in an integer of little more
  * than pbits, so that the integer may be efficiently brought in the 0..P-1
  * range by a few additions or substractions. It must return 0 on success and
  * non-zero on failure.
+ *
+ * For the built-in curves, T points to a read-only table of multiples of G
+ * (T_size is 0 in that case), so that multiplications by G do not modify the
+ * group. For other groups it is allocated on first use.
  */
 typedef struct
 {
@@ -151,7 +171,11 @@ typedef struct
     int (*t_post)(mbedtls_ecp_point *, void *); /*!< unused                         */
     void *t_data;                       /*!< unused                         */
     mbedtls_ecp_point *T;       /*!<  pre-computed points for ecp_mul_comb()        */
-    size_t T_size;      /*!<  number for pre-computed points                */
+    size_t T_size;      /*!<  number for pre-computed points, 0 if static   */
+    mbedtls_mpi_mod_ctx P_mod;  /*!<  reduction constants for P, if modp is NULL */
+    mbedtls_mpi mont_one;       /*!<  1 in Montgomery form (R mod P), or unset  */
+    mbedtls_mpi mont_A;         /*!<  A in Montgomery form, or unset            */
+    mbedtls_mpi mont_B;         /*!<  B in Montgomery form, or unset            */
 }
 mbedtls_ecp_group;
 
@@ -167,9 +191,82 @@ typedef struct
     mbedtls_ecp_group grp;      /*!<  Elliptic curve and base point     */
     mbedtls_mpi d;              /*!<  our secret value                  */
     mbedtls_ecp_point Q;        /*!<  our public value                  */
+    mbedtls_ecp_point *T;       /*!<  pre-computed points for Q, see
+                                      mbedtls_ecp_keypair_precompute()  */
+    size_t T_size;              /*!<  number for pre-computed points    */
 }
 mbedtls_ecp_keypair;
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+
+/**
+ * \brief           Internal restart context for multiplication
+ *
+ * \note            Opaque struct
+ */
+typedef struct mbedtls_ecp_restart_mul mbedtls_ecp_restart_mul_ctx;
+
+/**
+ * \brief           Internal restart context for ecp_muladd()
+ *
+ * \note            Opaque struct
+ */
+typedef struct mbedtls_ecp_restart_muladd mbedtls_ecp_restart_muladd_ctx;
+
+/**
+ * \brief           General context for resuming ECC operations
+ *
+ *                  Must be initialized with mbedtls_ecp_restart_init()
+ *                  before its first use, and freed with
+ *                  mbedtls_ecp_restart_free() when done or when the
+ *                  operation is abandoned.
+ */
+typedef struct
+{
+    unsigned ops_done;                  /*!<  current ops count             */
+    unsigned depth;                     /*!<  call depth (0 = top-level)    */
+    mbedtls_ecp_restart_mul_ctx *rsm;   /*!<  mbedtls_ecp_mul() sub-context */
+    mbedtls_ecp_restart_muladd_ctx *ma; /*!<  ecp_muladd() sub-context      */
+}
+mbedtls_ecp_restart_ctx;
+
+/*
+ * Operation counts for restartable functions, in "basic operations"
+ * (see mbedtls_ecp_set_max_ops())
+ */
+#define MBEDTLS_ECP_OPS_CHK   3 /*!< basic ops count for ecp_check_pubkey() */
+#define MBEDTLS_ECP_OPS_DBL   8 /*!< basic ops count for ecp_double_jac()   */
+#define MBEDTLS_ECP_OPS_ADD  11 /*!< basic ops count for ecp_add_mixed()    */
+#define MBEDTLS_ECP_OPS_INV 120 /*!< empirical equivalent for mpi_inv_mod() */
+
+/**
+ * \brief           Internal; for restartable functions in other modules.
+ *                  Check and update basic ops budget.
+ *
+ * \param grp       Group structure
+ * \param rs_ctx    Restart context
+ * \param ops       Number of basic ops to do
+ *
+ * \return          0 if doing \p ops basic ops is still allowed,
+ *                  MBEDTLS_ERR_ECP_IN_PROGRESS otherwise.
+ */
+int mbedtls_ecp_check_budget( const mbedtls_ecp_group *grp,
+                              mbedtls_ecp_restart_ctx *rs_ctx,
+                              unsigned ops );
+
+/* Utility macro for checking and updating ops budget */
+#define MBEDTLS_ECP_BUDGET( ops )   MBEDTLS_MPI_CHK( mbedtls_ecp_check_budget( grp, rs_ctx, \
+                                                     (unsigned) ( ops ) ) );
+
+#else /* MBEDTLS_ECP_RESTARTABLE */
+
+#define MBEDTLS_ECP_BUDGET( ops )   /* no-op */
+
+/* The restartable variants of the functions below take this argument anyway */
+typedef void mbedtls_ecp_restart_ctx;
+
+#endif /* MBEDTLS_ECP_RESTARTABLE */
+
 /**
  * \name SECTION: Module settings
  *
@@ -220,9 +317,12 @@ mbedtls_ecp_keypair;
  * multiplication in ECDSA signatures, and half of the multiplications in
  * ECDSA verification and ECDHE) by a factor roughly 3 to 4.
  *
- * The cost is increasing EC peak memory usage by a factor roughly 2.
+ * For the built-in curves, the precomputed points are static tables in
+ * ecp_curves.c, which costs code size (2 to 7 KB per curve) but no
+ * RAM. For other groups, the cost is increasing EC peak memory usage by a
+ * factor roughly 2.
  *
- * Change this value to 0 to reduce peak memory usage.
+ * Change this value to 0 to reduce code size and peak memory usage.
  */
 #define MBEDTLS_ECP_FIXED_POINT_OPTIM  1   /**< Enable fixed-point speed-up */
 #endif /* MBEDTLS_ECP_FIXED_POINT_OPTIM */
@@ -284,6 +384,89 @@ const mbedtls_ecp_curve_info *mbedtls_ecp_curve_info_from_tls_id( uint16_t tls_i
  */
 const mbedtls_ecp_curve_info *mbedtls_ecp_curve_info_from_name( const char *name );
 
+/**
+ * \brief           Get the type of a curve
+ *
+ * \param grp       Group
+ *
+ * \return          MBEDTLS_ECP_TYPE_MONTGOMERY for Montgomery curves,
+ *                  whose points are transmitted as a little-endian x
+ *                  coordinate (RFC 7748), MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS
+ *                  for short Weierstrass curves, or MBEDTLS_ECP_TYPE_NONE if
+ *                  the group is not set up
+ */
+mbedtls_ecp_curve_type mbedtls_ecp_get_type( const mbedtls_ecp_group *grp );
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+/**
+ * \brief           Set the maximum number of basic operations done in a row.
+ *
+ *                  If more operations are needed to complete a computation,
+ *                  #MBEDTLS_ERR_ECP_IN_PROGRESS will be returned by the
+ *                  function performing the computation. It is then the
+ *                  caller's responsibility to either call again with the same
+ *                  parameters until it returns 0 or an error code; or to free
+ *                  the restart context if the operation is to be aborted.
+ *
+ *                  It is strictly required that all input parameters and the
+ *                  restart context be the same on successive calls for the
+ *                  same operation, but output parameters need not be the
+ *                  same; they must not be used until the function finally
+ *                  returns 0.
+ *
+ *                  This only applies to functions whose documentation
+ *                  mentions they may return #MBEDTLS_ERR_ECP_IN_PROGRESS (or
+ *                  #MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS for functions in the
+ *                  SSL module). For functions that accept a "restart context"
+ *                  argument, passing NULL disables restart and makes the
+ *                  function equivalent to the function with the same name
+ *                  with \c _restartable removed. For functions in the ECDH
+ *                  module, restart is disabled unless the function accepts
+ *                  an "ECDH context" argument and mbedtls_ecdh_enable_restart()
+ *                  was previously called on that context. For functions in
+ *                  the SSL module, restart applies to the ECDH and ECDSA
+ *                  operations of the handshake, see mbedtls_ssl_handshake().
+ *
+ * \param max_ops   Maximum number of basic operations done in a row.
+ *                  Default: 0 (unlimited).
+ *                  Lower (non-zero) values mean ECC functions will block for
+ *                  a lesser maximum amount of time.
+ *
+ * \note            A "basic operation" is defined as a rough equivalent of a
+ *                  multiplication in GF(p) for the NIST P-256 curve.
+ *                  As an indication, with default settings, a scalar
+ *                  multiplication (full run of \c mbedtls_ecp_mul()) is:
+ *                  - about 3300 basic operations for P-256
+ *                  - about 9400 basic operations for P-384
+ *
+ * \note            Very low values are not always respected: sometimes
+ *                  functions need to block for a minimum number of
+ *                  operations, and will do so even if max_ops is set to a
+ *                  lower value. That minimum depends on the curve size, and
+ *                  can be made lower by decreasing the value of
+ *                  \c MBEDTLS_ECP_WINDOW_SIZE. As an indication, the lowest
+ *                  effective value is about 400 for P-384 and 1400 for
+ *                  P-521 with the default window size.
+ *
+ * \note            Multiplications on secp256r1, Curve25519 and Curve448
+ *                  that use the dedicated backends (MBEDTLS_ECP_P256_FAST,
+ *                  MBEDTLS_ECP_X25519_FAST, MBEDTLS_ECP_X448_FAST) are not
+ *                  affected: they always complete in one call.
+ *
+ * \note            This setting is global to the library and not
+ *                  thread-safe: set it once before starting any operation.
+ */
+void mbedtls_ecp_set_max_ops( unsigned max_ops );
+
+/**
+ * \brief           Check if restart is enabled (max_ops != 0)
+ *
+ * \return          0 if max_ops == 0 (restart disabled)
+ *                  1 otherwise (restart enabled)
+ */
+int mbedtls_ecp_restart_is_enabled( void );
+#endif /* MBEDTLS_ECP_RESTARTABLE */
+
 /**
  * \brief           Initialize a point (as zero)
  */
@@ -314,6 +497,18 @@ void mbedtls_ecp_group_free( mbedtls_ecp_group *grp );
  */
 void mbedtls_ecp_keypair_free( mbedtls_ecp_keypair *key );
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+/**
+ * \brief           Initialize a restart context
+ */
+void mbedtls_ecp_restart_init( mbedtls_ecp_restart_ctx *ctx );
+
+/**
+ * \brief           Free the components of a restart context
+ */
+void mbedtls_ecp_restart_free( mbedtls_ecp_restart_ctx *ctx );
+#endif /* MBEDTLS_ECP_RESTARTABLE */
+
 /**
  * \brief           Copy the contents of point Q into P
  *
@@ -503,7 +698,10 @@ int mbedtls_ecp_tls_write_group( const mbedtls_ecp_group *grp, size_t *olen,
 
 /**
  * \brief           Multiplication by an integer: R = m * P
- *                  (Not thread-safe to use same group in multiple threads)
+ *                  (Not thread-safe to use same group in multiple threads,
+ *                  unless it was set up by mbedtls_ecp_group_load(),
+ *                  MBEDTLS_ECP_FIXED_POINT_OPTIM is enabled and
+ *                  MBEDTLS_ECP_INTERNAL_ALT is not)
  *
  * \note            In order to prevent timing attacks, this function
  *                  executes the exact same sequence of (base field)
@@ -531,13 +729,70 @@ int mbedtls_ecp_mul( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
              const mbedtls_mpi *m, const mbedtls_ecp_point *P,
              int (*f_rng)(void *, unsigned char *, size_t), void *p_rng );
 
+/**
+ * \brief           Restartable version of \c mbedtls_ecp_mul()
+ *
+ * \note            Performs the same job as \c mbedtls_ecp_mul(), but can
+ *                  return early and restart according to the limit set with
+ *                  \c mbedtls_ecp_set_max_ops() to reduce blocking.
+ *
+ * \param grp       ECP group
+ * \param R         Destination point
+ * \param m         Integer by which to multiply
+ * \param P         Point to multiply
+ * \param f_rng     RNG function (see notes of \c mbedtls_ecp_mul())
+ * \param p_rng     RNG parameter
+ * \param rs_ctx    Restart context (NULL to disable restart)
+ *
+ * \return          See \c mbedtls_ecp_mul(), or
+ *                  MBEDTLS_ERR_ECP_IN_PROGRESS if maximum number of
+ *                  operations was reached: see \c mbedtls_ecp_set_max_ops().
+ */
+int mbedtls_ecp_mul_restartable( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+             int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+             mbedtls_ecp_restart_ctx *rs_ctx );
+
+/**
+ * \brief           Several multiplications by integers: R[i] = m[i] * P[i]
+ *                  (Same thread-safety as \c mbedtls_ecp_mul())
+ *
+ * \note            Performs the same job as calling \c mbedtls_ecp_mul()
+ *                  count times, with the same protection against timing
+ *                  attacks, but on curves in short Weierstrass form the
+ *                  conversions of the results to affine coordinates share
+ *                  a single modular inversion. This is meant for bursts of
+ *                  ephemeral key generations or ECDH computations. On
+ *                  Montgomery curves, the results are computed one by one.
+ *
+ * \note            Points are passed by address, so that the same point
+ *                  (typically the generator) may appear several times.
+ *
+ * \param grp       ECP group
+ * \param R         Array of count destination points
+ * \param m         Array of count integers by which to multiply P[i]
+ * \param P         Array of count points to multiply by m[i]
+ * \param count     Number of multiplications
+ * \param f_rng     RNG function (see notes of \c mbedtls_ecp_mul())
+ * \param p_rng     RNG parameter
+ *
+ * \return          0 if successful, or the first error
+ *                  \c mbedtls_ecp_mul() would have returned (in which case
+ *                  the contents of R are unspecified)
+ */
+int mbedtls_ecp_mul_batch( mbedtls_ecp_group *grp, mbedtls_ecp_point R[],
+             const mbedtls_mpi m[], const mbedtls_ecp_point *P[],
+             size_t count,
+             int (*f_rng)(void *, unsigned char *, size_t), void *p_rng );
+
 /**
  * \brief           Multiplication and addition of two points by integers:
  *                  R = m * P + n * Q
  *                  (Not thread-safe to use same group in multiple threads)
  *
  * \note            In contrast to mbedtls_ecp_mul(), this function does not guarantee
- *                  a constant execution flow and timing.
+ *                  a constant execution flow and timing. It is meant for
+ *                  public scalars, as in signature verification.
  *
  * \param grp       ECP group
  * \param R         Destination point
@@ -555,6 +810,115 @@ int mbedtls_ecp_muladd( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
              const mbedtls_mpi *m, const mbedtls_ecp_point *P,
              const mbedtls_mpi *n, const mbedtls_ecp_point *Q );
 
+/**
+ * \brief           Restartable version of \c mbedtls_ecp_muladd()
+ *
+ * \note            Performs the same job as \c mbedtls_ecp_muladd(), but can
+ *                  return early and restart according to the limit set with
+ *                  \c mbedtls_ecp_set_max_ops() to reduce blocking.
+ *
+ * \param grp       ECP group
+ * \param R         Destination point
+ * \param m         Integer by which to multiply P
+ * \param P         Point to multiply by m
+ * \param n         Integer by which to multiply Q
+ * \param Q         Point to be multiplied by n
+ * \param rs_ctx    Restart context (NULL to disable restart)
+ *
+ * \return          See \c mbedtls_ecp_muladd(), or
+ *                  MBEDTLS_ERR_ECP_IN_PROGRESS if maximum number of
+ *                  operations was reached: see \c mbedtls_ecp_set_max_ops().
+ */
+int mbedtls_ecp_muladd_restartable(
+             mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+             const mbedtls_mpi *n, const mbedtls_ecp_point *Q,
+             mbedtls_ecp_restart_ctx *rs_ctx );
+
+/**
+ * \brief           Several multiplications and additions of two points by
+ *                  integers: R[i] = m[i] * P[i] + n[i] * Q[i]
+ *                  (Not thread-safe to use same group in multiple threads)
+ *
+ * \note            Performs the same job as calling \c mbedtls_ecp_muladd()
+ *                  count times, but the conversions of the results to
+ *                  affine coordinates share a single modular inversion.
+ *                  Like \c mbedtls_ecp_muladd(), this is NOT constant-time.
+ *
+ * \note            On secp256r1 and secp384r1 with MBEDTLS_ECP_P256_FAST or
+ *                  MBEDTLS_ECP_P384_FAST, the inversion is only shared if
+ *                  every m[i] and n[i] is in [1, N-1] and every P[i] and
+ *                  Q[i] is a valid point with Z = 1, as is the case in
+ *                  ECDSA verification. Otherwise each result is converted
+ *                  on its own.
+ *
+ * \note            Points are passed by address, so that the same point
+ *                  (typically the generator) may appear several times.
+ *
+ * \param grp       ECP group
+ * \param R         Array of count destination points
+ * \param m         Array of count integers by which to multiply P[i]
+ * \param P         Array of count points to multiply by m[i]
+ * \param n         Array of count integers by which to multiply Q[i]
+ * \param Q         Array of count points to be multiplied by n[i]
+ * \param count     Number of linear combinations
+ *
+ * \return          0 if successful, or the first error
+ *                  \c mbedtls_ecp_muladd() would have returned (in which case
+ *                  the contents of R are unspecified)
+ */
+int mbedtls_ecp_muladd_batch( mbedtls_ecp_group *grp, mbedtls_ecp_point R[],
+             const mbedtls_mpi m[], const mbedtls_ecp_point *P[],
+             const mbedtls_mpi n[], const mbedtls_ecp_point *Q[],
+             size_t count );
+
+/**
+ * \brief           Pre-compute multiples of the public key of a key pair,
+ *                  for faster use with \c mbedtls_ecp_muladd_keypair()
+ *
+ * \note            This is worth it for keys that verify many signatures
+ *                  over their lifetime, such as those of trusted CAs. The
+ *                  table takes 2^(MBEDTLS_ECP_WINDOW_SIZE - 1) points and is
+ *                  freed along with the key pair.
+ *
+ * \note            If key->Q is changed afterwards, the table is no longer
+ *                  used (but still takes memory) until this function is
+ *                  called again.
+ *
+ * \param key       Key pair with a valid public key
+ *
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_ECP_INVALID_KEY if key->Q is not valid,
+ *                  MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE for Montgomery curves,
+ *                  MBEDTLS_ERR_ECP_ALLOC_FAILED or MBEDTLS_ERR_MPI_XXX
+ *                  if the computation failed
+ */
+int mbedtls_ecp_keypair_precompute( mbedtls_ecp_keypair *key );
+
+/**
+ * \brief           Multiplication and addition with the public key of a
+ *                  key pair: R = m * P + n * key->Q
+ *                  (Not thread-safe to use same group in multiple threads)
+ *
+ * \note            Same as \c mbedtls_ecp_muladd( grp, R, m, P, n, &key->Q ),
+ *                  but uses the table from \c mbedtls_ecp_keypair_precompute()
+ *                  if there is one. Like \c mbedtls_ecp_muladd(), this is
+ *                  NOT constant-time. The key itself is not modified, so it
+ *                  may be shared between threads if grp is not.
+ *
+ * \param grp       ECP group, the same curve as key->grp
+ * \param R         Destination point
+ * \param m         Integer by which to multiply P
+ * \param P         Point to multiply by m
+ * \param n         Integer by which to multiply key->Q
+ * \param key       Key pair holding the public key
+ *
+ * \return          See \c mbedtls_ecp_muladd()
+ */
+int mbedtls_ecp_muladd_keypair( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+             const mbedtls_mpi *n, const mbedtls_ecp_keypair *key );
+
 /**
  * \brief           Check that a point is a valid public key on this curve
  *
@@ -593,6 +957,22 @@ int mbedtls_ecp_check_pubkey( const mbedtls_ecp_group *grp, const mbedtls_ecp_po
  */
 int mbedtls_ecp_check_privkey( const mbedtls_ecp_group *grp, const mbedtls_mpi *d );
 
+/**
+ * \brief           Generate a private key
+ *
+ * \param grp       ECP group
+ * \param d         Destination MPI (secret part)
+ * \param f_rng     RNG function
+ * \param p_rng     RNG parameter
+ *
+ * \return          0 if successful,
+ *                  or a MBEDTLS_ERR_ECP_XXX or MBEDTLS_MPI_XXX error code
+ */
+int mbedtls_ecp_gen_privkey( const mbedtls_ecp_group *grp,
+                     mbedtls_mpi *d,
+                     int (*f_rng)(void *, unsigned char *, size_t),
+                     void *p_rng );
+
 /**
  * \brief           Generate a keypair with configurable base point
  *
@@ -0,0 +1,161 @@
+/**
+ * \file ecp_p384.h
+ *
+ * \brief Dedicated constant-time arithmetic for secp384r1
+ *
+ *  Copyright (C) 2006-2017, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ *
+ *
+ *  This file declares the entry points of the secp384r1 backend enabled by
+ *  MBEDTLS_ECP_P384_FAST. They are called by mbedtls_ecp_mul(),
+ *  mbedtls_ecp_mul_batch(), mbedtls_ecp_muladd() and
+ *  mbedtls_ecp_muladd_batch() when the group is secp384r1; applications
+ *  are not expected to call them directly.
+ */
+#ifndef MBEDTLS_ECP_P384_H
+#define MBEDTLS_ECP_P384_H
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include "ecp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief           Multiplication by an integer on secp384r1: R = m * P
+ *
+ * \param R         Destination point
+ * \param m         Integer by which to multiply, 0 < m < N
+ * \param P         Point to multiply, a valid public key
+ *
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_MPI_XXX if writing R failed
+ *
+ * \note            The caller checks m and P. The computation runs in
+ *                  constant time and uses a precomputed table when P is
+ *                  the generator.
+ */
+int mbedtls_ecp_p384_mul( mbedtls_ecp_point *R, const mbedtls_mpi *m,
+                          const mbedtls_ecp_point *P );
+
+/**
+ * \brief           Several multiplications by integers on secp384r1:
+ *                  R[i] = m[i] * P[i]
+ *
+ * \param R         Array of count destination points
+ * \param m         Array of count integers, 0 < m[i] < N
+ * \param P         Array of count points to multiply, valid public keys
+ * \param count     Number of multiplications
+ *
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_ECP_ALLOC_FAILED if memory allocation failed,
+ *                  MBEDTLS_ERR_MPI_XXX if writing R failed
+ *
+ * \note            Same as count calls to \c mbedtls_ecp_p384_mul(), except
+ *                  that the conversions to affine coordinates share a
+ *                  single field inversion.
+ */
+int mbedtls_ecp_p384_mul_batch( mbedtls_ecp_point R[], const mbedtls_mpi m[],
+                                const mbedtls_ecp_point *P[], size_t count );
+
+/**
+ * \brief           Multiplication and addition of two points on
+ *                  secp384r1: R = m * P + n * Q
+ *
+ * \param R         Destination point, set to zero if the sum is zero
+ * \param m         Integer by which to multiply P, 0 < m < N
+ * \param P         Point to multiply by m, a valid public key
+ * \param n         Integer by which to multiply Q, 0 < n < N
+ * \param Q         Point to multiply by n, a valid public key
+ *
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_MPI_XXX if writing R failed
+ */
+int mbedtls_ecp_p384_muladd( mbedtls_ecp_point *R,
+                             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                             const mbedtls_mpi *n, const mbedtls_ecp_point *Q );
+
+/**
+ * \brief           Several multiplications and additions of two points on
+ *                  secp384r1: R[i] = m[i] * P[i] + n[i] * Q[i]
+ *
+ * \param R         Array of count destination points, each set to zero if
+ *                  the sum is zero
+ * \param m         Array of count integers, 0 < m[i] < N
+ * \param P         Array of count points to multiply by m[i], valid
+ *                  public keys
+ * \param n         Array of count integers, 0 < n[i] < N
+ * \param Q         Array of count points to multiply by n[i], valid
+ *                  public keys
+ * \param count     Number of linear combinations
+ *
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_ECP_ALLOC_FAILED if memory allocation failed,
+ *                  MBEDTLS_ERR_MPI_384384384 if writing R failed
+ *
+ * \note            Same as count calls to \c mbedtls_ecp_p384_muladd(),
+ *                  except that the conversions to affine coordinates share
+ *                  a single field inversion.
+ */
+int mbedtls_ecp_p384_muladd_batch( mbedtls_ecp_point R[],
+                                   const mbedtls_mpi m[],
+                                   const mbedtls_ecp_point *P[],
+                                   const mbedtls_mpi n[],
+                                   const mbedtls_ecp_point *Q[],
+                                   size_t count );
+
+/**
+ * \brief           Multiplication and addition of two points on
+ *                  secp384r1, the second one with a comb table:
+ *                  R = m * P + n * Q
+ *
+ * \param R         Destination point, set to zero if the sum is zero
+ * \param m         Integer by which to multiply P, 0 < m < N
+ * \param P         Point to multiply by m, a valid public key
+ * \param T         Comb table for Q, as built by
+ *                  \c mbedtls_ecp_keypair_precompute()
+ * \param T_size    Number of points in T
+ * \param k         Comb digits k[0..d] of n, or of N - n if neg is set;
+ *                  bit 7 of each digit is its sign
+ * \param d         Index of the last digit
+ * \param neg       Non-zero if the digits are those of N - n
+ *
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_ECP_ALLOC_FAILED if memory allocation failed,
+ *                  MBEDTLS_ERR_MPI_XXX if reading T or writing R failed
+ *
+ * \note            Only meant for public data (signature verification):
+ *                  the second part runs in variable time.
+ */
+int mbedtls_ecp_p384_muladd_comb( mbedtls_ecp_point *R,
+                                  const mbedtls_mpi *m,
+                                  const mbedtls_ecp_point *P,
+                                  const mbedtls_ecp_point T[], size_t T_size,
+                                  const unsigned char k[], size_t d, int neg );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ecp_p384.h */
@@ -0,0 +1,188 @@
+/**
+ * \file ecp_pool.h
+ *
+ * \brief Pool of precomputed ephemeral EC values
+ *
+ *  Copyright (C) 2006-2017, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+#ifndef MBEDTLS_ECP_POOL_H
+#define MBEDTLS_ECP_POOL_H
+
+#include "ecp.h"
+
+#if defined(MBEDTLS_THREADING_C)
+#include "threading.h"
+#endif
+
+/*
+ * The pool holds values whose computation is dominated by a scalar
+ * multiplication of the generator but that do not depend on the data they
+ * will later be used with: ECDHE keypairs and ECDSA nonces. Filling it when
+ * the application is idle (or from a separate thread) moves that cost out of
+ * the handshake. Every entry is handed out at most once and wiped when taken.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Kind of value stored in a pool entry
+ */
+typedef enum
+{
+    MBEDTLS_ECP_POOL_NONE = 0,      /*!< unused entry                       */
+    MBEDTLS_ECP_POOL_KEYPAIR,       /*!< ephemeral keypair (d, Q)           */
+    MBEDTLS_ECP_POOL_NONCE,         /*!< ECDSA nonce (k^-1 mod n, r)        */
+} mbedtls_ecp_pool_type;
+
+/**
+ * \brief           Pool entry
+ */
+typedef struct
+{
+    mbedtls_ecp_pool_type type;     /*!<  kind of value                         */
+    mbedtls_ecp_group_id grp_id;    /*!<  curve the value belongs to            */
+    mbedtls_mpi d;                  /*!<  private key, or k^-1 mod n            */
+    mbedtls_ecp_point Q;            /*!<  public key (keypairs only)            */
+    mbedtls_mpi r;                  /*!<  x(kG) mod n (nonces only)             */
+}
+mbedtls_ecp_pool_entry;
+
+/**
+ * \brief           Pool context
+ */
+typedef struct
+{
+    mbedtls_ecp_pool_entry *entries;    /*!<  storage, used entries first       */
+    size_t capacity;                    /*!<  number of allocated entries       */
+    size_t used;                        /*!<  number of entries holding a value */
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_threading_mutex_t mutex;    /*!<  protects entries and used         */
+#endif
+}
+mbedtls_ecp_pool_context;
+
+/**
+ * \brief           Initialize a pool context
+ *
+ * \param ctx       Context to initialize
+ */
+void mbedtls_ecp_pool_init( mbedtls_ecp_pool_context *ctx );
+
+/**
+ * \brief           Allocate storage for a pool
+ *
+ * \param ctx       Initialized pool context
+ * \param capacity  Maximum number of entries (all types and curves together)
+ *
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_ECP_BAD_INPUT_DATA if capacity is 0 or the
+ *                  pool was already set up,
+ *                  MBEDTLS_ERR_ECP_ALLOC_FAILED if allocation failed
+ */
+int mbedtls_ecp_pool_setup( mbedtls_ecp_pool_context *ctx, size_t capacity );
+
+/**
+ * \brief           Free a pool context, wiping all remaining entries
+ *
+ * \param ctx       Context to free
+ */
+void mbedtls_ecp_pool_free( mbedtls_ecp_pool_context *ctx );
+
+/**
+ * \brief           Add up to count freshly generated values to the pool.
+ *
+ *                  The expensive computations happen without holding the
+ *                  pool's lock, so this may be called from a background
+ *                  thread while other threads take entries (when
+ *                  MBEDTLS_THREADING_C is enabled). f_rng must then be safe
+ *                  to call from that thread.
+ *
+ * \param ctx       Pool context
+ * \param type      MBEDTLS_ECP_POOL_KEYPAIR or MBEDTLS_ECP_POOL_NONCE
+ * \param grp_id    Curve to generate values for. Nonces require a curve
+ *                  usable for ECDSA.
+ * \param count     Number of values to add. Generation stops early,
+ *                  without error, when the pool is full.
+ * \param f_rng     RNG function
+ * \param p_rng     RNG parameter
+ *
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_ECP_BAD_INPUT_DATA if the type or curve is not
+ *                  suitable, or another MBEDTLS_ERR_ECP_XXX or
+ *                  MBEDTLS_ERR_MPI_XXX error code
+ */
+int mbedtls_ecp_pool_fill( mbedtls_ecp_pool_context *ctx,
+                           mbedtls_ecp_pool_type type,
+                           mbedtls_ecp_group_id grp_id, size_t count,
+                           int (*f_rng)(void *, unsigned char *, size_t),
+                           void *p_rng );
+
+/**
+ * \brief           Count the entries of a given type and curve
+ *
+ * \param ctx       Pool context
+ * \param type      Type of the entries to count
+ * \param grp_id    Curve of the entries to count,
+ *                  or MBEDTLS_ECP_DP_NONE for all curves
+ *
+ * \return          Number of matching entries (0 if locking failed)
+ */
+size_t mbedtls_ecp_pool_count( mbedtls_ecp_pool_context *ctx,
+                               mbedtls_ecp_pool_type type,
+                               mbedtls_ecp_group_id grp_id );
+
+/**
+ * \brief           Take an ephemeral keypair out of the pool
+ *
+ * \param ctx       Pool context
+ * \param grp_id    Curve of the keypair
+ * \param d         Destination MPI (private key)
+ * \param Q         Destination point (public key)
+ *
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_ECP_POOL_EMPTY if no keypair for this curve
+ *                  is available, or another error code
+ */
+int mbedtls_ecp_pool_take_keypair( mbedtls_ecp_pool_context *ctx,
+                                   mbedtls_ecp_group_id grp_id,
+                                   mbedtls_mpi *d, mbedtls_ecp_point *Q );
+
+/**
+ * \brief           Take an ECDSA nonce out of the pool, in the form expected
+ *                  by \c mbedtls_ecdsa_sign_with_nonce()
+ *
+ * \param ctx       Pool context
+ * \param grp_id    Curve of the nonce
+ * \param k_inv     Destination MPI (inverse of the nonce modulo n)
+ * \param r         Destination MPI (x coordinate of kG modulo n)
+ *
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_ECP_POOL_EMPTY if no nonce for this curve
+ *                  is available, or another error code
+ */
+int mbedtls_ecp_pool_take_nonce( mbedtls_ecp_pool_context *ctx,
+                                 mbedtls_ecp_group_id grp_id,
+                                 mbedtls_mpi *k_inv, mbedtls_mpi *r );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ecp_pool.h */
@@ -0,0 +1,61 @@
+/**
+ * \file ecp_x448.h
+ *
+ * \brief Dedicated constant-time arithmetic for Curve448
+ *
+ *  Copyright (C) 2006-2017, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ *
+ *  This file declares the entry point of the Curve448 backend enabled by
+ *  MBEDTLS_ECP_X448_FAST. It is called by mbedtls_ecp_mul() when the group
+ *  is Curve448; applications are not expected to call it directly.
+ */
+#ifndef MBEDTLS_ECP_X448_H
+#define MBEDTLS_ECP_X448_H
+
+#include "ecp.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief           X448 scalar multiplication (RFC 7748): R = m * P,
+ *                  x-coordinate only
+ *
+ * \param R         Destination point; only X and Z are set
+ * \param m         Integer by which to multiply, a valid private key
+ * \param P         Point to multiply, a valid public key
+ *
+ * \return          0 if successful,
+ *                  MBEDTLS_ERR_MPI_NOT_ACCEPTABLE if the result is the
+ *                  point at infinity (P has small order),
+ *                  MBEDTLS_ERR_MPI_XXX if reading the inputs or writing R
+ *                  failed
+ *
+ * \note            The caller checks m and P. The computation runs in
+ *                  constant time. As with the generic code, X(P) is
+ *                  reduced modulo p.
+ */
+int mbedtls_ecp_x448_mul( mbedtls_ecp_point *R, const mbedtls_mpi *m,
+                          const mbedtls_ecp_point *P );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ecp_x448.h */
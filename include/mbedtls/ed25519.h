@@ -0,0 +1,183 @@
+/**
+ * \file ed25519.h
+ *
+ * \brief Ed25519 signatures (RFC 8032)
+ *
+ *  Copyright (C) 2006-2017, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+#ifndef MBEDTLS_ED25519_H
+#define MBEDTLS_ED25519_H
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MBEDTLS_ERR_ED25519_VERIFY_FAILED                 -0x0011  /**< The signature is not valid. */
+#define MBEDTLS_ERR_ED25519_INVALID_KEY                   -0x0013  /**< Invalid key: not a point on the curve, or no key set. */
+
+#define MBEDTLS_ED25519_KEY_SIZE    32  /**< Size of public and private keys */
+#define MBEDTLS_ED25519_SIG_SIZE    64  /**< Size of a signature */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief          Ed25519 context structure
+ *
+ *                 Holds a private key (the 32-byte seed of RFC 8032 and the
+ *                 values derived from it), a public key, or both.
+ *
+ *                 Setting the public key also stores a few multiples of
+ *                 it in the context, so that verification does not have
+ *                 to recompute them; keep the context around when checking
+ *                 many signatures from the same signer.
+ */
+typedef struct
+{
+    unsigned char seed[32];     /*!<  private key as given to set_private */
+    unsigned char scalar[32];   /*!<  secret scalar, little-endian        */
+    unsigned char prefix[32];   /*!<  nonce derivation key                */
+    unsigned char pub[32];      /*!<  encoded public key                  */
+    int has_private;            /*!<  seed, scalar and prefix are valid   */
+    int has_public;             /*!<  pub and table are valid             */
+    uint64_t table[8][4][5];    /*!<  odd multiples of -pub, radix 2^51   */
+}
+mbedtls_ed25519_context;
+
+/**
+ * \brief          Initialize an Ed25519 context
+ *
+ * \param ctx      Context to initialize
+ */
+void mbedtls_ed25519_init( mbedtls_ed25519_context *ctx );
+
+/**
+ * \brief          Free the components of an Ed25519 context
+ *
+ * \param ctx      Context to free
+ */
+void mbedtls_ed25519_free( mbedtls_ed25519_context *ctx );
+
+/**
+ * \brief          Generate a new key pair
+ *
+ * \param ctx      Context to fill
+ * \param f_rng    RNG function
+ * \param p_rng    RNG parameter
+ *
+ * \return         0 if successful, or a non-zero error from f_rng
+ */
+int mbedtls_ed25519_genkey( mbedtls_ed25519_context *ctx,
+                    int (*f_rng)(void *, unsigned char *, size_t),
+                    void *p_rng );
+
+/**
+ * \brief          Set the private key and derive the public key from it
+ *
+ * \param ctx      Context to fill
+ * \param key      32-byte private key
+ *
+ * \return         0 if successful
+ */
+int mbedtls_ed25519_set_private( mbedtls_ed25519_context *ctx,
+                                 const unsigned char key[32] );
+
+/**
+ * \brief          Set the public key, clearing any private key
+ *
+ * \param ctx      Context to fill
+ * \param key      32-byte encoded public key
+ *
+ * \return         0 if successful, or MBEDTLS_ERR_ED25519_INVALID_KEY if
+ *                 key is not the encoding of a point on the curve
+ */
+int mbedtls_ed25519_set_public( mbedtls_ed25519_context *ctx,
+                                const unsigned char key[32] );
+
+/**
+ * \brief          Check that a public and a private key match
+ *
+ * \param pub      Context holding a public key
+ * \param prv      Context holding a private key
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_ED25519_INVALID_KEY otherwise
+ */
+int mbedtls_ed25519_check_pub_priv( const mbedtls_ed25519_context *pub,
+                                    const mbedtls_ed25519_context *prv );
+
+/**
+ * \brief          Sign a message (pure Ed25519, no pre-hashing)
+ *
+ * \param ctx      Context holding a private key
+ * \param msg      Message to sign
+ * \param len      Length of msg
+ * \param sig      Buffer receiving the 64-byte signature
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_ED25519_INVALID_KEY if no private key is set,
+ *                 or an MBEDTLS_ERR_MPI_XXX error code
+ *
+ * \note           Signing is deterministic and runs in constant time with
+ *                 respect to the private key and the nonce.
+ */
+int mbedtls_ed25519_sign( const mbedtls_ed25519_context *ctx,
+                          const unsigned char *msg, size_t len,
+                          unsigned char sig[64] );
+
+/**
+ * \brief          Verify a signature
+ *
+ * \param ctx      Context holding a public key
+ * \param msg      Signed message
+ * \param len      Length of msg
+ * \param sig      64-byte signature
+ *
+ * \return         0 if successful,
+ *                 MBEDTLS_ERR_ED25519_VERIFY_FAILED if the signature is
+ *                 not valid,
+ *                 MBEDTLS_ERR_ED25519_INVALID_KEY if no public key is set,
+ *                 or an MBEDTLS_ERR_MPI_XXX error code
+ *
+ * \note           This is the cofactorless check of RFC 8032: the encoding
+ *                 of [S]B - [k]A must equal R. Non-canonical S is rejected.
+ */
+int mbedtls_ed25519_verify( const mbedtls_ed25519_context *ctx,
+                            const unsigned char *msg, size_t len,
+                            const unsigned char sig[64] );
+
+#if defined(MBEDTLS_SELF_TEST)
+/**
+ * \brief          Checkup routine
+ *
+ * \return         0 if successful, or 1 if the test failed
+ */
+int mbedtls_ed25519_self_test( int verbose );
+#endif /* MBEDTLS_SELF_TEST */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ed25519.h */
@@ -66,6 +66,7 @@
  * PBKDF2    1  0x007C-0x007C
  * HMAC_DRBG 4  0x0003-0x0009
  * CCM       2                  0x000D-0x000F
+ * ED25519   2                  0x0011-0x0013
  *
  * High-level module nr (3 bits - 0x0...-0x7...)
  * Name      ID  Nr of Errors
@@ -76,7 +77,7 @@
  * DHM       3   9
  * PK        3   14 (Started from top)
  * RSA       4   10
- * ECP       4   8 (Started from top)
+ * ECP       4   10 (Started from top)
  * MD        5   4
  * CIPHER    6   6
  * SSL       6   17 (Started from top)
@@ -76,8 +76,10 @@ extern "C" {
 typedef struct
 {
     /* Working state: the key K is not stored explicitely,
-     * but is implied by the HMAC context */
-    mbedtls_md_context_t md_ctx;                    /*!< HMAC context (inc. K)  */
+     * but is implied by the keyed midstates */
+    mbedtls_md_context_t md_ctx;                    /*!< working MD context     */
+    mbedtls_md_context_t ipad_ctx;                  /*!< MD state after K^ipad  */
+    mbedtls_md_context_t opad_ctx;                  /*!< MD state after K^opad  */
     unsigned char V[MBEDTLS_MD_MAX_SIZE];  /*!< V in the spec          */
     int reseed_counter;                     /*!< reseed counter         */
 
@@ -91,6 +93,10 @@ typedef struct
     int (*f_entropy)(void *, unsigned char *, size_t); /*!< entropy function */
     void *p_entropy;            /*!< context for the entropy function        */
 
+#if defined(MBEDTLS_DRBG_FORK_SAFETY)
+    long pid;                   /*!< process that last used the context */
+#endif
+
 #if defined(MBEDTLS_THREADING_C)
     mbedtls_threading_mutex_t mutex;
 #endif
@@ -141,6 +147,11 @@ int mbedtls_hmac_drbg_seed( mbedtls_hmac_drbg_context *ctx,
  * \brief               Initilisation of simpified HMAC_DRBG (never reseeds).
  *                      (For use with deterministic ECDSA.)
  *
+ * \note                This is a lightweight instantiate path: no entropy
+ *                      source or reseed state is set up, and the keyed
+ *                      midstates are derived directly from the (all-zero)
+ *                      initial key.
+ *
  * \param ctx           HMAC_DRBG context to be initialised
  * \param md_info       MD algorithm to use for HMAC_DRBG
  * \param data          Concatenation of entropy string and additional data
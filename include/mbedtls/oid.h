@@ -280,6 +280,13 @@
  *     schemes(1) ecdh(12) } */
 #define MBEDTLS_OID_EC_ALG_ECDH                 MBEDTLS_OID_CERTICOM "\x01\x0c"
 
+/*
+ * EdDSA key algorithms from RFC 8410
+ */
+
+/* id-Ed25519 OBJECT IDENTIFIER ::= { 1 3 101 112 } */
+#define MBEDTLS_OID_ED25519                     MBEDTLS_OID_ISO_IDENTIFIED_ORG "\x65\x70"
+
 /*
  * ECParameters namedCurve identifiers, from RFC 5480, RFC 5639, and SEC2
  */
@@ -47,6 +47,10 @@
 #include "ecdh.h"
 #endif
 
+#if defined(MBEDTLS_ECP_POOL_C)
+#include "ecp_pool.h"
+#endif
+
 #if defined(MBEDTLS_ZLIB_SUPPORT)
 #include "zlib.h"
 #endif
@@ -109,6 +113,7 @@
 #define MBEDTLS_ERR_SSL_UNEXPECTED_RECORD                 -0x6700  /**< Record header looks valid but is not expected. */
 #define MBEDTLS_ERR_SSL_NON_FATAL                         -0x6680  /**< The alert message received indicates a non-fatal error. */
 #define MBEDTLS_ERR_SSL_INVALID_VERIFY_HASH               -0x6600  /**< Couldn't set the hash for verifying CertificateVerify */
+#define MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS                -0x7000  /**< A cryptographic operation is in progress. Try again later. */
 
 /*
  * Various constants
@@ -666,6 +671,10 @@ struct mbedtls_ssl_config
     const mbedtls_ecp_group_id *curve_list; /*!< allowed curves             */
 #endif
 
+#if defined(MBEDTLS_ECP_POOL_C) && defined(MBEDTLS_SSL_SRV_C)
+    mbedtls_ecp_pool_context *ecp_pool; /*!< precomputed ephemeral values   */
+#endif
+
 #if defined(MBEDTLS_DHM_C)
     mbedtls_mpi dhm_P;              /*!< prime modulus for DHM              */
     mbedtls_mpi dhm_G;              /*!< generator for DHM                  */
@@ -1769,6 +1778,31 @@ void mbedtls_ssl_conf_curves( mbedtls_ssl_config *conf,
                               const mbedtls_ecp_group_id *curves );
 #endif /* MBEDTLS_ECP_C */
 
+#if defined(MBEDTLS_ECP_POOL_C) && defined(MBEDTLS_SSL_SRV_C)
+/**
+ * \brief          Set the pool of precomputed ephemeral values used to
+ *                 speed up the ServerKeyExchange. (Server-side only.)
+ *                 (Default: none.)
+ *
+ *                 For ECDHE key exchanges, a keypair for the negotiated
+ *                 curve is taken from the pool if one is available. For
+ *                 ECDHE-ECDSA, the signature uses a nonce from the pool if
+ *                 one matches the curve of our key, instead of an
+ *                 RFC 6979 or random nonce. Whenever the pool has no
+ *                 suitable entry, the value is computed as usual.
+ *
+ * \note           The pool is not filled by the SSL module: the application
+ *                 should call \c mbedtls_ecp_pool_fill() when it is idle,
+ *                 or from a separate thread (with MBEDTLS_THREADING_C).
+ *
+ * \param conf     SSL configuration
+ * \param pool     Pool to take values from, or NULL to stop using one.
+ *                 It must stay valid as long as conf is in use.
+ */
+void mbedtls_ssl_conf_ecp_pool( mbedtls_ssl_config *conf,
+                                mbedtls_ecp_pool_context *pool );
+#endif /* MBEDTLS_ECP_POOL_C && MBEDTLS_SSL_SRV_C */
+
 #if defined(MBEDTLS_KEY_EXCHANGE__WITH_CERT__ENABLED)
 /**
  * \brief          Set the allowed hashes for signatures during the handshake.
@@ -2358,15 +2392,24 @@ int mbedtls_ssl_get_session( const mbedtls_ssl_context *ssl, mbedtls_ssl_session
  *
  * \return         0 if successful, or
  *                 MBEDTLS_ERR_SSL_WANT_READ or MBEDTLS_ERR_SSL_WANT_WRITE, or
+ *                 MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS (see below), or
  *                 MBEDTLS_ERR_SSL_HELLO_VERIFY_REQUIRED (see below), or
  *                 a specific SSL error code.
  *
- * \note           If this function returns something other than 0 or
- *                 MBEDTLS_ERR_SSL_WANT_READ/WRITE, then the ssl context
+ * \note           If this function returns something other than 0,
+ *                 MBEDTLS_ERR_SSL_WANT_READ/WRITE or
+ *                 MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS, then the ssl context
  *                 becomes unusable, and you should either free it or call
  *                 \c mbedtls_ssl_session_reset() on it before re-using it for
  *                 a new connection; the current connection must be closed.
  *
+ * \note           If ECC operations are restartable, see
+ *                 \c mbedtls_ecp_set_max_ops(), this function may return
+ *                 MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS when an ECDH or ECDSA
+ *                 operation of the handshake has used up its budget. No
+ *                 I/O is pending then: call this function again, after
+ *                 doing other work if wanted, to resume the operation.
+ *
  * \note           If DTLS is in use, then you may choose to handle
  *                 MBEDTLS_ERR_SSL_HELLO_VERIFY_REQUIRED specially for logging
  *                 purposes, as it is an expected return value rather than an
@@ -175,6 +175,14 @@ struct mbedtls_ssl_sig_hash_set_t
 #endif /* MBEDTLS_SSL_PROTO_TLS1_2 &&
           MBEDTLS_KEY_EXCHANGE__WITH_CERT__ENABLED */
 
+/* Shorthand for restartable ECC in the handshake */
+#if defined(MBEDTLS_ECP_RESTARTABLE) && \
+    defined(MBEDTLS_ECDH_C) && \
+    defined(MBEDTLS_ECDSA_C) && \
+    defined(MBEDTLS_PK_C)
+#define MBEDTLS_SSL__ECP_RESTARTABLE
+#endif
+
 /*
  * This structure contains the parameters only needed during handshake.
  */
@@ -194,6 +202,19 @@ struct mbedtls_ssl_handshake_params
 #if defined(MBEDTLS_ECDH_C)
     mbedtls_ecdh_context ecdh_ctx;              /*!<  ECDH key exchange       */
 #endif
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+    int ecrs_enabled;                   /*!< Handshake supports EC restart? */
+    mbedtls_pk_restart_ctx ecrs_ctx;    /*!< restart context for signatures */
+    enum { /* this complements ssl->state with info on intra-state operations */
+        ssl_ecrs_none = 0,              /*!< nothing going on (yet)         */
+        ssl_ecrs_ske_ecdh_make_params,  /*!< Srv: ServerKeyExchange ECDH    */
+        ssl_ecrs_ske_sign,              /*!< Srv: ServerKeyExchange sign    */
+        ssl_ecrs_ske_start_processing,  /*!< Cli: ServerKeyExchange verify  */
+        ssl_ecrs_cke_ecdh_calc_secret,  /*!< ClientKeyExchange: ECDH step 2 */
+        ssl_ecrs_crt_vrfy_sign,         /*!< Cli: CertificateVerify sign    */
+    } ecrs_state;                       /*!< current (or last) operation    */
+    size_t ecrs_n;                      /*!< place for saving a length      */
+#endif
 #if defined(MBEDTLS_KEY_EXCHANGE_ECJPAKE_ENABLED)
     mbedtls_ecjpake_context ecjpake_ctx;        /*!< EC J-PAKE key exchange */
 #if defined(MBEDTLS_SSL_CLI_C)
@@ -402,6 +402,22 @@ int mbedtls_x509_crt_check_extended_key_usage( const mbedtls_x509_crt *crt,
 int mbedtls_x509_crt_is_revoked( const mbedtls_x509_crt *crt, const mbedtls_x509_crl *crl );
 #endif /* MBEDTLS_X509_CRL_PARSE_C */
 
+/**
+ * \brief          Pre-compute data that speeds up the verification of
+ *                 signatures made by the keys of a certificate chain,
+ *                 typically the trusted CAs or a long-lived chain of
+ *                 intermediate CAs. See \c mbedtls_pk_precompute().
+ *
+ * \note           Call this once the chain is complete and before sharing
+ *                 it between threads: the verification functions only read
+ *                 the result.
+ *
+ * \param chain    certificate chain
+ *
+ * \return         0 if successful, or a specific error code
+ */
+int mbedtls_x509_crt_precompute( mbedtls_x509_crt *chain );
+
 /**
  * \brief          Initialize a certificate (chain)
  *
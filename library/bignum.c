@@ -58,6 +58,13 @@
 #define mbedtls_free       free
 #endif
 
+#if defined(MBEDTLS_GENPRIME) && defined(MBEDTLS_THREADING_PTHREAD) && \
+    MBEDTLS_MPI_GEN_PRIME_THREADS > 1
+#include "mbedtls/threading.h"
+#include <pthread.h>
+#define MPI_GEN_PRIME_PARALLEL
+#endif
+
 /* Implementation that should never be optimized out by the compiler */
 static void mbedtls_mpi_zeroize( mbedtls_mpi_uint *v, size_t n ) {
     volatile mbedtls_mpi_uint *p = v; while( n-- ) *p++ = 0;
@@ -689,6 +696,29 @@ cleanup:
     return( ret );
 }
 
+/*
+ * Import X from unsigned binary data, little endian
+ */
+int mbedtls_mpi_read_binary_le( mbedtls_mpi *X, const unsigned char *buf, size_t buflen )
+{
+    int ret;
+    size_t i, n;
+
+    for( n = buflen; n > 0; n-- )
+        if( buf[n - 1] != 0 )
+            break;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, CHARS_TO_LIMBS( n ) ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( X, 0 ) );
+
+    for( i = 0; i < n; i++ )
+        X->p[i / ciL] |= ((mbedtls_mpi_uint) buf[i]) << ((i % ciL) << 3);
+
+cleanup:
+
+    return( ret );
+}
+
 /*
  * Export X into unsigned binary data, big endian
  */
@@ -709,6 +739,26 @@ int mbedtls_mpi_write_binary( const mbedtls_mpi *X, unsigned char *buf, size_t b
     return( 0 );
 }
 
+/*
+ * Export X into unsigned binary data, little endian
+ */
+int mbedtls_mpi_write_binary_le( const mbedtls_mpi *X, unsigned char *buf, size_t buflen )
+{
+    size_t i, n;
+
+    n = mbedtls_mpi_size( X );
+
+    if( buflen < n )
+        return( MBEDTLS_ERR_MPI_BUFFER_TOO_SMALL );
+
+    memset( buf, 0, buflen );
+
+    for( i = 0; i < n; i++ )
+        buf[i] = (unsigned char)( X->p[i / ciL] >> ((i % ciL) << 3) );
+
+    return( 0 );
+}
+
 /*
  * Left-shift: X <<= count
  */
@@ -958,24 +1008,51 @@ static void mpi_sub_hlp( size_t n, mbedtls_mpi_uint *s, mbedtls_mpi_uint *d )
     }
 }
 
+/*
+ * Helper for mbedtls_mpi subtraction with the operands the other way
+ * round: d = s - d, where the n-limb value at s is at least the one at d
+ */
+static void mpi_rsub_hlp( size_t n, const mbedtls_mpi_uint *s,
+                          mbedtls_mpi_uint *d )
+{
+    size_t i;
+    mbedtls_mpi_uint c, z, t;
+
+    for( i = c = 0; i < n; i++ )
+    {
+        t = s[i];
+        z = ( t <  c );   t -=  c;
+        c = ( t < d[i] ) + z; d[i] = t - d[i];
+    }
+}
+
 /*
  * Unsigned subtraction: X = |A| - |B|  (HAC 14.9)
  */
 int mbedtls_mpi_sub_abs( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *B )
 {
-    mbedtls_mpi TB;
     int ret;
     size_t n;
 
     if( mbedtls_mpi_cmp_abs( A, B ) < 0 )
         return( MBEDTLS_ERR_MPI_NEGATIVE_VALUE );
 
-    mbedtls_mpi_init( &TB );
-
     if( X == B )
     {
-        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TB, B ) );
-        B = &TB;
+        /*
+         * X = |A| - |X| can be done in place: |X| <= |A|, so the limbs of X
+         * above the length of A are already zero. This avoids a copy of B,
+         * which is the common case when reducing negative values mod P.
+         */
+        for( n = A->n; n > 0; n-- )
+            if( A->p[n - 1] != 0 )
+                break;
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, n ) );
+        mpi_rsub_hlp( n, A->p, X->p );
+        X->s = 1;
+
+        return( 0 );
     }
 
     if( X != A )
@@ -996,8 +1073,6 @@ int mbedtls_mpi_sub_abs( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
 
 cleanup:
 
-    mbedtls_mpi_free( &TB );
-
     return( ret );
 }
 
@@ -1095,6 +1170,104 @@ int mbedtls_mpi_sub_int( mbedtls_mpi *X, const mbedtls_mpi *A, mbedtls_mpi_sint
     return( mbedtls_mpi_sub_mpi( X, A, &_B ) );
 }
 
+#if defined(MULADDC_X8_CORE)
+/*
+ * Check for the BMI2 (MULX) and ADX (ADCX/ADOX) extensions at runtime,
+ * CPUID.(EAX=7,ECX=0):EBX bits 8 and 19
+ */
+static int mpi_has_adx( void )
+{
+    static int done = 0;
+    static unsigned int ebx = 0;
+    const unsigned int what = ( 1u << 8 ) | ( 1u << 19 );
+
+    if( ! done )
+    {
+        unsigned int max_leaf;
+
+        asm( "xorl  %%eax, %%eax \n\t"
+             "cpuid              \n\t"
+             : "=a" (max_leaf)
+             :
+             : "ebx", "ecx", "edx" );
+
+        if( max_leaf >= 7 )
+        {
+            asm( "movl  $7, %%eax    \n\t"
+                 "xorl  %%ecx, %%ecx \n\t"
+                 "cpuid              \n\t"
+                 : "=b" (ebx)
+                 :
+                 : "eax", "ecx", "edx" );
+        }
+
+        done = 1;
+    }
+
+    return( ( ebx & what ) == what );
+}
+
+/*
+ * Helper for mbedtls_mpi multiplication, BMI2/ADX version
+ */
+static void mpi_mul_hlp_adx( size_t i, mbedtls_mpi_uint *s, mbedtls_mpi_uint *d, mbedtls_mpi_uint b )
+{
+    mbedtls_mpi_uint c = 0;
+
+    for( ; i >= 8; i -= 8 )
+    {
+        MULADDC_X_INIT
+        MULADDC_X8_CORE
+        MULADDC_X_STOP
+    }
+
+    /* Remaining limbs in one go, rather than one asm block per limb */
+    switch( i )
+    {
+        case 1:
+            MULADDC_X_INIT
+            MULADDC_X1_CORE
+            MULADDC_X_STOP
+            break;
+        case 2:
+            MULADDC_X_INIT
+            MULADDC_X1_CORE MULADDC_X1_CORE
+            MULADDC_X_STOP
+            break;
+        case 3:
+            MULADDC_X_INIT
+            MULADDC_X1_CORE MULADDC_X1_CORE MULADDC_X1_CORE
+            MULADDC_X_STOP
+            break;
+        case 4:
+            MULADDC_X_INIT
+            MULADDC_X4_CORE
+            MULADDC_X_STOP
+            break;
+        case 5:
+            MULADDC_X_INIT
+            MULADDC_X4_CORE MULADDC_X1_CORE
+            MULADDC_X_STOP
+            break;
+        case 6:
+            MULADDC_X_INIT
+            MULADDC_X4_CORE MULADDC_X1_CORE MULADDC_X1_CORE
+            MULADDC_X_STOP
+            break;
+        case 7:
+            MULADDC_X_INIT
+            MULADDC_X4_CORE MULADDC_X1_CORE MULADDC_X1_CORE MULADDC_X1_CORE
+            MULADDC_X_STOP
+            break;
+    }
+
+    do {
+        *d += c; c = ( *d < c ); d++;
+    }
+    while( c != 0 );
+}
+#endif /* MULADDC_X8_CORE */
+
 /*
  * Helper for mbedtls_mpi multiplication
  */
@@ -1110,6 +1283,14 @@ void mpi_mul_hlp( size_t i, mbedtls_mpi_uint *s, mbedtls_mpi_uint *d, mbedtls_mp
 {
     mbedtls_mpi_uint c = 0, t = 0;
 
+#if defined(MULADDC_X8_CORE)
+    if( mpi_has_adx() )
+    {
+        mpi_mul_hlp_adx( i, s, d, b );
+        return;
+    }
+#endif
+
 #if defined(MULADDC_HUIT)
     for( ; i >= 8; i -= 8 )
     {
@@ -1167,8 +1348,192 @@ void mpi_mul_hlp( size_t i, mbedtls_mpi_uint *s, mbedtls_mpi_uint *d, mbedtls_mp
     while( c != 0 );
 }
 
+#if MBEDTLS_MPI_KARATSUBA_THRESHOLD < 4
+#error "MBEDTLS_MPI_KARATSUBA_THRESHOLD must be at least 4"
+#endif
+
+/*
+ * Helper for Karatsuba multiplication: d += s, s being n limbs long.
+ * The carry is propagated upwards in d, which must be large enough.
+ */
+static void mpi_add_hlp( size_t n, const mbedtls_mpi_uint *s, mbedtls_mpi_uint *d )
+{
+    size_t i;
+    mbedtls_mpi_uint c, tmp;
+
+    for( i = c = 0; i < n; i++ )
+    {
+        tmp = s[i];
+        d[i] +=  c; c  = ( d[i] <  c );
+        d[i] += tmp; c += ( d[i] < tmp );
+    }
+
+    while( c != 0 )
+    {
+        d[i] += c; c = ( d[i] < c ); i++;
+    }
+}
+
+/*
+ * Helper for Karatsuba multiplication: d = | a - b |, where a and d are
+ * n limbs long and b is bn <= n limbs long.
+ * Returns 1 if a < b, 0 otherwise. Doesn't branch on the values.
+ */
+static mbedtls_mpi_uint mpi_absdiff_hlp( size_t n, mbedtls_mpi_uint *d,
+                                         const mbedtls_mpi_uint *a,
+                                         const mbedtls_mpi_uint *b, size_t bn )
+{
+    size_t i;
+    mbedtls_mpi_uint c, z, t, neg, mask;
+
+    for( i = c = 0; i < n; i++ )
+    {
+        t = ( i < bn ) ? b[i] : 0;
+        z = ( a[i] < c ); d[i] = a[i] - c;
+        c = ( d[i] < t ) + z; d[i] -= t;
+    }
+
+    /* Negate (two's complement) if there was a final borrow */
+    neg = c;
+    mask = (mbedtls_mpi_uint) 0 - neg;
+
+    for( i = 0; i < n; i++ )
+    {
+        d[i] = ( d[i] ^ mask ) + c;
+        c = ( d[i] < c );
+    }
+
+    return( neg );
+}
+
+/*
+ * Helper for Karatsuba multiplication: d = d - s if neg is 1, d + s if neg
+ * is 0, modulo B^(n + 1), where s is n limbs long and d is n + 1 limbs long.
+ * Doesn't branch on the values: s is added as its two's complement.
+ */
+static void mpi_addsub_hlp( size_t n, const mbedtls_mpi_uint *s,
+                            mbedtls_mpi_uint *d, mbedtls_mpi_uint neg )
+{
+    size_t i;
+    mbedtls_mpi_uint c, tmp, mask = (mbedtls_mpi_uint) 0 - neg;
+
+    for( i = 0, c = neg; i < n; i++ )
+    {
+        tmp = s[i] ^ mask;
+        d[i] +=  c; c  = ( d[i] <  c );
+        d[i] += tmp; c += ( d[i] < tmp );
+    }
+
+    d[n] += c + mask;
+}
+
+/*
+ * Size in limbs of the scratch buffer for mpi_mul_kara() with an an-limb
+ * first operand (4 * an plus four limbs per recursion level)
+ */
+#define KARA_SCRATCH_LIMBS( an )    ( 4 * ( an ) + 64 )
+
+/*
+ * Karatsuba multiplication: r = a * b, with an >= bn, r being an + bn limbs
+ * long (no need to be cleared beforehand) and w a scratch buffer of
+ * KARA_SCRATCH_LIMBS( an ) limbs. Squarings (a == b, an == bn) only need
+ * three half-size squarings at each level.
+ *
+ * With h = ceil(an / 2), a = a1 B^h + a0 and b = b1 B^h + b0:
+ *   a * b = z2 B^2h + ( z0 + z2 - (a0 - a1)(b0 - b1) ) B^h + z0
+ * where z0 = a0 b0 and z2 = a1 b1. The "subtractive" variant keeps all
+ * intermediate values within h limbs.
+ */
+static void mpi_mul_kara( mbedtls_mpi_uint *r,
+                          const mbedtls_mpi_uint *a, size_t an,
+                          const mbedtls_mpi_uint *b, size_t bn,
+                          mbedtls_mpi_uint *w )
+{
+    size_t i, n, h, tn;
+    mbedtls_mpi_uint sa, sb, *da, *db, *p, *t;
+
+    if( bn < MBEDTLS_MPI_KARATSUBA_THRESHOLD )
+    {
+        memset( r, 0, ( an + bn ) * ciL );
+
+        for( i = 0; i < bn; i++ )
+            mpi_mul_hlp( an, (mbedtls_mpi_uint *) a, r + i, b[i] );
+
+        return;
+    }
+
+    h = ( an + 1 ) / 2;
+
+    if( bn <= h )
+    {
+        /*
+         * Unbalanced operands: multiply b by bn-limb chunks of a
+         */
+        memset( r, 0, ( an + bn ) * ciL );
+
+        for( i = 0; i < an; i += bn )
+        {
+            n = ( an - i < bn ) ? an - i : bn;
+
+            if( n == bn )
+                mpi_mul_kara( w, a + i, n, b, bn, w + n + bn );
+            else
+                mpi_mul_kara( w, b, bn, a + i, n, w + n + bn );
+
+            mpi_add_hlp( n + bn, w, r + i );
+        }
+
+        return;
+    }
+
+    da = w;
+    db = w + h;
+    p  = w + 2 * h;
+    t  = w + 4 * h;
+
+    sa = mpi_absdiff_hlp( h, da, a, a + h, an - h );
+
+    if( a == b && an == bn )
+    {
+        /* Squaring: (a0 - a1)^2 is always subtracted */
+        sb = sa;
+        mpi_mul_kara( p, da, h, da, h, t );
+    }
+    else
+    {
+        sb = mpi_absdiff_hlp( h, db, b, b + h, bn - h );
+        mpi_mul_kara( p, da, h, db, h, t );
+    }
+
+    mpi_mul_kara( r, a, h, b, h, t );
+    mpi_mul_kara( r + 2 * h, a + h, an - h, b + h, bn - h, t );
+
+    /*
+     * t = z0 + z2 -/+ |a0 - a1| |b0 - b1|, then r += t B^h.
+     * The middle term is less than both B^(an + bn - h) and B^(2h + 1),
+     * so it can be computed modulo B^(2h + 1) without branching on the
+     * sign of (a0 - a1)(b0 - b1), and higher limbs of t are zero.
+     */
+    memcpy( t, r, 2 * h * ciL );
+    t[2 * h] = 0;
+    mpi_add_hlp( an + bn - 2 * h, r + 2 * h, t );
+
+    mpi_addsub_hlp( 2 * h, p, t, 1 - ( sa ^ sb ) );
+
+    tn = ( 2 * h + 1 < an + bn - h ) ? 2 * h + 1 : an + bn - h;
+    mpi_add_hlp( tn, t, r + h );
+}
+
+/*
+ * Largest product (in limbs) computed on the stack when the destination of
+ * mbedtls_mpi_mul_mpi() is one of the operands: enough for the product of
+ * two elements of the largest supported ECC field (521 bits)
+ */
+#define MPI_MUL_STACK_LIMBS     ( 2 * ( ( 521 + biL - 1 ) / biL ) )
+
 /*
  * Baseline multiplication: X = A * B  (HAC 14.12)
+ * Karatsuba multiplication for large operands.
  */
 int mbedtls_mpi_mul_mpi( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *B )
 {
@@ -1178,9 +1543,6 @@ int mbedtls_mpi_mul_mpi( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
 
     mbedtls_mpi_init( &TA ); mbedtls_mpi_init( &TB );
 
-    if( X == A ) { MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TA, A ) ); A = &TA; }
-    if( X == B ) { MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TB, B ) ); B = &TB; }
-
     for( i = A->n; i > 0; i-- )
         if( A->p[i - 1] != 0 )
             break;
@@ -1189,11 +1551,69 @@ int mbedtls_mpi_mul_mpi( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
         if( B->p[j - 1] != 0 )
             break;
 
+    if( ( X == A || X == B ) && i + j <= MPI_MUL_STACK_LIMBS )
+    {
+        /*
+         * Small in-place product, as in the ECC formulas: compute it on the
+         * stack rather than copying the operand to the heap
+         */
+        mbedtls_mpi_uint Tp[MPI_MUL_STACK_LIMBS];
+        int s = A->s * B->s;
+        size_t k;
+
+        memset( Tp, 0, ( i + j ) * ciL );
+
+        for( k = j; k > 0; k-- )
+            mpi_mul_hlp( i, A->p, Tp + k - 1, B->p[k - 1] );
+
+        if( ( ret = mbedtls_mpi_grow( X, i + j ) ) == 0 &&
+            ( ret = mbedtls_mpi_lset( X, 0 ) ) == 0 )
+        {
+            memcpy( X->p, Tp, ( i + j ) * ciL );
+            X->s = s;
+        }
+
+        mbedtls_mpi_zeroize( Tp, i + j );
+
+        return( ret );
+    }
+
+    if( X == A && X == B )
+    {
+        /* Keep A == B so that squarings are detected */
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TA, A ) ); A = B = &TA;
+    }
+    if( X == A ) { MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TA, A ) ); A = &TA; }
+    if( X == B ) { MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TB, B ) ); B = &TB; }
+
     MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, i + j ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_lset( X, 0 ) );
 
-    for( i++; j > 0; j-- )
-        mpi_mul_hlp( i - 1, A->p, X->p + j - 1, B->p[j - 1] );
+    if( i >= MBEDTLS_MPI_KARATSUBA_THRESHOLD &&
+        j >= MBEDTLS_MPI_KARATSUBA_THRESHOLD )
+    {
+        mbedtls_mpi_uint *w;
+        size_t wn = KARA_SCRATCH_LIMBS( i > j ? i : j );
+
+        if( ( w = (mbedtls_mpi_uint *) mbedtls_calloc( wn, ciL ) ) == NULL )
+        {
+            ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+            goto cleanup;
+        }
+
+        if( i >= j )
+            mpi_mul_kara( X->p, A->p, i, B->p, j, w );
+        else
+            mpi_mul_kara( X->p, B->p, j, A->p, i, w );
+
+        mbedtls_mpi_zeroize( w, wn );
+        mbedtls_free( w );
+    }
+    else
+    {
+        for( i++; j > 0; j-- )
+            mpi_mul_hlp( i - 1, A->p, X->p + j - 1, B->p[j - 1] );
+    }
 
     X->s = A->s * B->s;
 
@@ -1324,12 +1744,18 @@ int mbedtls_mpi_div_mpi( mbedtls_mpi *Q, mbedtls_mpi *R, const mbedtls_mpi *A, c
     int ret;
     size_t i, n, t, k;
     mbedtls_mpi X, Y, Z, T1, T2;
+    mbedtls_mpi_uint TP2[3];
 
     if( mbedtls_mpi_cmp_int( B, 0 ) == 0 )
         return( MBEDTLS_ERR_MPI_DIVISION_BY_ZERO );
 
     mbedtls_mpi_init( &X ); mbedtls_mpi_init( &Y ); mbedtls_mpi_init( &Z );
-    mbedtls_mpi_init( &T1 ); mbedtls_mpi_init( &T2 );
+    mbedtls_mpi_init( &T1 );
+
+    /* T2 only ever holds three limbs, keep it on the stack */
+    T2.s = 1;
+    T2.n = 3;
+    T2.p = TP2;
 
     if( mbedtls_mpi_cmp_abs( A, B ) < 0 )
     {
@@ -1338,14 +1764,25 @@ int mbedtls_mpi_div_mpi( mbedtls_mpi *Q, mbedtls_mpi *R, const mbedtls_mpi *A, c
         return( 0 );
     }
 
+    /*
+     * Size the working copies for the largest value they will hold (after
+     * normalization, Y is shifted up to the length of X) so that they are
+     * allocated once rather than regrown step by step.
+     */
+    for( n = A->n; n > 1; n-- )
+        if( A->p[n - 1] != 0 )
+            break;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &X, n + 1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &Y, n + 1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &T1, n + 2 ) );
+
     MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &X, A ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &Y, B ) );
     X.s = Y.s = 1;
 
     MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &Z, A->n + 2 ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &Z,  0 ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &T1, 2 ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &T2, 3 ) );
 
     k = mbedtls_mpi_bitlen( &Y ) % biL;
     if( k < biL - 1 )
@@ -1356,8 +1793,9 @@ int mbedtls_mpi_div_mpi( mbedtls_mpi *Q, mbedtls_mpi *R, const mbedtls_mpi *A, c
     }
     else k = 0;
 
-    n = X.n - 1;
-    t = Y.n - 1;
+    /* X and Y may have spare limbs, use their significant length */
+    n = BITS_TO_LIMBS( mbedtls_mpi_bitlen( &X ) ) - 1;
+    t = BITS_TO_LIMBS( mbedtls_mpi_bitlen( &Y ) ) - 1;
     MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &Y, biL * ( n - t ) ) );
 
     while( mbedtls_mpi_cmp_mpi( &X, &Y ) >= 0 )
@@ -1426,7 +1864,8 @@ int mbedtls_mpi_div_mpi( mbedtls_mpi *Q, mbedtls_mpi *R, const mbedtls_mpi *A, c
 cleanup:
 
     mbedtls_mpi_free( &X ); mbedtls_mpi_free( &Y ); mbedtls_mpi_free( &Z );
-    mbedtls_mpi_free( &T1 ); mbedtls_mpi_free( &T2 );
+    mbedtls_mpi_free( &T1 );
+    mbedtls_mpi_zeroize( TP2, 3 );
 
     return( ret );
 }
@@ -1588,43 +2027,342 @@ static int mpi_montmul( mbedtls_mpi *A, const mbedtls_mpi *B, const mbedtls_mpi
 }
 
 /*
- * Montgomery reduction: A = A * R^-1 mod N
+ * Helper for Montgomery squaring: d = s^2, s being n limbs long and d
+ * 2 * n limbs long, cleared beforehand.
+ * Each cross product s[i] * s[j] with i < j is computed once and doubled,
+ * then the squares s[i]^2 are added on the diagonal.
  */
-static int mpi_montred( mbedtls_mpi *A, const mbedtls_mpi *N, mbedtls_mpi_uint mm, const mbedtls_mpi *T )
+static void mpi_sqr_hlp( size_t n, mbedtls_mpi_uint *s, mbedtls_mpi_uint *d )
 {
-    mbedtls_mpi_uint z = 1;
-    mbedtls_mpi U;
+    size_t i;
+    mbedtls_mpi_uint b, c, h, t = 0;
 
-    U.n = U.s = (int) z;
-    U.p = &z;
+    for( i = 1; i < n; i++ )
+        mpi_mul_hlp( n - i, s + i, d + 2 * i - 1, s[i - 1] );
 
-    return( mpi_montmul( A, &U, N, mm, T ) );
+    /*
+     * Double the cross products two limbs at a time (h is the bit shifted
+     * out) and add s[i]^2 to each pair of limbs (c is the carry)
+     */
+    for( i = 0, c = h = 0; i < n; i++ )
+    {
+        b = d[1] >> ( biL - 1 );
+        d[1] = ( d[1] << 1 ) | ( d[0] >> ( biL - 1 ) );
+        d[0] = ( d[0] << 1 ) | h;
+        h = b;
+
+        b = *s;
+
+        MULADDC_INIT
+        MULADDC_CORE
+        MULADDC_STOP
+
+        *d += c; c = ( *d < c ); d++;
+    }
+
+    t++;
 }
 
 /*
- * Sliding-window exponentiation: X = A^E mod N  (HAC 14.85)
+ * Montgomery squaring: A = A * A * R^-1 mod N
+ *
+ * Same as mpi_montmul( A, A, N, mm, T ) but the square is computed first
+ * with mpi_sqr_hlp(), which needs about half the limb multiplications, and
+ * then reduced. T must be at least 2 * N->n + 1 limbs long.
  */
-int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *E, const mbedtls_mpi *N, mbedtls_mpi *_RR )
+static int mpi_montsqr( mbedtls_mpi *A, const mbedtls_mpi *N, mbedtls_mpi_uint mm,
+                        const mbedtls_mpi *T )
 {
-    int ret;
-    size_t wbits, wsize, one = 1;
-    size_t i, j, nblimbs;
-    size_t bufsize, nbits;
-    mbedtls_mpi_uint ei, mm, state;
-    mbedtls_mpi RR, T, W[ 2 << MBEDTLS_MPI_WINDOW_SIZE ], Apos;
-    int neg;
+    size_t i, n;
+    mbedtls_mpi_uint u, *d;
 
-    if( mbedtls_mpi_cmp_int( N, 0 ) < 0 || ( N->p[0] & 1 ) == 0 )
-        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+    n = N->n;
 
-    if( mbedtls_mpi_cmp_int( E, 0 ) < 0 )
+    if( T->n < 2 * n + 1 || T->p == NULL || A->n < n + 1 )
         return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
 
-    /*
-     * Init temps and window size
-     */
-    mpi_montg_init( &mm, N );
-    mbedtls_mpi_init( &RR ); mbedtls_mpi_init( &T );
+    memset( T->p, 0, T->n * ciL );
+
+    d = T->p;
+
+    mpi_sqr_hlp( n, A->p, d );
+
+    /*
+     * A^2 = H B^n + L: move H out of the way so that the carry of each
+     * reduction step lands on a zero limb and stops there
+     */
+    memcpy( A->p, d + n, n * ciL );
+    memset( d + n, 0, n * ciL );
+    A->p[n] = 0;
+
+    for( i = 0; i < n; i++ )
+    {
+        /*
+         * T = T + u*N B^i, clearing limb i
+         */
+        u = d[i] * mm;
+        mpi_mul_hlp( n, N->p, d + i, u );
+    }
+
+    /*
+     * T[n..2n] = H + (L + U N) / B^n < 2 N, then A = T[n..2n] as in
+     * mpi_montmul(): the dummy subtraction below then stops within T,
+     * since the borrow out of T[0..n-1] (all zero) only happens when A
+     * is non-zero.
+     */
+    mpi_add_hlp( n + 1, A->p, d + n );
+    memcpy( A->p, d + n, ( n + 1 ) * ciL );
+
+    if( mbedtls_mpi_cmp_abs( A, N ) >= 0 )
+        mpi_sub_hlp( n, N->p, A->p );
+    else
+        /* prevent timing attacks */
+        mpi_sub_hlp( n, A->p, T->p );
+
+    return( 0 );
+}
+
+/*
+ * Montgomery reduction: A = A * R^-1 mod N
+ */
+static int mpi_montred( mbedtls_mpi *A, const mbedtls_mpi *N, mbedtls_mpi_uint mm, const mbedtls_mpi *T )
+{
+    mbedtls_mpi_uint z = 1;
+    mbedtls_mpi U;
+
+    U.n = U.s = (int) z;
+    U.p = &z;
+
+    return( mpi_montmul( A, &U, N, mm, T ) );
+}
+
+#if defined(MBEDTLS_MPI_MONTMUL_UNROLLED)
+/*
+ * Montgomery multiplication and squaring specialised for the sizes of
+ * common RSA and DH moduli and of the primes of the corresponding RSA keys
+ * (16, 24, 32, 48 and 64 limbs): each row d += s * b is a single
+ * straight-line block of n multiply-accumulate steps, and the carry out of
+ * each row lands on a known limb instead of being propagated in a loop.
+ */
+typedef mbedtls_mpi_uint (*mpi_row_func)( mbedtls_mpi_uint *s, mbedtls_mpi_uint *d,
+                                          mbedtls_mpi_uint b );
+
+#define MPI_REP2( x )   x x
+#define MPI_REP3( x )   x x x
+#define MPI_REP4( x )   MPI_REP2( x ) MPI_REP2( x )
+#define MPI_REP6( x )   MPI_REP3( x ) MPI_REP3( x )
+#define MPI_REP8( x )   MPI_REP4( x ) MPI_REP4( x )
+#define MPI_REP16( x )  MPI_REP8( x ) MPI_REP8( x )
+#define MPI_REP24( x )  MPI_REP16( x ) MPI_REP8( x )
+#define MPI_REP32( x )  MPI_REP16( x ) MPI_REP16( x )
+#define MPI_REP48( x )  MPI_REP32( x ) MPI_REP16( x )
+#define MPI_REP64( x )  MPI_REP32( x ) MPI_REP32( x )
+
+/*
+ * d[0..n-1] += s[0..n-1] * b, returning the carry out
+ */
+#define MPI_ROW_FUNC( n )                                                   \
+static mbedtls_mpi_uint mpi_mul_row_##n( mbedtls_mpi_uint *s,               \
+                                         mbedtls_mpi_uint *d,               \
+                                         mbedtls_mpi_uint b )               \
+{                                                                           \
+    mbedtls_mpi_uint c = 0, t = 0;                                          \
+                                                                            \
+    MULADDC_INIT                                                            \
+    MPI_REP##n( MULADDC_CORE )                                              \
+    MULADDC_STOP                                                            \
+                                                                            \
+    t++;                                                                    \
+    return( c );                                                            \
+}
+
+MPI_ROW_FUNC( 16 )
+MPI_ROW_FUNC( 24 )
+MPI_ROW_FUNC( 32 )
+MPI_ROW_FUNC( 48 )
+MPI_ROW_FUNC( 64 )
+
+#if defined(MULADDC_X8_CORE)
+#define MPI_ROW_FUNC_ADX( n, n8 )                                           \
+static mbedtls_mpi_uint mpi_mul_row_adx_##n( mbedtls_mpi_uint *s,           \
+                                             mbedtls_mpi_uint *d,           \
+                                             mbedtls_mpi_uint b )           \
+{                                                                           \
+    mbedtls_mpi_uint c = 0;                                                 \
+                                                                            \
+    MULADDC_X_INIT                                                          \
+    MPI_REP##n8( MULADDC_X8_CORE )                                          \
+    MULADDC_X_STOP                                                          \
+                                                                            \
+    return( c );                                                            \
+}
+
+MPI_ROW_FUNC_ADX( 16, 2 )
+MPI_ROW_FUNC_ADX( 24, 3 )
+MPI_ROW_FUNC_ADX( 32, 4 )
+MPI_ROW_FUNC_ADX( 48, 6 )
+MPI_ROW_FUNC_ADX( 64, 8 )
+#endif /* MULADDC_X8_CORE */
+
+/*
+ * Row function for n-limb moduli, or NULL if there is none
+ */
+static mpi_row_func mpi_mont_row_select( size_t n )
+{
+#if defined(MULADDC_X8_CORE)
+    if( mpi_has_adx() )
+    {
+        switch( n )
+        {
+            case 16: return( mpi_mul_row_adx_16 );
+            case 24: return( mpi_mul_row_adx_24 );
+            case 32: return( mpi_mul_row_adx_32 );
+            case 48: return( mpi_mul_row_adx_48 );
+            case 64: return( mpi_mul_row_adx_64 );
+        }
+    }
+#endif
+
+    switch( n )
+    {
+        case 16: return( mpi_mul_row_16 );
+        case 24: return( mpi_mul_row_24 );
+        case 32: return( mpi_mul_row_32 );
+        case 48: return( mpi_mul_row_48 );
+        case 64: return( mpi_mul_row_64 );
+    }
+
+    return( NULL );
+}
+
+/*
+ * Same as mpi_montmul() with the rows done by row(),
+ * which must match N->n; B must have at least N->n limbs.
+ */
+static int mpi_montmul_unrolled( mbedtls_mpi *A, const mbedtls_mpi *B,
+                                 const mbedtls_mpi *N, mbedtls_mpi_uint mm,
+                                 const mbedtls_mpi *T, mpi_row_func row )
+{
+    size_t i, n;
+    mbedtls_mpi_uint u0, u1, c, *d;
+
+    n = N->n;
+
+    if( T->n < 2 * n + 2 || T->p == NULL || B->n < n || A->n < n + 1 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    memset( T->p, 0, T->n * ciL );
+
+    d = T->p;
+
+    for( i = 0; i < n; i++ )
+    {
+        /*
+         * T = (T + u0*B + u1*N) / 2^biL, with T < 2N all along
+         * so that the carries stop at d[n + 1]
+         */
+        u0 = A->p[i];
+        u1 = ( d[0] + u0 * B->p[0] ) * mm;
+
+        c = row( B->p, d, u0 );
+        d[n] += c; d[n + 1] = ( d[n] < c );
+
+        c = row( N->p, d, u1 );
+        d[n] += c; d[n + 1] += ( d[n] < c );
+
+        *d++ = u0; d[n + 1] = 0;
+    }
+
+    memcpy( A->p, d, ( n + 1 ) * ciL );
+
+    if( mbedtls_mpi_cmp_abs( A, N ) >= 0 )
+        mpi_sub_hlp( n, N->p, A->p );
+    else
+        /* prevent timing attacks */
+        mpi_sub_hlp( n, A->p, T->p );
+
+    return( 0 );
+}
+
+/*
+ * Same as mpi_montsqr() with the reduction rows done by row(),
+ * which must match N->n.
+ */
+static int mpi_montsqr_unrolled( mbedtls_mpi *A, const mbedtls_mpi *N,
+                                 mbedtls_mpi_uint mm, const mbedtls_mpi *T,
+                                 mpi_row_func row )
+{
+    size_t i, n;
+    mbedtls_mpi_uint *d;
+
+    n = N->n;
+
+    if( T->n < 2 * n + 1 || T->p == NULL || A->n < n + 1 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    memset( T->p, 0, T->n * ciL );
+
+    d = T->p;
+
+    mpi_sqr_hlp( n, A->p, d );
+
+    memcpy( A->p, d + n, n * ciL );
+    memset( d + n, 0, n * ciL );
+    A->p[n] = 0;
+
+    /* d[i + n] is still zero when step i runs, so it takes the carry as is */
+    for( i = 0; i < n; i++ )
+        d[i + n] = row( N->p, d + i, d[i] * mm );
+
+    mpi_add_hlp( n + 1, A->p, d + n );
+    memcpy( A->p, d + n, ( n + 1 ) * ciL );
+
+    if( mbedtls_mpi_cmp_abs( A, N ) >= 0 )
+        mpi_sub_hlp( n, N->p, A->p );
+    else
+        /* prevent timing attacks */
+        mpi_sub_hlp( n, A->p, T->p );
+
+    return( 0 );
+}
+
+#define MPI_EXP_MONTMUL( A, B )                                     \
+    ( ( row != NULL ) ? mpi_montmul_unrolled( A, B, N, mm, &T, row ) \
+                      : mpi_montmul( A, B, N, mm, &T ) )
+#define MPI_EXP_MONTSQR( A )                                        \
+    ( ( row != NULL ) ? mpi_montsqr_unrolled( A, N, mm, &T, row )   \
+                      : mpi_montsqr( A, N, mm, &T ) )
+#else
+#define MPI_EXP_MONTMUL( A, B )     mpi_montmul( A, B, N, mm, &T )
+#define MPI_EXP_MONTSQR( A )        mpi_montsqr( A, N, mm, &T )
+#endif /* MBEDTLS_MPI_MONTMUL_UNROLLED */
+
+/*
+ * Sliding-window exponentiation: X = A^E mod N  (HAC 14.85),
+ * given mm = -N^-1 mod 2^biL and RR = R^2 mod N
+ */
+static int mpi_exp_mod_mont( mbedtls_mpi *X, const mbedtls_mpi *A,
+                             const mbedtls_mpi *E, const mbedtls_mpi *N,
+                             const mbedtls_mpi *RR, mbedtls_mpi_uint mm )
+{
+    int ret;
+    size_t wbits, wsize, one = 1;
+    size_t i, j, nblimbs;
+    size_t bufsize, nbits, table_len;
+    mbedtls_mpi_uint ei, state, *work = NULL;
+    mbedtls_mpi T, W[ 2 << MBEDTLS_MPI_WINDOW_SIZE ], Apos;
+    int neg;
+#if defined(MBEDTLS_MPI_MONTMUL_UNROLLED)
+    mpi_row_func row;
+#endif
+
+    /*
+     * Init temps and window size
+     */
+#if defined(MBEDTLS_MPI_MONTMUL_UNROLLED)
+    row = mpi_mont_row_select( N->n );
+#endif
+    mbedtls_mpi_init( &T );
     mbedtls_mpi_init( &Apos );
     memset( W, 0, sizeof( W ) );
 
@@ -1639,7 +2377,31 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
     j = N->n + 1;
     MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, j ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &W[1],  j ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &T, j * 2 ) );
+
+    /*
+     * T and the window table W[1 << (wsize - 1)] .. W[(1 << wsize) - 1]
+     * are carved from a single block: they are only used by mpi_montmul(),
+     * mpi_montsqr() and mbedtls_mpi_copy() between values mod N, so they
+     * never need to grow
+     */
+    table_len = ( wsize > 1 ) ? one << ( wsize - 1 ) : 0;
+
+    work = (mbedtls_mpi_uint *) mbedtls_calloc( ( table_len + 2 ) * j, ciL );
+    if( work == NULL )
+    {
+        ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    T.p = work;
+    T.n = j * 2;
+
+    for( i = 0; i < table_len; i++ )
+    {
+        W[table_len + i].p = work + ( i + 2 ) * j;
+        W[table_len + i].n = j;
+        W[table_len + i].s = 1;
+    }
 
     /*
      * Compensate for negative A (and correct at the end)
@@ -1652,21 +2414,6 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
         A = &Apos;
     }
 
-    /*
-     * If 1st call, pre-compute R^2 mod N
-     */
-    if( _RR == NULL || _RR->p == NULL )
-    {
-        MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &RR, 1 ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &RR, N->n * 2 * biL ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &RR, &RR, N ) );
-
-        if( _RR != NULL )
-            memcpy( _RR, &RR, sizeof( mbedtls_mpi ) );
-    }
-    else
-        memcpy( &RR, _RR, sizeof( mbedtls_mpi ) );
-
     /*
      * W[1] = A * R^2 * R^-1 mod N = A * R mod N
      */
@@ -1675,12 +2422,12 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
     else
         MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &W[1], A ) );
 
-    MBEDTLS_MPI_CHK( mpi_montmul( &W[1], &RR, N, mm, &T ) );
+    MBEDTLS_MPI_CHK( mpi_montmul( &W[1], RR, N, mm, &T ) );
 
     /*
      * X = R^2 * R^-1 mod N = R mod N
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( X, &RR ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( X, RR ) );
     MBEDTLS_MPI_CHK( mpi_montred( X, N, mm, &T ) );
 
     if( wsize > 1 )
@@ -1690,21 +2437,19 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
          */
         j =  one << ( wsize - 1 );
 
-        MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &W[j], N->n + 1 ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &W[j], &W[1]    ) );
 
         for( i = 0; i < wsize - 1; i++ )
-            MBEDTLS_MPI_CHK( mpi_montmul( &W[j], &W[j], N, mm, &T ) );
+            MBEDTLS_MPI_CHK( MPI_EXP_MONTSQR( &W[j] ) );
 
         /*
          * W[i] = W[i - 1] * W[1]
          */
         for( i = j + 1; i < ( one << wsize ); i++ )
         {
-            MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &W[i], N->n + 1 ) );
             MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &W[i], &W[i - 1] ) );
 
-            MBEDTLS_MPI_CHK( mpi_montmul( &W[i], &W[1], N, mm, &T ) );
+            MBEDTLS_MPI_CHK( MPI_EXP_MONTMUL( &W[i], &W[1] ) );
         }
     }
 
@@ -1741,7 +2486,7 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
             /*
              * out of window, square X
              */
-            MBEDTLS_MPI_CHK( mpi_montmul( X, X, N, mm, &T ) );
+            MBEDTLS_MPI_CHK( MPI_EXP_MONTSQR( X ) );
             continue;
         }
 
@@ -1759,12 +2504,12 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
              * X = X^wsize R^-1 mod N
              */
             for( i = 0; i < wsize; i++ )
-                MBEDTLS_MPI_CHK( mpi_montmul( X, X, N, mm, &T ) );
+                MBEDTLS_MPI_CHK( MPI_EXP_MONTSQR( X ) );
 
             /*
              * X = X * W[wbits] R^-1 mod N
              */
-            MBEDTLS_MPI_CHK( mpi_montmul( X, &W[wbits], N, mm, &T ) );
+            MBEDTLS_MPI_CHK( MPI_EXP_MONTMUL( X, &W[wbits] ) );
 
             state--;
             nbits = 0;
@@ -1777,12 +2522,12 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
      */
     for( i = 0; i < nbits; i++ )
     {
-        MBEDTLS_MPI_CHK( mpi_montmul( X, X, N, mm, &T ) );
+        MBEDTLS_MPI_CHK( MPI_EXP_MONTSQR( X ) );
 
         wbits <<= 1;
 
         if( ( wbits & ( one << wsize ) ) != 0 )
-            MBEDTLS_MPI_CHK( mpi_montmul( X, &W[1], N, mm, &T ) );
+            MBEDTLS_MPI_CHK( MPI_EXP_MONTMUL( X, &W[1] ) );
     }
 
     /*
@@ -1798,10 +2543,53 @@ int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi
 
 cleanup:
 
-    for( i = ( one << ( wsize - 1 ) ); i < ( one << wsize ); i++ )
-        mbedtls_mpi_free( &W[i] );
+    if( work != NULL )
+    {
+        mbedtls_mpi_zeroize( work, ( table_len + 2 ) * ( N->n + 1 ) );
+        mbedtls_free( work );
+    }
+
+    mbedtls_mpi_free( &W[1] ); mbedtls_mpi_free( &Apos );
+
+    return( ret );
+}
+
+/*
+ * Sliding-window exponentiation: X = A^E mod N  (HAC 14.85)
+ */
+int mbedtls_mpi_exp_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *E, const mbedtls_mpi *N, mbedtls_mpi *_RR )
+{
+    int ret;
+    mbedtls_mpi_uint mm;
+    mbedtls_mpi RR;
+
+    if( mbedtls_mpi_cmp_int( N, 0 ) < 0 || ( N->p[0] & 1 ) == 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    if( mbedtls_mpi_cmp_int( E, 0 ) < 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    mpi_montg_init( &mm, N );
+    mbedtls_mpi_init( &RR );
+
+    /*
+     * If 1st call, pre-compute R^2 mod N
+     */
+    if( _RR == NULL || _RR->p == NULL )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &RR, 1 ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &RR, N->n * 2 * biL ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &RR, &RR, N ) );
+
+        if( _RR != NULL )
+            memcpy( _RR, &RR, sizeof( mbedtls_mpi ) );
+    }
+    else
+        memcpy( &RR, _RR, sizeof( mbedtls_mpi ) );
+
+    MBEDTLS_MPI_CHK( mpi_exp_mod_mont( X, A, E, N, &RR, mm ) );
 
-    mbedtls_mpi_free( &W[1] ); mbedtls_mpi_free( &T ); mbedtls_mpi_free( &Apos );
+cleanup:
 
     if( _RR == NULL || _RR->p == NULL )
         mbedtls_mpi_free( &RR );
@@ -1886,57 +2674,404 @@ cleanup:
 }
 
 /*
- * Modular inverse: X = A^-1 mod N  (HAC 14.61 / 14.64)
+ * Constant-time helpers for mbedtls_mpi_inv_mod_odd(), working on n-limb
+ * arrays holding two's complement values. Conditions are 0 or 1 and are
+ * turned into all-zero or all-one masks, so that the sequence of operations
+ * doesn't depend on them.
  */
-int mbedtls_mpi_inv_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *N )
-{
-    int ret;
-    mbedtls_mpi G, TA, TU, U1, U2, TB, TV, V1, V2;
-
-    if( mbedtls_mpi_cmp_int( N, 1 ) <= 0 )
-        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
 
-    mbedtls_mpi_init( &TA ); mbedtls_mpi_init( &TU ); mbedtls_mpi_init( &U1 ); mbedtls_mpi_init( &U2 );
-    mbedtls_mpi_init( &G ); mbedtls_mpi_init( &TB ); mbedtls_mpi_init( &TV );
-    mbedtls_mpi_init( &V1 ); mbedtls_mpi_init( &V2 );
+/* Number of divsteps per batch: keeps the transition matrix within a limb */
+#define MPI_DIVSTEPS    ( biL - 2 )
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_gcd( &G, A, N ) );
+/* Return 1 if a < b (as unsigned values), 0 otherwise */
+static mbedtls_mpi_uint mpi_ct_lt( size_t n, const mbedtls_mpi_uint *a,
+                                   const mbedtls_mpi_uint *b )
+{
+    size_t i;
+    mbedtls_mpi_uint c, z, t;
 
-    if( mbedtls_mpi_cmp_int( &G, 1 ) != 0 )
+    for( i = c = 0; i < n; i++ )
     {
-        ret = MBEDTLS_ERR_MPI_NOT_ACCEPTABLE;
-        goto cleanup;
+        t = a[i];
+        z = ( t < c );   t -= c;
+        c = ( t < b[i] ) + z;
     }
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &TA, A, N ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TU, &TA ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TB, N ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TV, N ) );
+    return( c );
+}
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &U1, 1 ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &U2, 0 ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &V1, 0 ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &V2, 1 ) );
+/* d += cond ? s : 0 */
+static void mpi_ct_add( size_t n, mbedtls_mpi_uint *d,
+                        const mbedtls_mpi_uint *s, mbedtls_mpi_uint cond )
+{
+    size_t i;
+    mbedtls_mpi_uint c, t, mask = (mbedtls_mpi_uint) 0 - cond;
 
-    do
+    for( i = c = 0; i < n; i++ )
     {
-        while( ( TU.p[0] & 1 ) == 0 )
-        {
-            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &TU, 1 ) );
+        t = s[i] & mask;
+        d[i] += c;  c  = ( d[i] < c );
+        d[i] += t;  c += ( d[i] < t );
+    }
+}
 
-            if( ( U1.p[0] & 1 ) != 0 || ( U2.p[0] & 1 ) != 0 )
-            {
-                MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &U1, &U1, &TB ) );
-                MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &U2, &U2, &TA ) );
-            }
+/* d -= cond ? s : 0 */
+static void mpi_ct_sub( size_t n, mbedtls_mpi_uint *d,
+                        const mbedtls_mpi_uint *s, mbedtls_mpi_uint cond )
+{
+    size_t i;
+    mbedtls_mpi_uint c, z, t, mask = (mbedtls_mpi_uint) 0 - cond;
 
-            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &U1, 1 ) );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &U2, 1 ) );
-        }
+    for( i = c = 0; i < n; i++ )
+    {
+        t = s[i] & mask;
+        z = ( d[i] < c );   d[i] -= c;
+        c = ( d[i] < t ) + z; d[i] -= t;
+    }
+}
 
-        while( ( TV.p[0] & 1 ) == 0 )
-        {
-            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &TV, 1 ) );
+/* Return the low limb of a * b, and the high one in *hi */
+static mbedtls_mpi_uint mpi_mul_limb( mbedtls_mpi_uint a, mbedtls_mpi_uint b,
+                                      mbedtls_mpi_uint *hi )
+{
+#if defined(MBEDTLS_HAVE_UDBL)
+    mbedtls_t_udbl r = (mbedtls_t_udbl) a * b;
+
+    *hi = (mbedtls_mpi_uint)( r >> biL );
+    return( (mbedtls_mpi_uint) r );
+#else
+    const mbedtls_mpi_uint mask = ( (mbedtls_mpi_uint) 1 << biH ) - 1;
+    mbedtls_mpi_uint a0 = a & mask, a1 = a >> biH;
+    mbedtls_mpi_uint b0 = b & mask, b1 = b >> biH;
+    mbedtls_mpi_uint p00 = a0 * b0, p01 = a0 * b1;
+    mbedtls_mpi_uint p10 = a1 * b0, p11 = a1 * b1, mid;
+
+    mid = ( p00 >> biH ) + ( p01 & mask ) + ( p10 & mask );
+    *hi = p11 + ( p01 >> biH ) + ( p10 >> biH ) + ( mid >> biH );
+    return( ( mid << biH ) | ( p00 & mask ) );
+#endif
+}
+
+/*
+ * d += s * x mod 2^(n * biL), where s is a signed limb with |s| < 2^(biL-1)
+ */
+static void mpi_ct_mla( size_t n, mbedtls_mpi_uint *d,
+                        const mbedtls_mpi_uint *x, mbedtls_mpi_uint s )
+{
+    size_t i;
+    mbedtls_mpi_uint neg = (mbedtls_mpi_uint) 0 - ( s >> ( biL - 1 ) );
+    mbedtls_mpi_uint a = ( s ^ neg ) - neg;
+    mbedtls_mpi_uint c = 0, cd = neg & 1, lo, hi;
+
+    /* Add |s| * x, or its two's complement ~(|s| * x) + 1 if s < 0 */
+    for( i = 0; i < n; i++ )
+    {
+        lo = mpi_mul_limb( a, x[i], &hi );
+        lo += c;    c = hi + ( lo < c );
+        lo ^= neg;
+        d[i] += cd; cd  = ( d[i] < cd );
+        d[i] += lo; cd += ( d[i] < lo );
+    }
+}
+
+/* Arithmetic right shift of a two's complement value by k < biL bits */
+static void mpi_ct_shift_r_signed( size_t n, mbedtls_mpi_uint *d, size_t k )
+{
+    size_t i;
+    mbedtls_mpi_uint sign = (mbedtls_mpi_uint) 0 - ( d[n - 1] >> ( biL - 1 ) );
+
+    for( i = 0; i + 1 < n; i++ )
+        d[i] = ( d[i] >> k ) | ( d[i + 1] << ( biL - k ) );
+
+    d[n - 1] = ( d[n - 1] >> k ) | ( sign << ( biL - k ) );
+}
+
+/*
+ * Run MPI_DIVSTEPS divsteps on the low limbs of f and g, starting with the
+ * given delta, and return the new delta. The transition matrix is stored
+ * in t[] = { u, v, q, r }, scaled by 2^MPI_DIVSTEPS:
+ * f' * 2^MPI_DIVSTEPS = u * f + v * g, g' * 2^MPI_DIVSTEPS = q * f + r * g.
+ *
+ * One divstep (Bernstein-Yang) is:
+ *   if delta > 0 and g odd: delta, f, g = 1 - delta, g, (g - f) / 2
+ *   else if g odd:          delta, f, g = 1 + delta, f, (g + f) / 2
+ *   else:                   delta, f, g = 1 + delta, f, g / 2
+ * and only depends on delta and the low bits of f and g.
+ */
+static mbedtls_mpi_uint mpi_divsteps( mbedtls_mpi_uint delta,
+                                      mbedtls_mpi_uint f, mbedtls_mpi_uint g,
+                                      mbedtls_mpi_uint t[4] )
+{
+    size_t i;
+    mbedtls_mpi_uint u = 1, v = 0, q = 0, r = 1;
+    mbedtls_mpi_uint c1, c2, x, y, z;
+
+    for( i = 0; i < MPI_DIVSTEPS; i++ )
+    {
+        /* c1: delta > 0 and g odd (swap), c2: g odd */
+        c2 = (mbedtls_mpi_uint) 0 - ( g & 1 );
+        c1 = (mbedtls_mpi_uint) 0 - ( ( (mbedtls_mpi_uint) 0 - delta ) >> ( biL - 1 ) );
+        c1 &= c2;
+
+        /* g += f or g -= f (in which case f, u and v are negated first) */
+        x = ( f ^ c1 ) - c1;
+        y = ( u ^ c1 ) - c1;
+        z = ( v ^ c1 ) - c1;
+        g += x & c2;
+        q += y & c2;
+        r += z & c2;
+
+        /* On swap, f = f + (g - f) = g, and the same for (u, v) */
+        f += g & c1;
+        u += q & c1;
+        v += r & c1;
+
+        delta = ( delta ^ c1 ) - c1 + 1;
+        g >>= 1;
+        u <<= 1;
+        v <<= 1;
+    }
+
+    t[0] = u; t[1] = v; t[2] = q; t[3] = r;
+
+    return( delta );
+}
+
+/*
+ * Modular inverse for odd N, constant-time (Bernstein-Yang safegcd)
+ *
+ * We keep f = d * A and g = e * A (mod N), starting from f = N, g = A,
+ * d = 0, e = 1, and apply divsteps in batches: the divsteps themselves run
+ * on single limbs, and their combined effect is then applied to the full
+ * values. After enough divsteps (bounded in terms of the size of N only),
+ * g = 0 and f = +/- gcd(A, N), so that +/- d is the inverse if f = +/- 1.
+ *
+ * All values are two's complement on n + 2 limbs, and all batches are run
+ * regardless of when g reaches 0, so the sequence of operations only
+ * depends on the size of N.
+ */
+int mbedtls_mpi_inv_mod_odd( mbedtls_mpi *X, const mbedtls_mpi *A,
+                             const mbedtls_mpi *N )
+{
+    int ret;
+    size_t i, n, m, bits, steps;
+    mbedtls_mpi_uint *buf = NULL, *f, *g, *d, *e, *tf, *tg, *md, *p;
+    mbedtls_mpi_uint delta, mm, k, t[4], neg, one, minus_one;
+    mbedtls_mpi TA;
+
+    if( mbedtls_mpi_cmp_int( N, 1 ) <= 0 || ( N->p[0] & 1 ) == 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    for( n = N->n; n > 1; n-- )
+        if( N->p[n - 1] != 0 )
+            break;
+
+    m = n + 2;
+    mbedtls_mpi_init( &TA );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &TA, A, N ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &TA, n ) );
+
+    buf = (mbedtls_mpi_uint *) mbedtls_calloc( 7 * m, ciL );
+    if( buf == NULL )
+    {
+        ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    f  = buf;
+    g  = buf + m;
+    d  = buf + 2 * m;
+    e  = buf + 3 * m;
+    tf = buf + 4 * m;
+    tg = buf + 5 * m;
+    md = buf + 6 * m;
+
+    memcpy( f,  N->p, n * ciL );
+    memcpy( md, N->p, n * ciL );
+    memcpy( g,  TA.p, n * ciL );
+    e[0] = 1;
+    delta = 1;
+
+    mpi_montg_init( &mm, N );
+
+    /* Number of divsteps that guarantees g = 0, from the safegcd paper */
+    bits = mbedtls_mpi_bitlen( N );
+    steps = bits < 46 ? ( 49 * bits + 80 ) / 17 : ( 49 * bits + 57 ) / 17;
+
+    for( i = 0; i < steps; i += MPI_DIVSTEPS )
+    {
+        delta = mpi_divsteps( delta, f[0], g[0], t );
+
+        /* f, g = ( u * f + v * g, q * f + r * g ) / 2^MPI_DIVSTEPS */
+        memset( tf, 0, m * ciL );
+        memset( tg, 0, m * ciL );
+        mpi_ct_mla( m, tf, f, t[0] );
+        mpi_ct_mla( m, tf, g, t[1] );
+        mpi_ct_mla( m, tg, f, t[2] );
+        mpi_ct_mla( m, tg, g, t[3] );
+        mpi_ct_shift_r_signed( m, tf, MPI_DIVSTEPS );
+        mpi_ct_shift_r_signed( m, tg, MPI_DIVSTEPS );
+        p = f; f = tf; tf = p;
+        p = g; g = tg; tg = p;
+
+        /*
+         * d, e = ( u * d + v * e, q * d + r * e ) / 2^MPI_DIVSTEPS mod N:
+         * add the multiple of N that clears the low bits, shift, and bring
+         * the result from ( -2N, 2N ) back to [ 0, N )
+         */
+        memset( tf, 0, m * ciL );
+        memset( tg, 0, m * ciL );
+        mpi_ct_mla( m, tf, d, t[0] );
+        mpi_ct_mla( m, tf, e, t[1] );
+        mpi_ct_mla( m, tg, d, t[2] );
+        mpi_ct_mla( m, tg, e, t[3] );
+
+        k = ( tf[0] * mm ) & ( ( (mbedtls_mpi_uint) 1 << MPI_DIVSTEPS ) - 1 );
+        mpi_ct_mla( m, tf, md, k );
+        k = ( tg[0] * mm ) & ( ( (mbedtls_mpi_uint) 1 << MPI_DIVSTEPS ) - 1 );
+        mpi_ct_mla( m, tg, md, k );
+
+        mpi_ct_shift_r_signed( m, tf, MPI_DIVSTEPS );
+        mpi_ct_shift_r_signed( m, tg, MPI_DIVSTEPS );
+
+        for( p = tf; ; p = tg )
+        {
+            mpi_ct_add( m, p, md, p[m - 1] >> ( biL - 1 ) );
+            mpi_ct_add( m, p, md, p[m - 1] >> ( biL - 1 ) );
+            mpi_ct_sub( m, p, md, 1 - mpi_ct_lt( m, p, md ) );
+
+            if( p == tg )
+                break;
+        }
+
+        p = d; d = tf; tf = p;
+        p = e; e = tg; tg = p;
+    }
+
+    /* f is now +/- gcd( A, N ) */
+    one = f[0] ^ 1;
+    minus_one = ~f[0];
+    for( i = 1; i < m; i++ )
+    {
+        one |= f[i];
+        minus_one |= ~f[i];
+    }
+
+    if( one != 0 && minus_one != 0 )
+    {
+        ret = MBEDTLS_ERR_MPI_NOT_ACCEPTABLE;
+        goto cleanup;
+    }
+
+    /* X = -d mod N if f = -1: d is in [ 1, N ), so this is N - d */
+    neg = ( minus_one == 0 );
+    memcpy( tf, md, m * ciL );
+    mpi_ct_sub( m, tf, d, 1 );
+    mpi_ct_sub( m, d, d, neg );
+    mpi_ct_add( m, d, tf, neg );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, n ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( X, 0 ) );
+    memcpy( X->p, d, n * ciL );
+
+cleanup:
+
+    if( buf != NULL )
+    {
+        mbedtls_mpi_zeroize( buf, 7 * m );
+        mbedtls_free( buf );
+    }
+
+    mbedtls_mpi_free( &TA );
+
+    return( ret );
+}
+
+/*
+ * Modular inverse mod a prime: X = A^(P-2) mod P (Fermat's little theorem)
+ */
+int mbedtls_mpi_inv_mod_prime( mbedtls_mpi *X, const mbedtls_mpi *A,
+                               const mbedtls_mpi *P, mbedtls_mpi *_RR )
+{
+    int ret;
+    mbedtls_mpi E;
+
+    if( mbedtls_mpi_cmp_int( P, 2 ) <= 0 || ( P->p[0] & 1 ) == 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    mbedtls_mpi_init( &E );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_int( &E, P, 2 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( X, A, &E, P, _RR ) );
+
+    /* Only A = 0 mod P has no inverse */
+    if( mbedtls_mpi_cmp_int( X, 0 ) == 0 )
+        ret = MBEDTLS_ERR_MPI_NOT_ACCEPTABLE;
+
+cleanup:
+
+    mbedtls_mpi_free( &E );
+
+    return( ret );
+}
+
+/*
+ * Modular inverse: X = A^-1 mod N  (HAC 14.61 / 14.64)
+ */
+int mbedtls_mpi_inv_mod( mbedtls_mpi *X, const mbedtls_mpi *A, const mbedtls_mpi *N )
+{
+    int ret;
+    mbedtls_mpi G, TA, TU, U1, U2, TB, TV, V1, V2;
+
+    if( mbedtls_mpi_cmp_int( N, 1 ) <= 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    /* Odd moduli (prime fields, group orders, RSA moduli) take the fast path */
+    if( ( N->p[0] & 1 ) != 0 )
+        return( mbedtls_mpi_inv_mod_odd( X, A, N ) );
+
+    mbedtls_mpi_init( &TA ); mbedtls_mpi_init( &TU ); mbedtls_mpi_init( &U1 ); mbedtls_mpi_init( &U2 );
+    mbedtls_mpi_init( &G ); mbedtls_mpi_init( &TB ); mbedtls_mpi_init( &TV );
+    mbedtls_mpi_init( &V1 ); mbedtls_mpi_init( &V2 );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_gcd( &G, A, N ) );
+
+    if( mbedtls_mpi_cmp_int( &G, 1 ) != 0 )
+    {
+        ret = MBEDTLS_ERR_MPI_NOT_ACCEPTABLE;
+        goto cleanup;
+    }
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &TA, A, N ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TU, &TA ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TB, N ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &TV, N ) );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &U1, 1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &U2, 0 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &V1, 0 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &V2, 1 ) );
+
+    do
+    {
+        while( ( TU.p[0] & 1 ) == 0 )
+        {
+            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &TU, 1 ) );
+
+            if( ( U1.p[0] & 1 ) != 0 || ( U2.p[0] & 1 ) != 0 )
+            {
+                MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &U1, &U1, &TB ) );
+                MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &U2, &U2, &TA ) );
+            }
+
+            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &U1, 1 ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &U2, 1 ) );
+        }
+
+        while( ( TV.p[0] & 1 ) == 0 )
+        {
+            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &TV, 1 ) );
 
             if( ( V1.p[0] & 1 ) != 0 || ( V2.p[0] & 1 ) != 0 )
             {
@@ -1980,6 +3115,299 @@ cleanup:
     return( ret );
 }
 
+/*
+ * Largest modulus, in limbs, whose Barrett scratch space goes on the stack
+ */
+#define MPI_BARRETT_STACK_K     ( ( 521 + biL - 1 ) / biL )
+#define MPI_BARRETT_SCRATCH( k, m ) ( 4 * ( k ) + 2 * ( m ) + 1 )
+
+/*
+ * Barrett reduction: X = A mod N, 0 <= A < 2^(2 * biL * k)  (HAC 14.42)
+ *
+ * a is the number of used limbs of A, k = N->n the number of limbs of N,
+ * whose top limb is not zero. Only the low k + 1 limbs of q3 * N are
+ * needed, but the full product is cheap at the sizes where this matters.
+ */
+static int mpi_barrett( mbedtls_mpi *X, const mbedtls_mpi *A, size_t a,
+                        const mbedtls_mpi_mod_ctx *ctx )
+{
+    int ret = 0;
+    size_t i, k = ctx->N.n, m, l1, l2, l3, wn;
+    mbedtls_mpi_uint Tp[MPI_BARRETT_SCRATCH( MPI_BARRETT_STACK_K,
+                                             MPI_BARRETT_STACK_K + 2 )];
+    mbedtls_mpi_uint *w = Tp, *q2, *r2, *r, c, z;
+    const mbedtls_mpi_uint *q1 = A->p + ( k - 1 );
+
+    for( m = ctx->mu.n; m > 0; m-- )
+        if( ctx->mu.p[m - 1] != 0 )
+            break;
+
+    wn = MPI_BARRETT_SCRATCH( k, m );
+    if( wn > sizeof( Tp ) / ciL )
+    {
+        w = (mbedtls_mpi_uint *) mbedtls_calloc( wn, ciL );
+        if( w == NULL )
+            return( MBEDTLS_ERR_MPI_ALLOC_FAILED );
+    }
+    else
+        memset( w, 0, wn * ciL );
+
+    /*
+     * q2 = floor( A / b^(k-1) ) * mu, q3 = floor( q2 / b^(k+1) )
+     */
+    l1 = a - ( k - 1 );
+    q2 = w;
+    for( i = 0; i < m; i++ )
+        mpi_mul_hlp( l1, (mbedtls_mpi_uint *) q1, q2 + i, ctx->mu.p[i] );
+
+    /*
+     * r2 = q3 * N, truncated to k + 1 limbs below
+     */
+    l2 = ( l1 + m > k + 1 ) ? l1 + m - ( k + 1 ) : 0;
+    r2 = q2 + l1 + m;
+    for( i = 0; i < l2; i++ )
+        mpi_mul_hlp( k, ctx->N.p, r2 + i, q2[k + 1 + i] );
+
+    /*
+     * r = ( A - r2 ) mod b^(k+1), which is < 3 N
+     */
+    r = r2 + l2 + k;
+    l3 = ( a < k + 1 ) ? a : k + 1;
+    memcpy( r, A->p, l3 * ciL );
+
+    for( i = c = 0; i < k + 1; i++ )
+    {
+        z = ( r[i] < c );       r[i] -= c;
+        c = ( r[i] < r2[i] ) + z; r[i] -= r2[i];
+    }
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, k + 1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( X, 0 ) );
+    memcpy( X->p, r, ( k + 1 ) * ciL );
+
+    while( mbedtls_mpi_cmp_abs( X, &ctx->N ) >= 0 )
+        mpi_sub_hlp( k, ctx->N.p, X->p );
+
+cleanup:
+
+    mbedtls_mpi_zeroize( w, wn );
+    if( w != Tp )
+        mbedtls_free( w );
+
+    return( ret );
+}
+
+/*
+ * Initialize a modulus context
+ */
+void mbedtls_mpi_mod_init( mbedtls_mpi_mod_ctx *ctx )
+{
+    mbedtls_mpi_init( &ctx->N );
+    mbedtls_mpi_init( &ctx->mu );
+    mbedtls_mpi_init( &ctx->RR );
+    ctx->mm = 0;
+}
+
+/*
+ * Free the components of a modulus context
+ */
+void mbedtls_mpi_mod_free( mbedtls_mpi_mod_ctx *ctx )
+{
+    if( ctx == NULL )
+        return;
+
+    mbedtls_mpi_free( &ctx->N );
+    mbedtls_mpi_free( &ctx->mu );
+    mbedtls_mpi_free( &ctx->RR );
+    ctx->mm = 0;
+}
+
+/*
+ * Precompute mu = floor( b^(2k) / N ) and, for odd N, R^2 = b^(2k) mod N
+ * (the remainder of the same division) and mm = -N^-1 mod b
+ */
+int mbedtls_mpi_mod_setup( mbedtls_mpi_mod_ctx *ctx, const mbedtls_mpi *N )
+{
+    int ret;
+    mbedtls_mpi B2k;
+
+    if( mbedtls_mpi_cmp_int( N, 0 ) <= 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    mbedtls_mpi_init( &B2k );
+    mbedtls_mpi_mod_free( ctx );
+
+    /* Copy to an empty MPI so that N.n is the number of used limbs */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &ctx->N, N ) );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &B2k, 1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &B2k, ctx->N.n * 2 * biL ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_div_mpi( &ctx->mu, &B2k, &B2k, &ctx->N ) );
+
+    if( ( ctx->N.p[0] & 1 ) != 0 )
+    {
+        mpi_montg_init( &ctx->mm, &ctx->N );
+        mbedtls_mpi_swap( &ctx->RR, &B2k );
+    }
+
+cleanup:
+
+    mbedtls_mpi_free( &B2k );
+
+    if( ret != 0 )
+        mbedtls_mpi_mod_free( ctx );
+
+    return( ret );
+}
+
+/*
+ * Reduction: X = A mod N
+ */
+int mbedtls_mpi_mod_reduce( mbedtls_mpi *X, const mbedtls_mpi *A,
+                            const mbedtls_mpi_mod_ctx *ctx )
+{
+    int ret;
+    size_t a, k = ctx->N.n;
+    int neg = ( A->s < 0 );
+
+    if( k == 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    for( a = A->n; a > 0; a-- )
+        if( A->p[a - 1] != 0 )
+            break;
+
+    if( a > 2 * k )
+        return( mbedtls_mpi_mod_mpi( X, A, &ctx->N ) );
+
+    if( a < k )
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( X, A ) );
+    else
+        MBEDTLS_MPI_CHK( mpi_barrett( X, A, a, ctx ) );
+
+    X->s = 1;
+    if( neg && mbedtls_mpi_cmp_int( X, 0 ) != 0 )
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_abs( X, &ctx->N, X ) );
+
+cleanup:
+
+    return( ret );
+}
+
+/*
+ * Montgomery reduction: X = A R^-1 mod N, 0 <= A < R^2  (HAC 14.32)
+ *
+ * As in mpi_montsqr(), each step adds the multiple of N that clears the
+ * next low limb of (a copy of) A, so that the top half is A R^-1 plus less
+ * than N.
+ */
+int mbedtls_mpi_mod_montred( mbedtls_mpi *X, const mbedtls_mpi *A,
+                             const mbedtls_mpi_mod_ctx *ctx )
+{
+    int ret = 0;
+    size_t i, a, n = ctx->N.n;
+    mbedtls_mpi_uint Tp[2 * MPI_BARRETT_STACK_K + 2];
+    mbedtls_mpi_uint *d = Tp;
+
+    if( ctx->RR.p == NULL || A->s < 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    for( a = A->n; a > 0; a-- )
+        if( A->p[a - 1] != 0 )
+            break;
+
+    if( a > 2 * n )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    /* A + U N < 2 R^2 fits in 2n + 1 limbs, the extra one is for the carry */
+    if( 2 * n + 2 > sizeof( Tp ) / ciL )
+    {
+        d = (mbedtls_mpi_uint *) mbedtls_calloc( 2 * n + 2, ciL );
+        if( d == NULL )
+            return( MBEDTLS_ERR_MPI_ALLOC_FAILED );
+    }
+    else
+        memset( d, 0, ( 2 * n + 2 ) * ciL );
+
+    memcpy( d, A->p, a * ciL );
+
+    for( i = 0; i < n; i++ )
+        mpi_mul_hlp( n, ctx->N.p, d + i, d[i] * ctx->mm );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( X, n + 1 ) );
+    memset( X->p, 0, X->n * ciL );
+    memcpy( X->p, d + n, ( n + 1 ) * ciL );
+    X->s = 1;
+
+    while( mbedtls_mpi_cmp_abs( X, &ctx->N ) >= 0 )
+        mpi_sub_hlp( n, ctx->N.p, X->p );
+
+cleanup:
+
+    mbedtls_mpi_zeroize( d, 2 * n + 2 );
+    if( d != Tp )
+        mbedtls_free( d );
+
+    return( ret );
+}
+
+/*
+ * Modular multiplication: X = A * B mod N
+ */
+int mbedtls_mpi_mod_mul( mbedtls_mpi *X, const mbedtls_mpi *A,
+                         const mbedtls_mpi *B, const mbedtls_mpi_mod_ctx *ctx )
+{
+    int ret;
+    mbedtls_mpi T;
+
+    mbedtls_mpi_init( &T );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T, A, B ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_reduce( X, &T, ctx ) );
+
+cleanup:
+
+    mbedtls_mpi_free( &T );
+
+    return( ret );
+}
+
+/*
+ * Modular squaring: X = A^2 mod N
+ */
+int mbedtls_mpi_mod_sqr( mbedtls_mpi *X, const mbedtls_mpi *A,
+                         const mbedtls_mpi_mod_ctx *ctx )
+{
+    return( mbedtls_mpi_mod_mul( X, A, A, ctx ) );
+}
+
+/*
+ * Modular exponentiation: X = A^E mod N
+ */
+int mbedtls_mpi_mod_exp( mbedtls_mpi *X, const mbedtls_mpi *A,
+                         const mbedtls_mpi *E, const mbedtls_mpi_mod_ctx *ctx )
+{
+    if( ctx->RR.p == NULL )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    if( mbedtls_mpi_cmp_int( E, 0 ) < 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    return( mpi_exp_mod_mont( X, A, E, &ctx->N, &ctx->RR, ctx->mm ) );
+}
+
+/*
+ * Modular inverse: X = A^-1 mod N
+ */
+int mbedtls_mpi_mod_inv( mbedtls_mpi *X, const mbedtls_mpi *A,
+                         const mbedtls_mpi_mod_ctx *ctx )
+{
+    if( ctx->N.n == 0 )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    return( mbedtls_mpi_inv_mod( X, A, &ctx->N ) );
+}
+
 #if defined(MBEDTLS_GENPRIME)
 
 static const int small_prime[] =
@@ -2025,17 +3453,63 @@ static int mpi_check_small_factors( const mbedtls_mpi *X )
     if( ( X->p[0] & 1 ) == 0 )
         return( MBEDTLS_ERR_MPI_NOT_ACCEPTABLE );
 
-    for( i = 0; small_prime[i] > 0; i++ )
+    for( i = 0; small_prime[i] > 0; i++ )
+    {
+        if( mbedtls_mpi_cmp_int( X, small_prime[i] ) <= 0 )
+            return( 1 );
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_int( &r, X, small_prime[i] ) );
+
+        if( r == 0 )
+            return( MBEDTLS_ERR_MPI_NOT_ACCEPTABLE );
+    }
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * One Miller-Rabin round (HAC 4.24, steps 2.2 and 2.3) with witness A,
+ * where W = |X| - 1 = 2^s * R with R odd. A is overwritten.
+ */
+static int mpi_miller_rabin_round( mbedtls_mpi *A, const mbedtls_mpi *X,
+                                   const mbedtls_mpi *W, const mbedtls_mpi *R,
+                                   size_t s, mbedtls_mpi *RR, mbedtls_mpi *T )
+{
+    int ret;
+    size_t j;
+
+    /*
+     * A = A^R mod |X|
+     */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( A, A, R, X, RR ) );
+
+    if( mbedtls_mpi_cmp_mpi( A, W ) == 0 ||
+        mbedtls_mpi_cmp_int( A,  1 ) == 0 )
+        return( 0 );
+
+    j = 1;
+    while( j < s && mbedtls_mpi_cmp_mpi( A, W ) != 0 )
     {
-        if( mbedtls_mpi_cmp_int( X, small_prime[i] ) <= 0 )
-            return( 1 );
+        /*
+         * A = A * A mod |X|
+         */
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T, A, A ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( A, T, X  ) );
 
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_int( &r, X, small_prime[i] ) );
+        if( mbedtls_mpi_cmp_int( A, 1 ) == 0 )
+            break;
 
-        if( r == 0 )
-            return( MBEDTLS_ERR_MPI_NOT_ACCEPTABLE );
+        j++;
     }
 
+    /*
+     * not prime if A != |X| - 1 or A == 1
+     */
+    if( mbedtls_mpi_cmp_mpi( A, W ) != 0 ||
+        mbedtls_mpi_cmp_int( A,  1 ) == 0 )
+        ret = MBEDTLS_ERR_MPI_NOT_ACCEPTABLE;
+
 cleanup:
     return( ret );
 }
@@ -2102,39 +3576,7 @@ static int mpi_miller_rabin( const mbedtls_mpi *X,
         } while ( mbedtls_mpi_cmp_mpi( &A, &W ) >= 0 ||
                   mbedtls_mpi_cmp_int( &A, 1 )  <= 0    );
 
-        /*
-         * A = A^R mod |X|
-         */
-        MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &A, &A, &R, X, &RR ) );
-
-        if( mbedtls_mpi_cmp_mpi( &A, &W ) == 0 ||
-            mbedtls_mpi_cmp_int( &A,  1 ) == 0 )
-            continue;
-
-        j = 1;
-        while( j < s && mbedtls_mpi_cmp_mpi( &A, &W ) != 0 )
-        {
-            /*
-             * A = A * A mod |X|
-             */
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T, &A, &A ) );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &A, &T, X  ) );
-
-            if( mbedtls_mpi_cmp_int( &A, 1 ) == 0 )
-                break;
-
-            j++;
-        }
-
-        /*
-         * not prime if A != |X| - 1 or A == 1
-         */
-        if( mbedtls_mpi_cmp_mpi( &A, &W ) != 0 ||
-            mbedtls_mpi_cmp_int( &A,  1 ) == 0 )
-        {
-            ret = MBEDTLS_ERR_MPI_NOT_ACCEPTABLE;
-            break;
-        }
+        MBEDTLS_MPI_CHK( mpi_miller_rabin_round( &A, X, &W, &R, s, &RR, &T ) );
     }
 
 cleanup:
@@ -2178,20 +3620,193 @@ int mbedtls_mpi_is_prime( const mbedtls_mpi *X,
 
 /*
  * Prime number generation
+ *
+ * Candidates are X, X + step, X + 2 * step, ... where X is random, step is
+ * 2 (or 12 with dh_flag, see mpi_gen_prime_start()). Large candidates are
+ * searched a window of MPI_SIEVE_SIZE at a time: the window is first sieved
+ * with the odd primes below MPI_SIEVE_PRIME_LIMIT, using residues of X that
+ * are computed once and then updated incrementally from window to window.
+ * The survivors are then screened with a Miller-Rabin round to the fixed base
+ * 2, and only the first candidate passing it goes through the randomized
+ * Miller-Rabin test. Since the screening does not use the RNG, it can be
+ * spread over several threads (MBEDTLS_MPI_GEN_PRIME_THREADS) without
+ * changing the result: for a given RNG output the same prime is found
+ * whatever the number of threads.
  */
-int mbedtls_mpi_gen_prime( mbedtls_mpi *X, size_t nbits, int dh_flag,
-                   int (*f_rng)(void *, unsigned char *, size_t),
-                   void *p_rng )
+#define MPI_SIEVE_SIZE          4096    /* candidates per sieve window          */
+#define MPI_SIEVE_PRIME_LIMIT   8192    /* sieve with the odd primes below this */
+#define MPI_SIEVE_MIN_BITS        64    /* smaller primes are searched one by one */
+
+/*
+ * State of the search over the survivors of one sieve window
+ */
+typedef struct
+{
+    const mbedtls_mpi *X;       /* first candidate of the window            */
+    mbedtls_mpi_uint step;      /* distance between consecutive candidates  */
+    int dh_flag;
+    const unsigned char *sieve; /* non-zero: candidate has a small factor   */
+    size_t next;                /* next candidate to screen                 */
+    size_t found;               /* first candidate known to pass screening,
+                                   MPI_SIEVE_SIZE if none                   */
+    int ret;                    /* first error other than NOT_ACCEPTABLE    */
+#if defined(MPI_GEN_PRIME_PARALLEL)
+    mbedtls_threading_mutex_t mutex;
+#endif
+}
+mpi_prime_search;
+
+#if defined(MPI_GEN_PRIME_PARALLEL)
+#define MPI_SEARCH_LOCK( ps )   mbedtls_mutex_lock( &(ps)->mutex )
+#define MPI_SEARCH_UNLOCK( ps ) mbedtls_mutex_unlock( &(ps)->mutex )
+#else
+#define MPI_SEARCH_LOCK( ps )   0
+#define MPI_SEARCH_UNLOCK( ps ) 0
+#endif
+
+/*
+ * Miller-Rabin round to base 2: a cheap deterministic filter that rejects
+ * nearly all composites surviving the sieve.
+ */
+static int mpi_miller_rabin_base2( const mbedtls_mpi *X )
 {
     int ret;
-    size_t k, n;
-    mbedtls_mpi_uint r;
-    mbedtls_mpi Y;
+    size_t s;
+    mbedtls_mpi W, R, T, A, RR;
 
-    if( nbits < 3 || nbits > MBEDTLS_MPI_MAX_BITS )
-        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+    mbedtls_mpi_init( &W ); mbedtls_mpi_init( &R ); mbedtls_mpi_init( &T ); mbedtls_mpi_init( &A );
+    mbedtls_mpi_init( &RR );
 
-    mbedtls_mpi_init( &Y );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_int( &W, X, 1 ) );
+    s = mbedtls_mpi_lsb( &W );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R, &W ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &R, s ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &A, 2 ) );
+
+    MBEDTLS_MPI_CHK( mpi_miller_rabin_round( &A, X, &W, &R, s, &RR, &T ) );
+
+cleanup:
+    mbedtls_mpi_free( &W ); mbedtls_mpi_free( &R ); mbedtls_mpi_free( &T ); mbedtls_mpi_free( &A );
+    mbedtls_mpi_free( &RR );
+
+    return( ret );
+}
+
+/*
+ * Screen candidate i of the window: C = X + i * step (and (C - 1) / 2)
+ */
+static int mpi_prime_screen( const mpi_prime_search *ps, size_t i )
+{
+    int ret;
+    mbedtls_mpi C;
+
+    mbedtls_mpi_init( &C );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &C, (mbedtls_mpi_sint) ( i * ps->step ) ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_abs( &C, &C, ps->X ) );
+    MBEDTLS_MPI_CHK( mpi_miller_rabin_base2( &C ) );
+
+    if( ps->dh_flag != 0 )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &C, 1 ) );
+        MBEDTLS_MPI_CHK( mpi_miller_rabin_base2( &C ) );
+    }
+
+cleanup:
+    mbedtls_mpi_free( &C );
+
+    return( ret );
+}
+
+/*
+ * Screen survivors in increasing order until one passes. Several workers
+ * may run this concurrently: each takes the next survivor, and stops once
+ * it is past a candidate that is known to pass. Every candidate before
+ * ps->found has therefore been screened when all workers are done, so
+ * ps->found is the same as with a single worker.
+ */
+static void mpi_prime_search_worker( mpi_prime_search *ps )
+{
+    int ret;
+    size_t i;
+
+    while( 1 )
+    {
+        if( MPI_SEARCH_LOCK( ps ) != 0 )
+            return;
+
+        while( ps->next < MPI_SIEVE_SIZE && ps->sieve[ps->next] != 0 )
+            ps->next++;
+
+        i = ps->next++;
+
+        if( i >= ps->found || ps->ret != 0 )
+        {
+            (void) MPI_SEARCH_UNLOCK( ps );
+            return;
+        }
+
+        if( MPI_SEARCH_UNLOCK( ps ) != 0 )
+            return;
+
+        ret = mpi_prime_screen( ps, i );
+
+        if( MPI_SEARCH_LOCK( ps ) != 0 )
+            return;
+
+        if( ret == 0 && i < ps->found )
+            ps->found = i;
+        else if( ret != 0 && ret != MBEDTLS_ERR_MPI_NOT_ACCEPTABLE &&
+                 ps->ret == 0 )
+            ps->ret = ret;
+
+        if( MPI_SEARCH_UNLOCK( ps ) != 0 )
+            return;
+    }
+}
+
+#if defined(MPI_GEN_PRIME_PARALLEL)
+static void *mpi_prime_search_thread( void *arg )
+{
+    mpi_prime_search_worker( (mpi_prime_search *) arg );
+    return( NULL );
+}
+#endif
+
+static int mpi_prime_search_run( mpi_prime_search *ps )
+{
+#if defined(MPI_GEN_PRIME_PARALLEL)
+    pthread_t threads[MBEDTLS_MPI_GEN_PRIME_THREADS - 1];
+    size_t i, started = 0;
+
+    /* If a thread can't be created, the others just do more of the work */
+    for( i = 0; i < MBEDTLS_MPI_GEN_PRIME_THREADS - 1; i++ )
+        if( pthread_create( &threads[started], NULL,
+                            mpi_prime_search_thread, ps ) == 0 )
+            started++;
+
+    mpi_prime_search_worker( ps );
+
+    for( i = 0; i < started; i++ )
+        (void) pthread_join( threads[i], NULL );
+#else
+    mpi_prime_search_worker( ps );
+#endif
+
+    return( ps->ret );
+}
+
+/*
+ * Random starting point of the search: nbits-bit odd X
+ * (with dh_flag, X = 3 mod 4 and X = 2 mod 3)
+ */
+static int mpi_gen_prime_start( mbedtls_mpi *X, size_t nbits, int dh_flag,
+                                int (*f_rng)(void *, unsigned char *, size_t),
+                                void *p_rng )
+{
+    int ret;
+    size_t k, n;
+    mbedtls_mpi_uint r;
 
     n = BITS_TO_LIMBS( nbits );
 
@@ -2204,17 +3819,7 @@ int mbedtls_mpi_gen_prime( mbedtls_mpi *X, size_t nbits, int dh_flag,
 
     X->p[0] |= 1;
 
-    if( dh_flag == 0 )
-    {
-        while( ( ret = mbedtls_mpi_is_prime( X, f_rng, p_rng ) ) != 0 )
-        {
-            if( ret != MBEDTLS_ERR_MPI_NOT_ACCEPTABLE )
-                goto cleanup;
-
-            MBEDTLS_MPI_CHK( mbedtls_mpi_add_int( X, X, 2 ) );
-        }
-    }
-    else
+    if( dh_flag != 0 )
     {
         /*
          * An necessary condition for Y and X = 2Y + 1 to be prime
@@ -2229,7 +3834,36 @@ int mbedtls_mpi_gen_prime( mbedtls_mpi *X, size_t nbits, int dh_flag,
             MBEDTLS_MPI_CHK( mbedtls_mpi_add_int( X, X, 8 ) );
         else if( r == 1 )
             MBEDTLS_MPI_CHK( mbedtls_mpi_add_int( X, X, 4 ) );
+    }
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * Search candidates one at a time (small primes)
+ */
+static int mpi_gen_prime_incremental( mbedtls_mpi *X, int dh_flag,
+                                      int (*f_rng)(void *, unsigned char *, size_t),
+                                      void *p_rng )
+{
+    int ret;
+    mbedtls_mpi Y;
+
+    mbedtls_mpi_init( &Y );
+
+    if( dh_flag == 0 )
+    {
+        while( ( ret = mbedtls_mpi_is_prime( X, f_rng, p_rng ) ) != 0 )
+        {
+            if( ret != MBEDTLS_ERR_MPI_NOT_ACCEPTABLE )
+                goto cleanup;
 
+            MBEDTLS_MPI_CHK( mbedtls_mpi_add_int( X, X, 2 ) );
+        }
+    }
+    else
+    {
         /* Set Y = (X-1) / 2, which is X / 2 because X is odd */
         MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &Y, X ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &Y, 1 ) );
@@ -2262,12 +3896,199 @@ int mbedtls_mpi_gen_prime( mbedtls_mpi *X, size_t nbits, int dh_flag,
     }
 
 cleanup:
-
     mbedtls_mpi_free( &Y );
 
     return( ret );
 }
 
+/*
+ * Inverse of a modulo the odd prime p, for 0 < a < p
+ */
+static unsigned int mpi_small_inv( unsigned int a, unsigned int p )
+{
+    unsigned int r0 = p, r1 = a, q, t;
+    unsigned int u0 = 0, u1 = 1;    /* u_i * a = +-r_i mod p, signs alternate */
+    int neg = 0;
+
+    while( r1 != 0 )
+    {
+        q = r0 / r1;
+        t = r0 - q * r1; r0 = r1; r1 = t;
+        t = u0 + q * u1; u0 = u1; u1 = t;
+        neg = !neg;
+    }
+
+    /* r0 == 1 here and u0 * a = (-1)^(neg + 1) mod p */
+    return( neg ? u0 : p - u0 );
+}
+
+/*
+ * Search candidates with a sieve (large primes)
+ */
+static int mpi_gen_prime_sieve( mbedtls_mpi *X, size_t nbits, int dh_flag,
+                                int (*f_rng)(void *, unsigned char *, size_t),
+                                void *p_rng )
+{
+    int ret;
+    size_t i, j, n_primes;
+    unsigned int p, inv, off;
+    mbedtls_mpi_uint r;
+    mbedtls_mpi C, Y;
+    mpi_prime_search ps;
+    unsigned char *sieve = NULL;
+    uint16_t *primes, *res;
+
+    mbedtls_mpi_init( &C ); mbedtls_mpi_init( &Y );
+    memset( &ps, 0, sizeof( ps ) );
+
+    /*
+     * One block for the sieve and for the sieving primes with the residues
+     * of X; there are fewer than MPI_SIEVE_PRIME_LIMIT / 4 of them.
+     */
+    sieve = mbedtls_calloc( 1, MPI_SIEVE_SIZE +
+                               2 * ( MPI_SIEVE_PRIME_LIMIT / 4 ) * sizeof( uint16_t ) );
+    if( sieve == NULL )
+        return( MBEDTLS_ERR_MPI_ALLOC_FAILED );
+
+    primes = (uint16_t *) ( sieve + MPI_SIEVE_SIZE );
+    res = primes + MPI_SIEVE_PRIME_LIMIT / 4;
+
+    /* Sieve of Eratosthenes on the odd numbers below MPI_SIEVE_PRIME_LIMIT */
+    for( n_primes = 0, i = 1; i < MPI_SIEVE_PRIME_LIMIT / 2; i++ )
+    {
+        if( sieve[i] != 0 )
+            continue;
+
+        p = (unsigned int)( 2 * i + 1 );
+        for( j = ( p * p ) / 2; j < MPI_SIEVE_PRIME_LIMIT / 2; j += p )
+            sieve[j] = 1;
+
+        /* 3 divides the step with dh_flag and never divides X nor Y */
+        if( dh_flag == 0 || p != 3 )
+            primes[n_primes++] = (uint16_t) p;
+    }
+
+    ps.X = X;
+    ps.step = ( dh_flag == 0 ) ? 2 : 12;
+    ps.dh_flag = dh_flag;
+    ps.sieve = sieve;
+#if defined(MPI_GEN_PRIME_PARALLEL)
+    mbedtls_mutex_init( &ps.mutex );
+#endif
+
+    MBEDTLS_MPI_CHK( mpi_gen_prime_start( X, nbits, dh_flag, f_rng, p_rng ) );
+    for( i = 0; i < n_primes; i++ )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_int( &r, X, primes[i] ) );
+        res[i] = (uint16_t) r;
+    }
+
+    while( 1 )
+    {
+        /* Start over if the window would go past nbits bits */
+        MBEDTLS_MPI_CHK( mbedtls_mpi_add_int( &C, X, MPI_SIEVE_SIZE * ps.step ) );
+        if( mbedtls_mpi_bitlen( &C ) > nbits )
+        {
+            MBEDTLS_MPI_CHK( mpi_gen_prime_start( X, nbits, dh_flag, f_rng, p_rng ) );
+            for( i = 0; i < n_primes; i++ )
+            {
+                MBEDTLS_MPI_CHK( mbedtls_mpi_mod_int( &r, X, primes[i] ) );
+                res[i] = (uint16_t) r;
+            }
+            continue;
+        }
+
+        /*
+         * Candidate X + i * step has the factor p if i = -X / step mod p,
+         * and (candidate - 1) / 2 has it if i = (1 - X) / step mod p.
+         */
+        memset( sieve, 0, MPI_SIEVE_SIZE );
+        for( i = 0; i < n_primes; i++ )
+        {
+            p = primes[i];
+            inv = mpi_small_inv( (unsigned int)( ps.step % p ), p );
+
+            off = ( ( p - res[i] ) * inv ) % p;
+            for( j = off; j < MPI_SIEVE_SIZE; j += p )
+                sieve[j] = 1;
+
+            if( dh_flag != 0 )
+            {
+                off = ( ( ( p + 1 - res[i] ) % p ) * inv ) % p;
+                for( j = off; j < MPI_SIEVE_SIZE; j += p )
+                    sieve[j] = 1;
+            }
+        }
+
+        ps.next = 0;
+
+        while( 1 )
+        {
+            ps.found = MPI_SIEVE_SIZE;
+            MBEDTLS_MPI_CHK( mpi_prime_search_run( &ps ) );
+
+            if( ps.found == MPI_SIEVE_SIZE )
+                break;
+
+            MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &C, (mbedtls_mpi_sint) ( ps.found * ps.step ) ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_add_abs( &C, &C, X ) );
+
+            ret = mpi_miller_rabin( &C, f_rng, p_rng );
+            if( ret == 0 && dh_flag != 0 )
+            {
+                MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &Y, &C ) );
+                MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &Y, 1 ) );
+                ret = mpi_miller_rabin( &Y, f_rng, p_rng );
+            }
+
+            if( ret == 0 )
+            {
+                MBEDTLS_MPI_CHK( mbedtls_mpi_copy( X, &C ) );
+                goto cleanup;
+            }
+
+            if( ret != MBEDTLS_ERR_MPI_NOT_ACCEPTABLE )
+                goto cleanup;
+
+            ps.next = ps.found + 1;
+        }
+
+        /* Next window: update the residues rather than recomputing them */
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( X, &C ) );
+        for( i = 0; i < n_primes; i++ )
+            res[i] = (uint16_t)( ( res[i] + MPI_SIEVE_SIZE * ps.step ) % primes[i] );
+    }
+
+cleanup:
+
+#if defined(MPI_GEN_PRIME_PARALLEL)
+    mbedtls_mutex_free( &ps.mutex );
+#endif
+    mbedtls_free( sieve );
+    mbedtls_mpi_free( &C ); mbedtls_mpi_free( &Y );
+
+    return( ret );
+}
+
+int mbedtls_mpi_gen_prime( mbedtls_mpi *X, size_t nbits, int dh_flag,
+                   int (*f_rng)(void *, unsigned char *, size_t),
+                   void *p_rng )
+{
+    int ret;
+
+    if( nbits < 3 || nbits > MBEDTLS_MPI_MAX_BITS )
+        return( MBEDTLS_ERR_MPI_BAD_INPUT_DATA );
+
+    if( nbits >= MPI_SIEVE_MIN_BITS )
+        return( mpi_gen_prime_sieve( X, nbits, dh_flag, f_rng, p_rng ) );
+
+    MBEDTLS_MPI_CHK( mpi_gen_prime_start( X, nbits, dh_flag, f_rng, p_rng ) );
+    MBEDTLS_MPI_CHK( mpi_gen_prime_incremental( X, dh_flag, f_rng, p_rng ) );
+
+cleanup:
+    return( ret );
+}
+
 #endif /* MBEDTLS_GENPRIME */
 
 #if defined(MBEDTLS_SELF_TEST)
@@ -40,6 +40,12 @@
 #include <stdio.h>
 #endif
 
+#if defined(MBEDTLS_DRBG_FORK_SAFETY)
+#include <sys/types.h>
+#include <unistd.h>
+#include <time.h>
+#endif
+
 #if defined(MBEDTLS_SELF_TEST)
 #if defined(MBEDTLS_PLATFORM_C)
 #include "mbedtls/platform.h"
@@ -284,6 +290,42 @@ void mbedtls_ctr_drbg_update( mbedtls_ctr_drbg_context *ctx,
     }
 }
 
+#if defined(MBEDTLS_DRBG_FORK_SAFETY)
+/*
+ * Fork detection: if this context was last used by another process, we are
+ * running in a child that inherited a copy of the parent's state. Make the
+ * state diverge by mixing in data that is unique to this child (pid, parent
+ * pid and timestamps, the latter guarding against pid reuse), which is much
+ * cheaper than a full reseed from the entropy source.
+ */
+static void ctr_drbg_fork_check( mbedtls_ctr_drbg_context *ctx )
+{
+    struct
+    {
+        long pid, ppid;
+        struct timespec mono, real;
+    } pers;
+
+    if( (long) getpid() == ctx->pid )
+        return;
+
+    memset( &pers, 0, sizeof( pers ) );
+    pers.pid = (long) getpid();
+    pers.ppid = (long) getppid();
+    (void) clock_gettime( CLOCK_MONOTONIC, &pers.mono );
+    (void) clock_gettime( CLOCK_REALTIME, &pers.real );
+
+    mbedtls_ctr_drbg_update( ctx, (const unsigned char *) &pers, sizeof( pers ) );
+
+    /* pid and time are guessable: get real entropy on the next request */
+    if( ctx->reseed_counter < ctx->reseed_interval )
+        ctx->reseed_counter = ctx->reseed_interval;
+    ctx->pid = pers.pid;
+
+    mbedtls_zeroize( &pers, sizeof( pers ) );
+}
+#endif /* MBEDTLS_DRBG_FORK_SAFETY */
+
 int mbedtls_ctr_drbg_reseed( mbedtls_ctr_drbg_context *ctx,
                      const unsigned char *additional, size_t len )
 {
@@ -327,6 +369,10 @@ int mbedtls_ctr_drbg_reseed( mbedtls_ctr_drbg_context *ctx,
     ctr_drbg_update_internal( ctx, seed );
     ctx->reseed_counter = 1;
 
+#if defined(MBEDTLS_DRBG_FORK_SAFETY)
+    ctx->pid = (long) getpid();
+#endif
+
     return( 0 );
 }
 
@@ -350,6 +396,10 @@ int mbedtls_ctr_drbg_random_with_add( void *p_rng,
 
     memset( add_input, 0, MBEDTLS_CTR_DRBG_SEEDLEN );
 
+#if defined(MBEDTLS_DRBG_FORK_SAFETY)
+    ctr_drbg_fork_check( ctx );
+#endif
+
     if( ctx->reseed_counter > ctx->reseed_interval ||
         ctx->prediction_resistance )
     {
@@ -222,6 +222,16 @@ void mbedtls_debug_print_mpi( const mbedtls_ssl_context *ssl, int level,
     if( ssl->conf == NULL || ssl->conf->f_dbg == NULL || X == NULL || level > debug_threshold )
         return;
 
+    /* Unallocated MPIs (such as Y for Montgomery curves) hold zero */
+    if( X->n == 0 )
+    {
+        mbedtls_snprintf( str, sizeof( str ), "value of '%s' (0 bits) is:\n",
+                          text );
+        debug_send_line( ssl, level, file, line, str );
+        debug_send_line( ssl, level, file, line, " 00\n" );
+        return;
+    }
+
     for( n = X->n - 1; n > 0; n-- )
         if( X->p[n] != 0 )
             break;
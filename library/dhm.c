@@ -118,6 +118,18 @@ cleanup:
     return( ret );
 }
 
+/*
+ * Set up the cached reduction constants for P, on first use or if P has
+ * changed since
+ */
+static int dhm_mod_check( mbedtls_dhm_context *ctx )
+{
+    if( mbedtls_mpi_cmp_mpi( &ctx->P_mod.N, &ctx->P ) == 0 )
+        return( 0 );
+
+    return( mbedtls_mpi_mod_setup( &ctx->P_mod, &ctx->P ) );
+}
+
 void mbedtls_dhm_init( mbedtls_dhm_context *ctx )
 {
     memset( ctx, 0, sizeof( mbedtls_dhm_context ) );
@@ -178,8 +190,9 @@ int mbedtls_dhm_make_params( mbedtls_dhm_context *ctx, int x_size,
     /*
      * Calculate GX = G^X mod P
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &ctx->GX, &ctx->G, &ctx->X,
-                          &ctx->P , &ctx->RP ) );
+    MBEDTLS_MPI_CHK( dhm_mod_check( ctx ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_exp( &ctx->GX, &ctx->G, &ctx->X,
+                                          &ctx->P_mod ) );
 
     if( ( ret = dhm_check_range( &ctx->GX, &ctx->P ) ) != 0 )
         return( ret );
@@ -261,8 +274,9 @@ int mbedtls_dhm_make_public( mbedtls_dhm_context *ctx, int x_size,
     }
     while( dhm_check_range( &ctx->X, &ctx->P ) != 0 );
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &ctx->GX, &ctx->G, &ctx->X,
-                          &ctx->P , &ctx->RP ) );
+    MBEDTLS_MPI_CHK( dhm_mod_check( ctx ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_exp( &ctx->GX, &ctx->G, &ctx->X,
+                                          &ctx->P_mod ) );
 
     if( ( ret = dhm_check_range( &ctx->GX, &ctx->P ) ) != 0 )
         return( ret );
@@ -308,10 +322,10 @@ static int dhm_update_blinding( mbedtls_dhm_context *ctx,
     if( mbedtls_mpi_cmp_int( &ctx->Vi, 1 ) != 0 )
     {
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ctx->Vi, &ctx->Vi, &ctx->Vi ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &ctx->Vi, &ctx->Vi, &ctx->P ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_reduce( &ctx->Vi, &ctx->Vi, &ctx->P_mod ) );
 
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ctx->Vf, &ctx->Vf, &ctx->Vf ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &ctx->Vf, &ctx->Vf, &ctx->P ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_reduce( &ctx->Vf, &ctx->Vf, &ctx->P_mod ) );
 
         return( 0 );
     }
@@ -335,8 +349,8 @@ static int dhm_update_blinding( mbedtls_dhm_context *ctx,
     while( mbedtls_mpi_cmp_int( &ctx->Vi, 1 ) <= 0 );
 
     /* Vf = Vi^-X mod P */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( &ctx->Vf, &ctx->Vi, &ctx->P ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &ctx->Vf, &ctx->Vf, &ctx->X, &ctx->P, &ctx->RP ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_inv( &ctx->Vf, &ctx->Vi, &ctx->P_mod ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_exp( &ctx->Vf, &ctx->Vf, &ctx->X, &ctx->P_mod ) );
 
 cleanup:
     return( ret );
@@ -361,25 +375,27 @@ int mbedtls_dhm_calc_secret( mbedtls_dhm_context *ctx,
 
     mbedtls_mpi_init( &GYb );
 
+    MBEDTLS_MPI_CHK( dhm_mod_check( ctx ) );
+
     /* Blind peer's value */
     if( f_rng != NULL )
     {
         MBEDTLS_MPI_CHK( dhm_update_blinding( ctx, f_rng, p_rng ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &GYb, &ctx->GY, &ctx->Vi ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &GYb, &GYb, &ctx->P ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_reduce( &GYb, &GYb, &ctx->P_mod ) );
     }
     else
         MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &GYb, &ctx->GY ) );
 
     /* Do modular exponentiation */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &ctx->K, &GYb, &ctx->X,
-                          &ctx->P, &ctx->RP ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_exp( &ctx->K, &GYb, &ctx->X,
+                                          &ctx->P_mod ) );
 
     /* Unblind secret value */
     if( f_rng != NULL )
     {
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ctx->K, &ctx->K, &ctx->Vf ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &ctx->K, &ctx->K, &ctx->P ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_reduce( &ctx->K, &ctx->K, &ctx->P_mod ) );
     }
 
     *olen = mbedtls_mpi_size( &ctx->K );
@@ -401,7 +417,7 @@ cleanup:
 void mbedtls_dhm_free( mbedtls_dhm_context *ctx )
 {
     mbedtls_mpi_free( &ctx->pX); mbedtls_mpi_free( &ctx->Vf ); mbedtls_mpi_free( &ctx->Vi );
-    mbedtls_mpi_free( &ctx->RP ); mbedtls_mpi_free( &ctx->K ); mbedtls_mpi_free( &ctx->GY );
+    mbedtls_mpi_mod_free( &ctx->P_mod ); mbedtls_mpi_free( &ctx->K ); mbedtls_mpi_free( &ctx->GY );
     mbedtls_mpi_free( &ctx->GX ); mbedtls_mpi_free( &ctx->X ); mbedtls_mpi_free( &ctx->G );
     mbedtls_mpi_free( &ctx->P );
 
@@ -42,6 +42,181 @@
 #include "mbedtls/hmac_drbg.h"
 #endif
 
+#if defined(MBEDTLS_PLATFORM_C)
+#include "mbedtls/platform.h"
+#else
+#include <stdlib.h>
+#define mbedtls_calloc    calloc
+#define mbedtls_free       free
+#endif
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+
+/*
+ * Sub-context for ecdsa_verify()
+ */
+struct mbedtls_ecdsa_restart_ver
+{
+    mbedtls_mpi u1, u2;     /* intermediate values  */
+    enum {                  /* what to do next?     */
+        ecdsa_ver_init = 0, /* getting started      */
+        ecdsa_ver_muladd,   /* muladd step          */
+    } state;
+};
+
+/*
+ * Init verify restart sub-context
+ */
+static void ecdsa_restart_ver_init( mbedtls_ecdsa_restart_ver_ctx *ctx )
+{
+    mbedtls_mpi_init( &ctx->u1 );
+    mbedtls_mpi_init( &ctx->u2 );
+    ctx->state = ecdsa_ver_init;
+}
+
+/*
+ * Free the components of a verify restart sub-context
+ */
+static void ecdsa_restart_ver_free( mbedtls_ecdsa_restart_ver_ctx *ctx )
+{
+    if( ctx == NULL )
+        return;
+
+    mbedtls_mpi_free( &ctx->u1 );
+    mbedtls_mpi_free( &ctx->u2 );
+
+    ecdsa_restart_ver_init( ctx );
+}
+
+/*
+ * Sub-context for ecdsa_sign()
+ */
+struct mbedtls_ecdsa_restart_sig
+{
+    int sign_tries;
+    int key_tries;
+    mbedtls_mpi k;          /* per-signature random */
+    mbedtls_mpi r;          /* r value              */
+    enum {                  /* what to do next?     */
+        ecdsa_sig_init = 0, /* getting started      */
+        ecdsa_sig_mul,      /* doing ecp_mul()      */
+        ecdsa_sig_modn,     /* mod N computations   */
+    } state;
+};
+
+/*
+ * Init sign restart sub-context
+ */
+static void ecdsa_restart_sig_init( mbedtls_ecdsa_restart_sig_ctx *ctx )
+{
+    ctx->sign_tries = 0;
+    ctx->key_tries = 0;
+    mbedtls_mpi_init( &ctx->k );
+    mbedtls_mpi_init( &ctx->r );
+    ctx->state = ecdsa_sig_init;
+}
+
+/*
+ * Free the components of a sign restart sub-context
+ */
+static void ecdsa_restart_sig_free( mbedtls_ecdsa_restart_sig_ctx *ctx )
+{
+    if( ctx == NULL )
+        return;
+
+    mbedtls_mpi_free( &ctx->k );
+    mbedtls_mpi_free( &ctx->r );
+}
+
+#if defined(MBEDTLS_ECDSA_DETERMINISTIC)
+/*
+ * Sub-context for ecdsa_sign_det()
+ */
+struct mbedtls_ecdsa_restart_det
+{
+    mbedtls_hmac_drbg_context rng_ctx;  /* DRBG state   */
+    enum {                      /* what to do next?     */
+        ecdsa_det_init = 0,     /* getting started      */
+        ecdsa_det_sign,         /* make signature       */
+    } state;
+};
+
+/*
+ * Init det restart sub-context
+ */
+static void ecdsa_restart_det_init( mbedtls_ecdsa_restart_det_ctx *ctx )
+{
+    mbedtls_hmac_drbg_init( &ctx->rng_ctx );
+    ctx->state = ecdsa_det_init;
+}
+
+/*
+ * Free the components of a det restart sub-context
+ */
+static void ecdsa_restart_det_free( mbedtls_ecdsa_restart_det_ctx *ctx )
+{
+    if( ctx == NULL )
+        return;
+
+    mbedtls_hmac_drbg_free( &ctx->rng_ctx );
+
+    ecdsa_restart_det_init( ctx );
+}
+#endif /* MBEDTLS_ECDSA_DETERMINISTIC */
+
+#define ECDSA_RS_ECP    ( rs_ctx == NULL ? NULL : &rs_ctx->ecp )
+
+/* Utility macro for checking and updating ops budget */
+#define ECDSA_BUDGET( ops )   \
+    MBEDTLS_MPI_CHK( mbedtls_ecp_check_budget( grp, ECDSA_RS_ECP, ops ) );
+
+/* Call this when entering a function that needs its own sub-context */
+#define ECDSA_RS_ENTER( SUB )   do {                                 \
+    /* reset ops count for this call if top-level */                 \
+    if( rs_ctx != NULL && rs_ctx->ecp.depth++ == 0 )                 \
+        rs_ctx->ecp.ops_done = 0;                                    \
+                                                                     \
+    /* set up our own sub-context if needed */                       \
+    if( mbedtls_ecp_restart_is_enabled() &&                          \
+        rs_ctx != NULL && rs_ctx->SUB == NULL )                      \
+    {                                                                \
+        rs_ctx->SUB = mbedtls_calloc( 1, sizeof( *rs_ctx->SUB ) );   \
+        if( rs_ctx->SUB == NULL )                                    \
+        {                                                            \
+            ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;                      \
+            goto cleanup;                                            \
+        }                                                            \
+                                                                     \
+        ecdsa_restart_## SUB ##_init( rs_ctx->SUB );                 \
+    }                                                                \
+} while( 0 )
+
+/* Call this when leaving a function that needs its own sub-context */
+#define ECDSA_RS_LEAVE( SUB )   do {                                 \
+    /* free our sub-context when done */                             \
+    if( rs_ctx != NULL && rs_ctx->SUB != NULL &&                     \
+        ret != MBEDTLS_ERR_ECP_IN_PROGRESS )                         \
+    {                                                                \
+        ecdsa_restart_## SUB ##_free( rs_ctx->SUB );                 \
+        mbedtls_free( rs_ctx->SUB );                                 \
+        rs_ctx->SUB = NULL;                                          \
+    }                                                                \
+                                                                     \
+    if( rs_ctx != NULL )                                             \
+        rs_ctx->ecp.depth--;                                         \
+} while( 0 )
+
+#else /* MBEDTLS_ECP_RESTARTABLE */
+
+#define ECDSA_RS_ECP    NULL
+
+#define ECDSA_BUDGET( ops )   /* no-op */
+
+#define ECDSA_RS_ENTER( SUB )   (void) rs_ctx
+#define ECDSA_RS_LEAVE( SUB )   (void) rs_ctx
+
+#endif /* MBEDTLS_ECP_RESTARTABLE */
+
 /*
  * Derive a suitable integer for group grp from a buffer of length len
  * SEC1 4.1.3 step 5 aka SEC1 4.1.4 step 3
@@ -70,13 +245,17 @@ cleanup:
  * Compute ECDSA signature of a hashed message (SEC1 4.1.3)
  * Obviously, compared to SEC1 4.1.3, we skip step 4 (hash message)
  */
-int mbedtls_ecdsa_sign( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
+static int ecdsa_sign_restartable( mbedtls_ecp_group *grp,
+                mbedtls_mpi *r, mbedtls_mpi *s,
                 const mbedtls_mpi *d, const unsigned char *buf, size_t blen,
-                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+                mbedtls_ecdsa_restart_ctx *rs_ctx )
 {
     int ret, key_tries, sign_tries, blind_tries;
+    int *p_sign_tries = &sign_tries, *p_key_tries = &key_tries;
     mbedtls_ecp_point R;
     mbedtls_mpi k, e, t;
+    mbedtls_mpi *pk = &k, *pr = r;
 
     /* Fail cleanly on curves such as Curve25519 that can't be used for ECDSA */
     if( grp->N.p == NULL )
@@ -89,26 +268,66 @@ int mbedtls_ecdsa_sign( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
     mbedtls_ecp_point_init( &R );
     mbedtls_mpi_init( &k ); mbedtls_mpi_init( &e ); mbedtls_mpi_init( &t );
 
-    sign_tries = 0;
+    ECDSA_RS_ENTER( sig );
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->sig != NULL )
+    {
+        /* redirect to our context */
+        p_sign_tries = &rs_ctx->sig->sign_tries;
+        p_key_tries = &rs_ctx->sig->key_tries;
+        pk = &rs_ctx->sig->k;
+        pr = &rs_ctx->sig->r;
+
+        /* jump to current step */
+        if( rs_ctx->sig->state == ecdsa_sig_mul )
+            goto mul;
+        if( rs_ctx->sig->state == ecdsa_sig_modn )
+            goto modn;
+    }
+#endif /* MBEDTLS_ECP_RESTARTABLE */
+
+    *p_sign_tries = 0;
     do
     {
         /*
          * Steps 1-3: generate a suitable ephemeral keypair
          * and set r = xR mod n
          */
-        key_tries = 0;
+        *p_key_tries = 0;
         do
         {
-            MBEDTLS_MPI_CHK( mbedtls_ecp_gen_keypair( grp, &k, &R, f_rng, p_rng ) );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( r, &R.X, &grp->N ) );
+            MBEDTLS_MPI_CHK( mbedtls_ecp_gen_privkey( grp, pk, f_rng, p_rng ) );
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+            if( rs_ctx != NULL && rs_ctx->sig != NULL )
+                rs_ctx->sig->state = ecdsa_sig_mul;
 
-            if( key_tries++ > 10 )
+mul:
+#endif
+            MBEDTLS_MPI_CHK( mbedtls_ecp_mul_restartable( grp, &R, pk, &grp->G,
+                                                  f_rng, p_rng, ECDSA_RS_ECP ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( pr, &R.X, &grp->N ) );
+
+            if( (*p_key_tries)++ > 10 )
             {
                 ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
                 goto cleanup;
             }
         }
-        while( mbedtls_mpi_cmp_int( r, 0 ) == 0 );
+        while( mbedtls_mpi_cmp_int( pr, 0 ) == 0 );
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+        if( rs_ctx != NULL && rs_ctx->sig != NULL )
+            rs_ctx->sig->state = ecdsa_sig_modn;
+
+modn:
+#endif
+        /*
+         * Accounting for everything up to the end of the loop
+         * (step 6, but checking now avoids saving e and t)
+         */
+        ECDSA_BUDGET( MBEDTLS_ECP_OPS_INV + 4 );
 
         /*
          * Step 5: derive MPI from hashed message
@@ -128,7 +347,10 @@ int mbedtls_ecdsa_sign( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
 
             /* See mbedtls_ecp_gen_keypair() */
             if( ++blind_tries > 30 )
-                return( MBEDTLS_ERR_ECP_RANDOM_FAILED );
+            {
+                ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+                goto cleanup;
+            }
         }
         while( mbedtls_mpi_cmp_int( &t, 1 ) < 0 ||
                mbedtls_mpi_cmp_mpi( &t, &grp->N ) >= 0 );
@@ -136,15 +358,15 @@ int mbedtls_ecdsa_sign( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
         /*
          * Step 6: compute s = (e + r * d) / k = t (e + rd) / (kt) mod n
          */
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( s, r, d ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( s, pr, d ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &e, &e, s ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &e, &e, &t ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &k, &k, &t ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( s, &k, &grp->N ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( pk, pk, &t ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( s, pk, &grp->N ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( s, s, &e ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( s, s, &grp->N ) );
 
-        if( sign_tries++ > 10 )
+        if( (*p_sign_tries)++ > 10 )
         {
             ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
             goto cleanup;
@@ -152,24 +374,95 @@ int mbedtls_ecdsa_sign( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
     }
     while( mbedtls_mpi_cmp_int( s, 0 ) == 0 );
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->sig != NULL )
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( r, pr ) );
+#endif
+
 cleanup:
     mbedtls_ecp_point_free( &R );
     mbedtls_mpi_free( &k ); mbedtls_mpi_free( &e ); mbedtls_mpi_free( &t );
 
+    ECDSA_RS_LEAVE( sig );
+
     return( ret );
 }
+
+/*
+ * Compute ECDSA signature of a hashed message
+ */
+int mbedtls_ecdsa_sign( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
+                const mbedtls_mpi *d, const unsigned char *buf, size_t blen,
+                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+{
+    return( ecdsa_sign_restartable( grp, r, s, d, buf, blen,
+                                    f_rng, p_rng, NULL ) );
+}
 #endif /* MBEDTLS_ECDSA_SIGN_ALT */
 
+/*
+ * Complete an ECDSA signature given k^-1 and r (SEC1 4.1.3 steps 5-6)
+ */
+int mbedtls_ecdsa_sign_with_nonce( mbedtls_ecp_group *grp, mbedtls_mpi *s,
+                    const mbedtls_mpi *d, const unsigned char *buf, size_t blen,
+                    const mbedtls_mpi *k_inv, const mbedtls_mpi *r )
+{
+    int ret;
+    mbedtls_mpi e;
+
+    /* Fail cleanly on curves such as Curve25519 that can't be used for ECDSA */
+    if( grp->N.p == NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    /* Make sure d is in range 1..n-1 */
+    if( mbedtls_mpi_cmp_int( d, 1 ) < 0 || mbedtls_mpi_cmp_mpi( d, &grp->N ) >= 0 )
+        return( MBEDTLS_ERR_ECP_INVALID_KEY );
+
+    if( mbedtls_mpi_cmp_int( k_inv, 1 ) < 0 ||
+        mbedtls_mpi_cmp_mpi( k_inv, &grp->N ) >= 0 ||
+        mbedtls_mpi_cmp_int( r, 1 ) < 0 ||
+        mbedtls_mpi_cmp_mpi( r, &grp->N ) >= 0 )
+    {
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+    }
+
+    mbedtls_mpi_init( &e );
+
+    /*
+     * Step 5: derive MPI from hashed message
+     */
+    MBEDTLS_MPI_CHK( derive_mpi( grp, &e, buf, blen ) );
+
+    /*
+     * Step 6: compute s = (e + r * d) / k mod n
+     */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( s, r, d ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &e, &e, s ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( s, &e, k_inv ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( s, s, &grp->N ) );
+
+    if( mbedtls_mpi_cmp_int( s, 0 ) == 0 )
+        ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+
+cleanup:
+    mbedtls_mpi_free( &e );
+
+    return( ret );
+}
+
 #if defined(MBEDTLS_ECDSA_DETERMINISTIC)
 /*
  * Deterministic signature wrapper
  */
-int mbedtls_ecdsa_sign_det( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
+static int ecdsa_sign_det_restartable( mbedtls_ecp_group *grp,
+                    mbedtls_mpi *r, mbedtls_mpi *s,
                     const mbedtls_mpi *d, const unsigned char *buf, size_t blen,
-                    mbedtls_md_type_t md_alg )
+                    mbedtls_md_type_t md_alg,
+                    mbedtls_ecdsa_restart_ctx *rs_ctx )
 {
     int ret;
     mbedtls_hmac_drbg_context rng_ctx;
+    mbedtls_hmac_drbg_context *p_rng = &rng_ctx;
     unsigned char data[2 * MBEDTLS_ECP_MAX_BYTES];
     size_t grp_len = ( grp->nbits + 7 ) / 8;
     const mbedtls_md_info_t *md_info;
@@ -181,21 +474,58 @@ int mbedtls_ecdsa_sign_det( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi
     mbedtls_mpi_init( &h );
     mbedtls_hmac_drbg_init( &rng_ctx );
 
+    ECDSA_RS_ENTER( det );
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->det != NULL )
+    {
+        /* redirect to our context */
+        p_rng = &rs_ctx->det->rng_ctx;
+
+        /* jump to current step */
+        if( rs_ctx->det->state == ecdsa_det_sign )
+            goto sign;
+    }
+#endif /* MBEDTLS_ECP_RESTARTABLE */
+
     /* Use private key and message hash (reduced) to initialize HMAC_DRBG */
     MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( d, data, grp_len ) );
     MBEDTLS_MPI_CHK( derive_mpi( grp, &h, buf, blen ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( &h, data + grp_len, grp_len ) );
-    mbedtls_hmac_drbg_seed_buf( &rng_ctx, md_info, data, 2 * grp_len );
+    mbedtls_hmac_drbg_seed_buf( p_rng, md_info, data, 2 * grp_len );
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->det != NULL )
+        rs_ctx->det->state = ecdsa_det_sign;
+
+sign:
+#endif
+#if defined(MBEDTLS_ECDSA_SIGN_ALT)
     ret = mbedtls_ecdsa_sign( grp, r, s, d, buf, blen,
-                      mbedtls_hmac_drbg_random, &rng_ctx );
+                              mbedtls_hmac_drbg_random, p_rng );
+#else
+    ret = ecdsa_sign_restartable( grp, r, s, d, buf, blen,
+                      mbedtls_hmac_drbg_random, p_rng, rs_ctx );
+#endif /* MBEDTLS_ECDSA_SIGN_ALT */
 
 cleanup:
     mbedtls_hmac_drbg_free( &rng_ctx );
     mbedtls_mpi_free( &h );
 
+    ECDSA_RS_LEAVE( det );
+
     return( ret );
 }
+
+/*
+ * Deterministic signature wrapper
+ */
+int mbedtls_ecdsa_sign_det( mbedtls_ecp_group *grp, mbedtls_mpi *r, mbedtls_mpi *s,
+                    const mbedtls_mpi *d, const unsigned char *buf, size_t blen,
+                    mbedtls_md_type_t md_alg )
+{
+    return( ecdsa_sign_det_restartable( grp, r, s, d, buf, blen, md_alg, NULL ) );
+}
 #endif /* MBEDTLS_ECDSA_DETERMINISTIC */
 
 #if !defined(MBEDTLS_ECDSA_VERIFY_ALT)
@@ -203,13 +533,17 @@ cleanup:
  * Verify ECDSA signature of hashed message (SEC1 4.1.4)
  * Obviously, compared to SEC1 4.1.3, we skip step 2 (hash message)
  */
-int mbedtls_ecdsa_verify( mbedtls_ecp_group *grp,
-                  const unsigned char *buf, size_t blen,
-                  const mbedtls_ecp_point *Q, const mbedtls_mpi *r, const mbedtls_mpi *s)
+static int ecdsa_verify_restartable( mbedtls_ecp_group *grp,
+                                     const unsigned char *buf, size_t blen,
+                                     const mbedtls_ecp_point *Q,
+                                     const mbedtls_ecp_keypair *key,
+                                     const mbedtls_mpi *r, const mbedtls_mpi *s,
+                                     mbedtls_ecdsa_restart_ctx *rs_ctx )
 {
     int ret;
     mbedtls_mpi e, s_inv, u1, u2;
     mbedtls_ecp_point R;
+    mbedtls_mpi *pu1 = &u1, *pu2 = &u2;
 
     mbedtls_ecp_point_init( &R );
     mbedtls_mpi_init( &e ); mbedtls_mpi_init( &s_inv ); mbedtls_mpi_init( &u1 ); mbedtls_mpi_init( &u2 );
@@ -218,6 +552,21 @@ int mbedtls_ecdsa_verify( mbedtls_ecp_group *grp,
     if( grp->N.p == NULL )
         return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
 
+    ECDSA_RS_ENTER( ver );
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->ver != NULL )
+    {
+        /* redirect to our context */
+        pu1 = &rs_ctx->ver->u1;
+        pu2 = &rs_ctx->ver->u2;
+
+        /* jump to current step */
+        if( rs_ctx->ver->state == ecdsa_ver_muladd )
+            goto muladd;
+    }
+#endif /* MBEDTLS_ECP_RESTARTABLE */
+
     /*
      * Step 1: make sure r and s are in range 1..n-1
      */
@@ -231,6 +580,7 @@ int mbedtls_ecdsa_verify( mbedtls_ecp_group *grp,
     /*
      * Additional precaution: make sure Q is valid
      */
+    ECDSA_BUDGET( MBEDTLS_ECP_OPS_CHK + MBEDTLS_ECP_OPS_INV + 2 );
     MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, Q ) );
 
     /*
@@ -243,19 +593,41 @@ int mbedtls_ecdsa_verify( mbedtls_ecp_group *grp,
      */
     MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( &s_inv, s, &grp->N ) );
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &u1, &e, &s_inv ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &u1, &u1, &grp->N ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( pu1, &e, &s_inv ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( pu1, pu1, &grp->N ) );
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &u2, r, &s_inv ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &u2, &u2, &grp->N ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( pu2, r, &s_inv ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( pu2, pu2, &grp->N ) );
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->ver != NULL )
+        rs_ctx->ver->state = ecdsa_ver_muladd;
+
+muladd:
+#endif
     /*
      * Step 5: R = u1 G + u2 Q
      *
      * Since we're not using any secret data, no need to pass a RNG to
      * mbedtls_ecp_mul() for countermesures.
+     *
+     * The pre-computed table of a key pair is only used by operations
+     * that won't be interrupted.
      */
-    MBEDTLS_MPI_CHK( mbedtls_ecp_muladd( grp, &R, &u1, &grp->G, &u2, Q ) );
+    if( key != NULL && key->T != NULL
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+        && ( rs_ctx == NULL || ! mbedtls_ecp_restart_is_enabled() )
+#endif
+      )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_ecp_muladd_keypair( grp,
+                         &R, pu1, &grp->G, pu2, key ) );
+    }
+    else
+    {
+        MBEDTLS_MPI_CHK( mbedtls_ecp_muladd_restartable( grp,
+                         &R, pu1, &grp->G, pu2, Q, ECDSA_RS_ECP ) );
+    }
 
     if( mbedtls_ecp_is_zero( &R ) )
     {
@@ -282,6 +654,235 @@ cleanup:
     mbedtls_ecp_point_free( &R );
     mbedtls_mpi_free( &e ); mbedtls_mpi_free( &s_inv ); mbedtls_mpi_free( &u1 ); mbedtls_mpi_free( &u2 );
 
+    ECDSA_RS_LEAVE( ver );
+
+    return( ret );
+}
+
+/*
+ * Verify ECDSA signature of hashed message
+ */
+int mbedtls_ecdsa_verify( mbedtls_ecp_group *grp,
+                  const unsigned char *buf, size_t blen,
+                  const mbedtls_ecp_point *Q, const mbedtls_mpi *r, const mbedtls_mpi *s)
+{
+    return( ecdsa_verify_restartable( grp, buf, blen, Q, NULL, r, s, NULL ) );
+}
+#endif /* MBEDTLS_ECDSA_VERIFY_ALT */
+
+/*
+ * Verify several ECDSA signatures of hashed messages
+ */
+#if defined(MBEDTLS_ECDSA_VERIFY_ALT)
+int mbedtls_ecdsa_verify_batch( mbedtls_ecp_group *grp, size_t count,
+                  const unsigned char *buf[], const size_t blen[],
+                  const mbedtls_ecp_point *Q[],
+                  const mbedtls_mpi r[], const mbedtls_mpi s[],
+                  int results[] )
+{
+    int ret = 0, res;
+    size_t i;
+
+    for( i = 0; i < count; i++ )
+    {
+        res = mbedtls_ecdsa_verify( grp, buf[i], blen[i], Q[i], &r[i], &s[i] );
+        if( results != NULL )
+            results[i] = res;
+        if( res != 0 )
+            ret = MBEDTLS_ERR_ECP_VERIFY_FAILED;
+    }
+
+    return( ret );
+}
+#else
+int mbedtls_ecdsa_verify_batch( mbedtls_ecp_group *grp, size_t count,
+                  const unsigned char *buf[], const size_t blen[],
+                  const mbedtls_ecp_point *Q[],
+                  const mbedtls_mpi r[], const mbedtls_mpi s[],
+                  int results[] )
+{
+    int ret = 0, res, failed = 0;
+    size_t i, j, k;
+    size_t *idx = NULL;
+    mbedtls_mpi *c = NULL, *u1 = NULL, *u2 = NULL;
+    mbedtls_ecp_point *R = NULL;
+    const mbedtls_ecp_point **G = NULL, **QQ = NULL;
+    mbedtls_mpi inv;
+
+    /* Fail cleanly on curves such as Curve25519 that can't be used for ECDSA */
+    if( grp->N.p == NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    if( count == 0 )
+        return( 0 );
+
+    mbedtls_mpi_init( &inv );
+
+    idx = mbedtls_calloc( count, sizeof( size_t ) );
+    c   = mbedtls_calloc( count, sizeof( mbedtls_mpi ) );
+    u1  = mbedtls_calloc( count, sizeof( mbedtls_mpi ) );
+    u2  = mbedtls_calloc( count, sizeof( mbedtls_mpi ) );
+    R   = mbedtls_calloc( count, sizeof( mbedtls_ecp_point ) );
+    G   = mbedtls_calloc( count, sizeof( mbedtls_ecp_point * ) );
+    QQ  = mbedtls_calloc( count, sizeof( mbedtls_ecp_point * ) );
+
+    if( idx == NULL || c == NULL || u1 == NULL || u2 == NULL ||
+        R == NULL || G == NULL || QQ == NULL )
+    {
+        /* only free what was actually initialized below */
+        count = 0;
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    for( i = 0; i < count; i++ )
+    {
+        mbedtls_mpi_init( &c[i] );
+        mbedtls_mpi_init( &u1[i] );
+        mbedtls_mpi_init( &u2[i] );
+        mbedtls_ecp_point_init( &R[i] );
+    }
+
+    /*
+     * Steps 1 and 3, and the additional check on Q, for each signature.
+     * Those that pass go to slot k of the batch, with e in u1[k].
+     */
+    for( i = 0, k = 0; i < count; i++ )
+    {
+        if( mbedtls_mpi_cmp_int( &r[i], 1 ) < 0 ||
+            mbedtls_mpi_cmp_mpi( &r[i], &grp->N ) >= 0 ||
+            mbedtls_mpi_cmp_int( &s[i], 1 ) < 0 ||
+            mbedtls_mpi_cmp_mpi( &s[i], &grp->N ) >= 0 )
+        {
+            res = MBEDTLS_ERR_ECP_VERIFY_FAILED;
+        }
+        else
+            res = mbedtls_ecp_check_pubkey( grp, Q[i] );
+
+        if( res == 0 )
+        {
+            MBEDTLS_MPI_CHK( derive_mpi( grp, &u1[k], buf[i], blen[i] ) );
+            idx[k++] = i;
+        }
+        else
+            failed = 1;
+
+        if( results != NULL )
+            results[i] = res;
+    }
+
+    if( k == 0 )
+        goto cleanup;
+
+    /*
+     * Step 4: u1 = e / s mod n, u2 = r / s mod n
+     *
+     * All s are inverted together (Montgomery's trick): with
+     * c[j] = s_0 * ... * s_j, invert c[k-1] once, then walk back,
+     * getting 1 / s_j = c[j-1] / c[j] and 1 / c[j-1] = s_j / c[j].
+     */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &c[0], &s[idx[0]] ) );
+    for( j = 1; j < k; j++ )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &c[j], &c[j-1], &s[idx[j]] ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &c[j], &c[j], &grp->N ) );
+    }
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( &inv, &c[k-1], &grp->N ) );
+
+    for( j = k - 1; ; j-- )
+    {
+        if( j == 0 )
+        {
+            MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &c[0], &inv ) );
+            break;
+        }
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &c[j], &c[j-1], &inv ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &c[j], &c[j], &grp->N ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &inv, &inv, &s[idx[j]] ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &inv, &inv, &grp->N ) );
+    }
+
+    for( j = 0, i = 0; j < k; j++ )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &u1[j], &u1[j], &c[j] ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &u1[j], &u1[j], &grp->N ) );
+
+        /*
+         * e = 0 mod n gives u1 = 0, which only the single verification
+         * handles (and rejects). Drop those from the batch.
+         */
+        if( mbedtls_mpi_cmp_int( &u1[j], 0 ) == 0 )
+        {
+            res = mbedtls_ecdsa_verify( grp, buf[idx[j]], blen[idx[j]],
+                                        Q[idx[j]], &r[idx[j]], &s[idx[j]] );
+            if( results != NULL )
+                results[idx[j]] = res;
+            if( res != 0 )
+                failed = 1;
+            continue;
+        }
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &u2[i], &r[idx[j]], &c[j] ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &u2[i], &u2[i], &grp->N ) );
+
+        mbedtls_mpi_swap( &u1[i], &u1[j] );
+        idx[i] = idx[j];
+        G[i] = &grp->G;
+        QQ[i] = Q[idx[j]];
+        i++;
+    }
+    k = i;
+
+    /*
+     * Step 5: R = u1 G + u2 Q, with a single inversion for all points
+     */
+    MBEDTLS_MPI_CHK( mbedtls_ecp_muladd_batch( grp, R, u1, G, u2, QQ, k ) );
+
+    /*
+     * Steps 6 to 8: check if v = xR mod n is equal to r
+     */
+    for( j = 0; j < k; j++ )
+    {
+        res = 0;
+
+        if( mbedtls_ecp_is_zero( &R[j] ) )
+            res = MBEDTLS_ERR_ECP_VERIFY_FAILED;
+        else
+        {
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &R[j].X, &R[j].X, &grp->N ) );
+            if( mbedtls_mpi_cmp_mpi( &R[j].X, &r[idx[j]] ) != 0 )
+                res = MBEDTLS_ERR_ECP_VERIFY_FAILED;
+        }
+
+        if( res != 0 )
+            failed = 1;
+        if( results != NULL )
+            results[idx[j]] = res;
+    }
+
+cleanup:
+    if( ret == 0 && failed )
+        ret = MBEDTLS_ERR_ECP_VERIFY_FAILED;
+
+    for( i = 0; i < count; i++ )
+    {
+        mbedtls_mpi_free( &c[i] );
+        mbedtls_mpi_free( &u1[i] );
+        mbedtls_mpi_free( &u2[i] );
+        mbedtls_ecp_point_free( &R[i] );
+    }
+    mbedtls_mpi_free( &inv );
+
+    mbedtls_free( idx );
+    mbedtls_free( c );
+    mbedtls_free( u1 );
+    mbedtls_free( u2 );
+    mbedtls_free( R );
+    mbedtls_free( G );
+    mbedtls_free( QQ );
+
     return( ret );
 }
 #endif /* MBEDTLS_ECDSA_VERIFY_ALT */
@@ -313,11 +914,13 @@ static int ecdsa_signature_to_asn1( const mbedtls_mpi *r, const mbedtls_mpi *s,
 /*
  * Compute and write signature
  */
-int mbedtls_ecdsa_write_signature( mbedtls_ecdsa_context *ctx, mbedtls_md_type_t md_alg,
+int mbedtls_ecdsa_write_signature_restartable( mbedtls_ecdsa_context *ctx,
+                           mbedtls_md_type_t md_alg,
                            const unsigned char *hash, size_t hlen,
                            unsigned char *sig, size_t *slen,
                            int (*f_rng)(void *, unsigned char *, size_t),
-                           void *p_rng )
+                           void *p_rng,
+                           mbedtls_ecdsa_restart_ctx *rs_ctx )
 {
     int ret;
     mbedtls_mpi r, s;
@@ -329,14 +932,21 @@ int mbedtls_ecdsa_write_signature( mbedtls_ecdsa_context *ctx, mbedtls_md_type_t
     (void) f_rng;
     (void) p_rng;
 
-    MBEDTLS_MPI_CHK( mbedtls_ecdsa_sign_det( &ctx->grp, &r, &s, &ctx->d,
-                             hash, hlen, md_alg ) );
+    MBEDTLS_MPI_CHK( ecdsa_sign_det_restartable( &ctx->grp, &r, &s, &ctx->d,
+                             hash, hlen, md_alg, rs_ctx ) );
 #else
     (void) md_alg;
 
+#if defined(MBEDTLS_ECDSA_SIGN_ALT)
+    (void) rs_ctx;
+
     MBEDTLS_MPI_CHK( mbedtls_ecdsa_sign( &ctx->grp, &r, &s, &ctx->d,
                          hash, hlen, f_rng, p_rng ) );
-#endif
+#else
+    MBEDTLS_MPI_CHK( ecdsa_sign_restartable( &ctx->grp, &r, &s, &ctx->d,
+                         hash, hlen, f_rng, p_rng, rs_ctx ) );
+#endif /* MBEDTLS_ECDSA_SIGN_ALT */
+#endif /* MBEDTLS_ECDSA_DETERMINISTIC */
 
     MBEDTLS_MPI_CHK( ecdsa_signature_to_asn1( &r, &s, sig, slen ) );
 
@@ -347,6 +957,43 @@ cleanup:
     return( ret );
 }
 
+/*
+ * Compute and write signature with a prepared nonce
+ */
+int mbedtls_ecdsa_write_signature_with_nonce( mbedtls_ecdsa_context *ctx,
+                           const unsigned char *hash, size_t hlen,
+                           const mbedtls_mpi *k_inv, const mbedtls_mpi *r,
+                           unsigned char *sig, size_t *slen )
+{
+    int ret;
+    mbedtls_mpi s;
+
+    mbedtls_mpi_init( &s );
+
+    MBEDTLS_MPI_CHK( mbedtls_ecdsa_sign_with_nonce( &ctx->grp, &s, &ctx->d,
+                                                    hash, hlen, k_inv, r ) );
+
+    MBEDTLS_MPI_CHK( ecdsa_signature_to_asn1( r, &s, sig, slen ) );
+
+cleanup:
+    mbedtls_mpi_free( &s );
+
+    return( ret );
+}
+
+/*
+ * Compute and write signature
+ */
+int mbedtls_ecdsa_write_signature( mbedtls_ecdsa_context *ctx, mbedtls_md_type_t md_alg,
+                           const unsigned char *hash, size_t hlen,
+                           unsigned char *sig, size_t *slen,
+                           int (*f_rng)(void *, unsigned char *, size_t),
+                           void *p_rng )
+{
+    return( mbedtls_ecdsa_write_signature_restartable(
+                ctx, md_alg, hash, hlen, sig, slen, f_rng, p_rng, NULL ) );
+}
+
 #if ! defined(MBEDTLS_DEPRECATED_REMOVED) && \
     defined(MBEDTLS_ECDSA_DETERMINISTIC)
 int mbedtls_ecdsa_write_signature_det( mbedtls_ecdsa_context *ctx,
@@ -365,6 +1012,18 @@ int mbedtls_ecdsa_write_signature_det( mbedtls_ecdsa_context *ctx,
 int mbedtls_ecdsa_read_signature( mbedtls_ecdsa_context *ctx,
                           const unsigned char *hash, size_t hlen,
                           const unsigned char *sig, size_t slen )
+{
+    return( mbedtls_ecdsa_read_signature_restartable(
+                ctx, hash, hlen, sig, slen, NULL ) );
+}
+
+/*
+ * Restartable read and check signature
+ */
+int mbedtls_ecdsa_read_signature_restartable( mbedtls_ecdsa_context *ctx,
+                          const unsigned char *hash, size_t hlen,
+                          const unsigned char *sig, size_t slen,
+                          mbedtls_ecdsa_restart_ctx *rs_ctx )
 {
     int ret;
     unsigned char *p = (unsigned char *) sig;
@@ -396,9 +1055,17 @@ int mbedtls_ecdsa_read_signature( mbedtls_ecdsa_context *ctx,
         goto cleanup;
     }
 
+#if defined(MBEDTLS_ECDSA_VERIFY_ALT)
+    (void) rs_ctx;
+
     if( ( ret = mbedtls_ecdsa_verify( &ctx->grp, hash, hlen,
                               &ctx->Q, &r, &s ) ) != 0 )
         goto cleanup;
+#else
+    if( ( ret = ecdsa_verify_restartable( &ctx->grp, hash, hlen,
+                              &ctx->Q, ctx, &r, &s, rs_ctx ) ) != 0 )
+        goto cleanup;
+#endif /* MBEDTLS_ECDSA_VERIFY_ALT */
 
     if( p != end )
         ret = MBEDTLS_ERR_ECP_SIG_LEN_MISMATCH;
@@ -455,4 +1122,45 @@ void mbedtls_ecdsa_free( mbedtls_ecdsa_context *ctx )
     mbedtls_ecp_keypair_free( ctx );
 }
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+/*
+ * Initialize a restart context
+ */
+void mbedtls_ecdsa_restart_init( mbedtls_ecdsa_restart_ctx *ctx )
+{
+    mbedtls_ecp_restart_init( &ctx->ecp );
+
+    ctx->ver = NULL;
+    ctx->sig = NULL;
+#if defined(MBEDTLS_ECDSA_DETERMINISTIC)
+    ctx->det = NULL;
+#endif
+}
+
+/*
+ * Free the components of a restart context
+ */
+void mbedtls_ecdsa_restart_free( mbedtls_ecdsa_restart_ctx *ctx )
+{
+    if( ctx == NULL )
+        return;
+
+    mbedtls_ecp_restart_free( &ctx->ecp );
+
+    ecdsa_restart_ver_free( ctx->ver );
+    mbedtls_free( ctx->ver );
+    ctx->ver = NULL;
+
+    ecdsa_restart_sig_free( ctx->sig );
+    mbedtls_free( ctx->sig );
+    ctx->sig = NULL;
+
+#if defined(MBEDTLS_ECDSA_DETERMINISTIC)
+    ecdsa_restart_det_free( ctx->det );
+    mbedtls_free( ctx->det );
+    ctx->det = NULL;
+#endif
+}
+#endif /* MBEDTLS_ECP_RESTARTABLE */
+
 #endif /* MBEDTLS_ECDSA_C */
@@ -85,6 +85,232 @@ static void mbedtls_zeroize( void *v, size_t n ) {
 static unsigned long add_count, dbl_count, mul_count;
 #endif
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+/*
+ * Maximum number of "basic operations" to be done in a row.
+ */
+static unsigned ecp_max_ops = 0;
+
+/*
+ * Set ecp_max_ops
+ */
+void mbedtls_ecp_set_max_ops( unsigned max_ops )
+{
+    ecp_max_ops = max_ops;
+}
+
+/*
+ * Check if restart is enabled
+ */
+int mbedtls_ecp_restart_is_enabled( void )
+{
+    return( ecp_max_ops != 0 );
+}
+
+/*
+ * Restart sub-context for ecp_mul_comb() and ecp_mul_mxz()
+ */
+struct mbedtls_ecp_restart_mul
+{
+    mbedtls_ecp_point R;    /* current intermediate result                  */
+    mbedtls_ecp_point RP;   /* ladder only: R + P                           */
+    size_t i;               /* current index in various loops, 0 outside    */
+    mbedtls_ecp_point *T;   /* table for precomputed points                 */
+    unsigned char T_size;   /* number of points in table T                  */
+    enum {                  /* what were we doing last time we returned?    */
+        ecp_rsm_init = 0,       /* nothing so far, dummy initial state      */
+        ecp_rsm_pre_dbl,        /* precompute 2^n multiples                 */
+        ecp_rsm_pre_norm_dbl,   /* normalize precomputed 2^n multiples      */
+        ecp_rsm_pre_add,        /* precompute remaining points by adding    */
+        ecp_rsm_pre_norm_add,   /* normalize all precomputed points         */
+        ecp_rsm_comb_core,      /* ecp_mul_comb_core()                      */
+        ecp_rsm_final_norm,     /* do the final normalization               */
+        ecp_rsm_ladder,         /* ecp_mul_mxz() main loop                  */
+    } state;
+};
+
+/*
+ * Init restart_mul sub-context
+ */
+static void ecp_restart_rsm_init( mbedtls_ecp_restart_mul_ctx *ctx )
+{
+    mbedtls_ecp_point_init( &ctx->R );
+    mbedtls_ecp_point_init( &ctx->RP );
+    ctx->i = 0;
+    ctx->T = NULL;
+    ctx->T_size = 0;
+    ctx->state = ecp_rsm_init;
+}
+
+/*
+ * Free the components of a restart_mul sub-context
+ */
+static void ecp_restart_rsm_free( mbedtls_ecp_restart_mul_ctx *ctx )
+{
+    unsigned char i;
+
+    if( ctx == NULL )
+        return;
+
+    mbedtls_ecp_point_free( &ctx->R );
+    mbedtls_ecp_point_free( &ctx->RP );
+
+    if( ctx->T != NULL )
+    {
+        for( i = 0; i < ctx->T_size; i++ )
+            mbedtls_ecp_point_free( ctx->T + i );
+        mbedtls_free( ctx->T );
+    }
+
+    ecp_restart_rsm_init( ctx );
+}
+
+/*
+ * Restart context for ecp_muladd()
+ */
+struct mbedtls_ecp_restart_muladd
+{
+    mbedtls_ecp_point mP;       /* mP value                             */
+    mbedtls_ecp_point R;        /* R intermediate result                */
+    enum {                      /* what should we do next?              */
+        ecp_rsma_mul1 = 0,      /* first multiplication                 */
+        ecp_rsma_mul2,          /* second multiplication                */
+        ecp_rsma_add,           /* addition                             */
+        ecp_rsma_norm,          /* normalization                        */
+    } state;
+};
+
+/*
+ * Init restart_muladd sub-context
+ */
+static void ecp_restart_ma_init( mbedtls_ecp_restart_muladd_ctx *ctx )
+{
+    mbedtls_ecp_point_init( &ctx->mP );
+    mbedtls_ecp_point_init( &ctx->R );
+    ctx->state = ecp_rsma_mul1;
+}
+
+/*
+ * Free the components of a restart_muladd sub-context
+ */
+static void ecp_restart_ma_free( mbedtls_ecp_restart_muladd_ctx *ctx )
+{
+    if( ctx == NULL )
+        return;
+
+    mbedtls_ecp_point_free( &ctx->mP );
+    mbedtls_ecp_point_free( &ctx->R );
+
+    ecp_restart_ma_init( ctx );
+}
+
+/*
+ * Initialize a restart context
+ */
+void mbedtls_ecp_restart_init( mbedtls_ecp_restart_ctx *ctx )
+{
+    ctx->ops_done = 0;
+    ctx->depth = 0;
+    ctx->rsm = NULL;
+    ctx->ma = NULL;
+}
+
+/*
+ * Free the components of a restart context
+ */
+void mbedtls_ecp_restart_free( mbedtls_ecp_restart_ctx *ctx )
+{
+    if( ctx == NULL )
+        return;
+
+    ecp_restart_rsm_free( ctx->rsm );
+    mbedtls_free( ctx->rsm );
+
+    ecp_restart_ma_free( ctx->ma );
+    mbedtls_free( ctx->ma );
+
+    mbedtls_ecp_restart_init( ctx );
+}
+
+/*
+ * Check if we can do the next step
+ */
+int mbedtls_ecp_check_budget( const mbedtls_ecp_group *grp,
+                              mbedtls_ecp_restart_ctx *rs_ctx,
+                              unsigned ops )
+{
+    if( rs_ctx != NULL && ecp_max_ops != 0 )
+    {
+        /* scale depending on curve size: the chosen reference is 256-bit,
+         * and multiplication is quadratic. Round to the closest integer. */
+        if( grp->pbits >= 512 )
+            ops *= 4;
+        else if( grp->pbits >= 384 )
+            ops *= 2;
+
+        /*
+         * Avoid infinite loops: always allow first step.
+         * Because of that, however, it's not generally true
+         * that ops_done <= ecp_max_ops, so the check
+         * ops_done > ecp_max_ops below is mandatory.
+         */
+        if( ( rs_ctx->ops_done != 0 ) &&
+            ( rs_ctx->ops_done > ecp_max_ops ||
+              ops > ecp_max_ops - rs_ctx->ops_done ) )
+        {
+            return( MBEDTLS_ERR_ECP_IN_PROGRESS );
+        }
+
+        /* update running count */
+        rs_ctx->ops_done += ops;
+    }
+
+    return( 0 );
+}
+
+/* Call this when entering a function that needs its own sub-context */
+#define ECP_RS_ENTER( SUB )   do {                                      \
+    /* reset ops count for this call if top-level */                    \
+    if( rs_ctx != NULL && rs_ctx->depth++ == 0 )                        \
+        rs_ctx->ops_done = 0;                                           \
+                                                                        \
+    /* set up our own sub-context if needed */                          \
+    if( mbedtls_ecp_restart_is_enabled() &&                             \
+        rs_ctx != NULL && rs_ctx->SUB == NULL )                         \
+    {                                                                   \
+        rs_ctx->SUB = mbedtls_calloc( 1, sizeof( *rs_ctx->SUB ) );      \
+        if( rs_ctx->SUB == NULL )                                       \
+        {                                                               \
+            rs_ctx->depth--;                                            \
+            return( MBEDTLS_ERR_ECP_ALLOC_FAILED );                     \
+        }                                                               \
+                                                                        \
+        ecp_restart_## SUB ##_init( rs_ctx->SUB );                      \
+    }                                                                   \
+} while( 0 )
+
+/* Call this when leaving a function that needs its own sub-context */
+#define ECP_RS_LEAVE( SUB )   do {                                      \
+    /* free our sub-context when done */                                \
+    if( rs_ctx != NULL && rs_ctx->SUB != NULL &&                        \
+        ret != MBEDTLS_ERR_ECP_IN_PROGRESS )                            \
+    {                                                                   \
+        ecp_restart_## SUB ##_free( rs_ctx->SUB );                      \
+        mbedtls_free( rs_ctx->SUB );                                    \
+        rs_ctx->SUB = NULL;                                             \
+    }                                                                   \
+                                                                        \
+    if( rs_ctx != NULL )                                                \
+        rs_ctx->depth--;                                                \
+} while( 0 )
+
+#else /* MBEDTLS_ECP_RESTARTABLE */
+
+#define ECP_RS_ENTER( sub )     (void) rs_ctx;
+#define ECP_RS_LEAVE( sub )     (void) rs_ctx;
+
+#endif /* MBEDTLS_ECP_RESTARTABLE */
+
 #if defined(MBEDTLS_ECP_DP_SECP192R1_ENABLED) ||   \
     defined(MBEDTLS_ECP_DP_SECP224R1_ENABLED) ||   \
     defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED) ||   \
@@ -99,29 +325,45 @@ static unsigned long add_count, dbl_count, mul_count;
 #define ECP_SHORTWEIERSTRASS
 #endif
 
-#if defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED)
+#if defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED) ||   \
+    defined(MBEDTLS_ECP_DP_CURVE448_ENABLED)
 #define ECP_MONTGOMERY
 #endif
 
-/*
- * Curve types: internal for now, might be exposed later
- */
-typedef enum
-{
-    ECP_TYPE_NONE = 0,
-    ECP_TYPE_SHORT_WEIERSTRASS,    /* y^2 = x^3 + a x + b      */
-    ECP_TYPE_MONTGOMERY,           /* y^2 = x^3 + a x^2 + x    */
-} ecp_curve_type;
+#if defined(MBEDTLS_ECP_P256_FAST) && defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED)
+#define ECP_P256_FAST
+#include "mbedtls/ecp_p256.h"
+#endif
+
+#if defined(MBEDTLS_ECP_P384_FAST) && defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED)
+#define ECP_P384_FAST
+#include "mbedtls/ecp_p384.h"
+#endif
+
+#if defined(MBEDTLS_ECP_X25519_FAST) && defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED)
+#define ECP_X25519_FAST
+#include "mbedtls/ecp_x25519.h"
+#endif
+
+#if defined(MBEDTLS_ECP_X448_FAST) && defined(MBEDTLS_ECP_DP_CURVE448_ENABLED)
+#define ECP_X448_FAST
+#include "mbedtls/ecp_x448.h"
+#endif
+
+#if defined(MBEDTLS_ECP_SECP256K1_GLV) && defined(MBEDTLS_ECP_DP_SECP256K1_ENABLED)
+#define ECP_SECP256K1_GLV
+#endif
 
 /*
  * List of supported curves:
  *  - internal ID
- *  - TLS NamedCurve ID (RFC 4492 sec. 5.1.1, RFC 7071 sec. 2)
+ *  - TLS NamedCurve ID (RFC 4492 sec. 5.1.1, RFC 7071 sec. 2, RFC 8422)
  *  - size in bits
  *  - readable name
  *
  * Curves are listed in order: largest curves first, and for a given size,
  * fastest curves first. This provides the default order for the SSL module.
+ * Montgomery curves (RFC 8422) can only be used for ECDH(E).
  *
  * Reminder: update profiles in x509_crt.c when adding a new curves!
  */
@@ -133,12 +375,18 @@ static const mbedtls_ecp_curve_info ecp_supported_curves[] =
 #if defined(MBEDTLS_ECP_DP_BP512R1_ENABLED)
     { MBEDTLS_ECP_DP_BP512R1,      28,     512,    "brainpoolP512r1"   },
 #endif
+#if defined(MBEDTLS_ECP_DP_CURVE448_ENABLED)
+    { MBEDTLS_ECP_DP_CURVE448,     30,     448,    "x448"              },
+#endif
 #if defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED)
     { MBEDTLS_ECP_DP_SECP384R1,    24,     384,    "secp384r1"         },
 #endif
 #if defined(MBEDTLS_ECP_DP_BP384R1_ENABLED)
     { MBEDTLS_ECP_DP_BP384R1,      27,     384,    "brainpoolP384r1"   },
 #endif
+#if defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED)
+    { MBEDTLS_ECP_DP_CURVE25519,   29,     256,    "x25519"            },
+#endif
 #if defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED)
     { MBEDTLS_ECP_DP_SECP256R1,    23,     256,    "secp256r1"         },
 #endif
@@ -259,15 +507,20 @@ const mbedtls_ecp_curve_info *mbedtls_ecp_curve_info_from_name( const char *name
 /*
  * Get the type of a curve
  */
-static inline ecp_curve_type ecp_get_type( const mbedtls_ecp_group *grp )
+static inline mbedtls_ecp_curve_type ecp_get_type( const mbedtls_ecp_group *grp )
 {
     if( grp->G.X.p == NULL )
-        return( ECP_TYPE_NONE );
+        return( MBEDTLS_ECP_TYPE_NONE );
 
     if( grp->G.Y.p == NULL )
-        return( ECP_TYPE_MONTGOMERY );
+        return( MBEDTLS_ECP_TYPE_MONTGOMERY );
     else
-        return( ECP_TYPE_SHORT_WEIERSTRASS );
+        return( MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS );
+}
+
+mbedtls_ecp_curve_type mbedtls_ecp_get_type( const mbedtls_ecp_group *grp )
+{
+    return( ecp_get_type( grp ) );
 }
 
 /*
@@ -292,6 +545,10 @@ void mbedtls_ecp_group_init( mbedtls_ecp_group *grp )
         return;
 
     memset( grp, 0, sizeof( mbedtls_ecp_group ) );
+    mbedtls_mpi_mod_init( &grp->P_mod );
+    mbedtls_mpi_init( &grp->mont_one );
+    mbedtls_mpi_init( &grp->mont_A );
+    mbedtls_mpi_init( &grp->mont_B );
 }
 
 /*
@@ -305,6 +562,8 @@ void mbedtls_ecp_keypair_init( mbedtls_ecp_keypair *key )
     mbedtls_ecp_group_init( &key->grp );
     mbedtls_mpi_init( &key->d );
     mbedtls_ecp_point_init( &key->Q );
+    key->T = NULL;
+    key->T_size = 0;
 }
 
 /*
@@ -339,13 +598,19 @@ void mbedtls_ecp_group_free( mbedtls_ecp_group *grp )
         mbedtls_mpi_free( &grp->N );
     }
 
-    if( grp->T != NULL )
+    /* T_size == 0 means T points to a static table from ecp_curves.c */
+    if( grp->T != NULL && grp->T_size != 0 )
     {
         for( i = 0; i < grp->T_size; i++ )
             mbedtls_ecp_point_free( &grp->T[i] );
         mbedtls_free( grp->T );
     }
 
+    mbedtls_mpi_mod_free( &grp->P_mod );
+    mbedtls_mpi_free( &grp->mont_one );
+    mbedtls_mpi_free( &grp->mont_A );
+    mbedtls_mpi_free( &grp->mont_B );
+
     mbedtls_zeroize( grp, sizeof( mbedtls_ecp_group ) );
 }
 
@@ -354,12 +619,24 @@ void mbedtls_ecp_group_free( mbedtls_ecp_group *grp )
  */
 void mbedtls_ecp_keypair_free( mbedtls_ecp_keypair *key )
 {
+    size_t i;
+
     if( key == NULL )
         return;
 
     mbedtls_ecp_group_free( &key->grp );
     mbedtls_mpi_free( &key->d );
     mbedtls_ecp_point_free( &key->Q );
+
+    if( key->T != NULL )
+    {
+        for( i = 0; i < key->T_size; i++ )
+            mbedtls_ecp_point_free( &key->T[i] );
+        mbedtls_free( key->T );
+    }
+
+    key->T = NULL;
+    key->T_size = 0;
 }
 
 /*
@@ -442,6 +719,7 @@ cleanup:
 
 /*
  * Export a point into unsigned binary data (SEC1 2.3.3)
+ * For Montgomery curves, only the x coordinate, little endian (RFC 7748 5)
  */
 int mbedtls_ecp_point_write_binary( const mbedtls_ecp_group *grp, const mbedtls_ecp_point *P,
                             int format, size_t *olen,
@@ -454,6 +732,19 @@ int mbedtls_ecp_point_write_binary( const mbedtls_ecp_group *grp, const mbedtls_
         format != MBEDTLS_ECP_PF_COMPRESSED )
         return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
 
+#if defined(ECP_MONTGOMERY)
+    if( ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_MONTGOMERY )
+    {
+        plen = mbedtls_mpi_size( &grp->P );
+        *olen = plen;
+
+        if( buflen < *olen )
+            return( MBEDTLS_ERR_ECP_BUFFER_TOO_SMALL );
+
+        return( mbedtls_mpi_write_binary_le( &P->X, buf, plen ) );
+    }
+#endif
+
     /*
      * Common case: P == 0
      */
@@ -498,6 +789,7 @@ cleanup:
 
 /*
  * Import a point from unsigned binary data (SEC1 2.3.4)
+ * For Montgomery curves, only the x coordinate, little endian (RFC 7748 5)
  */
 int mbedtls_ecp_point_read_binary( const mbedtls_ecp_group *grp, mbedtls_ecp_point *pt,
                            const unsigned char *buf, size_t ilen )
@@ -508,6 +800,27 @@ int mbedtls_ecp_point_read_binary( const mbedtls_ecp_group *grp, mbedtls_ecp_poi
     if( ilen < 1 )
         return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
 
+#if defined(ECP_MONTGOMERY)
+    if( ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_MONTGOMERY )
+    {
+        plen = mbedtls_mpi_size( &grp->P );
+
+        if( ilen != plen )
+            return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary_le( &pt->X, buf, plen ) );
+        mbedtls_mpi_free( &pt->Y );
+
+        /* X25519 ignores the unused top bit (RFC 7748 5) */
+        if( grp->pbits % 8 != 0 )
+            MBEDTLS_MPI_CHK( mbedtls_mpi_set_bit( &pt->X, 8 * plen - 1, 0 ) );
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &pt->Z, 1 ) );
+
+        return( 0 );
+    }
+#endif
+
     if( buf[0] == 0x00 )
     {
         if( ilen == 1 )
@@ -659,6 +972,18 @@ int mbedtls_ecp_tls_write_group( const mbedtls_ecp_group *grp, size_t *olen,
     return( 0 );
 }
 
+/*
+ * Built-in curves without a fast reduction keep their field elements in
+ * Montgomery form inside this module, so that a multiplication is followed
+ * by a Montgomery reduction rather than a Barrett one: additions,
+ * subtractions and multiplications by small integers work the same in that
+ * form, and the constants they need are in grp->mont_XXX. Points are
+ * converted on their way into the scalar multiplications and the public key
+ * check, and back on their way out; the static tables of multiples of G for
+ * these curves are in Montgomery form too.
+ */
+#define ECP_MONT( grp )     ( ( grp )->mont_one.p != NULL )
+
 /*
  * Wrapper around fast quasi-modp functions, with fall-back to mbedtls_mpi_mod_mpi.
  * See the documentation of struct mbedtls_ecp_group.
@@ -670,7 +995,15 @@ static int ecp_modp( mbedtls_mpi *N, const mbedtls_ecp_group *grp )
     int ret;
 
     if( grp->modp == NULL )
+    {
+        if( ECP_MONT( grp ) )
+            return( mbedtls_mpi_mod_montred( N, N, &grp->P_mod ) );
+
+        if( grp->P_mod.N.n != 0 )
+            return( mbedtls_mpi_mod_reduce( N, N, &grp->P_mod ) );
+
         return( mbedtls_mpi_mod_mpi( N, N, &grp->P ) );
+    }
 
     /* N->s < 0 is a much faster test, which fails only if N is 0 */
     if( ( N->s < 0 && mbedtls_mpi_cmp_int( N, 0 ) != 0 ) ||
@@ -712,7 +1045,7 @@ cleanup:
 #define INC_MUL_COUNT
 #endif
 
-#define MOD_MUL( N )    do { MBEDTLS_MPI_CHK( ecp_modp( &N, grp ) ); INC_MUL_COUNT } \
+#define MOD_MUL( N )    do { MBEDTLS_MPI_CHK( ecp_modp( &( N ), grp ) ); INC_MUL_COUNT } \
                         while( 0 )
 
 /*
@@ -720,8 +1053,8 @@ cleanup:
  * N->s < 0 is a very fast test, which fails only if N is 0
  */
 #define MOD_SUB( N )                                \
-    while( N.s < 0 && mbedtls_mpi_cmp_int( &N, 0 ) != 0 )   \
-        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &N, &N, &grp->P ) )
+    while( ( N ).s < 0 && mbedtls_mpi_cmp_int( &( N ), 0 ) != 0 )   \
+        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &( N ), &( N ), &grp->P ) )
 
 /*
  * Reduce a mbedtls_mpi mod p in-place, to use after mbedtls_mpi_add_mpi and mbedtls_mpi_mul_int.
@@ -729,8 +1062,40 @@ cleanup:
  * a bit faster.
  */
 #define MOD_ADD( N )                                \
-    while( mbedtls_mpi_cmp_mpi( &N, &grp->P ) >= 0 )        \
-        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_abs( &N, &N, &grp->P ) )
+    while( mbedtls_mpi_cmp_mpi( &( N ), &grp->P ) >= 0 )    \
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_abs( &( N ), &( N ), &grp->P ) )
+
+/*
+ * The point formulas below don't allocate their own temporaries: they work
+ * in an array of ECP_TMP_LEN MPIs (ecp_double_add_mxz() needs the most)
+ * provided by the top-level scalar multiplication. The array is set up once
+ * per operation, with enough room for a double-width product, so that the
+ * inner loops run without touching the heap.
+ */
+#define ECP_TMP_LEN     9
+
+static int ecp_tmp_init( const mbedtls_ecp_group *grp, mbedtls_mpi *tmp )
+{
+    int ret = 0;
+    size_t i;
+
+    for( i = 0; i < ECP_TMP_LEN; i++ )
+        mbedtls_mpi_init( &tmp[i] );
+
+    for( i = 0; i < ECP_TMP_LEN; i++ )
+        MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &tmp[i], 2 * grp->P.n + 1 ) );
+
+cleanup:
+    return( ret );
+}
+
+static void ecp_tmp_free( mbedtls_mpi *tmp )
+{
+    size_t i;
+
+    for( i = 0; i < ECP_TMP_LEN; i++ )
+        mbedtls_mpi_free( &tmp[i] );
+}
 
 #if defined(ECP_SHORTWEIERSTRASS)
 /*
@@ -741,14 +1106,103 @@ cleanup:
  * SPA, hence timing attacks.
  */
 
+/*
+ * X = X R mod P, as the Montgomery reduction of X R^2 (see ECP_MONT())
+ */
+static int ecp_mpi_to_mont( const mbedtls_ecp_group *grp, mbedtls_mpi *X )
+{
+    int ret;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( X, X, &grp->P_mod.RR ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_montred( X, X, &grp->P_mod ) );
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * R = P with its coordinates in Montgomery form, P being normalized or zero
+ */
+static int ecp_point_to_mont( const mbedtls_ecp_group *grp,
+                              mbedtls_ecp_point *R, const mbedtls_ecp_point *P )
+{
+    int ret;
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( R, P ) );
+
+    if( mbedtls_mpi_cmp_int( &R->Z, 0 ) != 0 )
+    {
+        MBEDTLS_MPI_CHK( ecp_mpi_to_mont( grp, &R->X ) );
+        MBEDTLS_MPI_CHK( ecp_mpi_to_mont( grp, &R->Y ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Z, &grp->mont_one ) );
+    }
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * Hand a normalized non-zero point back to the caller: X and Y out of
+ * Montgomery form if needed, and Z = 1 (which ecp_normalize_jac_many()
+ * doesn't store)
+ */
+static int ecp_point_out( const mbedtls_ecp_group *grp, mbedtls_ecp_point *pt )
+{
+    int ret;
+
+    if( ECP_MONT( grp ) )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_montred( &pt->X, &pt->X, &grp->P_mod ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_montred( &pt->Y, &pt->Y, &grp->P_mod ) );
+    }
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &pt->Z, 1 ) );
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * Z = 1 as a field element of the group, that is R mod P in Montgomery form
+ */
+static int ecp_set_one( const mbedtls_ecp_group *grp, mbedtls_mpi *Z )
+{
+    if( ECP_MONT( grp ) )
+        return( mbedtls_mpi_copy( Z, &grp->mont_one ) );
+
+    return( mbedtls_mpi_lset( Z, 1 ) );
+}
+
+/*
+ * X = 1 / A mod P. In Montgomery form, the inverse of A R is A^-1 R^-1,
+ * which takes two conversions to become A^-1 R.
+ */
+static int ecp_inv_modp( const mbedtls_ecp_group *grp, mbedtls_mpi *X,
+                         const mbedtls_mpi *A )
+{
+    int ret;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( X, A, &grp->P ) );
+
+    if( ECP_MONT( grp ) )
+    {
+        MBEDTLS_MPI_CHK( ecp_mpi_to_mont( grp, X ) );
+        MBEDTLS_MPI_CHK( ecp_mpi_to_mont( grp, X ) );
+    }
+
+cleanup:
+    return( ret );
+}
+
 /*
  * Normalize jacobian coordinates so that Z == 0 || Z == 1  (GECC 3.2.1)
  * Cost: 1N := 1I + 3M + 1S
  */
-static int ecp_normalize_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *pt )
+static int ecp_normalize_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *pt,
+                              mbedtls_mpi *tmp )
 {
     int ret;
-    mbedtls_mpi Zi, ZZi;
+    mbedtls_mpi *Zi = &tmp[0], *ZZi = &tmp[1];
 
     if( mbedtls_mpi_cmp_int( &pt->Z, 0 ) == 0 )
         return( 0 );
@@ -759,30 +1213,26 @@ static int ecp_normalize_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *p
         return mbedtls_internal_ecp_normalize_jac( grp, pt );
     }
 #endif /* MBEDTLS_ECP_NORMALIZE_JAC_ALT */
-    mbedtls_mpi_init( &Zi ); mbedtls_mpi_init( &ZZi );
-
     /*
      * X = X / Z^2  mod p
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( &Zi,      &pt->Z,     &grp->P ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ZZi,     &Zi,        &Zi     ) ); MOD_MUL( ZZi );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->X,   &pt->X,     &ZZi    ) ); MOD_MUL( pt->X );
+    MBEDTLS_MPI_CHK( ecp_inv_modp( grp, Zi,        &pt->Z          ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( ZZi,     Zi,        Zi     ) ); MOD_MUL( *ZZi );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->X,   &pt->X,     ZZi    ) ); MOD_MUL( pt->X );
 
     /*
      * Y = Y / Z^3  mod p
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Y,   &pt->Y,     &ZZi    ) ); MOD_MUL( pt->Y );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Y,   &pt->Y,     &Zi     ) ); MOD_MUL( pt->Y );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Y,   &pt->Y,     ZZi    ) ); MOD_MUL( pt->Y );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Y,   &pt->Y,     Zi     ) ); MOD_MUL( pt->Y );
 
     /*
      * Z = 1
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &pt->Z, 1 ) );
+    MBEDTLS_MPI_CHK( ecp_set_one( grp, &pt->Z ) );
 
 cleanup:
 
-    mbedtls_mpi_free( &Zi ); mbedtls_mpi_free( &ZZi );
-
     return( ret );
 }
 
@@ -798,14 +1248,15 @@ cleanup:
  * Cost: 1N(t) := 1I + (6t - 3)M + 1S
  */
 static int ecp_normalize_jac_many( const mbedtls_ecp_group *grp,
-                                   mbedtls_ecp_point *T[], size_t t_len )
+                                   mbedtls_ecp_point *T[], size_t t_len,
+                                   mbedtls_mpi *tmp )
 {
     int ret;
     size_t i;
-    mbedtls_mpi *c, u, Zi, ZZi;
+    mbedtls_mpi *c, *u = &tmp[0], *Zi = &tmp[1], *ZZi = &tmp[2];
 
     if( t_len < 2 )
-        return( ecp_normalize_jac( grp, *T ) );
+        return( ecp_normalize_jac( grp, *T, tmp ) );
 
 #if defined(MBEDTLS_ECP_NORMALIZE_JAC_MANY_ALT)
     if ( mbedtls_internal_ecp_grp_capable( grp ) )
@@ -817,8 +1268,6 @@ static int ecp_normalize_jac_many( const mbedtls_ecp_group *grp,
     if( ( c = mbedtls_calloc( t_len, sizeof( mbedtls_mpi ) ) ) == NULL )
         return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
 
-    mbedtls_mpi_init( &u ); mbedtls_mpi_init( &Zi ); mbedtls_mpi_init( &ZZi );
-
     /*
      * c[i] = Z_0 * ... * Z_i
      */
@@ -832,7 +1281,7 @@ static int ecp_normalize_jac_many( const mbedtls_ecp_group *grp,
     /*
      * u = 1 / (Z_0 * ... * Z_n) mod P
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( &u, &c[t_len-1], &grp->P ) );
+    MBEDTLS_MPI_CHK( ecp_inv_modp( grp, u, &c[t_len-1] ) );
 
     for( i = t_len - 1; ; i-- )
     {
@@ -841,21 +1290,21 @@ static int ecp_normalize_jac_many( const mbedtls_ecp_group *grp,
          * u = 1 / (Z_0 * ... * Z_i) mod P
          */
         if( i == 0 ) {
-            MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &Zi, &u ) );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_copy( Zi, u ) );
         }
         else
         {
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &Zi, &u, &c[i-1]  ) ); MOD_MUL( Zi );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &u,  &u, &T[i]->Z ) ); MOD_MUL( u );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( Zi, u, &c[i-1]  ) ); MOD_MUL( *Zi );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( u,  u, &T[i]->Z ) ); MOD_MUL( *u );
         }
 
         /*
          * proceed as in normalize()
          */
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ZZi,     &Zi,      &Zi  ) ); MOD_MUL( ZZi );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T[i]->X, &T[i]->X, &ZZi ) ); MOD_MUL( T[i]->X );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T[i]->Y, &T[i]->Y, &ZZi ) ); MOD_MUL( T[i]->Y );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T[i]->Y, &T[i]->Y, &Zi  ) ); MOD_MUL( T[i]->Y );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( ZZi,     Zi,      Zi  ) ); MOD_MUL( *ZZi );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T[i]->X, &T[i]->X, ZZi ) ); MOD_MUL( T[i]->X );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T[i]->Y, &T[i]->Y, ZZi ) ); MOD_MUL( T[i]->Y );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T[i]->Y, &T[i]->Y, Zi  ) ); MOD_MUL( T[i]->Y );
 
         /*
          * Post-precessing: reclaim some memory by shrinking coordinates
@@ -873,7 +1322,6 @@ static int ecp_normalize_jac_many( const mbedtls_ecp_group *grp,
 
 cleanup:
 
-    mbedtls_mpi_free( &u ); mbedtls_mpi_free( &Zi ); mbedtls_mpi_free( &ZZi );
     for( i = 0; i < t_len; i++ )
         mbedtls_mpi_free( &c[i] );
     mbedtls_free( c );
@@ -887,21 +1335,19 @@ cleanup:
  */
 static int ecp_safe_invert_jac( const mbedtls_ecp_group *grp,
                             mbedtls_ecp_point *Q,
-                            unsigned char inv )
+                            unsigned char inv,
+                            mbedtls_mpi *tmp )
 {
     int ret;
     unsigned char nonzero;
-    mbedtls_mpi mQY;
-
-    mbedtls_mpi_init( &mQY );
+    mbedtls_mpi *mQY = &tmp[0];
 
     /* Use the fact that -Q.Y mod P = P - Q.Y unless Q.Y == 0 */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &mQY, &grp->P, &Q->Y ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( mQY, &grp->P, &Q->Y ) );
     nonzero = mbedtls_mpi_cmp_int( &Q->Y, 0 ) != 0;
-    MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_assign( &Q->Y, &mQY, inv & nonzero ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_assign( &Q->Y, mQY, inv & nonzero ) );
 
 cleanup:
-    mbedtls_mpi_free( &mQY );
 
     return( ret );
 }
@@ -921,10 +1367,11 @@ cleanup:
  *             3M + 6S + 1a     otherwise
  */
 static int ecp_double_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
-                           const mbedtls_ecp_point *P )
+                           const mbedtls_ecp_point *P, mbedtls_mpi *tmp )
 {
     int ret;
-    mbedtls_mpi M, S, T, U;
+    mbedtls_mpi *M = &tmp[0], *S = &tmp[1], *T = &tmp[2], *U = &tmp[3];
+    const mbedtls_mpi *A = ECP_MONT( grp ) ? &grp->mont_A : &grp->A;
 
 #if defined(MBEDTLS_SELF_TEST)
     dbl_count++;
@@ -937,65 +1384,62 @@ static int ecp_double_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     }
 #endif /* MBEDTLS_ECP_DOUBLE_JAC_ALT */
 
-    mbedtls_mpi_init( &M ); mbedtls_mpi_init( &S ); mbedtls_mpi_init( &T ); mbedtls_mpi_init( &U );
-
     /* Special case for A = -3 */
     if( grp->A.p == NULL )
     {
         /* M = 3(X + Z^2)(X - Z^2) */
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &P->Z,  &P->Z   ) ); MOD_MUL( S );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &T,  &P->X,  &S      ) ); MOD_ADD( T );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &U,  &P->X,  &S      ) ); MOD_SUB( U );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &T,     &U      ) ); MOD_MUL( S );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( &M,  &S,     3       ) ); MOD_ADD( M );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,  &P->Z,  &P->Z   ) ); MOD_MUL( *S );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( T,  &P->X,  S      ) ); MOD_ADD( *T );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( U,  &P->X,  S      ) ); MOD_SUB( *U );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,  T,     U      ) ); MOD_MUL( *S );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( M,  S,     3       ) ); MOD_ADD( *M );
     }
     else
     {
         /* M = 3.X^2 */
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &P->X,  &P->X   ) ); MOD_MUL( S );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( &M,  &S,     3       ) ); MOD_ADD( M );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,  &P->X,  &P->X   ) ); MOD_MUL( *S );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( M,  S,     3       ) ); MOD_ADD( *M );
 
         /* Optimize away for "koblitz" curves with A = 0 */
         if( mbedtls_mpi_cmp_int( &grp->A, 0 ) != 0 )
         {
             /* M += A.Z^4 */
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &P->Z,  &P->Z   ) ); MOD_MUL( S );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T,  &S,     &S      ) ); MOD_MUL( T );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &T,     &grp->A ) ); MOD_MUL( S );
-            MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &M,  &M,     &S      ) ); MOD_ADD( M );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,  &P->Z,  &P->Z   ) ); MOD_MUL( *S );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T,  S,     S      ) ); MOD_MUL( *T );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,  T,     A      ) ); MOD_MUL( *S );
+            MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( M,  M,     S      ) ); MOD_ADD( *M );
         }
     }
 
     /* S = 4.X.Y^2 */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T,  &P->Y,  &P->Y   ) ); MOD_MUL( T );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &T,  1               ) ); MOD_ADD( T );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &P->X,  &T      ) ); MOD_MUL( S );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &S,  1               ) ); MOD_ADD( S );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T,  &P->Y,  &P->Y   ) ); MOD_MUL( *T );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( T,  1               ) ); MOD_ADD( *T );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,  &P->X,  T      ) ); MOD_MUL( *S );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( S,  1               ) ); MOD_ADD( *S );
 
     /* U = 8.Y^4 */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &U,  &T,     &T      ) ); MOD_MUL( U );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &U,  1               ) ); MOD_ADD( U );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( U,  T,     T      ) ); MOD_MUL( *U );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( U,  1               ) ); MOD_ADD( *U );
 
     /* T = M^2 - 2.S */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T,  &M,     &M      ) ); MOD_MUL( T );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T,  &T,     &S      ) ); MOD_SUB( T );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T,  &T,     &S      ) ); MOD_SUB( T );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T,  M,     M      ) ); MOD_MUL( *T );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( T,  T,     S      ) ); MOD_SUB( *T );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( T,  T,     S      ) ); MOD_SUB( *T );
 
     /* S = M(S - T) - U */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &S,  &S,     &T      ) ); MOD_SUB( S );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S,  &S,     &M      ) ); MOD_MUL( S );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &S,  &S,     &U      ) ); MOD_SUB( S );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( S,  S,     T      ) ); MOD_SUB( *S );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( S,  S,     M      ) ); MOD_MUL( *S );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( S,  S,     U      ) ); MOD_SUB( *S );
 
     /* U = 2.Y.Z */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &U,  &P->Y,  &P->Z   ) ); MOD_MUL( U );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &U,  1               ) ); MOD_ADD( U );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( U,  &P->Y,  &P->Z   ) ); MOD_MUL( *U );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( U,  1               ) ); MOD_ADD( *U );
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->X, &T ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Y, &S ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Z, &U ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->X, T ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Y, S ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Z, U ) );
 
 cleanup:
-    mbedtls_mpi_free( &M ); mbedtls_mpi_free( &S ); mbedtls_mpi_free( &T ); mbedtls_mpi_free( &U );
 
     return( ret );
 }
@@ -1019,10 +1463,12 @@ cleanup:
  * Cost: 1A := 8M + 3S
  */
 static int ecp_add_mixed( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
-                          const mbedtls_ecp_point *P, const mbedtls_ecp_point *Q )
+                          const mbedtls_ecp_point *P, const mbedtls_ecp_point *Q,
+                          mbedtls_mpi *tmp )
 {
     int ret;
-    mbedtls_mpi T1, T2, T3, T4, X, Y, Z;
+    mbedtls_mpi *T1 = &tmp[0], *T2 = &tmp[1], *T3 = &tmp[2], *T4 = &tmp[3];
+    mbedtls_mpi *X = &tmp[4], *Y = &tmp[5], *Z = &tmp[6];
 
 #if defined(MBEDTLS_SELF_TEST)
     add_count++;
@@ -1047,25 +1493,24 @@ static int ecp_add_mixed( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     /*
      * Make sure Q coordinates are normalized
      */
-    if( Q->Z.p != NULL && mbedtls_mpi_cmp_int( &Q->Z, 1 ) != 0 )
+    if( Q->Z.p != NULL &&
+        ( ECP_MONT( grp ) ? mbedtls_mpi_cmp_mpi( &Q->Z, &grp->mont_one ) :
+                            mbedtls_mpi_cmp_int( &Q->Z, 1 ) ) != 0 )
         return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
 
-    mbedtls_mpi_init( &T1 ); mbedtls_mpi_init( &T2 ); mbedtls_mpi_init( &T3 ); mbedtls_mpi_init( &T4 );
-    mbedtls_mpi_init( &X ); mbedtls_mpi_init( &Y ); mbedtls_mpi_init( &Z );
-
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T1,  &P->Z,  &P->Z ) );  MOD_MUL( T1 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T2,  &T1,    &P->Z ) );  MOD_MUL( T2 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T1,  &T1,    &Q->X ) );  MOD_MUL( T1 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T2,  &T2,    &Q->Y ) );  MOD_MUL( T2 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T1,  &T1,    &P->X ) );  MOD_SUB( T1 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T2,  &T2,    &P->Y ) );  MOD_SUB( T2 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T1,  &P->Z,  &P->Z ) );  MOD_MUL( *T1 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T2,  T1,    &P->Z ) );  MOD_MUL( *T2 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T1,  T1,    &Q->X ) );  MOD_MUL( *T1 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T2,  T2,    &Q->Y ) );  MOD_MUL( *T2 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( T1,  T1,    &P->X ) );  MOD_SUB( *T1 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( T2,  T2,    &P->Y ) );  MOD_SUB( *T2 );
 
     /* Special cases (2) and (3) */
-    if( mbedtls_mpi_cmp_int( &T1, 0 ) == 0 )
+    if( mbedtls_mpi_cmp_int( T1, 0 ) == 0 )
     {
-        if( mbedtls_mpi_cmp_int( &T2, 0 ) == 0 )
+        if( mbedtls_mpi_cmp_int( T2, 0 ) == 0 )
         {
-            ret = ecp_double_jac( grp, R, P );
+            ret = ecp_double_jac( grp, R, P, tmp );
             goto cleanup;
         }
         else
@@ -1075,28 +1520,25 @@ static int ecp_add_mixed( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
         }
     }
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &Z,   &P->Z,  &T1   ) );  MOD_MUL( Z  );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T3,  &T1,    &T1   ) );  MOD_MUL( T3 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T4,  &T3,    &T1   ) );  MOD_MUL( T4 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T3,  &T3,    &P->X ) );  MOD_MUL( T3 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( &T1,  &T3,    2     ) );  MOD_ADD( T1 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &X,   &T2,    &T2   ) );  MOD_MUL( X  );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &X,   &X,     &T1   ) );  MOD_SUB( X  );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &X,   &X,     &T4   ) );  MOD_SUB( X  );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T3,  &T3,    &X    ) );  MOD_SUB( T3 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T3,  &T3,    &T2   ) );  MOD_MUL( T3 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T4,  &T4,    &P->Y ) );  MOD_MUL( T4 );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &Y,   &T3,    &T4   ) );  MOD_SUB( Y  );
-
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->X, &X ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Y, &Y ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Z, &Z ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( Z,   &P->Z,  T1   ) );  MOD_MUL( *Z  );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T3,  T1,    T1   ) );  MOD_MUL( *T3 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T4,  T3,    T1   ) );  MOD_MUL( *T4 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T3,  T3,    &P->X ) );  MOD_MUL( *T3 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_int( T1,  T3,    2     ) );  MOD_ADD( *T1 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( X,   T2,    T2   ) );  MOD_MUL( *X  );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( X,   X,     T1   ) );  MOD_SUB( *X  );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( X,   X,     T4   ) );  MOD_SUB( *X  );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( T3,  T3,    X    ) );  MOD_SUB( *T3 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T3,  T3,    T2   ) );  MOD_MUL( *T3 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( T4,  T4,    &P->Y ) );  MOD_MUL( *T4 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( Y,   T3,    T4   ) );  MOD_SUB( *Y  );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->X, X ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Y, Y ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Z, Z ) );
 
 cleanup:
 
-    mbedtls_mpi_free( &T1 ); mbedtls_mpi_free( &T2 ); mbedtls_mpi_free( &T3 ); mbedtls_mpi_free( &T4 );
-    mbedtls_mpi_free( &X ); mbedtls_mpi_free( &Y ); mbedtls_mpi_free( &Z );
-
     return( ret );
 }
 
@@ -1108,10 +1550,11 @@ cleanup:
  * This countermeasure was first suggested in [2].
  */
 static int ecp_randomize_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *pt,
-                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+                mbedtls_mpi *tmp )
 {
     int ret;
-    mbedtls_mpi l, ll;
+    mbedtls_mpi *l = &tmp[0], *ll = &tmp[1];
     size_t p_size;
     int count = 0;
 
@@ -1123,34 +1566,32 @@ static int ecp_randomize_jac( const mbedtls_ecp_group *grp, mbedtls_ecp_point *p
 #endif /* MBEDTLS_ECP_RANDOMIZE_JAC_ALT */
 
     p_size = ( grp->pbits + 7 ) / 8;
-    mbedtls_mpi_init( &l ); mbedtls_mpi_init( &ll );
 
     /* Generate l such that 1 < l < p */
     do
     {
-        MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( &l, p_size, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( l, p_size, f_rng, p_rng ) );
 
-        while( mbedtls_mpi_cmp_mpi( &l, &grp->P ) >= 0 )
-            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &l, 1 ) );
+        while( mbedtls_mpi_cmp_mpi( l, &grp->P ) >= 0 )
+            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( l, 1 ) );
 
         if( count++ > 10 )
             return( MBEDTLS_ERR_ECP_RANDOM_FAILED );
     }
-    while( mbedtls_mpi_cmp_int( &l, 1 ) <= 0 );
+    while( mbedtls_mpi_cmp_int( l, 1 ) <= 0 );
 
     /* Z = l * Z */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Z,   &pt->Z,     &l  ) ); MOD_MUL( pt->Z );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Z,   &pt->Z,     l  ) ); MOD_MUL( pt->Z );
 
     /* X = l^2 * X */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ll,      &l,         &l  ) ); MOD_MUL( ll );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->X,   &pt->X,     &ll ) ); MOD_MUL( pt->X );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( ll,      l,         l  ) ); MOD_MUL( *ll );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->X,   &pt->X,     ll ) ); MOD_MUL( pt->X );
 
     /* Y = l^3 * Y */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ll,      &ll,        &l  ) ); MOD_MUL( ll );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Y,   &pt->Y,     &ll ) ); MOD_MUL( pt->Y );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( ll,      ll,        l  ) ); MOD_MUL( *ll );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &pt->Y,   &pt->Y,     ll ) ); MOD_MUL( pt->Y );
 
 cleanup:
-    mbedtls_mpi_free( &l ); mbedtls_mpi_free( &ll );
 
     return( ret );
 }
@@ -1168,6 +1609,12 @@ cleanup:
 /* number of precomputed points */
 #define COMB_MAX_PRE    ( 1 << ( MBEDTLS_ECP_WINDOW_SIZE - 1 ) )
 
+/*
+ * Window size of the static tables for G in ecp_curves.c, which does not
+ * depend on MBEDTLS_ECP_WINDOW_SIZE (see scripts/ecp_comb_table.py)
+ */
+#define ECP_COMB_STATIC_W( nbits )  ( ( nbits ) >= 384 ? 6 : 5 )
+
 /*
  * Compute the representation of m that will be used with our comb method.
  *
@@ -1230,50 +1677,126 @@ static void ecp_comb_fixed( unsigned char x[], size_t d,
  */
 static int ecp_precompute_comb( const mbedtls_ecp_group *grp,
                                 mbedtls_ecp_point T[], const mbedtls_ecp_point *P,
-                                unsigned char w, size_t d )
+                                unsigned char w, size_t d,
+                                mbedtls_ecp_restart_ctx *rs_ctx,
+                                mbedtls_mpi *tmp )
 {
     int ret;
-    unsigned char i, k;
-    size_t j;
+    unsigned char i;
+    size_t j = 0;
+    const unsigned char pre_len = 1U << ( w - 1 );
     mbedtls_ecp_point *cur, *TT[COMB_MAX_PRE - 1];
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+    {
+        if( rs_ctx->rsm->state == ecp_rsm_pre_dbl )
+            goto dbl;
+        if( rs_ctx->rsm->state == ecp_rsm_pre_norm_dbl )
+            goto norm_dbl;
+        if( rs_ctx->rsm->state == ecp_rsm_pre_add )
+            goto add;
+        if( rs_ctx->rsm->state == ecp_rsm_pre_norm_add )
+            goto norm_add;
+    }
+#else
+    (void) rs_ctx;
+#endif
+
     /*
      * Set T[0] = P and
      * T[2^{l-1}] = 2^{dl} P for l = 1 .. w-1 (this is not the final value)
      */
     MBEDTLS_MPI_CHK( mbedtls_ecp_copy( &T[0], P ) );
 
-    k = 0;
-    for( i = 1; i < ( 1U << ( w - 1 ) ); i <<= 1 )
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+    {
+        rs_ctx->rsm->state = ecp_rsm_pre_dbl;
+
+        /* initial state for the loop */
+        rs_ctx->rsm->i = 0;
+    }
+
+dbl:
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+        j = rs_ctx->rsm->i;
+#endif
+
+    /* The doublings are done in a single loop so that it can be resumed */
+    for( ; j < d * ( w - 1 ); j++ )
     {
+        MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_DBL );
+
+        i = 1U << ( j / d );
         cur = T + i;
-        MBEDTLS_MPI_CHK( mbedtls_ecp_copy( cur, T + ( i >> 1 ) ) );
-        for( j = 0; j < d; j++ )
-            MBEDTLS_MPI_CHK( ecp_double_jac( grp, cur, cur ) );
 
-        TT[k++] = cur;
+        if( j % d == 0 )
+            MBEDTLS_MPI_CHK( mbedtls_ecp_copy( cur, T + ( i >> 1 ) ) );
+
+        MBEDTLS_MPI_CHK( ecp_double_jac( grp, cur, cur, tmp ) );
     }
 
-    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, TT, k ) );
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+        rs_ctx->rsm->state = ecp_rsm_pre_norm_dbl;
+
+norm_dbl:
+#endif
+    j = 0;
+    for( i = 1; i < pre_len; i <<= 1 )
+        TT[j++] = T + i;
+
+    MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_INV + 6 * j - 2 );
 
+    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, TT, j, tmp ) );
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+        rs_ctx->rsm->state = ecp_rsm_pre_add;
+
+add:
+#endif
     /*
      * Compute the remaining ones using the minimal number of additions
      * Be careful to update T[2^l] only after using it!
      */
-    k = 0;
-    for( i = 1; i < ( 1U << ( w - 1 ) ); i <<= 1 )
+    MBEDTLS_ECP_BUDGET( ( pre_len - 1 ) * MBEDTLS_ECP_OPS_ADD );
+
+    for( i = 1; i < pre_len; i <<= 1 )
     {
         j = i;
         while( j-- )
-        {
-            MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &T[i + j], &T[j], &T[i] ) );
-            TT[k++] = &T[i + j];
-        }
+            MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &T[i + j], &T[j], &T[i], tmp ) );
     }
 
-    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, TT, k ) );
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+        rs_ctx->rsm->state = ecp_rsm_pre_norm_add;
+
+norm_add:
+#endif
+    /*
+     * Normalize final elements in T. Even though there are no holes now, we
+     * still need the auxiliary array for homogeneity with the previous
+     * call. Also, skip T[0] which is already normalised, being a copy of P.
+     */
+    for( j = 0; j + 1 < pre_len; j++ )
+        TT[j] = T + j + 1;
+
+    MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_INV + 6 * j - 2 );
+
+    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, TT, j, tmp ) );
 
 cleanup:
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL &&
+        ret == MBEDTLS_ERR_ECP_IN_PROGRESS )
+    {
+        if( rs_ctx->rsm->state == ecp_rsm_pre_dbl )
+            rs_ctx->rsm->i = j;
+    }
+#endif
 
     return( ret );
 }
@@ -1283,7 +1806,7 @@ cleanup:
  */
 static int ecp_select_comb( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
                             const mbedtls_ecp_point T[], unsigned char t_len,
-                            unsigned char i )
+                            unsigned char i, mbedtls_mpi *tmp )
 {
     int ret;
     unsigned char ii, j;
@@ -1299,7 +1822,7 @@ static int ecp_select_comb( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     }
 
     /* Safely invert result if i is "negative" */
-    MBEDTLS_MPI_CHK( ecp_safe_invert_jac( grp, R, i >> 7 ) );
+    MBEDTLS_MPI_CHK( ecp_safe_invert_jac( grp, R, i >> 7, tmp ) );
 
 cleanup:
     return( ret );
@@ -1315,7 +1838,8 @@ static int ecp_mul_comb_core( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R
                               const mbedtls_ecp_point T[], unsigned char t_len,
                               const unsigned char x[], size_t d,
                               int (*f_rng)(void *, unsigned char *, size_t),
-                              void *p_rng )
+                              void *p_rng, mbedtls_ecp_restart_ctx *rs_ctx,
+                              mbedtls_mpi *tmp )
 {
     int ret;
     mbedtls_ecp_point Txi;
@@ -1323,50 +1847,94 @@ static int ecp_mul_comb_core( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R
 
     mbedtls_ecp_point_init( &Txi );
 
-    /* Start with a non-zero point and randomize its coordinates */
-    i = d;
-    MBEDTLS_MPI_CHK( ecp_select_comb( grp, R, T, t_len, x[i] ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R->Z, 1 ) );
-    if( f_rng != 0 )
-        MBEDTLS_MPI_CHK( ecp_randomize_jac( grp, R, f_rng, p_rng ) );
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL &&
+        rs_ctx->rsm->state == ecp_rsm_comb_core )
+    {
+        /* restore current index (R already pointing to rs_ctx->rsm->R) */
+        i = rs_ctx->rsm->i;
+    }
+    else
+#else
+    (void) rs_ctx;
+#endif
+    {
+        /* Start with a non-zero point and randomize its coordinates */
+        i = d;
+        MBEDTLS_MPI_CHK( ecp_select_comb( grp, R, T, t_len, x[i], tmp ) );
+        MBEDTLS_MPI_CHK( ecp_set_one( grp, &R->Z ) );
+        if( f_rng != 0 )
+            MBEDTLS_MPI_CHK( ecp_randomize_jac( grp, R, f_rng, p_rng, tmp ) );
+    }
 
-    while( i-- != 0 )
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+        rs_ctx->rsm->state = ecp_rsm_comb_core;
+#endif
+
+    while( i != 0 )
     {
-        MBEDTLS_MPI_CHK( ecp_double_jac( grp, R, R ) );
-        MBEDTLS_MPI_CHK( ecp_select_comb( grp, &Txi, T, t_len, x[i] ) );
-        MBEDTLS_MPI_CHK( ecp_add_mixed( grp, R, R, &Txi ) );
+        MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_DBL + MBEDTLS_ECP_OPS_ADD );
+        --i;
+
+        MBEDTLS_MPI_CHK( ecp_double_jac( grp, R, R, tmp ) );
+        MBEDTLS_MPI_CHK( ecp_select_comb( grp, &Txi, T, t_len, x[i], tmp ) );
+        MBEDTLS_MPI_CHK( ecp_add_mixed( grp, R, R, &Txi, tmp ) );
     }
 
 cleanup:
 
     mbedtls_ecp_point_free( &Txi );
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL &&
+        ret == MBEDTLS_ERR_ECP_IN_PROGRESS )
+    {
+        rs_ctx->rsm->i = i;
+        /* no need to save R, already pointing to rs_ctx->rsm->R */
+    }
+#endif
+
     return( ret );
 }
 
 /*
  * Multiplication using the comb method,
  * for curves in short Weierstrass form
+ *
+ * Without normalize, R is left in Jacobian coordinates (and in Montgomery
+ * form if the group uses it) for ecp_normalize_jac_many() and ecp_point_out()
  */
 static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
                          const mbedtls_mpi *m, const mbedtls_ecp_point *P,
                          int (*f_rng)(void *, unsigned char *, size_t),
-                         void *p_rng )
+                         void *p_rng,
+                         mbedtls_ecp_restart_ctx *rs_ctx, int normalize )
 {
     int ret;
-    unsigned char w, m_is_odd, p_eq_g, pre_len, i;
+    unsigned char w, m_is_odd, p_eq_g, t_static, pre_len, T_ok, i;
     size_t d;
     unsigned char k[COMB_MAX_D + 1];
-    mbedtls_ecp_point *T;
+    mbedtls_ecp_point *T = NULL;
+    mbedtls_ecp_point *RR = R;
+    mbedtls_ecp_point Pm;
     mbedtls_mpi M, mm;
+    mbedtls_mpi tmp[ECP_TMP_LEN];
 
     mbedtls_mpi_init( &M );
     mbedtls_mpi_init( &mm );
+    mbedtls_ecp_point_init( &Pm );
 
     /* we need N to be odd to trnaform m in an odd number, check now */
     if( mbedtls_mpi_get_bit( &grp->N, 0 ) != 1 )
         return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    /* Work in the restart context, so that R may alias P between calls */
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+        RR = &rs_ctx->rsm->R;
+#endif
+
     /*
      * Minimize the number of multiplications, that is minimize
      * 10 * d * w + 18 * 2^(w-1) + 11 * d + 7 * w, with d = ceil( nbits / w )
@@ -1388,11 +1956,19 @@ static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     p_eq_g = 0;
 #endif
 
+    /*
+     * Groups loaded with mbedtls_ecp_group_load() come with a read-only
+     * table for G, whose size was fixed when it was generated.
+     */
+    t_static = ( p_eq_g && grp->T != NULL && grp->T_size == 0 );
+
     /*
      * Make sure w is within bounds.
      * (The last test is useful only for very small curves in the test suite.)
      */
-    if( w > MBEDTLS_ECP_WINDOW_SIZE )
+    if( t_static )
+        w = ECP_COMB_STATIC_W( grp->nbits );
+    if( w > MBEDTLS_ECP_WINDOW_SIZE && ! t_static )
         w = MBEDTLS_ECP_WINDOW_SIZE;
     if( w >= grp->nbits )
         w = 2;
@@ -1401,13 +1977,31 @@ static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     pre_len = 1U << ( w - 1 );
     d = ( grp->nbits + w - 1 ) / w;
 
+    MBEDTLS_MPI_CHK( ecp_tmp_init( grp, tmp ) );
+
     /*
      * Prepare precomputed points: if P == G we want to
      * use grp->T if already initialized, or initialize it.
      */
-    T = p_eq_g ? grp->T : NULL;
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL && rs_ctx->rsm->T != NULL )
+    {
+        /* transfer ownership of T from rsm to local function */
+        T = rs_ctx->rsm->T;
+        rs_ctx->rsm->T = NULL;
+        rs_ctx->rsm->T_size = 0;
 
-    if( T == NULL )
+        /* the table is complete once we reached the main loop */
+        T_ok = rs_ctx->rsm->state >= ecp_rsm_comb_core;
+    }
+    else
+#endif
+    if( p_eq_g && grp->T != NULL )
+    {
+        T = grp->T;
+        T_ok = 1;
+    }
+    else
     {
         T = mbedtls_calloc( pre_len, sizeof( mbedtls_ecp_point ) );
         if( T == NULL )
@@ -1416,9 +2010,20 @@ static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
             goto cleanup;
         }
 
-        MBEDTLS_MPI_CHK( ecp_precompute_comb( grp, T, P, w, d ) );
+        T_ok = 0;
+    }
+
+    if( ! T_ok )
+    {
+        if( ECP_MONT( grp ) )
+        {
+            MBEDTLS_MPI_CHK( ecp_point_to_mont( grp, &Pm, P ) );
+            P = &Pm;
+        }
+
+        MBEDTLS_MPI_CHK( ecp_precompute_comb( grp, T, P, w, d, rs_ctx, tmp ) );
 
-        if( p_eq_g )
+        if( p_eq_g && grp->T == NULL )
         {
             grp->T = T;
             grp->T_size = pre_len;
@@ -1434,21 +2039,61 @@ static int ecp_mul_comb( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &mm, &grp->N, m ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_assign( &M, &mm, ! m_is_odd ) );
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL &&
+        rs_ctx->rsm->state == ecp_rsm_final_norm )
+        goto final_norm;
+#endif
+
     /*
      * Go for comb multiplication, R = M * P
      */
     ecp_comb_fixed( k, d, w, &M );
-    MBEDTLS_MPI_CHK( ecp_mul_comb_core( grp, R, T, pre_len, k, d, f_rng, p_rng ) );
+    MBEDTLS_MPI_CHK( ecp_mul_comb_core( grp, RR, T, pre_len, k, d, f_rng, p_rng,
+                                        rs_ctx, tmp ) );
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+        rs_ctx->rsm->state = ecp_rsm_final_norm;
+
+final_norm:
+#endif
     /*
      * Now get m * P from M * P and normalize it
      */
-    MBEDTLS_MPI_CHK( ecp_safe_invert_jac( grp, R, ! m_is_odd ) );
-    MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, R ) );
+    MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_INV );
+    MBEDTLS_MPI_CHK( ecp_safe_invert_jac( grp, RR, ! m_is_odd, tmp ) );
+    if( normalize )
+        MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, RR, tmp ) );
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+        MBEDTLS_MPI_CHK( mbedtls_ecp_copy( R, RR ) );
+#endif
+
+    if( normalize && ECP_MONT( grp ) )
+        MBEDTLS_MPI_CHK( ecp_point_out( grp, R ) );
 
 cleanup:
 
-    if( T != NULL && ! p_eq_g )
+    /* does T belong to the group? */
+    if( T == grp->T )
+        T = NULL;
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    /* does T belong to the restart context? */
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL &&
+        ret == MBEDTLS_ERR_ECP_IN_PROGRESS && T != NULL )
+    {
+        /* transfer ownership of T from local function to rsm */
+        rs_ctx->rsm->T = T;
+        rs_ctx->rsm->T_size = pre_len;
+        T = NULL;
+    }
+#endif
+
+    /* did T belong to us? then let's destroy it! */
+    if( T != NULL )
     {
         for( i = 0; i < pre_len; i++ )
             mbedtls_ecp_point_free( &T[i] );
@@ -1457,6 +2102,284 @@ cleanup:
 
     mbedtls_mpi_free( &M );
     mbedtls_mpi_free( &mm );
+    mbedtls_ecp_point_free( &Pm );
+    ecp_tmp_free( tmp );
+
+    if( ret != 0 && ret != MBEDTLS_ERR_ECP_IN_PROGRESS )
+        mbedtls_ecp_point_free( R );
+
+    return( ret );
+}
+#if defined(ECP_SECP256K1_GLV)
+/*
+ * GLV method for secp256k1 (Gallant, Lambert, Vanstone, CRYPTO 2001)
+ *
+ * The map phi(x, y) = (beta x, y), where beta is a cube root of unity mod p,
+ * is an endomorphism of secp256k1 that acts on the group as multiplication
+ * by a cube root of unity lambda mod n. Any scalar splits as
+ * k = k1 + k2 lambda mod n with k1 and k2 about half as long as n, so that
+ * k P = k1 P + k2 phi(P) is a double multiplication with half-length
+ * scalars whose doublings can be shared, while phi(P) only costs one field
+ * multiplication.
+ *
+ * The split uses the short basis (a1, b1), (a2, b2) of the lattice of
+ * (x, y) with x + y lambda = 0 mod n found in the paper, with b2 = a1 and
+ * b1 < 0. To avoid a division, c1 = round(b2 k / n) and c2 = round(-b1 k / n)
+ * are computed as round(k g / 2^384) with g1 = round(2^384 b2 / n) and
+ * g2 = round(2^384 (-b1) / n), as in libsecp256k1. Then
+ * k1 = k - c1 a1 - c2 a2 and k2 = -c1 b1 - c2 b2 are less than 2^128 in
+ * absolute value.
+ */
+static const unsigned char glv_beta[] = {
+    0x7A, 0xE9, 0x6A, 0x2B, 0x65, 0x7C, 0x07, 0x10,
+    0x6E, 0x64, 0x47, 0x9E, 0xAC, 0x34, 0x34, 0xE9,
+    0x9C, 0xF0, 0x49, 0x75, 0x12, 0xF5, 0x89, 0x95,
+    0xC1, 0x39, 0x6C, 0x28, 0x71, 0x95, 0x01, 0xEE
+};
+static const unsigned char glv_a1[] = {
+    0x30, 0x86, 0xD2, 0x21, 0xA7, 0xD4, 0x6B, 0xCD,
+    0xE8, 0x6C, 0x90, 0xE4, 0x92, 0x84, 0xEB, 0x15
+};
+static const unsigned char glv_mb1[] = {
+    0xE4, 0x43, 0x7E, 0xD6, 0x01, 0x0E, 0x88, 0x28,
+    0x6F, 0x54, 0x7F, 0xA9, 0x0A, 0xBF, 0xE4, 0xC3
+};
+static const unsigned char glv_a2[] = {
+    0x01, 0x14, 0xCA, 0x50, 0xF7, 0xA8, 0xE2, 0xF3,
+    0xF6, 0x57, 0xC1, 0x10, 0x8D, 0x9D, 0x44, 0xCF,
+    0xD8
+};
+static const unsigned char glv_g1[] = {
+    0x30, 0x86, 0xD2, 0x21, 0xA7, 0xD4, 0x6B, 0xCD,
+    0xE8, 0x6C, 0x90, 0xE4, 0x92, 0x84, 0xEB, 0x15,
+    0x3D, 0xAA, 0x8A, 0x14, 0x71, 0xE8, 0xCA, 0x7F,
+    0xE8, 0x93, 0x20, 0x9A, 0x45, 0xDB, 0xB0, 0x31
+};
+static const unsigned char glv_g2[] = {
+    0xE4, 0x43, 0x7E, 0xD6, 0x01, 0x0E, 0x88, 0x28,
+    0x6F, 0x54, 0x7F, 0xA9, 0x0A, 0xBF, 0xE4, 0xC4,
+    0x22, 0x12, 0x08, 0xAC, 0x9D, 0xF5, 0x06, 0xC6,
+    0x15, 0x71, 0xB4, 0xAE, 0x8A, 0xC4, 0x7F, 0x71
+};
+
+/* Bit length of k1 and k2, plus one for making them odd in ecp_mul_glv() */
+#define ECP_GLV_BITS    129
+
+/*
+ * c = round( k g / 2^384 ) for g = glv_g1 or glv_g2
+ */
+static int ecp_glv_round( mbedtls_mpi *c, const mbedtls_mpi *k,
+                          const unsigned char *g, size_t g_len )
+{
+    int ret;
+    mbedtls_mpi G;
+    unsigned char half;
+
+    mbedtls_mpi_init( &G );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &G, g, g_len ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( c, k, &G ) );
+
+    half = mbedtls_mpi_get_bit( c, 383 );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( c, 384 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_int( c, c, half ) );
+
+cleanup:
+    mbedtls_mpi_free( &G );
+
+    return( ret );
+}
+
+/*
+ * Split 0 <= k < n as k = s1 k1 + s2 k2 lambda mod n, where k1, k2 >= 0 and
+ * s1, s2 = +-1 (with neg1, neg2 set if -1)
+ */
+static int ecp_glv_split( mbedtls_mpi *k1, int *neg1,
+                          mbedtls_mpi *k2, int *neg2, const mbedtls_mpi *k )
+{
+    int ret;
+    mbedtls_mpi c1, c2, C, t;
+
+    mbedtls_mpi_init( &c1 ); mbedtls_mpi_init( &c2 );
+    mbedtls_mpi_init( &C ); mbedtls_mpi_init( &t );
+
+    MBEDTLS_MPI_CHK( ecp_glv_round( &c1, k, glv_g1, sizeof( glv_g1 ) ) );
+    MBEDTLS_MPI_CHK( ecp_glv_round( &c2, k, glv_g2, sizeof( glv_g2 ) ) );
+
+    /* k1 = k - c1 a1 - c2 a2 */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &C, glv_a1, sizeof( glv_a1 ) ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, &c1, &C ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( k1, k, &t ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &C, glv_a2, sizeof( glv_a2 ) ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, &c2, &C ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( k1, k1, &t ) );
+
+    /* k2 = c1 (-b1) - c2 b2, with b2 = a1 */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &C, glv_mb1, sizeof( glv_mb1 ) ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( k2, &c1, &C ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &C, glv_a1, sizeof( glv_a1 ) ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &t, &c2, &C ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( k2, k2, &t ) );
+
+    *neg1 = ( mbedtls_mpi_cmp_int( k1, 0 ) < 0 );
+    *neg2 = ( mbedtls_mpi_cmp_int( k2, 0 ) < 0 );
+    k1->s = 1;
+    k2->s = 1;
+
+    /* Can't happen for 0 <= k < n, but the callers rely on it */
+    if( mbedtls_mpi_bitlen( k1 ) >= ECP_GLV_BITS ||
+        mbedtls_mpi_bitlen( k2 ) >= ECP_GLV_BITS )
+    {
+        ret = MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
+    }
+
+cleanup:
+    mbedtls_mpi_free( &c1 ); mbedtls_mpi_free( &c2 );
+    mbedtls_mpi_free( &C ); mbedtls_mpi_free( &t );
+
+    return( ret );
+}
+
+/*
+ * R = phi(P) = (beta X, Y, Z), which also holds in Jacobian coordinates
+ */
+static int ecp_glv_endo( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                         const mbedtls_ecp_point *P, const mbedtls_mpi *beta )
+{
+    int ret;
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( R, P ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &R->X, &R->X, beta ) );
+    MOD_MUL( R->X );
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * Multiplication R = m * P on secp256k1 with the GLV method, for points
+ * other than the generator (which has a static comb table already)
+ *
+ * Both half-length scalars use the comb method of ecp_mul_comb(), with the
+ * same d and w: the table for phi(P) is just phi applied to the table for P,
+ * and a single loop of d doublings adds one entry of each table per step.
+ * The signs of the split go into the sign bits of the comb digits. The comb
+ * representation needs odd scalars: even ones are incremented, and the
+ * extra P or phi(P) is subtracted at the end, in constant time.
+ *
+ * Cost: about half the doublings of ecp_mul_comb(), both in the
+ * precomputation and in the main loop, for the same number of additions.
+ * R is left in Jacobian coordinates without normalize, as there.
+ */
+static int ecp_mul_glv( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                        const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                        int (*f_rng)(void *, unsigned char *, size_t),
+                        void *p_rng, int normalize )
+{
+    int ret;
+    int neg[2];
+    unsigned char w, pre_len, odd[2], t;
+    size_t d, i;
+    unsigned char k[2][COMB_MAX_D + 1];
+    mbedtls_ecp_point *T[2] = { NULL, NULL };
+    mbedtls_ecp_point RR, Txi, C;
+    mbedtls_mpi K[2], beta;
+    mbedtls_mpi tmp[ECP_TMP_LEN];
+
+    w = MBEDTLS_ECP_WINDOW_SIZE < 5 ? MBEDTLS_ECP_WINDOW_SIZE : 5;
+    pre_len = 1U << ( w - 1 );
+    d = ( ECP_GLV_BITS + w - 1 ) / w;
+
+    mbedtls_ecp_point_init( &RR );
+    mbedtls_ecp_point_init( &Txi );
+    mbedtls_ecp_point_init( &C );
+    mbedtls_mpi_init( &K[0] ); mbedtls_mpi_init( &K[1] );
+    mbedtls_mpi_init( &beta );
+
+    MBEDTLS_MPI_CHK( ecp_tmp_init( grp, tmp ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &beta, glv_beta,
+                                              sizeof( glv_beta ) ) );
+
+    T[0] = mbedtls_calloc( 2 * pre_len, sizeof( mbedtls_ecp_point ) );
+    if( T[0] == NULL )
+    {
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        goto cleanup;
+    }
+    T[1] = T[0] + pre_len;
+
+    /* Tables for P and phi(P); T[0][0] = P and T[1][0] = phi(P) have Z = 1 */
+    MBEDTLS_MPI_CHK( ecp_precompute_comb( grp, T[0], P, w, d, NULL, tmp ) );
+    for( i = 0; i < pre_len; i++ )
+        MBEDTLS_MPI_CHK( ecp_glv_endo( grp, &T[1][i], &T[0][i], &beta ) );
+
+    /* m = s1 K1 + s2 K2 lambda, then make K1 and K2 odd */
+    MBEDTLS_MPI_CHK( ecp_glv_split( &K[0], &neg[0], &K[1], &neg[1], m ) );
+    for( t = 0; t < 2; t++ )
+    {
+        odd[t] = mbedtls_mpi_get_bit( &K[t], 0 );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_add_int( &K[t], &K[t], 1 - odd[t] ) );
+
+        ecp_comb_fixed( k[t], d, w, &K[t] );
+        for( i = 0; i <= d; i++ )
+            k[t][i] ^= (unsigned char) ( neg[t] << 7 );
+    }
+
+    /*
+     * Joint comb loop, as in ecp_mul_comb_core(). Txi.Z is never touched by
+     * ecp_select_comb(), so setting it once makes it a valid affine point.
+     */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &Txi.Z, 1 ) );
+
+    MBEDTLS_MPI_CHK( ecp_select_comb( grp, &RR, T[0], pre_len, k[0][d], tmp ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &RR.Z, 1 ) );
+    if( f_rng != 0 )
+        MBEDTLS_MPI_CHK( ecp_randomize_jac( grp, &RR, f_rng, p_rng, tmp ) );
+    MBEDTLS_MPI_CHK( ecp_select_comb( grp, &Txi, T[1], pre_len, k[1][d], tmp ) );
+    MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &RR, &RR, &Txi, tmp ) );
+
+    for( i = d; i-- > 0; )
+    {
+        MBEDTLS_MPI_CHK( ecp_double_jac( grp, &RR, &RR, tmp ) );
+
+        for( t = 0; t < 2; t++ )
+        {
+            MBEDTLS_MPI_CHK( ecp_select_comb( grp, &Txi, T[t], pre_len,
+                                              k[t][i], tmp ) );
+            MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &RR, &RR, &Txi, tmp ) );
+        }
+    }
+
+    /* Subtract s1 P if K1 was incremented, and s2 phi(P) if K2 was */
+    for( t = 0; t < 2; t++ )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_ecp_copy( &C, &T[t][0] ) );
+        MBEDTLS_MPI_CHK( ecp_safe_invert_jac( grp, &C, ! neg[t], tmp ) );
+        MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &Txi, &RR, &C, tmp ) );
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_assign( &RR.X, &Txi.X, ! odd[t] ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_assign( &RR.Y, &Txi.Y, ! odd[t] ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_assign( &RR.Z, &Txi.Z, ! odd[t] ) );
+    }
+
+    if( normalize )
+        MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, &RR, tmp ) );
+    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( R, &RR ) );
+
+cleanup:
+    if( T[0] != NULL )
+    {
+        for( i = 0; i < 2 * (size_t) pre_len; i++ )
+            mbedtls_ecp_point_free( &T[0][i] );
+        mbedtls_free( T[0] );
+    }
+
+    mbedtls_ecp_point_free( &RR );
+    mbedtls_ecp_point_free( &Txi );
+    mbedtls_ecp_point_free( &C );
+    mbedtls_mpi_free( &K[0] ); mbedtls_mpi_free( &K[1] );
+    mbedtls_mpi_free( &beta );
+    ecp_tmp_free( tmp );
 
     if( ret != 0 )
         mbedtls_ecp_point_free( R );
@@ -1464,6 +2387,408 @@ cleanup:
     return( ret );
 }
 
+/*
+ * Should R = m * P go through ecp_mul_glv()? The generator is better served
+ * by its static comb table, and restartable operations by ecp_mul_comb().
+ */
+static int ecp_mul_glv_ok( const mbedtls_ecp_group *grp,
+                           const mbedtls_ecp_point *P,
+                           const mbedtls_ecp_restart_ctx *rs_ctx )
+{
+    if( grp->id != MBEDTLS_ECP_DP_SECP256K1 )
+        return( 0 );
+
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+    if( mbedtls_mpi_cmp_mpi( &P->Y, &grp->G.Y ) == 0 &&
+        mbedtls_mpi_cmp_mpi( &P->X, &grp->G.X ) == 0 )
+        return( 0 );
+#else
+    (void) P;
+#endif
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+        return( 0 );
+#else
+    (void) rs_ctx;
+#endif
+
+    return( 1 );
+}
+#endif /* ECP_SECP256K1_GLV */
+
+/*
+ * Variable-time double-scalar multiplication R = m * P + n * Q, for
+ * public scalars only (signature verification).
+ *
+ * Both products are evaluated in a single Horner loop, so that they share
+ * their doublings (the Straus-Shamir trick, see GECC 3.48). Each scalar is
+ * written in width-w NAF (GECC 3.35) with a small table of odd multiples of
+ * its point, computed on the fly.
+ *
+ * When P is the generator and the group has a comb table for it (see
+ * ecp_mul_comb()), m uses the comb representation instead: its d + 1
+ * digits land on the low-order positions of the loop and every one of
+ * them is a single addition of an entry of the table, with no precomputation
+ * at all. The same goes for Q when the caller has a comb table for it (see
+ * mbedtls_ecp_keypair_precompute()).
+ *
+ * On secp256k1 with the GLV method, each wNAF scalar is split in two
+ * half-length ones (see ecp_glv_split()), the second one using phi applied
+ * to the table of the first one, which halves the number of doublings.
+ */
+
+/* Window size for the on-the-fly tables, and their maximum number of points */
+#define ECP_WNAF_W( nbits )     ( ( nbits ) >= 256 ? 5 : 4 )
+#define ECP_WNAF_MAX_PRE        ( 1 << ( 5 - 2 ) )
+
+/* Maximum number of wNAF scalars in the loop: one or two for each of m, n */
+#if defined(ECP_SECP256K1_GLV)
+#define ECP_WNAF_MAX_TERMS      4
+#else
+#define ECP_WNAF_MAX_TERMS      2
+#endif
+
+/*
+ * One wNAF scalar of the loop, with the table for its point and its sign
+ */
+typedef struct
+{
+    signed char naf[MBEDTLS_ECP_MAX_BITS + 1];  /*!< digits of the scalar   */
+    size_t len;                                 /*!< one past the last one  */
+    int neg;                                    /*!< negate every digit?    */
+    mbedtls_ecp_point T[ECP_WNAF_MAX_PRE];      /*!< (2i + 1) times point   */
+}
+ecp_wnaf_term;
+
+/*
+ * One comb scalar of the loop: the table for its point and its digits
+ */
+typedef struct
+{
+    const mbedtls_ecp_point *T;         /*!< table, see ecp_precompute_comb() */
+    size_t d;                           /*!< index of the last digit        */
+    int neg;                            /*!< digits are for N - k?          */
+    unsigned char k[COMB_MAX_D + 1];    /*!< see ecp_comb_fixed()           */
+}
+ecp_comb_term;
+
+/*
+ * Set up a comb term for k with a table of T_size points (0 for a static
+ * table of G). The comb representation needs an odd scalar (see
+ * ecp_mul_comb()), so use N - k if k is even.
+ */
+static int ecp_comb_prepare( const mbedtls_ecp_group *grp, ecp_comb_term *c,
+                             const mbedtls_ecp_point *T, size_t T_size,
+                             const mbedtls_mpi *k )
+{
+    int ret;
+    unsigned char w;
+    mbedtls_mpi K;
+
+    mbedtls_mpi_init( &K );
+
+    /* the table has 2^(w-1) points */
+    if( T_size == 0 )
+        w = ECP_COMB_STATIC_W( grp->nbits );
+    else
+        for( w = 1; ( 1U << ( w - 1 ) ) < T_size; w++ );
+
+    c->T = T;
+    c->d = ( grp->nbits + w - 1 ) / w;
+
+    c->neg = ( mbedtls_mpi_get_bit( k, 0 ) == 0 );
+    if( c->neg )
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &K, &grp->N, k ) );
+    else
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &K, k ) );
+
+    ecp_comb_fixed( c->k, c->d, w, &K );
+
+cleanup:
+    mbedtls_mpi_free( &K );
+
+    return( ret );
+}
+
+/*
+ * Width-w NAF of k >= 0: k = sum( naf[i] 2^i ) with each non-zero digit odd
+ * and less than 2^(w-1) in absolute value. naf must have room for
+ * bitlen(k) + 1 digits; *len is set to one past the last non-zero digit.
+ */
+static void ecp_wnaf( signed char naf[], size_t *len,
+                      const mbedtls_mpi *k, unsigned char w )
+{
+    size_t bits = mbedtls_mpi_bitlen( k ) + 1;
+    size_t i = 0, j, now;
+    int word, carry = 0;
+
+    memset( naf, 0, bits );
+    *len = 0;
+
+    while( i < bits )
+    {
+        if( (int) mbedtls_mpi_get_bit( k, i ) == carry )
+        {
+            i++;
+            continue;
+        }
+
+        now = w;
+        if( now > bits - i )
+            now = bits - i;
+
+        word = carry;
+        for( j = 0; j < now; j++ )
+            word += mbedtls_mpi_get_bit( k, i + j ) << j;
+
+        carry = ( word >> ( w - 1 ) ) & 1;
+        naf[i] = (signed char)( word - ( carry << w ) );
+
+        *len = i + 1;
+        i += now;
+    }
+}
+
+/*
+ * T[i] = (2i + 1) P for i < t_len, normalized; P must be normalized
+ */
+static int ecp_precompute_odd( const mbedtls_ecp_group *grp,
+                               mbedtls_ecp_point T[], size_t t_len,
+                               const mbedtls_ecp_point *P, mbedtls_mpi *tmp )
+{
+    int ret;
+    size_t i;
+    mbedtls_ecp_point P2;
+    mbedtls_ecp_point *TT[ECP_WNAF_MAX_PRE];
+
+    mbedtls_ecp_point_init( &P2 );
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( &T[0], P ) );
+
+    MBEDTLS_MPI_CHK( ecp_double_jac( grp, &P2, P, tmp ) );
+    MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, &P2, tmp ) );
+
+    for( i = 1; i < t_len; i++ )
+    {
+        MBEDTLS_MPI_CHK( ecp_add_mixed( grp, &T[i], &T[i-1], &P2, tmp ) );
+        TT[i-1] = &T[i];
+    }
+
+    MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, TT, t_len - 1, tmp ) );
+
+cleanup:
+    mbedtls_ecp_point_free( &P2 );
+
+    return( ret );
+}
+
+/*
+ * R += sign * T, where T is normalized and R is either zero or the result of
+ * previous additions and doublings (so that its Z is set); neg is a scratch
+ * point
+ */
+static int ecp_add_signed( const mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                           const mbedtls_ecp_point *T, int negate,
+                           mbedtls_ecp_point *neg, mbedtls_mpi *tmp )
+{
+    int ret;
+
+    if( negate )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &neg->X, &T->X ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &neg->Y, &grp->P, &T->Y ) );
+        T = neg;
+    }
+
+    /* ecp_add_mixed() would copy T as is, with its Z possibly unset */
+    if( mbedtls_mpi_cmp_int( &R->Z, 0 ) == 0 )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->X, &T->X ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &R->Y, &T->Y ) );
+        MBEDTLS_MPI_CHK( ecp_set_one( grp, &R->Z ) );
+    }
+    else
+    {
+        MBEDTLS_MPI_CHK( ecp_add_mixed( grp, R, R, T, tmp ) );
+    }
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * Add the terms for k P to the loop: the wNAF of k with the odd multiples of
+ * P or, with the GLV method, two half-length ones with the odd multiples of P
+ * and phi(P)
+ */
+static int ecp_wnaf_prepare( const mbedtls_ecp_group *grp,
+                             ecp_wnaf_term t[], size_t *terms,
+                             const mbedtls_mpi *k, const mbedtls_ecp_point *P,
+                             unsigned char w, mbedtls_mpi *tmp )
+{
+    int ret;
+    size_t t_len = (size_t) 1 << ( w - 2 );
+#if defined(ECP_SECP256K1_GLV)
+    size_t i;
+    mbedtls_mpi K1, K2, beta;
+
+    mbedtls_mpi_init( &K1 ); mbedtls_mpi_init( &K2 ); mbedtls_mpi_init( &beta );
+#endif
+
+    MBEDTLS_MPI_CHK( ecp_precompute_odd( grp, t[*terms].T, t_len, P, tmp ) );
+
+#if defined(ECP_SECP256K1_GLV)
+    if( grp->id == MBEDTLS_ECP_DP_SECP256K1 )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &beta, glv_beta,
+                                                  sizeof( glv_beta ) ) );
+        MBEDTLS_MPI_CHK( ecp_glv_split( &K1, &t[*terms].neg,
+                                        &K2, &t[*terms + 1].neg, k ) );
+
+        for( i = 0; i < t_len; i++ )
+            MBEDTLS_MPI_CHK( ecp_glv_endo( grp, &t[*terms + 1].T[i],
+                                           &t[*terms].T[i], &beta ) );
+
+        ecp_wnaf( t[*terms].naf, &t[*terms].len, &K1, w );
+        ecp_wnaf( t[*terms + 1].naf, &t[*terms + 1].len, &K2, w );
+        *terms += 2;
+        goto cleanup;
+    }
+#endif
+
+    t[*terms].neg = 0;
+    ecp_wnaf( t[*terms].naf, &t[*terms].len, k, w );
+    *terms += 1;
+
+cleanup:
+#if defined(ECP_SECP256K1_GLV)
+    mbedtls_mpi_free( &K1 ); mbedtls_mpi_free( &K2 ); mbedtls_mpi_free( &beta );
+#endif
+
+    return( ret );
+}
+
+/*
+ * Expects 0 < m, n < N and P, Q valid normalized points; TQ, if not NULL,
+ * is a comb table of TQ_size points for Q.
+ * Leaves R in Jacobian coordinates (and in Montgomery form if ECP_MONT()),
+ * so that callers computing several linear combinations can normalize them
+ * all with a single inversion before ecp_point_out().
+ */
+static int ecp_muladd_wnaf( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+                            const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                            const mbedtls_mpi *n, const mbedtls_ecp_point *Q,
+                            const mbedtls_ecp_point *TQ, size_t TQ_size,
+                            mbedtls_mpi tmp[] )
+{
+    int ret;
+    unsigned char w;
+    size_t i, j, top = 0, terms = 0, combs = 0;
+    signed char digit;
+    ecp_wnaf_term *t;
+    ecp_comb_term c[2];
+    mbedtls_ecp_point RR, neg, Pm, Qm;
+
+    w = ECP_WNAF_W( grp->nbits );
+
+    /* Too big for the stack of small targets */
+    t = mbedtls_calloc( ECP_WNAF_MAX_TERMS, sizeof( ecp_wnaf_term ) );
+    if( t == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    for( i = 0; i < ECP_WNAF_MAX_TERMS; i++ )
+        for( j = 0; j < ECP_WNAF_MAX_PRE; j++ )
+            mbedtls_ecp_point_init( &t[i].T[j] );
+    mbedtls_ecp_point_init( &RR );
+    mbedtls_ecp_point_init( &neg );
+    mbedtls_ecp_point_init( &Pm );
+    mbedtls_ecp_point_init( &Qm );
+
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+    if( grp->T != NULL &&
+        mbedtls_mpi_cmp_mpi( &P->Y, &grp->G.Y ) == 0 &&
+        mbedtls_mpi_cmp_mpi( &P->X, &grp->G.X ) == 0 )
+    {
+        MBEDTLS_MPI_CHK( ecp_comb_prepare( grp, &c[combs++],
+                                           grp->T, grp->T_size, m ) );
+    }
+    else
+#endif
+    {
+        if( ECP_MONT( grp ) )
+        {
+            MBEDTLS_MPI_CHK( ecp_point_to_mont( grp, &Pm, P ) );
+            P = &Pm;
+        }
+
+        MBEDTLS_MPI_CHK( ecp_wnaf_prepare( grp, t, &terms, m, P, w, tmp ) );
+    }
+
+    if( TQ != NULL )
+        MBEDTLS_MPI_CHK( ecp_comb_prepare( grp, &c[combs++], TQ, TQ_size, n ) );
+    else
+    {
+        if( ECP_MONT( grp ) )
+        {
+            MBEDTLS_MPI_CHK( ecp_point_to_mont( grp, &Qm, Q ) );
+            Q = &Qm;
+        }
+
+        MBEDTLS_MPI_CHK( ecp_wnaf_prepare( grp, t, &terms, n, Q, w, tmp ) );
+    }
+
+    for( j = 0; j < combs; j++ )
+        if( c[j].d + 1 > top )
+            top = c[j].d + 1;
+
+    for( j = 0; j < terms; j++ )
+        if( t[j].len > top )
+            top = t[j].len;
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_set_zero( &RR ) );
+
+    for( i = top; i-- > 0; )
+    {
+        if( mbedtls_mpi_cmp_int( &RR.Z, 0 ) != 0 )
+            MBEDTLS_MPI_CHK( ecp_double_jac( grp, &RR, &RR, tmp ) );
+
+        for( j = 0; j < combs; j++ )
+        {
+            if( i > c[j].d )
+                continue;
+
+            MBEDTLS_MPI_CHK( ecp_add_signed( grp, &RR,
+                                 &c[j].T[( c[j].k[i] & 0x7F ) >> 1],
+                                 ( c[j].k[i] >> 7 ) ^ c[j].neg, &neg, tmp ) );
+        }
+
+        for( j = 0; j < terms; j++ )
+        {
+            if( i >= t[j].len || ( digit = t[j].naf[i] ) == 0 )
+                continue;
+
+            MBEDTLS_MPI_CHK( ecp_add_signed( grp, &RR,
+                                 &t[j].T[( digit < 0 ? -digit : digit ) >> 1],
+                                 ( digit < 0 ) ^ t[j].neg, &neg, tmp ) );
+        }
+    }
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( R, &RR ) );
+
+cleanup:
+    for( i = 0; i < ECP_WNAF_MAX_TERMS; i++ )
+        for( j = 0; j < ECP_WNAF_MAX_PRE; j++ )
+            mbedtls_ecp_point_free( &t[i].T[j] );
+    mbedtls_free( t );
+    mbedtls_ecp_point_free( &RR );
+    mbedtls_ecp_point_free( &neg );
+    mbedtls_ecp_point_free( &Pm );
+    mbedtls_ecp_point_free( &Qm );
+
+    return( ret );
+}
+
 #endif /* ECP_SHORTWEIERSTRASS */
 
 #if defined(ECP_MONTGOMERY)
@@ -1507,10 +2832,11 @@ cleanup:
  * Cost: 2M
  */
 static int ecp_randomize_mxz( const mbedtls_ecp_group *grp, mbedtls_ecp_point *P,
-                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+                int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+                mbedtls_mpi *tmp )
 {
     int ret;
-    mbedtls_mpi l;
+    mbedtls_mpi *l = &tmp[0];
     size_t p_size;
     int count = 0;
 
@@ -1522,26 +2848,24 @@ static int ecp_randomize_mxz( const mbedtls_ecp_group *grp, mbedtls_ecp_point *P
 #endif /* MBEDTLS_ECP_RANDOMIZE_MXZ_ALT */
 
     p_size = ( grp->pbits + 7 ) / 8;
-    mbedtls_mpi_init( &l );
 
     /* Generate l such that 1 < l < p */
     do
     {
-        MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( &l, p_size, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( l, p_size, f_rng, p_rng ) );
 
-        while( mbedtls_mpi_cmp_mpi( &l, &grp->P ) >= 0 )
-            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &l, 1 ) );
+        while( mbedtls_mpi_cmp_mpi( l, &grp->P ) >= 0 )
+            MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( l, 1 ) );
 
         if( count++ > 10 )
             return( MBEDTLS_ERR_ECP_RANDOM_FAILED );
     }
-    while( mbedtls_mpi_cmp_int( &l, 1 ) <= 0 );
+    while( mbedtls_mpi_cmp_int( l, 1 ) <= 0 );
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &P->X, &P->X, &l ) ); MOD_MUL( P->X );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &P->Z, &P->Z, &l ) ); MOD_MUL( P->Z );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &P->X, &P->X, l ) ); MOD_MUL( P->X );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &P->Z, &P->Z, l ) ); MOD_MUL( P->Z );
 
 cleanup:
-    mbedtls_mpi_free( &l );
 
     return( ret );
 }
@@ -1564,10 +2888,12 @@ cleanup:
 static int ecp_double_add_mxz( const mbedtls_ecp_group *grp,
                                mbedtls_ecp_point *R, mbedtls_ecp_point *S,
                                const mbedtls_ecp_point *P, const mbedtls_ecp_point *Q,
-                               const mbedtls_mpi *d )
+                               const mbedtls_mpi *d, mbedtls_mpi *tmp )
 {
     int ret;
-    mbedtls_mpi A, AA, B, BB, E, C, D, DA, CB;
+    mbedtls_mpi *A = &tmp[0], *AA = &tmp[1], *B = &tmp[2];
+    mbedtls_mpi *BB = &tmp[3], *E = &tmp[4], *C = &tmp[5];
+    mbedtls_mpi *D = &tmp[6], *DA = &tmp[7], *CB = &tmp[8];
 
 #if defined(MBEDTLS_ECP_DOUBLE_ADD_MXZ_ALT)
     if ( mbedtls_internal_ecp_grp_capable( grp ) )
@@ -1576,33 +2902,26 @@ static int ecp_double_add_mxz( const mbedtls_ecp_group *grp,
     }
 #endif /* MBEDTLS_ECP_DOUBLE_ADD_MXZ_ALT */
 
-    mbedtls_mpi_init( &A ); mbedtls_mpi_init( &AA ); mbedtls_mpi_init( &B );
-    mbedtls_mpi_init( &BB ); mbedtls_mpi_init( &E ); mbedtls_mpi_init( &C );
-    mbedtls_mpi_init( &D ); mbedtls_mpi_init( &DA ); mbedtls_mpi_init( &CB );
-
-    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &A,    &P->X,   &P->Z ) ); MOD_ADD( A    );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &AA,   &A,      &A    ) ); MOD_MUL( AA   );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &B,    &P->X,   &P->Z ) ); MOD_SUB( B    );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &BB,   &B,      &B    ) ); MOD_MUL( BB   );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &E,    &AA,     &BB   ) ); MOD_SUB( E    );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &C,    &Q->X,   &Q->Z ) ); MOD_ADD( C    );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &D,    &Q->X,   &Q->Z ) ); MOD_SUB( D    );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &DA,   &D,      &A    ) ); MOD_MUL( DA   );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &CB,   &C,      &B    ) ); MOD_MUL( CB   );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &S->X, &DA,     &CB   ) ); MOD_MUL( S->X );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( A,    &P->X,   &P->Z ) ); MOD_ADD( *A    );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( AA,   A,      A    ) ); MOD_MUL( *AA   );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( B,    &P->X,   &P->Z ) ); MOD_SUB( *B    );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( BB,   B,      B    ) ); MOD_MUL( *BB   );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( E,    AA,     BB   ) ); MOD_SUB( *E    );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( C,    &Q->X,   &Q->Z ) ); MOD_ADD( *C    );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( D,    &Q->X,   &Q->Z ) ); MOD_SUB( *D    );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( DA,   D,      A    ) ); MOD_MUL( *DA   );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( CB,   C,      B    ) ); MOD_MUL( *CB   );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &S->X, DA,     CB   ) ); MOD_MUL( S->X );
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S->X, &S->X,   &S->X ) ); MOD_MUL( S->X );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &S->Z, &DA,     &CB   ) ); MOD_SUB( S->Z );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &S->Z, DA,     CB   ) ); MOD_SUB( S->Z );
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S->Z, &S->Z,   &S->Z ) ); MOD_MUL( S->Z );
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &S->Z, d,       &S->Z ) ); MOD_MUL( S->Z );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &R->X, &AA,     &BB   ) ); MOD_MUL( R->X );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &R->Z, &grp->A, &E    ) ); MOD_MUL( R->Z );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &R->Z, &BB,     &R->Z ) ); MOD_ADD( R->Z );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &R->Z, &E,      &R->Z ) ); MOD_MUL( R->Z );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &R->X, AA,     BB   ) ); MOD_MUL( R->X );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &R->Z, &grp->A, E    ) ); MOD_MUL( R->Z );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &R->Z, BB,     &R->Z ) ); MOD_ADD( R->Z );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &R->Z, E,      &R->Z ) ); MOD_MUL( R->Z );
 
 cleanup:
-    mbedtls_mpi_free( &A ); mbedtls_mpi_free( &AA ); mbedtls_mpi_free( &B );
-    mbedtls_mpi_free( &BB ); mbedtls_mpi_free( &E ); mbedtls_mpi_free( &C );
-    mbedtls_mpi_free( &D ); mbedtls_mpi_free( &DA ); mbedtls_mpi_free( &CB );
 
     return( ret );
 }
@@ -1614,36 +2933,71 @@ cleanup:
 static int ecp_mul_mxz( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
                         const mbedtls_mpi *m, const mbedtls_ecp_point *P,
                         int (*f_rng)(void *, unsigned char *, size_t),
-                        void *p_rng )
+                        void *p_rng,
+                        mbedtls_ecp_restart_ctx *rs_ctx )
 {
     int ret;
-    size_t i;
+    size_t i = 0;
     unsigned char b;
     mbedtls_ecp_point RP;
+    mbedtls_ecp_point *RR = R, *pRP = &RP;
     mbedtls_mpi PX;
+    mbedtls_mpi tmp[ECP_TMP_LEN];
 
     mbedtls_ecp_point_init( &RP ); mbedtls_mpi_init( &PX );
+    MBEDTLS_MPI_CHK( ecp_tmp_init( grp, tmp ) );
 
     /* Save PX and read from P before writing to R, in case P == R */
     MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &PX, &P->X ) );
-    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( &RP, P ) );
 
-    /* Set R to zero in modified x/z coordinates */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R->X, 1 ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R->Z, 0 ) );
-    mbedtls_mpi_free( &R->Y );
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    /* Keep the state of the ladder in the restart context */
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+    {
+        RR = &rs_ctx->rsm->R;
+        pRP = &rs_ctx->rsm->RP;
+    }
 
-    /* RP.X might be sligtly larger than P, so reduce it */
-    MOD_ADD( RP.X );
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL &&
+        rs_ctx->rsm->state == ecp_rsm_ladder )
+    {
+        i = rs_ctx->rsm->i;
+    }
+    else
+#else
+    (void) rs_ctx;
+#endif
+    {
+        MBEDTLS_MPI_CHK( mbedtls_ecp_copy( pRP, P ) );
 
-    /* Randomize coordinates of the starting point */
-    if( f_rng != NULL )
-        MBEDTLS_MPI_CHK( ecp_randomize_mxz( grp, &RP, f_rng, p_rng ) );
+        /* Set R to zero in modified x/z coordinates */
+        MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &RR->X, 1 ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &RR->Z, 0 ) );
+        mbedtls_mpi_free( &RR->Y );
+
+        /* RP.X might be sligtly larger than P, so reduce it */
+        MOD_ADD( pRP->X );
+
+        /* Randomize coordinates of the starting point */
+        if( f_rng != NULL )
+            MBEDTLS_MPI_CHK( ecp_randomize_mxz( grp, pRP, f_rng, p_rng, tmp ) );
+
+        i = mbedtls_mpi_bitlen( m ); /* one past the (zero-based) most significant bit */
+    }
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+        rs_ctx->rsm->state = ecp_rsm_ladder;
+#endif
 
     /* Loop invariant: R = result so far, RP = R + P */
-    i = mbedtls_mpi_bitlen( m ); /* one past the (zero-based) most significant bit */
-    while( i-- > 0 )
+    while( i > 0 )
     {
+        /* One ladder step costs about as much as a doubling and an addition
+         * in Jacobian coordinates */
+        MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_ADD );
+        i--;
+
         b = mbedtls_mpi_get_bit( m, i );
         /*
          *  if (b) R = 2R + P else R = 2R,
@@ -1652,17 +3006,30 @@ static int ecp_mul_mxz( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
          *  else   double_add( R, RP, R, RP )
          * but using safe conditional swaps to avoid leaks
          */
-        MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_swap( &R->X, &RP.X, b ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_swap( &R->Z, &RP.Z, b ) );
-        MBEDTLS_MPI_CHK( ecp_double_add_mxz( grp, R, &RP, R, &RP, &PX ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_swap( &R->X, &RP.X, b ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_swap( &R->Z, &RP.Z, b ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_swap( &RR->X, &pRP->X, b ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_swap( &RR->Z, &pRP->Z, b ) );
+        MBEDTLS_MPI_CHK( ecp_double_add_mxz( grp, RR, pRP, RR, pRP, &PX, tmp ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_swap( &RR->X, &pRP->X, b ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_safe_cond_swap( &RR->Z, &pRP->Z, b ) );
     }
 
-    MBEDTLS_MPI_CHK( ecp_normalize_mxz( grp, R ) );
+    MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_INV );
+    MBEDTLS_MPI_CHK( ecp_normalize_mxz( grp, RR ) );
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL )
+        MBEDTLS_MPI_CHK( mbedtls_ecp_copy( R, RR ) );
+#endif
 
 cleanup:
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL &&
+        ret == MBEDTLS_ERR_ECP_IN_PROGRESS )
+        rs_ctx->rsm->i = i;
+#endif
+
     mbedtls_ecp_point_free( &RP ); mbedtls_mpi_free( &PX );
+    ecp_tmp_free( tmp );
 
     return( ret );
 }
@@ -1670,11 +3037,12 @@ cleanup:
 #endif /* ECP_MONTGOMERY */
 
 /*
- * Multiplication R = m * P
+ * Restartable multiplication R = m * P
  */
-int mbedtls_ecp_mul( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+int mbedtls_ecp_mul_restartable( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
              const mbedtls_mpi *m, const mbedtls_ecp_point *P,
-             int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+             int (*f_rng)(void *, unsigned char *, size_t), void *p_rng,
+             mbedtls_ecp_restart_ctx *rs_ctx )
 {
     int ret = MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
 #if defined(MBEDTLS_ECP_INTERNAL_ALT)
@@ -1685,9 +3053,37 @@ int mbedtls_ecp_mul( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     if( mbedtls_mpi_cmp_int( &P->Z, 1 ) != 0 )
         return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
 
-    if( ( ret = mbedtls_ecp_check_privkey( grp, m ) ) != 0 ||
-        ( ret = mbedtls_ecp_check_pubkey( grp, P ) ) != 0 )
-        return( ret );
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    /* reset ops count for this call if top-level */
+    if( rs_ctx != NULL && rs_ctx->depth++ == 0 )
+        rs_ctx->ops_done = 0;
+
+    /* skip argument check when restarting */
+    if( rs_ctx == NULL || rs_ctx->rsm == NULL )
+#endif
+    {
+        /* check_privkey is free */
+        MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_CHK );
+
+        MBEDTLS_MPI_CHK( mbedtls_ecp_check_privkey( grp, m ) );
+        MBEDTLS_MPI_CHK( mbedtls_ecp_check_pubkey( grp, P ) );
+    }
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    /* set up our own sub-context if needed */
+    if( mbedtls_ecp_restart_is_enabled() &&
+        rs_ctx != NULL && rs_ctx->rsm == NULL )
+    {
+        rs_ctx->rsm = mbedtls_calloc( 1, sizeof( *rs_ctx->rsm ) );
+        if( rs_ctx->rsm == NULL )
+        {
+            ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+            goto cleanup;
+        }
+
+        ecp_restart_rsm_init( rs_ctx->rsm );
+    }
+#endif
 
 #if defined(MBEDTLS_ECP_INTERNAL_ALT)
     if ( is_grp_capable = mbedtls_internal_ecp_grp_capable( grp )  )
@@ -1697,25 +3093,209 @@ int mbedtls_ecp_mul( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
 
 #endif /* MBEDTLS_ECP_INTERNAL_ALT */
 #if defined(ECP_MONTGOMERY)
-    if( ecp_get_type( grp ) == ECP_TYPE_MONTGOMERY )
-        ret = ecp_mul_mxz( grp, R, m, P, f_rng, p_rng );
+    if( ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_MONTGOMERY )
+    {
+#if defined(ECP_X25519_FAST)
+        if( grp->id == MBEDTLS_ECP_DP_CURVE25519
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+            && !is_grp_capable
+#endif
+          )
+            ret = mbedtls_ecp_x25519_mul( R, m, P );
+        else
+#endif
+#if defined(ECP_X448_FAST)
+        if( grp->id == MBEDTLS_ECP_DP_CURVE448
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+            && !is_grp_capable
+#endif
+          )
+            ret = mbedtls_ecp_x448_mul( R, m, P );
+        else
+#endif
+        ret = ecp_mul_mxz( grp, R, m, P, f_rng, p_rng, rs_ctx );
+    }
+
+#endif
+#if defined(ECP_SHORTWEIERSTRASS)
+    if( ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS )
+    {
+#if defined(ECP_P256_FAST)
+        if( grp->id == MBEDTLS_ECP_DP_SECP256R1
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+            && !is_grp_capable
+#endif
+          )
+            ret = mbedtls_ecp_p256_mul( R, m, P );
+        else
+#endif
+#if defined(ECP_P384_FAST)
+        if( grp->id == MBEDTLS_ECP_DP_SECP384R1
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+            && ( rs_ctx == NULL || rs_ctx->rsm == NULL )
+#endif
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+            && !is_grp_capable
+#endif
+          )
+            ret = mbedtls_ecp_p384_mul( R, m, P );
+        else
+#endif
+#if defined(ECP_SECP256K1_GLV)
+        if( ecp_mul_glv_ok( grp, P, rs_ctx )
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+            && !is_grp_capable
+#endif
+          )
+            ret = ecp_mul_glv( grp, R, m, P, f_rng, p_rng, 1 );
+        else
+#endif
+        ret = ecp_mul_comb( grp, R, m, P, f_rng, p_rng, rs_ctx, 1 );
+    }
+
+#endif
+cleanup:
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if ( is_grp_capable )
+    {
+        mbedtls_internal_ecp_free( grp );
+    }
+
+#endif /* MBEDTLS_ECP_INTERNAL_ALT */
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    /* free our sub-context when done */
+    if( rs_ctx != NULL && rs_ctx->rsm != NULL &&
+        ret != MBEDTLS_ERR_ECP_IN_PROGRESS )
+    {
+        ecp_restart_rsm_free( rs_ctx->rsm );
+        mbedtls_free( rs_ctx->rsm );
+        rs_ctx->rsm = NULL;
+    }
+
+    if( rs_ctx != NULL )
+        rs_ctx->depth--;
+#else
+    (void) rs_ctx;
+#endif
+
+    return( ret );
+}
+
+/*
+ * Multiplication R = m * P
+ */
+int mbedtls_ecp_mul( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+             int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+{
+    return( mbedtls_ecp_mul_restartable( grp, R, m, P, f_rng, p_rng, NULL ) );
+}
+
+#if defined(ECP_SHORTWEIERSTRASS)
+/*
+ * Several multiplications R[i] = m[i] * P[i] on a short Weierstrass curve,
+ * sharing the final inversion
+ */
+static int ecp_mul_batch_sw( mbedtls_ecp_group *grp, mbedtls_ecp_point R[],
+             const mbedtls_mpi m[], const mbedtls_ecp_point *P[],
+             size_t count,
+             int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+{
+    int ret;
+    size_t i, t_len = 0;
+    mbedtls_ecp_point **T = NULL;
+    mbedtls_mpi tmp[ECP_TMP_LEN];
+
+    /* Same checks as mbedtls_ecp_mul(), before any result is written */
+    for( i = 0; i < count; i++ )
+    {
+        if( mbedtls_mpi_cmp_int( &P[i]->Z, 1 ) != 0 )
+            return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+        if( ( ret = mbedtls_ecp_check_privkey( grp, &m[i] ) ) != 0 ||
+            ( ret = mbedtls_ecp_check_pubkey( grp, P[i] ) ) != 0 )
+            return( ret );
+    }
+
+#if defined(ECP_P256_FAST)
+    if( grp->id == MBEDTLS_ECP_DP_SECP256R1 )
+        return( mbedtls_ecp_p256_mul_batch( R, m, P, count ) );
+#endif
+#if defined(ECP_P384_FAST)
+    if( grp->id == MBEDTLS_ECP_DP_SECP384R1 )
+        return( mbedtls_ecp_p384_mul_batch( R, m, P, count ) );
+#endif
+
+    MBEDTLS_MPI_CHK( ecp_tmp_init( grp, tmp ) );
+
+    T = mbedtls_calloc( count, sizeof( mbedtls_ecp_point * ) );
+    if( T == NULL )
+    {
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    for( i = 0; i < count; i++ )
+    {
+#if defined(ECP_SECP256K1_GLV)
+        if( ecp_mul_glv_ok( grp, P[i], NULL ) )
+            MBEDTLS_MPI_CHK( ecp_mul_glv( grp, &R[i], &m[i], P[i],
+                                          f_rng, p_rng, 0 ) );
+        else
+#endif
+        MBEDTLS_MPI_CHK( ecp_mul_comb( grp, &R[i], &m[i], P[i],
+                                       f_rng, p_rng, NULL, 0 ) );
+
+        if( ! mbedtls_ecp_is_zero( &R[i] ) )
+            T[t_len++] = &R[i];
+    }
+
+    if( t_len > 0 )
+        MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, T, t_len, tmp ) );
+    for( i = 0; i < t_len; i++ )
+        MBEDTLS_MPI_CHK( ecp_point_out( grp, T[i] ) );
+
+cleanup:
+    mbedtls_free( T );
+    ecp_tmp_free( tmp );
+
+    return( ret );
+}
+#endif /* ECP_SHORTWEIERSTRASS */
+
+/*
+ * Several multiplications R[i] = m[i] * P[i]
+ */
+int mbedtls_ecp_mul_batch( mbedtls_ecp_group *grp, mbedtls_ecp_point R[],
+             const mbedtls_mpi m[], const mbedtls_ecp_point *P[],
+             size_t count,
+             int (*f_rng)(void *, unsigned char *, size_t), void *p_rng )
+{
+    int ret;
+    size_t i;
 
-#endif
 #if defined(ECP_SHORTWEIERSTRASS)
-    if( ecp_get_type( grp ) == ECP_TYPE_SHORT_WEIERSTRASS )
-        ret = ecp_mul_comb( grp, R, m, P, f_rng, p_rng );
-
-#endif
+    if( count > 1 &&
+        ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS
 #if defined(MBEDTLS_ECP_INTERNAL_ALT)
-cleanup:
+        && ! mbedtls_internal_ecp_grp_capable( grp )
+#endif
+      )
+        return( ecp_mul_batch_sw( grp, R, m, P, count, f_rng, p_rng ) );
+#endif
 
-    if ( is_grp_capable )
+    /*
+     * The x-only ladders of Montgomery curves have no Z to share, and
+     * alternative implementations normalize on their own
+     */
+    for( i = 0; i < count; i++ )
     {
-        mbedtls_internal_ecp_free( grp );
+        if( ( ret = mbedtls_ecp_mul( grp, &R[i], &m[i], P[i],
+                                     f_rng, p_rng ) ) != 0 )
+            return( ret );
     }
 
-#endif /* MBEDTLS_ECP_INTERNAL_ALT */
-    return( ret );
+    return( 0 );
 }
 
 #if defined(ECP_SHORTWEIERSTRASS)
@@ -1727,6 +3307,7 @@ static int ecp_check_pubkey_sw( const mbedtls_ecp_group *grp, const mbedtls_ecp_
 {
     int ret;
     mbedtls_mpi YY, RHS;
+    mbedtls_ecp_point ptm;
 
     /* pt coordinates must be normalized for our checks */
     if( mbedtls_mpi_cmp_int( &pt->X, 0 ) < 0 ||
@@ -1736,6 +3317,13 @@ static int ecp_check_pubkey_sw( const mbedtls_ecp_group *grp, const mbedtls_ecp_
         return( MBEDTLS_ERR_ECP_INVALID_KEY );
 
     mbedtls_mpi_init( &YY ); mbedtls_mpi_init( &RHS );
+    mbedtls_ecp_point_init( &ptm );
+
+    if( ECP_MONT( grp ) )
+    {
+        MBEDTLS_MPI_CHK( ecp_point_to_mont( grp, &ptm, pt ) );
+        pt = &ptm;
+    }
 
     /*
      * YY = Y^2
@@ -1744,8 +3332,12 @@ static int ecp_check_pubkey_sw( const mbedtls_ecp_group *grp, const mbedtls_ecp_
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &YY,  &pt->Y,   &pt->Y  ) );  MOD_MUL( YY  );
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &RHS, &pt->X,   &pt->X  ) );  MOD_MUL( RHS );
 
-    /* Special case for A = -3 */
-    if( grp->A.p == NULL )
+    /* Special case for A = -3, unless it is there in Montgomery form */
+    if( ECP_MONT( grp ) )
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &RHS, &RHS, &grp->mont_A ) );  MOD_ADD( RHS );
+    }
+    else if( grp->A.p == NULL )
     {
         MBEDTLS_MPI_CHK( mbedtls_mpi_sub_int( &RHS, &RHS, 3       ) );  MOD_SUB( RHS );
     }
@@ -1755,7 +3347,8 @@ static int ecp_check_pubkey_sw( const mbedtls_ecp_group *grp, const mbedtls_ecp_
     }
 
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &RHS, &RHS,     &pt->X  ) );  MOD_MUL( RHS );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &RHS, &RHS,     &grp->B ) );  MOD_ADD( RHS );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &RHS, &RHS,
+                     ECP_MONT( grp ) ? &grp->mont_B : &grp->B ) );     MOD_ADD( RHS );
 
     if( mbedtls_mpi_cmp_mpi( &YY, &RHS ) != 0 )
         ret = MBEDTLS_ERR_ECP_INVALID_KEY;
@@ -1763,6 +3356,7 @@ static int ecp_check_pubkey_sw( const mbedtls_ecp_group *grp, const mbedtls_ecp_
 cleanup:
 
     mbedtls_mpi_free( &YY ); mbedtls_mpi_free( &RHS );
+    mbedtls_ecp_point_free( &ptm );
 
     return( ret );
 }
@@ -1775,7 +3369,8 @@ cleanup:
 static int mbedtls_ecp_mul_shortcuts( mbedtls_ecp_group *grp,
                                       mbedtls_ecp_point *R,
                                       const mbedtls_mpi *m,
-                                      const mbedtls_ecp_point *P )
+                                      const mbedtls_ecp_point *P,
+                                      mbedtls_ecp_restart_ctx *rs_ctx )
 {
     int ret;
 
@@ -1791,34 +3386,180 @@ static int mbedtls_ecp_mul_shortcuts( mbedtls_ecp_group *grp,
     }
     else
     {
-        MBEDTLS_MPI_CHK( mbedtls_ecp_mul( grp, R, m, P, NULL, NULL ) );
+        MBEDTLS_MPI_CHK( mbedtls_ecp_mul_restartable( grp, R, m, P,
+                                                      NULL, NULL, rs_ctx ) );
     }
 
 cleanup:
     return( ret );
 }
 
+#if defined(ECP_P256_FAST) || defined(ECP_P384_FAST)
 /*
- * Linear combination
+ * Is grp handled by one of the dedicated backends (ecp_p256.c, ecp_p384.c)?
+ * The secp256r1 one also takes restartable operations and completes them
+ * in one call, while those on secp384r1 stay with the generic code.
+ */
+static int ecp_has_backend( const mbedtls_ecp_group *grp, int restarting )
+{
+#if defined(ECP_P256_FAST)
+    if( grp->id == MBEDTLS_ECP_DP_SECP256R1 )
+        return( 1 );
+#endif
+#if defined(ECP_P384_FAST)
+    if( grp->id == MBEDTLS_ECP_DP_SECP384R1 )
+        return( ! restarting );
+#else
+    (void) restarting;
+#endif
+
+    return( 0 );
+}
+
+/*
+ * Can a backend compute m P + n Q? It only handles the common case of two
+ * valid scalars and points; anything else (including m or n equal to +-1,
+ * which the shortcuts accept) goes through the generic code.
+ */
+static int ecp_muladd_backend_ok( mbedtls_ecp_group *grp,
+                                  const mbedtls_mpi *m,
+                                  const mbedtls_ecp_point *P,
+                                  const mbedtls_mpi *n,
+                                  const mbedtls_ecp_point *Q )
+{
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( mbedtls_internal_ecp_grp_capable( grp ) )
+        return( 0 );
+#endif
+
+    return( mbedtls_mpi_cmp_int( &P->Z, 1 ) == 0 &&
+            mbedtls_mpi_cmp_int( &Q->Z, 1 ) == 0 &&
+            mbedtls_ecp_check_privkey( grp, m ) == 0 &&
+            mbedtls_ecp_check_privkey( grp, n ) == 0 &&
+            mbedtls_ecp_check_pubkey( grp, P ) == 0 &&
+            mbedtls_ecp_check_pubkey( grp, Q ) == 0 );
+}
+#endif /* ECP_P256_FAST || ECP_P384_FAST */
+
+/*
+ * Can m P + n Q be computed with ecp_muladd_wnaf()?
+ * Anything else (including m or n equal to +-1, which the shortcuts
+ * accept) is left to the generic code, which also reports errors.
+ */
+static int ecp_muladd_wnaf_ok( mbedtls_ecp_group *grp,
+                               const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                               const mbedtls_mpi *n, const mbedtls_ecp_point *Q )
+{
+#if defined(ECP_P256_FAST) || defined(ECP_P384_FAST)
+    /* valid input is handled by the dedicated backend */
+    if( ecp_has_backend( grp, 0 ) )
+        return( 0 );
+#endif
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+    if( mbedtls_internal_ecp_grp_capable( grp ) )
+        return( 0 );
+#endif
+
+    return( mbedtls_ecp_check_privkey( grp, m ) == 0 &&
+            mbedtls_ecp_check_privkey( grp, n ) == 0 &&
+            mbedtls_ecp_check_pubkey( grp, P ) == 0 &&
+            mbedtls_ecp_check_pubkey( grp, Q ) == 0 );
+}
+
+/*
+ * May a linear combination with this restart context return early, or is it
+ * resuming one that did?
+ */
+static int ecp_muladd_restarting( const mbedtls_ecp_restart_ctx *rs_ctx )
+{
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    return( rs_ctx != NULL &&
+            ( mbedtls_ecp_restart_is_enabled() || rs_ctx->ma != NULL ) );
+#else
+    (void) rs_ctx;
+    return( 0 );
+#endif
+}
+
+/*
+ * Restartable linear combination
  * NOT constant-time
  */
-int mbedtls_ecp_muladd( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+int mbedtls_ecp_muladd_restartable(
+             mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
              const mbedtls_mpi *m, const mbedtls_ecp_point *P,
-             const mbedtls_mpi *n, const mbedtls_ecp_point *Q )
+             const mbedtls_mpi *n, const mbedtls_ecp_point *Q,
+             mbedtls_ecp_restart_ctx *rs_ctx )
 {
     int ret;
     mbedtls_ecp_point mP;
+    mbedtls_ecp_point *pmP = &mP;
+    mbedtls_ecp_point *pR = R;
+    mbedtls_mpi tmp[ECP_TMP_LEN];
 #if defined(MBEDTLS_ECP_INTERNAL_ALT)
     char is_grp_capable = 0;
 #endif
 
-    if( ecp_get_type( grp ) != ECP_TYPE_SHORT_WEIERSTRASS )
+    if( ecp_get_type( grp ) != MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS )
         return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
 
+#if defined(ECP_P256_FAST) || defined(ECP_P384_FAST)
+    if( ecp_has_backend( grp, ecp_muladd_restarting( rs_ctx ) ) &&
+        ecp_muladd_backend_ok( grp, m, P, n, Q ) )
+    {
+#if defined(ECP_P256_FAST)
+        if( grp->id == MBEDTLS_ECP_DP_SECP256R1 )
+            return( mbedtls_ecp_p256_muladd( R, m, P, n, Q ) );
+#endif
+#if defined(ECP_P384_FAST)
+        if( grp->id == MBEDTLS_ECP_DP_SECP384R1 )
+            return( mbedtls_ecp_p384_muladd( R, m, P, n, Q ) );
+#endif
+    }
+#endif /* ECP_P256_FAST || ECP_P384_FAST */
+
+    /*
+     * Unless we may have to return early, valid input goes through the
+     * interleaved method, which is much faster than two separate
+     * multiplications.
+     */
+    if( ! ecp_muladd_restarting( rs_ctx ) &&
+        ecp_muladd_wnaf_ok( grp, m, P, n, Q ) )
+    {
+        return( mbedtls_ecp_muladd_batch( grp, R, m, &P, n, &Q, 1 ) );
+    }
+
     mbedtls_ecp_point_init( &mP );
 
-    MBEDTLS_MPI_CHK( mbedtls_ecp_mul_shortcuts( grp, &mP, m, P ) );
-    MBEDTLS_MPI_CHK( mbedtls_ecp_mul_shortcuts( grp, R,   n, Q ) );
+    ECP_RS_ENTER( ma );
+
+    MBEDTLS_MPI_CHK( ecp_tmp_init( grp, tmp ) );
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->ma != NULL )
+    {
+        /* redirect intermediate results to restart context */
+        pmP = &rs_ctx->ma->mP;
+        pR  = &rs_ctx->ma->R;
+
+        /* jump to next operation */
+        if( rs_ctx->ma->state == ecp_rsma_mul2 )
+            goto mul2;
+        if( rs_ctx->ma->state == ecp_rsma_add )
+            goto add;
+        if( rs_ctx->ma->state == ecp_rsma_norm )
+            goto norm;
+    }
+#endif /* MBEDTLS_ECP_RESTARTABLE */
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_mul_shortcuts( grp, pmP, m, P, rs_ctx ) );
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->ma != NULL )
+        rs_ctx->ma->state = ecp_rsma_mul2;
+
+mul2:
+#endif
+    MBEDTLS_MPI_CHK( mbedtls_ecp_mul_shortcuts( grp, pR,  n, Q, rs_ctx ) );
 
 #if defined(MBEDTLS_ECP_INTERNAL_ALT)
     if (  is_grp_capable = mbedtls_internal_ecp_grp_capable( grp )  )
@@ -1827,8 +3568,34 @@ int mbedtls_ecp_muladd( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
     }
 
 #endif /* MBEDTLS_ECP_INTERNAL_ALT */
-    MBEDTLS_MPI_CHK( ecp_add_mixed( grp, R, &mP, R ) );
-    MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, R ) );
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->ma != NULL )
+        rs_ctx->ma->state = ecp_rsma_add;
+
+add:
+#endif
+    MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_ADD );
+    if( ECP_MONT( grp ) )
+    {
+        MBEDTLS_MPI_CHK( ecp_point_to_mont( grp, pmP, pmP ) );
+        MBEDTLS_MPI_CHK( ecp_point_to_mont( grp, pR, pR ) );
+    }
+    MBEDTLS_MPI_CHK( ecp_add_mixed( grp, pR, pmP, pR, tmp ) );
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->ma != NULL )
+        rs_ctx->ma->state = ecp_rsma_norm;
+
+norm:
+#endif
+    MBEDTLS_ECP_BUDGET( MBEDTLS_ECP_OPS_INV );
+    MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, pR, tmp ) );
+    if( ECP_MONT( grp ) && ! mbedtls_ecp_is_zero( pR ) )
+        MBEDTLS_MPI_CHK( ecp_point_out( grp, pR ) );
+
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( rs_ctx != NULL && rs_ctx->ma != NULL )
+        MBEDTLS_MPI_CHK( mbedtls_ecp_copy( R, pR ) );
+#endif
 
 cleanup:
 
@@ -1840,6 +3607,280 @@ cleanup:
 
 #endif /* MBEDTLS_ECP_INTERNAL_ALT */
     mbedtls_ecp_point_free( &mP );
+    ecp_tmp_free( tmp );
+
+    ECP_RS_LEAVE( ma );
+
+    return( ret );
+}
+
+/*
+ * Linear combination
+ * NOT constant-time
+ */
+int mbedtls_ecp_muladd( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+             const mbedtls_mpi *n, const mbedtls_ecp_point *Q )
+{
+    return( mbedtls_ecp_muladd_restartable( grp, R, m, P, n, Q, NULL ) );
+}
+
+/*
+ * Several linear combinations, sharing the final inversion
+ * NOT constant-time
+ */
+int mbedtls_ecp_muladd_batch( mbedtls_ecp_group *grp, mbedtls_ecp_point R[],
+             const mbedtls_mpi m[], const mbedtls_ecp_point *P[],
+             const mbedtls_mpi n[], const mbedtls_ecp_point *Q[],
+             size_t count )
+{
+    int ret = 0;
+    size_t i, t_len = 0;
+    mbedtls_ecp_point **T = NULL;
+    mbedtls_mpi tmp[ECP_TMP_LEN];
+
+    if( ecp_get_type( grp ) != MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS )
+        return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
+
+    if( count == 0 )
+        return( 0 );
+
+#if defined(ECP_P256_FAST) || defined(ECP_P384_FAST)
+    /*
+     * The dedicated backends share their own inversion, provided they can
+     * take all the combinations; otherwise each one they can take costs an
+     * inversion of its own in mbedtls_ecp_muladd() below.
+     */
+    if( ecp_has_backend( grp, 0 ) )
+    {
+        for( i = 0; i < count; i++ )
+            if( ! ecp_muladd_backend_ok( grp, &m[i], P[i], &n[i], Q[i] ) )
+                break;
+
+#if defined(ECP_P256_FAST)
+        if( i == count && grp->id == MBEDTLS_ECP_DP_SECP256R1 )
+            return( mbedtls_ecp_p256_muladd_batch( R, m, P, n, Q, count ) );
+#endif
+#if defined(ECP_P384_FAST)
+        if( i == count && grp->id == MBEDTLS_ECP_DP_SECP384R1 )
+            return( mbedtls_ecp_p384_muladd_batch( R, m, P, n, Q, count ) );
+#endif
+    }
+#endif /* ECP_P256_FAST || ECP_P384_FAST */
+
+    MBEDTLS_MPI_CHK( ecp_tmp_init( grp, tmp ) );
+
+    if( count > 1 )
+    {
+        T = mbedtls_calloc( count, sizeof( mbedtls_ecp_point * ) );
+        if( T == NULL )
+        {
+            ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+            goto cleanup;
+        }
+    }
+
+    for( i = 0; i < count; i++ )
+    {
+        if( ! ecp_muladd_wnaf_ok( grp, &m[i], P[i], &n[i], Q[i] ) )
+        {
+            MBEDTLS_MPI_CHK( mbedtls_ecp_muladd( grp, &R[i],
+                                                 &m[i], P[i], &n[i], Q[i] ) );
+            continue;
+        }
+
+        MBEDTLS_MPI_CHK( ecp_muladd_wnaf( grp, &R[i], &m[i], P[i],
+                                          &n[i], Q[i], NULL, 0, tmp ) );
+
+        if( mbedtls_ecp_is_zero( &R[i] ) )
+            continue;
+
+        if( T == NULL )
+        {
+            MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, &R[i], tmp ) );
+            MBEDTLS_MPI_CHK( ecp_point_out( grp, &R[i] ) );
+        }
+        else
+            T[t_len++] = &R[i];
+    }
+
+    if( t_len > 0 )
+        MBEDTLS_MPI_CHK( ecp_normalize_jac_many( grp, T, t_len, tmp ) );
+    for( i = 0; i < t_len; i++ )
+        MBEDTLS_MPI_CHK( ecp_point_out( grp, T[i] ) );
+
+cleanup:
+    mbedtls_free( T );
+    ecp_tmp_free( tmp );
+
+    return( ret );
+}
+
+/*
+ * Pre-compute a comb table for the public key of a key pair
+ */
+int mbedtls_ecp_keypair_precompute( mbedtls_ecp_keypair *key )
+{
+    int ret;
+    unsigned char w;
+    size_t i, d, T_size;
+    mbedtls_ecp_point *T = NULL;
+    const mbedtls_ecp_point *Q = &key->Q;
+    mbedtls_ecp_point Qm;
+    mbedtls_mpi tmp[ECP_TMP_LEN];
+
+    if( ecp_get_type( &key->grp ) != MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS )
+        return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
+
+    if( ( ret = mbedtls_ecp_check_pubkey( &key->grp, &key->Q ) ) != 0 )
+        return( ret );
+
+    mbedtls_ecp_point_init( &Qm );
+
+    /* Same bounds as in ecp_mul_comb() */
+    w = MBEDTLS_ECP_WINDOW_SIZE;
+    if( w >= key->grp.nbits )
+        w = 2;
+
+    T_size = (size_t) 1 << ( w - 1 );
+    d = ( key->grp.nbits + w - 1 ) / w;
+
+    MBEDTLS_MPI_CHK( ecp_tmp_init( &key->grp, tmp ) );
+
+    T = mbedtls_calloc( T_size, sizeof( mbedtls_ecp_point ) );
+    if( T == NULL )
+    {
+        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        goto cleanup;
+    }
+
+    for( i = 0; i < T_size; i++ )
+        mbedtls_ecp_point_init( &T[i] );
+
+    if( ECP_MONT( &key->grp ) )
+    {
+        MBEDTLS_MPI_CHK( ecp_point_to_mont( &key->grp, &Qm, Q ) );
+        Q = &Qm;
+    }
+
+    MBEDTLS_MPI_CHK( ecp_precompute_comb( &key->grp, T, Q, w, d, NULL, tmp ) );
+
+    /* Replace the previous table, if any */
+    if( key->T != NULL )
+    {
+        for( i = 0; i < key->T_size; i++ )
+            mbedtls_ecp_point_free( &key->T[i] );
+        mbedtls_free( key->T );
+    }
+
+    key->T = T;
+    key->T_size = T_size;
+    T = NULL;
+
+cleanup:
+    if( T != NULL )
+    {
+        for( i = 0; i < T_size; i++ )
+            mbedtls_ecp_point_free( &T[i] );
+        mbedtls_free( T );
+    }
+    mbedtls_ecp_point_free( &Qm );
+    ecp_tmp_free( tmp );
+
+    return( ret );
+}
+
+/*
+ * Is the table of a key pair, whose first point is a copy of Q in the
+ * representation of the group's field elements, still that of Q?
+ */
+static int ecp_keypair_table_ok( const mbedtls_ecp_keypair *key )
+{
+    int ok;
+    mbedtls_ecp_point Qm;
+
+    if( ! ECP_MONT( &key->grp ) )
+        return( mbedtls_mpi_cmp_mpi( &key->T[0].X, &key->Q.X ) == 0 &&
+                mbedtls_mpi_cmp_mpi( &key->T[0].Y, &key->Q.Y ) == 0 );
+
+    mbedtls_ecp_point_init( &Qm );
+
+    ok = ecp_point_to_mont( &key->grp, &Qm, &key->Q ) == 0 &&
+         mbedtls_mpi_cmp_mpi( &key->T[0].X, &Qm.X ) == 0 &&
+         mbedtls_mpi_cmp_mpi( &key->T[0].Y, &Qm.Y ) == 0;
+
+    mbedtls_ecp_point_free( &Qm );
+
+    return( ok );
+}
+
+/*
+ * Linear combination with the public key of a key pair
+ * NOT constant-time
+ */
+int mbedtls_ecp_muladd_keypair( mbedtls_ecp_group *grp, mbedtls_ecp_point *R,
+             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+             const mbedtls_mpi *n, const mbedtls_ecp_keypair *key )
+{
+    int ret;
+    const mbedtls_ecp_point *Q = &key->Q;
+#if defined(ECP_P256_FAST) || defined(ECP_P384_FAST)
+    ecp_comb_term c;
+#endif
+    mbedtls_mpi tmp[ECP_TMP_LEN];
+
+    /*
+     * T[0] is a copy of Q, which tells if the table is still current. The
+     * rest of the conditions are those of mbedtls_ecp_muladd_restartable()
+     * for its fast paths.
+     */
+    if( key->T == NULL || grp->id == MBEDTLS_ECP_DP_NONE ||
+        grp->id != key->grp.id ||
+        ! ecp_keypair_table_ok( key ) ||
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+        mbedtls_internal_ecp_grp_capable( grp ) ||
+#endif
+        mbedtls_mpi_cmp_int( &P->Z, 1 ) != 0 ||
+        mbedtls_ecp_check_privkey( grp, m ) != 0 ||
+        mbedtls_ecp_check_privkey( grp, n ) != 0 ||
+        mbedtls_ecp_check_pubkey( grp, P ) != 0 ||
+        mbedtls_ecp_check_pubkey( grp, Q ) != 0 )
+    {
+        return( mbedtls_ecp_muladd( grp, R, m, P, n, Q ) );
+    }
+
+    MBEDTLS_MPI_CHK( ecp_tmp_init( grp, tmp ) );
+
+#if defined(ECP_P256_FAST)
+    if( grp->id == MBEDTLS_ECP_DP_SECP256R1 )
+    {
+        MBEDTLS_MPI_CHK( ecp_comb_prepare( grp, &c, key->T, key->T_size, n ) );
+        MBEDTLS_MPI_CHK( mbedtls_ecp_p256_muladd_comb( R, m, P,
+                                 key->T, key->T_size, c.k, c.d, c.neg ) );
+        goto cleanup;
+    }
+#endif
+#if defined(ECP_P384_FAST)
+    if( grp->id == MBEDTLS_ECP_DP_SECP384R1 )
+    {
+        MBEDTLS_MPI_CHK( ecp_comb_prepare( grp, &c, key->T, key->T_size, n ) );
+        MBEDTLS_MPI_CHK( mbedtls_ecp_p384_muladd_comb( R, m, P,
+                                 key->T, key->T_size, c.k, c.d, c.neg ) );
+        goto cleanup;
+    }
+#endif
+
+    MBEDTLS_MPI_CHK( ecp_muladd_wnaf( grp, R, m, P, n, Q,
+                                      key->T, key->T_size, tmp ) );
+
+    if( ! mbedtls_ecp_is_zero( R ) )
+    {
+        MBEDTLS_MPI_CHK( ecp_normalize_jac( grp, R, tmp ) );
+        MBEDTLS_MPI_CHK( ecp_point_out( grp, R ) );
+    }
+
+cleanup:
+    ecp_tmp_free( tmp );
 
     return( ret );
 }
@@ -1869,11 +3910,11 @@ int mbedtls_ecp_check_pubkey( const mbedtls_ecp_group *grp, const mbedtls_ecp_po
         return( MBEDTLS_ERR_ECP_INVALID_KEY );
 
 #if defined(ECP_MONTGOMERY)
-    if( ecp_get_type( grp ) == ECP_TYPE_MONTGOMERY )
+    if( ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_MONTGOMERY )
         return( ecp_check_pubkey_mx( grp, pt ) );
 #endif
 #if defined(ECP_SHORTWEIERSTRASS)
-    if( ecp_get_type( grp ) == ECP_TYPE_SHORT_WEIERSTRASS )
+    if( ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS )
         return( ecp_check_pubkey_sw( grp, pt ) );
 #endif
     return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
@@ -1885,12 +3926,12 @@ int mbedtls_ecp_check_pubkey( const mbedtls_ecp_group *grp, const mbedtls_ecp_po
 int mbedtls_ecp_check_privkey( const mbedtls_ecp_group *grp, const mbedtls_mpi *d )
 {
 #if defined(ECP_MONTGOMERY)
-    if( ecp_get_type( grp ) == ECP_TYPE_MONTGOMERY )
+    if( ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_MONTGOMERY )
     {
-        /* see [Curve25519] page 5 */
+        /* see [Curve25519] page 5 and RFC 7748 section 5 */
         if( mbedtls_mpi_get_bit( d, 0 ) != 0 ||
             mbedtls_mpi_get_bit( d, 1 ) != 0 ||
-            mbedtls_mpi_get_bit( d, 2 ) != 0 ||
+            ( grp->nbits == 254 && mbedtls_mpi_get_bit( d, 2 ) != 0 ) ||
             mbedtls_mpi_bitlen( d ) - 1 != grp->nbits ) /* mbedtls_mpi_bitlen is one-based! */
             return( MBEDTLS_ERR_ECP_INVALID_KEY );
         else
@@ -1898,7 +3939,7 @@ int mbedtls_ecp_check_privkey( const mbedtls_ecp_group *grp, const mbedtls_mpi *
     }
 #endif /* ECP_MONTGOMERY */
 #if defined(ECP_SHORTWEIERSTRASS)
-    if( ecp_get_type( grp ) == ECP_TYPE_SHORT_WEIERSTRASS )
+    if( ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS )
     {
         /* see SEC1 3.2 */
         if( mbedtls_mpi_cmp_int( d, 1 ) < 0 ||
@@ -1913,19 +3954,18 @@ int mbedtls_ecp_check_privkey( const mbedtls_ecp_group *grp, const mbedtls_mpi *
 }
 
 /*
- * Generate a keypair with configurable base point
+ * Generate a private key
  */
-int mbedtls_ecp_gen_keypair_base( mbedtls_ecp_group *grp,
-                     const mbedtls_ecp_point *G,
-                     mbedtls_mpi *d, mbedtls_ecp_point *Q,
+int mbedtls_ecp_gen_privkey( const mbedtls_ecp_group *grp,
+                     mbedtls_mpi *d,
                      int (*f_rng)(void *, unsigned char *, size_t),
                      void *p_rng )
 {
-    int ret;
+    int ret = MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
     size_t n_size = ( grp->nbits + 7 ) / 8;
 
 #if defined(ECP_MONTGOMERY)
-    if( ecp_get_type( grp ) == ECP_TYPE_MONTGOMERY )
+    if( ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_MONTGOMERY )
     {
         /* [M225] page 5 */
         size_t b;
@@ -1941,15 +3981,16 @@ int mbedtls_ecp_gen_keypair_base( mbedtls_ecp_group *grp,
         else
             MBEDTLS_MPI_CHK( mbedtls_mpi_set_bit( d, grp->nbits, 1 ) );
 
-        /* Make sure the last three bits are unset */
+        /* Make sure the last three bits (two for Curve448) are unset */
         MBEDTLS_MPI_CHK( mbedtls_mpi_set_bit( d, 0, 0 ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_set_bit( d, 1, 0 ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_set_bit( d, 2, 0 ) );
+        if( grp->nbits == 254 )
+            MBEDTLS_MPI_CHK( mbedtls_mpi_set_bit( d, 2, 0 ) );
     }
-    else
 #endif /* ECP_MONTGOMERY */
+
 #if defined(ECP_SHORTWEIERSTRASS)
-    if( ecp_get_type( grp ) == ECP_TYPE_SHORT_WEIERSTRASS )
+    if( ecp_get_type( grp ) == MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS )
     {
         /* SEC1 3.2.1: Generate d such that 1 <= n < N */
         int count = 0;
@@ -1983,15 +4024,28 @@ int mbedtls_ecp_gen_keypair_base( mbedtls_ecp_group *grp,
         while( mbedtls_mpi_cmp_int( d, 1 ) < 0 ||
                mbedtls_mpi_cmp_mpi( d, &grp->N ) >= 0 );
     }
-    else
 #endif /* ECP_SHORTWEIERSTRASS */
-        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
 
 cleanup:
-    if( ret != 0 )
-        return( ret );
+    return( ret );
+}
+
+/*
+ * Generate a keypair with configurable base point
+ */
+int mbedtls_ecp_gen_keypair_base( mbedtls_ecp_group *grp,
+                     const mbedtls_ecp_point *G,
+                     mbedtls_mpi *d, mbedtls_ecp_point *Q,
+                     int (*f_rng)(void *, unsigned char *, size_t),
+                     void *p_rng )
+{
+    int ret;
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_gen_privkey( grp, d, f_rng, p_rng ) );
+    MBEDTLS_MPI_CHK( mbedtls_ecp_mul( grp, Q, d, G, f_rng, p_rng ) );
 
-    return( mbedtls_ecp_mul( grp, Q, d, G, f_rng, p_rng ) );
+cleanup:
+    return( ret );
 }
 
 /*
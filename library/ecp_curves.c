@@ -77,6 +77,45 @@
 
 #endif /* bits in mbedtls_mpi_uint */
 
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+/*
+ * Static tables of precomputed multiples of the generators, as
+ * ecp_precompute_comb() would compute them (see scripts/ecp_comb_table.py).
+ * Each table holds the X and Y coordinates of its points back to back, with
+ * as many limbs as the generator's coordinates. As in the tables built at
+ * run time, Z is not stored and means 1. Curves without a fast reduction
+ * compute in Montgomery form (see ecp_mont_setup()), and so do their tables.
+ * Groups loaded from here point to these tables, so they never build or
+ * modify grp->T for multiplications by G.
+ */
+
+#define ECP_COMB_LIMBS( G )     ( sizeof( G ## _gx ) / sizeof( mbedtls_mpi_uint ) )
+
+#define ECP_COMB_MPI( G, k )                                            \
+    { 1, ECP_COMB_LIMBS( G ),                                           \
+      (mbedtls_mpi_uint *) G ## _T_xy + ( k ) * ECP_COMB_LIMBS( G ) }
+
+#define ECP_COMB_POINT( G, i )                                          \
+    { ECP_COMB_MPI( G, 2 * ( i ) ), ECP_COMB_MPI( G, 2 * ( i ) + 1 ),   \
+      { 1, 0, NULL } }
+
+#define ECP_COMB_TABLE( G )     G ## _T
+#else
+#define ECP_COMB_TABLE( G )     NULL
+#endif /* MBEDTLS_ECP_FIXED_POINT_OPTIM */
+
+/*
+ * Without their fast reductions, the NIST curves compute in Montgomery form
+ * too, so their tables, which are in normal form, can't be used
+ */
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1 &&                               \
+    ( defined(MBEDTLS_ECP_NIST_OPTIM) || defined(MBEDTLS_ECP_INTERNAL_ALT) )
+#define ECP_NIST_TABLES
+#define ECP_NIST_TABLE( G )     ECP_COMB_TABLE( G )
+#else
+#define ECP_NIST_TABLE( G )     NULL
+#endif
+
 /*
  * Note: the constants are in little-endian order
  * to be directly usable in MPIs
@@ -111,6 +150,140 @@ static const mbedtls_mpi_uint secp192r1_n[] = {
     BYTES_TO_T_UINT_8( 0x36, 0xF8, 0xDE, 0x99, 0xFF, 0xFF, 0xFF, 0xFF ),
     BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
 };
+#if defined(ECP_NIST_TABLES)
+static const mbedtls_mpi_uint secp192r1_T_xy[] = {
+    /* T[0].X, T[0].Y */
+    BYTES_TO_T_UINT_8( 0x12, 0x10, 0xFF, 0x82, 0xFD, 0x0A, 0xFF, 0xF4 ),
+    BYTES_TO_T_UINT_8( 0x00, 0x88, 0xA1, 0x43, 0xEB, 0x20, 0xBF, 0x7C ),
+    BYTES_TO_T_UINT_8( 0xF6, 0x90, 0x30, 0xB0, 0x0E, 0xA8, 0x8D, 0x18 ),
+    BYTES_TO_T_UINT_8( 0x11, 0x48, 0x79, 0x1E, 0xA1, 0x77, 0xF9, 0x73 ),
+    BYTES_TO_T_UINT_8( 0xD5, 0xCD, 0x24, 0x6B, 0xED, 0x11, 0x10, 0x63 ),
+    BYTES_TO_T_UINT_8( 0x78, 0xDA, 0xC8, 0xFF, 0x95, 0x2B, 0x19, 0x07 ),
+    /* T[1].X, T[1].Y */
+    BYTES_TO_T_UINT_8( 0x97, 0x9E, 0xE3, 0x60, 0x59, 0xD1, 0xC4, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0x91, 0xBD, 0x22, 0xD7, 0x2D, 0x07, 0xBD, 0xB6 ),
+    BYTES_TO_T_UINT_8( 0x74, 0x2A, 0xCF, 0x33, 0xF0, 0xBE, 0xD1, 0xED ),
+    BYTES_TO_T_UINT_8( 0x88, 0x71, 0x4B, 0xA8, 0xED, 0x7E, 0xC9, 0x1A ),
+    BYTES_TO_T_UINT_8( 0x8E, 0x2A, 0xF6, 0xDF, 0x0E, 0xE8, 0x4C, 0x0F ),
+    BYTES_TO_T_UINT_8( 0xC5, 0x35, 0xF7, 0x8A, 0xC3, 0xEC, 0xDE, 0x1E ),
+    /* T[2].X, T[2].Y */
+    BYTES_TO_T_UINT_8( 0x00, 0x67, 0xC2, 0x1D, 0x32, 0x8F, 0x10, 0xFB ),
+    BYTES_TO_T_UINT_8( 0xBB, 0x2D, 0x17, 0xF3, 0xE4, 0xFE, 0xD8, 0x13 ),
+    BYTES_TO_T_UINT_8( 0x55, 0x45, 0x10, 0x70, 0x2C, 0x3E, 0x52, 0x3E ),
+    BYTES_TO_T_UINT_8( 0x61, 0xF1, 0x04, 0x5D, 0xEE, 0xD4, 0x56, 0xE6 ),
+    BYTES_TO_T_UINT_8( 0x78, 0xB7, 0x38, 0x27, 0x61, 0xAA, 0x81, 0x87 ),
+    BYTES_TO_T_UINT_8( 0x71, 0x37, 0xD7, 0x0E, 0x29, 0x0E, 0x11, 0x14 ),
+    /* T[3].X, T[3].Y */
+    BYTES_TO_T_UINT_8( 0x1E, 0x35, 0x52, 0xC6, 0x31, 0xB7, 0x27, 0xF5 ),
+    BYTES_TO_T_UINT_8( 0x3D, 0xD4, 0x15, 0x98, 0x0F, 0xE7, 0xF3, 0x6A ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x31, 0x70, 0x35, 0x09, 0xA0, 0x2B, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0x21, 0x75, 0xA7, 0x4C, 0x88, 0xCF, 0x5B, 0xE4 ),
+    BYTES_TO_T_UINT_8( 0x17, 0x17, 0x48, 0x8D, 0xF2, 0xF0, 0x86, 0xED ),
+    BYTES_TO_T_UINT_8( 0x49, 0xCF, 0xFE, 0x6B, 0xB0, 0xA5, 0x06, 0xAB ),
+    /* T[4].X, T[4].Y */
+    BYTES_TO_T_UINT_8( 0x18, 0x6A, 0xDC, 0x9A, 0x6D, 0x7B, 0x47, 0x2E ),
+    BYTES_TO_T_UINT_8( 0x12, 0xFC, 0x51, 0x12, 0x62, 0x66, 0x0B, 0x59 ),
+    BYTES_TO_T_UINT_8( 0xCD, 0x40, 0x93, 0xA0, 0xB5, 0x5A, 0x58, 0xD7 ),
+    BYTES_TO_T_UINT_8( 0xEF, 0xCB, 0xAF, 0xDC, 0x0B, 0xA1, 0x26, 0xFB ),
+    BYTES_TO_T_UINT_8( 0xDA, 0x36, 0x9D, 0xA3, 0xD7, 0x3B, 0xAD, 0x39 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0x3B, 0x05, 0x9A, 0xA8, 0xAA, 0x69, 0xB2 ),
+    /* T[5].X, T[5].Y */
+    BYTES_TO_T_UINT_8( 0x6D, 0xD9, 0xD1, 0x4D, 0x4A, 0x6E, 0x96, 0x1E ),
+    BYTES_TO_T_UINT_8( 0x17, 0x66, 0x32, 0x39, 0xC6, 0x57, 0x7D, 0xE6 ),
+    BYTES_TO_T_UINT_8( 0x92, 0xA0, 0x36, 0xC2, 0x45, 0xF9, 0x00, 0x62 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0xEF, 0x59, 0x46, 0xDC, 0x60, 0xD9, 0x8F ),
+    BYTES_TO_T_UINT_8( 0x24, 0xB0, 0xE9, 0x41, 0xA4, 0x87, 0x76, 0x89 ),
+    BYTES_TO_T_UINT_8( 0x13, 0xD4, 0x0E, 0xB2, 0xFA, 0x16, 0x56, 0xDC ),
+    /* T[6].X, T[6].Y */
+    BYTES_TO_T_UINT_8( 0x0A, 0x62, 0xD2, 0xB1, 0x34, 0xB2, 0xF1, 0x06 ),
+    BYTES_TO_T_UINT_8( 0xB2, 0xED, 0x55, 0xC5, 0x47, 0xB5, 0x07, 0x15 ),
+    BYTES_TO_T_UINT_8( 0x17, 0xF6, 0x2F, 0x94, 0xC3, 0xDD, 0x54, 0x2F ),
+    BYTES_TO_T_UINT_8( 0xFD, 0xA6, 0xD4, 0x8C, 0xA9, 0xCE, 0x4D, 0x2E ),
+    BYTES_TO_T_UINT_8( 0xB9, 0x4B, 0x46, 0xCC, 0xB2, 0x55, 0xC8, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x3A, 0xAE, 0x31, 0xED, 0x89, 0x65, 0x59, 0x55 ),
+    /* T[7].X, T[7].Y */
+    BYTES_TO_T_UINT_8( 0xCC, 0x0A, 0xD1, 0x1A, 0xC5, 0xF6, 0xEA, 0x43 ),
+    BYTES_TO_T_UINT_8( 0x0C, 0xFC, 0x0C, 0x1A, 0xFB, 0xA0, 0xC8, 0x70 ),
+    BYTES_TO_T_UINT_8( 0xEA, 0xFD, 0x53, 0x6F, 0x6D, 0xBF, 0xBA, 0xAF ),
+    BYTES_TO_T_UINT_8( 0x2D, 0xB0, 0x7D, 0x83, 0x96, 0xE3, 0xCB, 0x9D ),
+    BYTES_TO_T_UINT_8( 0x6F, 0x6E, 0x55, 0x2C, 0x20, 0x53, 0x2F, 0x46 ),
+    BYTES_TO_T_UINT_8( 0xA6, 0x66, 0x00, 0x17, 0x08, 0xFE, 0xAC, 0x31 ),
+    /* T[8].X, T[8].Y */
+    BYTES_TO_T_UINT_8( 0x09, 0x12, 0x97, 0x3A, 0xC7, 0x57, 0x45, 0xCD ),
+    BYTES_TO_T_UINT_8( 0x38, 0x25, 0x99, 0x00, 0xF6, 0x97, 0xB4, 0x64 ),
+    BYTES_TO_T_UINT_8( 0x9B, 0x74, 0xE6, 0xE6, 0xA3, 0xDF, 0x9C, 0xCC ),
+    BYTES_TO_T_UINT_8( 0x32, 0xF4, 0x76, 0xD5, 0x5F, 0x2A, 0xFD, 0x85 ),
+    BYTES_TO_T_UINT_8( 0x62, 0x80, 0x7E, 0x3E, 0xE5, 0xE8, 0xD6, 0x63 ),
+    BYTES_TO_T_UINT_8( 0xE2, 0xAD, 0x1E, 0x70, 0x79, 0x3E, 0x3D, 0x83 ),
+    /* T[9].X, T[9].Y */
+    BYTES_TO_T_UINT_8( 0x8E, 0x15, 0xBB, 0xB3, 0x42, 0x6A, 0xA1, 0x7C ),
+    BYTES_TO_T_UINT_8( 0x9B, 0x58, 0xCB, 0x43, 0x25, 0x00, 0x14, 0x68 ),
+    BYTES_TO_T_UINT_8( 0x06, 0x4E, 0x93, 0x11, 0xE0, 0x32, 0x54, 0x98 ),
+    BYTES_TO_T_UINT_8( 0xA7, 0x52, 0xA2, 0xB4, 0x57, 0x32, 0xB9, 0x11 ),
+    BYTES_TO_T_UINT_8( 0x7D, 0x43, 0xA1, 0xB1, 0xFB, 0x01, 0xE1, 0xE7 ),
+    BYTES_TO_T_UINT_8( 0xA6, 0xFB, 0x5A, 0x11, 0xB8, 0xC2, 0x03, 0xE5 ),
+    /* T[10].X, T[10].Y */
+    BYTES_TO_T_UINT_8( 0x1C, 0x2B, 0x71, 0x26, 0x4E, 0x7C, 0xC5, 0x32 ),
+    BYTES_TO_T_UINT_8( 0x1F, 0xF5, 0xD3, 0xA8, 0xE4, 0x95, 0x48, 0x65 ),
+    BYTES_TO_T_UINT_8( 0x55, 0xAE, 0xD9, 0x5D, 0x9F, 0x6A, 0x22, 0xAD ),
+    BYTES_TO_T_UINT_8( 0xD9, 0xCC, 0xA3, 0x4D, 0xA0, 0x1C, 0x34, 0xEF ),
+    BYTES_TO_T_UINT_8( 0xA3, 0x3C, 0x62, 0xF8, 0x5E, 0xA6, 0x58, 0x7D ),
+    BYTES_TO_T_UINT_8( 0x6D, 0x6E, 0x66, 0x8A, 0x3D, 0x17, 0xFF, 0x0F ),
+    /* T[11].X, T[11].Y */
+    BYTES_TO_T_UINT_8( 0xF7, 0xCD, 0xA8, 0xDD, 0xD1, 0x20, 0x5C, 0xEA ),
+    BYTES_TO_T_UINT_8( 0xBF, 0xFE, 0x17, 0xE2, 0xCF, 0xEA, 0x63, 0xDE ),
+    BYTES_TO_T_UINT_8( 0x74, 0x51, 0xC9, 0x16, 0xDE, 0xB4, 0xB2, 0xDD ),
+    BYTES_TO_T_UINT_8( 0x59, 0xBE, 0x12, 0xD7, 0xA3, 0x0A, 0x50, 0x33 ),
+    BYTES_TO_T_UINT_8( 0x53, 0x87, 0xC5, 0x8A, 0x76, 0x57, 0x07, 0x60 ),
+    BYTES_TO_T_UINT_8( 0xE5, 0x1F, 0xC6, 0x1B, 0x66, 0xC4, 0x3D, 0x8A ),
+    /* T[12].X, T[12].Y */
+    BYTES_TO_T_UINT_8( 0x28, 0xA4, 0x85, 0x13, 0x8F, 0xA7, 0x35, 0x19 ),
+    BYTES_TO_T_UINT_8( 0x58, 0x0D, 0xFD, 0xFF, 0x1B, 0xD1, 0xD6, 0xEF ),
+    BYTES_TO_T_UINT_8( 0xBA, 0x7A, 0xD0, 0xC3, 0xB4, 0xEF, 0x39, 0x66 ),
+    BYTES_TO_T_UINT_8( 0x3A, 0xFE, 0xA5, 0x9C, 0x34, 0x30, 0x49, 0x40 ),
+    BYTES_TO_T_UINT_8( 0xDE, 0xC5, 0x39, 0x26, 0x06, 0xE3, 0x01, 0x17 ),
+    BYTES_TO_T_UINT_8( 0xE2, 0x2B, 0x66, 0xFC, 0x95, 0x5F, 0x35, 0xF7 ),
+    /* T[13].X, T[13].Y */
+    BYTES_TO_T_UINT_8( 0x58, 0xCF, 0x54, 0x63, 0x99, 0x57, 0x05, 0x45 ),
+    BYTES_TO_T_UINT_8( 0x71, 0x6F, 0x00, 0x5F, 0x65, 0x08, 0x47, 0x98 ),
+    BYTES_TO_T_UINT_8( 0x62, 0x2A, 0x90, 0x6D, 0x67, 0xC6, 0xBC, 0x45 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0x4D, 0x88, 0x0A, 0x35, 0x9E, 0x33, 0x9C ),
+    BYTES_TO_T_UINT_8( 0x7C, 0x17, 0x0C, 0xF8, 0xE1, 0x7A, 0x49, 0x02 ),
+    BYTES_TO_T_UINT_8( 0xA4, 0x44, 0x06, 0x8F, 0x0B, 0x70, 0x2F, 0x71 ),
+    /* T[14].X, T[14].Y */
+    BYTES_TO_T_UINT_8( 0x85, 0x4B, 0xCB, 0xF9, 0x8E, 0x6A, 0xDA, 0x1B ),
+    BYTES_TO_T_UINT_8( 0x29, 0x43, 0xA1, 0x3F, 0xCE, 0x17, 0xD2, 0x32 ),
+    BYTES_TO_T_UINT_8( 0x5D, 0x0D, 0xD2, 0x6C, 0x82, 0x37, 0xE5, 0xFC ),
+    BYTES_TO_T_UINT_8( 0x4A, 0x3C, 0xF4, 0x92, 0xB4, 0x8A, 0x95, 0x85 ),
+    BYTES_TO_T_UINT_8( 0x85, 0x96, 0xF1, 0x0A, 0x34, 0x2F, 0x74, 0x7E ),
+    BYTES_TO_T_UINT_8( 0x7B, 0xA1, 0xAA, 0xBA, 0x86, 0x77, 0x4F, 0xA2 ),
+    /* T[15].X, T[15].Y */
+    BYTES_TO_T_UINT_8( 0xE5, 0x7F, 0xEF, 0x60, 0x50, 0x80, 0xD7, 0xD4 ),
+    BYTES_TO_T_UINT_8( 0x31, 0xAC, 0xC9, 0xFE, 0xEC, 0x0A, 0x1A, 0x9F ),
+    BYTES_TO_T_UINT_8( 0x6B, 0x2F, 0xBE, 0x91, 0xD7, 0xB7, 0x38, 0x48 ),
+    BYTES_TO_T_UINT_8( 0xB1, 0xAE, 0x85, 0x98, 0xFE, 0x05, 0x7F, 0x9F ),
+    BYTES_TO_T_UINT_8( 0x91, 0xBE, 0xFD, 0x11, 0x31, 0x3D, 0x14, 0x13 ),
+    BYTES_TO_T_UINT_8( 0x59, 0x75, 0xE8, 0x30, 0x01, 0xCB, 0x9B, 0x1C ),
+};
+static const mbedtls_ecp_point secp192r1_T[16] = {
+    ECP_COMB_POINT( secp192r1, 0 ),
+    ECP_COMB_POINT( secp192r1, 1 ),
+    ECP_COMB_POINT( secp192r1, 2 ),
+    ECP_COMB_POINT( secp192r1, 3 ),
+    ECP_COMB_POINT( secp192r1, 4 ),
+    ECP_COMB_POINT( secp192r1, 5 ),
+    ECP_COMB_POINT( secp192r1, 6 ),
+    ECP_COMB_POINT( secp192r1, 7 ),
+    ECP_COMB_POINT( secp192r1, 8 ),
+    ECP_COMB_POINT( secp192r1, 9 ),
+    ECP_COMB_POINT( secp192r1, 10 ),
+    ECP_COMB_POINT( secp192r1, 11 ),
+    ECP_COMB_POINT( secp192r1, 12 ),
+    ECP_COMB_POINT( secp192r1, 13 ),
+    ECP_COMB_POINT( secp192r1, 14 ),
+    ECP_COMB_POINT( secp192r1, 15 ),
+};
+#endif /* ECP_NIST_TABLES */
 #endif /* MBEDTLS_ECP_DP_SECP192R1_ENABLED */
 
 /*
@@ -147,6 +320,172 @@ static const mbedtls_mpi_uint secp224r1_n[] = {
     BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
     BYTES_TO_T_UINT_4( 0xFF, 0xFF, 0xFF, 0xFF ),
 };
+#if defined(ECP_NIST_TABLES)
+static const mbedtls_mpi_uint secp224r1_T_xy[] = {
+    /* T[0].X, T[0].Y */
+    BYTES_TO_T_UINT_8( 0x21, 0x1D, 0x5C, 0x11, 0xD6, 0x80, 0x32, 0x34 ),
+    BYTES_TO_T_UINT_8( 0x22, 0x11, 0xC2, 0x56, 0xD3, 0xC1, 0x03, 0x4A ),
+    BYTES_TO_T_UINT_8( 0xB9, 0x90, 0x13, 0x32, 0x7F, 0xBF, 0xB4, 0x6B ),
+    BYTES_TO_T_UINT_4( 0xBD, 0x0C, 0x0E, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x34, 0x7E, 0x00, 0x85, 0x99, 0x81, 0xD5, 0x44 ),
+    BYTES_TO_T_UINT_8( 0x64, 0x47, 0x07, 0x5A, 0xA0, 0x75, 0x43, 0xCD ),
+    BYTES_TO_T_UINT_8( 0xE6, 0xDF, 0x22, 0x4C, 0xFB, 0x23, 0xF7, 0xB5 ),
+    BYTES_TO_T_UINT_4( 0x88, 0x63, 0x37, 0xBD ),
+    /* T[1].X, T[1].Y */
+    BYTES_TO_T_UINT_8( 0xE0, 0xF9, 0xB8, 0xD0, 0x3D, 0xD2, 0xD3, 0xFA ),
+    BYTES_TO_T_UINT_8( 0x1E, 0xFD, 0x99, 0x26, 0x19, 0xFE, 0x13, 0x6E ),
+    BYTES_TO_T_UINT_8( 0x1C, 0x0E, 0x4C, 0x48, 0x7C, 0xA2, 0x17, 0x01 ),
+    BYTES_TO_T_UINT_4( 0x3D, 0xA3, 0x13, 0x57 ),
+    BYTES_TO_T_UINT_8( 0x9F, 0x16, 0x5C, 0x8F, 0xAA, 0xED, 0x0F, 0x58 ),
+    BYTES_TO_T_UINT_8( 0xBF, 0xC5, 0x43, 0x34, 0x93, 0x05, 0x2A, 0x4C ),
+    BYTES_TO_T_UINT_8( 0xE4, 0xE3, 0x6C, 0xCA, 0xC6, 0x14, 0xC2, 0x25 ),
+    BYTES_TO_T_UINT_4( 0xD3, 0x43, 0x6C, 0xD7 ),
+    /* T[2].X, T[2].Y */
+    BYTES_TO_T_UINT_8( 0xC3, 0x5A, 0x98, 0x1E, 0xC8, 0xA5, 0x42, 0xA3 ),
+    BYTES_TO_T_UINT_8( 0x98, 0x49, 0x56, 0x78, 0xF8, 0xEF, 0xED, 0x65 ),
+    BYTES_TO_T_UINT_8( 0x1B, 0xBB, 0x64, 0xB6, 0x4C, 0x54, 0x5F, 0xD1 ),
+    BYTES_TO_T_UINT_4( 0x2F, 0x0C, 0x33, 0xCC ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x79, 0xCB, 0x2E, 0x08, 0xFF, 0xD8, 0xE6 ),
+    BYTES_TO_T_UINT_8( 0x2E, 0x1F, 0xD4, 0xD7, 0x57, 0xE9, 0x39, 0x45 ),
+    BYTES_TO_T_UINT_8( 0xD8, 0xD6, 0x3B, 0x0A, 0x1C, 0x87, 0xB7, 0x6A ),
+    BYTES_TO_T_UINT_4( 0xEB, 0x30, 0xD8, 0x05 ),
+    /* T[3].X, T[3].Y */
+    BYTES_TO_T_UINT_8( 0xAD, 0x79, 0x74, 0x9A, 0xE6, 0xBB, 0xC2, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0x5B, 0xA6, 0x67, 0xC1, 0x91, 0xE7, 0x64 ),
+    BYTES_TO_T_UINT_8( 0xF0, 0xDF, 0x38, 0x82, 0x19, 0x2C, 0x4C, 0xCA ),
+    BYTES_TO_T_UINT_4( 0xD1, 0x2E, 0x39, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0x99, 0x36, 0x78, 0x4E, 0xAE, 0x5B, 0x02, 0x76 ),
+    BYTES_TO_T_UINT_8( 0x14, 0xF6, 0x8B, 0xF8, 0xF4, 0x92, 0x6B, 0x42 ),
+    BYTES_TO_T_UINT_8( 0xBA, 0x4D, 0x71, 0x35, 0xE7, 0x0C, 0x2C, 0x98 ),
+    BYTES_TO_T_UINT_4( 0x9B, 0xA5, 0x1F, 0xAE ),
+    /* T[4].X, T[4].Y */
+    BYTES_TO_T_UINT_8( 0xAF, 0x1C, 0x4B, 0xDF, 0x5B, 0xF2, 0x51, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x05, 0x74, 0xB1, 0x5A, 0xC6, 0x0F, 0x0E, 0x61 ),
+    BYTES_TO_T_UINT_8( 0xE8, 0x24, 0x09, 0x62, 0xAF, 0xFC, 0xDB, 0x45 ),
+    BYTES_TO_T_UINT_4( 0x43, 0xE1, 0x80, 0x55 ),
+    BYTES_TO_T_UINT_8( 0x3C, 0x82, 0xFE, 0xAD, 0xC3, 0xE5, 0xCF, 0xD8 ),
+    BYTES_TO_T_UINT_8( 0x24, 0xA2, 0x62, 0x17, 0x76, 0xF0, 0x5A, 0xFA ),
+    BYTES_TO_T_UINT_8( 0x3E, 0xB8, 0xE5, 0xAC, 0xB7, 0x66, 0x38, 0xAA ),
+    BYTES_TO_T_UINT_4( 0x97, 0xFD, 0x86, 0x05 ),
+    /* T[5].X, T[5].Y */
+    BYTES_TO_T_UINT_8( 0x59, 0xD3, 0x0C, 0x3C, 0xD1, 0x66, 0xB0, 0xF1 ),
+    BYTES_TO_T_UINT_8( 0xBC, 0x59, 0xB4, 0x8D, 0x90, 0x10, 0xB7, 0xA2 ),
+    BYTES_TO_T_UINT_8( 0x96, 0x47, 0x9B, 0xE6, 0x55, 0x8A, 0xE4, 0xEE ),
+    BYTES_TO_T_UINT_4( 0xB1, 0x49, 0xDB, 0x78 ),
+    BYTES_TO_T_UINT_8( 0x41, 0x97, 0xED, 0xDE, 0xFF, 0xB3, 0xDF, 0x48 ),
+    BYTES_TO_T_UINT_8( 0x10, 0xB9, 0x83, 0xB7, 0xEB, 0xBE, 0x40, 0x8D ),
+    BYTES_TO_T_UINT_8( 0xAF, 0xD3, 0xD3, 0xCD, 0x0E, 0x82, 0x79, 0x3D ),
+    BYTES_TO_T_UINT_4( 0x9B, 0x83, 0x1B, 0xF0 ),
+    /* T[6].X, T[6].Y */
+    BYTES_TO_T_UINT_8( 0x3F, 0x22, 0xBB, 0x54, 0xD3, 0x31, 0x56, 0xFC ),
+    BYTES_TO_T_UINT_8( 0x80, 0x36, 0xE5, 0xE0, 0x89, 0x96, 0x8E, 0x71 ),
+    BYTES_TO_T_UINT_8( 0xE1, 0xEF, 0x0A, 0xED, 0xD0, 0x11, 0x4A, 0xFF ),
+    BYTES_TO_T_UINT_4( 0x15, 0x00, 0x57, 0x27 ),
+    BYTES_TO_T_UINT_8( 0x13, 0xCA, 0x3D, 0xF7, 0x64, 0x9B, 0x6E, 0x85 ),
+    BYTES_TO_T_UINT_8( 0x90, 0xE3, 0x70, 0x6B, 0x41, 0xD7, 0xED, 0x8F ),
+    BYTES_TO_T_UINT_8( 0x02, 0x44, 0x44, 0x80, 0xCE, 0x13, 0x37, 0x92 ),
+    BYTES_TO_T_UINT_4( 0x94, 0x73, 0x80, 0x79 ),
+    /* T[7].X, T[7].Y */
+    BYTES_TO_T_UINT_8( 0xB7, 0x4D, 0x70, 0x7D, 0x31, 0x0F, 0x1C, 0x58 ),
+    BYTES_TO_T_UINT_8( 0x6D, 0x35, 0x88, 0x47, 0xC4, 0x24, 0x78, 0x3F ),
+    BYTES_TO_T_UINT_8( 0xBA, 0xF0, 0xCD, 0x91, 0x81, 0xB3, 0xDE, 0xB6 ),
+    BYTES_TO_T_UINT_4( 0x04, 0xCE, 0xC6, 0xF7 ),
+    BYTES_TO_T_UINT_8( 0xE9, 0x9C, 0x2D, 0xE8, 0xD2, 0x00, 0x8F, 0x10 ),
+    BYTES_TO_T_UINT_8( 0xD5, 0x5E, 0x7C, 0x0E, 0x0C, 0x6E, 0x58, 0x02 ),
+    BYTES_TO_T_UINT_8( 0xAE, 0x81, 0x21, 0xCE, 0x43, 0xF4, 0x24, 0x3D ),
+    BYTES_TO_T_UINT_4( 0x9E, 0xBC, 0xF0, 0xF4 ),
+    /* T[8].X, T[8].Y */
+    BYTES_TO_T_UINT_8( 0xD6, 0x10, 0xC2, 0x74, 0x4A, 0x8F, 0x8A, 0xCF ),
+    BYTES_TO_T_UINT_8( 0x89, 0x67, 0xF4, 0x2B, 0x38, 0x2B, 0x35, 0x17 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0xE7, 0x0C, 0xA9, 0xFA, 0x77, 0x5C, 0xBD ),
+    BYTES_TO_T_UINT_4( 0xE0, 0x33, 0x19, 0x2B ),
+    BYTES_TO_T_UINT_8( 0xE7, 0x3E, 0x96, 0x22, 0x53, 0xE1, 0xE9, 0xBE ),
+    BYTES_TO_T_UINT_8( 0xE0, 0x13, 0xBC, 0xA1, 0x16, 0xEC, 0x01, 0x1A ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x00, 0xC9, 0x7A, 0xC3, 0x73, 0xA5, 0x45 ),
+    BYTES_TO_T_UINT_4( 0xE1, 0xF4, 0x5E, 0xC1 ),
+    /* T[9].X, T[9].Y */
+    BYTES_TO_T_UINT_8( 0xA8, 0x95, 0xD6, 0xD9, 0x32, 0x30, 0x2B, 0xD0 ),
+    BYTES_TO_T_UINT_8( 0x77, 0x42, 0x09, 0x05, 0x61, 0x2A, 0x7E, 0x82 ),
+    BYTES_TO_T_UINT_8( 0x73, 0x84, 0xA2, 0x05, 0x88, 0x64, 0x65, 0xF9 ),
+    BYTES_TO_T_UINT_4( 0x03, 0x2D, 0x90, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0x0A, 0xE7, 0x2E, 0x85, 0x55, 0x80, 0x7C, 0x79 ),
+    BYTES_TO_T_UINT_8( 0x0F, 0xC1, 0xAC, 0x78, 0xB4, 0xAF, 0xFB, 0x6E ),
+    BYTES_TO_T_UINT_8( 0xD3, 0xC3, 0x28, 0x8E, 0x79, 0x18, 0x1F, 0x58 ),
+    BYTES_TO_T_UINT_4( 0x34, 0x46, 0xCF, 0x49 ),
+    /* T[10].X, T[10].Y */
+    BYTES_TO_T_UINT_8( 0x63, 0x5F, 0xA8, 0x6C, 0x46, 0x83, 0x43, 0xFA ),
+    BYTES_TO_T_UINT_8( 0xFA, 0xA9, 0x93, 0x11, 0xB6, 0x07, 0x57, 0x74 ),
+    BYTES_TO_T_UINT_8( 0x77, 0x2A, 0x9D, 0x03, 0x89, 0x7E, 0xD7, 0x3C ),
+    BYTES_TO_T_UINT_4( 0x7B, 0x8C, 0x62, 0xCF ),
+    BYTES_TO_T_UINT_8( 0x44, 0x2C, 0x13, 0x59, 0xCC, 0xFA, 0x84, 0x9E ),
+    BYTES_TO_T_UINT_8( 0x51, 0xB9, 0x48, 0xBC, 0x57, 0xC7, 0xB3, 0x7C ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x0A, 0x38, 0x24, 0x2E, 0x3A, 0x28, 0x25 ),
+    BYTES_TO_T_UINT_4( 0xBC, 0x0A, 0x43, 0xB8 ),
+    /* T[11].X, T[11].Y */
+    BYTES_TO_T_UINT_8( 0x59, 0x25, 0xAB, 0xC1, 0xEE, 0x70, 0x3C, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0xF3, 0xDB, 0x45, 0x1D, 0x4A, 0x80, 0x75, 0x35 ),
+    BYTES_TO_T_UINT_8( 0xE8, 0x1F, 0x4D, 0x2D, 0x9A, 0x05, 0xF4, 0xCB ),
+    BYTES_TO_T_UINT_4( 0x6B, 0x10, 0xF0, 0x5A ),
+    BYTES_TO_T_UINT_8( 0x35, 0x95, 0xE1, 0xDC, 0x15, 0x86, 0xC3, 0x7B ),
+    BYTES_TO_T_UINT_8( 0xEC, 0xDC, 0x27, 0xD1, 0x56, 0xA1, 0x14, 0x0D ),
+    BYTES_TO_T_UINT_8( 0x59, 0x0B, 0xD6, 0x77, 0x4E, 0x44, 0xA2, 0xF8 ),
+    BYTES_TO_T_UINT_4( 0x94, 0x42, 0x71, 0x1F ),
+    /* T[12].X, T[12].Y */
+    BYTES_TO_T_UINT_8( 0x30, 0x86, 0xB2, 0xB0, 0xC8, 0x2F, 0x7B, 0xFE ),
+    BYTES_TO_T_UINT_8( 0x96, 0xEF, 0xCB, 0xDB, 0xBC, 0x9E, 0x3B, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0x1B, 0x03, 0x86, 0xDD, 0x5B, 0xF5, 0x8D, 0x46 ),
+    BYTES_TO_T_UINT_4( 0x58, 0x95, 0x79, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0x84, 0x32, 0x14, 0xDA, 0x9B, 0x4F, 0x07, 0x39 ),
+    BYTES_TO_T_UINT_8( 0xB5, 0x3E, 0xFB, 0x06, 0xEE, 0xA7, 0x40, 0x40 ),
+    BYTES_TO_T_UINT_8( 0x76, 0x1F, 0xDF, 0x71, 0x61, 0xFD, 0x8B, 0xBE ),
+    BYTES_TO_T_UINT_4( 0x80, 0x8B, 0xAB, 0x8B ),
+    /* T[13].X, T[13].Y */
+    BYTES_TO_T_UINT_8( 0xC9, 0x34, 0xB3, 0xB4, 0xBC, 0x9F, 0xB0, 0x5E ),
+    BYTES_TO_T_UINT_8( 0xE6, 0x58, 0x48, 0xA8, 0x77, 0xBB, 0x13, 0x2F ),
+    BYTES_TO_T_UINT_8( 0x41, 0xC6, 0xF7, 0x34, 0xCC, 0x89, 0x21, 0x0A ),
+    BYTES_TO_T_UINT_4( 0xCA, 0x33, 0xDD, 0x1F ),
+    BYTES_TO_T_UINT_8( 0xCC, 0x81, 0xEF, 0xA4, 0xF2, 0x10, 0x0B, 0xCD ),
+    BYTES_TO_T_UINT_8( 0x83, 0xF7, 0x6E, 0x72, 0x4A, 0xDF, 0xDD, 0xE8 ),
+    BYTES_TO_T_UINT_8( 0x67, 0x23, 0x0A, 0x53, 0x03, 0x16, 0x62, 0xD2 ),
+    BYTES_TO_T_UINT_4( 0x0B, 0x76, 0xFD, 0x3C ),
+    /* T[14].X, T[14].Y */
+    BYTES_TO_T_UINT_8( 0xCB, 0x14, 0xA1, 0xFA, 0xA0, 0x18, 0xBE, 0x07 ),
+    BYTES_TO_T_UINT_8( 0x03, 0x2A, 0xE1, 0xD7, 0xB0, 0x6C, 0xA0, 0xDE ),
+    BYTES_TO_T_UINT_8( 0xD1, 0xC0, 0xB0, 0xC6, 0x63, 0x24, 0xCD, 0x4E ),
+    BYTES_TO_T_UINT_4( 0x33, 0x38, 0x2C, 0xB1 ),
+    BYTES_TO_T_UINT_8( 0xEE, 0xCD, 0x7D, 0x20, 0x0C, 0xFE, 0xAC, 0xC3 ),
+    BYTES_TO_T_UINT_8( 0x09, 0x97, 0x9F, 0xA2, 0xB6, 0x45, 0xF7, 0x7B ),
+    BYTES_TO_T_UINT_8( 0xCA, 0x99, 0xF3, 0xD2, 0x20, 0x02, 0xEB, 0x04 ),
+    BYTES_TO_T_UINT_4( 0x43, 0x18, 0x5B, 0x7B ),
+    /* T[15].X, T[15].Y */
+    BYTES_TO_T_UINT_8( 0x2B, 0xDD, 0x77, 0x91, 0x60, 0xEA, 0xFD, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0x7D, 0xD3, 0xB5, 0xD6, 0x90, 0x17, 0x0E, 0x1A ),
+    BYTES_TO_T_UINT_8( 0x00, 0xF4, 0x28, 0xC1, 0xF2, 0x53, 0xF6, 0x63 ),
+    BYTES_TO_T_UINT_4( 0x49, 0x58, 0xDC, 0x61 ),
+    BYTES_TO_T_UINT_8( 0xA8, 0x20, 0x01, 0xFB, 0xF1, 0xBD, 0x5F, 0x45 ),
+    BYTES_TO_T_UINT_8( 0xD0, 0x7F, 0x06, 0xDA, 0x11, 0xCB, 0xBA, 0xA6 ),
+    BYTES_TO_T_UINT_8( 0xA7, 0x41, 0x00, 0xA4, 0x1B, 0x30, 0x33, 0x79 ),
+    BYTES_TO_T_UINT_4( 0xF4, 0xFF, 0x27, 0xCA ),
+};
+static const mbedtls_ecp_point secp224r1_T[16] = {
+    ECP_COMB_POINT( secp224r1, 0 ),
+    ECP_COMB_POINT( secp224r1, 1 ),
+    ECP_COMB_POINT( secp224r1, 2 ),
+    ECP_COMB_POINT( secp224r1, 3 ),
+    ECP_COMB_POINT( secp224r1, 4 ),
+    ECP_COMB_POINT( secp224r1, 5 ),
+    ECP_COMB_POINT( secp224r1, 6 ),
+    ECP_COMB_POINT( secp224r1, 7 ),
+    ECP_COMB_POINT( secp224r1, 8 ),
+    ECP_COMB_POINT( secp224r1, 9 ),
+    ECP_COMB_POINT( secp224r1, 10 ),
+    ECP_COMB_POINT( secp224r1, 11 ),
+    ECP_COMB_POINT( secp224r1, 12 ),
+    ECP_COMB_POINT( secp224r1, 13 ),
+    ECP_COMB_POINT( secp224r1, 14 ),
+    ECP_COMB_POINT( secp224r1, 15 ),
+};
+#endif /* ECP_NIST_TABLES */
 #endif /* MBEDTLS_ECP_DP_SECP224R1_ENABLED */
 
 /*
@@ -183,6 +522,177 @@ static const mbedtls_mpi_uint secp256r1_n[] = {
     BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
     BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF ),
 };
+#if defined(ECP_NIST_TABLES)
+#if defined(MBEDTLS_ECP_P256_FAST)
+/* Multiplications on this curve go to ecp_p256.c, which has its own table */
+#define secp256r1_T     NULL
+#else
+static const mbedtls_mpi_uint secp256r1_T_xy[] = {
+    /* T[0].X, T[0].Y */
+    BYTES_TO_T_UINT_8( 0x96, 0xC2, 0x98, 0xD8, 0x45, 0x39, 0xA1, 0xF4 ),
+    BYTES_TO_T_UINT_8( 0xA0, 0x33, 0xEB, 0x2D, 0x81, 0x7D, 0x03, 0x77 ),
+    BYTES_TO_T_UINT_8( 0xF2, 0x40, 0xA4, 0x63, 0xE5, 0xE6, 0xBC, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0x47, 0x42, 0x2C, 0xE1, 0xF2, 0xD1, 0x17, 0x6B ),
+    BYTES_TO_T_UINT_8( 0xF5, 0x51, 0xBF, 0x37, 0x68, 0x40, 0xB6, 0xCB ),
+    BYTES_TO_T_UINT_8( 0xCE, 0x5E, 0x31, 0x6B, 0x57, 0x33, 0xCE, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x16, 0x9E, 0x0F, 0x7C, 0x4A, 0xEB, 0xE7, 0x8E ),
+    BYTES_TO_T_UINT_8( 0x9B, 0x7F, 0x1A, 0xFE, 0xE2, 0x42, 0xE3, 0x4F ),
+    /* T[1].X, T[1].Y */
+    BYTES_TO_T_UINT_8( 0x70, 0xC8, 0xBA, 0x04, 0xB7, 0x4B, 0xD2, 0xF7 ),
+    BYTES_TO_T_UINT_8( 0xAB, 0xC6, 0x23, 0x3A, 0xA0, 0x09, 0x3A, 0x59 ),
+    BYTES_TO_T_UINT_8( 0x1D, 0x9D, 0x4C, 0xF9, 0x58, 0x23, 0xCC, 0xDF ),
+    BYTES_TO_T_UINT_8( 0x02, 0xED, 0x7B, 0x29, 0x87, 0x0F, 0xFA, 0x3C ),
+    BYTES_TO_T_UINT_8( 0x40, 0x69, 0xF2, 0x40, 0x0B, 0xA3, 0x98, 0xCE ),
+    BYTES_TO_T_UINT_8( 0xAF, 0xA8, 0x48, 0x02, 0x0D, 0x1C, 0x12, 0x62 ),
+    BYTES_TO_T_UINT_8( 0x9B, 0xAF, 0x09, 0x83, 0x80, 0xAA, 0x58, 0xA7 ),
+    BYTES_TO_T_UINT_8( 0xC6, 0x12, 0xBE, 0x70, 0x94, 0x76, 0xE3, 0xE4 ),
+    /* T[2].X, T[2].Y */
+    BYTES_TO_T_UINT_8( 0x7D, 0x7D, 0xEF, 0x86, 0xFF, 0xE3, 0x37, 0xDD ),
+    BYTES_TO_T_UINT_8( 0xDB, 0x86, 0x8B, 0x08, 0x27, 0x7C, 0xD7, 0xF6 ),
+    BYTES_TO_T_UINT_8( 0x91, 0x54, 0x4C, 0x25, 0x4F, 0x9A, 0xFE, 0x28 ),
+    BYTES_TO_T_UINT_8( 0x5E, 0xFD, 0xF0, 0x6D, 0x37, 0x03, 0x69, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0x96, 0xD5, 0xDA, 0xAD, 0x92, 0x49, 0xF0, 0x9F ),
+    BYTES_TO_T_UINT_8( 0xF9, 0x73, 0x43, 0x9E, 0xAF, 0xA7, 0xD1, 0xF3 ),
+    BYTES_TO_T_UINT_8( 0x67, 0x41, 0x07, 0xDF, 0x78, 0x95, 0x3E, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0x22, 0x3D, 0xD1, 0xE6, 0x3C, 0xA5, 0xE2, 0x20 ),
+    /* T[3].X, T[3].Y */
+    BYTES_TO_T_UINT_8( 0xBF, 0x6A, 0x5D, 0x52, 0x35, 0xD7, 0xBF, 0xAE ),
+    BYTES_TO_T_UINT_8( 0x5A, 0xA2, 0xBE, 0x96, 0xF4, 0xF8, 0x02, 0xC3 ),
+    BYTES_TO_T_UINT_8( 0xA4, 0x20, 0x49, 0x54, 0xEA, 0xB3, 0x82, 0xDB ),
+    BYTES_TO_T_UINT_8( 0x2E, 0xDB, 0xEA, 0x02, 0xD1, 0x75, 0x1C, 0x62 ),
+    BYTES_TO_T_UINT_8( 0xF0, 0x85, 0xF4, 0x9E, 0x4C, 0xDC, 0x39, 0x89 ),
+    BYTES_TO_T_UINT_8( 0x63, 0x6D, 0xC4, 0x57, 0xD8, 0x03, 0x5D, 0x22 ),
+    BYTES_TO_T_UINT_8( 0x70, 0x7F, 0x2D, 0x52, 0x6F, 0xC9, 0xDA, 0x4F ),
+    BYTES_TO_T_UINT_8( 0x9D, 0x64, 0xFA, 0xB4, 0xFE, 0xA4, 0xC4, 0xD7 ),
+    /* T[4].X, T[4].Y */
+    BYTES_TO_T_UINT_8( 0x2A, 0x37, 0xB9, 0xC0, 0xAA, 0x59, 0xC6, 0x8B ),
+    BYTES_TO_T_UINT_8( 0x3F, 0x58, 0xD9, 0xED, 0x58, 0x99, 0x65, 0xF7 ),
+    BYTES_TO_T_UINT_8( 0x88, 0x7D, 0x26, 0x8C, 0x4A, 0xF9, 0x05, 0x9F ),
+    BYTES_TO_T_UINT_8( 0x9D, 0x73, 0x9A, 0xC9, 0xE7, 0x46, 0xDC, 0x00 ),
+    BYTES_TO_T_UINT_8( 0xF2, 0xD0, 0x55, 0xDF, 0x00, 0x0A, 0xF5, 0x4A ),
+    BYTES_TO_T_UINT_8( 0x6A, 0xBF, 0x56, 0x81, 0x2D, 0x20, 0xEB, 0xB5 ),
+    BYTES_TO_T_UINT_8( 0x11, 0xC1, 0x28, 0x52, 0xAB, 0xE3, 0xD1, 0x40 ),
+    BYTES_TO_T_UINT_8( 0x24, 0x34, 0x79, 0x45, 0x57, 0xA5, 0x12, 0x03 ),
+    /* T[5].X, T[5].Y */
+    BYTES_TO_T_UINT_8( 0xEE, 0xCF, 0xB8, 0x7E, 0xF7, 0x92, 0x96, 0x8D ),
+    BYTES_TO_T_UINT_8( 0x3D, 0x01, 0x8C, 0x0D, 0x23, 0xF2, 0xE3, 0x05 ),
+    BYTES_TO_T_UINT_8( 0x59, 0x2E, 0xE3, 0x84, 0x52, 0x7A, 0x34, 0x76 ),
+    BYTES_TO_T_UINT_8( 0xE5, 0xA1, 0xB0, 0x15, 0x90, 0xE2, 0x53, 0x3C ),
+    BYTES_TO_T_UINT_8( 0xD4, 0x98, 0xE7, 0xFA, 0xA5, 0x7D, 0x8B, 0x53 ),
+    BYTES_TO_T_UINT_8( 0x91, 0x35, 0xD2, 0x00, 0xD1, 0x1B, 0x9F, 0x1B ),
+    BYTES_TO_T_UINT_8( 0x3F, 0x69, 0x08, 0x9A, 0x72, 0xF0, 0xA9, 0x11 ),
+    BYTES_TO_T_UINT_8( 0xB3, 0xFE, 0x0E, 0x14, 0xDA, 0x7C, 0x0E, 0xD3 ),
+    /* T[6].X, T[6].Y */
+    BYTES_TO_T_UINT_8( 0x83, 0xF6, 0xE8, 0xF8, 0x87, 0xF7, 0xFC, 0x6D ),
+    BYTES_TO_T_UINT_8( 0x90, 0xBE, 0x7F, 0x3F, 0x7A, 0x2B, 0xD7, 0x13 ),
+    BYTES_TO_T_UINT_8( 0xCF, 0x32, 0xF2, 0x2D, 0x94, 0x6D, 0x42, 0xFD ),
+    BYTES_TO_T_UINT_8( 0xAD, 0x9A, 0xE3, 0x5F, 0x42, 0xBB, 0x84, 0xED ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x95, 0x29, 0x73, 0xA1, 0x67, 0x3E, 0x02 ),
+    BYTES_TO_T_UINT_8( 0xE3, 0x30, 0x54, 0x35, 0x8E, 0x0A, 0xDD, 0x67 ),
+    BYTES_TO_T_UINT_8( 0x03, 0xD7, 0xA1, 0x97, 0x61, 0x3B, 0xF8, 0x0C ),
+    BYTES_TO_T_UINT_8( 0xF2, 0x33, 0x3C, 0x58, 0x55, 0x34, 0x23, 0xA3 ),
+    /* T[7].X, T[7].Y */
+    BYTES_TO_T_UINT_8( 0x99, 0x5D, 0x16, 0x5F, 0x7B, 0xBC, 0xBB, 0xCE ),
+    BYTES_TO_T_UINT_8( 0x61, 0xEE, 0x4E, 0x8A, 0xC1, 0x51, 0xCC, 0x50 ),
+    BYTES_TO_T_UINT_8( 0x1F, 0x0D, 0x4D, 0x1B, 0x53, 0x23, 0x1D, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0xDA, 0x2A, 0x38, 0x66, 0x52, 0x84, 0xE1, 0x95 ),
+    BYTES_TO_T_UINT_8( 0x5B, 0x9B, 0x83, 0x0A, 0x81, 0x4F, 0xAD, 0xAC ),
+    BYTES_TO_T_UINT_8( 0x0F, 0xFF, 0x42, 0x41, 0x6E, 0xA9, 0xA2, 0xA0 ),
+    BYTES_TO_T_UINT_8( 0x2F, 0xA1, 0x4F, 0x1F, 0x89, 0x82, 0xAA, 0x3E ),
+    BYTES_TO_T_UINT_8( 0xF3, 0xB8, 0x0F, 0x6B, 0x8F, 0x8C, 0xD6, 0x68 ),
+    /* T[8].X, T[8].Y */
+    BYTES_TO_T_UINT_8( 0xF1, 0xB3, 0xBB, 0x51, 0x69, 0xA2, 0x11, 0x93 ),
+    BYTES_TO_T_UINT_8( 0x65, 0x4F, 0x0F, 0x8D, 0xBD, 0x26, 0x0F, 0xE8 ),
+    BYTES_TO_T_UINT_8( 0xB9, 0xCB, 0xEC, 0x6B, 0x34, 0xC3, 0x3D, 0x9D ),
+    BYTES_TO_T_UINT_8( 0xE4, 0x5D, 0x1E, 0x10, 0xD5, 0x44, 0xE2, 0x54 ),
+    BYTES_TO_T_UINT_8( 0x28, 0x9E, 0xB1, 0xF1, 0x6E, 0x4C, 0xAD, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0xB7, 0xE3, 0xC2, 0x58, 0xC0, 0xFB, 0x34, 0x43 ),
+    BYTES_TO_T_UINT_8( 0x25, 0x9C, 0xDF, 0x35, 0x07, 0x41, 0xBD, 0x19 ),
+    BYTES_TO_T_UINT_8( 0xB6, 0x6E, 0x10, 0xEC, 0x0E, 0xEC, 0xBB, 0xD6 ),
+    /* T[9].X, T[9].Y */
+    BYTES_TO_T_UINT_8( 0xC8, 0xCF, 0xEF, 0x3F, 0x83, 0x1A, 0x88, 0xE8 ),
+    BYTES_TO_T_UINT_8( 0x0B, 0x29, 0xB5, 0xB9, 0xE0, 0xC9, 0xA3, 0xAE ),
+    BYTES_TO_T_UINT_8( 0x88, 0x46, 0x1E, 0x77, 0xCD, 0x7E, 0xB3, 0x10 ),
+    BYTES_TO_T_UINT_8( 0xB6, 0x21, 0xD0, 0xD4, 0xA3, 0x16, 0x08, 0xEE ),
+    BYTES_TO_T_UINT_8( 0xA1, 0xCA, 0xA8, 0xB3, 0xBF, 0x29, 0x99, 0x8E ),
+    BYTES_TO_T_UINT_8( 0xD1, 0xF2, 0x05, 0xC1, 0xCF, 0x5D, 0x91, 0x48 ),
+    BYTES_TO_T_UINT_8( 0x9F, 0x01, 0x49, 0xDB, 0x82, 0xDF, 0x5F, 0x3A ),
+    BYTES_TO_T_UINT_8( 0xE1, 0x06, 0x90, 0xAD, 0xE3, 0x38, 0xA4, 0xC4 ),
+    /* T[10].X, T[10].Y */
+    BYTES_TO_T_UINT_8( 0xC9, 0xD2, 0x3A, 0xE8, 0x03, 0xC5, 0x6D, 0x5D ),
+    BYTES_TO_T_UINT_8( 0xBE, 0x35, 0xD0, 0xAE, 0x1D, 0x7A, 0x9F, 0xCA ),
+    BYTES_TO_T_UINT_8( 0x33, 0x1E, 0xD2, 0xCB, 0xAC, 0x88, 0x27, 0x55 ),
+    BYTES_TO_T_UINT_8( 0xF0, 0xB9, 0x9C, 0xE0, 0x31, 0xDD, 0x99, 0x86 ),
+    BYTES_TO_T_UINT_8( 0x61, 0xF9, 0x9B, 0x32, 0x96, 0x41, 0x58, 0x38 ),
+    BYTES_TO_T_UINT_8( 0xF9, 0x5A, 0x2A, 0xB8, 0x96, 0x0E, 0xB2, 0x4C ),
+    BYTES_TO_T_UINT_8( 0xC1, 0x78, 0x2C, 0xC7, 0x08, 0x99, 0x19, 0x24 ),
+    BYTES_TO_T_UINT_8( 0xB7, 0x59, 0x28, 0xE9, 0x84, 0x54, 0xE6, 0x16 ),
+    /* T[11].X, T[11].Y */
+    BYTES_TO_T_UINT_8( 0xDD, 0x38, 0x30, 0xDB, 0x70, 0x2C, 0x0A, 0xA2 ),
+    BYTES_TO_T_UINT_8( 0x7C, 0x5C, 0x9D, 0xE9, 0xD5, 0x46, 0x0B, 0x5F ),
+    BYTES_TO_T_UINT_8( 0x83, 0x0B, 0x60, 0x4B, 0x37, 0x7D, 0xB9, 0xC9 ),
+    BYTES_TO_T_UINT_8( 0x5E, 0x24, 0xF3, 0x3D, 0x79, 0x7F, 0x6C, 0x18 ),
+    BYTES_TO_T_UINT_8( 0x7F, 0xE5, 0x1C, 0x4F, 0x60, 0x24, 0xF7, 0x2A ),
+    BYTES_TO_T_UINT_8( 0xED, 0xD8, 0xE2, 0x91, 0x7F, 0x89, 0x49, 0x92 ),
+    BYTES_TO_T_UINT_8( 0x97, 0xA7, 0x2E, 0x8D, 0x6A, 0xB3, 0x39, 0x81 ),
+    BYTES_TO_T_UINT_8( 0x13, 0x89, 0xB5, 0x9A, 0xB8, 0x8D, 0x42, 0x9C ),
+    /* T[12].X, T[12].Y */
+    BYTES_TO_T_UINT_8( 0x8D, 0x45, 0xE6, 0x4B, 0x3F, 0x4F, 0x1E, 0x1F ),
+    BYTES_TO_T_UINT_8( 0x47, 0x65, 0x5E, 0x59, 0x22, 0xCC, 0x72, 0x5F ),
+    BYTES_TO_T_UINT_8( 0xF1, 0x93, 0x1A, 0x27, 0x1E, 0x34, 0xC5, 0x5B ),
+    BYTES_TO_T_UINT_8( 0x63, 0xF2, 0xA5, 0x58, 0x5C, 0x15, 0x2E, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0xF4, 0x7F, 0xBA, 0x58, 0x5A, 0x84, 0x6F, 0x5F ),
+    BYTES_TO_T_UINT_8( 0xAD, 0xA6, 0x36, 0x7E, 0xDC, 0xF7, 0xE1, 0x67 ),
+    BYTES_TO_T_UINT_8( 0x04, 0x4D, 0xAA, 0xEE, 0x57, 0x76, 0x3A, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0x4E, 0x7E, 0x26, 0x18, 0x22, 0x23, 0x9F, 0xFF ),
+    /* T[13].X, T[13].Y */
+    BYTES_TO_T_UINT_8( 0x1D, 0x4C, 0x64, 0xC7, 0x55, 0x02, 0x3F, 0xE3 ),
+    BYTES_TO_T_UINT_8( 0xD8, 0x02, 0x90, 0xBB, 0xC3, 0xEC, 0x30, 0x40 ),
+    BYTES_TO_T_UINT_8( 0x9F, 0x6F, 0x64, 0xF4, 0x16, 0x69, 0x48, 0xA4 ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x44, 0x9C, 0x95, 0x0C, 0x7D, 0x67, 0x5E ),
+    BYTES_TO_T_UINT_8( 0x44, 0x91, 0x8B, 0xD8, 0xD0, 0xD7, 0xE7, 0xE2 ),
+    BYTES_TO_T_UINT_8( 0x1F, 0xF9, 0x48, 0x62, 0x6F, 0xA8, 0x93, 0x5D ),
+    BYTES_TO_T_UINT_8( 0xEA, 0x3A, 0x99, 0x02, 0xD5, 0x0B, 0x3D, 0xE3 ),
+    BYTES_TO_T_UINT_8( 0x1E, 0xD3, 0x00, 0x31, 0xE6, 0x0C, 0x9F, 0x44 ),
+    /* T[14].X, T[14].Y */
+    BYTES_TO_T_UINT_8( 0x56, 0xB2, 0xAA, 0xFD, 0x88, 0x15, 0xDF, 0x52 ),
+    BYTES_TO_T_UINT_8( 0x4C, 0x35, 0x27, 0x31, 0x44, 0xCD, 0xC0, 0x68 ),
+    BYTES_TO_T_UINT_8( 0x53, 0xF8, 0x91, 0xA5, 0x71, 0x94, 0x84, 0x2A ),
+    BYTES_TO_T_UINT_8( 0x92, 0xCB, 0xD0, 0x93, 0xE9, 0x88, 0xDA, 0xE4 ),
+    BYTES_TO_T_UINT_8( 0x24, 0xC6, 0x39, 0x16, 0x5D, 0xA3, 0x1E, 0x6D ),
+    BYTES_TO_T_UINT_8( 0xBA, 0x07, 0x37, 0x26, 0x36, 0x2A, 0xFE, 0x60 ),
+    BYTES_TO_T_UINT_8( 0x51, 0xBC, 0xF3, 0xD0, 0xDE, 0x50, 0xFC, 0x97 ),
+    BYTES_TO_T_UINT_8( 0x80, 0x2E, 0x06, 0x10, 0x15, 0x4D, 0xFA, 0xF7 ),
+    /* T[15].X, T[15].Y */
+    BYTES_TO_T_UINT_8( 0x27, 0x65, 0x69, 0x5B, 0x66, 0xA2, 0x75, 0x2E ),
+    BYTES_TO_T_UINT_8( 0x9C, 0x16, 0x00, 0x5A, 0xB0, 0x30, 0x25, 0x1A ),
+    BYTES_TO_T_UINT_8( 0x42, 0xFB, 0x86, 0x42, 0x80, 0xC1, 0xC4, 0x76 ),
+    BYTES_TO_T_UINT_8( 0x5B, 0x1D, 0x83, 0x8E, 0x94, 0x01, 0x5F, 0x82 ),
+    BYTES_TO_T_UINT_8( 0x39, 0x37, 0x70, 0xEF, 0x1F, 0xA1, 0xF0, 0xDB ),
+    BYTES_TO_T_UINT_8( 0x6A, 0x10, 0x5B, 0xCE, 0xC4, 0x9B, 0x6F, 0x10 ),
+    BYTES_TO_T_UINT_8( 0x50, 0x11, 0x11, 0x24, 0x4F, 0x4C, 0x79, 0x61 ),
+    BYTES_TO_T_UINT_8( 0x17, 0x3A, 0x72, 0xBC, 0xFE, 0x72, 0x58, 0x43 ),
+};
+static const mbedtls_ecp_point secp256r1_T[16] = {
+    ECP_COMB_POINT( secp256r1, 0 ),
+    ECP_COMB_POINT( secp256r1, 1 ),
+    ECP_COMB_POINT( secp256r1, 2 ),
+    ECP_COMB_POINT( secp256r1, 3 ),
+    ECP_COMB_POINT( secp256r1, 4 ),
+    ECP_COMB_POINT( secp256r1, 5 ),
+    ECP_COMB_POINT( secp256r1, 6 ),
+    ECP_COMB_POINT( secp256r1, 7 ),
+    ECP_COMB_POINT( secp256r1, 8 ),
+    ECP_COMB_POINT( secp256r1, 9 ),
+    ECP_COMB_POINT( secp256r1, 10 ),
+    ECP_COMB_POINT( secp256r1, 11 ),
+    ECP_COMB_POINT( secp256r1, 12 ),
+    ECP_COMB_POINT( secp256r1, 13 ),
+    ECP_COMB_POINT( secp256r1, 14 ),
+    ECP_COMB_POINT( secp256r1, 15 ),
+};
+#endif /* MBEDTLS_ECP_P256_FAST */
+#endif /* ECP_NIST_TABLES */
 #endif /* MBEDTLS_ECP_DP_SECP256R1_ENABLED */
 
 /*
@@ -229,6 +739,466 @@ static const mbedtls_mpi_uint secp384r1_n[] = {
     BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
     BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
 };
+#if defined(ECP_NIST_TABLES)
+#if defined(MBEDTLS_ECP_P384_FAST) && !defined(MBEDTLS_ECP_RESTARTABLE)
+/* Multiplications on this curve go to ecp_p384.c, which has its own table,
+ * except restartable ones */
+#define secp384r1_T     NULL
+#else
+static const mbedtls_mpi_uint secp384r1_T_xy[] = {
+    /* T[0].X, T[0].Y */
+    BYTES_TO_T_UINT_8( 0xB7, 0x0A, 0x76, 0x72, 0x38, 0x5E, 0x54, 0x3A ),
+    BYTES_TO_T_UINT_8( 0x6C, 0x29, 0x55, 0xBF, 0x5D, 0xF2, 0x02, 0x55 ),
+    BYTES_TO_T_UINT_8( 0x38, 0x2A, 0x54, 0x82, 0xE0, 0x41, 0xF7, 0x59 ),
+    BYTES_TO_T_UINT_8( 0x98, 0x9B, 0xA7, 0x8B, 0x62, 0x3B, 0x1D, 0x6E ),
+    BYTES_TO_T_UINT_8( 0x74, 0xAD, 0x20, 0xF3, 0x1E, 0xC7, 0xB1, 0x8E ),
+    BYTES_TO_T_UINT_8( 0x37, 0x05, 0x8B, 0xBE, 0x22, 0xCA, 0x87, 0xAA ),
+    BYTES_TO_T_UINT_8( 0x5F, 0x0E, 0xEA, 0x90, 0x7C, 0x1D, 0x43, 0x7A ),
+    BYTES_TO_T_UINT_8( 0x9D, 0x81, 0x7E, 0x1D, 0xCE, 0xB1, 0x60, 0x0A ),
+    BYTES_TO_T_UINT_8( 0xC0, 0xB8, 0xF0, 0xB5, 0x13, 0x31, 0xDA, 0xE9 ),
+    BYTES_TO_T_UINT_8( 0x7C, 0x14, 0x9A, 0x28, 0xBD, 0x1D, 0xF4, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0x29, 0xDC, 0x92, 0x92, 0xBF, 0x98, 0x9E, 0x5D ),
+    BYTES_TO_T_UINT_8( 0x6F, 0x2C, 0x26, 0x96, 0x4A, 0xDE, 0x17, 0x36 ),
+    /* T[1].X, T[1].Y */
+    BYTES_TO_T_UINT_8( 0x46, 0x92, 0x00, 0x2C, 0x78, 0xDB, 0x1F, 0x37 ),
+    BYTES_TO_T_UINT_8( 0x17, 0xF3, 0xEB, 0xB7, 0x06, 0xF7, 0xB6, 0xBC ),
+    BYTES_TO_T_UINT_8( 0x3D, 0xBC, 0x2C, 0xCF, 0xD8, 0xED, 0x53, 0xE7 ),
+    BYTES_TO_T_UINT_8( 0x52, 0x75, 0x7B, 0xA3, 0xAB, 0xC3, 0x2C, 0x85 ),
+    BYTES_TO_T_UINT_8( 0xE5, 0x9D, 0x78, 0x41, 0xF6, 0x76, 0x84, 0xAC ),
+    BYTES_TO_T_UINT_8( 0x54, 0x56, 0xE8, 0x52, 0xB3, 0xCB, 0xA8, 0xBD ),
+    BYTES_TO_T_UINT_8( 0x6D, 0xF2, 0xAE, 0xA4, 0xB6, 0x89, 0x1B, 0xDA ),
+    BYTES_TO_T_UINT_8( 0x01, 0x0F, 0xCE, 0x1C, 0x7C, 0xF6, 0x50, 0x4C ),
+    BYTES_TO_T_UINT_8( 0x4C, 0xEB, 0x90, 0xE6, 0x4D, 0xC7, 0xD4, 0x7A ),
+    BYTES_TO_T_UINT_8( 0xD1, 0x49, 0x2D, 0x8A, 0x01, 0x99, 0x60, 0x94 ),
+    BYTES_TO_T_UINT_8( 0x5F, 0x80, 0x9B, 0x9B, 0x6A, 0xB0, 0x07, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0xC2, 0xA2, 0xEE, 0x59, 0xBE, 0x95, 0xBC, 0x23 ),
+    /* T[2].X, T[2].Y */
+    BYTES_TO_T_UINT_8( 0xE6, 0x9D, 0x56, 0xAE, 0x59, 0xFB, 0x1F, 0x98 ),
+    BYTES_TO_T_UINT_8( 0xCF, 0xAC, 0x91, 0x80, 0x87, 0xA8, 0x6E, 0x58 ),
+    BYTES_TO_T_UINT_8( 0x30, 0x08, 0xA7, 0x08, 0x94, 0x32, 0xFC, 0x67 ),
+    BYTES_TO_T_UINT_8( 0x9F, 0x29, 0x9E, 0x84, 0xF4, 0xE5, 0x6E, 0x7E ),
+    BYTES_TO_T_UINT_8( 0x55, 0x21, 0xB9, 0x50, 0x24, 0xF8, 0x9C, 0xC7 ),
+    BYTES_TO_T_UINT_8( 0x34, 0x04, 0x01, 0xC2, 0xFB, 0x77, 0x3E, 0xDE ),
+    BYTES_TO_T_UINT_8( 0x00, 0x38, 0xEE, 0xE3, 0xC7, 0x9D, 0xEC, 0xA6 ),
+    BYTES_TO_T_UINT_8( 0xB6, 0x88, 0xCF, 0x43, 0xFA, 0x92, 0x5E, 0x8E ),
+    BYTES_TO_T_UINT_8( 0xE9, 0xCA, 0x43, 0xF8, 0x3B, 0x49, 0x7E, 0x75 ),
+    BYTES_TO_T_UINT_8( 0x1C, 0xE7, 0xEB, 0x17, 0x45, 0x86, 0xC2, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0x92, 0x69, 0x57, 0x32, 0xE0, 0x9C, 0xD1, 0x00 ),
+    BYTES_TO_T_UINT_8( 0xD9, 0x10, 0xB8, 0x4D, 0xB8, 0xF4, 0x0D, 0xE3 ),
+    /* T[3].X, T[3].Y */
+    BYTES_TO_T_UINT_8( 0x60, 0xDC, 0x9A, 0xB2, 0x79, 0x39, 0x27, 0x16 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0x71, 0xE4, 0x3B, 0x4D, 0x60, 0x0C, 0xA3 ),
+    BYTES_TO_T_UINT_8( 0x55, 0xBD, 0x19, 0x40, 0xFA, 0x19, 0x2A, 0x5A ),
+    BYTES_TO_T_UINT_8( 0x4D, 0xF8, 0x1E, 0x43, 0xA1, 0x50, 0x8D, 0xEF ),
+    BYTES_TO_T_UINT_8( 0xA3, 0x18, 0x7C, 0x41, 0xFA, 0x7C, 0x1B, 0x58 ),
+    BYTES_TO_T_UINT_8( 0x00, 0x59, 0x24, 0xC4, 0xE9, 0xB7, 0xD3, 0xAD ),
+    BYTES_TO_T_UINT_8( 0xBB, 0x01, 0x3D, 0x63, 0x54, 0x45, 0x6F, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x7B, 0xB2, 0x19, 0xA3, 0x86, 0x1D, 0x42, 0x34 ),
+    BYTES_TO_T_UINT_8( 0x84, 0x02, 0x87, 0x18, 0x92, 0x52, 0x1A, 0x71 ),
+    BYTES_TO_T_UINT_8( 0x6C, 0x18, 0xB1, 0x5D, 0x18, 0x1B, 0x37, 0xFE ),
+    BYTES_TO_T_UINT_8( 0xF4, 0x74, 0x61, 0xBA, 0x18, 0xAF, 0x40, 0x30 ),
+    BYTES_TO_T_UINT_8( 0xDA, 0x7D, 0x3C, 0x52, 0x0F, 0x07, 0xB0, 0x6F ),
+    /* T[4].X, T[4].Y */
+    BYTES_TO_T_UINT_8( 0x09, 0x39, 0x13, 0xAA, 0x60, 0x15, 0x99, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x17, 0x00, 0xCB, 0xC6, 0xB1, 0xDB, 0x97, 0x90 ),
+    BYTES_TO_T_UINT_8( 0xE6, 0xFA, 0x60, 0xB8, 0x24, 0xE4, 0x7D, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x75, 0xB3, 0x70, 0xB2, 0x83, 0xB1, 0x9B ),
+    BYTES_TO_T_UINT_8( 0xA3, 0xE3, 0x6C, 0xCD, 0x33, 0x62, 0x7A, 0x56 ),
+    BYTES_TO_T_UINT_8( 0x88, 0x30, 0xDC, 0x0F, 0x9F, 0xBB, 0xB8, 0xAA ),
+    BYTES_TO_T_UINT_8( 0xA6, 0xD5, 0x0A, 0x60, 0x81, 0xB9, 0xC5, 0x16 ),
+    BYTES_TO_T_UINT_8( 0x44, 0xAA, 0x2F, 0xD6, 0xF2, 0x73, 0xDF, 0xEB ),
+    BYTES_TO_T_UINT_8( 0xF3, 0x7B, 0x74, 0xC9, 0xB3, 0x5B, 0x95, 0x6D ),
+    BYTES_TO_T_UINT_8( 0xAC, 0x04, 0xEB, 0x15, 0xC8, 0x5F, 0x00, 0xF6 ),
+    BYTES_TO_T_UINT_8( 0xB5, 0x50, 0x20, 0x28, 0xD1, 0x01, 0xAF, 0xF0 ),
+    BYTES_TO_T_UINT_8( 0x28, 0x6D, 0x4F, 0x31, 0x81, 0x2F, 0x94, 0x48 ),
+    /* T[5].X, T[5].Y */
+    BYTES_TO_T_UINT_8( 0x46, 0x2F, 0xD8, 0xB6, 0x63, 0x7C, 0xE9, 0x50 ),
+    BYTES_TO_T_UINT_8( 0xD9, 0x8C, 0xB9, 0x14, 0xD9, 0x37, 0x63, 0xDE ),
+    BYTES_TO_T_UINT_8( 0x10, 0x02, 0xB8, 0x46, 0xAD, 0xCE, 0x7B, 0x38 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x47, 0x2D, 0x66, 0xA7, 0xE9, 0x33, 0x23 ),
+    BYTES_TO_T_UINT_8( 0x92, 0xF9, 0x93, 0x94, 0xA8, 0x48, 0xB3, 0x4F ),
+    BYTES_TO_T_UINT_8( 0xE9, 0x4A, 0xAC, 0x51, 0x08, 0x72, 0x2F, 0x1A ),
+    BYTES_TO_T_UINT_8( 0xDA, 0xAD, 0xA0, 0xF9, 0x81, 0xE1, 0x78, 0x97 ),
+    BYTES_TO_T_UINT_8( 0x3A, 0x9A, 0x63, 0xD8, 0xBA, 0x79, 0x1A, 0x17 ),
+    BYTES_TO_T_UINT_8( 0x34, 0x31, 0x7B, 0x7A, 0x5A, 0x5D, 0x7D, 0x2D ),
+    BYTES_TO_T_UINT_8( 0x83, 0x96, 0x12, 0x4B, 0x19, 0x09, 0xE0, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x55, 0x8A, 0x57, 0xEE, 0x4E, 0x6E, 0x7E, 0xEC ),
+    BYTES_TO_T_UINT_8( 0x11, 0x9D, 0x69, 0xDC, 0xB3, 0xDA, 0xD8, 0x08 ),
+    /* T[6].X, T[6].Y */
+    BYTES_TO_T_UINT_8( 0x68, 0x49, 0x03, 0x03, 0x33, 0x6F, 0x28, 0x4A ),
+    BYTES_TO_T_UINT_8( 0x5D, 0xDB, 0xA7, 0x05, 0x8C, 0xF3, 0x4D, 0xFB ),
+    BYTES_TO_T_UINT_8( 0x8E, 0x92, 0xB1, 0xA8, 0xEC, 0x0D, 0x64, 0x3B ),
+    BYTES_TO_T_UINT_8( 0x4E, 0xFC, 0xFD, 0xD0, 0x4B, 0x88, 0x1B, 0x5D ),
+    BYTES_TO_T_UINT_8( 0x83, 0x9C, 0x51, 0x69, 0xCE, 0x71, 0x73, 0xF5 ),
+    BYTES_TO_T_UINT_8( 0xB8, 0x5A, 0x14, 0x23, 0x1A, 0x46, 0x63, 0x5F ),
+    BYTES_TO_T_UINT_8( 0xBC, 0x4C, 0x70, 0x44, 0x18, 0xCD, 0xEF, 0xED ),
+    BYTES_TO_T_UINT_8( 0xC2, 0x49, 0xDD, 0x64, 0x7E, 0x7E, 0x4D, 0x92 ),
+    BYTES_TO_T_UINT_8( 0xA2, 0x32, 0x7C, 0x09, 0xD0, 0x3F, 0xD6, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x6D, 0xE0, 0x4F, 0x65, 0x0C, 0x7A, 0x54, 0x3E ),
+    BYTES_TO_T_UINT_8( 0x16, 0xFA, 0xFB, 0x4A, 0xB4, 0x79, 0x5A, 0x8C ),
+    BYTES_TO_T_UINT_8( 0x04, 0x5D, 0x1B, 0x2B, 0xDA, 0xBC, 0x9A, 0x74 ),
+    /* T[7].X, T[7].Y */
+    BYTES_TO_T_UINT_8( 0x51, 0xAC, 0x56, 0xF7, 0x5F, 0x51, 0x68, 0x0B ),
+    BYTES_TO_T_UINT_8( 0xC6, 0xE0, 0x1D, 0xBC, 0x13, 0x4E, 0xAC, 0x03 ),
+    BYTES_TO_T_UINT_8( 0xB7, 0xF5, 0xC5, 0xE6, 0xD2, 0x88, 0xBA, 0xCB ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x0E, 0x28, 0x23, 0x58, 0x67, 0xFA, 0xEE ),
+    BYTES_TO_T_UINT_8( 0x9E, 0x80, 0x4B, 0xD8, 0xC4, 0xDF, 0x15, 0xE4 ),
+    BYTES_TO_T_UINT_8( 0xF1, 0x0E, 0x58, 0xE6, 0x2C, 0x59, 0xC2, 0x03 ),
+    BYTES_TO_T_UINT_8( 0x9B, 0x26, 0x27, 0x99, 0x16, 0x2B, 0x22, 0x0B ),
+    BYTES_TO_T_UINT_8( 0xBA, 0xF3, 0x8F, 0xC3, 0x2A, 0x9B, 0xFC, 0x38 ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x2E, 0x83, 0x3D, 0xFE, 0x9E, 0x3C, 0x1B ),
+    BYTES_TO_T_UINT_8( 0x08, 0x57, 0xCD, 0x2D, 0xC1, 0x49, 0x38, 0xB5 ),
+    BYTES_TO_T_UINT_8( 0x95, 0x42, 0x8B, 0x33, 0x89, 0x1F, 0xEA, 0x01 ),
+    BYTES_TO_T_UINT_8( 0xAA, 0x1D, 0x13, 0xD7, 0x50, 0xBB, 0x3E, 0xEB ),
+    /* T[8].X, T[8].Y */
+    BYTES_TO_T_UINT_8( 0xD2, 0x9A, 0x52, 0xD2, 0x54, 0x7C, 0x97, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0x33, 0x6E, 0xED, 0xD9, 0x87, 0x50, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0x5A, 0x35, 0x7E, 0x16, 0x40, 0x15, 0x83, 0xB8 ),
+    BYTES_TO_T_UINT_8( 0x33, 0x2B, 0xA4, 0xAB, 0x03, 0x91, 0xEA, 0xFE ),
+    BYTES_TO_T_UINT_8( 0xC1, 0x47, 0x39, 0xEF, 0x05, 0x59, 0xD0, 0x90 ),
+    BYTES_TO_T_UINT_8( 0xBF, 0x24, 0x0D, 0x76, 0x11, 0x53, 0x08, 0xAF ),
+    BYTES_TO_T_UINT_8( 0x1F, 0x2F, 0xDD, 0xBD, 0x50, 0x48, 0xB1, 0xE5 ),
+    BYTES_TO_T_UINT_8( 0x80, 0x1C, 0x84, 0x55, 0x78, 0x14, 0xEB, 0xF6 ),
+    BYTES_TO_T_UINT_8( 0xD9, 0x5E, 0x3E, 0xA6, 0xAF, 0xF6, 0xC7, 0x04 ),
+    BYTES_TO_T_UINT_8( 0xE7, 0x11, 0xE2, 0x65, 0xCA, 0x41, 0x95, 0x3B ),
+    BYTES_TO_T_UINT_8( 0xAE, 0x83, 0xD8, 0xE6, 0x4D, 0x22, 0x06, 0x2D ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x7F, 0x25, 0x2A, 0xAA, 0x28, 0x46, 0x97 ),
+    /* T[9].X, T[9].Y */
+    BYTES_TO_T_UINT_8( 0x79, 0xDB, 0x15, 0x56, 0x84, 0xCB, 0xC0, 0x56 ),
+    BYTES_TO_T_UINT_8( 0x56, 0xDB, 0x0E, 0x08, 0xC9, 0xF5, 0xD4, 0x9E ),
+    BYTES_TO_T_UINT_8( 0xE6, 0x62, 0xD0, 0x1A, 0x7C, 0x13, 0xD5, 0x07 ),
+    BYTES_TO_T_UINT_8( 0x7D, 0xAD, 0x53, 0xE0, 0x32, 0x21, 0xA0, 0xC0 ),
+    BYTES_TO_T_UINT_8( 0xC5, 0x38, 0x81, 0x21, 0x23, 0x0E, 0xD2, 0xBB ),
+    BYTES_TO_T_UINT_8( 0x1C, 0x51, 0x05, 0xD0, 0x1E, 0x82, 0xA9, 0x71 ),
+    BYTES_TO_T_UINT_8( 0xA7, 0xC3, 0x27, 0xBF, 0xC6, 0xAA, 0xB7, 0xB9 ),
+    BYTES_TO_T_UINT_8( 0xCB, 0x65, 0x45, 0xDF, 0xB9, 0x46, 0x17, 0x46 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0x38, 0x3F, 0xB2, 0xB1, 0x5D, 0xCA, 0x1C ),
+    BYTES_TO_T_UINT_8( 0x88, 0x29, 0x6C, 0x63, 0xE9, 0xD7, 0x48, 0xB8 ),
+    BYTES_TO_T_UINT_8( 0xBC, 0xF1, 0xD7, 0x99, 0x8C, 0xC2, 0x05, 0x99 ),
+    BYTES_TO_T_UINT_8( 0x6D, 0xE6, 0x5E, 0x82, 0x6D, 0xE5, 0x7E, 0xD5 ),
+    /* T[10].X, T[10].Y */
+    BYTES_TO_T_UINT_8( 0x7B, 0x61, 0xFA, 0x7D, 0x01, 0xDB, 0xB6, 0x63 ),
+    BYTES_TO_T_UINT_8( 0x11, 0xC6, 0x58, 0x39, 0xF4, 0xC6, 0x82, 0x23 ),
+    BYTES_TO_T_UINT_8( 0x47, 0x5A, 0x7A, 0x80, 0x08, 0xCD, 0xAA, 0xD8 ),
+    BYTES_TO_T_UINT_8( 0xDA, 0x8C, 0xC6, 0x3F, 0x3C, 0xA5, 0x68, 0xF4 ),
+    BYTES_TO_T_UINT_8( 0xBB, 0xF5, 0xD5, 0x17, 0xAE, 0x36, 0xD8, 0x8A ),
+    BYTES_TO_T_UINT_8( 0xC7, 0xAD, 0x92, 0xC5, 0x57, 0x6C, 0xDA, 0x91 ),
+    BYTES_TO_T_UINT_8( 0xE8, 0x67, 0x17, 0xC0, 0x40, 0x78, 0x8C, 0x84 ),
+    BYTES_TO_T_UINT_8( 0x7E, 0x9F, 0xF4, 0xAA, 0xDA, 0x5C, 0x7E, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x96, 0xDB, 0x42, 0x3E, 0x72, 0x64, 0xA0, 0x67 ),
+    BYTES_TO_T_UINT_8( 0x27, 0xF9, 0x41, 0x17, 0x43, 0xE3, 0xE8, 0xA8 ),
+    BYTES_TO_T_UINT_8( 0x66, 0xDD, 0xCC, 0x43, 0x7E, 0x16, 0x05, 0x03 ),
+    BYTES_TO_T_UINT_8( 0x36, 0x4B, 0xCF, 0x48, 0x8F, 0x41, 0x90, 0xE5 ),
+    /* T[11].X, T[11].Y */
+    BYTES_TO_T_UINT_8( 0x98, 0x0C, 0x6B, 0x9D, 0x22, 0x04, 0xBC, 0x5C ),
+    BYTES_TO_T_UINT_8( 0x86, 0x63, 0x79, 0x2F, 0x6A, 0x0E, 0x8A, 0xDE ),
+    BYTES_TO_T_UINT_8( 0x29, 0x67, 0x3F, 0x02, 0xB8, 0x91, 0x7F, 0x74 ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x14, 0x64, 0xA0, 0x33, 0xF4, 0x6B, 0x50 ),
+    BYTES_TO_T_UINT_8( 0x1C, 0x44, 0x71, 0x87, 0xB8, 0x88, 0x3F, 0x45 ),
+    BYTES_TO_T_UINT_8( 0x1B, 0x2B, 0x85, 0x05, 0xC5, 0x44, 0x53, 0x15 ),
+    BYTES_TO_T_UINT_8( 0x3E, 0x2B, 0xFE, 0xD1, 0x1C, 0x73, 0xE3, 0x2E ),
+    BYTES_TO_T_UINT_8( 0x66, 0x33, 0xA1, 0xD3, 0x69, 0x1C, 0x9D, 0xD2 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0x5A, 0xBA, 0xB6, 0xAE, 0x1B, 0x94, 0x04 ),
+    BYTES_TO_T_UINT_8( 0xAF, 0x74, 0x90, 0x5C, 0x57, 0xB0, 0x3A, 0x45 ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x2F, 0x93, 0x20, 0x24, 0x54, 0x1D, 0x8D ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x78, 0x9D, 0x71, 0x67, 0x5D, 0x49, 0x98 ),
+    /* T[12].X, T[12].Y */
+    BYTES_TO_T_UINT_8( 0x12, 0xC8, 0x0E, 0x11, 0x8D, 0xE0, 0x8F, 0x69 ),
+    BYTES_TO_T_UINT_8( 0x59, 0x7F, 0x79, 0x6C, 0x5F, 0xB7, 0xBC, 0xB1 ),
+    BYTES_TO_T_UINT_8( 0x88, 0xE1, 0x83, 0x3C, 0x12, 0xBB, 0xEE, 0x96 ),
+    BYTES_TO_T_UINT_8( 0x2A, 0xC2, 0xC4, 0x1B, 0x41, 0x71, 0xB9, 0x17 ),
+    BYTES_TO_T_UINT_8( 0xB0, 0xEE, 0xBB, 0x1D, 0x89, 0x50, 0x88, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x1C, 0x55, 0x74, 0xEB, 0xDE, 0x92, 0x3F ),
+    BYTES_TO_T_UINT_8( 0x9C, 0x38, 0x92, 0x06, 0x19, 0xD0, 0xB3, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x2A, 0x99, 0x26, 0xA3, 0x5F, 0xE2, 0xC1, 0x81 ),
+    BYTES_TO_T_UINT_8( 0x75, 0xFC, 0xFD, 0xC3, 0xB6, 0x26, 0x24, 0x8F ),
+    BYTES_TO_T_UINT_8( 0xAF, 0xAD, 0xE7, 0x49, 0xB7, 0x64, 0x4B, 0x96 ),
+    BYTES_TO_T_UINT_8( 0x6C, 0x4E, 0x95, 0xAD, 0x07, 0xFE, 0xB6, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0x15, 0xE7, 0x2D, 0x19, 0xA9, 0x08, 0x10 ),
+    /* T[13].X, T[13].Y */
+    BYTES_TO_T_UINT_8( 0xBE, 0xBD, 0xAC, 0x0A, 0x3F, 0x6B, 0xFF, 0xFA ),
+    BYTES_TO_T_UINT_8( 0xE0, 0xE4, 0x74, 0x14, 0xD9, 0x70, 0x1D, 0x71 ),
+    BYTES_TO_T_UINT_8( 0xF2, 0xB0, 0x71, 0xBB, 0xD8, 0x18, 0x96, 0x2B ),
+    BYTES_TO_T_UINT_8( 0xDA, 0xB8, 0x19, 0x90, 0x80, 0xB5, 0xEE, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x91, 0x21, 0x20, 0xA6, 0x17, 0x48, 0x03, 0x6F ),
+    BYTES_TO_T_UINT_8( 0xE3, 0x1D, 0xBB, 0x6D, 0x94, 0x20, 0x34, 0xF1 ),
+    BYTES_TO_T_UINT_8( 0x59, 0x82, 0x67, 0x4B, 0x8E, 0x4E, 0xBE, 0xE2 ),
+    BYTES_TO_T_UINT_8( 0xBE, 0xDA, 0x77, 0xF8, 0x23, 0x55, 0x2B, 0x2D ),
+    BYTES_TO_T_UINT_8( 0x5C, 0x02, 0xDE, 0x25, 0x35, 0x2D, 0x74, 0x51 ),
+    BYTES_TO_T_UINT_8( 0xD0, 0x0C, 0xB8, 0x0B, 0x39, 0xBA, 0xAD, 0x04 ),
+    BYTES_TO_T_UINT_8( 0xA6, 0x0E, 0x28, 0x4D, 0xE1, 0x3D, 0xE4, 0x1B ),
+    BYTES_TO_T_UINT_8( 0x5D, 0xEC, 0x0A, 0xD4, 0xB8, 0xC4, 0x8D, 0xB0 ),
+    /* T[14].X, T[14].Y */
+    BYTES_TO_T_UINT_8( 0x3E, 0x68, 0xCE, 0xC2, 0x55, 0x4D, 0x0C, 0x6D ),
+    BYTES_TO_T_UINT_8( 0x9B, 0x20, 0x93, 0x32, 0x90, 0xD6, 0xAE, 0x47 ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x78, 0xAB, 0x43, 0x9E, 0xEB, 0x73, 0xAE ),
+    BYTES_TO_T_UINT_8( 0xED, 0x97, 0xC3, 0x83, 0xA6, 0x3C, 0xF1, 0xBF ),
+    BYTES_TO_T_UINT_8( 0x0F, 0x25, 0x25, 0x66, 0x08, 0x26, 0xFA, 0x4B ),
+    BYTES_TO_T_UINT_8( 0x41, 0xFB, 0x44, 0x5D, 0x82, 0xEC, 0x3B, 0xAC ),
+    BYTES_TO_T_UINT_8( 0x58, 0x90, 0xEA, 0xB5, 0x04, 0x99, 0xD0, 0x69 ),
+    BYTES_TO_T_UINT_8( 0x4A, 0xF2, 0x22, 0xA0, 0xEB, 0xFD, 0x45, 0x87 ),
+    BYTES_TO_T_UINT_8( 0x5D, 0xA4, 0x81, 0x32, 0xFC, 0xFA, 0xEE, 0x5B ),
+    BYTES_TO_T_UINT_8( 0x27, 0xBB, 0xA4, 0x6A, 0x77, 0x41, 0x5C, 0x1D ),
+    BYTES_TO_T_UINT_8( 0xA1, 0x1E, 0xAA, 0x4F, 0xF0, 0x10, 0xB3, 0x50 ),
+    BYTES_TO_T_UINT_8( 0x09, 0x74, 0x13, 0x14, 0x9E, 0x90, 0xD7, 0xE6 ),
+    /* T[15].X, T[15].Y */
+    BYTES_TO_T_UINT_8( 0xDB, 0xBD, 0x70, 0x4F, 0xA8, 0xD1, 0x06, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x19, 0x4E, 0x2E, 0x68, 0xFC, 0x35, 0xFA, 0x50 ),
+    BYTES_TO_T_UINT_8( 0x60, 0x53, 0x75, 0xED, 0xF2, 0x5F, 0xC2, 0xEB ),
+    BYTES_TO_T_UINT_8( 0x39, 0x87, 0x6B, 0x9F, 0x05, 0xE2, 0x22, 0x93 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0x1A, 0xA8, 0xB7, 0x03, 0x9E, 0x6D, 0x7C ),
+    BYTES_TO_T_UINT_8( 0xCB, 0xD0, 0x69, 0x88, 0xA8, 0x39, 0x9E, 0x3A ),
+    BYTES_TO_T_UINT_8( 0xF8, 0xEF, 0x68, 0xFE, 0xEC, 0x24, 0x08, 0x15 ),
+    BYTES_TO_T_UINT_8( 0xA1, 0x06, 0x4B, 0x92, 0x0D, 0xB7, 0x34, 0x74 ),
+    BYTES_TO_T_UINT_8( 0x3E, 0xF4, 0xDD, 0x1A, 0xA0, 0x4A, 0xE4, 0x45 ),
+    BYTES_TO_T_UINT_8( 0xC3, 0x63, 0x4F, 0x4F, 0xCE, 0xBB, 0xD6, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0xCD, 0xEE, 0x8D, 0xDF, 0x3F, 0x73, 0xB7, 0xAC ),
+    BYTES_TO_T_UINT_8( 0xDF, 0x06, 0xB6, 0x80, 0x4D, 0x81, 0xD9, 0x53 ),
+    /* T[16].X, T[16].Y */
+    BYTES_TO_T_UINT_8( 0x15, 0xF5, 0x13, 0xDF, 0x13, 0x19, 0x97, 0x94 ),
+    BYTES_TO_T_UINT_8( 0x08, 0xF9, 0xB3, 0x33, 0x66, 0x82, 0x21, 0xFE ),
+    BYTES_TO_T_UINT_8( 0xF5, 0xFC, 0x39, 0x16, 0x23, 0x43, 0x76, 0x0E ),
+    BYTES_TO_T_UINT_8( 0x09, 0x48, 0x25, 0xA1, 0x64, 0x95, 0x1C, 0x2F ),
+    BYTES_TO_T_UINT_8( 0x43, 0xAC, 0x15, 0x57, 0xD9, 0xDE, 0xA0, 0x28 ),
+    BYTES_TO_T_UINT_8( 0x16, 0x5F, 0xB8, 0x3D, 0x48, 0x91, 0x24, 0xCC ),
+    BYTES_TO_T_UINT_8( 0x2D, 0xF2, 0xC8, 0x54, 0xD1, 0x32, 0xBD, 0xC4 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0x3B, 0xF0, 0xAA, 0x9D, 0xD8, 0xF4, 0x20 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0xC3, 0xBB, 0x6C, 0x66, 0xAC, 0x25, 0x2D ),
+    BYTES_TO_T_UINT_8( 0x6F, 0x25, 0x10, 0xB2, 0xE1, 0x41, 0xDE, 0x1D ),
+    BYTES_TO_T_UINT_8( 0x3C, 0xE8, 0x30, 0xB8, 0x37, 0xBC, 0x2A, 0x98 ),
+    BYTES_TO_T_UINT_8( 0xBA, 0x57, 0x01, 0x4A, 0x1E, 0x78, 0x9F, 0x85 ),
+    /* T[17].X, T[17].Y */
+    BYTES_TO_T_UINT_8( 0xBD, 0x19, 0xCD, 0x12, 0x0B, 0x51, 0x4F, 0x56 ),
+    BYTES_TO_T_UINT_8( 0x30, 0x4B, 0x3D, 0x24, 0xA4, 0x16, 0x59, 0x05 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0xEB, 0xD3, 0x59, 0x2E, 0x75, 0x7C, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x8C, 0xB9, 0xB4, 0xA5, 0xD9, 0x2E, 0x29, 0x4C ),
+    BYTES_TO_T_UINT_8( 0x86, 0x16, 0x05, 0x75, 0x02, 0xB3, 0x06, 0xEE ),
+    BYTES_TO_T_UINT_8( 0xAB, 0x7C, 0x9F, 0x79, 0x91, 0xF1, 0x4F, 0x23 ),
+    BYTES_TO_T_UINT_8( 0x65, 0x98, 0x7C, 0x84, 0xE1, 0xFF, 0x30, 0x77 ),
+    BYTES_TO_T_UINT_8( 0x71, 0xE2, 0xC2, 0x5F, 0x55, 0x40, 0xBD, 0xCD ),
+    BYTES_TO_T_UINT_8( 0x69, 0x65, 0x87, 0x3F, 0xC4, 0xC2, 0x24, 0x57 ),
+    BYTES_TO_T_UINT_8( 0x0E, 0x30, 0x0A, 0x60, 0x15, 0xD1, 0x24, 0x48 ),
+    BYTES_TO_T_UINT_8( 0x57, 0x99, 0xD9, 0xB6, 0xAE, 0xB1, 0xAF, 0x1D ),
+    BYTES_TO_T_UINT_8( 0x9B, 0x80, 0xEE, 0xA2, 0x0F, 0x74, 0xB9, 0xF3 ),
+    /* T[18].X, T[18].Y */
+    BYTES_TO_T_UINT_8( 0x03, 0xE6, 0x0F, 0x37, 0xC1, 0x10, 0x99, 0x1E ),
+    BYTES_TO_T_UINT_8( 0x61, 0xAD, 0x9D, 0x5D, 0x80, 0x01, 0xA6, 0xFE ),
+    BYTES_TO_T_UINT_8( 0xB0, 0x0F, 0x10, 0x2A, 0x9D, 0x20, 0x38, 0xEB ),
+    BYTES_TO_T_UINT_8( 0x6C, 0x60, 0xCB, 0xCE, 0x5A, 0xA0, 0xA7, 0x32 ),
+    BYTES_TO_T_UINT_8( 0xBA, 0xCF, 0x14, 0xDF, 0xBF, 0xE5, 0x74, 0x2D ),
+    BYTES_TO_T_UINT_8( 0xB5, 0x12, 0x1A, 0xDD, 0x59, 0x02, 0x5D, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0xC8, 0xC9, 0xF8, 0xF5, 0xB6, 0x13, 0x4D, 0x7B ),
+    BYTES_TO_T_UINT_8( 0xED, 0x45, 0xB1, 0x93, 0xB3, 0xA2, 0x79, 0xDC ),
+    BYTES_TO_T_UINT_8( 0x74, 0xF6, 0xCF, 0xF7, 0xE6, 0x29, 0x9C, 0xCC ),
+    BYTES_TO_T_UINT_8( 0x87, 0x50, 0x65, 0x80, 0xBC, 0x59, 0x0A, 0x59 ),
+    BYTES_TO_T_UINT_8( 0x0E, 0xF0, 0x24, 0x35, 0xA2, 0x46, 0xF0, 0x0C ),
+    BYTES_TO_T_UINT_8( 0xBD, 0x26, 0xC0, 0x9D, 0x61, 0x56, 0x62, 0x67 ),
+    /* T[19].X, T[19].Y */
+    BYTES_TO_T_UINT_8( 0x10, 0xBB, 0xC2, 0x24, 0x43, 0x2E, 0x37, 0x54 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0xF7, 0xCE, 0x35, 0xFC, 0x77, 0xF3, 0x3F ),
+    BYTES_TO_T_UINT_8( 0x75, 0x34, 0x96, 0xD5, 0x4A, 0x76, 0x9D, 0x6B ),
+    BYTES_TO_T_UINT_8( 0xB8, 0x3B, 0x0F, 0xEA, 0xA8, 0x12, 0x0B, 0x22 ),
+    BYTES_TO_T_UINT_8( 0x66, 0x3F, 0x5D, 0x2D, 0x1C, 0xD4, 0x9E, 0xFB ),
+    BYTES_TO_T_UINT_8( 0x7D, 0x2E, 0xDD, 0xC7, 0x6E, 0xAB, 0xAF, 0xDC ),
+    BYTES_TO_T_UINT_8( 0x8C, 0xB2, 0x7B, 0x0C, 0x9A, 0x83, 0x8E, 0x59 ),
+    BYTES_TO_T_UINT_8( 0x30, 0x51, 0x90, 0x92, 0x79, 0x32, 0x19, 0xC3 ),
+    BYTES_TO_T_UINT_8( 0xEE, 0x89, 0xF9, 0xD0, 0xCF, 0x2C, 0xA5, 0x8F ),
+    BYTES_TO_T_UINT_8( 0x7B, 0x50, 0x21, 0xDE, 0x50, 0x41, 0x9D, 0x81 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0x7D, 0x2B, 0x9E, 0x9D, 0x95, 0xA8, 0xE3 ),
+    BYTES_TO_T_UINT_8( 0xD8, 0xA5, 0x20, 0x87, 0x88, 0x97, 0x5F, 0xAA ),
+    /* T[20].X, T[20].Y */
+    BYTES_TO_T_UINT_8( 0x64, 0x59, 0xB4, 0x66, 0x7E, 0xE8, 0x5A, 0x60 ),
+    BYTES_TO_T_UINT_8( 0xA5, 0x5C, 0x7E, 0xB2, 0xAD, 0xD9, 0xC9, 0xDA ),
+    BYTES_TO_T_UINT_8( 0x82, 0x97, 0x49, 0xA3, 0x13, 0x83, 0x07, 0x2E ),
+    BYTES_TO_T_UINT_8( 0x5A, 0x26, 0xC7, 0x13, 0x35, 0x0D, 0xB0, 0x6B ),
+    BYTES_TO_T_UINT_8( 0x1E, 0x60, 0xAB, 0xFA, 0x4B, 0x93, 0x18, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x54, 0x2D, 0x1C, 0x31, 0x4C, 0xE4, 0x61, 0xAE ),
+    BYTES_TO_T_UINT_8( 0xDE, 0x4D, 0x1E, 0x51, 0x59, 0x6E, 0x91, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0x38, 0x54, 0x4D, 0x51, 0xED, 0x36, 0xCC, 0x60 ),
+    BYTES_TO_T_UINT_8( 0x18, 0xA8, 0x56, 0xC7, 0x78, 0x27, 0x33, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0x42, 0xB7, 0x95, 0xC9, 0x8B, 0xC8, 0x6A, 0xBC ),
+    BYTES_TO_T_UINT_8( 0x5E, 0xE9, 0x13, 0x96, 0xB3, 0xE1, 0xF9, 0xEE ),
+    BYTES_TO_T_UINT_8( 0xF5, 0x46, 0xB0, 0x5E, 0xC3, 0x94, 0x03, 0x05 ),
+    /* T[21].X, T[21].Y */
+    BYTES_TO_T_UINT_8( 0x6D, 0x5B, 0x29, 0x30, 0x41, 0x1A, 0x9E, 0xB6 ),
+    BYTES_TO_T_UINT_8( 0x76, 0xCA, 0x83, 0x31, 0x5B, 0xA7, 0xCB, 0x42 ),
+    BYTES_TO_T_UINT_8( 0x21, 0x41, 0x50, 0x44, 0x4D, 0x64, 0x31, 0x89 ),
+    BYTES_TO_T_UINT_8( 0xCF, 0x84, 0xC2, 0x5D, 0x97, 0xA5, 0x3C, 0x18 ),
+    BYTES_TO_T_UINT_8( 0xF0, 0x0F, 0xA5, 0xFD, 0x8E, 0x5A, 0x47, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x7C, 0x58, 0x02, 0x2D, 0x40, 0xB1, 0x0B, 0xBA ),
+    BYTES_TO_T_UINT_8( 0xDA, 0x33, 0x8C, 0x67, 0xCE, 0x23, 0x43, 0x99 ),
+    BYTES_TO_T_UINT_8( 0x84, 0x53, 0x47, 0x72, 0x44, 0x1F, 0x5B, 0x2A ),
+    BYTES_TO_T_UINT_8( 0xAE, 0xC1, 0xD9, 0xA4, 0x50, 0x88, 0x63, 0x18 ),
+    BYTES_TO_T_UINT_8( 0x7C, 0xF2, 0x75, 0x69, 0x73, 0x00, 0xC4, 0x31 ),
+    BYTES_TO_T_UINT_8( 0x4B, 0x90, 0x1D, 0xDF, 0x1A, 0x00, 0xD8, 0x69 ),
+    BYTES_TO_T_UINT_8( 0x05, 0xB1, 0x89, 0x48, 0xA8, 0x70, 0x62, 0xEF ),
+    /* T[22].X, T[22].Y */
+    BYTES_TO_T_UINT_8( 0x7E, 0x8A, 0x55, 0x50, 0x7B, 0xEF, 0x8A, 0x3C ),
+    BYTES_TO_T_UINT_8( 0xFE, 0x1B, 0x23, 0x48, 0x23, 0x63, 0x91, 0xB6 ),
+    BYTES_TO_T_UINT_8( 0x0D, 0x04, 0x54, 0x3C, 0x24, 0x9B, 0xC7, 0x9A ),
+    BYTES_TO_T_UINT_8( 0x25, 0x38, 0xC3, 0x84, 0xFB, 0xFF, 0x9F, 0x49 ),
+    BYTES_TO_T_UINT_8( 0x66, 0x2A, 0xE0, 0x6D, 0x68, 0x8A, 0x5C, 0xCB ),
+    BYTES_TO_T_UINT_8( 0xC4, 0x93, 0x53, 0x85, 0xA1, 0x0D, 0xAF, 0x63 ),
+    BYTES_TO_T_UINT_8( 0x1B, 0x88, 0x95, 0x4C, 0x0B, 0xD0, 0x06, 0x51 ),
+    BYTES_TO_T_UINT_8( 0x92, 0xAF, 0x8D, 0x49, 0xA2, 0xC8, 0xB4, 0xE0 ),
+    BYTES_TO_T_UINT_8( 0x75, 0x76, 0x53, 0x09, 0x88, 0x43, 0x87, 0xCA ),
+    BYTES_TO_T_UINT_8( 0x90, 0xA4, 0x77, 0x3F, 0x5E, 0x21, 0xB4, 0x0A ),
+    BYTES_TO_T_UINT_8( 0x35, 0x9E, 0x86, 0x64, 0xCC, 0x91, 0xC1, 0x77 ),
+    BYTES_TO_T_UINT_8( 0xC1, 0x17, 0x56, 0xCB, 0xC3, 0x7D, 0x5B, 0xB1 ),
+    /* T[23].X, T[23].Y */
+    BYTES_TO_T_UINT_8( 0x64, 0x74, 0x9F, 0xB5, 0x91, 0x21, 0xB1, 0x1C ),
+    BYTES_TO_T_UINT_8( 0x1E, 0xED, 0xE1, 0x11, 0xEF, 0x45, 0xAF, 0xC1 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0x31, 0xBE, 0xB2, 0xBC, 0x72, 0x65, 0x1F ),
+    BYTES_TO_T_UINT_8( 0xB1, 0x4B, 0x8C, 0x77, 0xCE, 0x1E, 0x42, 0xB5 ),
+    BYTES_TO_T_UINT_8( 0xFF, 0xC9, 0xAA, 0xB9, 0xD9, 0x86, 0x99, 0x55 ),
+    BYTES_TO_T_UINT_8( 0x65, 0x23, 0x80, 0xC6, 0x4E, 0x35, 0x0B, 0x6D ),
+    BYTES_TO_T_UINT_8( 0x47, 0xD8, 0xA2, 0x0A, 0x39, 0x32, 0x1D, 0x23 ),
+    BYTES_TO_T_UINT_8( 0x61, 0xC8, 0x86, 0xF1, 0x12, 0x9A, 0x4A, 0x05 ),
+    BYTES_TO_T_UINT_8( 0x8D, 0xF1, 0x7C, 0xAA, 0x70, 0x8E, 0xBC, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x62, 0x01, 0x47, 0x8F, 0xDD, 0x8B, 0xA5, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0xDB, 0x08, 0x21, 0xF4, 0xAB, 0xC7, 0xF5, 0x96 ),
+    BYTES_TO_T_UINT_8( 0x0A, 0x76, 0xA5, 0x95, 0xC4, 0x0F, 0x88, 0x1D ),
+    /* T[24].X, T[24].Y */
+    BYTES_TO_T_UINT_8( 0x3F, 0x42, 0x2A, 0x52, 0xCD, 0x75, 0x51, 0x49 ),
+    BYTES_TO_T_UINT_8( 0x90, 0x36, 0xE5, 0x04, 0x2B, 0x44, 0xC6, 0xEF ),
+    BYTES_TO_T_UINT_8( 0x5C, 0xEE, 0x16, 0x13, 0x07, 0x83, 0xB5, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x76, 0x59, 0xC6, 0xA2, 0x19, 0x05, 0xD3, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0xB6, 0x8B, 0xA8, 0x16, 0x09, 0xB7, 0xEA, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0x70, 0xEE, 0x14, 0xAF, 0xB5, 0xFD, 0xD0, 0xEF ),
+    BYTES_TO_T_UINT_8( 0x18, 0x7C, 0xCA, 0x71, 0x3E, 0x6E, 0x66, 0x75 ),
+    BYTES_TO_T_UINT_8( 0xBE, 0x31, 0x0E, 0x3F, 0xE5, 0x91, 0xC4, 0x7F ),
+    BYTES_TO_T_UINT_8( 0x8E, 0x3D, 0xC2, 0x3E, 0x95, 0x37, 0x58, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x01, 0x1F, 0x02, 0x03, 0xF3, 0xEF, 0xEE, 0x66 ),
+    BYTES_TO_T_UINT_8( 0x28, 0x5B, 0x1A, 0xFC, 0x38, 0xCD, 0xE8, 0x24 ),
+    BYTES_TO_T_UINT_8( 0x12, 0x57, 0x42, 0x85, 0xC6, 0x21, 0x68, 0x71 ),
+    /* T[25].X, T[25].Y */
+    BYTES_TO_T_UINT_8( 0x8D, 0xA2, 0x4A, 0x66, 0xB1, 0x0A, 0xE6, 0xC0 ),
+    BYTES_TO_T_UINT_8( 0x86, 0x0C, 0x94, 0x9D, 0x5E, 0x99, 0xB2, 0xCE ),
+    BYTES_TO_T_UINT_8( 0xAD, 0x03, 0x40, 0xCA, 0xB2, 0xB3, 0x30, 0x55 ),
+    BYTES_TO_T_UINT_8( 0x74, 0x78, 0x48, 0x27, 0x34, 0x1E, 0xE2, 0x42 ),
+    BYTES_TO_T_UINT_8( 0xAE, 0x72, 0x5B, 0xAC, 0xC1, 0x6D, 0xE3, 0x82 ),
+    BYTES_TO_T_UINT_8( 0x57, 0xAB, 0x46, 0xCB, 0xEA, 0x5E, 0x4B, 0x0B ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x08, 0xAD, 0x4E, 0x51, 0x9F, 0x2A, 0x52 ),
+    BYTES_TO_T_UINT_8( 0x68, 0x5C, 0x7D, 0x4C, 0xD6, 0xCF, 0xDD, 0x02 ),
+    BYTES_TO_T_UINT_8( 0xD8, 0x76, 0x26, 0xE0, 0x8B, 0x10, 0xD9, 0x7C ),
+    BYTES_TO_T_UINT_8( 0x30, 0xA7, 0x23, 0x4E, 0x5F, 0xD2, 0x42, 0x17 ),
+    BYTES_TO_T_UINT_8( 0xD1, 0xE5, 0xA4, 0xEC, 0x77, 0x21, 0x34, 0x28 ),
+    BYTES_TO_T_UINT_8( 0x5C, 0x14, 0x65, 0xEA, 0x4A, 0x85, 0xC3, 0x2F ),
+    /* T[26].X, T[26].Y */
+    BYTES_TO_T_UINT_8( 0x19, 0xD8, 0x40, 0x27, 0x73, 0x15, 0x7E, 0x65 ),
+    BYTES_TO_T_UINT_8( 0xF6, 0xBB, 0x53, 0x7E, 0x0F, 0x40, 0xC8, 0xD4 ),
+    BYTES_TO_T_UINT_8( 0xEA, 0x37, 0x19, 0x73, 0xEF, 0x5A, 0x5E, 0x04 ),
+    BYTES_TO_T_UINT_8( 0x9C, 0x73, 0x2B, 0x49, 0x7E, 0xAC, 0x97, 0x5C ),
+    BYTES_TO_T_UINT_8( 0x15, 0xB2, 0xC3, 0x1E, 0x0E, 0xE7, 0xD2, 0x21 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0x08, 0xD6, 0xDD, 0xAC, 0x21, 0xD6, 0x3E ),
+    BYTES_TO_T_UINT_8( 0xA9, 0x26, 0xBE, 0x6D, 0x6D, 0xF2, 0x38, 0x3F ),
+    BYTES_TO_T_UINT_8( 0x08, 0x6C, 0x31, 0xA7, 0x49, 0x50, 0x3A, 0x89 ),
+    BYTES_TO_T_UINT_8( 0xC3, 0x99, 0xC6, 0xF5, 0xD2, 0xC2, 0x30, 0x5A ),
+    BYTES_TO_T_UINT_8( 0x2A, 0xE4, 0xF6, 0x8B, 0x8B, 0x97, 0xE9, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x21, 0xB7, 0x0D, 0xFC, 0x15, 0x54, 0x0B ),
+    BYTES_TO_T_UINT_8( 0x65, 0x83, 0x1C, 0xA4, 0xCD, 0x6B, 0x9D, 0xF2 ),
+    /* T[27].X, T[27].Y */
+    BYTES_TO_T_UINT_8( 0xD6, 0xE8, 0x4C, 0x48, 0xE4, 0xAA, 0x69, 0x93 ),
+    BYTES_TO_T_UINT_8( 0x27, 0x7A, 0x27, 0xFC, 0x37, 0x96, 0x1A, 0x7B ),
+    BYTES_TO_T_UINT_8( 0x6F, 0xE7, 0x30, 0xA5, 0xCF, 0x13, 0x46, 0x5C ),
+    BYTES_TO_T_UINT_8( 0x8C, 0xD8, 0xAF, 0x74, 0x23, 0x4D, 0x56, 0x84 ),
+    BYTES_TO_T_UINT_8( 0x32, 0x3D, 0x44, 0x14, 0x1B, 0x97, 0x83, 0xF0 ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x47, 0xD7, 0x5F, 0xFD, 0x98, 0x38, 0xF7 ),
+    BYTES_TO_T_UINT_8( 0xA3, 0x73, 0x64, 0x36, 0xFD, 0x7B, 0xC1, 0x15 ),
+    BYTES_TO_T_UINT_8( 0xEA, 0x5D, 0x32, 0xD2, 0x47, 0x94, 0x89, 0x2D ),
+    BYTES_TO_T_UINT_8( 0x51, 0xE9, 0x30, 0xAC, 0x06, 0xC8, 0x65, 0x04 ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x6C, 0xB9, 0x1B, 0xF7, 0x61, 0x49, 0x53 ),
+    BYTES_TO_T_UINT_8( 0xD7, 0xFF, 0x32, 0x43, 0x80, 0xDA, 0xA6, 0xB1 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0xF8, 0x04, 0x01, 0x95, 0x35, 0xCE, 0x21 ),
+    /* T[28].X, T[28].Y */
+    BYTES_TO_T_UINT_8( 0x6D, 0x06, 0x46, 0x0D, 0x51, 0xE2, 0xD8, 0xAC ),
+    BYTES_TO_T_UINT_8( 0x14, 0x57, 0x1D, 0x6F, 0x79, 0xA0, 0xCD, 0xA6 ),
+    BYTES_TO_T_UINT_8( 0xDF, 0xFB, 0x36, 0xCA, 0xAD, 0xF5, 0x9E, 0x41 ),
+    BYTES_TO_T_UINT_8( 0x6F, 0x7A, 0x1D, 0x9E, 0x1D, 0x95, 0x48, 0xDC ),
+    BYTES_TO_T_UINT_8( 0x81, 0x26, 0xA5, 0xB7, 0x15, 0x2C, 0xC2, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0x86, 0x42, 0x72, 0xAA, 0x11, 0xDC, 0xC9, 0xB6 ),
+    BYTES_TO_T_UINT_8( 0x3F, 0x6C, 0x64, 0xA7, 0x62, 0x3C, 0xAB, 0xD4 ),
+    BYTES_TO_T_UINT_8( 0x48, 0x6A, 0x44, 0xD8, 0x60, 0xC0, 0xA8, 0x80 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x76, 0x58, 0x12, 0x57, 0x3C, 0x89, 0x46 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x4F, 0x83, 0xCE, 0xCB, 0xB8, 0xD0, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x84, 0x04, 0xB0, 0xAD, 0xEB, 0xFA, 0xDF ),
+    BYTES_TO_T_UINT_8( 0x34, 0xA4, 0xC3, 0x41, 0x44, 0x4E, 0x65, 0x3E ),
+    /* T[29].X, T[29].Y */
+    BYTES_TO_T_UINT_8( 0xB6, 0x16, 0xA9, 0x1C, 0xE7, 0x65, 0x20, 0xC1 ),
+    BYTES_TO_T_UINT_8( 0x58, 0x53, 0x32, 0xF8, 0xC0, 0xA6, 0xBD, 0x2C ),
+    BYTES_TO_T_UINT_8( 0xB7, 0xF0, 0xE6, 0x57, 0x31, 0xCC, 0x26, 0x6F ),
+    BYTES_TO_T_UINT_8( 0x27, 0xE3, 0x54, 0x1C, 0x34, 0xD3, 0x17, 0xBC ),
+    BYTES_TO_T_UINT_8( 0xF5, 0xAE, 0xED, 0xFB, 0xCD, 0xE7, 0x1E, 0x9F ),
+    BYTES_TO_T_UINT_8( 0x5A, 0x16, 0x1C, 0x34, 0x40, 0x00, 0x1F, 0xB6 ),
+    BYTES_TO_T_UINT_8( 0x6A, 0x32, 0x00, 0xC2, 0xD4, 0x3B, 0x1A, 0x09 ),
+    BYTES_TO_T_UINT_8( 0x34, 0xE0, 0x99, 0x8F, 0x0C, 0x4A, 0x16, 0x44 ),
+    BYTES_TO_T_UINT_8( 0x83, 0x73, 0x18, 0x1B, 0xD4, 0x94, 0x29, 0x62 ),
+    BYTES_TO_T_UINT_8( 0x29, 0xA4, 0x2D, 0xB1, 0x9D, 0x74, 0x32, 0x67 ),
+    BYTES_TO_T_UINT_8( 0xBF, 0xF4, 0xB1, 0x0C, 0x37, 0x62, 0x8B, 0x66 ),
+    BYTES_TO_T_UINT_8( 0xC9, 0xFF, 0xDA, 0xE2, 0x35, 0xA3, 0xB6, 0x42 ),
+    /* T[30].X, T[30].Y */
+    BYTES_TO_T_UINT_8( 0x91, 0x49, 0x99, 0x65, 0xC5, 0xED, 0x16, 0xEF ),
+    BYTES_TO_T_UINT_8( 0x79, 0x42, 0x9A, 0xF3, 0xA7, 0x4E, 0x6F, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x7B, 0x0A, 0x7E, 0xC0, 0xD7, 0x4E, 0x07, 0x55 ),
+    BYTES_TO_T_UINT_8( 0xD6, 0x7A, 0x31, 0x69, 0xA6, 0xB9, 0x15, 0x34 ),
+    BYTES_TO_T_UINT_8( 0xA8, 0xE0, 0x72, 0xA4, 0x3F, 0xB9, 0xF8, 0x0C ),
+    BYTES_TO_T_UINT_8( 0x2B, 0x75, 0x32, 0x85, 0xA2, 0xDE, 0x37, 0x12 ),
+    BYTES_TO_T_UINT_8( 0xBC, 0xC0, 0x0D, 0xCF, 0x25, 0x41, 0xA4, 0xF4 ),
+    BYTES_TO_T_UINT_8( 0x9B, 0xFC, 0xB2, 0x48, 0xC3, 0x85, 0x83, 0x4B ),
+    BYTES_TO_T_UINT_8( 0x2B, 0xBE, 0x0B, 0x58, 0x2D, 0x7A, 0x9A, 0x62 ),
+    BYTES_TO_T_UINT_8( 0xC5, 0xF3, 0x81, 0x18, 0x1B, 0x74, 0x4F, 0x2C ),
+    BYTES_TO_T_UINT_8( 0xE2, 0x43, 0xA3, 0x0A, 0x16, 0x8B, 0xA3, 0x1E ),
+    BYTES_TO_T_UINT_8( 0x4A, 0x18, 0x81, 0x7B, 0x8D, 0xA2, 0x35, 0x77 ),
+    /* T[31].X, T[31].Y */
+    BYTES_TO_T_UINT_8( 0x86, 0xC4, 0x3F, 0x2C, 0xE7, 0x5F, 0x99, 0x03 ),
+    BYTES_TO_T_UINT_8( 0xF0, 0x2B, 0xB7, 0xB6, 0xAD, 0x5A, 0x56, 0xFF ),
+    BYTES_TO_T_UINT_8( 0x04, 0x00, 0xA4, 0x48, 0xC8, 0xE8, 0xBA, 0xBF ),
+    BYTES_TO_T_UINT_8( 0xE8, 0xA1, 0xB5, 0x13, 0x5A, 0xCD, 0x99, 0x9C ),
+    BYTES_TO_T_UINT_8( 0xB0, 0x95, 0xAD, 0xFC, 0xE2, 0x7E, 0xE7, 0xFE ),
+    BYTES_TO_T_UINT_8( 0x96, 0x6B, 0xD1, 0x34, 0x99, 0x53, 0x63, 0x0B ),
+    BYTES_TO_T_UINT_8( 0x19, 0x8A, 0x77, 0x5D, 0x2B, 0xAB, 0x01, 0x28 ),
+    BYTES_TO_T_UINT_8( 0x4E, 0x85, 0xD0, 0xD5, 0x49, 0x83, 0x4D, 0x60 ),
+    BYTES_TO_T_UINT_8( 0x81, 0xC6, 0x91, 0x30, 0x3B, 0x00, 0xAF, 0x7A ),
+    BYTES_TO_T_UINT_8( 0x3A, 0xAE, 0x61, 0x07, 0xE1, 0xB6, 0xE2, 0xC9 ),
+    BYTES_TO_T_UINT_8( 0x95, 0x43, 0x41, 0xFE, 0x9B, 0xB6, 0xF0, 0xA5 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0x97, 0xAE, 0xAD, 0x89, 0x88, 0x9E, 0x41 ),
+};
+static const mbedtls_ecp_point secp384r1_T[32] = {
+    ECP_COMB_POINT( secp384r1, 0 ),
+    ECP_COMB_POINT( secp384r1, 1 ),
+    ECP_COMB_POINT( secp384r1, 2 ),
+    ECP_COMB_POINT( secp384r1, 3 ),
+    ECP_COMB_POINT( secp384r1, 4 ),
+    ECP_COMB_POINT( secp384r1, 5 ),
+    ECP_COMB_POINT( secp384r1, 6 ),
+    ECP_COMB_POINT( secp384r1, 7 ),
+    ECP_COMB_POINT( secp384r1, 8 ),
+    ECP_COMB_POINT( secp384r1, 9 ),
+    ECP_COMB_POINT( secp384r1, 10 ),
+    ECP_COMB_POINT( secp384r1, 11 ),
+    ECP_COMB_POINT( secp384r1, 12 ),
+    ECP_COMB_POINT( secp384r1, 13 ),
+    ECP_COMB_POINT( secp384r1, 14 ),
+    ECP_COMB_POINT( secp384r1, 15 ),
+    ECP_COMB_POINT( secp384r1, 16 ),
+    ECP_COMB_POINT( secp384r1, 17 ),
+    ECP_COMB_POINT( secp384r1, 18 ),
+    ECP_COMB_POINT( secp384r1, 19 ),
+    ECP_COMB_POINT( secp384r1, 20 ),
+    ECP_COMB_POINT( secp384r1, 21 ),
+    ECP_COMB_POINT( secp384r1, 22 ),
+    ECP_COMB_POINT( secp384r1, 23 ),
+    ECP_COMB_POINT( secp384r1, 24 ),
+    ECP_COMB_POINT( secp384r1, 25 ),
+    ECP_COMB_POINT( secp384r1, 26 ),
+    ECP_COMB_POINT( secp384r1, 27 ),
+    ECP_COMB_POINT( secp384r1, 28 ),
+    ECP_COMB_POINT( secp384r1, 29 ),
+    ECP_COMB_POINT( secp384r1, 30 ),
+    ECP_COMB_POINT( secp384r1, 31 ),
+};
+#endif /* MBEDTLS_ECP_P384_FAST && !MBEDTLS_ECP_RESTARTABLE */
+#endif /* ECP_NIST_TABLES */
 #endif /* MBEDTLS_ECP_DP_SECP384R1_ENABLED */
 
 /*
@@ -290,6 +1260,652 @@ static const mbedtls_mpi_uint secp521r1_n[] = {
     BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
     BYTES_TO_T_UINT_2( 0xFF, 0x01 ),
 };
+#if defined(ECP_NIST_TABLES)
+static const mbedtls_mpi_uint secp521r1_T_xy[] = {
+    /* T[0].X, T[0].Y */
+    BYTES_TO_T_UINT_8( 0x66, 0xBD, 0xE5, 0xC2, 0x31, 0x7E, 0x7E, 0xF9 ),
+    BYTES_TO_T_UINT_8( 0x9B, 0x42, 0x6A, 0x85, 0xC1, 0xB3, 0x48, 0x33 ),
+    BYTES_TO_T_UINT_8( 0xDE, 0xA8, 0xFF, 0xA2, 0x27, 0xC1, 0x1D, 0xFE ),
+    BYTES_TO_T_UINT_8( 0x28, 0x59, 0xE7, 0xEF, 0x77, 0x5E, 0x4B, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0xBA, 0x3D, 0x4D, 0x6B, 0x60, 0xAF, 0x28, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0x21, 0xB5, 0x3F, 0x05, 0x39, 0x81, 0x64, 0x9C ),
+    BYTES_TO_T_UINT_8( 0x42, 0xB4, 0x95, 0x23, 0x66, 0xCB, 0x3E, 0x9E ),
+    BYTES_TO_T_UINT_8( 0xCD, 0xE9, 0x04, 0x04, 0xB7, 0x06, 0x8E, 0x85 ),
+    BYTES_TO_T_UINT_2( 0xC6, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x50, 0x66, 0xD1, 0x9F, 0x76, 0x94, 0xBE, 0x88 ),
+    BYTES_TO_T_UINT_8( 0x40, 0xC2, 0x72, 0xA2, 0x86, 0x70, 0x3C, 0x35 ),
+    BYTES_TO_T_UINT_8( 0x61, 0x07, 0xAD, 0x3F, 0x01, 0xB9, 0x50, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0x40, 0x26, 0xF4, 0x5E, 0x99, 0x72, 0xEE, 0x97 ),
+    BYTES_TO_T_UINT_8( 0x2C, 0x66, 0x3E, 0x27, 0x17, 0xBD, 0xAF, 0x17 ),
+    BYTES_TO_T_UINT_8( 0x68, 0x44, 0x9B, 0x57, 0x49, 0x44, 0xF5, 0x98 ),
+    BYTES_TO_T_UINT_8( 0xD9, 0x1B, 0x7D, 0x2C, 0xB4, 0x5F, 0x8A, 0x5C ),
+    BYTES_TO_T_UINT_8( 0x04, 0xC0, 0x3B, 0x9A, 0x78, 0x6A, 0x29, 0x39 ),
+    BYTES_TO_T_UINT_2( 0x18, 0x01 ),
+    /* T[1].X, T[1].Y */
+    BYTES_TO_T_UINT_8( 0x2F, 0xB1, 0x2D, 0xEB, 0x27, 0x2F, 0xE8, 0xDA ),
+    BYTES_TO_T_UINT_8( 0x98, 0x4B, 0x44, 0x25, 0xDB, 0x5C, 0x5F, 0x67 ),
+    BYTES_TO_T_UINT_8( 0x13, 0x85, 0x28, 0x78, 0x2E, 0x75, 0x34, 0x32 ),
+    BYTES_TO_T_UINT_8( 0x69, 0x57, 0x0F, 0x73, 0x78, 0x7A, 0xE3, 0x53 ),
+    BYTES_TO_T_UINT_8( 0x8D, 0xD8, 0xEC, 0xDC, 0xDA, 0x04, 0xAD, 0xAB ),
+    BYTES_TO_T_UINT_8( 0x34, 0x8A, 0x09, 0xF3, 0x58, 0x79, 0xD8, 0x29 ),
+    BYTES_TO_T_UINT_8( 0x63, 0x03, 0xCB, 0x50, 0x1A, 0x7F, 0x56, 0x00 ),
+    BYTES_TO_T_UINT_8( 0xF6, 0xA6, 0x78, 0x38, 0x85, 0x67, 0x0B, 0x40 ),
+    BYTES_TO_T_UINT_2( 0x83, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0xD5, 0xD2, 0x22, 0xC4, 0x00, 0x3B, 0xBA ),
+    BYTES_TO_T_UINT_8( 0xD5, 0x93, 0x0E, 0x7B, 0x85, 0x51, 0xC3, 0x06 ),
+    BYTES_TO_T_UINT_8( 0x3D, 0xA6, 0x5F, 0x54, 0x49, 0x02, 0x81, 0x78 ),
+    BYTES_TO_T_UINT_8( 0x22, 0xE9, 0x6B, 0x3A, 0x92, 0xE7, 0x72, 0x1D ),
+    BYTES_TO_T_UINT_8( 0x6F, 0x5F, 0x28, 0x9E, 0x91, 0x27, 0x88, 0xE3 ),
+    BYTES_TO_T_UINT_8( 0xEF, 0x28, 0x31, 0xB3, 0x84, 0xCA, 0x12, 0x32 ),
+    BYTES_TO_T_UINT_8( 0x3D, 0xF9, 0xAC, 0x22, 0x10, 0x0A, 0x64, 0x41 ),
+    BYTES_TO_T_UINT_8( 0xE9, 0xC6, 0x33, 0x1F, 0x69, 0x19, 0x18, 0xBF ),
+    BYTES_TO_T_UINT_2( 0xBE, 0x01 ),
+    /* T[2].X, T[2].Y */
+    BYTES_TO_T_UINT_8( 0xA0, 0x48, 0xB8, 0xC7, 0x37, 0x5A, 0x00, 0x36 ),
+    BYTES_TO_T_UINT_8( 0x07, 0xCC, 0x32, 0xE0, 0xEE, 0x03, 0xC2, 0xBA ),
+    BYTES_TO_T_UINT_8( 0xC4, 0x29, 0xC2, 0xE4, 0x6E, 0x24, 0x20, 0x8D ),
+    BYTES_TO_T_UINT_8( 0x06, 0x6B, 0x7F, 0x7B, 0xF9, 0xB0, 0xB8, 0x13 ),
+    BYTES_TO_T_UINT_8( 0x1D, 0x7B, 0x3C, 0xE1, 0x19, 0xA1, 0x23, 0x02 ),
+    BYTES_TO_T_UINT_8( 0x2A, 0xE3, 0xC2, 0x53, 0xC0, 0x07, 0x13, 0xA9 ),
+    BYTES_TO_T_UINT_8( 0x07, 0xFE, 0x36, 0x35, 0x9F, 0x5E, 0x59, 0xCE ),
+    BYTES_TO_T_UINT_8( 0x1D, 0x55, 0x89, 0x84, 0xBC, 0xEF, 0xA2, 0xC2 ),
+    BYTES_TO_T_UINT_2( 0x19, 0x00 ),
+    BYTES_TO_T_UINT_8( 0xFD, 0x1A, 0x08, 0x67, 0xB4, 0xE7, 0x22, 0xED ),
+    BYTES_TO_T_UINT_8( 0x76, 0x26, 0xDF, 0x81, 0x3C, 0x5F, 0x1C, 0xDA ),
+    BYTES_TO_T_UINT_8( 0xE0, 0x4D, 0xD0, 0x0A, 0x48, 0x06, 0xF4, 0x48 ),
+    BYTES_TO_T_UINT_8( 0x73, 0x18, 0x39, 0xF7, 0xD1, 0x20, 0x77, 0x8D ),
+    BYTES_TO_T_UINT_8( 0x78, 0x8F, 0x44, 0x13, 0xCB, 0x78, 0x11, 0x11 ),
+    BYTES_TO_T_UINT_8( 0x33, 0xE2, 0x49, 0xEA, 0x43, 0x79, 0x08, 0x39 ),
+    BYTES_TO_T_UINT_8( 0x01, 0xD1, 0xD8, 0x73, 0x2C, 0x71, 0x2F, 0x69 ),
+    BYTES_TO_T_UINT_8( 0x21, 0xE5, 0xE7, 0xF4, 0x46, 0xAB, 0x20, 0xCA ),
+    BYTES_TO_T_UINT_2( 0x5A, 0x00 ),
+    /* T[3].X, T[3].Y */
+    BYTES_TO_T_UINT_8( 0x8C, 0x0B, 0xB9, 0x71, 0x1A, 0x27, 0xB7, 0xA7 ),
+    BYTES_TO_T_UINT_8( 0x2A, 0xA2, 0x2C, 0xD1, 0xDA, 0xBC, 0xC1, 0xBD ),
+    BYTES_TO_T_UINT_8( 0x10, 0xA3, 0x10, 0x1F, 0x90, 0xF2, 0xA5, 0x52 ),
+    BYTES_TO_T_UINT_8( 0x28, 0xFB, 0x20, 0xF4, 0xC0, 0x70, 0xC0, 0xF5 ),
+    BYTES_TO_T_UINT_8( 0x8F, 0xA7, 0x99, 0xF0, 0xA5, 0xD3, 0x09, 0xDD ),
+    BYTES_TO_T_UINT_8( 0x26, 0xE8, 0x14, 0x39, 0xBE, 0xCB, 0x60, 0xAF ),
+    BYTES_TO_T_UINT_8( 0x9F, 0xD6, 0x14, 0xA9, 0xC9, 0x20, 0xC3, 0xEA ),
+    BYTES_TO_T_UINT_8( 0x5D, 0xA8, 0x5B, 0xFD, 0x2D, 0x96, 0xBC, 0x78 ),
+    BYTES_TO_T_UINT_2( 0xC0, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x9D, 0x04, 0x45, 0xBE, 0xCE, 0x75, 0x95, 0xF6 ),
+    BYTES_TO_T_UINT_8( 0xCC, 0xDA, 0x58, 0x49, 0x35, 0x09, 0x8D, 0x41 ),
+    BYTES_TO_T_UINT_8( 0x76, 0xF0, 0xC0, 0x36, 0xF2, 0xA6, 0x2D, 0x14 ),
+    BYTES_TO_T_UINT_8( 0xE7, 0xFC, 0x3D, 0xA8, 0xFB, 0x3C, 0xD2, 0x51 ),
+    BYTES_TO_T_UINT_8( 0x01, 0x4D, 0x71, 0x09, 0x18, 0x42, 0xF0, 0x2D ),
+    BYTES_TO_T_UINT_8( 0x8D, 0xC1, 0xCE, 0x9E, 0x6A, 0x49, 0x60, 0x12 ),
+    BYTES_TO_T_UINT_8( 0xAD, 0xB1, 0x00, 0xF7, 0xA1, 0x7A, 0x31, 0xB4 ),
+    BYTES_TO_T_UINT_8( 0x41, 0xC3, 0x86, 0xCD, 0x20, 0x4A, 0x17, 0x86 ),
+    BYTES_TO_T_UINT_2( 0x6C, 0x01 ),
+    /* T[4].X, T[4].Y */
+    BYTES_TO_T_UINT_8( 0x98, 0xAB, 0x8B, 0x47, 0x8D, 0xAA, 0xA6, 0x5B ),
+    BYTES_TO_T_UINT_8( 0xC4, 0x97, 0xF0, 0xBC, 0x2D, 0xDC, 0x9D, 0x84 ),
+    BYTES_TO_T_UINT_8( 0x01, 0x86, 0xB0, 0x74, 0xB2, 0xF4, 0xF6, 0x67 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0xBD, 0xAC, 0xE3, 0x8F, 0x43, 0x5C, 0xB1 ),
+    BYTES_TO_T_UINT_8( 0x37, 0xC3, 0xE2, 0x6E, 0x25, 0x49, 0xCD, 0x0B ),
+    BYTES_TO_T_UINT_8( 0x64, 0x5E, 0x08, 0xB3, 0xB9, 0xAC, 0x5F, 0xD1 ),
+    BYTES_TO_T_UINT_8( 0x08, 0xB7, 0xD1, 0xF4, 0xDC, 0x19, 0xE9, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0x49, 0xE4, 0xFA, 0xE1, 0x36, 0x3E, 0xED, 0x6E ),
+    BYTES_TO_T_UINT_2( 0x0A, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x00, 0x67, 0x92, 0x84, 0x6E, 0x48, 0x03, 0x51 ),
+    BYTES_TO_T_UINT_8( 0x9E, 0x95, 0xEF, 0x8F, 0xB2, 0x82, 0x6B, 0x1C ),
+    BYTES_TO_T_UINT_8( 0x8D, 0xFA, 0xB9, 0x55, 0x23, 0xFE, 0x09, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0xEF, 0x79, 0x85, 0x4B, 0x0E, 0xD4, 0x35, 0xDB ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x27, 0x45, 0x81, 0xE0, 0x88, 0x52, 0xAD ),
+    BYTES_TO_T_UINT_8( 0x17, 0x63, 0xA2, 0x4B, 0xBC, 0x5D, 0xB1, 0x92 ),
+    BYTES_TO_T_UINT_8( 0x28, 0x8C, 0x83, 0xD9, 0x3E, 0xD3, 0x42, 0xDA ),
+    BYTES_TO_T_UINT_8( 0x99, 0x03, 0x3A, 0x31, 0xBA, 0xE9, 0x3A, 0xD1 ),
+    BYTES_TO_T_UINT_2( 0x47, 0x00 ),
+    /* T[5].X, T[5].Y */
+    BYTES_TO_T_UINT_8( 0x35, 0x10, 0xCD, 0x2D, 0x00, 0xFE, 0x32, 0xA7 ),
+    BYTES_TO_T_UINT_8( 0xE4, 0x6E, 0x1F, 0xDA, 0xF8, 0x6F, 0x4D, 0x03 ),
+    BYTES_TO_T_UINT_8( 0x09, 0x79, 0x7D, 0x09, 0xE5, 0xD3, 0x03, 0x21 ),
+    BYTES_TO_T_UINT_8( 0x58, 0xC3, 0xBE, 0xDF, 0x07, 0x65, 0x49, 0xCC ),
+    BYTES_TO_T_UINT_8( 0x08, 0x57, 0x33, 0xEF, 0xAE, 0x4F, 0x04, 0x27 ),
+    BYTES_TO_T_UINT_8( 0x9A, 0xE9, 0x9B, 0xFE, 0xBF, 0xE6, 0x85, 0xF6 ),
+    BYTES_TO_T_UINT_8( 0xBD, 0xBA, 0xAA, 0x06, 0xC4, 0xC6, 0xB8, 0x57 ),
+    BYTES_TO_T_UINT_8( 0x0C, 0x83, 0x01, 0xA9, 0xF6, 0x51, 0xE7, 0xB8 ),
+    BYTES_TO_T_UINT_2( 0x1B, 0x01 ),
+    BYTES_TO_T_UINT_8( 0xB9, 0xA6, 0x15, 0x8E, 0xAB, 0x1F, 0x10, 0x87 ),
+    BYTES_TO_T_UINT_8( 0x74, 0x08, 0x27, 0x1A, 0xA1, 0x21, 0xAD, 0xF5 ),
+    BYTES_TO_T_UINT_8( 0x02, 0x09, 0x90, 0x6E, 0x50, 0x90, 0x9A, 0x5D ),
+    BYTES_TO_T_UINT_8( 0x86, 0x9A, 0xFE, 0xD7, 0xA1, 0xF5, 0xA2, 0x15 ),
+    BYTES_TO_T_UINT_8( 0xE8, 0x7D, 0xE3, 0xDC, 0x21, 0xFB, 0xA4, 0x7B ),
+    BYTES_TO_T_UINT_8( 0xB9, 0xBF, 0x07, 0xFF, 0x45, 0xDF, 0x51, 0x77 ),
+    BYTES_TO_T_UINT_8( 0x0B, 0x5C, 0x34, 0x02, 0x62, 0x9B, 0x08, 0x12 ),
+    BYTES_TO_T_UINT_8( 0x86, 0xCE, 0x9A, 0x6A, 0xEC, 0x75, 0xF6, 0x46 ),
+    BYTES_TO_T_UINT_2( 0x6D, 0x00 ),
+    /* T[6].X, T[6].Y */
+    BYTES_TO_T_UINT_8( 0xE6, 0x59, 0xF4, 0x78, 0x3C, 0x60, 0xB1, 0x4A ),
+    BYTES_TO_T_UINT_8( 0x3E, 0x37, 0x84, 0x6A, 0xDC, 0xF2, 0x9A, 0x7D ),
+    BYTES_TO_T_UINT_8( 0x40, 0x9A, 0x9A, 0x15, 0x36, 0xE0, 0x2B, 0x2D ),
+    BYTES_TO_T_UINT_8( 0xEC, 0x38, 0x9C, 0x50, 0x3D, 0x1E, 0x37, 0x82 ),
+    BYTES_TO_T_UINT_8( 0xB7, 0x79, 0xF0, 0x92, 0xF2, 0x8B, 0x18, 0x82 ),
+    BYTES_TO_T_UINT_8( 0x17, 0xE0, 0x82, 0x1E, 0x80, 0x82, 0x4B, 0xD7 ),
+    BYTES_TO_T_UINT_8( 0xFA, 0xBB, 0x59, 0x6B, 0x8A, 0x77, 0x41, 0x40 ),
+    BYTES_TO_T_UINT_8( 0xA7, 0xF9, 0xD4, 0xB8, 0x4A, 0x82, 0xCF, 0x40 ),
+    BYTES_TO_T_UINT_2( 0x5D, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x1E, 0x8C, 0xC8, 0x9B, 0x72, 0x9E, 0xF7, 0xF9 ),
+    BYTES_TO_T_UINT_8( 0xB8, 0xCE, 0xE9, 0x77, 0x0A, 0x19, 0x59, 0x84 ),
+    BYTES_TO_T_UINT_8( 0x9D, 0xA1, 0x41, 0x6A, 0x72, 0x4B, 0xB4, 0xDC ),
+    BYTES_TO_T_UINT_8( 0x0B, 0x35, 0x43, 0xE2, 0x8C, 0xBE, 0x0D, 0xE3 ),
+    BYTES_TO_T_UINT_8( 0xC1, 0xEB, 0xAD, 0xF3, 0xA9, 0xA6, 0x68, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0x81, 0x2F, 0xE2, 0x48, 0x0C, 0xDB, 0x1F, 0x42 ),
+    BYTES_TO_T_UINT_8( 0xD1, 0x1E, 0x60, 0x9B, 0x2A, 0xD2, 0xC1, 0x3C ),
+    BYTES_TO_T_UINT_8( 0xC0, 0x64, 0xB5, 0xD2, 0xF6, 0xF6, 0x6E, 0x22 ),
+    BYTES_TO_T_UINT_2( 0x70, 0x01 ),
+    /* T[7].X, T[7].Y */
+    BYTES_TO_T_UINT_8( 0xC6, 0x3D, 0x30, 0x78, 0x10, 0x18, 0x41, 0x51 ),
+    BYTES_TO_T_UINT_8( 0x96, 0x1D, 0x1C, 0xE0, 0x6D, 0x83, 0xD1, 0x93 ),
+    BYTES_TO_T_UINT_8( 0x7B, 0x03, 0x0B, 0xF5, 0x2F, 0x6C, 0x04, 0x98 ),
+    BYTES_TO_T_UINT_8( 0x6C, 0x3E, 0xD5, 0xFC, 0x31, 0x5B, 0x3A, 0xEB ),
+    BYTES_TO_T_UINT_8( 0x50, 0x82, 0x2F, 0xFB, 0xFE, 0xF8, 0x76, 0x39 ),
+    BYTES_TO_T_UINT_8( 0x85, 0x26, 0xDA, 0x9C, 0x36, 0xF5, 0x93, 0xD1 ),
+    BYTES_TO_T_UINT_8( 0x4C, 0xE7, 0x6E, 0xD2, 0x7D, 0x81, 0x09, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x03, 0xF9, 0x58, 0x48, 0x24, 0xA2, 0xEE ),
+    BYTES_TO_T_UINT_2( 0xE9, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x1B, 0x79, 0x0C, 0x8E, 0x6B, 0x95, 0xF3, 0xC4 ),
+    BYTES_TO_T_UINT_8( 0xF4, 0x10, 0x5C, 0x87, 0x03, 0x39, 0xCF, 0x68 ),
+    BYTES_TO_T_UINT_8( 0xAD, 0xF0, 0xF7, 0xC1, 0x07, 0xA4, 0xF4, 0x3F ),
+    BYTES_TO_T_UINT_8( 0x32, 0xE8, 0x02, 0x89, 0x65, 0xC4, 0x72, 0x36 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0x88, 0xEA, 0x96, 0x67, 0x0B, 0x5D, 0xDF ),
+    BYTES_TO_T_UINT_8( 0xA8, 0x75, 0x60, 0xA8, 0xBD, 0x74, 0xDF, 0x68 ),
+    BYTES_TO_T_UINT_8( 0x6E, 0xE5, 0x71, 0x50, 0x67, 0xD0, 0xD2, 0xE6 ),
+    BYTES_TO_T_UINT_8( 0xD5, 0xFC, 0xE5, 0xC7, 0x77, 0xB0, 0x7F, 0x8C ),
+    BYTES_TO_T_UINT_2( 0xF1, 0x01 ),
+    /* T[8].X, T[8].Y */
+    BYTES_TO_T_UINT_8( 0x97, 0x86, 0x69, 0xCD, 0x0D, 0x9A, 0xBD, 0x66 ),
+    BYTES_TO_T_UINT_8( 0x58, 0x17, 0xBC, 0xBB, 0x59, 0x85, 0x7D, 0x0E ),
+    BYTES_TO_T_UINT_8( 0x8D, 0xA8, 0x76, 0xAC, 0x80, 0xA9, 0x72, 0xE0 ),
+    BYTES_TO_T_UINT_8( 0x74, 0x78, 0xC1, 0xE2, 0x4D, 0xAF, 0xF9, 0x3C ),
+    BYTES_TO_T_UINT_8( 0xAD, 0x97, 0x8E, 0x74, 0xC4, 0x4B, 0xB2, 0x85 ),
+    BYTES_TO_T_UINT_8( 0xEA, 0xD8, 0xF6, 0xF3, 0xAF, 0x2F, 0x52, 0xE5 ),
+    BYTES_TO_T_UINT_8( 0x95, 0x57, 0xF4, 0xCE, 0xEE, 0x43, 0xED, 0x60 ),
+    BYTES_TO_T_UINT_8( 0x7D, 0x46, 0x38, 0xDE, 0x20, 0xFD, 0x59, 0x18 ),
+    BYTES_TO_T_UINT_2( 0xD7, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x1C, 0x18, 0xE8, 0x58, 0xB9, 0x76, 0x2C, 0xE6 ),
+    BYTES_TO_T_UINT_8( 0xED, 0x54, 0xE4, 0xFE, 0xC7, 0xBC, 0x31, 0x37 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0xF8, 0x89, 0xEE, 0x70, 0xB5, 0xB0, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x83, 0x22, 0x26, 0x9A, 0x53, 0xB9, 0x38, 0x0A ),
+    BYTES_TO_T_UINT_8( 0x74, 0xA7, 0x19, 0x8C, 0x74, 0x7E, 0x88, 0x46 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0xDA, 0x0A, 0xE8, 0xDA, 0xA5, 0xBE, 0x1D ),
+    BYTES_TO_T_UINT_8( 0x90, 0x5C, 0xF7, 0xB1, 0x0C, 0x72, 0xFB, 0x09 ),
+    BYTES_TO_T_UINT_8( 0x78, 0xE2, 0x23, 0xE7, 0x46, 0xB7, 0xE0, 0x91 ),
+    BYTES_TO_T_UINT_2( 0xC5, 0x01 ),
+    /* T[9].X, T[9].Y */
+    BYTES_TO_T_UINT_8( 0x3A, 0x36, 0xBC, 0xBD, 0x48, 0x11, 0x8E, 0x72 ),
+    BYTES_TO_T_UINT_8( 0xAB, 0xBB, 0xA1, 0xF7, 0x0B, 0x9E, 0xBF, 0xDF ),
+    BYTES_TO_T_UINT_8( 0x68, 0x28, 0xE1, 0xA2, 0x8F, 0xFC, 0xFC, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0x81, 0xFE, 0x19, 0x0A, 0xE5, 0xE7, 0x69, 0x39 ),
+    BYTES_TO_T_UINT_8( 0x5E, 0xCD, 0x12, 0xF5, 0xBE, 0xD3, 0x04, 0xF1 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0xA8, 0x0D, 0x81, 0x59, 0xC4, 0x79, 0x98 ),
+    BYTES_TO_T_UINT_8( 0xA3, 0xF3, 0x4B, 0x92, 0x65, 0xC3, 0x31, 0xAD ),
+    BYTES_TO_T_UINT_8( 0x75, 0xB5, 0x4F, 0x4D, 0x91, 0xD4, 0xE2, 0xB2 ),
+    BYTES_TO_T_UINT_2( 0x51, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x72, 0x09, 0x41, 0x79, 0x1D, 0x4D, 0x0D, 0x33 ),
+    BYTES_TO_T_UINT_8( 0xBB, 0x31, 0x18, 0xBA, 0xA0, 0xF2, 0x6E, 0x7E ),
+    BYTES_TO_T_UINT_8( 0x93, 0x5B, 0x4D, 0x4F, 0xAF, 0xC9, 0x8C, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0x48, 0x99, 0x9C, 0x06, 0x68, 0xDE, 0xD8, 0x29 ),
+    BYTES_TO_T_UINT_8( 0xA0, 0x04, 0xE1, 0xB5, 0x9D, 0x00, 0xBC, 0xB8 ),
+    BYTES_TO_T_UINT_8( 0x61, 0x95, 0x92, 0x8D, 0x72, 0xD3, 0x37, 0x42 ),
+    BYTES_TO_T_UINT_8( 0xAB, 0x4B, 0x27, 0xA2, 0xE8, 0xA4, 0x26, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0x45, 0x9C, 0xA9, 0xCB, 0x9F, 0xBA, 0x85 ),
+    BYTES_TO_T_UINT_2( 0xCB, 0x00 ),
+    /* T[10].X, T[10].Y */
+    BYTES_TO_T_UINT_8( 0x08, 0x7E, 0x1B, 0x64, 0xF4, 0xE8, 0xA5, 0x55 ),
+    BYTES_TO_T_UINT_8( 0xF7, 0x20, 0xA9, 0xCA, 0xF3, 0x89, 0xE5, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0x83, 0xED, 0xFC, 0xAB, 0xD9, 0x0A, 0xB9, 0x07 ),
+    BYTES_TO_T_UINT_8( 0x08, 0x6F, 0x46, 0x7C, 0xCD, 0x78, 0xFF, 0x05 ),
+    BYTES_TO_T_UINT_8( 0x69, 0xAB, 0x71, 0x5A, 0x94, 0xAB, 0x20, 0x20 ),
+    BYTES_TO_T_UINT_8( 0xC2, 0x2E, 0xEE, 0x87, 0x57, 0x1F, 0xAD, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0x91, 0x4C, 0x3D, 0xFB, 0x7E, 0xA1, 0x8B, 0x07 ),
+    BYTES_TO_T_UINT_8( 0x69, 0xCF, 0x07, 0x86, 0xBA, 0x53, 0x37, 0xCF ),
+    BYTES_TO_T_UINT_2( 0x38, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x00, 0x26, 0xB2, 0xB9, 0xE2, 0x91, 0xE3, 0xB5 ),
+    BYTES_TO_T_UINT_8( 0x79, 0xC9, 0x54, 0x84, 0x08, 0x3D, 0x0B, 0xD2 ),
+    BYTES_TO_T_UINT_8( 0x5D, 0xA8, 0x77, 0x2F, 0x64, 0x45, 0x99, 0x4C ),
+    BYTES_TO_T_UINT_8( 0x87, 0x96, 0x16, 0x1F, 0xDB, 0x96, 0x28, 0x97 ),
+    BYTES_TO_T_UINT_8( 0x83, 0x2B, 0x8D, 0xFF, 0xA2, 0x4F, 0x55, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0x71, 0xE6, 0x48, 0xBD, 0x99, 0x3D, 0x12, 0x57 ),
+    BYTES_TO_T_UINT_8( 0x3F, 0x84, 0x59, 0xDA, 0xB9, 0xB6, 0x66, 0x12 ),
+    BYTES_TO_T_UINT_8( 0x6D, 0x78, 0x41, 0x92, 0xDF, 0xF4, 0x3F, 0x63 ),
+    BYTES_TO_T_UINT_2( 0x1F, 0x01 ),
+    /* T[11].X, T[11].Y */
+    BYTES_TO_T_UINT_8( 0x7E, 0x86, 0x6F, 0x4F, 0xBF, 0x67, 0xDF, 0x2F ),
+    BYTES_TO_T_UINT_8( 0xF2, 0x2B, 0x1E, 0x5F, 0x00, 0xEA, 0xF6, 0x56 ),
+    BYTES_TO_T_UINT_8( 0x90, 0xB9, 0x6A, 0x89, 0xD8, 0xC0, 0xD7, 0xA7 ),
+    BYTES_TO_T_UINT_8( 0xCB, 0x9A, 0x32, 0x23, 0xA0, 0x02, 0x91, 0x58 ),
+    BYTES_TO_T_UINT_8( 0x42, 0x7F, 0x6A, 0x15, 0x64, 0x6A, 0x8B, 0xBB ),
+    BYTES_TO_T_UINT_8( 0x8A, 0x57, 0x82, 0x58, 0xA9, 0x56, 0xB5, 0xFB ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x50, 0x92, 0x60, 0xCC, 0x81, 0x24, 0xA8 ),
+    BYTES_TO_T_UINT_8( 0x36, 0x3D, 0xAD, 0xDA, 0xD9, 0x51, 0x3E, 0x57 ),
+    BYTES_TO_T_UINT_2( 0x5D, 0x00 ),
+    BYTES_TO_T_UINT_8( 0xEC, 0xFE, 0x8F, 0xB0, 0x0B, 0xDE, 0x2E, 0x7E ),
+    BYTES_TO_T_UINT_8( 0x79, 0xD2, 0xBE, 0xEF, 0xAC, 0x76, 0x71, 0xA3 ),
+    BYTES_TO_T_UINT_8( 0x55, 0xE8, 0x72, 0x0B, 0xAC, 0xFE, 0xCA, 0x5A ),
+    BYTES_TO_T_UINT_8( 0xAD, 0x5B, 0xC7, 0xFC, 0xE3, 0x3C, 0x7C, 0x4C ),
+    BYTES_TO_T_UINT_8( 0xA1, 0x04, 0xA7, 0xB9, 0x9B, 0x93, 0xC0, 0x2F ),
+    BYTES_TO_T_UINT_8( 0x41, 0x48, 0x4B, 0x8E, 0x32, 0xC5, 0xF0, 0x6B ),
+    BYTES_TO_T_UINT_8( 0xB0, 0x42, 0x07, 0xC1, 0xF2, 0xF1, 0x72, 0x5B ),
+    BYTES_TO_T_UINT_8( 0x1E, 0x37, 0x54, 0x9C, 0x88, 0xD2, 0x62, 0xAA ),
+    BYTES_TO_T_UINT_2( 0xC1, 0x01 ),
+    /* T[12].X, T[12].Y */
+    BYTES_TO_T_UINT_8( 0xC2, 0x19, 0x8A, 0x89, 0x58, 0xA2, 0x0F, 0xDB ),
+    BYTES_TO_T_UINT_8( 0x01, 0xCC, 0x4C, 0x97, 0x30, 0x66, 0x34, 0x26 ),
+    BYTES_TO_T_UINT_8( 0x83, 0x6A, 0x1E, 0x1F, 0xDB, 0xC9, 0x5E, 0x13 ),
+    BYTES_TO_T_UINT_8( 0x1B, 0x4D, 0x49, 0xFF, 0x9B, 0x9C, 0xAC, 0x9B ),
+    BYTES_TO_T_UINT_8( 0xD7, 0xE4, 0x4B, 0xF2, 0xD4, 0x1A, 0xD2, 0x78 ),
+    BYTES_TO_T_UINT_8( 0xCD, 0xDA, 0xE8, 0x61, 0x9F, 0xC8, 0x49, 0x32 ),
+    BYTES_TO_T_UINT_8( 0x51, 0xCB, 0xF2, 0x2D, 0x85, 0xF6, 0x8D, 0x52 ),
+    BYTES_TO_T_UINT_8( 0xB7, 0xC5, 0xCD, 0x2C, 0x79, 0xC6, 0x0E, 0x4F ),
+    BYTES_TO_T_UINT_2( 0xDB, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x73, 0x1D, 0x55, 0x0F, 0xF8, 0x22, 0x9F, 0x78 ),
+    BYTES_TO_T_UINT_8( 0x76, 0x56, 0xBA, 0xE7, 0x57, 0x32, 0xEC, 0x42 ),
+    BYTES_TO_T_UINT_8( 0x65, 0x9A, 0xC6, 0x4C, 0x09, 0xC4, 0x52, 0x3F ),
+    BYTES_TO_T_UINT_8( 0xB6, 0x1E, 0x6F, 0xF4, 0x7D, 0x27, 0xDD, 0xAF ),
+    BYTES_TO_T_UINT_8( 0x94, 0x11, 0x16, 0xEC, 0x79, 0x83, 0xAD, 0xAE ),
+    BYTES_TO_T_UINT_8( 0x46, 0x4E, 0x92, 0x1F, 0x19, 0x7D, 0x65, 0xDC ),
+    BYTES_TO_T_UINT_8( 0x09, 0xFF, 0x78, 0x15, 0x45, 0x63, 0x32, 0xE4 ),
+    BYTES_TO_T_UINT_8( 0xBF, 0x91, 0xD0, 0x78, 0x58, 0xDA, 0x50, 0x47 ),
+    BYTES_TO_T_UINT_2( 0x73, 0x01 ),
+    /* T[13].X, T[13].Y */
+    BYTES_TO_T_UINT_8( 0x23, 0xDE, 0x40, 0xF6, 0x41, 0xB4, 0x3B, 0x95 ),
+    BYTES_TO_T_UINT_8( 0xC6, 0x8D, 0xE0, 0xE1, 0xA9, 0xF0, 0x35, 0x5D ),
+    BYTES_TO_T_UINT_8( 0xE6, 0xD4, 0xBA, 0x7B, 0xCC, 0x1B, 0x3A, 0x32 ),
+    BYTES_TO_T_UINT_8( 0xD0, 0x5A, 0x2E, 0x74, 0x47, 0x14, 0xC3, 0x4D ),
+    BYTES_TO_T_UINT_8( 0x7D, 0xF0, 0x8B, 0x06, 0x15, 0x8E, 0x0E, 0xCA ),
+    BYTES_TO_T_UINT_8( 0xB5, 0xD2, 0xEB, 0x97, 0x50, 0x7D, 0x31, 0xFC ),
+    BYTES_TO_T_UINT_8( 0x42, 0x93, 0x4C, 0xDB, 0x97, 0x79, 0x44, 0xF5 ),
+    BYTES_TO_T_UINT_8( 0x9C, 0xA2, 0xA0, 0x0B, 0xC8, 0x3A, 0x8A, 0xF9 ),
+    BYTES_TO_T_UINT_2( 0x61, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x79, 0x50, 0x92, 0x9E, 0x24, 0x1F, 0xCB, 0x4C ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x16, 0xC9, 0xC5, 0x3D, 0x5A, 0xAF, 0x97 ),
+    BYTES_TO_T_UINT_8( 0x18, 0xE3, 0x97, 0xE4, 0xA8, 0x50, 0xF6, 0x7E ),
+    BYTES_TO_T_UINT_8( 0x45, 0x57, 0x97, 0x42, 0x78, 0x92, 0x49, 0x0D ),
+    BYTES_TO_T_UINT_8( 0xA5, 0xEB, 0x62, 0x24, 0xFB, 0x8F, 0x32, 0xCF ),
+    BYTES_TO_T_UINT_8( 0xF3, 0x0C, 0x36, 0x6E, 0x8F, 0xE8, 0xE8, 0x8E ),
+    BYTES_TO_T_UINT_8( 0xC2, 0xD3, 0x7C, 0xC7, 0x8D, 0x3F, 0x5C, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0x6A, 0x64, 0x6A, 0x73, 0x10, 0x79, 0xB8, 0x5A ),
+    BYTES_TO_T_UINT_2( 0xCB, 0x01 ),
+    /* T[14].X, T[14].Y */
+    BYTES_TO_T_UINT_8( 0x51, 0xF9, 0xEF, 0xA5, 0x20, 0x4A, 0x5C, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0x2F, 0xF3, 0xF4, 0x49, 0x5B, 0x73, 0xAA, 0x1B ),
+    BYTES_TO_T_UINT_8( 0xC6, 0xF2, 0xEA, 0x0F, 0x00, 0xAD, 0x53, 0xAB ),
+    BYTES_TO_T_UINT_8( 0x03, 0xB8, 0x66, 0xED, 0xC4, 0x2B, 0x4C, 0x35 ),
+    BYTES_TO_T_UINT_8( 0x3A, 0x2F, 0xC1, 0x9A, 0x37, 0xD2, 0x7F, 0x58 ),
+    BYTES_TO_T_UINT_8( 0x29, 0xA7, 0x81, 0x38, 0x64, 0xC9, 0x37, 0x38 ),
+    BYTES_TO_T_UINT_8( 0xBE, 0x3B, 0x6C, 0x9F, 0x5B, 0xD9, 0x8B, 0x1D ),
+    BYTES_TO_T_UINT_8( 0xB6, 0x14, 0xD9, 0x08, 0xD8, 0xD2, 0x7E, 0x23 ),
+    BYTES_TO_T_UINT_2( 0x1C, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x15, 0x71, 0xE6, 0x3D, 0xD1, 0xB0, 0xE7, 0xCD ),
+    BYTES_TO_T_UINT_8( 0x5B, 0x81, 0x23, 0xEC, 0x2D, 0x42, 0x45, 0xE6 ),
+    BYTES_TO_T_UINT_8( 0x51, 0x5B, 0x44, 0x6B, 0x89, 0x03, 0x67, 0x28 ),
+    BYTES_TO_T_UINT_8( 0x84, 0x27, 0xAE, 0x80, 0x5A, 0x33, 0xBE, 0x11 ),
+    BYTES_TO_T_UINT_8( 0xE3, 0xB6, 0x64, 0x1A, 0xDF, 0xD3, 0x85, 0x91 ),
+    BYTES_TO_T_UINT_8( 0x67, 0x8C, 0x22, 0xBA, 0xD0, 0xBD, 0xCC, 0xA0 ),
+    BYTES_TO_T_UINT_8( 0xF7, 0x3C, 0x01, 0x3A, 0xFF, 0x9D, 0xC7, 0x6B ),
+    BYTES_TO_T_UINT_8( 0x0C, 0xC7, 0x64, 0xB4, 0x59, 0x4E, 0x9F, 0x22 ),
+    BYTES_TO_T_UINT_2( 0x85, 0x01 ),
+    /* T[15].X, T[15].Y */
+    BYTES_TO_T_UINT_8( 0xA1, 0x34, 0x0A, 0x41, 0x94, 0xA8, 0xF2, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0xF6, 0xD4, 0xE4, 0xF0, 0x97, 0x45, 0x6D, 0xCA ),
+    BYTES_TO_T_UINT_8( 0x8F, 0x1F, 0x4D, 0x6D, 0xFE, 0xA0, 0xC4, 0x84 ),
+    BYTES_TO_T_UINT_8( 0x1D, 0x28, 0x5C, 0x40, 0xBB, 0x65, 0xD4, 0x42 ),
+    BYTES_TO_T_UINT_8( 0x98, 0xA8, 0x87, 0x35, 0x20, 0x3A, 0x89, 0x44 ),
+    BYTES_TO_T_UINT_8( 0xD6, 0xFD, 0x4F, 0xAB, 0x2D, 0xD1, 0xD0, 0xC0 ),
+    BYTES_TO_T_UINT_8( 0x86, 0xE8, 0x00, 0xFC, 0x69, 0x52, 0xF8, 0xD5 ),
+    BYTES_TO_T_UINT_8( 0xE1, 0x9A, 0x99, 0xE1, 0xDC, 0x9C, 0x3F, 0xD9 ),
+    BYTES_TO_T_UINT_2( 0x99, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x12, 0x08, 0x98, 0xD9, 0xCA, 0x73, 0xD5, 0xA9 ),
+    BYTES_TO_T_UINT_8( 0xB9, 0x2C, 0xE0, 0xA7, 0x3E, 0x91, 0xD7, 0x87 ),
+    BYTES_TO_T_UINT_8( 0x68, 0x04, 0xB0, 0x54, 0x09, 0xF4, 0x72, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0xC8, 0xEE, 0x28, 0xCC, 0xE8, 0x50, 0x78, 0x20 ),
+    BYTES_TO_T_UINT_8( 0x0D, 0x91, 0x03, 0x76, 0xDB, 0x68, 0x24, 0x77 ),
+    BYTES_TO_T_UINT_8( 0x7A, 0xE0, 0x56, 0xB2, 0x5D, 0x12, 0xD3, 0xB5 ),
+    BYTES_TO_T_UINT_8( 0x0D, 0x42, 0x59, 0x8B, 0xDF, 0x67, 0xB5, 0xBE ),
+    BYTES_TO_T_UINT_8( 0xD1, 0xCC, 0xE5, 0x31, 0x53, 0x7A, 0x46, 0xB3 ),
+    BYTES_TO_T_UINT_2( 0xDA, 0x01 ),
+    /* T[16].X, T[16].Y */
+    BYTES_TO_T_UINT_8( 0xCC, 0x8D, 0x59, 0xB5, 0x1B, 0x0F, 0xF4, 0xAF ),
+    BYTES_TO_T_UINT_8( 0xD9, 0x2F, 0xD1, 0x2C, 0xE0, 0xD8, 0x04, 0xEF ),
+    BYTES_TO_T_UINT_8( 0xAC, 0xF4, 0xD7, 0xBA, 0xB0, 0xA3, 0x7E, 0xC9 ),
+    BYTES_TO_T_UINT_8( 0xCD, 0x08, 0x51, 0x56, 0xA6, 0x76, 0x67, 0x33 ),
+    BYTES_TO_T_UINT_8( 0x8C, 0x17, 0x63, 0xFE, 0x56, 0xD0, 0xD9, 0x71 ),
+    BYTES_TO_T_UINT_8( 0xAA, 0xF6, 0xC3, 0x14, 0x47, 0xC5, 0xA7, 0x31 ),
+    BYTES_TO_T_UINT_8( 0x72, 0x4C, 0x80, 0xF6, 0xA2, 0x57, 0xA7, 0x5D ),
+    BYTES_TO_T_UINT_8( 0x11, 0xB3, 0x7B, 0xF8, 0x2F, 0xE1, 0x3E, 0x7B ),
+    BYTES_TO_T_UINT_2( 0xFA, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x26, 0xF4, 0xF9, 0x6B, 0x7B, 0x90, 0xDF, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x1F, 0x82, 0xEF, 0x62, 0xA1, 0x4C, 0x53, 0xCA ),
+    BYTES_TO_T_UINT_8( 0xE6, 0x99, 0x76, 0x01, 0xBA, 0x8D, 0x0F, 0x54 ),
+    BYTES_TO_T_UINT_8( 0xAF, 0xF4, 0x58, 0x73, 0x56, 0xFE, 0xDD, 0x7C ),
+    BYTES_TO_T_UINT_8( 0xF6, 0xCE, 0xF9, 0xE8, 0xA1, 0x34, 0xC3, 0x5B ),
+    BYTES_TO_T_UINT_8( 0x09, 0x5F, 0xDC, 0x6A, 0x3D, 0xD8, 0x7F, 0x42 ),
+    BYTES_TO_T_UINT_8( 0xC2, 0xF4, 0x51, 0xB8, 0xB8, 0xC1, 0xD7, 0x2F ),
+    BYTES_TO_T_UINT_8( 0xAE, 0x7D, 0x58, 0xD1, 0xD4, 0x1B, 0x4D, 0x23 ),
+    BYTES_TO_T_UINT_2( 0xD3, 0x00 ),
+    /* T[17].X, T[17].Y */
+    BYTES_TO_T_UINT_8( 0xB9, 0x95, 0xDF, 0x00, 0xD8, 0x21, 0xDE, 0x94 ),
+    BYTES_TO_T_UINT_8( 0xF7, 0x47, 0x3C, 0xC3, 0xB2, 0x01, 0x53, 0x5D ),
+    BYTES_TO_T_UINT_8( 0x1E, 0x17, 0x43, 0x23, 0xBD, 0xCA, 0x71, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0x70, 0xBA, 0x0F, 0x4F, 0xDC, 0x41, 0x54, 0xBE ),
+    BYTES_TO_T_UINT_8( 0xD6, 0x39, 0x26, 0x70, 0x53, 0x32, 0x18, 0x11 ),
+    BYTES_TO_T_UINT_8( 0x32, 0x46, 0x07, 0x97, 0x3A, 0x57, 0xE0, 0x01 ),
+    BYTES_TO_T_UINT_8( 0xD6, 0x92, 0x4F, 0xCE, 0xDF, 0x25, 0x80, 0x26 ),
+    BYTES_TO_T_UINT_8( 0x5B, 0x6F, 0x9A, 0x03, 0x05, 0x4B, 0xD1, 0x47 ),
+    BYTES_TO_T_UINT_2( 0x5D, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x25, 0x01, 0x72, 0x30, 0x90, 0x17, 0x51, 0x20 ),
+    BYTES_TO_T_UINT_8( 0x74, 0xFB, 0x41, 0x65, 0x5C, 0xB4, 0x2D, 0xEE ),
+    BYTES_TO_T_UINT_8( 0x66, 0xCD, 0xCD, 0xAA, 0x41, 0xCC, 0xBB, 0x07 ),
+    BYTES_TO_T_UINT_8( 0xD4, 0xCE, 0x08, 0x0A, 0x63, 0xE9, 0xA2, 0xFF ),
+    BYTES_TO_T_UINT_8( 0x3D, 0xA8, 0x21, 0x7F, 0x7A, 0x5B, 0x9B, 0x81 ),
+    BYTES_TO_T_UINT_8( 0x10, 0x6B, 0x89, 0x44, 0x0A, 0x7F, 0x85, 0x5F ),
+    BYTES_TO_T_UINT_8( 0x7D, 0xDE, 0x7C, 0x19, 0x5C, 0x65, 0x26, 0x61 ),
+    BYTES_TO_T_UINT_8( 0xD7, 0xAC, 0x62, 0x29, 0x4A, 0xF1, 0xD0, 0x81 ),
+    BYTES_TO_T_UINT_2( 0x38, 0x01 ),
+    /* T[18].X, T[18].Y */
+    BYTES_TO_T_UINT_8( 0x32, 0x00, 0x40, 0x87, 0xEB, 0xA9, 0x58, 0x56 ),
+    BYTES_TO_T_UINT_8( 0xAF, 0x51, 0x0B, 0xFF, 0x56, 0x35, 0x51, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0x7B, 0xAC, 0x08, 0x94, 0x71, 0xDA, 0xEC, 0x99 ),
+    BYTES_TO_T_UINT_8( 0x5F, 0x4D, 0xC5, 0x7B, 0x31, 0x8B, 0x8D, 0x5E ),
+    BYTES_TO_T_UINT_8( 0x15, 0x05, 0xF1, 0x3E, 0x9E, 0x8F, 0x17, 0x8F ),
+    BYTES_TO_T_UINT_8( 0xF0, 0x9C, 0x4B, 0x62, 0x94, 0xAD, 0x49, 0xFC ),
+    BYTES_TO_T_UINT_8( 0x0F, 0xC9, 0xC6, 0x8F, 0xFD, 0x33, 0x44, 0x34 ),
+    BYTES_TO_T_UINT_8( 0x5F, 0x96, 0x17, 0x7F, 0x42, 0xBE, 0xF7, 0x0D ),
+    BYTES_TO_T_UINT_2( 0xD4, 0x00 ),
+    BYTES_TO_T_UINT_8( 0xFB, 0x29, 0x39, 0x13, 0x08, 0x8D, 0x91, 0x47 ),
+    BYTES_TO_T_UINT_8( 0xF6, 0x79, 0xF9, 0x2F, 0xA9, 0x0A, 0xCF, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0xAB, 0x87, 0x7A, 0xA3, 0x19, 0xAB, 0x55, 0xAD ),
+    BYTES_TO_T_UINT_8( 0xE8, 0x0B, 0x01, 0xC5, 0x56, 0x19, 0x9D, 0x9E ),
+    BYTES_TO_T_UINT_8( 0x19, 0xDE, 0x82, 0x3B, 0xEA, 0xD3, 0x0B, 0x8C ),
+    BYTES_TO_T_UINT_8( 0x65, 0x6B, 0xC7, 0xF3, 0x0F, 0x82, 0x87, 0x6C ),
+    BYTES_TO_T_UINT_8( 0xD8, 0x2E, 0x23, 0xF2, 0x39, 0x9D, 0x49, 0x70 ),
+    BYTES_TO_T_UINT_8( 0x31, 0xDE, 0xAF, 0x7A, 0xEE, 0xB0, 0xDA, 0x70 ),
+    BYTES_TO_T_UINT_2( 0x63, 0x01 ),
+    /* T[19].X, T[19].Y */
+    BYTES_TO_T_UINT_8( 0x76, 0x4E, 0x2A, 0x50, 0xFD, 0x8E, 0xC0, 0xEB ),
+    BYTES_TO_T_UINT_8( 0x52, 0x0F, 0x7C, 0x76, 0x63, 0xD8, 0x89, 0x45 ),
+    BYTES_TO_T_UINT_8( 0xEC, 0x2D, 0xB9, 0x4E, 0xF4, 0xEE, 0x85, 0xCF ),
+    BYTES_TO_T_UINT_8( 0xC1, 0x95, 0x5C, 0x96, 0x5D, 0xAA, 0x59, 0x0B ),
+    BYTES_TO_T_UINT_8( 0xCA, 0xDB, 0xD2, 0x68, 0x8E, 0x5A, 0x94, 0x60 ),
+    BYTES_TO_T_UINT_8( 0xD9, 0x02, 0xBF, 0x77, 0x9F, 0xB9, 0x4C, 0xC9 ),
+    BYTES_TO_T_UINT_8( 0x2D, 0xDC, 0xC0, 0xCF, 0x81, 0x1E, 0xC4, 0x6C ),
+    BYTES_TO_T_UINT_8( 0x2B, 0xCC, 0x37, 0x86, 0xDC, 0xE2, 0x64, 0x72 ),
+    BYTES_TO_T_UINT_2( 0xD5, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x2C, 0x30, 0xB1, 0x59, 0x20, 0x9D, 0x98, 0x28 ),
+    BYTES_TO_T_UINT_8( 0x77, 0x0C, 0x9D, 0xF8, 0x20, 0xDC, 0x90, 0xBA ),
+    BYTES_TO_T_UINT_8( 0xB1, 0xA0, 0xF4, 0xE7, 0x3E, 0x9C, 0x9E, 0xA2 ),
+    BYTES_TO_T_UINT_8( 0xB5, 0x25, 0xA2, 0xB0, 0x54, 0xCD, 0x2E, 0x33 ),
+    BYTES_TO_T_UINT_8( 0xEA, 0xD9, 0x42, 0xB0, 0x80, 0xB0, 0xA3, 0x38 ),
+    BYTES_TO_T_UINT_8( 0x9F, 0xFE, 0x9D, 0x8D, 0x40, 0xFF, 0x27, 0x6D ),
+    BYTES_TO_T_UINT_8( 0x3A, 0x9D, 0xA6, 0x88, 0x3A, 0x8B, 0x6F, 0x14 ),
+    BYTES_TO_T_UINT_8( 0xB6, 0x39, 0xEE, 0x1F, 0x3F, 0xB1, 0x4F, 0x63 ),
+    BYTES_TO_T_UINT_2( 0x31, 0x00 ),
+    /* T[20].X, T[20].Y */
+    BYTES_TO_T_UINT_8( 0x6D, 0xD7, 0x9E, 0xFF, 0xD2, 0x35, 0x67, 0x03 ),
+    BYTES_TO_T_UINT_8( 0xCA, 0x4F, 0x15, 0x5D, 0xE3, 0xE8, 0x53, 0x86 ),
+    BYTES_TO_T_UINT_8( 0x92, 0xF7, 0x24, 0x98, 0xA2, 0xCB, 0x11, 0x68 ),
+    BYTES_TO_T_UINT_8( 0x06, 0x2E, 0x25, 0xE1, 0x94, 0xC5, 0xA3, 0x96 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0x82, 0x6E, 0xBA, 0xE7, 0x43, 0x25, 0xB0 ),
+    BYTES_TO_T_UINT_8( 0x18, 0x65, 0xB4, 0x49, 0x73, 0x18, 0x35, 0x54 ),
+    BYTES_TO_T_UINT_8( 0x59, 0x5B, 0xBC, 0x62, 0x86, 0x4C, 0xC1, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x9B, 0xF2, 0x95, 0xA2, 0xBB, 0xA2, 0x35, 0x65 ),
+    BYTES_TO_T_UINT_2( 0xBF, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x72, 0x59, 0x62, 0xB0, 0x4B, 0x1E, 0xB4, 0xD8 ),
+    BYTES_TO_T_UINT_8( 0x0D, 0x55, 0xCE, 0xB0, 0x69, 0xBA, 0x63, 0x10 ),
+    BYTES_TO_T_UINT_8( 0x6E, 0x69, 0x86, 0xDB, 0x34, 0x7D, 0x68, 0x64 ),
+    BYTES_TO_T_UINT_8( 0xDA, 0x06, 0xCA, 0x55, 0x44, 0x36, 0x2B, 0xBA ),
+    BYTES_TO_T_UINT_8( 0x6C, 0xD4, 0xC4, 0x3D, 0xCD, 0x9E, 0x69, 0xA4 ),
+    BYTES_TO_T_UINT_8( 0x3F, 0x44, 0xE4, 0xBF, 0x31, 0xE6, 0x40, 0x9F ),
+    BYTES_TO_T_UINT_8( 0x7E, 0x4F, 0xFA, 0x75, 0xE3, 0xFB, 0x97, 0x0E ),
+    BYTES_TO_T_UINT_8( 0x08, 0xC0, 0xBD, 0x1C, 0x48, 0xB0, 0x26, 0xD0 ),
+    BYTES_TO_T_UINT_2( 0xD2, 0x01 ),
+    /* T[21].X, T[21].Y */
+    BYTES_TO_T_UINT_8( 0x1C, 0x7B, 0x32, 0xFA, 0xF2, 0x6D, 0x84, 0x8E ),
+    BYTES_TO_T_UINT_8( 0xA0, 0x21, 0x03, 0x1D, 0x0D, 0x22, 0x55, 0x67 ),
+    BYTES_TO_T_UINT_8( 0x18, 0xF9, 0x42, 0x03, 0x9C, 0xC2, 0xCB, 0xBA ),
+    BYTES_TO_T_UINT_8( 0xF8, 0xA1, 0x96, 0xD9, 0x9D, 0x11, 0x6F, 0xBE ),
+    BYTES_TO_T_UINT_8( 0xFF, 0x40, 0x57, 0xEB, 0x40, 0x2D, 0xC0, 0x11 ),
+    BYTES_TO_T_UINT_8( 0x2F, 0x96, 0xBB, 0x4F, 0x2F, 0x23, 0xA8, 0x28 ),
+    BYTES_TO_T_UINT_8( 0x3A, 0x29, 0x85, 0x21, 0xA5, 0x50, 0x62, 0x06 ),
+    BYTES_TO_T_UINT_8( 0xC9, 0x7D, 0x92, 0xCF, 0x87, 0x0C, 0x22, 0xF9 ),
+    BYTES_TO_T_UINT_2( 0xC9, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x5A, 0x0E, 0xA5, 0x32, 0x5B, 0xDF, 0x9C, 0xD5 ),
+    BYTES_TO_T_UINT_8( 0x27, 0x96, 0x37, 0x2C, 0x88, 0x35, 0x30, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0x40, 0xB4, 0x69, 0xFF, 0xEB, 0xC6, 0x94, 0x08 ),
+    BYTES_TO_T_UINT_8( 0xC9, 0x55, 0x60, 0xAD, 0xAA, 0x58, 0x14, 0x88 ),
+    BYTES_TO_T_UINT_8( 0x3C, 0xFF, 0xF2, 0xB2, 0xD5, 0xA7, 0xD9, 0x27 ),
+    BYTES_TO_T_UINT_8( 0x2D, 0xAE, 0x54, 0xD2, 0x60, 0x31, 0xF3, 0x15 ),
+    BYTES_TO_T_UINT_8( 0xBB, 0x92, 0x83, 0xE3, 0xF1, 0x42, 0x83, 0x6E ),
+    BYTES_TO_T_UINT_8( 0x49, 0xD2, 0xC8, 0xB7, 0x76, 0x45, 0x7F, 0x7D ),
+    BYTES_TO_T_UINT_2( 0x04, 0x01 ),
+    /* T[22].X, T[22].Y */
+    BYTES_TO_T_UINT_8( 0x4A, 0x11, 0xA4, 0xFB, 0x7A, 0x01, 0xBC, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0xCD, 0x27, 0x73, 0x8D, 0x02, 0x91, 0x27, 0x8E ),
+    BYTES_TO_T_UINT_8( 0xA4, 0x62, 0xF6, 0xDD, 0x6B, 0xFA, 0x5B, 0xB9 ),
+    BYTES_TO_T_UINT_8( 0xEF, 0xCA, 0xA2, 0x44, 0x2C, 0xF0, 0x28, 0xD8 ),
+    BYTES_TO_T_UINT_8( 0x3C, 0xF1, 0x7A, 0xA2, 0x42, 0x4C, 0x50, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0x2D, 0x83, 0x3E, 0x50, 0xAB, 0x9C, 0xF7, 0x67 ),
+    BYTES_TO_T_UINT_8( 0x1D, 0xED, 0x78, 0xCB, 0x76, 0x69, 0xDA, 0x42 ),
+    BYTES_TO_T_UINT_8( 0xDB, 0x01, 0x1E, 0x43, 0x27, 0x47, 0x6E, 0xDA ),
+    BYTES_TO_T_UINT_2( 0x94, 0x00 ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x4F, 0x54, 0xB9, 0x3E, 0xBD, 0xD5, 0x44 ),
+    BYTES_TO_T_UINT_8( 0xC9, 0x35, 0x40, 0x69, 0x7F, 0x74, 0x9D, 0x32 ),
+    BYTES_TO_T_UINT_8( 0x5A, 0x06, 0x6F, 0x67, 0x68, 0x2B, 0x4D, 0x10 ),
+    BYTES_TO_T_UINT_8( 0xC6, 0x65, 0x41, 0xFC, 0x7C, 0x1E, 0xE8, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0xF2, 0x79, 0x37, 0xAF, 0xFD, 0xD2, 0xDA, 0x4C ),
+    BYTES_TO_T_UINT_8( 0x33, 0xA8, 0x69, 0x56, 0x62, 0xA4, 0xE4, 0xA3 ),
+    BYTES_TO_T_UINT_8( 0x42, 0x71, 0x73, 0x21, 0x8A, 0x17, 0x81, 0xA2 ),
+    BYTES_TO_T_UINT_8( 0x14, 0x55, 0x8F, 0x7B, 0xB8, 0xAF, 0xF7, 0x86 ),
+    BYTES_TO_T_UINT_2( 0xAA, 0x01 ),
+    /* T[23].X, T[23].Y */
+    BYTES_TO_T_UINT_8( 0x4B, 0xD1, 0xBD, 0xBE, 0x8C, 0xBC, 0x60, 0x6E ),
+    BYTES_TO_T_UINT_8( 0x62, 0xA6, 0x57, 0x8C, 0xAE, 0x5C, 0x19, 0xFE ),
+    BYTES_TO_T_UINT_8( 0x7A, 0x43, 0xE4, 0xD9, 0xD8, 0x7B, 0xE7, 0x41 ),
+    BYTES_TO_T_UINT_8( 0xED, 0xB9, 0xE4, 0x85, 0x7C, 0x2E, 0xFC, 0x20 ),
+    BYTES_TO_T_UINT_8( 0x02, 0x2E, 0x01, 0x2A, 0x6D, 0x56, 0xBE, 0x97 ),
+    BYTES_TO_T_UINT_8( 0x6A, 0x0C, 0x25, 0x9B, 0xAE, 0x86, 0x37, 0x43 ),
+    BYTES_TO_T_UINT_8( 0x4A, 0x22, 0xB3, 0xCB, 0x99, 0x66, 0xB7, 0x9E ),
+    BYTES_TO_T_UINT_8( 0x56, 0xF7, 0x90, 0xF0, 0x1B, 0x09, 0x27, 0xF7 ),
+    BYTES_TO_T_UINT_2( 0xC8, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x1C, 0x16, 0x08, 0xEF, 0x39, 0x64, 0x49, 0x31 ),
+    BYTES_TO_T_UINT_8( 0x08, 0xA0, 0xE3, 0x97, 0xA9, 0x07, 0x54, 0x26 ),
+    BYTES_TO_T_UINT_8( 0xCD, 0xFF, 0xE2, 0x00, 0x07, 0x21, 0x88, 0x20 ),
+    BYTES_TO_T_UINT_8( 0x16, 0xFD, 0x59, 0x53, 0x05, 0x6C, 0x42, 0x27 ),
+    BYTES_TO_T_UINT_8( 0x8F, 0xF7, 0x39, 0x5C, 0x82, 0x36, 0xE8, 0x03 ),
+    BYTES_TO_T_UINT_8( 0x2E, 0x83, 0xA8, 0xE2, 0xA8, 0x43, 0x07, 0x38 ),
+    BYTES_TO_T_UINT_8( 0xE6, 0xAF, 0x2B, 0x79, 0xED, 0xD8, 0x39, 0x87 ),
+    BYTES_TO_T_UINT_8( 0x15, 0x20, 0x91, 0x7A, 0xC4, 0x07, 0xEF, 0x6C ),
+    BYTES_TO_T_UINT_2( 0x28, 0x01 ),
+    /* T[24].X, T[24].Y */
+    BYTES_TO_T_UINT_8( 0x6A, 0x10, 0x2F, 0xAA, 0x0C, 0x94, 0x0E, 0x5A ),
+    BYTES_TO_T_UINT_8( 0xB7, 0x81, 0x87, 0x41, 0x23, 0xEB, 0x55, 0x7C ),
+    BYTES_TO_T_UINT_8( 0xB8, 0x53, 0xCC, 0x79, 0xB6, 0xEB, 0x6C, 0xCC ),
+    BYTES_TO_T_UINT_8( 0xF4, 0x77, 0x73, 0x9D, 0xFC, 0x64, 0x6F, 0x7F ),
+    BYTES_TO_T_UINT_8( 0x3C, 0x40, 0xE3, 0x6D, 0x1C, 0x16, 0x71, 0x15 ),
+    BYTES_TO_T_UINT_8( 0x5A, 0xF4, 0x1B, 0xFF, 0x1C, 0x2F, 0xA5, 0xD7 ),
+    BYTES_TO_T_UINT_8( 0x06, 0x0E, 0x0B, 0x11, 0xF4, 0x8D, 0x93, 0xAF ),
+    BYTES_TO_T_UINT_8( 0x58, 0xC5, 0x64, 0x6F, 0x24, 0x19, 0xF2, 0x9B ),
+    BYTES_TO_T_UINT_2( 0x1C, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x52, 0xB3, 0xAF, 0xA5, 0x0E, 0x4F, 0x5E, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0x0F, 0x77, 0xCA, 0xF2, 0x6D, 0xC5, 0xF6, 0x9F ),
+    BYTES_TO_T_UINT_8( 0x90, 0x18, 0x8E, 0x33, 0x68, 0x6C, 0xE8, 0xE0 ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x8B, 0x80, 0x90, 0x19, 0x7F, 0x90, 0x96 ),
+    BYTES_TO_T_UINT_8( 0x5B, 0x80, 0x6B, 0x68, 0xE2, 0x7D, 0xD4, 0xD0 ),
+    BYTES_TO_T_UINT_8( 0x2A, 0xC1, 0x67, 0xB3, 0x72, 0xCB, 0xBF, 0x2F ),
+    BYTES_TO_T_UINT_8( 0x4F, 0xD5, 0xD3, 0x1D, 0x14, 0x58, 0x0A, 0x80 ),
+    BYTES_TO_T_UINT_8( 0x79, 0x7A, 0x65, 0x98, 0xB3, 0x07, 0x4B, 0x2F ),
+    BYTES_TO_T_UINT_2( 0xF3, 0x01 ),
+    /* T[25].X, T[25].Y */
+    BYTES_TO_T_UINT_8( 0x2A, 0x87, 0x0F, 0x5F, 0xCF, 0xA2, 0x01, 0x08 ),
+    BYTES_TO_T_UINT_8( 0x0C, 0xC9, 0xC8, 0x6E, 0x35, 0x87, 0xA5, 0x67 ),
+    BYTES_TO_T_UINT_8( 0x94, 0x3E, 0x91, 0xA0, 0xAB, 0x24, 0x1E, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0xB9, 0xBC, 0x02, 0x35, 0x70, 0xC1, 0x5F, 0x98 ),
+    BYTES_TO_T_UINT_8( 0x26, 0x59, 0xA0, 0x50, 0x04, 0x80, 0x52, 0x85 ),
+    BYTES_TO_T_UINT_8( 0xF8, 0x56, 0x6E, 0x42, 0x8F, 0x8C, 0x91, 0x65 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0xA2, 0xCB, 0xA5, 0xDE, 0x14, 0x24, 0x38 ),
+    BYTES_TO_T_UINT_8( 0x00, 0xCB, 0x74, 0x28, 0xE6, 0xA7, 0xE7, 0xC3 ),
+    BYTES_TO_T_UINT_2( 0x5F, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x35, 0x73, 0xA8, 0x8F, 0x9E, 0x0E, 0x63, 0x96 ),
+    BYTES_TO_T_UINT_8( 0xC8, 0x1B, 0x77, 0xC7, 0xC1, 0x38, 0xF9, 0xDC ),
+    BYTES_TO_T_UINT_8( 0xD8, 0x3C, 0xCF, 0xA8, 0x7A, 0xD7, 0xF3, 0xC4 ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x5F, 0x9A, 0xC9, 0xAD, 0xE9, 0x1A, 0x93 ),
+    BYTES_TO_T_UINT_8( 0xFC, 0xCF, 0x2B, 0x5E, 0xD5, 0x81, 0x95, 0xA8 ),
+    BYTES_TO_T_UINT_8( 0x19, 0x88, 0x75, 0x29, 0x1F, 0xC7, 0xC7, 0xD0 ),
+    BYTES_TO_T_UINT_8( 0xD8, 0xA9, 0x5A, 0x4D, 0x63, 0x95, 0xF9, 0x4E ),
+    BYTES_TO_T_UINT_8( 0xEB, 0xCD, 0x04, 0x8F, 0xCD, 0x91, 0xDE, 0xC6 ),
+    BYTES_TO_T_UINT_2( 0x71, 0x01 ),
+    /* T[26].X, T[26].Y */
+    BYTES_TO_T_UINT_8( 0x88, 0xD4, 0xFD, 0x25, 0x11, 0x99, 0x6E, 0xEA ),
+    BYTES_TO_T_UINT_8( 0xB0, 0x83, 0x01, 0x3D, 0xFB, 0x56, 0xA5, 0x4E ),
+    BYTES_TO_T_UINT_8( 0xC2, 0x3A, 0xDC, 0x74, 0xC2, 0xD7, 0xCF, 0xE8 ),
+    BYTES_TO_T_UINT_8( 0x8F, 0xBD, 0xF1, 0xDD, 0xA3, 0x07, 0x03, 0xE2 ),
+    BYTES_TO_T_UINT_8( 0x7B, 0xBE, 0xE9, 0x2E, 0x58, 0x84, 0x66, 0xFC ),
+    BYTES_TO_T_UINT_8( 0x71, 0x20, 0x78, 0x37, 0x79, 0x0B, 0xA6, 0x64 ),
+    BYTES_TO_T_UINT_8( 0xE3, 0xF2, 0xAC, 0x65, 0xC8, 0xC9, 0x2F, 0x61 ),
+    BYTES_TO_T_UINT_8( 0x26, 0x93, 0xE5, 0x0D, 0x0C, 0xC6, 0xB8, 0xCB ),
+    BYTES_TO_T_UINT_2( 0x9C, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x69, 0xAD, 0x5C, 0x19, 0x12, 0x61, 0x0E, 0x25 ),
+    BYTES_TO_T_UINT_8( 0x39, 0x4F, 0x0B, 0x1F, 0x49, 0x7E, 0xCD, 0x81 ),
+    BYTES_TO_T_UINT_8( 0x46, 0x2E, 0x30, 0x61, 0xDB, 0x08, 0x68, 0x9B ),
+    BYTES_TO_T_UINT_8( 0x41, 0x78, 0xAF, 0xB3, 0x08, 0xC1, 0x69, 0xE5 ),
+    BYTES_TO_T_UINT_8( 0xC4, 0x5F, 0x5D, 0xC1, 0x57, 0x6F, 0xD8, 0x34 ),
+    BYTES_TO_T_UINT_8( 0x38, 0xD3, 0x6A, 0xF7, 0xFD, 0x86, 0xE5, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0xA8, 0x63, 0xBD, 0x70, 0x7B, 0x47, 0xE8, 0x6D ),
+    BYTES_TO_T_UINT_8( 0x18, 0x62, 0xC8, 0x7E, 0x9D, 0x11, 0x2B, 0xA5 ),
+    BYTES_TO_T_UINT_2( 0xB6, 0x00 ),
+    /* T[27].X, T[27].Y */
+    BYTES_TO_T_UINT_8( 0xE2, 0x84, 0xFD, 0xD5, 0x9A, 0x56, 0x7F, 0x5C ),
+    BYTES_TO_T_UINT_8( 0x7C, 0xBB, 0xA4, 0x6F, 0x12, 0x6E, 0x4D, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0x1D, 0x08, 0xA1, 0x82, 0x9C, 0x62, 0x74, 0x7B ),
+    BYTES_TO_T_UINT_8( 0x9E, 0x58, 0x22, 0x05, 0x1D, 0x15, 0x35, 0x79 ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x88, 0xCF, 0x5C, 0x05, 0x78, 0xFB, 0x94 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0x6B, 0x2F, 0x79, 0x09, 0x73, 0x67, 0xEC ),
+    BYTES_TO_T_UINT_8( 0xD8, 0xA0, 0x80, 0xD8, 0xE8, 0xEC, 0xFB, 0x42 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0xE7, 0x0B, 0xB7, 0x81, 0x48, 0x7B, 0xD9 ),
+    BYTES_TO_T_UINT_2( 0xE3, 0x00 ),
+    BYTES_TO_T_UINT_8( 0xE8, 0x53, 0xA9, 0xED, 0x61, 0x92, 0xD7, 0x85 ),
+    BYTES_TO_T_UINT_8( 0x26, 0x49, 0xD9, 0x5D, 0x9B, 0x4E, 0x89, 0x35 ),
+    BYTES_TO_T_UINT_8( 0xB8, 0x12, 0xEB, 0x9A, 0xC9, 0xCB, 0xC1, 0x95 ),
+    BYTES_TO_T_UINT_8( 0x35, 0xDC, 0x95, 0x16, 0xFE, 0x29, 0x70, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x64, 0x33, 0xB1, 0xD6, 0x78, 0xB9, 0xE2, 0x36 ),
+    BYTES_TO_T_UINT_8( 0x34, 0xCE, 0x88, 0xC3, 0xFD, 0x7A, 0x6B, 0xB8 ),
+    BYTES_TO_T_UINT_8( 0x40, 0x1E, 0x50, 0x1E, 0xAF, 0xB1, 0x25, 0x2D ),
+    BYTES_TO_T_UINT_8( 0xC1, 0xE7, 0xD7, 0xD5, 0xBD, 0x7A, 0x12, 0xF9 ),
+    BYTES_TO_T_UINT_2( 0x31, 0x00 ),
+    /* T[28].X, T[28].Y */
+    BYTES_TO_T_UINT_8( 0x22, 0xAA, 0xA2, 0x80, 0x5D, 0x8F, 0xCD, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0x48, 0x39, 0x79, 0x64, 0xA1, 0x67, 0x3C, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x3D, 0xC7, 0x49, 0xFF, 0x7F, 0xAC, 0xAB, 0x55 ),
+    BYTES_TO_T_UINT_8( 0x81, 0x54, 0x3E, 0x83, 0xF0, 0x3D, 0xBC, 0xB5 ),
+    BYTES_TO_T_UINT_8( 0x87, 0x92, 0x4A, 0x38, 0x42, 0x8A, 0xAB, 0xF6 ),
+    BYTES_TO_T_UINT_8( 0xE7, 0x0B, 0x4F, 0xEE, 0x9E, 0x92, 0xA5, 0xBE ),
+    BYTES_TO_T_UINT_8( 0xBA, 0xDD, 0x19, 0x96, 0xF2, 0xF0, 0x6B, 0x2E ),
+    BYTES_TO_T_UINT_8( 0xBE, 0xFC, 0xDD, 0xB2, 0x8A, 0xE5, 0x4C, 0x22 ),
+    BYTES_TO_T_UINT_2( 0xD4, 0x01 ),
+    BYTES_TO_T_UINT_8( 0xB7, 0x06, 0x49, 0xAC, 0x99, 0x7E, 0xF8, 0x12 ),
+    BYTES_TO_T_UINT_8( 0x76, 0xC8, 0x01, 0x51, 0xEA, 0xF6, 0x52, 0xE7 ),
+    BYTES_TO_T_UINT_8( 0x43, 0x89, 0x66, 0x2B, 0x1F, 0x9B, 0x2A, 0xA3 ),
+    BYTES_TO_T_UINT_8( 0xDF, 0x0F, 0x95, 0x07, 0x2B, 0x6C, 0x6E, 0x9E ),
+    BYTES_TO_T_UINT_8( 0x24, 0xC3, 0xB4, 0xBB, 0x91, 0x1F, 0xA3, 0x72 ),
+    BYTES_TO_T_UINT_8( 0x5F, 0x6E, 0x54, 0x28, 0x7B, 0x9C, 0x79, 0x2E ),
+    BYTES_TO_T_UINT_8( 0x03, 0x45, 0xFF, 0xA6, 0xDA, 0xA2, 0x83, 0x71 ),
+    BYTES_TO_T_UINT_8( 0xEB, 0xDE, 0x8F, 0x17, 0x37, 0x82, 0xCB, 0xE2 ),
+    BYTES_TO_T_UINT_2( 0x30, 0x00 ),
+    /* T[29].X, T[29].Y */
+    BYTES_TO_T_UINT_8( 0xD8, 0x94, 0x3F, 0x26, 0xC9, 0x1D, 0xD9, 0xAE ),
+    BYTES_TO_T_UINT_8( 0x09, 0x97, 0x28, 0x20, 0xCD, 0xC1, 0xF3, 0x40 ),
+    BYTES_TO_T_UINT_8( 0x95, 0xC9, 0xB5, 0x60, 0x9B, 0x1E, 0xDC, 0x74 ),
+    BYTES_TO_T_UINT_8( 0x5B, 0xB9, 0x5B, 0x7D, 0xA0, 0xB2, 0x8C, 0xF0 ),
+    BYTES_TO_T_UINT_8( 0x33, 0xD1, 0x42, 0xE6, 0x39, 0x33, 0x6D, 0xBB ),
+    BYTES_TO_T_UINT_8( 0x5D, 0xC0, 0xFC, 0xD2, 0x14, 0x5D, 0x3E, 0x3C ),
+    BYTES_TO_T_UINT_8( 0x78, 0x4A, 0x3E, 0x40, 0x16, 0x93, 0x15, 0xCF ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x24, 0xC1, 0x27, 0x27, 0xE5, 0x4B, 0xD8 ),
+    BYTES_TO_T_UINT_2( 0xD4, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x1D, 0x50, 0xD8, 0xBC, 0xC1, 0x46, 0x22, 0xBB ),
+    BYTES_TO_T_UINT_8( 0xAD, 0x0E, 0x60, 0xA1, 0xB3, 0x50, 0xD4, 0x86 ),
+    BYTES_TO_T_UINT_8( 0x80, 0xB1, 0x26, 0xB6, 0x6D, 0x47, 0x5A, 0x6F ),
+    BYTES_TO_T_UINT_8( 0x45, 0xAC, 0x11, 0x35, 0x3E, 0xB9, 0xF4, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x58, 0x97, 0xFA, 0xBB, 0x6B, 0x39, 0x13, 0xD8 ),
+    BYTES_TO_T_UINT_8( 0x15, 0x7B, 0x34, 0x12, 0x75, 0x8E, 0x9B, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0x2C, 0x9E, 0xCD, 0x29, 0xB6, 0xEF, 0x8D, 0x10 ),
+    BYTES_TO_T_UINT_8( 0x47, 0xAC, 0xE9, 0x25, 0x27, 0xBB, 0x78, 0x47 ),
+    BYTES_TO_T_UINT_2( 0x2F, 0x01 ),
+    /* T[30].X, T[30].Y */
+    BYTES_TO_T_UINT_8( 0x30, 0x7A, 0xA8, 0xD3, 0xE3, 0x66, 0xE5, 0x66 ),
+    BYTES_TO_T_UINT_8( 0x2F, 0x4C, 0xC4, 0x2C, 0x76, 0x81, 0x50, 0x32 ),
+    BYTES_TO_T_UINT_8( 0xEE, 0x71, 0x08, 0xB8, 0x52, 0x7C, 0xAF, 0xDC ),
+    BYTES_TO_T_UINT_8( 0x45, 0x59, 0x24, 0xDD, 0xFB, 0x2F, 0xD0, 0xDA ),
+    BYTES_TO_T_UINT_8( 0xB7, 0xCD, 0x56, 0xE9, 0xAC, 0x91, 0xE6, 0xB9 ),
+    BYTES_TO_T_UINT_8( 0xE5, 0x64, 0x20, 0xC6, 0x9F, 0xE4, 0xEF, 0xDF ),
+    BYTES_TO_T_UINT_8( 0x6D, 0x2C, 0x8F, 0x8C, 0x97, 0xF6, 0x22, 0xC3 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0xF4, 0x88, 0xAA, 0xA8, 0xD7, 0xA5, 0x68 ),
+    BYTES_TO_T_UINT_2( 0xDE, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x21, 0x6C, 0xAE, 0x83, 0xB1, 0x55, 0x55, 0xEE ),
+    BYTES_TO_T_UINT_8( 0xB0, 0x67, 0x84, 0x47, 0x7C, 0x83, 0x5C, 0x89 ),
+    BYTES_TO_T_UINT_8( 0x5B, 0x10, 0x4D, 0xDD, 0x30, 0x60, 0xB0, 0xE6 ),
+    BYTES_TO_T_UINT_8( 0x59, 0xA7, 0x36, 0x76, 0x24, 0x32, 0x9F, 0x9D ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x42, 0x81, 0xFB, 0xA4, 0x2E, 0x13, 0x68 ),
+    BYTES_TO_T_UINT_8( 0x87, 0x94, 0x91, 0xFF, 0x99, 0xA0, 0x09, 0x61 ),
+    BYTES_TO_T_UINT_8( 0x5D, 0x83, 0xA1, 0x76, 0xAF, 0x37, 0x5C, 0x77 ),
+    BYTES_TO_T_UINT_8( 0x1E, 0xA8, 0x04, 0x86, 0xC4, 0xA9, 0x79, 0x42 ),
+    BYTES_TO_T_UINT_2( 0x93, 0x00 ),
+    /* T[31].X, T[31].Y */
+    BYTES_TO_T_UINT_8( 0xB6, 0x8C, 0xC2, 0x34, 0xFB, 0x83, 0x28, 0x27 ),
+    BYTES_TO_T_UINT_8( 0xA4, 0x03, 0x7D, 0x5E, 0x9E, 0x0E, 0xB0, 0x22 ),
+    BYTES_TO_T_UINT_8( 0xA2, 0x02, 0x46, 0x7F, 0xB9, 0xAC, 0xBB, 0x23 ),
+    BYTES_TO_T_UINT_8( 0x06, 0xED, 0x48, 0xC2, 0x96, 0x4D, 0x56, 0x27 ),
+    BYTES_TO_T_UINT_8( 0x44, 0xB5, 0xC5, 0xD1, 0xE6, 0x1C, 0x7E, 0x9B ),
+    BYTES_TO_T_UINT_8( 0x92, 0x2E, 0x18, 0x71, 0x2D, 0x7B, 0xD7, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0xAB, 0x46, 0x9D, 0xDE, 0xAA, 0x78, 0x8E, 0xB1 ),
+    BYTES_TO_T_UINT_8( 0x4D, 0xD7, 0x69, 0x2E, 0xE1, 0xD9, 0x48, 0xDE ),
+    BYTES_TO_T_UINT_2( 0xFB, 0x01 ),
+    BYTES_TO_T_UINT_8( 0xAF, 0xFF, 0x9E, 0x09, 0x22, 0x22, 0xE6, 0x8D ),
+    BYTES_TO_T_UINT_8( 0x6C, 0x14, 0x28, 0x13, 0x1B, 0x62, 0x12, 0x22 ),
+    BYTES_TO_T_UINT_8( 0xCC, 0x7F, 0x67, 0x03, 0xB0, 0xC0, 0xF3, 0x05 ),
+    BYTES_TO_T_UINT_8( 0xC0, 0xC3, 0x0F, 0xFB, 0x25, 0x48, 0x3E, 0xF4 ),
+    BYTES_TO_T_UINT_8( 0x0B, 0x6E, 0x53, 0x98, 0x36, 0xB3, 0xD3, 0x94 ),
+    BYTES_TO_T_UINT_8( 0xEB, 0x81, 0x54, 0x22, 0xA4, 0xCC, 0xC1, 0x22 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0xBA, 0xFC, 0xA9, 0xDF, 0x68, 0x86, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x71, 0x92, 0x0E, 0xC3, 0xF2, 0x58, 0xE8, 0x51 ),
+    BYTES_TO_T_UINT_2( 0xE9, 0x01 ),
+};
+static const mbedtls_ecp_point secp521r1_T[32] = {
+    ECP_COMB_POINT( secp521r1, 0 ),
+    ECP_COMB_POINT( secp521r1, 1 ),
+    ECP_COMB_POINT( secp521r1, 2 ),
+    ECP_COMB_POINT( secp521r1, 3 ),
+    ECP_COMB_POINT( secp521r1, 4 ),
+    ECP_COMB_POINT( secp521r1, 5 ),
+    ECP_COMB_POINT( secp521r1, 6 ),
+    ECP_COMB_POINT( secp521r1, 7 ),
+    ECP_COMB_POINT( secp521r1, 8 ),
+    ECP_COMB_POINT( secp521r1, 9 ),
+    ECP_COMB_POINT( secp521r1, 10 ),
+    ECP_COMB_POINT( secp521r1, 11 ),
+    ECP_COMB_POINT( secp521r1, 12 ),
+    ECP_COMB_POINT( secp521r1, 13 ),
+    ECP_COMB_POINT( secp521r1, 14 ),
+    ECP_COMB_POINT( secp521r1, 15 ),
+    ECP_COMB_POINT( secp521r1, 16 ),
+    ECP_COMB_POINT( secp521r1, 17 ),
+    ECP_COMB_POINT( secp521r1, 18 ),
+    ECP_COMB_POINT( secp521r1, 19 ),
+    ECP_COMB_POINT( secp521r1, 20 ),
+    ECP_COMB_POINT( secp521r1, 21 ),
+    ECP_COMB_POINT( secp521r1, 22 ),
+    ECP_COMB_POINT( secp521r1, 23 ),
+    ECP_COMB_POINT( secp521r1, 24 ),
+    ECP_COMB_POINT( secp521r1, 25 ),
+    ECP_COMB_POINT( secp521r1, 26 ),
+    ECP_COMB_POINT( secp521r1, 27 ),
+    ECP_COMB_POINT( secp521r1, 28 ),
+    ECP_COMB_POINT( secp521r1, 29 ),
+    ECP_COMB_POINT( secp521r1, 30 ),
+    ECP_COMB_POINT( secp521r1, 31 ),
+};
+#endif /* ECP_NIST_TABLES */
 #endif /* MBEDTLS_ECP_DP_SECP521R1_ENABLED */
 
 #if defined(MBEDTLS_ECP_DP_SECP192K1_ENABLED)
@@ -319,6 +1935,140 @@ static const mbedtls_mpi_uint secp192k1_n[] = {
     BYTES_TO_T_UINT_8( 0x17, 0xFC, 0xF2, 0x26, 0xFE, 0xFF, 0xFF, 0xFF ),
     BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
 };
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint secp192k1_T_xy[] = {
+    /* T[0].X, T[0].Y */
+    BYTES_TO_T_UINT_8( 0x7D, 0x6C, 0xE0, 0xEA, 0xB1, 0xD1, 0xA5, 0x1D ),
+    BYTES_TO_T_UINT_8( 0x34, 0xF4, 0xB7, 0x80, 0x02, 0x7D, 0xB0, 0x26 ),
+    BYTES_TO_T_UINT_8( 0xAE, 0xE9, 0x57, 0xC0, 0x0E, 0xF1, 0x4F, 0xDB ),
+    BYTES_TO_T_UINT_8( 0x9D, 0x2F, 0x5E, 0xD9, 0x88, 0xAA, 0x82, 0x40 ),
+    BYTES_TO_T_UINT_8( 0x34, 0x86, 0xBE, 0x15, 0xD0, 0x63, 0x41, 0x84 ),
+    BYTES_TO_T_UINT_8( 0xA7, 0x28, 0x56, 0x9C, 0x6D, 0x2F, 0x2F, 0x9B ),
+    /* T[1].X, T[1].Y */
+    BYTES_TO_T_UINT_8( 0x6F, 0x77, 0x3D, 0x0D, 0x85, 0x48, 0xA8, 0xA9 ),
+    BYTES_TO_T_UINT_8( 0x62, 0x07, 0xDF, 0x1D, 0xB3, 0xB3, 0x01, 0x54 ),
+    BYTES_TO_T_UINT_8( 0x05, 0x86, 0xF6, 0xAF, 0x19, 0x2A, 0x88, 0x2E ),
+    BYTES_TO_T_UINT_8( 0x33, 0x90, 0xB6, 0x2F, 0x48, 0x36, 0x4C, 0x5B ),
+    BYTES_TO_T_UINT_8( 0xDB, 0x11, 0x14, 0xA6, 0xCB, 0xBA, 0x15, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0x7E, 0xB0, 0xF2, 0xD4, 0xC9, 0xDA, 0xBA, 0xD7 ),
+    /* T[2].X, T[2].Y */
+    BYTES_TO_T_UINT_8( 0xE4, 0xC1, 0x9C, 0xE6, 0xBB, 0xFB, 0xCF, 0x23 ),
+    BYTES_TO_T_UINT_8( 0x93, 0x19, 0xAC, 0x5A, 0xC9, 0x8A, 0x1C, 0x75 ),
+    BYTES_TO_T_UINT_8( 0xC1, 0xF6, 0x76, 0x86, 0x89, 0x27, 0x8D, 0x28 ),
+    BYTES_TO_T_UINT_8( 0x4B, 0xE0, 0x6F, 0x34, 0xBA, 0x5E, 0xD3, 0x96 ),
+    BYTES_TO_T_UINT_8( 0x6A, 0xDC, 0xA6, 0x87, 0xC9, 0x9D, 0xC0, 0x82 ),
+    BYTES_TO_T_UINT_8( 0x09, 0x11, 0x7E, 0xD6, 0xF7, 0x33, 0xFC, 0xE4 ),
+    /* T[3].X, T[3].Y */
+    BYTES_TO_T_UINT_8( 0xC2, 0x37, 0x3E, 0xC0, 0x7F, 0x62, 0xE7, 0x54 ),
+    BYTES_TO_T_UINT_8( 0xA5, 0x3B, 0x69, 0x9D, 0x44, 0xBC, 0x82, 0x99 ),
+    BYTES_TO_T_UINT_8( 0xD4, 0x84, 0xB3, 0x5F, 0x2B, 0xA5, 0x9E, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x1D, 0x95, 0xEB, 0x4C, 0x04, 0xB4, 0xF4, 0x75 ),
+    BYTES_TO_T_UINT_8( 0x55, 0xAD, 0x4B, 0xD5, 0x9A, 0xEB, 0xC4, 0x4E ),
+    BYTES_TO_T_UINT_8( 0xC9, 0xB1, 0xC5, 0x59, 0xE3, 0xD5, 0x16, 0x2A ),
+    /* T[4].X, T[4].Y */
+    BYTES_TO_T_UINT_8( 0x48, 0x2A, 0xCC, 0xAC, 0xD0, 0xEE, 0x50, 0xEC ),
+    BYTES_TO_T_UINT_8( 0x99, 0x83, 0xE0, 0x5B, 0x14, 0x44, 0x52, 0x20 ),
+    BYTES_TO_T_UINT_8( 0xD6, 0x15, 0x2D, 0x78, 0xF6, 0x51, 0x32, 0xCF ),
+    BYTES_TO_T_UINT_8( 0x86, 0x36, 0x9B, 0xDD, 0xF8, 0xDD, 0xEF, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x0B, 0xB1, 0x6A, 0x2B, 0xAF, 0xEB, 0x2B, 0xB1 ),
+    BYTES_TO_T_UINT_8( 0xC9, 0x87, 0x7A, 0x66, 0x5D, 0x5B, 0xDF, 0x8F ),
+    /* T[5].X, T[5].Y */
+    BYTES_TO_T_UINT_8( 0x62, 0x45, 0xE5, 0x81, 0x9B, 0xEB, 0x37, 0x23 ),
+    BYTES_TO_T_UINT_8( 0xB3, 0x29, 0xE2, 0x20, 0x64, 0x23, 0x6B, 0x6E ),
+    BYTES_TO_T_UINT_8( 0xFE, 0x1D, 0x41, 0xE1, 0x9B, 0x61, 0x7B, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0x75, 0x57, 0xA3, 0x0A, 0x13, 0xE4, 0x59, 0x15 ),
+    BYTES_TO_T_UINT_8( 0x79, 0x6E, 0x4A, 0x48, 0x84, 0x90, 0xAC, 0xC7 ),
+    BYTES_TO_T_UINT_8( 0x9C, 0xB8, 0xF5, 0xF3, 0xDE, 0xA0, 0xA1, 0x1D ),
+    /* T[6].X, T[6].Y */
+    BYTES_TO_T_UINT_8( 0xA3, 0x32, 0x81, 0xA9, 0x91, 0x5A, 0x4E, 0x33 ),
+    BYTES_TO_T_UINT_8( 0xCB, 0xA8, 0x90, 0xBE, 0x0F, 0xEC, 0xC0, 0x85 ),
+    BYTES_TO_T_UINT_8( 0x80, 0x30, 0xD7, 0x08, 0xAE, 0xC4, 0x3A, 0xA5 ),
+    BYTES_TO_T_UINT_8( 0xBC, 0x55, 0xE3, 0x76, 0xB3, 0x64, 0x74, 0x9F ),
+    BYTES_TO_T_UINT_8( 0x3F, 0x75, 0xD4, 0xDB, 0x98, 0xD7, 0x39, 0xAE ),
+    BYTES_TO_T_UINT_8( 0xD4, 0xEB, 0x8A, 0xAB, 0x16, 0xD9, 0xD4, 0x0B ),
+    /* T[7].X, T[7].Y */
+    BYTES_TO_T_UINT_8( 0x41, 0xBE, 0xF9, 0xC7, 0xC7, 0xBA, 0xF3, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0xC2, 0x85, 0x59, 0xF3, 0x60, 0x41, 0x02, 0xD2 ),
+    BYTES_TO_T_UINT_8( 0x46, 0x1C, 0x4A, 0xA4, 0xC7, 0xED, 0x66, 0xBC ),
+    BYTES_TO_T_UINT_8( 0xC3, 0x9C, 0x2E, 0x46, 0x52, 0x18, 0x87, 0x14 ),
+    BYTES_TO_T_UINT_8( 0xFF, 0x35, 0x5A, 0x75, 0xAC, 0x4D, 0x75, 0x91 ),
+    BYTES_TO_T_UINT_8( 0xCE, 0x2F, 0xAC, 0xFC, 0xBC, 0xE6, 0x93, 0x5E ),
+    /* T[8].X, T[8].Y */
+    BYTES_TO_T_UINT_8( 0x87, 0x4D, 0xC9, 0x18, 0xE9, 0x00, 0xEB, 0x33 ),
+    BYTES_TO_T_UINT_8( 0x1A, 0x69, 0x72, 0x07, 0x5A, 0x59, 0xA8, 0x26 ),
+    BYTES_TO_T_UINT_8( 0xB6, 0x65, 0x83, 0x20, 0x10, 0xF9, 0x69, 0x82 ),
+    BYTES_TO_T_UINT_8( 0x8B, 0x56, 0x7F, 0x9F, 0xBF, 0x46, 0x0C, 0x7E ),
+    BYTES_TO_T_UINT_8( 0xFC, 0xCF, 0xF0, 0xDC, 0xDF, 0x2D, 0xE6, 0xE5 ),
+    BYTES_TO_T_UINT_8( 0x09, 0xF0, 0x72, 0x3A, 0x7A, 0x03, 0xE5, 0x22 ),
+    /* T[9].X, T[9].Y */
+    BYTES_TO_T_UINT_8( 0x3E, 0xAA, 0x57, 0x13, 0x37, 0xA7, 0x2C, 0xD4 ),
+    BYTES_TO_T_UINT_8( 0xA3, 0xAC, 0xA2, 0x23, 0xF9, 0x84, 0x60, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0x32, 0xEB, 0x51, 0x70, 0x64, 0x78, 0xCA, 0x05 ),
+    BYTES_TO_T_UINT_8( 0x91, 0xCC, 0x30, 0x62, 0x93, 0x46, 0x13, 0xE9 ),
+    BYTES_TO_T_UINT_8( 0x21, 0x26, 0xCC, 0x6C, 0x3D, 0x5C, 0xDA, 0x2C ),
+    BYTES_TO_T_UINT_8( 0xD5, 0xAA, 0xB8, 0x03, 0xA4, 0x1A, 0x00, 0x96 ),
+    /* T[10].X, T[10].Y */
+    BYTES_TO_T_UINT_8( 0xF9, 0x9D, 0xE6, 0xCC, 0x4E, 0x2E, 0xC2, 0xD5 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0xC3, 0x8A, 0xAE, 0x6F, 0x40, 0x05, 0xEB ),
+    BYTES_TO_T_UINT_8( 0x9D, 0x8F, 0x4A, 0x4D, 0x35, 0xD3, 0x50, 0x9D ),
+    BYTES_TO_T_UINT_8( 0x1F, 0xFD, 0x98, 0xAB, 0xC7, 0x03, 0xB4, 0x55 ),
+    BYTES_TO_T_UINT_8( 0x40, 0x40, 0xD2, 0x9F, 0xCA, 0xD0, 0x53, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x1A, 0x84, 0x00, 0x6F, 0xC8, 0xAD, 0xED, 0x8D ),
+    /* T[11].X, T[11].Y */
+    BYTES_TO_T_UINT_8( 0xCE, 0xD3, 0x57, 0xD7, 0xC3, 0x07, 0xBD, 0xD7 ),
+    BYTES_TO_T_UINT_8( 0x67, 0xBA, 0x47, 0x1D, 0x3D, 0xEF, 0x98, 0x6C ),
+    BYTES_TO_T_UINT_8( 0x6D, 0xC0, 0x6C, 0x7F, 0x12, 0xEE, 0x9F, 0x67 ),
+    BYTES_TO_T_UINT_8( 0xCA, 0x02, 0xDA, 0x79, 0xAA, 0xC9, 0x27, 0xC4 ),
+    BYTES_TO_T_UINT_8( 0x21, 0x79, 0xC7, 0x71, 0x84, 0xCB, 0xE5, 0x5A ),
+    BYTES_TO_T_UINT_8( 0x15, 0x37, 0x06, 0xBA, 0xB5, 0xD5, 0x18, 0x4C ),
+    /* T[12].X, T[12].Y */
+    BYTES_TO_T_UINT_8( 0xA1, 0x65, 0x72, 0x6C, 0xF2, 0x63, 0x27, 0x6A ),
+    BYTES_TO_T_UINT_8( 0x69, 0xBC, 0x71, 0xDF, 0x75, 0xF8, 0x98, 0x4D ),
+    BYTES_TO_T_UINT_8( 0x70, 0x70, 0x9B, 0xDC, 0xE7, 0x18, 0x71, 0xFF ),
+    BYTES_TO_T_UINT_8( 0x15, 0x5B, 0x9F, 0x00, 0x5A, 0xB6, 0x80, 0x7A ),
+    BYTES_TO_T_UINT_8( 0xB7, 0xE0, 0xBB, 0xFC, 0x5E, 0x78, 0x9C, 0x89 ),
+    BYTES_TO_T_UINT_8( 0x60, 0x03, 0x68, 0x83, 0x3D, 0x2E, 0x4C, 0xDD ),
+    /* T[13].X, T[13].Y */
+    BYTES_TO_T_UINT_8( 0x3B, 0x49, 0x23, 0xA8, 0xCB, 0x3B, 0x1A, 0xF6 ),
+    BYTES_TO_T_UINT_8( 0x8B, 0x3D, 0xA7, 0x46, 0xCF, 0x75, 0xB6, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x92, 0xFD, 0x30, 0x01, 0xB6, 0xEF, 0xF9, 0xE8 ),
+    BYTES_TO_T_UINT_8( 0xDC, 0xFA, 0xDA, 0xB8, 0x29, 0x42, 0xC9, 0xC7 ),
+    BYTES_TO_T_UINT_8( 0x06, 0xD7, 0xA0, 0xE6, 0x6B, 0x86, 0x61, 0x39 ),
+    BYTES_TO_T_UINT_8( 0xDB, 0xE9, 0xD3, 0x37, 0xD8, 0xE7, 0x35, 0xA9 ),
+    /* T[14].X, T[14].Y */
+    BYTES_TO_T_UINT_8( 0xFD, 0xC8, 0x8E, 0xB1, 0xCB, 0xB1, 0xB5, 0x4D ),
+    BYTES_TO_T_UINT_8( 0x16, 0xD7, 0x46, 0x7D, 0xAF, 0xE2, 0xDC, 0xBB ),
+    BYTES_TO_T_UINT_8( 0xD0, 0x46, 0xE7, 0xD8, 0x76, 0x31, 0x90, 0x76 ),
+    BYTES_TO_T_UINT_8( 0xEB, 0xD3, 0xF4, 0x74, 0xE1, 0x67, 0xD8, 0x66 ),
+    BYTES_TO_T_UINT_8( 0xE7, 0x70, 0x3C, 0xC8, 0xAF, 0x5F, 0xF4, 0x58 ),
+    BYTES_TO_T_UINT_8( 0x24, 0x4E, 0xED, 0x5C, 0x43, 0xB3, 0x16, 0x35 ),
+    /* T[15].X, T[15].Y */
+    BYTES_TO_T_UINT_8( 0x57, 0xAE, 0xD1, 0xDD, 0x31, 0x14, 0xD3, 0xF0 ),
+    BYTES_TO_T_UINT_8( 0xE8, 0x14, 0x06, 0x13, 0x12, 0x1C, 0x81, 0xF5 ),
+    BYTES_TO_T_UINT_8( 0xA6, 0xF9, 0x0C, 0x91, 0xF7, 0x67, 0x59, 0x63 ),
+    BYTES_TO_T_UINT_8( 0xAB, 0x91, 0xE2, 0xF4, 0x9D, 0xEB, 0x88, 0x87 ),
+    BYTES_TO_T_UINT_8( 0xDB, 0x82, 0x30, 0x9C, 0xAE, 0x18, 0x4D, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x3C, 0x79, 0xCF, 0x17, 0xA5, 0x1E, 0xE8, 0xC8 ),
+};
+static const mbedtls_ecp_point secp192k1_T[16] = {
+    ECP_COMB_POINT( secp192k1, 0 ),
+    ECP_COMB_POINT( secp192k1, 1 ),
+    ECP_COMB_POINT( secp192k1, 2 ),
+    ECP_COMB_POINT( secp192k1, 3 ),
+    ECP_COMB_POINT( secp192k1, 4 ),
+    ECP_COMB_POINT( secp192k1, 5 ),
+    ECP_COMB_POINT( secp192k1, 6 ),
+    ECP_COMB_POINT( secp192k1, 7 ),
+    ECP_COMB_POINT( secp192k1, 8 ),
+    ECP_COMB_POINT( secp192k1, 9 ),
+    ECP_COMB_POINT( secp192k1, 10 ),
+    ECP_COMB_POINT( secp192k1, 11 ),
+    ECP_COMB_POINT( secp192k1, 12 ),
+    ECP_COMB_POINT( secp192k1, 13 ),
+    ECP_COMB_POINT( secp192k1, 14 ),
+    ECP_COMB_POINT( secp192k1, 15 ),
+};
+#endif /* MBEDTLS_ECP_FIXED_POINT_OPTIM */
 #endif /* MBEDTLS_ECP_DP_SECP192K1_ENABLED */
 
 #if defined(MBEDTLS_ECP_DP_SECP224K1_ENABLED)
@@ -352,6 +2102,172 @@ static const mbedtls_mpi_uint secp224k1_n[] = {
     BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 ),
     BYTES_TO_T_UINT_8( 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 ),
 };
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint secp224k1_T_xy[] = {
+    /* T[0].X, T[0].Y */
+    BYTES_TO_T_UINT_8( 0x5C, 0xA4, 0xB7, 0xB6, 0x0E, 0x65, 0x7E, 0x0F ),
+    BYTES_TO_T_UINT_8( 0xA9, 0x75, 0x70, 0xE4, 0xE9, 0x67, 0xA4, 0x69 ),
+    BYTES_TO_T_UINT_8( 0xA1, 0x28, 0xFC, 0x30, 0xDF, 0x99, 0xF0, 0x4D ),
+    BYTES_TO_T_UINT_4( 0x33, 0x5B, 0x45, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0xA5, 0x61, 0x6D, 0x55, 0xDB, 0x4B, 0xCA, 0xE2 ),
+    BYTES_TO_T_UINT_8( 0x59, 0xBD, 0xB0, 0xC0, 0xF7, 0x19, 0xE3, 0xF7 ),
+    BYTES_TO_T_UINT_8( 0xD6, 0xFB, 0xCA, 0x82, 0x42, 0x34, 0xBA, 0x7F ),
+    BYTES_TO_T_UINT_4( 0xED, 0x9F, 0x08, 0x7E ),
+    /* T[1].X, T[1].Y */
+    BYTES_TO_T_UINT_8( 0x99, 0x6C, 0x22, 0x22, 0x40, 0x89, 0xAE, 0x7A ),
+    BYTES_TO_T_UINT_8( 0x2F, 0x92, 0xE1, 0x87, 0x56, 0x35, 0xAF, 0x9B ),
+    BYTES_TO_T_UINT_8( 0x88, 0xAF, 0x08, 0x35, 0x27, 0xEA, 0x04, 0xED ),
+    BYTES_TO_T_UINT_4( 0xF0, 0x53, 0xFD, 0xCF ),
+    BYTES_TO_T_UINT_8( 0xC1, 0xD0, 0x9F, 0x8D, 0xF3, 0x63, 0x54, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x39, 0xDB, 0x0F, 0x61, 0x54, 0x26, 0xD1, 0x98 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0x21, 0xF7, 0x1B, 0xB5, 0x1D, 0xF6, 0x7E ),
+    BYTES_TO_T_UINT_4( 0xFF, 0x05, 0xDA, 0x8F ),
+    /* T[2].X, T[2].Y */
+    BYTES_TO_T_UINT_8( 0x10, 0x26, 0x73, 0xBC, 0xE4, 0x29, 0x62, 0x56 ),
+    BYTES_TO_T_UINT_8( 0x37, 0x95, 0x17, 0x8B, 0xC3, 0x9B, 0xAC, 0xCC ),
+    BYTES_TO_T_UINT_8( 0xB1, 0xDB, 0x77, 0xDF, 0xDD, 0x13, 0x04, 0x98 ),
+    BYTES_TO_T_UINT_4( 0x02, 0xFC, 0x22, 0x93 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0x65, 0xF1, 0x5A, 0x37, 0xEF, 0x79, 0xAD ),
+    BYTES_TO_T_UINT_8( 0x99, 0x01, 0x37, 0xAC, 0x9A, 0x5B, 0x51, 0x65 ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x75, 0x13, 0xA9, 0x4A, 0xAD, 0xFE, 0x9B ),
+    BYTES_TO_T_UINT_4( 0x32, 0x82, 0x6F, 0x66 ),
+    /* T[3].X, T[3].Y */
+    BYTES_TO_T_UINT_8( 0x4D, 0x5E, 0xF0, 0x40, 0xC3, 0xA6, 0xE2, 0x1E ),
+    BYTES_TO_T_UINT_8( 0x34, 0x9A, 0x6F, 0xCF, 0x11, 0x26, 0x66, 0x85 ),
+    BYTES_TO_T_UINT_8( 0x79, 0x73, 0xA8, 0xCF, 0x2B, 0x12, 0x36, 0x37 ),
+    BYTES_TO_T_UINT_4( 0xB9, 0xB3, 0x0A, 0x58 ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x79, 0x00, 0x55, 0x04, 0x34, 0x90, 0x1A ),
+    BYTES_TO_T_UINT_8( 0x0A, 0x54, 0x1C, 0xC2, 0x45, 0x0C, 0x1B, 0x23 ),
+    BYTES_TO_T_UINT_8( 0x86, 0x19, 0xAB, 0xA8, 0xFC, 0x73, 0xDC, 0xEE ),
+    BYTES_TO_T_UINT_4( 0x72, 0xFB, 0x93, 0xCE ),
+    /* T[4].X, T[4].Y */
+    BYTES_TO_T_UINT_8( 0xF8, 0x75, 0xD0, 0x66, 0x95, 0x86, 0xCA, 0x66 ),
+    BYTES_TO_T_UINT_8( 0x17, 0xEA, 0x29, 0x16, 0x6A, 0x38, 0xDF, 0x41 ),
+    BYTES_TO_T_UINT_8( 0xD8, 0xA2, 0x36, 0x2F, 0xDC, 0xBB, 0x5E, 0xF7 ),
+    BYTES_TO_T_UINT_4( 0xD4, 0x89, 0x59, 0x49 ),
+    BYTES_TO_T_UINT_8( 0xCA, 0xA3, 0x99, 0x9D, 0xB8, 0x77, 0x9D, 0x1D ),
+    BYTES_TO_T_UINT_8( 0x0A, 0x93, 0x43, 0x47, 0xC6, 0x5C, 0xF9, 0xFD ),
+    BYTES_TO_T_UINT_8( 0xAA, 0x00, 0x79, 0x42, 0x64, 0xB8, 0x25, 0x3E ),
+    BYTES_TO_T_UINT_4( 0x29, 0x54, 0xB4, 0x33 ),
+    /* T[5].X, T[5].Y */
+    BYTES_TO_T_UINT_8( 0xD9, 0x0C, 0x42, 0x90, 0x83, 0x0B, 0x31, 0x5F ),
+    BYTES_TO_T_UINT_8( 0x54, 0x2E, 0xAE, 0xC8, 0xC7, 0x5F, 0xD2, 0x70 ),
+    BYTES_TO_T_UINT_8( 0xA9, 0xBC, 0xAD, 0x41, 0xE7, 0x32, 0x3A, 0x81 ),
+    BYTES_TO_T_UINT_4( 0x8A, 0x97, 0x52, 0x83 ),
+    BYTES_TO_T_UINT_8( 0x1A, 0x13, 0x7A, 0xBD, 0xAE, 0x94, 0x60, 0xFD ),
+    BYTES_TO_T_UINT_8( 0x92, 0x9B, 0x95, 0xB4, 0x6E, 0x68, 0xB2, 0x1F ),
+    BYTES_TO_T_UINT_8( 0x15, 0x49, 0xBE, 0x51, 0xFE, 0x66, 0x15, 0x74 ),
+    BYTES_TO_T_UINT_4( 0xE6, 0x37, 0xE4, 0xFE ),
+    /* T[6].X, T[6].Y */
+    BYTES_TO_T_UINT_8( 0xF6, 0x9B, 0xEE, 0x64, 0xC9, 0x1B, 0xBD, 0x77 ),
+    BYTES_TO_T_UINT_8( 0xDA, 0x5F, 0x34, 0xA9, 0x0B, 0xB7, 0x25, 0x52 ),
+    BYTES_TO_T_UINT_8( 0x90, 0x13, 0xB1, 0x38, 0xFB, 0x9D, 0x78, 0xED ),
+    BYTES_TO_T_UINT_4( 0x39, 0xE7, 0x1B, 0xFA ),
+    BYTES_TO_T_UINT_8( 0xFB, 0xB3, 0xB7, 0x44, 0x92, 0x6B, 0x00, 0x82 ),
+    BYTES_TO_T_UINT_8( 0x97, 0x82, 0x44, 0x3E, 0x18, 0x1A, 0x58, 0x6A ),
+    BYTES_TO_T_UINT_8( 0x15, 0xF8, 0xC0, 0xE4, 0xEE, 0xC1, 0xBF, 0x44 ),
+    BYTES_TO_T_UINT_4( 0x7E, 0x32, 0x27, 0xB2 ),
+    /* T[7].X, T[7].Y */
+    BYTES_TO_T_UINT_8( 0xF4, 0x9A, 0x42, 0x62, 0x8B, 0x26, 0x54, 0x21 ),
+    BYTES_TO_T_UINT_8( 0x24, 0x85, 0x74, 0xA0, 0x79, 0xA8, 0xEE, 0xBE ),
+    BYTES_TO_T_UINT_8( 0x80, 0x36, 0x60, 0xB3, 0x28, 0x4D, 0x55, 0xBE ),
+    BYTES_TO_T_UINT_4( 0x32, 0x27, 0x82, 0x29 ),
+    BYTES_TO_T_UINT_8( 0x0D, 0xFC, 0x73, 0x77, 0xAF, 0x5C, 0xAC, 0x78 ),
+    BYTES_TO_T_UINT_8( 0xCC, 0xED, 0xE5, 0xF6, 0x1D, 0xA8, 0x67, 0x43 ),
+    BYTES_TO_T_UINT_8( 0xF8, 0xDE, 0x33, 0x1C, 0xF1, 0x80, 0x73, 0xF8 ),
+    BYTES_TO_T_UINT_4( 0x2A, 0xE2, 0xDE, 0x3C ),
+    /* T[8].X, T[8].Y */
+    BYTES_TO_T_UINT_8( 0x57, 0x3E, 0x6B, 0xFE, 0xF0, 0x04, 0x28, 0x01 ),
+    BYTES_TO_T_UINT_8( 0xBB, 0xB2, 0x14, 0x9D, 0x18, 0x11, 0x7D, 0x9D ),
+    BYTES_TO_T_UINT_8( 0x96, 0xC4, 0xD6, 0x2E, 0x6E, 0x57, 0x4D, 0xE1 ),
+    BYTES_TO_T_UINT_4( 0xEA, 0x55, 0x1B, 0xDE ),
+    BYTES_TO_T_UINT_8( 0x07, 0xF7, 0x17, 0xBC, 0x45, 0xAB, 0x16, 0xAB ),
+    BYTES_TO_T_UINT_8( 0xCD, 0xB0, 0xEF, 0x61, 0xE3, 0x20, 0x7C, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0x6C, 0x85, 0x41, 0x4D, 0xF1, 0x7E, 0x4D, 0x41 ),
+    BYTES_TO_T_UINT_4( 0x99, 0xC2, 0x9B, 0x5E ),
+    /* T[9].X, T[9].Y */
+    BYTES_TO_T_UINT_8( 0x70, 0x2E, 0x49, 0x3D, 0x3E, 0x4B, 0xD3, 0x32 ),
+    BYTES_TO_T_UINT_8( 0xC8, 0x2B, 0x9D, 0xD5, 0x27, 0xFA, 0xCA, 0xE0 ),
+    BYTES_TO_T_UINT_8( 0xB3, 0xB3, 0x6A, 0xE0, 0x79, 0x14, 0x28, 0x0F ),
+    BYTES_TO_T_UINT_4( 0x6C, 0x1E, 0xDC, 0xF5 ),
+    BYTES_TO_T_UINT_8( 0xCA, 0x44, 0x56, 0xCD, 0xFC, 0x9F, 0x09, 0xFF ),
+    BYTES_TO_T_UINT_8( 0x5C, 0x8C, 0x59, 0xA4, 0x64, 0x2A, 0x3A, 0xED ),
+    BYTES_TO_T_UINT_8( 0x40, 0xA0, 0xB5, 0x86, 0x4E, 0x69, 0xDA, 0x06 ),
+    BYTES_TO_T_UINT_4( 0x08, 0x8B, 0x11, 0x38 ),
+    /* T[10].X, T[10].Y */
+    BYTES_TO_T_UINT_8( 0xA0, 0x17, 0x16, 0x12, 0x17, 0xDC, 0x00, 0x7E ),
+    BYTES_TO_T_UINT_8( 0xE7, 0x76, 0x24, 0x6C, 0x97, 0x2C, 0xB5, 0xF9 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x71, 0xE3, 0xB0, 0xBB, 0x4E, 0x50, 0x52 ),
+    BYTES_TO_T_UINT_4( 0x6E, 0x48, 0x26, 0xD5 ),
+    BYTES_TO_T_UINT_8( 0x06, 0x5F, 0x28, 0xF6, 0x01, 0x5A, 0x60, 0x41 ),
+    BYTES_TO_T_UINT_8( 0xAE, 0x95, 0xFE, 0xD0, 0xAD, 0x15, 0xD4, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0xAD, 0x5B, 0x7A, 0xFD, 0x80, 0xF7, 0x9F, 0x64 ),
+    BYTES_TO_T_UINT_4( 0x32, 0xBC, 0x1B, 0xDF ),
+    /* T[11].X, T[11].Y */
+    BYTES_TO_T_UINT_8( 0xBB, 0xE6, 0xDF, 0x14, 0x29, 0xF4, 0xD4, 0x14 ),
+    BYTES_TO_T_UINT_8( 0xE5, 0x12, 0xDD, 0xEC, 0x5B, 0x8A, 0x59, 0xE5 ),
+    BYTES_TO_T_UINT_8( 0x26, 0x92, 0x3E, 0x35, 0x08, 0xE9, 0xCF, 0x0E ),
+    BYTES_TO_T_UINT_4( 0xE0, 0x35, 0x29, 0x97 ),
+    BYTES_TO_T_UINT_8( 0x11, 0xDB, 0xD6, 0x6A, 0xC5, 0x43, 0xA4, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0x61, 0x33, 0x50, 0x61, 0x70, 0xA1, 0xE9, 0xCE ),
+    BYTES_TO_T_UINT_8( 0x15, 0x15, 0x6E, 0x5F, 0x01, 0x0C, 0x8C, 0xFA ),
+    BYTES_TO_T_UINT_4( 0x85, 0xA1, 0x9A, 0x9D ),
+    /* T[12].X, T[12].Y */
+    BYTES_TO_T_UINT_8( 0x6E, 0xC6, 0xF7, 0xE2, 0x4A, 0xCD, 0x9B, 0x61 ),
+    BYTES_TO_T_UINT_8( 0x34, 0x4D, 0x5A, 0xB8, 0xE2, 0x6D, 0xA6, 0x50 ),
+    BYTES_TO_T_UINT_8( 0x32, 0x3F, 0xB6, 0x17, 0xE3, 0x2C, 0x6F, 0x65 ),
+    BYTES_TO_T_UINT_4( 0x1E, 0xA4, 0x59, 0x51 ),
+    BYTES_TO_T_UINT_8( 0x77, 0x4F, 0x7C, 0x49, 0xCD, 0x6E, 0xEB, 0x3C ),
+    BYTES_TO_T_UINT_8( 0x05, 0xC9, 0x1F, 0xB7, 0x4D, 0x98, 0xC7, 0x67 ),
+    BYTES_TO_T_UINT_8( 0x4C, 0xFD, 0x98, 0x20, 0x95, 0xBB, 0x20, 0x3A ),
+    BYTES_TO_T_UINT_4( 0xE0, 0xF2, 0x73, 0x92 ),
+    /* T[13].X, T[13].Y */
+    BYTES_TO_T_UINT_8( 0xE2, 0xEF, 0xFB, 0x30, 0xFA, 0x12, 0x1A, 0xB0 ),
+    BYTES_TO_T_UINT_8( 0x7A, 0x4C, 0x24, 0xB4, 0x5B, 0xC9, 0x4C, 0x0F ),
+    BYTES_TO_T_UINT_8( 0x7A, 0xDD, 0x5E, 0x84, 0x95, 0x4D, 0x26, 0xED ),
+    BYTES_TO_T_UINT_4( 0xE3, 0xFA, 0xF9, 0x3A ),
+    BYTES_TO_T_UINT_8( 0x6A, 0xA3, 0x2E, 0x7A, 0xDC, 0xA7, 0x53, 0xA9 ),
+    BYTES_TO_T_UINT_8( 0x7C, 0x9F, 0x81, 0x84, 0xB2, 0x0D, 0xFE, 0x31 ),
+    BYTES_TO_T_UINT_8( 0x61, 0x89, 0x1B, 0x77, 0x0C, 0x89, 0x71, 0xEC ),
+    BYTES_TO_T_UINT_4( 0xFA, 0xFF, 0x7F, 0xB2 ),
+    /* T[14].X, T[14].Y */
+    BYTES_TO_T_UINT_8( 0x28, 0xE9, 0x2C, 0x79, 0xA6, 0x3C, 0xAD, 0x93 ),
+    BYTES_TO_T_UINT_8( 0xD6, 0xE0, 0x23, 0x02, 0x86, 0x0F, 0x77, 0x2A ),
+    BYTES_TO_T_UINT_8( 0x13, 0x93, 0x6D, 0xE9, 0xF9, 0x3C, 0xBE, 0xB9 ),
+    BYTES_TO_T_UINT_4( 0x04, 0xE7, 0x24, 0x92 ),
+    BYTES_TO_T_UINT_8( 0xBB, 0x3C, 0x5B, 0x4B, 0x1B, 0x25, 0x37, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0xC9, 0xE8, 0x38, 0x1B, 0xA1, 0x5A, 0x2E, 0x68 ),
+    BYTES_TO_T_UINT_8( 0x03, 0x19, 0xFD, 0xF4, 0x78, 0x01, 0x6B, 0x44 ),
+    BYTES_TO_T_UINT_4( 0x0F, 0x69, 0x37, 0x4F ),
+    /* T[15].X, T[15].Y */
+    BYTES_TO_T_UINT_8( 0x1A, 0xE2, 0xBF, 0xD3, 0xEC, 0x95, 0x9C, 0x03 ),
+    BYTES_TO_T_UINT_8( 0xC2, 0x7B, 0xFC, 0xD5, 0xD3, 0x25, 0x5E, 0x0F ),
+    BYTES_TO_T_UINT_8( 0x39, 0x55, 0x09, 0xA2, 0x58, 0x6A, 0xC9, 0xFF ),
+    BYTES_TO_T_UINT_4( 0x80, 0xCC, 0x3B, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0x8F, 0x08, 0x65, 0x5E, 0xCB, 0xAB, 0x48, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0xEE, 0x79, 0x8B, 0xC0, 0x11, 0xC0, 0x69, 0x38 ),
+    BYTES_TO_T_UINT_8( 0xE6, 0xE8, 0x8C, 0x4C, 0xC5, 0x28, 0xE4, 0xAE ),
+    BYTES_TO_T_UINT_4( 0xA5, 0x1F, 0x34, 0x5C ),
+};
+static const mbedtls_ecp_point secp224k1_T[16] = {
+    ECP_COMB_POINT( secp224k1, 0 ),
+    ECP_COMB_POINT( secp224k1, 1 ),
+    ECP_COMB_POINT( secp224k1, 2 ),
+    ECP_COMB_POINT( secp224k1, 3 ),
+    ECP_COMB_POINT( secp224k1, 4 ),
+    ECP_COMB_POINT( secp224k1, 5 ),
+    ECP_COMB_POINT( secp224k1, 6 ),
+    ECP_COMB_POINT( secp224k1, 7 ),
+    ECP_COMB_POINT( secp224k1, 8 ),
+    ECP_COMB_POINT( secp224k1, 9 ),
+    ECP_COMB_POINT( secp224k1, 10 ),
+    ECP_COMB_POINT( secp224k1, 11 ),
+    ECP_COMB_POINT( secp224k1, 12 ),
+    ECP_COMB_POINT( secp224k1, 13 ),
+    ECP_COMB_POINT( secp224k1, 14 ),
+    ECP_COMB_POINT( secp224k1, 15 ),
+};
+#endif /* MBEDTLS_ECP_FIXED_POINT_OPTIM */
 #endif /* MBEDTLS_ECP_DP_SECP224K1_ENABLED */
 
 #if defined(MBEDTLS_ECP_DP_SECP256K1_ENABLED)
@@ -385,6 +2301,172 @@ static const mbedtls_mpi_uint secp256k1_n[] = {
     BYTES_TO_T_UINT_8( 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
     BYTES_TO_T_UINT_8( 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF ),
 };
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+static const mbedtls_mpi_uint secp256k1_T_xy[] = {
+    /* T[0].X, T[0].Y */
+    BYTES_TO_T_UINT_8( 0x98, 0x17, 0xF8, 0x16, 0x5B, 0x81, 0xF2, 0x59 ),
+    BYTES_TO_T_UINT_8( 0xD9, 0x28, 0xCE, 0x2D, 0xDB, 0xFC, 0x9B, 0x02 ),
+    BYTES_TO_T_UINT_8( 0x07, 0x0B, 0x87, 0xCE, 0x95, 0x62, 0xA0, 0x55 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0xBB, 0xDC, 0xF9, 0x7E, 0x66, 0xBE, 0x79 ),
+    BYTES_TO_T_UINT_8( 0xB8, 0xD4, 0x10, 0xFB, 0x8F, 0xD0, 0x47, 0x9C ),
+    BYTES_TO_T_UINT_8( 0x19, 0x54, 0x85, 0xA6, 0x48, 0xB4, 0x17, 0xFD ),
+    BYTES_TO_T_UINT_8( 0xA8, 0x08, 0x11, 0x0E, 0xFC, 0xFB, 0xA4, 0x5D ),
+    BYTES_TO_T_UINT_8( 0x65, 0xC4, 0xA3, 0x26, 0x77, 0xDA, 0x3A, 0x48 ),
+    /* T[1].X, T[1].Y */
+    BYTES_TO_T_UINT_8( 0xE7, 0xEE, 0xD7, 0x1E, 0x67, 0x86, 0x32, 0x74 ),
+    BYTES_TO_T_UINT_8( 0x23, 0x73, 0xB1, 0xA9, 0xD5, 0xCC, 0x27, 0x78 ),
+    BYTES_TO_T_UINT_8( 0x1F, 0x0E, 0x11, 0x01, 0x71, 0xFE, 0x92, 0x73 ),
+    BYTES_TO_T_UINT_8( 0xC6, 0x28, 0x63, 0x6D, 0x72, 0x09, 0xA6, 0xC0 ),
+    BYTES_TO_T_UINT_8( 0xCE, 0xE1, 0x69, 0xDC, 0x3E, 0x2C, 0x75, 0xC3 ),
+    BYTES_TO_T_UINT_8( 0xE5, 0xB7, 0x3F, 0x30, 0x26, 0x3C, 0xDF, 0x8E ),
+    BYTES_TO_T_UINT_8( 0x3D, 0xBE, 0xB9, 0x5D, 0x0E, 0xE8, 0x5E, 0x14 ),
+    BYTES_TO_T_UINT_8( 0x01, 0xC3, 0x05, 0xD6, 0xB7, 0xD5, 0x24, 0xFC ),
+    /* T[2].X, T[2].Y */
+    BYTES_TO_T_UINT_8( 0x13, 0xCF, 0x7B, 0xDC, 0xCD, 0xC3, 0x39, 0x9D ),
+    BYTES_TO_T_UINT_8( 0x42, 0xDA, 0xB9, 0xE5, 0x64, 0xA7, 0x47, 0x91 ),
+    BYTES_TO_T_UINT_8( 0x76, 0x46, 0xA8, 0x61, 0xF6, 0x23, 0xEB, 0x58 ),
+    BYTES_TO_T_UINT_8( 0x5C, 0xC1, 0xFF, 0xE4, 0x55, 0xD5, 0xC2, 0xBF ),
+    BYTES_TO_T_UINT_8( 0xC9, 0xBE, 0xB9, 0x59, 0x24, 0x13, 0x4A, 0x2A ),
+    BYTES_TO_T_UINT_8( 0x64, 0x45, 0x12, 0xDE, 0xBA, 0x4F, 0xEF, 0x56 ),
+    BYTES_TO_T_UINT_8( 0xBE, 0x08, 0xBF, 0xC1, 0x66, 0xAA, 0x0A, 0xBC ),
+    BYTES_TO_T_UINT_8( 0x36, 0xFE, 0x30, 0x55, 0x31, 0x86, 0xA7, 0xB4 ),
+    /* T[3].X, T[3].Y */
+    BYTES_TO_T_UINT_8( 0x1D, 0xBF, 0x18, 0x81, 0x67, 0x27, 0x42, 0xBD ),
+    BYTES_TO_T_UINT_8( 0x08, 0x05, 0x83, 0xA4, 0xDD, 0x57, 0xD3, 0x50 ),
+    BYTES_TO_T_UINT_8( 0x20, 0x63, 0xAB, 0xE4, 0x90, 0x70, 0xD0, 0x7C ),
+    BYTES_TO_T_UINT_8( 0x71, 0x5D, 0xFD, 0xA0, 0xEF, 0xCF, 0x1C, 0x54 ),
+    BYTES_TO_T_UINT_8( 0x13, 0x80, 0xE4, 0xF6, 0x09, 0xBC, 0x57, 0x90 ),
+    BYTES_TO_T_UINT_8( 0x21, 0x9F, 0x6E, 0x88, 0x54, 0x6E, 0x51, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0x5F, 0x85, 0xFB, 0x84, 0x3E, 0x4A, 0xAA ),
+    BYTES_TO_T_UINT_8( 0xA8, 0x19, 0xF5, 0x55, 0xC9, 0x07, 0xD8, 0xCE ),
+    /* T[4].X, T[4].Y */
+    BYTES_TO_T_UINT_8( 0x1A, 0xB4, 0xC3, 0xD9, 0x5C, 0xA0, 0xD4, 0x90 ),
+    BYTES_TO_T_UINT_8( 0x0D, 0x30, 0xAF, 0x59, 0x9B, 0xF8, 0x04, 0x85 ),
+    BYTES_TO_T_UINT_8( 0x4D, 0xA6, 0xFD, 0x66, 0x7B, 0xC3, 0x39, 0x85 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0xBF, 0xF0, 0xC2, 0xE9, 0x71, 0xA4, 0x9E ),
+    BYTES_TO_T_UINT_8( 0x14, 0x2D, 0xB9, 0x88, 0x28, 0xF1, 0xBE, 0x78 ),
+    BYTES_TO_T_UINT_8( 0x14, 0xF3, 0x1A, 0x0E, 0xB9, 0x01, 0x66, 0x34 ),
+    BYTES_TO_T_UINT_8( 0x77, 0xA7, 0xA4, 0xF4, 0x05, 0xD0, 0xAA, 0x53 ),
+    BYTES_TO_T_UINT_8( 0x00, 0x39, 0x1E, 0x47, 0xE5, 0x68, 0xC8, 0xC0 ),
+    /* T[5].X, T[5].Y */
+    BYTES_TO_T_UINT_8( 0xDD, 0xB9, 0xFC, 0xE0, 0x33, 0x8A, 0x7D, 0x96 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0x93, 0xA5, 0x53, 0x55, 0x16, 0xB4, 0x6E ),
+    BYTES_TO_T_UINT_8( 0xE9, 0x5F, 0xEA, 0x9B, 0x29, 0x52, 0x71, 0xDA ),
+    BYTES_TO_T_UINT_8( 0xB2, 0xF0, 0x24, 0xB8, 0x7D, 0xB7, 0xA0, 0x9B ),
+    BYTES_TO_T_UINT_8( 0xC2, 0x00, 0x27, 0xB2, 0xDF, 0x73, 0xA2, 0xE0 ),
+    BYTES_TO_T_UINT_8( 0x1D, 0x2E, 0x4D, 0x7C, 0xDE, 0x7A, 0x23, 0x32 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0x65, 0x60, 0xC7, 0x97, 0x1E, 0xA4, 0x22 ),
+    BYTES_TO_T_UINT_8( 0xCD, 0x13, 0x5B, 0x77, 0x59, 0xCB, 0x36, 0xE1 ),
+    /* T[6].X, T[6].Y */
+    BYTES_TO_T_UINT_8( 0x99, 0xBC, 0x9F, 0x9E, 0x2D, 0x53, 0x2A, 0xA8 ),
+    BYTES_TO_T_UINT_8( 0x87, 0x5F, 0x64, 0x9F, 0x1A, 0x19, 0xE6, 0x77 ),
+    BYTES_TO_T_UINT_8( 0x9E, 0x7B, 0x39, 0xD2, 0xDB, 0x85, 0x84, 0xD5 ),
+    BYTES_TO_T_UINT_8( 0x83, 0xC7, 0x0D, 0x58, 0x6E, 0x3F, 0x52, 0x15 ),
+    BYTES_TO_T_UINT_8( 0x21, 0x68, 0x19, 0x0B, 0x68, 0xC9, 0x1E, 0xFB ),
+    BYTES_TO_T_UINT_8( 0xD2, 0x4E, 0x21, 0x49, 0x3D, 0x55, 0xCC, 0x25 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0xF9, 0x25, 0x45, 0x54, 0x45, 0xB1, 0x0F ),
+    BYTES_TO_T_UINT_8( 0xA9, 0xB3, 0xF7, 0xCD, 0x80, 0xA4, 0x04, 0x05 ),
+    /* T[7].X, T[7].Y */
+    BYTES_TO_T_UINT_8( 0xD4, 0x1E, 0x88, 0xC4, 0xAA, 0x18, 0x7E, 0x45 ),
+    BYTES_TO_T_UINT_8( 0x4B, 0xAC, 0xD9, 0xB2, 0xA1, 0xC0, 0x71, 0x5D ),
+    BYTES_TO_T_UINT_8( 0xA9, 0xA2, 0xF1, 0x15, 0xA6, 0x5F, 0x6C, 0x86 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0x5B, 0x05, 0xBC, 0xB7, 0xC6, 0x4E, 0x72 ),
+    BYTES_TO_T_UINT_8( 0x1D, 0x80, 0xF8, 0x5C, 0x20, 0x2A, 0xE1, 0xE2 ),
+    BYTES_TO_T_UINT_8( 0x7C, 0x48, 0x2E, 0x68, 0x82, 0x7F, 0xEB, 0x5F ),
+    BYTES_TO_T_UINT_8( 0xA2, 0x3B, 0x25, 0xDB, 0x32, 0x4D, 0x88, 0x42 ),
+    BYTES_TO_T_UINT_8( 0xEE, 0x6E, 0xA6, 0xB6, 0x6D, 0x62, 0x78, 0x22 ),
+    /* T[8].X, T[8].Y */
+    BYTES_TO_T_UINT_8( 0x1F, 0x4D, 0x3E, 0x86, 0x58, 0xC3, 0xEB, 0xBA ),
+    BYTES_TO_T_UINT_8( 0x1A, 0x89, 0x33, 0x18, 0x21, 0x1D, 0x9B, 0xE7 ),
+    BYTES_TO_T_UINT_8( 0x0B, 0x9D, 0xFF, 0xC3, 0x79, 0xC1, 0x88, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0x28, 0xD4, 0x48, 0x53, 0xE8, 0xAD, 0x21, 0x16 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0x7B, 0xDE, 0xCB, 0xD8, 0x39, 0x17, 0x7C ),
+    BYTES_TO_T_UINT_8( 0xD3, 0xF3, 0x03, 0xF2, 0x5C, 0xBC, 0xC8, 0x8A ),
+    BYTES_TO_T_UINT_8( 0x27, 0xAE, 0x4C, 0xB0, 0x16, 0xA4, 0x93, 0x86 ),
+    BYTES_TO_T_UINT_8( 0x71, 0x8B, 0x6B, 0xDC, 0xD7, 0x9A, 0x3E, 0x7E ),
+    /* T[9].X, T[9].Y */
+    BYTES_TO_T_UINT_8( 0xD6, 0x2D, 0x7A, 0xD2, 0x59, 0x05, 0xA2, 0x82 ),
+    BYTES_TO_T_UINT_8( 0x57, 0x56, 0x09, 0x32, 0xF1, 0xE8, 0xE3, 0x72 ),
+    BYTES_TO_T_UINT_8( 0x03, 0xCA, 0xE5, 0x2E, 0xF0, 0xFB, 0x18, 0x19 ),
+    BYTES_TO_T_UINT_8( 0xBA, 0x85, 0xA9, 0x23, 0x15, 0x31, 0x1F, 0x0E ),
+    BYTES_TO_T_UINT_8( 0x76, 0xE5, 0xB1, 0x86, 0xB9, 0x6E, 0x8D, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0x6C, 0x77, 0xFC, 0xC9, 0xA3, 0x3F, 0x89, 0xD2 ),
+    BYTES_TO_T_UINT_8( 0xDB, 0x6A, 0xDC, 0x25, 0xB0, 0xC7, 0x41, 0x54 ),
+    BYTES_TO_T_UINT_8( 0x02, 0x11, 0x6B, 0xA6, 0x11, 0x62, 0xD4, 0x2D ),
+    /* T[10].X, T[10].Y */
+    BYTES_TO_T_UINT_8( 0x19, 0x7D, 0x34, 0xB3, 0x20, 0x7F, 0x37, 0xAA ),
+    BYTES_TO_T_UINT_8( 0xBD, 0xD4, 0x45, 0xE8, 0xC2, 0xE9, 0xC5, 0xEA ),
+    BYTES_TO_T_UINT_8( 0x5A, 0x32, 0x3B, 0x25, 0x7E, 0x79, 0xAF, 0xE7 ),
+    BYTES_TO_T_UINT_8( 0x3F, 0xE4, 0x54, 0x71, 0xBE, 0x35, 0x4E, 0xD0 ),
+    BYTES_TO_T_UINT_8( 0xB0, 0x94, 0xDD, 0x8F, 0xB5, 0xC2, 0xDD, 0x75 ),
+    BYTES_TO_T_UINT_8( 0x07, 0x49, 0xE9, 0x1C, 0x2F, 0x08, 0x49, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0x77, 0xB6, 0x03, 0x88, 0x6F, 0xB8, 0x15, 0x67 ),
+    BYTES_TO_T_UINT_8( 0xA4, 0xD3, 0x1C, 0xF3, 0xA5, 0xEB, 0x79, 0x01 ),
+    /* T[11].X, T[11].Y */
+    BYTES_TO_T_UINT_8( 0x25, 0xF9, 0x43, 0x88, 0x89, 0x0D, 0x06, 0xEA ),
+    BYTES_TO_T_UINT_8( 0x02, 0x2D, 0xF5, 0x98, 0x32, 0xF6, 0xB1, 0x05 ),
+    BYTES_TO_T_UINT_8( 0x23, 0x73, 0x8F, 0x2B, 0x50, 0x27, 0x0A, 0xE7 ),
+    BYTES_TO_T_UINT_8( 0xA7, 0xE3, 0xBD, 0x16, 0x05, 0xC8, 0x93, 0x12 ),
+    BYTES_TO_T_UINT_8( 0x0A, 0x6A, 0xF7, 0xE3, 0x3D, 0xDE, 0x5F, 0x2F ),
+    BYTES_TO_T_UINT_8( 0x47, 0xA3, 0x9C, 0x22, 0x3C, 0x33, 0x36, 0x5D ),
+    BYTES_TO_T_UINT_8( 0x20, 0x24, 0x4C, 0x69, 0x45, 0x78, 0x14, 0xAE ),
+    BYTES_TO_T_UINT_8( 0x59, 0xF8, 0xD4, 0xBF, 0xB8, 0xC0, 0xA1, 0x25 ),
+    /* T[12].X, T[12].Y */
+    BYTES_TO_T_UINT_8( 0x7E, 0x88, 0xE1, 0x91, 0x03, 0xEB, 0xB3, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x5C, 0x11, 0xA1, 0xEF, 0x14, 0x0D, 0xC4, 0x7D ),
+    BYTES_TO_T_UINT_8( 0xFE, 0xD4, 0x0D, 0x1D, 0x96, 0x33, 0x5C, 0x19 ),
+    BYTES_TO_T_UINT_8( 0x70, 0x45, 0x2A, 0x1A, 0xE6, 0x57, 0x04, 0x9B ),
+    BYTES_TO_T_UINT_8( 0x70, 0xB5, 0xA7, 0x80, 0xE9, 0x93, 0x97, 0x8D ),
+    BYTES_TO_T_UINT_8( 0x5D, 0xB9, 0x7C, 0xA0, 0xC9, 0x57, 0x26, 0x43 ),
+    BYTES_TO_T_UINT_8( 0x9E, 0xEF, 0x56, 0xDA, 0x66, 0xF6, 0x1B, 0x9A ),
+    BYTES_TO_T_UINT_8( 0x1F, 0x89, 0x6B, 0x91, 0xE0, 0xA9, 0x65, 0x2B ),
+    /* T[13].X, T[13].Y */
+    BYTES_TO_T_UINT_8( 0x91, 0x98, 0x96, 0x9B, 0x06, 0x7D, 0x5E, 0x5A ),
+    BYTES_TO_T_UINT_8( 0x0A, 0xFA, 0xC1, 0x5F, 0x19, 0x37, 0x94, 0x9D ),
+    BYTES_TO_T_UINT_8( 0xCF, 0xBE, 0x6B, 0x1A, 0x05, 0xE4, 0xBF, 0x9F ),
+    BYTES_TO_T_UINT_8( 0x84, 0xCD, 0x5D, 0x35, 0xB4, 0x51, 0xF7, 0x64 ),
+    BYTES_TO_T_UINT_8( 0x6C, 0xEF, 0x96, 0xDB, 0xF2, 0x61, 0x63, 0x59 ),
+    BYTES_TO_T_UINT_8( 0xCB, 0x04, 0x88, 0xC9, 0x9F, 0x1B, 0x94, 0xB9 ),
+    BYTES_TO_T_UINT_8( 0xDB, 0x30, 0x79, 0x7E, 0x24, 0xE7, 0x5F, 0xB8 ),
+    BYTES_TO_T_UINT_8( 0x3F, 0xB8, 0x90, 0xB7, 0x94, 0x25, 0xBB, 0x0F ),
+    /* T[14].X, T[14].Y */
+    BYTES_TO_T_UINT_8( 0x62, 0x79, 0xEA, 0xAD, 0xC0, 0x6D, 0x18, 0x57 ),
+    BYTES_TO_T_UINT_8( 0xE9, 0xA4, 0x58, 0x2A, 0x8D, 0x95, 0xB3, 0xE6 ),
+    BYTES_TO_T_UINT_8( 0xC8, 0xC4, 0xC2, 0x12, 0x0D, 0x79, 0xE2, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x02, 0x6F, 0xBE, 0x97, 0x4D, 0xA4, 0x20, 0x07 ),
+    BYTES_TO_T_UINT_8( 0xCA, 0x31, 0x71, 0xC6, 0xA6, 0x91, 0xEB, 0x1F ),
+    BYTES_TO_T_UINT_8( 0xB4, 0x9B, 0xA8, 0x4A, 0xE7, 0x77, 0xE1, 0xAA ),
+    BYTES_TO_T_UINT_8( 0xA9, 0x06, 0xD3, 0x3D, 0x94, 0x30, 0xEF, 0x8C ),
+    BYTES_TO_T_UINT_8( 0xE7, 0xDF, 0xCA, 0xFA, 0xF5, 0x28, 0xF8, 0xC9 ),
+    /* T[15].X, T[15].Y */
+    BYTES_TO_T_UINT_8( 0xCC, 0xE1, 0x32, 0xFD, 0x3E, 0x81, 0xF8, 0x11 ),
+    BYTES_TO_T_UINT_8( 0xCD, 0xF2, 0x4B, 0x1D, 0x19, 0xC9, 0x0F, 0xCC ),
+    BYTES_TO_T_UINT_8( 0x59, 0xB1, 0x8A, 0x22, 0x8B, 0x05, 0x6B, 0x56 ),
+    BYTES_TO_T_UINT_8( 0x35, 0x21, 0xEF, 0x30, 0xEC, 0x09, 0x2A, 0x89 ),
+    BYTES_TO_T_UINT_8( 0x15, 0x84, 0x4A, 0x46, 0x07, 0x6C, 0x3C, 0x4C ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x18, 0x3A, 0xF4, 0xCC, 0xF5, 0xB2, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0x8F, 0xCD, 0x0A, 0x9C, 0xF4, 0xBD, 0x95 ),
+    BYTES_TO_T_UINT_8( 0x37, 0x89, 0x7F, 0x8A, 0xB1, 0x52, 0x3A, 0xAB ),
+};
+static const mbedtls_ecp_point secp256k1_T[16] = {
+    ECP_COMB_POINT( secp256k1, 0 ),
+    ECP_COMB_POINT( secp256k1, 1 ),
+    ECP_COMB_POINT( secp256k1, 2 ),
+    ECP_COMB_POINT( secp256k1, 3 ),
+    ECP_COMB_POINT( secp256k1, 4 ),
+    ECP_COMB_POINT( secp256k1, 5 ),
+    ECP_COMB_POINT( secp256k1, 6 ),
+    ECP_COMB_POINT( secp256k1, 7 ),
+    ECP_COMB_POINT( secp256k1, 8 ),
+    ECP_COMB_POINT( secp256k1, 9 ),
+    ECP_COMB_POINT( secp256k1, 10 ),
+    ECP_COMB_POINT( secp256k1, 11 ),
+    ECP_COMB_POINT( secp256k1, 12 ),
+    ECP_COMB_POINT( secp256k1, 13 ),
+    ECP_COMB_POINT( secp256k1, 14 ),
+    ECP_COMB_POINT( secp256k1, 15 ),
+};
+#endif /* MBEDTLS_ECP_FIXED_POINT_OPTIM */
 #endif /* MBEDTLS_ECP_DP_SECP256K1_ENABLED */
 
 /*
@@ -427,6 +2509,177 @@ static const mbedtls_mpi_uint brainpoolP256r1_n[] = {
     BYTES_TO_T_UINT_8( 0x71, 0x8D, 0x83, 0x9D, 0x90, 0x0A, 0x66, 0x3E ),
     BYTES_TO_T_UINT_8( 0xBC, 0xA9, 0xEE, 0xA1, 0xDB, 0x57, 0xFB, 0xA9 ),
 };
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+/* The table below is in Montgomery form, see ecp_mont_setup() */
+#define brainpoolP256r1_T    NULL
+#else
+static const mbedtls_mpi_uint brainpoolP256r1_T_xy[] = {
+    /* T[0].X, T[0].Y */
+    BYTES_TO_T_UINT_8( 0x0C, 0xD1, 0x1F, 0x35, 0x2D, 0xD9, 0xC0, 0x27 ),
+    BYTES_TO_T_UINT_8( 0x0A, 0xF3, 0x7C, 0xB9, 0x9A, 0x4D, 0xDE, 0x80 ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x2A, 0x89, 0x6B, 0x1D, 0x31, 0x4C, 0x70 ),
+    BYTES_TO_T_UINT_8( 0xDF, 0x9B, 0x11, 0x9E, 0x7A, 0x76, 0x1F, 0x8E ),
+    BYTES_TO_T_UINT_8( 0x17, 0x7A, 0x91, 0xA0, 0x48, 0xE9, 0x4F, 0x9A ),
+    BYTES_TO_T_UINT_8( 0x62, 0x01, 0x95, 0xCD, 0x59, 0xF2, 0x18, 0xA6 ),
+    BYTES_TO_T_UINT_8( 0x03, 0x8B, 0xBD, 0xDF, 0xE8, 0xF6, 0xFD, 0x16 ),
+    BYTES_TO_T_UINT_8( 0xA2, 0xB0, 0x6E, 0x02, 0xC6, 0x78, 0xEB, 0x14 ),
+    /* T[1].X, T[1].Y */
+    BYTES_TO_T_UINT_8( 0xA9, 0x2D, 0xC8, 0x0C, 0xD5, 0x53, 0xFE, 0xCF ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x2A, 0x5B, 0xBA, 0x49, 0x7B, 0x7E, 0x09 ),
+    BYTES_TO_T_UINT_8( 0x9D, 0x53, 0x68, 0x59, 0x5F, 0xA5, 0x8A, 0xCD ),
+    BYTES_TO_T_UINT_8( 0x5D, 0x9C, 0x34, 0x62, 0x23, 0xEE, 0x05, 0x5C ),
+    BYTES_TO_T_UINT_8( 0x42, 0x26, 0xA8, 0xB9, 0xC5, 0x83, 0x47, 0x1A ),
+    BYTES_TO_T_UINT_8( 0x43, 0x0E, 0x3B, 0x96, 0x50, 0xFE, 0xDA, 0x6E ),
+    BYTES_TO_T_UINT_8( 0x7F, 0xEA, 0x74, 0x43, 0xA3, 0x8E, 0xD3, 0x59 ),
+    BYTES_TO_T_UINT_8( 0xBA, 0xFD, 0x12, 0x6C, 0x54, 0xBB, 0x31, 0x92 ),
+    /* T[2].X, T[2].Y */
+    BYTES_TO_T_UINT_8( 0x84, 0xE6, 0x1A, 0x65, 0xF1, 0xC4, 0xE4, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0x4C, 0x33, 0x7E, 0x72, 0xC5, 0xBC, 0x57, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0x3F, 0x09, 0x43, 0x93, 0x03, 0x88, 0x50, 0x9D ),
+    BYTES_TO_T_UINT_8( 0x88, 0xCC, 0x3C, 0xE3, 0xAB, 0x6D, 0xA9, 0x1F ),
+    BYTES_TO_T_UINT_8( 0x6B, 0x12, 0x04, 0xF9, 0x5E, 0x46, 0xF4, 0x26 ),
+    BYTES_TO_T_UINT_8( 0xC8, 0xC4, 0xF5, 0x31, 0x59, 0xB5, 0x48, 0x4B ),
+    BYTES_TO_T_UINT_8( 0x6B, 0x75, 0xC6, 0xC3, 0xFA, 0x6F, 0xFC, 0xF7 ),
+    BYTES_TO_T_UINT_8( 0x8C, 0x1C, 0xC2, 0xAF, 0x42, 0x99, 0x83, 0x24 ),
+    /* T[3].X, T[3].Y */
+    BYTES_TO_T_UINT_8( 0x58, 0xBD, 0xF6, 0x08, 0x25, 0x3E, 0x92, 0x37 ),
+    BYTES_TO_T_UINT_8( 0xF0, 0x25, 0xED, 0x23, 0xA8, 0x3A, 0x15, 0xE3 ),
+    BYTES_TO_T_UINT_8( 0x37, 0x3D, 0x0C, 0xAC, 0xCD, 0x1C, 0x7A, 0x1F ),
+    BYTES_TO_T_UINT_8( 0xA5, 0x56, 0x62, 0x84, 0x6A, 0xBC, 0x71, 0x2C ),
+    BYTES_TO_T_UINT_8( 0xFD, 0x52, 0xF5, 0xAE, 0xC8, 0x50, 0x46, 0x40 ),
+    BYTES_TO_T_UINT_8( 0x56, 0x30, 0xF9, 0x95, 0x29, 0xC7, 0x56, 0xBC ),
+    BYTES_TO_T_UINT_8( 0xE5, 0xC4, 0xBC, 0x92, 0xBF, 0xC7, 0xC6, 0x4D ),
+    BYTES_TO_T_UINT_8( 0xE0, 0xAB, 0x22, 0x77, 0xFF, 0xA9, 0xCD, 0x0E ),
+    /* T[4].X, T[4].Y */
+    BYTES_TO_T_UINT_8( 0x1B, 0xFC, 0xFD, 0xCB, 0x7F, 0x10, 0x6C, 0x3F ),
+    BYTES_TO_T_UINT_8( 0x10, 0xA4, 0x71, 0x24, 0xC7, 0xB7, 0xDA, 0xFB ),
+    BYTES_TO_T_UINT_8( 0x23, 0xFA, 0x99, 0x4A, 0x01, 0x5B, 0x15, 0x92 ),
+    BYTES_TO_T_UINT_8( 0x02, 0xB4, 0x1D, 0xFE, 0xCE, 0xE9, 0x71, 0x08 ),
+    BYTES_TO_T_UINT_8( 0x66, 0xA2, 0x17, 0x96, 0x19, 0x1F, 0x3D, 0xA0 ),
+    BYTES_TO_T_UINT_8( 0xB5, 0x7E, 0xB3, 0xAE, 0x80, 0x81, 0xD0, 0xBF ),
+    BYTES_TO_T_UINT_8( 0xC5, 0xFB, 0x72, 0xEB, 0xE2, 0xB0, 0xC8, 0x84 ),
+    BYTES_TO_T_UINT_8( 0x8F, 0x62, 0x85, 0x87, 0x72, 0x5C, 0x88, 0x4A ),
+    /* T[5].X, T[5].Y */
+    BYTES_TO_T_UINT_8( 0x76, 0x39, 0x2C, 0x14, 0xD6, 0x17, 0x2B, 0xB0 ),
+    BYTES_TO_T_UINT_8( 0x35, 0x23, 0x4F, 0xA4, 0x45, 0xC0, 0x0E, 0x09 ),
+    BYTES_TO_T_UINT_8( 0x08, 0xCE, 0xEE, 0x58, 0x11, 0x96, 0xB3, 0xEA ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x21, 0x60, 0x7B, 0x52, 0x81, 0xEB, 0x12 ),
+    BYTES_TO_T_UINT_8( 0xBA, 0xC1, 0x27, 0x63, 0xE9, 0xB3, 0xFC, 0x70 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0x6E, 0xCC, 0x63, 0xB2, 0x08, 0xBA, 0x74 ),
+    BYTES_TO_T_UINT_8( 0x7E, 0xFC, 0xFC, 0xCC, 0xB3, 0xF0, 0x03, 0x51 ),
+    BYTES_TO_T_UINT_8( 0x13, 0x7B, 0xD4, 0x13, 0x54, 0xC5, 0x53, 0x3A ),
+    /* T[6].X, T[6].Y */
+    BYTES_TO_T_UINT_8( 0xD4, 0xE4, 0x61, 0xEB, 0x61, 0xA8, 0x1D, 0x18 ),
+    BYTES_TO_T_UINT_8( 0xB3, 0x8D, 0x31, 0x98, 0x62, 0x77, 0xB0, 0xF0 ),
+    BYTES_TO_T_UINT_8( 0x75, 0xC5, 0x7F, 0x20, 0xC1, 0x2A, 0x3F, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x16, 0x27, 0xA5, 0x48, 0x9B, 0x3A, 0xF3, 0x06 ),
+    BYTES_TO_T_UINT_8( 0xB2, 0xD6, 0x21, 0x47, 0xC4, 0xB1, 0xE6, 0x62 ),
+    BYTES_TO_T_UINT_8( 0xF0, 0xF2, 0xF7, 0xA7, 0xEC, 0xCE, 0x2F, 0xB0 ),
+    BYTES_TO_T_UINT_8( 0x26, 0x04, 0x07, 0xD3, 0x85, 0x9F, 0x5A, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0x21, 0x4A, 0x91, 0x30, 0xE6, 0x00, 0xB0, 0x89 ),
+    /* T[7].X, T[7].Y */
+    BYTES_TO_T_UINT_8( 0xE7, 0x30, 0xA5, 0x06, 0xE8, 0x6E, 0x73, 0xF1 ),
+    BYTES_TO_T_UINT_8( 0xF7, 0x50, 0x3B, 0x02, 0x96, 0xE5, 0x05, 0xB0 ),
+    BYTES_TO_T_UINT_8( 0x55, 0x6B, 0x70, 0xA7, 0x87, 0x90, 0x4D, 0x11 ),
+    BYTES_TO_T_UINT_8( 0x3D, 0x6C, 0xFB, 0x84, 0x25, 0x00, 0x2D, 0x1B ),
+    BYTES_TO_T_UINT_8( 0x5C, 0xBD, 0xF9, 0xB2, 0xA9, 0x5A, 0xE7, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0x72, 0xFA, 0xF3, 0x00, 0x59, 0xD6, 0x9D, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0xDE, 0x1F, 0xFF, 0x06, 0xC7, 0xAB, 0x64, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0xA1, 0x0D, 0x95, 0x74, 0x58, 0xE3, 0x23, 0x59 ),
+    /* T[8].X, T[8].Y */
+    BYTES_TO_T_UINT_8( 0x48, 0x17, 0x82, 0x72, 0x62, 0x42, 0x1B, 0x4E ),
+    BYTES_TO_T_UINT_8( 0x4D, 0x60, 0x4A, 0xD6, 0x45, 0x32, 0xF1, 0x10 ),
+    BYTES_TO_T_UINT_8( 0x31, 0x14, 0xFC, 0x47, 0xAA, 0x98, 0xF3, 0x8D ),
+    BYTES_TO_T_UINT_8( 0x2B, 0xBE, 0xF2, 0xCB, 0xC2, 0xA5, 0xD3, 0x09 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x3B, 0x7D, 0xFD, 0x70, 0x53, 0x6A, 0x17 ),
+    BYTES_TO_T_UINT_8( 0x31, 0xD5, 0x64, 0x5D, 0xE6, 0xDD, 0x32, 0x9C ),
+    BYTES_TO_T_UINT_8( 0xCA, 0x0B, 0x66, 0x02, 0x54, 0x6D, 0x6F, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0x36, 0xD7, 0xE4, 0xD0, 0xAA, 0xB7, 0xB3, 0x11 ),
+    /* T[9].X, T[9].Y */
+    BYTES_TO_T_UINT_8( 0xB5, 0x91, 0x2A, 0x9F, 0x64, 0x63, 0xBA, 0xF3 ),
+    BYTES_TO_T_UINT_8( 0x09, 0xFF, 0x9C, 0xBB, 0xC6, 0x21, 0xC6, 0x2A ),
+    BYTES_TO_T_UINT_8( 0x65, 0x59, 0xFA, 0x37, 0x06, 0x17, 0x6C, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0x6D, 0x39, 0x72, 0x2C, 0x82, 0x9D, 0xEF, 0x0A ),
+    BYTES_TO_T_UINT_8( 0x87, 0x1C, 0xE6, 0x6A, 0x42, 0x88, 0xF0, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x55, 0xE1, 0xFC, 0x1C, 0xA4, 0x71, 0xEB, 0xD4 ),
+    BYTES_TO_T_UINT_8( 0x42, 0x88, 0x6F, 0xA6, 0xE2, 0xAA, 0x93, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x99, 0xCD, 0x4B, 0x15, 0xB6, 0xC7, 0xFD, 0x2F ),
+    /* T[10].X, T[10].Y */
+    BYTES_TO_T_UINT_8( 0x40, 0x4D, 0x35, 0x8E, 0x14, 0xEB, 0xF8, 0xFE ),
+    BYTES_TO_T_UINT_8( 0x23, 0x3D, 0xA4, 0xD3, 0x68, 0x0D, 0x4A, 0xEB ),
+    BYTES_TO_T_UINT_8( 0x36, 0xF9, 0x8D, 0xE4, 0x5B, 0x92, 0xF4, 0x33 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0x72, 0x2E, 0xEB, 0x25, 0x82, 0xA8, 0x5A ),
+    BYTES_TO_T_UINT_8( 0x8B, 0xED, 0x09, 0xE0, 0xDF, 0xBF, 0xFC, 0xD1 ),
+    BYTES_TO_T_UINT_8( 0x68, 0x3A, 0x37, 0x21, 0x60, 0xE0, 0x41, 0xDB ),
+    BYTES_TO_T_UINT_8( 0xC6, 0x80, 0xFD, 0x19, 0xF2, 0x05, 0xD4, 0xBD ),
+    BYTES_TO_T_UINT_8( 0xA8, 0xA2, 0x18, 0x34, 0x1E, 0xE7, 0x9F, 0x13 ),
+    /* T[11].X, T[11].Y */
+    BYTES_TO_T_UINT_8( 0x71, 0xB3, 0xBF, 0xD5, 0x81, 0x16, 0x44, 0x1E ),
+    BYTES_TO_T_UINT_8( 0x0C, 0x35, 0x11, 0xEA, 0x7C, 0x9C, 0x57, 0x35 ),
+    BYTES_TO_T_UINT_8( 0xB3, 0x28, 0xDD, 0x95, 0x55, 0x1C, 0x1A, 0xDC ),
+    BYTES_TO_T_UINT_8( 0x05, 0xCF, 0xE7, 0xDF, 0xD8, 0x86, 0x9A, 0x88 ),
+    BYTES_TO_T_UINT_8( 0x75, 0xB3, 0xE7, 0x7B, 0x85, 0x50, 0x14, 0x91 ),
+    BYTES_TO_T_UINT_8( 0xBB, 0x18, 0x38, 0x7A, 0xF6, 0xA8, 0xFA, 0xC3 ),
+    BYTES_TO_T_UINT_8( 0x39, 0x52, 0xBA, 0x97, 0xFB, 0xDB, 0xEF, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0xFE, 0x0E, 0x25, 0xFD, 0x32, 0x9C, 0x6C, 0x11 ),
+    /* T[12].X, T[12].Y */
+    BYTES_TO_T_UINT_8( 0xA4, 0x5B, 0x27, 0x7B, 0xCB, 0xB8, 0x45, 0xC7 ),
+    BYTES_TO_T_UINT_8( 0x8B, 0xFA, 0x35, 0x3B, 0x23, 0xE4, 0x9C, 0x4D ),
+    BYTES_TO_T_UINT_8( 0xCF, 0x9A, 0x3E, 0xD2, 0x32, 0xBC, 0x4A, 0x24 ),
+    BYTES_TO_T_UINT_8( 0x23, 0xB6, 0x0B, 0x50, 0xA3, 0x23, 0xA6, 0x06 ),
+    BYTES_TO_T_UINT_8( 0xF9, 0xF7, 0x8D, 0x67, 0x3B, 0xAE, 0x6D, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0x79, 0xC9, 0x83, 0x78, 0x57, 0xDF, 0xB5, 0x92 ),
+    BYTES_TO_T_UINT_8( 0xBA, 0x93, 0x2B, 0x8F, 0x07, 0xA8, 0xF4, 0xCE ),
+    BYTES_TO_T_UINT_8( 0x3E, 0xFA, 0xB0, 0xC4, 0x22, 0xB6, 0xF4, 0x9F ),
+    /* T[13].X, T[13].Y */
+    BYTES_TO_T_UINT_8( 0x11, 0x61, 0x16, 0x27, 0x8F, 0x30, 0x1B, 0x48 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0x09, 0xF6, 0x77, 0x48, 0x6F, 0xC8, 0x38 ),
+    BYTES_TO_T_UINT_8( 0x7F, 0xAA, 0xE5, 0xEC, 0x23, 0x91, 0x2A, 0x27 ),
+    BYTES_TO_T_UINT_8( 0xDA, 0xB1, 0xF2, 0x10, 0x64, 0xB8, 0x14, 0x98 ),
+    BYTES_TO_T_UINT_8( 0x67, 0x50, 0xF0, 0xB8, 0xBD, 0x81, 0xD3, 0x4E ),
+    BYTES_TO_T_UINT_8( 0xE9, 0x91, 0x1E, 0xCD, 0xD2, 0x1B, 0x17, 0x6D ),
+    BYTES_TO_T_UINT_8( 0x8A, 0xDC, 0x0C, 0xDF, 0x3B, 0x9E, 0x82, 0xB0 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0x31, 0xDD, 0x68, 0x60, 0x47, 0x51, 0x66 ),
+    /* T[14].X, T[14].Y */
+    BYTES_TO_T_UINT_8( 0x36, 0xEE, 0x50, 0xC9, 0xE7, 0x2A, 0xD9, 0x27 ),
+    BYTES_TO_T_UINT_8( 0x41, 0x9B, 0x27, 0xF0, 0x14, 0xE2, 0xD1, 0x11 ),
+    BYTES_TO_T_UINT_8( 0x46, 0x00, 0x7B, 0x3E, 0xF6, 0x3B, 0x84, 0x79 ),
+    BYTES_TO_T_UINT_8( 0x08, 0xFC, 0x6D, 0xE1, 0x28, 0xA2, 0xE9, 0x30 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0x44, 0xE0, 0xFC, 0x32, 0xF5, 0xE8, 0xAE ),
+    BYTES_TO_T_UINT_8( 0xF6, 0x86, 0xAA, 0xAF, 0x81, 0xF9, 0x2D, 0x9B ),
+    BYTES_TO_T_UINT_8( 0xDE, 0xA2, 0x6B, 0xF9, 0x1E, 0xA1, 0xAE, 0x7A ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x77, 0xAF, 0xD5, 0x7C, 0x1B, 0x41, 0x17 ),
+    /* T[15].X, T[15].Y */
+    BYTES_TO_T_UINT_8( 0xBF, 0x77, 0x22, 0x64, 0x33, 0x73, 0x47, 0xF7 ),
+    BYTES_TO_T_UINT_8( 0x68, 0x7C, 0xD2, 0xCA, 0x6D, 0x54, 0xAC, 0x97 ),
+    BYTES_TO_T_UINT_8( 0x95, 0x8F, 0x62, 0x50, 0xB7, 0x09, 0x1D, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0xD7, 0x61, 0xCC, 0x2A, 0x18, 0xC3, 0xC5, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x29, 0x20, 0x1A, 0x3B, 0x9A, 0xE5, 0x73, 0x60 ),
+    BYTES_TO_T_UINT_8( 0xFD, 0x4B, 0x6B, 0x0C, 0x45, 0xB0, 0xFF, 0xC0 ),
+    BYTES_TO_T_UINT_8( 0xB7, 0x87, 0x5F, 0x05, 0xDA, 0x33, 0x31, 0xF5 ),
+    BYTES_TO_T_UINT_8( 0x07, 0x8E, 0x04, 0x43, 0x6F, 0x47, 0xD2, 0x7B ),
+};
+static const mbedtls_ecp_point brainpoolP256r1_T[16] = {
+    ECP_COMB_POINT( brainpoolP256r1, 0 ),
+    ECP_COMB_POINT( brainpoolP256r1, 1 ),
+    ECP_COMB_POINT( brainpoolP256r1, 2 ),
+    ECP_COMB_POINT( brainpoolP256r1, 3 ),
+    ECP_COMB_POINT( brainpoolP256r1, 4 ),
+    ECP_COMB_POINT( brainpoolP256r1, 5 ),
+    ECP_COMB_POINT( brainpoolP256r1, 6 ),
+    ECP_COMB_POINT( brainpoolP256r1, 7 ),
+    ECP_COMB_POINT( brainpoolP256r1, 8 ),
+    ECP_COMB_POINT( brainpoolP256r1, 9 ),
+    ECP_COMB_POINT( brainpoolP256r1, 10 ),
+    ECP_COMB_POINT( brainpoolP256r1, 11 ),
+    ECP_COMB_POINT( brainpoolP256r1, 12 ),
+    ECP_COMB_POINT( brainpoolP256r1, 13 ),
+    ECP_COMB_POINT( brainpoolP256r1, 14 ),
+    ECP_COMB_POINT( brainpoolP256r1, 15 ),
+};
+#endif /* MBEDTLS_ECP_INTERNAL_ALT */
+#endif /* MBEDTLS_ECP_FIXED_POINT_OPTIM */
 #endif /* MBEDTLS_ECP_DP_BP256R1_ENABLED */
 
 /*
@@ -481,6 +2734,465 @@ static const mbedtls_mpi_uint brainpoolP384r1_n[] = {
     BYTES_TO_T_UINT_8( 0xDF, 0x41, 0xE6, 0x50, 0x7E, 0x6F, 0x5D, 0x0F ),
     BYTES_TO_T_UINT_8( 0x28, 0x6D, 0x38, 0xA3, 0x82, 0x1E, 0xB9, 0x8C ),
 };
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+/* The table below is in Montgomery form, see ecp_mont_setup() */
+#define brainpoolP384r1_T    NULL
+#else
+static const mbedtls_mpi_uint brainpoolP384r1_T_xy[] = {
+    /* T[0].X, T[0].Y */
+    BYTES_TO_T_UINT_8( 0xC1, 0xFB, 0x38, 0xD4, 0xEB, 0xDE, 0x89, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0xBF, 0x86, 0xA8, 0xD5, 0xE8, 0x80, 0xFC, 0x66 ),
+    BYTES_TO_T_UINT_8( 0x23, 0x2F, 0x20, 0x9D, 0xE9, 0x78, 0xC3, 0x94 ),
+    BYTES_TO_T_UINT_8( 0x64, 0x21, 0x5C, 0xF9, 0x4E, 0x26, 0x8B, 0x06 ),
+    BYTES_TO_T_UINT_8( 0x99, 0x00, 0xCD, 0xBA, 0xCF, 0x0D, 0xDD, 0x9C ),
+    BYTES_TO_T_UINT_8( 0xC1, 0x3F, 0xF5, 0x88, 0x33, 0x75, 0x00, 0x85 ),
+    BYTES_TO_T_UINT_8( 0xA5, 0x40, 0xE1, 0x0D, 0x31, 0xB3, 0x38, 0xE7 ),
+    BYTES_TO_T_UINT_8( 0x55, 0x6F, 0x99, 0xC7, 0x46, 0xD2, 0xE0, 0xF5 ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x37, 0x07, 0x8F, 0xA3, 0x09, 0x83, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0x17, 0x92, 0x71, 0xD5, 0xD4, 0xAC, 0x80, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0xB6, 0xDD, 0x21, 0x4F, 0x66, 0x25, 0x16, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0xB5, 0x68, 0x89, 0x45, 0x62, 0xA0, 0xF4, 0x2C ),
+    /* T[1].X, T[1].Y */
+    BYTES_TO_T_UINT_8( 0x68, 0x8A, 0xBA, 0xB5, 0xC6, 0xA0, 0x35, 0x6F ),
+    BYTES_TO_T_UINT_8( 0x61, 0xCE, 0xE2, 0x4C, 0x45, 0x05, 0x50, 0x67 ),
+    BYTES_TO_T_UINT_8( 0xD8, 0x50, 0x15, 0x87, 0xC7, 0x4B, 0x19, 0xF1 ),
+    BYTES_TO_T_UINT_8( 0x2D, 0xFF, 0x9E, 0xE3, 0xDF, 0x24, 0x54, 0x53 ),
+    BYTES_TO_T_UINT_8( 0xD3, 0xA3, 0xDB, 0x44, 0xAF, 0xC7, 0x3C, 0xAB ),
+    BYTES_TO_T_UINT_8( 0x13, 0xF4, 0x5B, 0x3E, 0x18, 0x37, 0x8D, 0x61 ),
+    BYTES_TO_T_UINT_8( 0x3A, 0x40, 0xB5, 0xD1, 0x4C, 0xA4, 0xC8, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0x63, 0xC3, 0xF0, 0xC5, 0xED, 0x07, 0x08, 0x60 ),
+    BYTES_TO_T_UINT_8( 0xCB, 0x50, 0xF6, 0xDA, 0xF3, 0x1B, 0x32, 0x39 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0xC0, 0xB2, 0xF5, 0xA3, 0xB3, 0x69, 0x94 ),
+    BYTES_TO_T_UINT_8( 0x6D, 0x7D, 0x6B, 0xA3, 0xDD, 0x64, 0x2B, 0x8F ),
+    BYTES_TO_T_UINT_8( 0x99, 0x3B, 0xA6, 0xC8, 0x59, 0xF1, 0xEE, 0x0A ),
+    /* T[2].X, T[2].Y */
+    BYTES_TO_T_UINT_8( 0x98, 0x88, 0x82, 0x9F, 0x01, 0xD7, 0xE0, 0xEB ),
+    BYTES_TO_T_UINT_8( 0x7C, 0x7C, 0x14, 0xF3, 0x63, 0xED, 0x59, 0x78 ),
+    BYTES_TO_T_UINT_8( 0xB7, 0x48, 0x7C, 0xAA, 0xE1, 0x27, 0x3C, 0xD7 ),
+    BYTES_TO_T_UINT_8( 0xE6, 0x5B, 0xC2, 0xC4, 0x07, 0x2E, 0xB6, 0xC3 ),
+    BYTES_TO_T_UINT_8( 0x74, 0x58, 0x67, 0xE0, 0x8A, 0x48, 0xAC, 0x12 ),
+    BYTES_TO_T_UINT_8( 0x18, 0x37, 0xC8, 0x9E, 0x30, 0x5D, 0xC7, 0x19 ),
+    BYTES_TO_T_UINT_8( 0x7A, 0x26, 0xF3, 0xDE, 0xD4, 0x51, 0x05, 0xD8 ),
+    BYTES_TO_T_UINT_8( 0xAC, 0xFF, 0xF8, 0x0D, 0x02, 0x97, 0xEC, 0x2F ),
+    BYTES_TO_T_UINT_8( 0x2C, 0x9A, 0x76, 0xF9, 0x26, 0xFA, 0x80, 0xFA ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x01, 0xA0, 0xCE, 0x47, 0xAC, 0x4E, 0x7F ),
+    BYTES_TO_T_UINT_8( 0x93, 0x83, 0x1E, 0x1D, 0x17, 0x73, 0xEB, 0xCC ),
+    BYTES_TO_T_UINT_8( 0x99, 0x3C, 0xD2, 0x32, 0x25, 0x0A, 0x7E, 0x58 ),
+    /* T[3].X, T[3].Y */
+    BYTES_TO_T_UINT_8( 0x02, 0x9E, 0xAC, 0x98, 0x49, 0x95, 0xDF, 0x73 ),
+    BYTES_TO_T_UINT_8( 0x87, 0x33, 0x0C, 0xA0, 0x2A, 0x28, 0xF9, 0xF6 ),
+    BYTES_TO_T_UINT_8( 0xEC, 0xE7, 0x57, 0xB5, 0x92, 0x0C, 0xEA, 0x86 ),
+    BYTES_TO_T_UINT_8( 0x32, 0xF6, 0x23, 0xCD, 0x16, 0x8A, 0x9B, 0x87 ),
+    BYTES_TO_T_UINT_8( 0x9B, 0x0A, 0xD9, 0x6D, 0x3E, 0x02, 0x1A, 0x9D ),
+    BYTES_TO_T_UINT_8( 0x34, 0x71, 0x36, 0x38, 0xFA, 0xF6, 0x5E, 0x13 ),
+    BYTES_TO_T_UINT_8( 0x28, 0x47, 0x19, 0x6D, 0x0B, 0x08, 0xB5, 0x16 ),
+    BYTES_TO_T_UINT_8( 0xB4, 0x7C, 0x97, 0x86, 0xEF, 0xF9, 0xAA, 0x4B ),
+    BYTES_TO_T_UINT_8( 0x4E, 0x05, 0xED, 0xA1, 0x5A, 0x93, 0x25, 0x89 ),
+    BYTES_TO_T_UINT_8( 0xA7, 0xAC, 0x74, 0x51, 0x59, 0x56, 0x90, 0x29 ),
+    BYTES_TO_T_UINT_8( 0xFB, 0x6C, 0x47, 0xF6, 0x4B, 0xEF, 0xF3, 0xDC ),
+    BYTES_TO_T_UINT_8( 0x64, 0xBF, 0x09, 0xA0, 0x43, 0x3F, 0x36, 0x36 ),
+    /* T[4].X, T[4].Y */
+    BYTES_TO_T_UINT_8( 0x2C, 0x34, 0x95, 0x72, 0x0F, 0x4B, 0x5B, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x4E, 0x2F, 0x88, 0x56, 0xD9, 0x6F, 0xB9, 0xE5 ),
+    BYTES_TO_T_UINT_8( 0x08, 0xD3, 0xC9, 0xFE, 0x4E, 0xF1, 0x05, 0xE0 ),
+    BYTES_TO_T_UINT_8( 0x94, 0x44, 0xE7, 0xBE, 0x3F, 0x86, 0xE7, 0x24 ),
+    BYTES_TO_T_UINT_8( 0x3D, 0xC8, 0x0F, 0xC6, 0xEC, 0xB1, 0x21, 0x31 ),
+    BYTES_TO_T_UINT_8( 0xFF, 0x3E, 0xD5, 0x49, 0x98, 0x55, 0x60, 0x23 ),
+    BYTES_TO_T_UINT_8( 0x2B, 0xF4, 0x57, 0xFD, 0x1D, 0xFF, 0x77, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0x84, 0x58, 0x1B, 0x5C, 0xE7, 0x21, 0xE2, 0xB8 ),
+    BYTES_TO_T_UINT_8( 0xFF, 0x0E, 0x71, 0x46, 0x09, 0x5A, 0xDF, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x05, 0x3D, 0xAF, 0x84, 0xB4, 0xA8, 0x74, 0xFD ),
+    BYTES_TO_T_UINT_8( 0xB1, 0xFB, 0x7A, 0x51, 0x7A, 0x22, 0xAE, 0x10 ),
+    BYTES_TO_T_UINT_8( 0x4F, 0x6D, 0x92, 0x1F, 0x1C, 0x03, 0xC1, 0x4F ),
+    /* T[5].X, T[5].Y */
+    BYTES_TO_T_UINT_8( 0x8D, 0x82, 0x3A, 0x11, 0xCE, 0xE1, 0xE1, 0xD5 ),
+    BYTES_TO_T_UINT_8( 0xB9, 0xA8, 0x43, 0x1C, 0x8B, 0x27, 0xC7, 0x83 ),
+    BYTES_TO_T_UINT_8( 0x27, 0x70, 0x58, 0xCA, 0x8B, 0x05, 0x17, 0xC7 ),
+    BYTES_TO_T_UINT_8( 0xC7, 0xFB, 0x83, 0xED, 0xEF, 0x6B, 0x53, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x08, 0x20, 0x12, 0xBA, 0x7F, 0x33, 0xE9, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0x4D, 0x43, 0x98, 0xC0, 0x8B, 0x3A, 0xE1, 0x02 ),
+    BYTES_TO_T_UINT_8( 0xE6, 0xDF, 0xA1, 0x97, 0x2D, 0x6A, 0xFA, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0x13, 0x86, 0x15, 0x8F, 0xEF, 0x9B, 0x3F, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x3A, 0x9D, 0xEA, 0x50, 0x44, 0xAE, 0x00, 0xBA ),
+    BYTES_TO_T_UINT_8( 0x8B, 0xAC, 0xF8, 0xA4, 0x5E, 0xDD, 0x26, 0xC3 ),
+    BYTES_TO_T_UINT_8( 0x55, 0x30, 0xBA, 0x6D, 0xE1, 0x3E, 0x91, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0xB2, 0xD0, 0x40, 0x41, 0x8A, 0xA5, 0x40, 0x3B ),
+    /* T[6].X, T[6].Y */
+    BYTES_TO_T_UINT_8( 0x81, 0x88, 0xA2, 0x51, 0x55, 0xF3, 0x55, 0x65 ),
+    BYTES_TO_T_UINT_8( 0xF5, 0x76, 0x35, 0xF3, 0xDD, 0x07, 0x14, 0x65 ),
+    BYTES_TO_T_UINT_8( 0x73, 0x6E, 0x67, 0xCF, 0x55, 0x2E, 0xB7, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x3D, 0x4A, 0x9A, 0xE3, 0x7E, 0x74, 0x5E, 0xA0 ),
+    BYTES_TO_T_UINT_8( 0x6E, 0x20, 0x4A, 0x76, 0xF0, 0x8E, 0x18, 0xA9 ),
+    BYTES_TO_T_UINT_8( 0x41, 0x8F, 0x50, 0xCB, 0x20, 0x14, 0xBF, 0x87 ),
+    BYTES_TO_T_UINT_8( 0x65, 0x75, 0xA8, 0xC1, 0xD0, 0x0F, 0x2D, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0x9D, 0xF0, 0xBB, 0x07, 0x6E, 0x57, 0x06, 0x1C ),
+    BYTES_TO_T_UINT_8( 0x8C, 0x53, 0x22, 0xBB, 0xE7, 0x2B, 0x51, 0x58 ),
+    BYTES_TO_T_UINT_8( 0xEA, 0x0B, 0xCB, 0xDB, 0xA2, 0x8E, 0xEE, 0x31 ),
+    BYTES_TO_T_UINT_8( 0xDB, 0x85, 0x50, 0x2B, 0xD8, 0x90, 0x5C, 0x58 ),
+    BYTES_TO_T_UINT_8( 0x0A, 0x7E, 0x2D, 0xC2, 0x02, 0xDA, 0x01, 0x27 ),
+    /* T[7].X, T[7].Y */
+    BYTES_TO_T_UINT_8( 0x20, 0x76, 0xB2, 0xFF, 0x95, 0x4F, 0x9F, 0x43 ),
+    BYTES_TO_T_UINT_8( 0x76, 0xF8, 0x24, 0x11, 0xEE, 0xBC, 0x4F, 0x16 ),
+    BYTES_TO_T_UINT_8( 0x25, 0xBF, 0x13, 0x2C, 0x23, 0xC6, 0x6A, 0x69 ),
+    BYTES_TO_T_UINT_8( 0xF6, 0xCE, 0x84, 0xBA, 0x00, 0xCC, 0xBB, 0x76 ),
+    BYTES_TO_T_UINT_8( 0x24, 0x1C, 0xF5, 0x52, 0x3E, 0x27, 0x4B, 0x3D ),
+    BYTES_TO_T_UINT_8( 0x2C, 0x75, 0x79, 0xAD, 0x4B, 0x44, 0xF2, 0x61 ),
+    BYTES_TO_T_UINT_8( 0x97, 0xB9, 0xEA, 0x6A, 0x36, 0x41, 0xCC, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0x1E, 0x02, 0xC4, 0x5D, 0x53, 0xB0, 0x61, 0x86 ),
+    BYTES_TO_T_UINT_8( 0x20, 0x96, 0x31, 0x3A, 0x95, 0x6C, 0x88, 0x3D ),
+    BYTES_TO_T_UINT_8( 0xE8, 0x51, 0x36, 0xCB, 0x96, 0x0B, 0x76, 0x75 ),
+    BYTES_TO_T_UINT_8( 0x35, 0xE0, 0xB0, 0xE0, 0x3F, 0xC7, 0xF8, 0xC4 ),
+    BYTES_TO_T_UINT_8( 0xDA, 0x7D, 0x2A, 0x76, 0xEA, 0x40, 0xC9, 0x63 ),
+    /* T[8].X, T[8].Y */
+    BYTES_TO_T_UINT_8( 0x9B, 0x09, 0xA6, 0x1B, 0x9C, 0x44, 0x9B, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0x5E, 0x46, 0x2E, 0x34, 0x5C, 0xD7, 0xC2, 0x0F ),
+    BYTES_TO_T_UINT_8( 0x83, 0xBC, 0xCB, 0x0E, 0x8E, 0xD2, 0xA8, 0x45 ),
+    BYTES_TO_T_UINT_8( 0x12, 0xB0, 0xF9, 0x5D, 0xE0, 0xDF, 0xCA, 0x80 ),
+    BYTES_TO_T_UINT_8( 0x56, 0x5E, 0x75, 0xA7, 0x30, 0x06, 0x74, 0x92 ),
+    BYTES_TO_T_UINT_8( 0xC6, 0x9A, 0x43, 0xFB, 0x94, 0xFA, 0xBE, 0x1B ),
+    BYTES_TO_T_UINT_8( 0x38, 0xE2, 0xC3, 0x32, 0x33, 0x4B, 0xD5, 0xBD ),
+    BYTES_TO_T_UINT_8( 0xC0, 0xAC, 0x26, 0x3F, 0xC4, 0xCE, 0x0E, 0x3F ),
+    BYTES_TO_T_UINT_8( 0xC4, 0x5E, 0xDE, 0x7D, 0xA5, 0x43, 0xB6, 0xEA ),
+    BYTES_TO_T_UINT_8( 0xD7, 0xBB, 0x1B, 0xE6, 0xA0, 0xE9, 0x0F, 0xDE ),
+    BYTES_TO_T_UINT_8( 0x76, 0xBD, 0x44, 0xB2, 0xED, 0x87, 0x36, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0x62, 0x3D, 0x46, 0x4D, 0x5A, 0x28, 0xE2, 0x00 ),
+    /* T[9].X, T[9].Y */
+    BYTES_TO_T_UINT_8( 0x22, 0xE2, 0xCD, 0x91, 0xFA, 0xD9, 0xAB, 0x5B ),
+    BYTES_TO_T_UINT_8( 0x8C, 0xC5, 0x5B, 0x6F, 0xEB, 0xE1, 0xF3, 0xA3 ),
+    BYTES_TO_T_UINT_8( 0x48, 0x54, 0x98, 0xE8, 0xB1, 0xC6, 0x96, 0xE5 ),
+    BYTES_TO_T_UINT_8( 0xC6, 0xD7, 0xF8, 0xA0, 0x35, 0x89, 0x35, 0x6C ),
+    BYTES_TO_T_UINT_8( 0xCF, 0xAF, 0xA0, 0x67, 0x4F, 0x81, 0xAE, 0x94 ),
+    BYTES_TO_T_UINT_8( 0x6B, 0x80, 0xFC, 0x56, 0xB2, 0x60, 0xB4, 0x4F ),
+    BYTES_TO_T_UINT_8( 0xD5, 0x9D, 0xF6, 0x9E, 0x29, 0xF0, 0xC6, 0x5A ),
+    BYTES_TO_T_UINT_8( 0xEF, 0x40, 0x17, 0x58, 0x4B, 0x11, 0xB6, 0xD8 ),
+    BYTES_TO_T_UINT_8( 0x14, 0x86, 0x3D, 0xC5, 0x49, 0x9E, 0xA1, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0x61, 0x46, 0xB4, 0xE7, 0x16, 0x87, 0xC4, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0x22, 0x8B, 0xEA, 0xAA, 0x7D, 0x1D, 0xF7, 0xD0 ),
+    BYTES_TO_T_UINT_8( 0xA7, 0x6E, 0xEE, 0x5E, 0xA4, 0x60, 0x40, 0x42 ),
+    /* T[10].X, T[10].Y */
+    BYTES_TO_T_UINT_8( 0x9A, 0x05, 0x71, 0xA6, 0xE6, 0x1E, 0x80, 0x9B ),
+    BYTES_TO_T_UINT_8( 0xAD, 0x82, 0x6C, 0x2C, 0x18, 0xD8, 0x67, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0xA3, 0x6A, 0x22, 0x0C, 0x1C, 0x63, 0xC8, 0x0F ),
+    BYTES_TO_T_UINT_8( 0x47, 0x92, 0x16, 0xD9, 0xF4, 0x0E, 0xEE, 0x94 ),
+    BYTES_TO_T_UINT_8( 0xD5, 0x80, 0x1D, 0x34, 0x68, 0x67, 0x0E, 0xFF ),
+    BYTES_TO_T_UINT_8( 0xE3, 0xB0, 0xFB, 0x38, 0x59, 0x90, 0x8C, 0x10 ),
+    BYTES_TO_T_UINT_8( 0x44, 0x6A, 0xA2, 0x39, 0x7D, 0xCF, 0x42, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x77, 0x64, 0x1A, 0x57, 0x00, 0x9B, 0xBC ),
+    BYTES_TO_T_UINT_8( 0xE4, 0x63, 0xCA, 0x37, 0x54, 0x6F, 0xFC, 0x13 ),
+    BYTES_TO_T_UINT_8( 0x33, 0x79, 0xB5, 0x35, 0x8E, 0xCC, 0x2A, 0x44 ),
+    BYTES_TO_T_UINT_8( 0xCD, 0xFD, 0xA7, 0xE8, 0xCF, 0x42, 0x2D, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0xEA, 0x93, 0x3E, 0x82, 0x9E, 0x26, 0x55, 0x4A ),
+    /* T[11].X, T[11].Y */
+    BYTES_TO_T_UINT_8( 0xC3, 0x93, 0x1D, 0x66, 0x9B, 0x4B, 0x4D, 0x1C ),
+    BYTES_TO_T_UINT_8( 0xA3, 0xDF, 0x5E, 0xA6, 0x69, 0x29, 0x4B, 0x43 ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x32, 0x91, 0x0F, 0x02, 0xE9, 0x9D, 0x61 ),
+    BYTES_TO_T_UINT_8( 0x65, 0x06, 0x95, 0xF2, 0x51, 0xC6, 0x8C, 0x59 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x91, 0xCB, 0x9D, 0x4D, 0x74, 0x23, 0xF9 ),
+    BYTES_TO_T_UINT_8( 0x65, 0x64, 0xD9, 0x71, 0xDD, 0xB1, 0x94, 0x4E ),
+    BYTES_TO_T_UINT_8( 0x27, 0x9E, 0x67, 0xB0, 0x17, 0x31, 0xAC, 0x5F ),
+    BYTES_TO_T_UINT_8( 0x43, 0x19, 0x1B, 0x16, 0x26, 0xA4, 0x11, 0xAF ),
+    BYTES_TO_T_UINT_8( 0x26, 0xDC, 0x80, 0x21, 0x9E, 0xC7, 0x02, 0x62 ),
+    BYTES_TO_T_UINT_8( 0xF9, 0xD3, 0x80, 0x16, 0x58, 0x19, 0x8C, 0x0A ),
+    BYTES_TO_T_UINT_8( 0x98, 0x69, 0x72, 0xD9, 0xFE, 0x27, 0xDD, 0xB9 ),
+    BYTES_TO_T_UINT_8( 0xC5, 0xC5, 0xBF, 0xCC, 0x8C, 0x59, 0x59, 0x25 ),
+    /* T[12].X, T[12].Y */
+    BYTES_TO_T_UINT_8( 0x6E, 0xF5, 0x56, 0x67, 0x77, 0xFF, 0xC1, 0x87 ),
+    BYTES_TO_T_UINT_8( 0xE6, 0xAA, 0x55, 0x17, 0x13, 0xCC, 0xB8, 0x7D ),
+    BYTES_TO_T_UINT_8( 0x46, 0xD6, 0x16, 0xA8, 0xDD, 0xD6, 0x6E, 0x7F ),
+    BYTES_TO_T_UINT_8( 0xB2, 0x69, 0xD2, 0x48, 0x39, 0x22, 0x5E, 0x72 ),
+    BYTES_TO_T_UINT_8( 0x54, 0xB0, 0x61, 0xE2, 0x17, 0xE7, 0x35, 0x06 ),
+    BYTES_TO_T_UINT_8( 0xC2, 0x0F, 0x83, 0x34, 0x9A, 0x34, 0x0F, 0x87 ),
+    BYTES_TO_T_UINT_8( 0xC6, 0xF5, 0x5F, 0x0D, 0x70, 0x45, 0x90, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0xD2, 0x1E, 0x59, 0x12, 0x85, 0xAE, 0x11, 0xA6 ),
+    BYTES_TO_T_UINT_8( 0x72, 0x48, 0x34, 0xF4, 0x07, 0xF0, 0x57, 0x08 ),
+    BYTES_TO_T_UINT_8( 0x14, 0x32, 0xBE, 0x08, 0xC0, 0x89, 0x38, 0xB1 ),
+    BYTES_TO_T_UINT_8( 0x66, 0xC0, 0xCF, 0x18, 0xA6, 0xD6, 0x8C, 0x45 ),
+    BYTES_TO_T_UINT_8( 0x07, 0x44, 0xA6, 0xA9, 0xC8, 0x51, 0x29, 0x0F ),
+    /* T[13].X, T[13].Y */
+    BYTES_TO_T_UINT_8( 0xDB, 0x5C, 0x52, 0x5A, 0x1C, 0x17, 0x3C, 0x49 ),
+    BYTES_TO_T_UINT_8( 0xE7, 0x34, 0x31, 0x5C, 0x11, 0x77, 0x6F, 0xA6 ),
+    BYTES_TO_T_UINT_8( 0x15, 0x95, 0x1A, 0xE3, 0xCE, 0x4E, 0x87, 0xD0 ),
+    BYTES_TO_T_UINT_8( 0x18, 0x4D, 0xC2, 0x38, 0x71, 0xAC, 0xDD, 0x50 ),
+    BYTES_TO_T_UINT_8( 0x4E, 0xB7, 0xB0, 0x5E, 0x43, 0xCA, 0xE4, 0x13 ),
+    BYTES_TO_T_UINT_8( 0x9D, 0x39, 0x12, 0xCA, 0x1C, 0x7A, 0x65, 0x24 ),
+    BYTES_TO_T_UINT_8( 0x32, 0x6E, 0x0B, 0x62, 0x64, 0xFF, 0x07, 0xD7 ),
+    BYTES_TO_T_UINT_8( 0xFE, 0xB0, 0x4D, 0x38, 0x76, 0xF9, 0xA7, 0x62 ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x6A, 0x87, 0x40, 0x1C, 0x3D, 0xE1, 0xBB ),
+    BYTES_TO_T_UINT_8( 0x07, 0x27, 0xB6, 0x0B, 0xC3, 0xB0, 0x51, 0x5F ),
+    BYTES_TO_T_UINT_8( 0xC3, 0x54, 0xE7, 0xFB, 0xAB, 0x57, 0x94, 0xF1 ),
+    BYTES_TO_T_UINT_8( 0x0A, 0xE1, 0x84, 0xE7, 0xDD, 0x98, 0x97, 0x3F ),
+    /* T[14].X, T[14].Y */
+    BYTES_TO_T_UINT_8( 0x1E, 0xD4, 0xDD, 0xC3, 0x0F, 0x54, 0x85, 0x69 ),
+    BYTES_TO_T_UINT_8( 0x4E, 0x5A, 0xD3, 0xFB, 0x47, 0x71, 0x59, 0x0F ),
+    BYTES_TO_T_UINT_8( 0xAD, 0x72, 0x6E, 0x42, 0x53, 0xC3, 0xF3, 0x0C ),
+    BYTES_TO_T_UINT_8( 0x14, 0x58, 0xE1, 0x34, 0xA9, 0x27, 0x00, 0xD1 ),
+    BYTES_TO_T_UINT_8( 0xB2, 0xD4, 0x3C, 0xDA, 0x0E, 0x5F, 0x7A, 0x63 ),
+    BYTES_TO_T_UINT_8( 0xB9, 0xED, 0xBD, 0x7F, 0xA7, 0xB7, 0x5D, 0x5F ),
+    BYTES_TO_T_UINT_8( 0x00, 0x35, 0xEB, 0x60, 0xF0, 0x3C, 0xEF, 0xCE ),
+    BYTES_TO_T_UINT_8( 0x68, 0xF5, 0x42, 0x24, 0x37, 0x4E, 0xC4, 0xED ),
+    BYTES_TO_T_UINT_8( 0x13, 0x73, 0x3E, 0x8D, 0xBF, 0x36, 0x25, 0x33 ),
+    BYTES_TO_T_UINT_8( 0x46, 0x04, 0x68, 0x5E, 0x49, 0xED, 0x79, 0x46 ),
+    BYTES_TO_T_UINT_8( 0x48, 0xC1, 0x17, 0x46, 0xFE, 0xE1, 0xD0, 0x37 ),
+    BYTES_TO_T_UINT_8( 0x2C, 0xD8, 0xFF, 0xA3, 0xD8, 0x8C, 0x6F, 0x55 ),
+    /* T[15].X, T[15].Y */
+    BYTES_TO_T_UINT_8( 0xEE, 0x47, 0x45, 0x55, 0xE3, 0x18, 0x85, 0x1E ),
+    BYTES_TO_T_UINT_8( 0x91, 0x52, 0x5B, 0x7E, 0xF9, 0xEA, 0x2F, 0x6A ),
+    BYTES_TO_T_UINT_8( 0xC0, 0xCF, 0x54, 0xF2, 0x36, 0xFC, 0xF8, 0xD5 ),
+    BYTES_TO_T_UINT_8( 0xBE, 0x2B, 0x7D, 0x74, 0x14, 0xC2, 0xE4, 0xDF ),
+    BYTES_TO_T_UINT_8( 0xBD, 0xBB, 0xC2, 0xC2, 0x0B, 0xEF, 0x73, 0xB4 ),
+    BYTES_TO_T_UINT_8( 0xAD, 0x2C, 0xA7, 0xC2, 0x37, 0x9B, 0xAF, 0x43 ),
+    BYTES_TO_T_UINT_8( 0xCB, 0x55, 0x74, 0x8C, 0x24, 0x06, 0xB4, 0xBA ),
+    BYTES_TO_T_UINT_8( 0x25, 0x7B, 0xB5, 0x9E, 0xB0, 0xDD, 0x7E, 0x05 ),
+    BYTES_TO_T_UINT_8( 0xDA, 0x17, 0xCF, 0xF3, 0x0B, 0x23, 0x1B, 0x32 ),
+    BYTES_TO_T_UINT_8( 0x54, 0x6B, 0xC3, 0xB7, 0x39, 0xC8, 0xFB, 0xDE ),
+    BYTES_TO_T_UINT_8( 0x41, 0x24, 0x0C, 0x76, 0xF5, 0xCF, 0x37, 0xFD ),
+    BYTES_TO_T_UINT_8( 0xCE, 0x71, 0x62, 0x13, 0xE8, 0x5E, 0xF0, 0x26 ),
+    /* T[16].X, T[16].Y */
+    BYTES_TO_T_UINT_8( 0xB3, 0x11, 0xA6, 0x4E, 0x08, 0x9D, 0x32, 0xB0 ),
+    BYTES_TO_T_UINT_8( 0x49, 0xF7, 0x53, 0x31, 0x9D, 0x2B, 0xE8, 0xA9 ),
+    BYTES_TO_T_UINT_8( 0xF0, 0xFD, 0xCF, 0xBB, 0x2F, 0xFC, 0x1A, 0x86 ),
+    BYTES_TO_T_UINT_8( 0x0B, 0x55, 0x48, 0x00, 0xEF, 0x5B, 0xCC, 0xD2 ),
+    BYTES_TO_T_UINT_8( 0x9A, 0xE9, 0x5C, 0x0D, 0x10, 0x04, 0xF9, 0xBC ),
+    BYTES_TO_T_UINT_8( 0x4B, 0x63, 0x32, 0x0C, 0x7A, 0x89, 0x3C, 0x50 ),
+    BYTES_TO_T_UINT_8( 0x22, 0xD2, 0x05, 0x2D, 0xAE, 0x05, 0x04, 0xE9 ),
+    BYTES_TO_T_UINT_8( 0xAD, 0x25, 0x07, 0xB4, 0x10, 0x0A, 0x50, 0xDF ),
+    BYTES_TO_T_UINT_8( 0xC5, 0x48, 0x01, 0xE1, 0xB7, 0xA1, 0x90, 0x99 ),
+    BYTES_TO_T_UINT_8( 0xF1, 0x74, 0x7D, 0xEE, 0x7B, 0x37, 0xAE, 0x6A ),
+    BYTES_TO_T_UINT_8( 0x98, 0x9C, 0x3E, 0x61, 0x84, 0xD2, 0x18, 0x68 ),
+    BYTES_TO_T_UINT_8( 0x44, 0x10, 0x6E, 0x1E, 0xA2, 0x8A, 0x07, 0x02 ),
+    /* T[17].X, T[17].Y */
+    BYTES_TO_T_UINT_8( 0xD6, 0x58, 0x86, 0xF7, 0xE6, 0xAE, 0x21, 0x15 ),
+    BYTES_TO_T_UINT_8( 0x6F, 0x55, 0x64, 0x73, 0x55, 0xF2, 0xF6, 0xDE ),
+    BYTES_TO_T_UINT_8( 0x41, 0x70, 0x2E, 0xAF, 0xB3, 0xD7, 0x06, 0x06 ),
+    BYTES_TO_T_UINT_8( 0x80, 0x9E, 0x2A, 0xBA, 0x26, 0xFF, 0x2B, 0xD1 ),
+    BYTES_TO_T_UINT_8( 0x66, 0xF9, 0xB6, 0x76, 0x7A, 0x11, 0x4C, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x1A, 0xB3, 0xD8, 0x4E, 0x38, 0x51, 0x59, 0x66 ),
+    BYTES_TO_T_UINT_8( 0x76, 0x6C, 0x8D, 0x33, 0x9D, 0xEF, 0xBF, 0x66 ),
+    BYTES_TO_T_UINT_8( 0x5A, 0x5D, 0xE5, 0x87, 0x17, 0xFD, 0xAE, 0xEC ),
+    BYTES_TO_T_UINT_8( 0xD2, 0xE0, 0x5C, 0x22, 0xC4, 0x7D, 0xDE, 0x14 ),
+    BYTES_TO_T_UINT_8( 0x04, 0x7B, 0x48, 0x31, 0x30, 0x4E, 0xC2, 0x70 ),
+    BYTES_TO_T_UINT_8( 0x57, 0x02, 0xDA, 0x2C, 0x78, 0x6D, 0x83, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0x96, 0x49, 0xD3, 0xB5, 0xBE, 0xF4, 0x56, 0x76 ),
+    /* T[18].X, T[18].Y */
+    BYTES_TO_T_UINT_8( 0x1A, 0x0C, 0xC1, 0xAE, 0x3B, 0xB2, 0xA4, 0x06 ),
+    BYTES_TO_T_UINT_8( 0x37, 0xFA, 0x83, 0xDF, 0x05, 0x3A, 0xD3, 0xF9 ),
+    BYTES_TO_T_UINT_8( 0x09, 0x45, 0x56, 0xC1, 0xB1, 0xE2, 0x05, 0x08 ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x1C, 0x1E, 0xC8, 0x41, 0x55, 0xB0, 0x19 ),
+    BYTES_TO_T_UINT_8( 0x92, 0x40, 0xE4, 0xB3, 0xA8, 0xD0, 0xDE, 0xCB ),
+    BYTES_TO_T_UINT_8( 0x5D, 0x97, 0xF6, 0x0A, 0xB4, 0x45, 0x0F, 0x68 ),
+    BYTES_TO_T_UINT_8( 0xAD, 0x2D, 0x46, 0x08, 0x6D, 0x08, 0x52, 0x8C ),
+    BYTES_TO_T_UINT_8( 0xC5, 0x33, 0xD4, 0x58, 0xAC, 0xFF, 0xE2, 0xF3 ),
+    BYTES_TO_T_UINT_8( 0x0B, 0x6A, 0xE6, 0xAF, 0x44, 0x5B, 0x56, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0x2F, 0x79, 0x04, 0x12, 0x2C, 0xF4, 0x7F, 0x67 ),
+    BYTES_TO_T_UINT_8( 0x92, 0x75, 0x6B, 0x67, 0x3E, 0xC5, 0x51, 0x93 ),
+    BYTES_TO_T_UINT_8( 0xF7, 0xFC, 0x0B, 0xF2, 0x72, 0x1F, 0x5A, 0x0A ),
+    /* T[19].X, T[19].Y */
+    BYTES_TO_T_UINT_8( 0x5F, 0x51, 0x35, 0xAD, 0x32, 0x6A, 0x39, 0x41 ),
+    BYTES_TO_T_UINT_8( 0xDD, 0x50, 0xFF, 0x0C, 0xCA, 0x10, 0xDA, 0x2A ),
+    BYTES_TO_T_UINT_8( 0x82, 0xAF, 0x60, 0xAD, 0xB2, 0x38, 0xC0, 0xF2 ),
+    BYTES_TO_T_UINT_8( 0x54, 0x94, 0xF5, 0x61, 0x0D, 0x55, 0x3B, 0x5F ),
+    BYTES_TO_T_UINT_8( 0x82, 0x9A, 0x5B, 0xE9, 0x0C, 0xD6, 0x1A, 0xFB ),
+    BYTES_TO_T_UINT_8( 0xE3, 0x23, 0xEB, 0x7E, 0xF5, 0x6F, 0xC6, 0x60 ),
+    BYTES_TO_T_UINT_8( 0x04, 0xE7, 0x9F, 0xB9, 0x5D, 0x19, 0x5A, 0x0F ),
+    BYTES_TO_T_UINT_8( 0x5D, 0x2D, 0xB0, 0xB3, 0x94, 0xEA, 0xC9, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0xC2, 0x56, 0x78, 0x61, 0x43, 0x08, 0xBE, 0x60 ),
+    BYTES_TO_T_UINT_8( 0x95, 0xB7, 0x00, 0x97, 0x1E, 0xEF, 0x58, 0xBB ),
+    BYTES_TO_T_UINT_8( 0x5D, 0x7A, 0x38, 0x37, 0x4F, 0x21, 0x61, 0xC1 ),
+    BYTES_TO_T_UINT_8( 0xC9, 0xA7, 0x6F, 0xD9, 0x4C, 0xB4, 0x2E, 0x4E ),
+    /* T[20].X, T[20].Y */
+    BYTES_TO_T_UINT_8( 0xB2, 0xED, 0x46, 0x0C, 0xD9, 0x21, 0x61, 0x3C ),
+    BYTES_TO_T_UINT_8( 0x11, 0xDA, 0x12, 0x8D, 0x43, 0x2E, 0x5E, 0x91 ),
+    BYTES_TO_T_UINT_8( 0x2E, 0xE3, 0x77, 0xAF, 0x9E, 0xC6, 0xAB, 0x18 ),
+    BYTES_TO_T_UINT_8( 0x47, 0x03, 0x46, 0x3E, 0x7D, 0x4C, 0xD5, 0x19 ),
+    BYTES_TO_T_UINT_8( 0x4A, 0x0A, 0x24, 0xD0, 0x9A, 0x0B, 0xAD, 0xC1 ),
+    BYTES_TO_T_UINT_8( 0x5E, 0xF8, 0x7F, 0xF5, 0x5C, 0x0F, 0x2C, 0x57 ),
+    BYTES_TO_T_UINT_8( 0xE8, 0xD7, 0x3B, 0xFD, 0xAF, 0x65, 0xA2, 0x0C ),
+    BYTES_TO_T_UINT_8( 0xA8, 0x15, 0x99, 0x07, 0x52, 0x91, 0xFF, 0x9F ),
+    BYTES_TO_T_UINT_8( 0x72, 0xC3, 0x90, 0xD3, 0x0E, 0xFD, 0xAD, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0x20, 0x10, 0x18, 0x9A, 0xBF, 0x36, 0x02, 0x27 ),
+    BYTES_TO_T_UINT_8( 0xF9, 0xDA, 0xE6, 0xCE, 0xD6, 0xA3, 0xAF, 0x39 ),
+    BYTES_TO_T_UINT_8( 0xA5, 0x51, 0x94, 0x94, 0x62, 0x1F, 0x58, 0x5D ),
+    /* T[21].X, T[21].Y */
+    BYTES_TO_T_UINT_8( 0x7C, 0xA3, 0x39, 0x9E, 0xD4, 0xB8, 0xB6, 0xA9 ),
+    BYTES_TO_T_UINT_8( 0x66, 0x2F, 0x62, 0xF5, 0x97, 0x6F, 0xD5, 0x49 ),
+    BYTES_TO_T_UINT_8( 0x6B, 0xA2, 0xDC, 0xE9, 0xE9, 0x3D, 0xBC, 0x87 ),
+    BYTES_TO_T_UINT_8( 0xF7, 0xEB, 0x61, 0xF6, 0xA9, 0x8F, 0x54, 0xE3 ),
+    BYTES_TO_T_UINT_8( 0x4A, 0x5F, 0x4D, 0xFD, 0xED, 0xA2, 0x1B, 0xFE ),
+    BYTES_TO_T_UINT_8( 0x76, 0x43, 0x9C, 0xD1, 0xA0, 0xD1, 0xC4, 0x58 ),
+    BYTES_TO_T_UINT_8( 0x97, 0x9B, 0xCE, 0x0E, 0xE3, 0xB5, 0xC7, 0xF4 ),
+    BYTES_TO_T_UINT_8( 0xBD, 0x44, 0x17, 0xB6, 0xDE, 0xC7, 0xFD, 0xB0 ),
+    BYTES_TO_T_UINT_8( 0x0C, 0xEB, 0xBF, 0xFB, 0x9F, 0x14, 0x80, 0xEC ),
+    BYTES_TO_T_UINT_8( 0x88, 0x71, 0xFE, 0xCB, 0xB7, 0x1B, 0xAD, 0x84 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0x55, 0xBA, 0xB3, 0xDF, 0xB1, 0x75, 0x84 ),
+    BYTES_TO_T_UINT_8( 0x32, 0xBA, 0xCF, 0xBC, 0x2A, 0xAD, 0x13, 0x17 ),
+    /* T[22].X, T[22].Y */
+    BYTES_TO_T_UINT_8( 0x74, 0x32, 0xA7, 0xE0, 0x8C, 0x6A, 0x74, 0x4E ),
+    BYTES_TO_T_UINT_8( 0xF2, 0x58, 0xCA, 0xEC, 0x84, 0x97, 0x93, 0x77 ),
+    BYTES_TO_T_UINT_8( 0x29, 0x51, 0x8F, 0xB2, 0x87, 0xEE, 0x6D, 0x4B ),
+    BYTES_TO_T_UINT_8( 0x1E, 0xDB, 0x9D, 0xC4, 0x9A, 0x31, 0xD5, 0x51 ),
+    BYTES_TO_T_UINT_8( 0xB2, 0xB1, 0x4D, 0x3C, 0x13, 0x68, 0xE5, 0x61 ),
+    BYTES_TO_T_UINT_8( 0xBF, 0x03, 0x71, 0x61, 0xED, 0xA1, 0xBA, 0x7A ),
+    BYTES_TO_T_UINT_8( 0xE3, 0x3B, 0x20, 0x00, 0x3F, 0x49, 0xAE, 0xBB ),
+    BYTES_TO_T_UINT_8( 0x94, 0x97, 0xD9, 0x82, 0xB6, 0xBB, 0x65, 0x6D ),
+    BYTES_TO_T_UINT_8( 0xAB, 0xFB, 0x9B, 0x90, 0x3B, 0xFF, 0xCF, 0xEE ),
+    BYTES_TO_T_UINT_8( 0x95, 0x21, 0xDB, 0xFA, 0x30, 0x57, 0x28, 0xAB ),
+    BYTES_TO_T_UINT_8( 0xF6, 0xC4, 0x09, 0x38, 0xCB, 0xE7, 0x08, 0x85 ),
+    BYTES_TO_T_UINT_8( 0xBC, 0xC1, 0xD1, 0xDF, 0x71, 0xBD, 0xB4, 0x04 ),
+    /* T[23].X, T[23].Y */
+    BYTES_TO_T_UINT_8( 0x66, 0xEA, 0x69, 0xC0, 0x8D, 0x5F, 0x12, 0xAE ),
+    BYTES_TO_T_UINT_8( 0x82, 0x8A, 0xE8, 0x01, 0x30, 0x34, 0x90, 0x62 ),
+    BYTES_TO_T_UINT_8( 0x53, 0x39, 0xD5, 0x4B, 0xE9, 0x61, 0xF9, 0x98 ),
+    BYTES_TO_T_UINT_8( 0x09, 0xEA, 0x76, 0xF9, 0xAF, 0xE8, 0x4D, 0x8F ),
+    BYTES_TO_T_UINT_8( 0x34, 0xD9, 0xD5, 0xA2, 0x15, 0x4E, 0xC9, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x01, 0xF5, 0xBE, 0xE9, 0xC7, 0x2F, 0x8A, 0x63 ),
+    BYTES_TO_T_UINT_8( 0x53, 0x19, 0xFD, 0xC5, 0x31, 0xE3, 0x15, 0x1F ),
+    BYTES_TO_T_UINT_8( 0x98, 0xD5, 0x62, 0x10, 0xE0, 0x59, 0xA9, 0x2E ),
+    BYTES_TO_T_UINT_8( 0x3E, 0x29, 0xAA, 0xD6, 0xB5, 0xF9, 0xA4, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0x3E, 0x1B, 0x31, 0xE5, 0xDF, 0xEA, 0xFF, 0x0C ),
+    BYTES_TO_T_UINT_8( 0xDC, 0xC8, 0x70, 0x83, 0xE8, 0xB0, 0x75, 0x91 ),
+    BYTES_TO_T_UINT_8( 0x79, 0xE2, 0xC2, 0xA2, 0xF5, 0xAD, 0xC9, 0x01 ),
+    /* T[24].X, T[24].Y */
+    BYTES_TO_T_UINT_8( 0x74, 0x7A, 0x78, 0x45, 0x18, 0x1E, 0x68, 0x55 ),
+    BYTES_TO_T_UINT_8( 0x52, 0xE3, 0x7B, 0x2F, 0xE2, 0xF6, 0x01, 0xA0 ),
+    BYTES_TO_T_UINT_8( 0x7F, 0xC7, 0xA8, 0x72, 0xE9, 0x69, 0x94, 0xB8 ),
+    BYTES_TO_T_UINT_8( 0xC0, 0x97, 0x7A, 0xFD, 0x52, 0x59, 0x1F, 0xC4 ),
+    BYTES_TO_T_UINT_8( 0x81, 0x94, 0xEB, 0x15, 0x0F, 0x48, 0xE1, 0x3D ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x1D, 0x61, 0x43, 0x9C, 0x3E, 0x39, 0x32 ),
+    BYTES_TO_T_UINT_8( 0xC7, 0x9F, 0xC2, 0x89, 0x11, 0x64, 0x9F, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x3F, 0x9D, 0x8E, 0xF6, 0xC0, 0xC6, 0x69, 0x95 ),
+    BYTES_TO_T_UINT_8( 0x12, 0x68, 0xC5, 0x08, 0xDF, 0x98, 0x0C, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x04, 0x3D, 0xF7, 0x2A, 0xCB, 0x73, 0x75 ),
+    BYTES_TO_T_UINT_8( 0xC4, 0x43, 0xB7, 0x5A, 0xE9, 0xA9, 0x68, 0xC1 ),
+    BYTES_TO_T_UINT_8( 0x7B, 0x48, 0xB3, 0x23, 0xA2, 0x85, 0x0D, 0x75 ),
+    /* T[25].X, T[25].Y */
+    BYTES_TO_T_UINT_8( 0x78, 0xEB, 0xA7, 0x35, 0x11, 0x18, 0xB8, 0x2F ),
+    BYTES_TO_T_UINT_8( 0x5D, 0x70, 0x2B, 0xB1, 0xC7, 0x17, 0x28, 0xE0 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0xD0, 0x96, 0x66, 0x02, 0xDA, 0x2B, 0x7E ),
+    BYTES_TO_T_UINT_8( 0x32, 0xB4, 0xEE, 0x55, 0xB4, 0x94, 0xF6, 0x7B ),
+    BYTES_TO_T_UINT_8( 0x43, 0x25, 0xA1, 0x79, 0xBA, 0x66, 0xC5, 0x8D ),
+    BYTES_TO_T_UINT_8( 0x79, 0x1F, 0x4C, 0x54, 0x4E, 0x54, 0x7F, 0x66 ),
+    BYTES_TO_T_UINT_8( 0xCB, 0x35, 0xDB, 0x02, 0xDC, 0xE8, 0x88, 0x0F ),
+    BYTES_TO_T_UINT_8( 0x39, 0x66, 0x45, 0x77, 0xC4, 0x42, 0xA9, 0xFD ),
+    BYTES_TO_T_UINT_8( 0x83, 0x72, 0xF2, 0xC1, 0xC5, 0xD9, 0x12, 0xC4 ),
+    BYTES_TO_T_UINT_8( 0xF1, 0x53, 0x10, 0xBD, 0x96, 0xB8, 0x9B, 0xDF ),
+    BYTES_TO_T_UINT_8( 0xD4, 0xFE, 0x84, 0x63, 0x66, 0xE0, 0x36, 0x81 ),
+    BYTES_TO_T_UINT_8( 0x40, 0x78, 0xD6, 0xBB, 0x8A, 0xEA, 0xC4, 0x39 ),
+    /* T[26].X, T[26].Y */
+    BYTES_TO_T_UINT_8( 0x72, 0xC0, 0x7F, 0x62, 0x75, 0x05, 0xB6, 0x1E ),
+    BYTES_TO_T_UINT_8( 0xEA, 0xC0, 0x5B, 0x91, 0x5A, 0xA1, 0x64, 0x69 ),
+    BYTES_TO_T_UINT_8( 0x72, 0x78, 0x8F, 0x40, 0x1D, 0x9D, 0x1F, 0x11 ),
+    BYTES_TO_T_UINT_8( 0x13, 0xF5, 0x0C, 0x63, 0xAA, 0x69, 0x52, 0xE2 ),
+    BYTES_TO_T_UINT_8( 0x82, 0xB0, 0x7D, 0xF4, 0xA2, 0x30, 0x02, 0x95 ),
+    BYTES_TO_T_UINT_8( 0xA4, 0xED, 0xD5, 0x64, 0xE1, 0x43, 0xBA, 0x0B ),
+    BYTES_TO_T_UINT_8( 0x60, 0x63, 0x33, 0xAB, 0x07, 0xA9, 0x61, 0xD7 ),
+    BYTES_TO_T_UINT_8( 0x54, 0x95, 0x26, 0xD8, 0x00, 0x94, 0xAF, 0xDF ),
+    BYTES_TO_T_UINT_8( 0x35, 0xBE, 0x4D, 0x54, 0x1D, 0xF8, 0xAE, 0x2A ),
+    BYTES_TO_T_UINT_8( 0x24, 0xFB, 0x45, 0x26, 0xB5, 0x0B, 0xAF, 0x1F ),
+    BYTES_TO_T_UINT_8( 0x26, 0x9B, 0xB5, 0x74, 0xE4, 0x71, 0x0F, 0x2A ),
+    BYTES_TO_T_UINT_8( 0xBA, 0xA2, 0xBE, 0xB1, 0xF8, 0x91, 0xE8, 0x5A ),
+    /* T[27].X, T[27].Y */
+    BYTES_TO_T_UINT_8( 0x65, 0x75, 0xE7, 0x71, 0xC7, 0x42, 0x90, 0x3C ),
+    BYTES_TO_T_UINT_8( 0xA3, 0x05, 0x76, 0x73, 0x3D, 0x48, 0x29, 0x44 ),
+    BYTES_TO_T_UINT_8( 0x52, 0x0B, 0xCD, 0xA3, 0x23, 0xE0, 0x76, 0x05 ),
+    BYTES_TO_T_UINT_8( 0xEA, 0x08, 0xD5, 0x00, 0x50, 0xA4, 0x4F, 0xC4 ),
+    BYTES_TO_T_UINT_8( 0x72, 0xDD, 0x00, 0x44, 0xA2, 0xB8, 0xE0, 0xA9 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x17, 0xAC, 0x6F, 0x71, 0x87, 0xDC, 0x66 ),
+    BYTES_TO_T_UINT_8( 0x64, 0xFE, 0x87, 0xCA, 0x0B, 0x5B, 0x24, 0x77 ),
+    BYTES_TO_T_UINT_8( 0xDA, 0xD4, 0x47, 0x03, 0x05, 0x94, 0xD0, 0xB6 ),
+    BYTES_TO_T_UINT_8( 0xEF, 0xD5, 0xF1, 0xC7, 0x28, 0x78, 0xA5, 0xDF ),
+    BYTES_TO_T_UINT_8( 0x00, 0xA9, 0xC8, 0x27, 0x6F, 0xDE, 0x1E, 0x57 ),
+    BYTES_TO_T_UINT_8( 0x0C, 0x42, 0xA6, 0xF3, 0xEF, 0x3E, 0x93, 0xAF ),
+    BYTES_TO_T_UINT_8( 0xE2, 0x56, 0xC2, 0x5C, 0x2E, 0x82, 0x43, 0x22 ),
+    /* T[28].X, T[28].Y */
+    BYTES_TO_T_UINT_8( 0x91, 0x40, 0x5C, 0xC8, 0x16, 0x27, 0x4B, 0xBA ),
+    BYTES_TO_T_UINT_8( 0xD6, 0xCB, 0xB5, 0xC8, 0x98, 0x59, 0xD2, 0x40 ),
+    BYTES_TO_T_UINT_8( 0x58, 0xD6, 0x69, 0x47, 0x77, 0x4C, 0xFB, 0x34 ),
+    BYTES_TO_T_UINT_8( 0xC2, 0xAE, 0x07, 0xFF, 0x70, 0x5D, 0x04, 0x6D ),
+    BYTES_TO_T_UINT_8( 0x89, 0xDB, 0xDC, 0xC3, 0xDA, 0x36, 0x0B, 0xF1 ),
+    BYTES_TO_T_UINT_8( 0xB1, 0xED, 0xE2, 0x6E, 0x9B, 0x62, 0xBA, 0x2B ),
+    BYTES_TO_T_UINT_8( 0x35, 0xC8, 0xD6, 0x15, 0x9B, 0x76, 0xF4, 0xD5 ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x78, 0xFB, 0x08, 0x5D, 0x10, 0x68, 0xC0 ),
+    BYTES_TO_T_UINT_8( 0x86, 0xE3, 0x9A, 0xE8, 0xF6, 0xD5, 0xB9, 0x1F ),
+    BYTES_TO_T_UINT_8( 0xAB, 0xC6, 0xD5, 0x8A, 0xCD, 0xE9, 0x21, 0x5A ),
+    BYTES_TO_T_UINT_8( 0xA1, 0x5C, 0x82, 0x54, 0xD2, 0x6D, 0x00, 0xCA ),
+    BYTES_TO_T_UINT_8( 0x68, 0x44, 0xCB, 0xA2, 0xDB, 0x84, 0x29, 0x8C ),
+    /* T[29].X, T[29].Y */
+    BYTES_TO_T_UINT_8( 0xED, 0x51, 0xBD, 0xEB, 0x70, 0x94, 0x34, 0x1B ),
+    BYTES_TO_T_UINT_8( 0x0C, 0xA4, 0x09, 0x46, 0x38, 0x6D, 0xF5, 0x71 ),
+    BYTES_TO_T_UINT_8( 0x5B, 0xE5, 0x07, 0xE2, 0x7E, 0xFE, 0xCE, 0xEA ),
+    BYTES_TO_T_UINT_8( 0xE2, 0xB1, 0x2A, 0x29, 0xCA, 0x6B, 0xCD, 0xB8 ),
+    BYTES_TO_T_UINT_8( 0xB5, 0x47, 0xEC, 0x2E, 0xA2, 0x0E, 0x82, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0x30, 0x56, 0x95, 0x32, 0x94, 0x26, 0x64, 0x2D ),
+    BYTES_TO_T_UINT_8( 0x40, 0x85, 0xF7, 0x48, 0xAD, 0x42, 0xD1, 0xA0 ),
+    BYTES_TO_T_UINT_8( 0xDE, 0x99, 0xA5, 0x6C, 0xD6, 0xDD, 0xF7, 0x9A ),
+    BYTES_TO_T_UINT_8( 0xF1, 0x6D, 0x3D, 0x61, 0x25, 0x7F, 0x2A, 0x20 ),
+    BYTES_TO_T_UINT_8( 0xEB, 0x72, 0x51, 0xE0, 0x20, 0x81, 0xD4, 0xE7 ),
+    BYTES_TO_T_UINT_8( 0x72, 0x32, 0x54, 0xCF, 0x37, 0x09, 0x1B, 0x02 ),
+    BYTES_TO_T_UINT_8( 0x71, 0x22, 0x2D, 0x42, 0xA2, 0x74, 0x0B, 0x4C ),
+    /* T[30].X, T[30].Y */
+    BYTES_TO_T_UINT_8( 0x5E, 0x5C, 0xFE, 0xD6, 0x49, 0x64, 0x98, 0x0E ),
+    BYTES_TO_T_UINT_8( 0x95, 0xAF, 0x72, 0xAB, 0xDF, 0xCE, 0x88, 0xE6 ),
+    BYTES_TO_T_UINT_8( 0xAA, 0x01, 0x42, 0xF3, 0x07, 0xD2, 0x34, 0x94 ),
+    BYTES_TO_T_UINT_8( 0xF7, 0xE4, 0xB9, 0x8F, 0x27, 0x8E, 0x22, 0x2F ),
+    BYTES_TO_T_UINT_8( 0x0B, 0x42, 0x24, 0xCE, 0xAC, 0x86, 0xF4, 0x98 ),
+    BYTES_TO_T_UINT_8( 0x3E, 0x9D, 0x3F, 0x59, 0x88, 0x13, 0xA5, 0x07 ),
+    BYTES_TO_T_UINT_8( 0xC5, 0x38, 0xA4, 0x08, 0x0B, 0x8C, 0x11, 0x54 ),
+    BYTES_TO_T_UINT_8( 0x89, 0x5D, 0xAC, 0x90, 0x8C, 0x75, 0xE2, 0x0F ),
+    BYTES_TO_T_UINT_8( 0x14, 0x52, 0xD9, 0x4C, 0x17, 0xFD, 0xB2, 0xC0 ),
+    BYTES_TO_T_UINT_8( 0x77, 0x14, 0x58, 0xBE, 0x29, 0xED, 0x16, 0xDA ),
+    BYTES_TO_T_UINT_8( 0xEF, 0xF7, 0x4D, 0x77, 0xE5, 0x51, 0x98, 0x76 ),
+    BYTES_TO_T_UINT_8( 0x79, 0xE8, 0x4B, 0x62, 0x49, 0x72, 0x67, 0x01 ),
+    /* T[31].X, T[31].Y */
+    BYTES_TO_T_UINT_8( 0xE2, 0x95, 0xE3, 0xD2, 0x8E, 0xC9, 0xAE, 0xB0 ),
+    BYTES_TO_T_UINT_8( 0x72, 0xA3, 0x53, 0xAA, 0x81, 0xCC, 0x2B, 0x57 ),
+    BYTES_TO_T_UINT_8( 0xF9, 0xE8, 0xD4, 0x72, 0x51, 0xD1, 0x94, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0xD5, 0xE4, 0xAF, 0xDD, 0x0E, 0x2B, 0x65, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0x69, 0x23, 0x7C, 0xE4, 0x9C, 0xFC, 0xEE ),
+    BYTES_TO_T_UINT_8( 0x03, 0xF3, 0x6F, 0xA6, 0x4E, 0xA5, 0x83, 0x41 ),
+    BYTES_TO_T_UINT_8( 0x74, 0x7D, 0x99, 0xDD, 0x0F, 0x96, 0x37, 0xDF ),
+    BYTES_TO_T_UINT_8( 0x98, 0x47, 0x16, 0xD8, 0x48, 0x95, 0xD2, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0xB0, 0xC8, 0x03, 0xF0, 0x87, 0xF4, 0x94, 0xBE ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x79, 0xB6, 0x30, 0xE4, 0x43, 0x7A, 0xDC ),
+    BYTES_TO_T_UINT_8( 0x50, 0x1A, 0xE9, 0x61, 0xED, 0x94, 0xEC, 0xE0 ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x05, 0xEA, 0xF0, 0x2C, 0x20, 0x50, 0x3E ),
+};
+static const mbedtls_ecp_point brainpoolP384r1_T[32] = {
+    ECP_COMB_POINT( brainpoolP384r1, 0 ),
+    ECP_COMB_POINT( brainpoolP384r1, 1 ),
+    ECP_COMB_POINT( brainpoolP384r1, 2 ),
+    ECP_COMB_POINT( brainpoolP384r1, 3 ),
+    ECP_COMB_POINT( brainpoolP384r1, 4 ),
+    ECP_COMB_POINT( brainpoolP384r1, 5 ),
+    ECP_COMB_POINT( brainpoolP384r1, 6 ),
+    ECP_COMB_POINT( brainpoolP384r1, 7 ),
+    ECP_COMB_POINT( brainpoolP384r1, 8 ),
+    ECP_COMB_POINT( brainpoolP384r1, 9 ),
+    ECP_COMB_POINT( brainpoolP384r1, 10 ),
+    ECP_COMB_POINT( brainpoolP384r1, 11 ),
+    ECP_COMB_POINT( brainpoolP384r1, 12 ),
+    ECP_COMB_POINT( brainpoolP384r1, 13 ),
+    ECP_COMB_POINT( brainpoolP384r1, 14 ),
+    ECP_COMB_POINT( brainpoolP384r1, 15 ),
+    ECP_COMB_POINT( brainpoolP384r1, 16 ),
+    ECP_COMB_POINT( brainpoolP384r1, 17 ),
+    ECP_COMB_POINT( brainpoolP384r1, 18 ),
+    ECP_COMB_POINT( brainpoolP384r1, 19 ),
+    ECP_COMB_POINT( brainpoolP384r1, 20 ),
+    ECP_COMB_POINT( brainpoolP384r1, 21 ),
+    ECP_COMB_POINT( brainpoolP384r1, 22 ),
+    ECP_COMB_POINT( brainpoolP384r1, 23 ),
+    ECP_COMB_POINT( brainpoolP384r1, 24 ),
+    ECP_COMB_POINT( brainpoolP384r1, 25 ),
+    ECP_COMB_POINT( brainpoolP384r1, 26 ),
+    ECP_COMB_POINT( brainpoolP384r1, 27 ),
+    ECP_COMB_POINT( brainpoolP384r1, 28 ),
+    ECP_COMB_POINT( brainpoolP384r1, 29 ),
+    ECP_COMB_POINT( brainpoolP384r1, 30 ),
+    ECP_COMB_POINT( brainpoolP384r1, 31 ),
+};
+#endif /* MBEDTLS_ECP_INTERNAL_ALT */
+#endif /* MBEDTLS_ECP_FIXED_POINT_OPTIM */
 #endif /* MBEDTLS_ECP_DP_BP384R1_ENABLED */
 
 /*
@@ -547,6 +3259,593 @@ static const mbedtls_mpi_uint brainpoolP512r1_n[] = {
     BYTES_TO_T_UINT_8( 0x07, 0xFC, 0xC9, 0x33, 0xAE, 0xE6, 0xD4, 0x3F ),
     BYTES_TO_T_UINT_8( 0x8B, 0xC4, 0xE9, 0xDB, 0xB8, 0x9D, 0xDD, 0xAA ),
 };
+#if MBEDTLS_ECP_FIXED_POINT_OPTIM == 1
+#if defined(MBEDTLS_ECP_INTERNAL_ALT)
+/* The table below is in Montgomery form, see ecp_mont_setup() */
+#define brainpoolP512r1_T    NULL
+#else
+static const mbedtls_mpi_uint brainpoolP512r1_T_xy[] = {
+    /* T[0].X, T[0].Y */
+    BYTES_TO_T_UINT_8( 0xD3, 0xD9, 0x61, 0x51, 0x09, 0x96, 0xCE, 0xC4 ),
+    BYTES_TO_T_UINT_8( 0xA4, 0x02, 0x2C, 0x27, 0x64, 0x4D, 0x3E, 0x68 ),
+    BYTES_TO_T_UINT_8( 0x8F, 0x5E, 0xF5, 0x6D, 0x14, 0x04, 0xAB, 0x34 ),
+    BYTES_TO_T_UINT_8( 0xC8, 0x1F, 0xC0, 0x14, 0x95, 0x53, 0x50, 0x85 ),
+    BYTES_TO_T_UINT_8( 0x37, 0x87, 0x5C, 0x90, 0x6F, 0xD7, 0x33, 0x24 ),
+    BYTES_TO_T_UINT_8( 0xF7, 0x3C, 0x6D, 0xF3, 0x37, 0xEA, 0xB6, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x73, 0x45, 0x6D, 0x00, 0xCA, 0xB5, 0x1C, 0x87 ),
+    BYTES_TO_T_UINT_8( 0x81, 0xE9, 0x94, 0x09, 0x4C, 0xA1, 0x2B, 0x5A ),
+    BYTES_TO_T_UINT_8( 0x6D, 0x2A, 0x04, 0x25, 0x29, 0x66, 0x90, 0x2F ),
+    BYTES_TO_T_UINT_8( 0x25, 0xF3, 0x42, 0x47, 0x6F, 0xDF, 0x18, 0x75 ),
+    BYTES_TO_T_UINT_8( 0x90, 0x94, 0x85, 0x4C, 0x53, 0x55, 0x84, 0xBF ),
+    BYTES_TO_T_UINT_8( 0x3E, 0xCC, 0x8E, 0x59, 0x75, 0xC7, 0x0E, 0x36 ),
+    BYTES_TO_T_UINT_8( 0xDC, 0x2F, 0xE6, 0x8F, 0x88, 0x0B, 0x17, 0x7C ),
+    BYTES_TO_T_UINT_8( 0x8C, 0x3F, 0x9D, 0xCD, 0x77, 0x2B, 0x5D, 0x58 ),
+    BYTES_TO_T_UINT_8( 0x9B, 0x3F, 0x0F, 0x87, 0xDA, 0xD7, 0x5E, 0x9A ),
+    BYTES_TO_T_UINT_8( 0x81, 0x72, 0xCB, 0x2A, 0xD1, 0xC9, 0x50, 0x8C ),
+    /* T[1].X, T[1].Y */
+    BYTES_TO_T_UINT_8( 0xDA, 0x93, 0x2A, 0xE1, 0xD8, 0xCB, 0x1D, 0x39 ),
+    BYTES_TO_T_UINT_8( 0x50, 0x32, 0x72, 0x64, 0xA0, 0x5B, 0xCA, 0xCF ),
+    BYTES_TO_T_UINT_8( 0xD9, 0xA3, 0x2F, 0xF1, 0x4B, 0x1C, 0x7C, 0xE0 ),
+    BYTES_TO_T_UINT_8( 0xA0, 0x7C, 0x89, 0x28, 0xF9, 0x8E, 0x5E, 0x72 ),
+    BYTES_TO_T_UINT_8( 0xCE, 0xB0, 0x56, 0xFF, 0xA5, 0x52, 0x42, 0x5A ),
+    BYTES_TO_T_UINT_8( 0x37, 0x64, 0x9E, 0xF5, 0x32, 0x8B, 0xD6, 0x8B ),
+    BYTES_TO_T_UINT_8( 0x83, 0x7A, 0x80, 0x10, 0xE1, 0xF7, 0xC9, 0xE2 ),
+    BYTES_TO_T_UINT_8( 0x6B, 0xBC, 0xBF, 0x54, 0x7E, 0x75, 0xA8, 0xA3 ),
+    BYTES_TO_T_UINT_8( 0x56, 0x01, 0x3E, 0x91, 0x87, 0x74, 0xB7, 0x1B ),
+    BYTES_TO_T_UINT_8( 0xA5, 0xDE, 0x00, 0x3C, 0xA1, 0xBF, 0x16, 0xEF ),
+    BYTES_TO_T_UINT_8( 0x06, 0xD2, 0x10, 0xDB, 0xF1, 0x62, 0x87, 0xE0 ),
+    BYTES_TO_T_UINT_8( 0x1E, 0x2A, 0xAA, 0x35, 0xA1, 0xF8, 0x7D, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x7A, 0xDF, 0x91, 0xEB, 0x46, 0xD1, 0x35, 0x40 ),
+    BYTES_TO_T_UINT_8( 0x9D, 0xAD, 0x5A, 0x7F, 0x12, 0x2E, 0xDF, 0x75 ),
+    BYTES_TO_T_UINT_8( 0x16, 0x4A, 0xF1, 0x04, 0x7D, 0x79, 0x91, 0x4B ),
+    BYTES_TO_T_UINT_8( 0x49, 0x67, 0xA0, 0xEC, 0x11, 0x78, 0xC7, 0x83 ),
+    /* T[2].X, T[2].Y */
+    BYTES_TO_T_UINT_8( 0x67, 0x77, 0x1F, 0xBA, 0x46, 0x63, 0x12, 0x3A ),
+    BYTES_TO_T_UINT_8( 0x4B, 0x29, 0x52, 0x3D, 0x79, 0xDE, 0x09, 0xA9 ),
+    BYTES_TO_T_UINT_8( 0xEA, 0x63, 0xCE, 0x05, 0xC7, 0x00, 0xE4, 0x26 ),
+    BYTES_TO_T_UINT_8( 0xB9, 0xAF, 0xE9, 0x68, 0xA8, 0xF8, 0x36, 0xA3 ),
+    BYTES_TO_T_UINT_8( 0x73, 0x3A, 0xED, 0xB6, 0xD3, 0x6E, 0x29, 0x7F ),
+    BYTES_TO_T_UINT_8( 0x62, 0xB8, 0x84, 0x46, 0xCF, 0xA6, 0xC5, 0x78 ),
+    BYTES_TO_T_UINT_8( 0xA6, 0x3A, 0xEE, 0xBE, 0x8D, 0xCE, 0x4C, 0xC9 ),
+    BYTES_TO_T_UINT_8( 0xD6, 0xC7, 0xEA, 0xC3, 0xAE, 0x98, 0x58, 0x38 ),
+    BYTES_TO_T_UINT_8( 0x3D, 0xC9, 0xC6, 0x50, 0x00, 0xFB, 0xEF, 0x1E ),
+    BYTES_TO_T_UINT_8( 0xD4, 0x7D, 0xD8, 0x20, 0x81, 0x02, 0x7E, 0x6B ),
+    BYTES_TO_T_UINT_8( 0x2B, 0xBE, 0x83, 0x39, 0xC6, 0x60, 0x4D, 0x5C ),
+    BYTES_TO_T_UINT_8( 0x9E, 0xED, 0x28, 0x1F, 0x1D, 0xB2, 0x0E, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0x1D, 0xC4, 0xB8, 0x91, 0x4D, 0xB6, 0x12, 0x8C ),
+    BYTES_TO_T_UINT_8( 0x77, 0x8C, 0x98, 0x67, 0xD2, 0x8C, 0x73, 0x0A ),
+    BYTES_TO_T_UINT_8( 0x7A, 0xF3, 0x6A, 0x06, 0x26, 0x02, 0x02, 0x33 ),
+    BYTES_TO_T_UINT_8( 0xC8, 0x21, 0x89, 0x75, 0x11, 0x25, 0x0D, 0xA0 ),
+    /* T[3].X, T[3].Y */
+    BYTES_TO_T_UINT_8( 0x3E, 0x92, 0xC9, 0xCE, 0x8D, 0xA7, 0xA8, 0xC0 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0xE8, 0x98, 0xEA, 0x7F, 0x7B, 0xDF, 0x89 ),
+    BYTES_TO_T_UINT_8( 0x76, 0x54, 0xD8, 0x02, 0x92, 0x7F, 0x6F, 0xA4 ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x93, 0xA0, 0x4C, 0x4E, 0x3A, 0x72, 0x6A ),
+    BYTES_TO_T_UINT_8( 0xE2, 0x0A, 0x53, 0xA4, 0x42, 0xDF, 0x18, 0xCE ),
+    BYTES_TO_T_UINT_8( 0x31, 0x49, 0x4B, 0xD0, 0xC4, 0xD5, 0x3E, 0x4C ),
+    BYTES_TO_T_UINT_8( 0xBF, 0x1D, 0xE7, 0x5C, 0x75, 0xCB, 0xCD, 0x21 ),
+    BYTES_TO_T_UINT_8( 0xFD, 0x69, 0xA0, 0x75, 0x04, 0x99, 0xB8, 0x82 ),
+    BYTES_TO_T_UINT_8( 0xDD, 0xA4, 0xBA, 0xFC, 0xF6, 0x2A, 0x2D, 0x68 ),
+    BYTES_TO_T_UINT_8( 0xD0, 0x37, 0xE6, 0xB8, 0x76, 0xAD, 0x98, 0x60 ),
+    BYTES_TO_T_UINT_8( 0x12, 0xEC, 0x8C, 0x63, 0x07, 0xA0, 0x64, 0xE9 ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x3F, 0xC2, 0x80, 0x31, 0xAD, 0x71, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0x45, 0x56, 0xF2, 0x70, 0x06, 0x22, 0xD1, 0x63 ),
+    BYTES_TO_T_UINT_8( 0xDB, 0x33, 0x12, 0x8F, 0xFA, 0xEB, 0x4C, 0x35 ),
+    BYTES_TO_T_UINT_8( 0x96, 0xEE, 0x10, 0x07, 0x52, 0x36, 0x9D, 0xDD ),
+    BYTES_TO_T_UINT_8( 0x29, 0x03, 0x73, 0x76, 0x58, 0xAF, 0xD0, 0x0E ),
+    /* T[4].X, T[4].Y */
+    BYTES_TO_T_UINT_8( 0x23, 0xE4, 0x75, 0x53, 0x69, 0xEF, 0xA6, 0x44 ),
+    BYTES_TO_T_UINT_8( 0x76, 0xE5, 0x3A, 0x73, 0xB0, 0x74, 0x13, 0xF1 ),
+    BYTES_TO_T_UINT_8( 0x8F, 0x8C, 0x62, 0x0E, 0x74, 0xA3, 0x95, 0xE4 ),
+    BYTES_TO_T_UINT_8( 0x9B, 0xAA, 0x43, 0xD1, 0xBA, 0xF9, 0xE5, 0x7F ),
+    BYTES_TO_T_UINT_8( 0xEE, 0x6C, 0x87, 0xB4, 0xC0, 0x0B, 0x1F, 0x5B ),
+    BYTES_TO_T_UINT_8( 0x53, 0x4D, 0xB4, 0x27, 0x9F, 0x09, 0x06, 0x52 ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x87, 0xA7, 0xAC, 0x67, 0x9E, 0xC0, 0xF1 ),
+    BYTES_TO_T_UINT_8( 0x22, 0x71, 0xFA, 0x22, 0xE2, 0x39, 0xC4, 0x60 ),
+    BYTES_TO_T_UINT_8( 0x0A, 0x57, 0x88, 0x23, 0x84, 0x3D, 0x7E, 0x53 ),
+    BYTES_TO_T_UINT_8( 0xD2, 0xAC, 0x87, 0xFB, 0x53, 0x5C, 0x96, 0x56 ),
+    BYTES_TO_T_UINT_8( 0xF6, 0xBC, 0x08, 0x57, 0xF9, 0x9E, 0x29, 0x81 ),
+    BYTES_TO_T_UINT_8( 0x12, 0x30, 0x29, 0x7E, 0x10, 0xD0, 0x78, 0x14 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0x70, 0x6A, 0xF1, 0xFB, 0xA9, 0x1D, 0x6F ),
+    BYTES_TO_T_UINT_8( 0x76, 0x7E, 0x65, 0x03, 0x69, 0xA7, 0xEE, 0x48 ),
+    BYTES_TO_T_UINT_8( 0x7C, 0x41, 0xEE, 0xF3, 0x2F, 0xB9, 0xB9, 0x82 ),
+    BYTES_TO_T_UINT_8( 0x55, 0x52, 0xF5, 0x67, 0x97, 0x3E, 0xA2, 0x7E ),
+    /* T[5].X, T[5].Y */
+    BYTES_TO_T_UINT_8( 0x62, 0x72, 0x3D, 0x13, 0x5E, 0x5A, 0xAD, 0x05 ),
+    BYTES_TO_T_UINT_8( 0xB9, 0xD0, 0xBF, 0x7B, 0x8A, 0x36, 0xEB, 0xC7 ),
+    BYTES_TO_T_UINT_8( 0x2B, 0x1B, 0xF6, 0x0B, 0x03, 0x22, 0xD9, 0xF5 ),
+    BYTES_TO_T_UINT_8( 0xD5, 0x64, 0xAF, 0xF9, 0x0A, 0x2C, 0x5A, 0x6F ),
+    BYTES_TO_T_UINT_8( 0xB3, 0x43, 0xF0, 0x1E, 0x02, 0x57, 0xF5, 0x48 ),
+    BYTES_TO_T_UINT_8( 0x88, 0x79, 0x70, 0xE7, 0xA3, 0x8D, 0xDB, 0xE3 ),
+    BYTES_TO_T_UINT_8( 0xB9, 0x40, 0xF4, 0x6E, 0x73, 0x6D, 0xA4, 0xE7 ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x99, 0x71, 0x00, 0x63, 0x18, 0xCA, 0xA5 ),
+    BYTES_TO_T_UINT_8( 0xC4, 0x0C, 0xAB, 0x37, 0x23, 0xDE, 0x61, 0x95 ),
+    BYTES_TO_T_UINT_8( 0xBF, 0x18, 0x00, 0xA9, 0x58, 0x54, 0x79, 0x23 ),
+    BYTES_TO_T_UINT_8( 0x0F, 0x98, 0xB4, 0x0E, 0x7B, 0xCF, 0xF3, 0xAD ),
+    BYTES_TO_T_UINT_8( 0x93, 0x11, 0x93, 0x1C, 0x1B, 0x52, 0xC1, 0x58 ),
+    BYTES_TO_T_UINT_8( 0xF8, 0x74, 0xFA, 0x98, 0x58, 0x15, 0x12, 0x45 ),
+    BYTES_TO_T_UINT_8( 0x4E, 0x6D, 0xA9, 0x51, 0xAB, 0x27, 0xB0, 0x0C ),
+    BYTES_TO_T_UINT_8( 0x2A, 0x78, 0x2C, 0x5B, 0xEC, 0x78, 0x84, 0x9E ),
+    BYTES_TO_T_UINT_8( 0x67, 0x01, 0x15, 0xE9, 0x05, 0xE4, 0xB8, 0x2C ),
+    /* T[6].X, T[6].Y */
+    BYTES_TO_T_UINT_8( 0x21, 0xAA, 0x4E, 0xF6, 0x3C, 0x92, 0x1E, 0x47 ),
+    BYTES_TO_T_UINT_8( 0xAD, 0xB2, 0x9A, 0xB4, 0xC1, 0xC0, 0xBB, 0xCF ),
+    BYTES_TO_T_UINT_8( 0xF3, 0xFA, 0x99, 0x10, 0x11, 0xD2, 0xB2, 0x3F ),
+    BYTES_TO_T_UINT_8( 0xD8, 0xA3, 0x8C, 0xB1, 0xB2, 0x36, 0x98, 0xA7 ),
+    BYTES_TO_T_UINT_8( 0xBC, 0xF5, 0x28, 0x25, 0x4E, 0xCE, 0xC3, 0x59 ),
+    BYTES_TO_T_UINT_8( 0xA1, 0x4F, 0x9D, 0x5B, 0xD5, 0xA0, 0xB8, 0x62 ),
+    BYTES_TO_T_UINT_8( 0x68, 0x9D, 0xED, 0x08, 0xBC, 0xF8, 0xCE, 0x06 ),
+    BYTES_TO_T_UINT_8( 0x34, 0xEB, 0xBF, 0xD3, 0xC3, 0xC6, 0x8E, 0x88 ),
+    BYTES_TO_T_UINT_8( 0x57, 0xAE, 0x1C, 0x6A, 0x6A, 0x80, 0xD1, 0x70 ),
+    BYTES_TO_T_UINT_8( 0x2A, 0x0C, 0xB9, 0x6A, 0x30, 0x60, 0x8E, 0xA2 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x4B, 0xFA, 0x2C, 0x5C, 0x5A, 0xE0, 0x4E ),
+    BYTES_TO_T_UINT_8( 0xD0, 0xE6, 0x48, 0x2E, 0x1A, 0xC6, 0xBC, 0xE2 ),
+    BYTES_TO_T_UINT_8( 0x39, 0x14, 0x22, 0xA5, 0x82, 0x60, 0x0A, 0x27 ),
+    BYTES_TO_T_UINT_8( 0xA2, 0x30, 0x07, 0xEE, 0x76, 0x99, 0x57, 0x54 ),
+    BYTES_TO_T_UINT_8( 0x80, 0xFE, 0xF2, 0xED, 0xE3, 0xB5, 0x26, 0xF5 ),
+    BYTES_TO_T_UINT_8( 0x75, 0x4A, 0x8D, 0x09, 0xAA, 0x8B, 0x32, 0x3E ),
+    /* T[7].X, T[7].Y */
+    BYTES_TO_T_UINT_8( 0xD1, 0xF8, 0x03, 0x6D, 0xA0, 0x21, 0x03, 0xDA ),
+    BYTES_TO_T_UINT_8( 0x3B, 0x91, 0xAE, 0xDC, 0xD6, 0xE8, 0xC7, 0x90 ),
+    BYTES_TO_T_UINT_8( 0xA3, 0xBE, 0x9A, 0x0A, 0x38, 0xEC, 0x81, 0x5F ),
+    BYTES_TO_T_UINT_8( 0xEE, 0x50, 0xA4, 0xA6, 0xD4, 0xC4, 0x80, 0x1D ),
+    BYTES_TO_T_UINT_8( 0xB4, 0x4C, 0x0A, 0x83, 0xF4, 0x1D, 0x93, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0x44, 0x59, 0xC0, 0xAB, 0x18, 0x1D, 0x31, 0xB2 ),
+    BYTES_TO_T_UINT_8( 0x34, 0x3E, 0xA1, 0xF3, 0xC7, 0xE4, 0xB3, 0x52 ),
+    BYTES_TO_T_UINT_8( 0xE5, 0x75, 0xE7, 0x69, 0x7A, 0xA1, 0x4D, 0x5B ),
+    BYTES_TO_T_UINT_8( 0x14, 0xF7, 0x4E, 0xEA, 0xD4, 0xB2, 0xB6, 0x23 ),
+    BYTES_TO_T_UINT_8( 0xA2, 0x51, 0xFD, 0xB5, 0x1F, 0x1E, 0xCD, 0xEC ),
+    BYTES_TO_T_UINT_8( 0x9C, 0x28, 0xE4, 0xC4, 0xE8, 0x6D, 0x4A, 0x69 ),
+    BYTES_TO_T_UINT_8( 0xDF, 0xF5, 0x7D, 0xAD, 0x91, 0x17, 0xDF, 0x7F ),
+    BYTES_TO_T_UINT_8( 0x86, 0xC7, 0xD5, 0x36, 0x00, 0xC5, 0x34, 0x19 ),
+    BYTES_TO_T_UINT_8( 0xCC, 0xF1, 0x62, 0xD5, 0x49, 0x37, 0x34, 0x69 ),
+    BYTES_TO_T_UINT_8( 0x8D, 0x85, 0x5D, 0xAF, 0x13, 0xDC, 0x76, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x85, 0x92, 0xDF, 0x92, 0xDB, 0x04, 0xC4, 0x1D ),
+    /* T[8].X, T[8].Y */
+    BYTES_TO_T_UINT_8( 0x17, 0x74, 0x98, 0x1B, 0xD9, 0x10, 0x79, 0x63 ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x24, 0x41, 0xFC, 0x78, 0x56, 0x61, 0xB9 ),
+    BYTES_TO_T_UINT_8( 0xF9, 0x4F, 0xD7, 0xC7, 0xDA, 0x83, 0xE7, 0xE2 ),
+    BYTES_TO_T_UINT_8( 0x13, 0x79, 0xBE, 0x98, 0x6D, 0x47, 0x4E, 0xE4 ),
+    BYTES_TO_T_UINT_8( 0xF1, 0x76, 0x20, 0xF3, 0xA4, 0xBA, 0x57, 0xE3 ),
+    BYTES_TO_T_UINT_8( 0x20, 0x0B, 0xB6, 0x92, 0x1B, 0xDC, 0xBE, 0xE3 ),
+    BYTES_TO_T_UINT_8( 0x44, 0xE4, 0x51, 0xB4, 0x04, 0x7F, 0x0E, 0xDE ),
+    BYTES_TO_T_UINT_8( 0xDB, 0xF9, 0x9F, 0xCC, 0x97, 0x53, 0x84, 0x1D ),
+    BYTES_TO_T_UINT_8( 0xF7, 0x3F, 0x59, 0x04, 0x55, 0x0E, 0x21, 0x98 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0xCB, 0x70, 0x8E, 0x82, 0x53, 0x2E, 0xAD ),
+    BYTES_TO_T_UINT_8( 0xCF, 0x41, 0x42, 0x3F, 0xAF, 0xAF, 0x89, 0x03 ),
+    BYTES_TO_T_UINT_8( 0xF9, 0x1E, 0xB6, 0x0C, 0x9E, 0x39, 0xEB, 0x9F ),
+    BYTES_TO_T_UINT_8( 0x4E, 0xC7, 0x21, 0xCF, 0xD8, 0xD4, 0x4C, 0x08 ),
+    BYTES_TO_T_UINT_8( 0x0F, 0xCA, 0x43, 0x5D, 0x94, 0x01, 0x25, 0x78 ),
+    BYTES_TO_T_UINT_8( 0x3B, 0x0C, 0x23, 0xFB, 0x14, 0x2C, 0xC5, 0x1B ),
+    BYTES_TO_T_UINT_8( 0x0E, 0x14, 0x73, 0x11, 0x29, 0x8B, 0xDA, 0x5F ),
+    /* T[9].X, T[9].Y */
+    BYTES_TO_T_UINT_8( 0xC4, 0xA9, 0x15, 0x88, 0xF1, 0x6D, 0xF2, 0x04 ),
+    BYTES_TO_T_UINT_8( 0x23, 0x54, 0x34, 0xDB, 0x32, 0x77, 0x99, 0x46 ),
+    BYTES_TO_T_UINT_8( 0xEA, 0x2F, 0x4C, 0xD5, 0xCE, 0xF3, 0x3B, 0xFB ),
+    BYTES_TO_T_UINT_8( 0x7A, 0xCD, 0xA8, 0xFE, 0x06, 0x99, 0x05, 0xD8 ),
+    BYTES_TO_T_UINT_8( 0xD8, 0x1A, 0xD2, 0xEC, 0xC5, 0xBE, 0x4C, 0x1F ),
+    BYTES_TO_T_UINT_8( 0x59, 0x56, 0x70, 0x71, 0xC3, 0x18, 0x07, 0x3B ),
+    BYTES_TO_T_UINT_8( 0x19, 0xDC, 0x26, 0xE9, 0xDA, 0xBC, 0xAD, 0x82 ),
+    BYTES_TO_T_UINT_8( 0x1C, 0x26, 0xB1, 0x43, 0x7A, 0xCC, 0xBB, 0x9A ),
+    BYTES_TO_T_UINT_8( 0x47, 0x48, 0x08, 0x8B, 0x0F, 0xE7, 0x0C, 0x61 ),
+    BYTES_TO_T_UINT_8( 0x02, 0x2F, 0xD9, 0xAD, 0x73, 0x65, 0x39, 0x97 ),
+    BYTES_TO_T_UINT_8( 0x33, 0x08, 0xDA, 0xF5, 0xD5, 0xF8, 0x99, 0xD8 ),
+    BYTES_TO_T_UINT_8( 0x81, 0xD8, 0xD1, 0xB1, 0x3B, 0xB2, 0x33, 0xA3 ),
+    BYTES_TO_T_UINT_8( 0x32, 0x0C, 0xAD, 0x03, 0x24, 0xF0, 0x66, 0x86 ),
+    BYTES_TO_T_UINT_8( 0xDE, 0xAC, 0xAD, 0x46, 0x7B, 0x65, 0x1C, 0x31 ),
+    BYTES_TO_T_UINT_8( 0x50, 0x43, 0x60, 0x63, 0x8F, 0xEA, 0x58, 0xBE ),
+    BYTES_TO_T_UINT_8( 0x07, 0x76, 0x31, 0x53, 0x0E, 0xFA, 0xE9, 0x25 ),
+    /* T[10].X, T[10].Y */
+    BYTES_TO_T_UINT_8( 0x28, 0x37, 0x46, 0xCE, 0x69, 0x21, 0x91, 0x16 ),
+    BYTES_TO_T_UINT_8( 0x49, 0x70, 0x13, 0x83, 0x6A, 0x2A, 0xF9, 0x1E ),
+    BYTES_TO_T_UINT_8( 0x73, 0xB8, 0xE3, 0x90, 0x9C, 0x8B, 0x0C, 0x09 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x61, 0x30, 0x1F, 0xD3, 0x78, 0x87, 0xD7 ),
+    BYTES_TO_T_UINT_8( 0xE3, 0x33, 0x58, 0xB7, 0x96, 0x4F, 0x60, 0x3F ),
+    BYTES_TO_T_UINT_8( 0x40, 0xC7, 0xB8, 0x9F, 0x08, 0x56, 0x9A, 0x88 ),
+    BYTES_TO_T_UINT_8( 0x1B, 0xBD, 0x8D, 0x3B, 0xE5, 0x22, 0x5C, 0x70 ),
+    BYTES_TO_T_UINT_8( 0x6B, 0xC1, 0x71, 0x5A, 0xF3, 0x8B, 0x3A, 0x47 ),
+    BYTES_TO_T_UINT_8( 0x0F, 0xC9, 0xA8, 0xBB, 0x7E, 0x44, 0x70, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0x04, 0x6E, 0x13, 0x1F, 0x10, 0x58, 0x2E, 0x0A ),
+    BYTES_TO_T_UINT_8( 0xD1, 0x13, 0xA1, 0x60, 0x94, 0xA2, 0xE3, 0xA7 ),
+    BYTES_TO_T_UINT_8( 0xC7, 0xDE, 0x34, 0x41, 0x28, 0x6E, 0xB9, 0x56 ),
+    BYTES_TO_T_UINT_8( 0x10, 0x37, 0xB8, 0x29, 0x66, 0x59, 0x70, 0xC7 ),
+    BYTES_TO_T_UINT_8( 0xC9, 0x6B, 0x5B, 0x0E, 0xA3, 0x62, 0x45, 0x59 ),
+    BYTES_TO_T_UINT_8( 0x18, 0xA3, 0xFD, 0x97, 0x45, 0xF5, 0x66, 0x41 ),
+    BYTES_TO_T_UINT_8( 0xEB, 0x64, 0xEB, 0xE5, 0x75, 0x79, 0x68, 0x66 ),
+    /* T[11].X, T[11].Y */
+    BYTES_TO_T_UINT_8( 0xC3, 0xE7, 0x00, 0x12, 0x50, 0xDE, 0xA7, 0x9F ),
+    BYTES_TO_T_UINT_8( 0x6D, 0x3C, 0xBF, 0x19, 0x64, 0xBE, 0xF4, 0x1A ),
+    BYTES_TO_T_UINT_8( 0x0E, 0xBA, 0xB5, 0x95, 0x7A, 0x82, 0x31, 0x2E ),
+    BYTES_TO_T_UINT_8( 0xAF, 0xF1, 0x1D, 0x8E, 0xE5, 0x8E, 0x60, 0x14 ),
+    BYTES_TO_T_UINT_8( 0x1D, 0x99, 0x41, 0x2D, 0xEF, 0x62, 0x3E, 0x43 ),
+    BYTES_TO_T_UINT_8( 0xCE, 0x88, 0x43, 0x5F, 0x4D, 0x63, 0xE8, 0xD1 ),
+    BYTES_TO_T_UINT_8( 0x6E, 0x56, 0x0E, 0x41, 0x7B, 0xD6, 0xBD, 0x51 ),
+    BYTES_TO_T_UINT_8( 0xB3, 0xBF, 0xBB, 0xFE, 0x11, 0xCD, 0x50, 0x97 ),
+    BYTES_TO_T_UINT_8( 0x17, 0xEB, 0x13, 0xCB, 0x0A, 0x8A, 0x91, 0x74 ),
+    BYTES_TO_T_UINT_8( 0x4E, 0xD3, 0x22, 0x5D, 0xDB, 0x02, 0x0A, 0x8E ),
+    BYTES_TO_T_UINT_8( 0x75, 0x3A, 0xF1, 0x61, 0x30, 0x05, 0xDC, 0xBF ),
+    BYTES_TO_T_UINT_8( 0x90, 0x1A, 0xA9, 0x81, 0x0C, 0x91, 0x47, 0x4A ),
+    BYTES_TO_T_UINT_8( 0x14, 0x59, 0x0F, 0xC6, 0x9C, 0xFD, 0x01, 0x5B ),
+    BYTES_TO_T_UINT_8( 0xE2, 0xC2, 0x62, 0xC6, 0x97, 0x72, 0x63, 0xB8 ),
+    BYTES_TO_T_UINT_8( 0x24, 0xF5, 0x4A, 0x24, 0x4C, 0xF0, 0xAE, 0x83 ),
+    BYTES_TO_T_UINT_8( 0xB3, 0x3C, 0xFD, 0x91, 0x98, 0xD1, 0xB0, 0x6B ),
+    /* T[12].X, T[12].Y */
+    BYTES_TO_T_UINT_8( 0x7D, 0xD0, 0x90, 0x13, 0x1E, 0x44, 0xD8, 0x6E ),
+    BYTES_TO_T_UINT_8( 0x75, 0x19, 0xC9, 0x9D, 0x96, 0x95, 0x52, 0xD6 ),
+    BYTES_TO_T_UINT_8( 0xA8, 0x90, 0x9C, 0x16, 0xB4, 0x16, 0xEE, 0xC0 ),
+    BYTES_TO_T_UINT_8( 0x95, 0x57, 0x5E, 0xD7, 0x28, 0x65, 0xB1, 0x3F ),
+    BYTES_TO_T_UINT_8( 0xC8, 0xC5, 0x7C, 0x8F, 0x24, 0x23, 0xDD, 0xF1 ),
+    BYTES_TO_T_UINT_8( 0x1D, 0xBE, 0xE2, 0x73, 0x4A, 0x97, 0xD8, 0x3C ),
+    BYTES_TO_T_UINT_8( 0x7D, 0x10, 0xFC, 0x3B, 0x36, 0x41, 0xB2, 0x25 ),
+    BYTES_TO_T_UINT_8( 0x23, 0x70, 0x71, 0xD7, 0xDF, 0x4A, 0x53, 0x10 ),
+    BYTES_TO_T_UINT_8( 0x48, 0x01, 0x26, 0x1E, 0x8D, 0x04, 0x5C, 0xD5 ),
+    BYTES_TO_T_UINT_8( 0x33, 0x08, 0x5E, 0xE1, 0x6B, 0xC8, 0xAC, 0xCE ),
+    BYTES_TO_T_UINT_8( 0x6F, 0xA9, 0xCF, 0x82, 0xAD, 0x5A, 0x80, 0x66 ),
+    BYTES_TO_T_UINT_8( 0x03, 0x05, 0xC3, 0x84, 0x7D, 0x18, 0xB4, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x87, 0xB1, 0x99, 0x82, 0x9F, 0x50, 0x02, 0x36 ),
+    BYTES_TO_T_UINT_8( 0x90, 0x75, 0x64, 0x19, 0x3E, 0x55, 0xCA, 0xDB ),
+    BYTES_TO_T_UINT_8( 0x7A, 0x26, 0x24, 0xBF, 0x02, 0x9C, 0x61, 0x29 ),
+    BYTES_TO_T_UINT_8( 0xD0, 0x98, 0xD3, 0x9F, 0x2B, 0x64, 0x62, 0x9C ),
+    /* T[13].X, T[13].Y */
+    BYTES_TO_T_UINT_8( 0x48, 0x50, 0x07, 0xC9, 0x7D, 0x8E, 0xEC, 0xBB ),
+    BYTES_TO_T_UINT_8( 0xF9, 0x35, 0x9F, 0x81, 0x2D, 0x01, 0xF5, 0xEE ),
+    BYTES_TO_T_UINT_8( 0x3C, 0x93, 0xD8, 0x42, 0x87, 0x42, 0x2B, 0x22 ),
+    BYTES_TO_T_UINT_8( 0x3C, 0x1B, 0xA3, 0xB2, 0xC6, 0xCE, 0x57, 0xEE ),
+    BYTES_TO_T_UINT_8( 0x9D, 0xBB, 0x02, 0xCF, 0x56, 0x40, 0x86, 0xE8 ),
+    BYTES_TO_T_UINT_8( 0xE0, 0x13, 0xDD, 0xAD, 0x2A, 0x37, 0xCC, 0x8D ),
+    BYTES_TO_T_UINT_8( 0x3D, 0x6F, 0x1A, 0x6F, 0x23, 0x2A, 0x23, 0x87 ),
+    BYTES_TO_T_UINT_8( 0x34, 0x94, 0x80, 0x88, 0xE0, 0x06, 0xF1, 0x1F ),
+    BYTES_TO_T_UINT_8( 0x42, 0xA9, 0xE5, 0x70, 0xFC, 0xC9, 0xCE, 0xFF ),
+    BYTES_TO_T_UINT_8( 0x1B, 0xB8, 0x5C, 0x96, 0x25, 0x9A, 0x91, 0x8E ),
+    BYTES_TO_T_UINT_8( 0xF4, 0x59, 0xA0, 0x9D, 0x16, 0x2B, 0xA4, 0x66 ),
+    BYTES_TO_T_UINT_8( 0xF4, 0x1D, 0x67, 0x98, 0x89, 0xD0, 0x7A, 0xD2 ),
+    BYTES_TO_T_UINT_8( 0x61, 0xDA, 0xD3, 0x3A, 0xB8, 0xAD, 0x04, 0x56 ),
+    BYTES_TO_T_UINT_8( 0xEE, 0xF7, 0xD8, 0x26, 0x95, 0x44, 0xCA, 0xF0 ),
+    BYTES_TO_T_UINT_8( 0xAF, 0x58, 0x2C, 0x8A, 0x46, 0x44, 0xAC, 0x25 ),
+    BYTES_TO_T_UINT_8( 0x59, 0xAF, 0xAC, 0x7E, 0x44, 0x3C, 0xAA, 0x36 ),
+    /* T[14].X, T[14].Y */
+    BYTES_TO_T_UINT_8( 0xF5, 0x0A, 0x4C, 0x8B, 0x12, 0xD4, 0xE0, 0xAD ),
+    BYTES_TO_T_UINT_8( 0xC6, 0x54, 0x3E, 0x7D, 0x33, 0xD2, 0x3E, 0x84 ),
+    BYTES_TO_T_UINT_8( 0x56, 0xB6, 0xBB, 0x78, 0x4E, 0x55, 0xC6, 0xA9 ),
+    BYTES_TO_T_UINT_8( 0x98, 0x0F, 0x91, 0x83, 0x8C, 0x6A, 0x75, 0x4D ),
+    BYTES_TO_T_UINT_8( 0x00, 0x30, 0x49, 0x6F, 0xCA, 0x1E, 0x58, 0x2E ),
+    BYTES_TO_T_UINT_8( 0x1C, 0x94, 0x8F, 0xCD, 0x3A, 0xC0, 0x0D, 0x57 ),
+    BYTES_TO_T_UINT_8( 0x60, 0xC5, 0xA0, 0x67, 0xD6, 0xB8, 0xD2, 0xB5 ),
+    BYTES_TO_T_UINT_8( 0x02, 0xA8, 0xF7, 0xCD, 0x1D, 0x38, 0x3B, 0x4B ),
+    BYTES_TO_T_UINT_8( 0x23, 0x47, 0x4B, 0xA4, 0x9C, 0xFC, 0x7E, 0x2A ),
+    BYTES_TO_T_UINT_8( 0x79, 0x86, 0x00, 0xF0, 0xA0, 0x4D, 0x78, 0x06 ),
+    BYTES_TO_T_UINT_8( 0x6A, 0xCC, 0xAF, 0x47, 0x6E, 0xF0, 0x14, 0xF9 ),
+    BYTES_TO_T_UINT_8( 0x0A, 0x35, 0xF9, 0xC4, 0xE9, 0x65, 0x5B, 0x59 ),
+    BYTES_TO_T_UINT_8( 0x2F, 0x0E, 0x0F, 0x21, 0xA9, 0x79, 0x84, 0x19 ),
+    BYTES_TO_T_UINT_8( 0x72, 0x45, 0x98, 0x7A, 0x73, 0x43, 0x24, 0x67 ),
+    BYTES_TO_T_UINT_8( 0xC6, 0x58, 0xD2, 0xC1, 0x53, 0x52, 0xC8, 0x53 ),
+    BYTES_TO_T_UINT_8( 0x6F, 0xD0, 0x04, 0x3F, 0xFA, 0x34, 0xF5, 0x3D ),
+    /* T[15].X, T[15].Y */
+    BYTES_TO_T_UINT_8( 0xF6, 0x43, 0xBE, 0xDC, 0x38, 0x09, 0xFA, 0x4C ),
+    BYTES_TO_T_UINT_8( 0x11, 0x7C, 0x9C, 0x96, 0x85, 0xFD, 0x15, 0x10 ),
+    BYTES_TO_T_UINT_8( 0x3D, 0x93, 0x15, 0x8D, 0x3C, 0x52, 0x79, 0xE1 ),
+    BYTES_TO_T_UINT_8( 0x14, 0x96, 0x14, 0xD3, 0x01, 0x40, 0x91, 0x36 ),
+    BYTES_TO_T_UINT_8( 0x89, 0x4F, 0x4C, 0xF4, 0x3E, 0xC1, 0x52, 0xEB ),
+    BYTES_TO_T_UINT_8( 0xFE, 0x5E, 0x7F, 0xFD, 0xAC, 0x6E, 0x18, 0x7C ),
+    BYTES_TO_T_UINT_8( 0x2F, 0x38, 0x7C, 0x8E, 0x45, 0x2C, 0x8C, 0xF9 ),
+    BYTES_TO_T_UINT_8( 0xB7, 0xA9, 0x5D, 0x11, 0xBC, 0x89, 0x1F, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0x49, 0xAB, 0x2C, 0xBF, 0x34, 0x29, 0xF1, 0x00 ),
+    BYTES_TO_T_UINT_8( 0xB2, 0x2D, 0x9D, 0x53, 0x5C, 0x46, 0x0C, 0x90 ),
+    BYTES_TO_T_UINT_8( 0xF8, 0x9C, 0x25, 0x0E, 0xF8, 0x2E, 0x66, 0xA8 ),
+    BYTES_TO_T_UINT_8( 0x9E, 0xAE, 0x51, 0xFA, 0x1E, 0xD3, 0xA6, 0x30 ),
+    BYTES_TO_T_UINT_8( 0xAB, 0x52, 0xF8, 0xB0, 0x1A, 0x96, 0x43, 0xB9 ),
+    BYTES_TO_T_UINT_8( 0xDC, 0x37, 0x0A, 0xE0, 0x34, 0x92, 0xA3, 0x5B ),
+    BYTES_TO_T_UINT_8( 0xA4, 0x2C, 0x07, 0x40, 0x8F, 0x7A, 0x78, 0x21 ),
+    BYTES_TO_T_UINT_8( 0x20, 0x46, 0xDD, 0xD8, 0x9F, 0xB1, 0x45, 0x1D ),
+    /* T[16].X, T[16].Y */
+    BYTES_TO_T_UINT_8( 0x89, 0x11, 0xCB, 0x41, 0xB3, 0xBD, 0xAD, 0x96 ),
+    BYTES_TO_T_UINT_8( 0x74, 0x50, 0x43, 0x9A, 0x44, 0x51, 0x9F, 0x97 ),
+    BYTES_TO_T_UINT_8( 0x0A, 0xD9, 0x9C, 0x21, 0x2D, 0xC6, 0x4C, 0xDE ),
+    BYTES_TO_T_UINT_8( 0x5E, 0x5E, 0xF0, 0x7D, 0x66, 0xB4, 0x94, 0x8C ),
+    BYTES_TO_T_UINT_8( 0xEC, 0x36, 0x59, 0x49, 0x45, 0x56, 0xCE, 0x45 ),
+    BYTES_TO_T_UINT_8( 0x74, 0xA5, 0xEF, 0x3A, 0x37, 0xC7, 0xB9, 0x9E ),
+    BYTES_TO_T_UINT_8( 0xDE, 0x29, 0x78, 0x3D, 0xF7, 0x41, 0x9F, 0xF5 ),
+    BYTES_TO_T_UINT_8( 0xC4, 0x62, 0xA6, 0xA8, 0x63, 0x87, 0xB1, 0x00 ),
+    BYTES_TO_T_UINT_8( 0xA7, 0xBB, 0x43, 0xEE, 0x5B, 0xEB, 0x38, 0x98 ),
+    BYTES_TO_T_UINT_8( 0xA5, 0xF7, 0x23, 0x1C, 0xB4, 0xEC, 0x44, 0xF0 ),
+    BYTES_TO_T_UINT_8( 0x61, 0x37, 0xB0, 0xF7, 0x10, 0xCB, 0x52, 0x6C ),
+    BYTES_TO_T_UINT_8( 0x34, 0xC8, 0xA8, 0xD1, 0xCB, 0xFE, 0x90, 0x02 ),
+    BYTES_TO_T_UINT_8( 0x93, 0x1A, 0xC7, 0xD0, 0x67, 0x76, 0xE1, 0x76 ),
+    BYTES_TO_T_UINT_8( 0xF8, 0xC2, 0x90, 0xA7, 0xB1, 0xBB, 0x2B, 0xE6 ),
+    BYTES_TO_T_UINT_8( 0x8A, 0xE1, 0x05, 0x1F, 0x95, 0x7F, 0x93, 0x89 ),
+    BYTES_TO_T_UINT_8( 0x74, 0x76, 0x5D, 0x3C, 0xCF, 0xC1, 0xCB, 0x3C ),
+    /* T[17].X, T[17].Y */
+    BYTES_TO_T_UINT_8( 0x14, 0x5F, 0xAE, 0xA7, 0x6C, 0xC2, 0x2A, 0xED ),
+    BYTES_TO_T_UINT_8( 0xA3, 0xD8, 0x6A, 0x71, 0x69, 0x12, 0x3C, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0xE1, 0x33, 0x2C, 0x15, 0xDD, 0x66, 0xAC, 0xB6 ),
+    BYTES_TO_T_UINT_8( 0x0A, 0xAF, 0x61, 0xA0, 0xD1, 0xD3, 0x16, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0xC7, 0x36, 0x42, 0x72, 0x3E, 0x82, 0x85, 0x23 ),
+    BYTES_TO_T_UINT_8( 0x39, 0x5A, 0x91, 0x0E, 0x1F, 0xBC, 0x07, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0xD8, 0x3E, 0x90, 0x2C, 0xC8, 0xB1, 0xBA, 0x5C ),
+    BYTES_TO_T_UINT_8( 0x20, 0xF2, 0xB0, 0x67, 0xF6, 0x83, 0x98, 0x10 ),
+    BYTES_TO_T_UINT_8( 0x02, 0xF5, 0x2C, 0xC2, 0xE9, 0xD9, 0xA0, 0x87 ),
+    BYTES_TO_T_UINT_8( 0xDC, 0xCB, 0x99, 0x5E, 0x46, 0xF7, 0x24, 0xA7 ),
+    BYTES_TO_T_UINT_8( 0x18, 0x8B, 0xCC, 0xB6, 0x52, 0xA9, 0x36, 0x67 ),
+    BYTES_TO_T_UINT_8( 0xCC, 0x23, 0x79, 0x48, 0x40, 0xAF, 0x83, 0xB9 ),
+    BYTES_TO_T_UINT_8( 0x53, 0x6D, 0x19, 0xB5, 0x0E, 0x66, 0xB9, 0x5F ),
+    BYTES_TO_T_UINT_8( 0x33, 0x8A, 0x80, 0x28, 0x5F, 0x57, 0x53, 0xF3 ),
+    BYTES_TO_T_UINT_8( 0xEE, 0xF0, 0xBA, 0xCF, 0x3B, 0x8D, 0x7D, 0x04 ),
+    BYTES_TO_T_UINT_8( 0xC7, 0x89, 0x07, 0x1A, 0x02, 0x1E, 0xA5, 0x79 ),
+    /* T[18].X, T[18].Y */
+    BYTES_TO_T_UINT_8( 0xC6, 0x6A, 0x22, 0xE9, 0xB3, 0x63, 0x8A, 0x6E ),
+    BYTES_TO_T_UINT_8( 0x77, 0x6D, 0x9A, 0x15, 0xAA, 0xF3, 0x7E, 0xC3 ),
+    BYTES_TO_T_UINT_8( 0xA5, 0x0A, 0xBB, 0x91, 0x74, 0xE7, 0x8E, 0x2D ),
+    BYTES_TO_T_UINT_8( 0x93, 0xEE, 0x2F, 0xA3, 0x77, 0x79, 0x1D, 0x0D ),
+    BYTES_TO_T_UINT_8( 0x5E, 0x65, 0x77, 0x99, 0xFA, 0x20, 0x69, 0x3E ),
+    BYTES_TO_T_UINT_8( 0x6D, 0x8F, 0xFB, 0x49, 0xCB, 0x58, 0xD8, 0x27 ),
+    BYTES_TO_T_UINT_8( 0xD2, 0x8C, 0x27, 0x42, 0x70, 0x16, 0x9B, 0xC2 ),
+    BYTES_TO_T_UINT_8( 0x3B, 0xB2, 0x7B, 0x18, 0x52, 0xE6, 0xAD, 0x7B ),
+    BYTES_TO_T_UINT_8( 0xD3, 0x5D, 0x6D, 0x98, 0xCA, 0x7A, 0x0E, 0x57 ),
+    BYTES_TO_T_UINT_8( 0x94, 0xFA, 0x45, 0x14, 0x8D, 0x0F, 0xA9, 0x90 ),
+    BYTES_TO_T_UINT_8( 0xBA, 0x43, 0x37, 0x89, 0x8B, 0x0A, 0xAE, 0x9D ),
+    BYTES_TO_T_UINT_8( 0x70, 0x8F, 0x63, 0xFC, 0x29, 0x7C, 0x4C, 0x27 ),
+    BYTES_TO_T_UINT_8( 0x8E, 0x85, 0x78, 0x07, 0xD2, 0x80, 0x33, 0xE7 ),
+    BYTES_TO_T_UINT_8( 0x35, 0x5C, 0xAA, 0x0D, 0x3E, 0x12, 0x4B, 0x30 ),
+    BYTES_TO_T_UINT_8( 0x98, 0xF6, 0x77, 0x1B, 0xFC, 0x54, 0x45, 0x18 ),
+    BYTES_TO_T_UINT_8( 0x54, 0xE8, 0x80, 0x3B, 0x3B, 0x04, 0x1B, 0x73 ),
+    /* T[19].X, T[19].Y */
+    BYTES_TO_T_UINT_8( 0x9B, 0x9E, 0xB6, 0x38, 0xE5, 0xDD, 0x39, 0x97 ),
+    BYTES_TO_T_UINT_8( 0x7F, 0xC6, 0xAB, 0xEE, 0x26, 0x5E, 0xA3, 0x86 ),
+    BYTES_TO_T_UINT_8( 0xA4, 0x9C, 0x24, 0x88, 0x44, 0xFE, 0x4E, 0xE5 ),
+    BYTES_TO_T_UINT_8( 0xC5, 0x99, 0x9A, 0x6F, 0x6D, 0x22, 0x97, 0x9F ),
+    BYTES_TO_T_UINT_8( 0xD7, 0x42, 0x10, 0x40, 0x8C, 0xBC, 0x5A, 0x87 ),
+    BYTES_TO_T_UINT_8( 0xAF, 0x76, 0x93, 0xDF, 0x91, 0x22, 0x3A, 0xC7 ),
+    BYTES_TO_T_UINT_8( 0x37, 0x49, 0x85, 0xE3, 0x31, 0x50, 0xA3, 0xBD ),
+    BYTES_TO_T_UINT_8( 0xBF, 0x65, 0xA0, 0xF7, 0x4A, 0x50, 0x60, 0x6E ),
+    BYTES_TO_T_UINT_8( 0x6E, 0xC2, 0x3E, 0xE9, 0xC6, 0x99, 0x75, 0x86 ),
+    BYTES_TO_T_UINT_8( 0x2C, 0xC8, 0xDB, 0x5D, 0x69, 0x72, 0x1E, 0x7B ),
+    BYTES_TO_T_UINT_8( 0x8B, 0x3C, 0xC5, 0x50, 0x52, 0xC8, 0xF0, 0x10 ),
+    BYTES_TO_T_UINT_8( 0x40, 0x8A, 0x13, 0x3A, 0x75, 0xAB, 0xEB, 0xD7 ),
+    BYTES_TO_T_UINT_8( 0xF7, 0x49, 0x1C, 0x1A, 0x73, 0x47, 0x0D, 0xEF ),
+    BYTES_TO_T_UINT_8( 0xB4, 0x7F, 0xC2, 0x20, 0x5D, 0x54, 0xB1, 0x1A ),
+    BYTES_TO_T_UINT_8( 0x23, 0x58, 0x62, 0xC3, 0xDC, 0x50, 0x18, 0x8A ),
+    BYTES_TO_T_UINT_8( 0x13, 0xAE, 0xA0, 0x0E, 0x5A, 0x8B, 0xB5, 0x27 ),
+    /* T[20].X, T[20].Y */
+    BYTES_TO_T_UINT_8( 0xCC, 0xA6, 0x72, 0x16, 0x8E, 0x1E, 0xBE, 0xC5 ),
+    BYTES_TO_T_UINT_8( 0x8D, 0x69, 0xDC, 0xBD, 0x5E, 0xA1, 0x1F, 0x64 ),
+    BYTES_TO_T_UINT_8( 0x49, 0x41, 0xFF, 0x67, 0x47, 0x5F, 0x17, 0x31 ),
+    BYTES_TO_T_UINT_8( 0x73, 0x6F, 0xDB, 0x2D, 0x7C, 0x3D, 0xDF, 0xBD ),
+    BYTES_TO_T_UINT_8( 0x04, 0xBF, 0x01, 0xB3, 0xE7, 0x5B, 0x1E, 0x4A ),
+    BYTES_TO_T_UINT_8( 0x54, 0x76, 0x60, 0xE7, 0x26, 0x5F, 0xED, 0x19 ),
+    BYTES_TO_T_UINT_8( 0x13, 0x59, 0xDC, 0xEC, 0xB0, 0xCD, 0xEE, 0xDE ),
+    BYTES_TO_T_UINT_8( 0x43, 0x63, 0x3A, 0x27, 0xA6, 0xF6, 0x47, 0x64 ),
+    BYTES_TO_T_UINT_8( 0x2C, 0xEE, 0x25, 0xDD, 0xAD, 0x78, 0x08, 0x80 ),
+    BYTES_TO_T_UINT_8( 0xBB, 0x10, 0xD2, 0x1E, 0xDD, 0xCF, 0x4D, 0x1B ),
+    BYTES_TO_T_UINT_8( 0xFC, 0x48, 0xD8, 0x35, 0xFD, 0x3C, 0x31, 0x40 ),
+    BYTES_TO_T_UINT_8( 0x3B, 0xE0, 0xBA, 0xA5, 0x6C, 0x84, 0x3F, 0x5B ),
+    BYTES_TO_T_UINT_8( 0x74, 0xA7, 0xF4, 0x54, 0x3C, 0x06, 0xBF, 0x88 ),
+    BYTES_TO_T_UINT_8( 0x32, 0x64, 0x55, 0x86, 0xC3, 0x3C, 0x1C, 0xA8 ),
+    BYTES_TO_T_UINT_8( 0xF7, 0x21, 0xC5, 0x5F, 0x65, 0x36, 0xAB, 0x3C ),
+    BYTES_TO_T_UINT_8( 0xEB, 0x6A, 0xBD, 0x89, 0x9C, 0xFE, 0x3D, 0x3D ),
+    /* T[21].X, T[21].Y */
+    BYTES_TO_T_UINT_8( 0x62, 0x81, 0xD0, 0xC5, 0xEC, 0x99, 0x9E, 0xC8 ),
+    BYTES_TO_T_UINT_8( 0x1B, 0x39, 0x02, 0xC0, 0x37, 0xCA, 0x24, 0x06 ),
+    BYTES_TO_T_UINT_8( 0x1F, 0xED, 0x4A, 0xA1, 0x61, 0x75, 0xCB, 0x76 ),
+    BYTES_TO_T_UINT_8( 0x17, 0x07, 0x3E, 0xE9, 0x8E, 0x66, 0xC7, 0xD8 ),
+    BYTES_TO_T_UINT_8( 0x25, 0x8C, 0x5F, 0x02, 0xED, 0x64, 0xBA, 0x51 ),
+    BYTES_TO_T_UINT_8( 0x9B, 0x29, 0x65, 0x42, 0x02, 0x65, 0x53, 0xE2 ),
+    BYTES_TO_T_UINT_8( 0x17, 0x7B, 0xED, 0x28, 0x93, 0xC2, 0x63, 0x6C ),
+    BYTES_TO_T_UINT_8( 0xC7, 0xBC, 0x1A, 0xEE, 0xA4, 0x89, 0x73, 0xA7 ),
+    BYTES_TO_T_UINT_8( 0xB8, 0x04, 0x0C, 0x64, 0x79, 0x74, 0x56, 0xA2 ),
+    BYTES_TO_T_UINT_8( 0x14, 0x82, 0xFC, 0xBF, 0xE3, 0x16, 0xD8, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0x5E, 0xAD, 0xDC, 0xAF, 0x53, 0x8B, 0x98, 0x3E ),
+    BYTES_TO_T_UINT_8( 0x7A, 0x1B, 0x66, 0x57, 0xF9, 0x41, 0x4E, 0x4A ),
+    BYTES_TO_T_UINT_8( 0xA9, 0x59, 0x38, 0x1B, 0x5F, 0x6C, 0xC2, 0x2D ),
+    BYTES_TO_T_UINT_8( 0x51, 0x26, 0xCC, 0x26, 0xCF, 0x58, 0x7D, 0xDD ),
+    BYTES_TO_T_UINT_8( 0x16, 0xD5, 0xA8, 0x9C, 0xEE, 0x2F, 0x11, 0xED ),
+    BYTES_TO_T_UINT_8( 0x0B, 0x74, 0x9A, 0xD0, 0x0B, 0xDF, 0x03, 0x69 ),
+    /* T[22].X, T[22].Y */
+    BYTES_TO_T_UINT_8( 0xA0, 0xA6, 0xD5, 0xEB, 0x71, 0x04, 0x10, 0x39 ),
+    BYTES_TO_T_UINT_8( 0x70, 0xEB, 0xF9, 0x49, 0x5A, 0xD5, 0x71, 0x01 ),
+    BYTES_TO_T_UINT_8( 0x51, 0x00, 0x53, 0x4D, 0x96, 0xEE, 0x1D, 0x5B ),
+    BYTES_TO_T_UINT_8( 0x49, 0x59, 0x11, 0x3A, 0xDA, 0xF5, 0x39, 0x81 ),
+    BYTES_TO_T_UINT_8( 0xA3, 0x99, 0x67, 0xFC, 0x36, 0xDA, 0xDE, 0x93 ),
+    BYTES_TO_T_UINT_8( 0xAA, 0x86, 0x66, 0xF2, 0x48, 0xB5, 0x5D, 0x70 ),
+    BYTES_TO_T_UINT_8( 0xE2, 0x69, 0x5F, 0x7C, 0x26, 0x09, 0x60, 0xCC ),
+    BYTES_TO_T_UINT_8( 0x27, 0x6B, 0xFC, 0x9F, 0xF9, 0xDF, 0xB0, 0x6A ),
+    BYTES_TO_T_UINT_8( 0x85, 0x3C, 0xF0, 0xCD, 0xE3, 0x15, 0xBC, 0x3D ),
+    BYTES_TO_T_UINT_8( 0xF2, 0x2F, 0xD1, 0x6D, 0xEF, 0x44, 0x7A, 0x63 ),
+    BYTES_TO_T_UINT_8( 0x73, 0x19, 0x46, 0xE8, 0xA8, 0x54, 0xB9, 0x3E ),
+    BYTES_TO_T_UINT_8( 0x8C, 0xE9, 0x87, 0x90, 0x62, 0x3D, 0xD1, 0x8C ),
+    BYTES_TO_T_UINT_8( 0xC7, 0x04, 0xF2, 0x95, 0xB2, 0x04, 0xA1, 0xFE ),
+    BYTES_TO_T_UINT_8( 0x4D, 0x73, 0xED, 0x2F, 0x5C, 0xFC, 0xB1, 0x46 ),
+    BYTES_TO_T_UINT_8( 0xCE, 0x95, 0x19, 0xAE, 0x8D, 0x39, 0xFC, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0xB7, 0xC6, 0xB2, 0xE9, 0x90, 0x61, 0xF4, 0x10 ),
+    /* T[23].X, T[23].Y */
+    BYTES_TO_T_UINT_8( 0x2B, 0xCB, 0x83, 0x34, 0xB9, 0x77, 0x30, 0x6C ),
+    BYTES_TO_T_UINT_8( 0x3D, 0xC2, 0x4F, 0x63, 0x40, 0x9E, 0xA5, 0x82 ),
+    BYTES_TO_T_UINT_8( 0xEE, 0xFD, 0x70, 0xC9, 0x9B, 0x54, 0xF4, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0xF2, 0x72, 0x29, 0xC7, 0x26, 0xB1, 0x44, 0xB4 ),
+    BYTES_TO_T_UINT_8( 0xEA, 0xCD, 0xA3, 0xD5, 0x0A, 0x11, 0x48, 0xEC ),
+    BYTES_TO_T_UINT_8( 0x64, 0xFB, 0x13, 0x8D, 0x55, 0x16, 0x46, 0x4F ),
+    BYTES_TO_T_UINT_8( 0xED, 0x5B, 0xF9, 0x01, 0x51, 0x04, 0x2E, 0x19 ),
+    BYTES_TO_T_UINT_8( 0xC8, 0x69, 0x0F, 0x89, 0x9B, 0x1A, 0xE2, 0x1C ),
+    BYTES_TO_T_UINT_8( 0xE5, 0xFD, 0xB4, 0x73, 0x9B, 0xD6, 0xB8, 0xF9 ),
+    BYTES_TO_T_UINT_8( 0x30, 0x18, 0x65, 0xF3, 0xFA, 0x13, 0xD2, 0x7E ),
+    BYTES_TO_T_UINT_8( 0x5C, 0x48, 0xB1, 0x11, 0x82, 0xAA, 0x0E, 0xE8 ),
+    BYTES_TO_T_UINT_8( 0xB7, 0x19, 0xBF, 0x17, 0xB9, 0x74, 0xED, 0x25 ),
+    BYTES_TO_T_UINT_8( 0x99, 0x6F, 0x7D, 0x55, 0xDA, 0x3C, 0xAC, 0xCC ),
+    BYTES_TO_T_UINT_8( 0x7C, 0xCB, 0xE5, 0x87, 0xCD, 0xCF, 0x90, 0x45 ),
+    BYTES_TO_T_UINT_8( 0xCD, 0xCC, 0xA1, 0xEE, 0xCA, 0xA1, 0x6F, 0x8B ),
+    BYTES_TO_T_UINT_8( 0xCE, 0xC2, 0xBB, 0xFE, 0xEB, 0x87, 0xA2, 0xA4 ),
+    /* T[24].X, T[24].Y */
+    BYTES_TO_T_UINT_8( 0x4B, 0xBB, 0x3F, 0xBE, 0x70, 0x48, 0x1F, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0x60, 0xD9, 0xF7, 0x47, 0x6D, 0x88, 0xB6, 0xD7 ),
+    BYTES_TO_T_UINT_8( 0x5D, 0xF7, 0xF6, 0x41, 0x75, 0xE9, 0x54, 0x06 ),
+    BYTES_TO_T_UINT_8( 0xF0, 0xE9, 0x47, 0x13, 0xC9, 0xDC, 0x90, 0x40 ),
+    BYTES_TO_T_UINT_8( 0x23, 0x08, 0xE0, 0x06, 0xF7, 0x67, 0x4E, 0x53 ),
+    BYTES_TO_T_UINT_8( 0x1C, 0x10, 0xDF, 0x62, 0x11, 0xD7, 0x65, 0xA1 ),
+    BYTES_TO_T_UINT_8( 0xA0, 0xAF, 0x5A, 0x00, 0xCE, 0x20, 0xB8, 0xB5 ),
+    BYTES_TO_T_UINT_8( 0x57, 0x6A, 0xF1, 0xFA, 0x3A, 0xCC, 0x09, 0x1B ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x9D, 0x86, 0x92, 0x17, 0x1E, 0xBC, 0x48 ),
+    BYTES_TO_T_UINT_8( 0x38, 0x55, 0x41, 0xAC, 0x94, 0xDC, 0xA4, 0x15 ),
+    BYTES_TO_T_UINT_8( 0x22, 0x98, 0x25, 0x31, 0xB0, 0x67, 0xF0, 0x83 ),
+    BYTES_TO_T_UINT_8( 0x34, 0x89, 0x0A, 0x45, 0xEA, 0xC9, 0xC5, 0xD1 ),
+    BYTES_TO_T_UINT_8( 0x42, 0x1F, 0x00, 0x43, 0xE0, 0xF1, 0x27, 0x24 ),
+    BYTES_TO_T_UINT_8( 0x78, 0x34, 0xC5, 0x7C, 0xBD, 0xC6, 0x8B, 0x0D ),
+    BYTES_TO_T_UINT_8( 0xBC, 0x41, 0xE6, 0x4C, 0xD7, 0x9E, 0xA2, 0xF7 ),
+    BYTES_TO_T_UINT_8( 0xEF, 0x13, 0x10, 0xFF, 0x12, 0x1E, 0x5C, 0x5F ),
+    /* T[25].X, T[25].Y */
+    BYTES_TO_T_UINT_8( 0x0E, 0x56, 0x70, 0x35, 0x41, 0x1F, 0x80, 0x20 ),
+    BYTES_TO_T_UINT_8( 0x33, 0xEA, 0xCD, 0xDB, 0x9E, 0x82, 0x41, 0x43 ),
+    BYTES_TO_T_UINT_8( 0x46, 0x2D, 0xF3, 0xD1, 0xC4, 0x87, 0x6F, 0x19 ),
+    BYTES_TO_T_UINT_8( 0x1B, 0xFC, 0xF8, 0xCE, 0x90, 0x35, 0x0B, 0x5B ),
+    BYTES_TO_T_UINT_8( 0xFA, 0x0E, 0xD2, 0xED, 0xBE, 0x65, 0x27, 0xFF ),
+    BYTES_TO_T_UINT_8( 0xE6, 0x33, 0x0E, 0x86, 0x11, 0xB2, 0x20, 0xB9 ),
+    BYTES_TO_T_UINT_8( 0x6A, 0x62, 0x98, 0xAD, 0x38, 0x3E, 0x65, 0x7D ),
+    BYTES_TO_T_UINT_8( 0xF5, 0x04, 0x71, 0xCB, 0xA0, 0xA4, 0x8B, 0x59 ),
+    BYTES_TO_T_UINT_8( 0xC7, 0x79, 0x69, 0x49, 0xCB, 0x20, 0x88, 0x43 ),
+    BYTES_TO_T_UINT_8( 0x9A, 0x84, 0x5F, 0x8A, 0x7C, 0x8B, 0x5B, 0x73 ),
+    BYTES_TO_T_UINT_8( 0x82, 0x23, 0xAC, 0x2B, 0x79, 0xEA, 0xBA, 0xF8 ),
+    BYTES_TO_T_UINT_8( 0x13, 0xD0, 0x43, 0xCA, 0xA3, 0xF8, 0x4B, 0x1E ),
+    BYTES_TO_T_UINT_8( 0x76, 0x95, 0x5F, 0x66, 0x0F, 0x74, 0x48, 0x68 ),
+    BYTES_TO_T_UINT_8( 0x3D, 0x35, 0x74, 0x93, 0x17, 0xE1, 0x9C, 0x54 ),
+    BYTES_TO_T_UINT_8( 0xA2, 0x2F, 0x96, 0x95, 0x2A, 0x77, 0x33, 0x43 ),
+    BYTES_TO_T_UINT_8( 0x3E, 0xB3, 0x59, 0xFC, 0x73, 0xED, 0x04, 0xA1 ),
+    /* T[26].X, T[26].Y */
+    BYTES_TO_T_UINT_8( 0xE7, 0x9A, 0xBD, 0x99, 0x89, 0x93, 0xFE, 0x9C ),
+    BYTES_TO_T_UINT_8( 0x4D, 0xAB, 0x14, 0x12, 0xBA, 0x49, 0x45, 0x98 ),
+    BYTES_TO_T_UINT_8( 0x32, 0x2C, 0x4E, 0x72, 0xE2, 0x92, 0x84, 0xE8 ),
+    BYTES_TO_T_UINT_8( 0xD5, 0xEA, 0x72, 0x18, 0x1E, 0x9B, 0x88, 0x62 ),
+    BYTES_TO_T_UINT_8( 0xA1, 0x30, 0x15, 0xBE, 0xDA, 0x5B, 0x74, 0x52 ),
+    BYTES_TO_T_UINT_8( 0x2B, 0x36, 0x12, 0x82, 0x4C, 0xC8, 0x25, 0x40 ),
+    BYTES_TO_T_UINT_8( 0xD2, 0xD1, 0x57, 0xD1, 0x60, 0xAC, 0xB4, 0xAC ),
+    BYTES_TO_T_UINT_8( 0xED, 0xF2, 0x6E, 0xDF, 0x35, 0xB1, 0xE1, 0x33 ),
+    BYTES_TO_T_UINT_8( 0xF6, 0x4B, 0x2B, 0x05, 0x34, 0x74, 0x32, 0x2C ),
+    BYTES_TO_T_UINT_8( 0x4C, 0x5F, 0x00, 0xBA, 0x94, 0x24, 0xB0, 0x07 ),
+    BYTES_TO_T_UINT_8( 0x96, 0xF3, 0x6E, 0x10, 0xED, 0xA6, 0x02, 0xEB ),
+    BYTES_TO_T_UINT_8( 0xDC, 0xA9, 0x60, 0xCF, 0x96, 0x2F, 0xF0, 0x18 ),
+    BYTES_TO_T_UINT_8( 0x7E, 0x81, 0xB1, 0xD4, 0xBE, 0xC4, 0x03, 0x3C ),
+    BYTES_TO_T_UINT_8( 0xF8, 0xC6, 0x8B, 0x9B, 0xFB, 0x3A, 0xD1, 0x7C ),
+    BYTES_TO_T_UINT_8( 0xF4, 0x43, 0x98, 0x2C, 0x59, 0xD5, 0xFA, 0xC6 ),
+    BYTES_TO_T_UINT_8( 0x62, 0xB8, 0x2D, 0x86, 0xBB, 0x95, 0x94, 0x9E ),
+    /* T[27].X, T[27].Y */
+    BYTES_TO_T_UINT_8( 0xAB, 0xB0, 0x5E, 0xCF, 0xC4, 0x97, 0x15, 0x74 ),
+    BYTES_TO_T_UINT_8( 0x76, 0x64, 0x26, 0xBA, 0x11, 0x4C, 0x01, 0x59 ),
+    BYTES_TO_T_UINT_8( 0xB2, 0x05, 0xEE, 0xB0, 0x07, 0xA2, 0x55, 0x64 ),
+    BYTES_TO_T_UINT_8( 0x93, 0xE3, 0x47, 0xF6, 0xEF, 0x5B, 0x28, 0x59 ),
+    BYTES_TO_T_UINT_8( 0xCA, 0x77, 0x66, 0x55, 0x76, 0xCF, 0x76, 0xEB ),
+    BYTES_TO_T_UINT_8( 0xCC, 0x80, 0xE6, 0xA0, 0xBE, 0x90, 0x56, 0x3C ),
+    BYTES_TO_T_UINT_8( 0xE2, 0x6D, 0xEF, 0xDF, 0x11, 0xC0, 0x90, 0x6E ),
+    BYTES_TO_T_UINT_8( 0x16, 0x49, 0x1F, 0x28, 0x33, 0x0C, 0x73, 0x5A ),
+    BYTES_TO_T_UINT_8( 0xAA, 0xC7, 0xAB, 0x25, 0x25, 0xD3, 0x62, 0x72 ),
+    BYTES_TO_T_UINT_8( 0xB8, 0x6C, 0xE1, 0xDF, 0x0D, 0x04, 0x9F, 0x54 ),
+    BYTES_TO_T_UINT_8( 0x54, 0xAD, 0x1D, 0x79, 0x4D, 0xCA, 0x6E, 0x77 ),
+    BYTES_TO_T_UINT_8( 0xA2, 0xA5, 0xBE, 0x70, 0xC8, 0x1E, 0x7F, 0xE8 ),
+    BYTES_TO_T_UINT_8( 0xB3, 0x07, 0xA6, 0xA9, 0x6F, 0xB8, 0x67, 0x43 ),
+    BYTES_TO_T_UINT_8( 0xC6, 0xAD, 0x62, 0xDD, 0x33, 0xE4, 0xAD, 0xEF ),
+    BYTES_TO_T_UINT_8( 0xBF, 0x80, 0x66, 0x78, 0xD1, 0x57, 0x51, 0x6C ),
+    BYTES_TO_T_UINT_8( 0xFE, 0xD5, 0x1F, 0x45, 0x90, 0xE1, 0x89, 0x97 ),
+    /* T[28].X, T[28].Y */
+    BYTES_TO_T_UINT_8( 0xB3, 0x77, 0x13, 0xEA, 0xA9, 0xA1, 0x06, 0x19 ),
+    BYTES_TO_T_UINT_8( 0x09, 0x37, 0x6D, 0x74, 0xEC, 0x0F, 0x6F, 0xD7 ),
+    BYTES_TO_T_UINT_8( 0x3C, 0x25, 0xAC, 0x79, 0x42, 0xC6, 0xF3, 0x98 ),
+    BYTES_TO_T_UINT_8( 0x51, 0xDF, 0x05, 0xD1, 0xD2, 0x40, 0x8B, 0x5A ),
+    BYTES_TO_T_UINT_8( 0x26, 0x22, 0x8F, 0xAE, 0xA7, 0xD1, 0x60, 0xAD ),
+    BYTES_TO_T_UINT_8( 0x82, 0xE4, 0x37, 0x69, 0xF1, 0xF9, 0xF5, 0xA0 ),
+    BYTES_TO_T_UINT_8( 0x17, 0x51, 0xB0, 0x63, 0xD1, 0x0C, 0x81, 0x39 ),
+    BYTES_TO_T_UINT_8( 0x52, 0xBC, 0x84, 0x3E, 0x1D, 0x23, 0x43, 0x98 ),
+    BYTES_TO_T_UINT_8( 0x48, 0xFA, 0x57, 0xC5, 0xE1, 0xC5, 0x1A, 0x06 ),
+    BYTES_TO_T_UINT_8( 0x44, 0x88, 0x60, 0x36, 0x4C, 0xBB, 0xDF, 0xBD ),
+    BYTES_TO_T_UINT_8( 0x1F, 0xD5, 0x96, 0x44, 0x17, 0x1A, 0x90, 0x19 ),
+    BYTES_TO_T_UINT_8( 0x2D, 0x8D, 0xD1, 0x21, 0x26, 0xF7, 0xC1, 0xF3 ),
+    BYTES_TO_T_UINT_8( 0x29, 0x0E, 0xAF, 0xA6, 0xC5, 0x49, 0x22, 0xA4 ),
+    BYTES_TO_T_UINT_8( 0x4B, 0xEF, 0x44, 0x50, 0xB8, 0x09, 0xE2, 0xB6 ),
+    BYTES_TO_T_UINT_8( 0x10, 0x7C, 0x30, 0x40, 0x98, 0x0D, 0xDA, 0x24 ),
+    BYTES_TO_T_UINT_8( 0x66, 0x5C, 0x1F, 0xEA, 0x72, 0xA4, 0x28, 0x0C ),
+    /* T[29].X, T[29].Y */
+    BYTES_TO_T_UINT_8( 0x43, 0xCD, 0xCC, 0x85, 0x9F, 0x32, 0x18, 0x88 ),
+    BYTES_TO_T_UINT_8( 0x76, 0x32, 0x95, 0x51, 0xF2, 0xFE, 0x2B, 0xD9 ),
+    BYTES_TO_T_UINT_8( 0xF2, 0xF3, 0x15, 0xC1, 0x71, 0x7F, 0x17, 0x3D ),
+    BYTES_TO_T_UINT_8( 0x04, 0xE0, 0xEC, 0xCC, 0x77, 0xAA, 0x90, 0x48 ),
+    BYTES_TO_T_UINT_8( 0x3E, 0xAE, 0xDF, 0x7D, 0xDE, 0x75, 0x33, 0xE9 ),
+    BYTES_TO_T_UINT_8( 0xB1, 0x99, 0x2D, 0xDD, 0x75, 0x04, 0x6D, 0x1E ),
+    BYTES_TO_T_UINT_8( 0x24, 0xF6, 0xFD, 0xE3, 0xAB, 0x69, 0x90, 0xC4 ),
+    BYTES_TO_T_UINT_8( 0xE9, 0x75, 0x58, 0x41, 0xBA, 0x3B, 0x2B, 0x95 ),
+    BYTES_TO_T_UINT_8( 0x3C, 0xA9, 0xEB, 0x77, 0x06, 0xB5, 0x6F, 0xC9 ),
+    BYTES_TO_T_UINT_8( 0x0B, 0x38, 0x23, 0x9C, 0x2F, 0x66, 0x68, 0x56 ),
+    BYTES_TO_T_UINT_8( 0xEC, 0x84, 0xD7, 0x99, 0x78, 0xCE, 0x08, 0x27 ),
+    BYTES_TO_T_UINT_8( 0x3C, 0x7E, 0xC5, 0xAA, 0xA0, 0x7E, 0xAB, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0x4A, 0x22, 0x73, 0xE3, 0xE6, 0x63, 0x7A, 0x26 ),
+    BYTES_TO_T_UINT_8( 0xDE, 0xD1, 0x83, 0x62, 0x39, 0xCC, 0xAE, 0x7A ),
+    BYTES_TO_T_UINT_8( 0x97, 0x2F, 0x6E, 0x20, 0xEE, 0x80, 0x24, 0x4C ),
+    BYTES_TO_T_UINT_8( 0x0F, 0x12, 0x20, 0x58, 0x79, 0x54, 0xBC, 0x34 ),
+    /* T[30].X, T[30].Y */
+    BYTES_TO_T_UINT_8( 0x34, 0xCD, 0xAE, 0x52, 0x75, 0x40, 0x35, 0xDE ),
+    BYTES_TO_T_UINT_8( 0xED, 0xD4, 0x9F, 0xE9, 0xE8, 0x7D, 0x4A, 0x55 ),
+    BYTES_TO_T_UINT_8( 0x54, 0x66, 0x40, 0xF3, 0x6A, 0x9A, 0x98, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0xC3, 0x06, 0xE9, 0x82, 0x5E, 0x0B, 0x07, 0xCD ),
+    BYTES_TO_T_UINT_8( 0xDC, 0x6C, 0xD4, 0xA6, 0xAA, 0xB8, 0x26, 0xB3 ),
+    BYTES_TO_T_UINT_8( 0xFB, 0xFC, 0x96, 0xC2, 0xEF, 0x40, 0x0F, 0x38 ),
+    BYTES_TO_T_UINT_8( 0x61, 0x60, 0xF9, 0xF4, 0x56, 0x1D, 0x05, 0x78 ),
+    BYTES_TO_T_UINT_8( 0xDD, 0xBF, 0x4C, 0x16, 0xA3, 0x4F, 0x34, 0x55 ),
+    BYTES_TO_T_UINT_8( 0x49, 0x51, 0xB4, 0xF2, 0xDB, 0x16, 0x9A, 0x9D ),
+    BYTES_TO_T_UINT_8( 0x28, 0xFC, 0x84, 0xEC, 0xE6, 0x10, 0x8F, 0xB5 ),
+    BYTES_TO_T_UINT_8( 0xE8, 0xBE, 0xAA, 0x75, 0x76, 0x1E, 0x8E, 0xBE ),
+    BYTES_TO_T_UINT_8( 0xD5, 0xE8, 0x70, 0xA2, 0xB2, 0x22, 0xEC, 0xDB ),
+    BYTES_TO_T_UINT_8( 0x4D, 0x9F, 0x4F, 0xEC, 0x88, 0x5B, 0xCB, 0x5C ),
+    BYTES_TO_T_UINT_8( 0xCC, 0x7D, 0x85, 0xDF, 0xF2, 0x6D, 0x53, 0x53 ),
+    BYTES_TO_T_UINT_8( 0x4C, 0x27, 0x12, 0x7B, 0x56, 0x2A, 0x85, 0x58 ),
+    BYTES_TO_T_UINT_8( 0xF9, 0xFE, 0xFE, 0xC1, 0xEB, 0x34, 0x95, 0x14 ),
+    /* T[31].X, T[31].Y */
+    BYTES_TO_T_UINT_8( 0x46, 0xB6, 0x88, 0x38, 0xBB, 0x47, 0x83, 0xDB ),
+    BYTES_TO_T_UINT_8( 0x27, 0xBD, 0x5D, 0x2B, 0x36, 0xFC, 0xD8, 0x83 ),
+    BYTES_TO_T_UINT_8( 0x5F, 0xAC, 0xEC, 0x05, 0x6A, 0x58, 0x5D, 0x00 ),
+    BYTES_TO_T_UINT_8( 0x1A, 0x52, 0x45, 0x6A, 0x55, 0x55, 0xD0, 0xD3 ),
+    BYTES_TO_T_UINT_8( 0xB6, 0x8E, 0xE2, 0x33, 0x0A, 0x13, 0x75, 0x3B ),
+    BYTES_TO_T_UINT_8( 0x23, 0x1F, 0x0E, 0x66, 0x06, 0xA3, 0xD2, 0x87 ),
+    BYTES_TO_T_UINT_8( 0xB9, 0x51, 0x78, 0xB8, 0x79, 0xFD, 0xCE, 0xA7 ),
+    BYTES_TO_T_UINT_8( 0x88, 0x70, 0x9F, 0xF0, 0x61, 0x88, 0x73, 0x29 ),
+    BYTES_TO_T_UINT_8( 0x6B, 0x35, 0xE9, 0xBB, 0xF5, 0x71, 0xCE, 0x6B ),
+    BYTES_TO_T_UINT_8( 0xE5, 0xF8, 0x12, 0x0F, 0x66, 0xC7, 0x7A, 0x2E ),
+    BYTES_TO_T_UINT_8( 0x43, 0xAC, 0xDA, 0x06, 0xE1, 0x4E, 0xBA, 0xA8 ),
+    BYTES_TO_T_UINT_8( 0x6B, 0xF2, 0x82, 0x7E, 0x31, 0x7C, 0x47, 0x0F ),
+    BYTES_TO_T_UINT_8( 0x21, 0x4A, 0xB3, 0x8A, 0xE8, 0x98, 0xB2, 0x9F ),
+    BYTES_TO_T_UINT_8( 0xAE, 0xBC, 0x44, 0x43, 0xF8, 0x3E, 0xF3, 0x6E ),
+    BYTES_TO_T_UINT_8( 0x09, 0x9D, 0x8F, 0x05, 0xE3, 0x22, 0xDE, 0xB7 ),
+    BYTES_TO_T_UINT_8( 0x57, 0x96, 0x24, 0xDC, 0xF3, 0x50, 0x4B, 0x18 ),
+};
+static const mbedtls_ecp_point brainpoolP512r1_T[32] = {
+    ECP_COMB_POINT( brainpoolP512r1, 0 ),
+    ECP_COMB_POINT( brainpoolP512r1, 1 ),
+    ECP_COMB_POINT( brainpoolP512r1, 2 ),
+    ECP_COMB_POINT( brainpoolP512r1, 3 ),
+    ECP_COMB_POINT( brainpoolP512r1, 4 ),
+    ECP_COMB_POINT( brainpoolP512r1, 5 ),
+    ECP_COMB_POINT( brainpoolP512r1, 6 ),
+    ECP_COMB_POINT( brainpoolP512r1, 7 ),
+    ECP_COMB_POINT( brainpoolP512r1, 8 ),
+    ECP_COMB_POINT( brainpoolP512r1, 9 ),
+    ECP_COMB_POINT( brainpoolP512r1, 10 ),
+    ECP_COMB_POINT( brainpoolP512r1, 11 ),
+    ECP_COMB_POINT( brainpoolP512r1, 12 ),
+    ECP_COMB_POINT( brainpoolP512r1, 13 ),
+    ECP_COMB_POINT( brainpoolP512r1, 14 ),
+    ECP_COMB_POINT( brainpoolP512r1, 15 ),
+    ECP_COMB_POINT( brainpoolP512r1, 16 ),
+    ECP_COMB_POINT( brainpoolP512r1, 17 ),
+    ECP_COMB_POINT( brainpoolP512r1, 18 ),
+    ECP_COMB_POINT( brainpoolP512r1, 19 ),
+    ECP_COMB_POINT( brainpoolP512r1, 20 ),
+    ECP_COMB_POINT( brainpoolP512r1, 21 ),
+    ECP_COMB_POINT( brainpoolP512r1, 22 ),
+    ECP_COMB_POINT( brainpoolP512r1, 23 ),
+    ECP_COMB_POINT( brainpoolP512r1, 24 ),
+    ECP_COMB_POINT( brainpoolP512r1, 25 ),
+    ECP_COMB_POINT( brainpoolP512r1, 26 ),
+    ECP_COMB_POINT( brainpoolP512r1, 27 ),
+    ECP_COMB_POINT( brainpoolP512r1, 28 ),
+    ECP_COMB_POINT( brainpoolP512r1, 29 ),
+    ECP_COMB_POINT( brainpoolP512r1, 30 ),
+    ECP_COMB_POINT( brainpoolP512r1, 31 ),
+};
+#endif /* MBEDTLS_ECP_INTERNAL_ALT */
+#endif /* MBEDTLS_ECP_FIXED_POINT_OPTIM */
 #endif /* MBEDTLS_ECP_DP_BP512R1_ENABLED */
 
 /*
@@ -571,6 +3870,49 @@ static inline void ecp_mpi_set1( mbedtls_mpi *X )
     X->p = one;
 }
 
+/*
+ * Set up Montgomery reduction mod P for a curve without a fast reduction,
+ * and the constants that ecp.c then needs in Montgomery form (see
+ * ECP_MONT() there). Alternative implementations get Barrett reduction and
+ * field elements in normal form instead.
+ */
+static int ecp_mont_setup( mbedtls_ecp_group *grp )
+{
+    int ret;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_setup( &grp->P_mod, &grp->P ) );
+
+#if defined(MBEDTLS_ECP_P256_FAST)
+    /* ecp_p256.c has its own arithmetic and reads key tables in normal form */
+    if( grp->id == MBEDTLS_ECP_DP_SECP256R1 )
+        return( 0 );
+#endif
+#if defined(MBEDTLS_ECP_P384_FAST)
+    /* Same for ecp_p384.c */
+    if( grp->id == MBEDTLS_ECP_DP_SECP384R1 )
+        return( 0 );
+#endif
+
+#if !defined(MBEDTLS_ECP_INTERNAL_ALT)
+    /* R mod P is the reduction of R^2, then x R mod P = x (R mod P) mod P */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_montred( &grp->mont_one, &grp->P_mod.RR,
+                                              &grp->P_mod ) );
+
+    if( grp->A.p == NULL )
+        MBEDTLS_MPI_CHK( mbedtls_mpi_sub_int( &grp->mont_A, &grp->P, 3 ) );
+    else
+        MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &grp->mont_A, &grp->A ) );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mul( &grp->mont_A, &grp->mont_A,
+                                          &grp->mont_one, &grp->P_mod ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mul( &grp->mont_B, &grp->B,
+                                          &grp->mont_one, &grp->P_mod ) );
+#endif
+
+cleanup:
+    return( ret );
+}
+
 /*
  * Make group available from embedded constants
  */
@@ -580,7 +3922,8 @@ static int ecp_group_load( mbedtls_ecp_group *grp,
                            const mbedtls_mpi_uint *b,  size_t blen,
                            const mbedtls_mpi_uint *gx, size_t gxlen,
                            const mbedtls_mpi_uint *gy, size_t gylen,
-                           const mbedtls_mpi_uint *n,  size_t nlen)
+                           const mbedtls_mpi_uint *n,  size_t nlen,
+                           const mbedtls_ecp_point *T )
 {
     ecp_mpi_load( &grp->P, p, plen );
     if( a != NULL )
@@ -597,6 +3940,13 @@ static int ecp_group_load( mbedtls_ecp_group *grp,
 
     grp->h = 1;
 
+    /* T_size == 0 marks a static table, see mbedtls_ecp_group_free() */
+    grp->T = (mbedtls_ecp_point *) T;
+    grp->T_size = 0;
+
+    if( grp->modp == NULL )
+        return( ecp_mont_setup( grp ) );
+
     return( 0 );
 }
 
@@ -627,6 +3977,9 @@ static int ecp_mod_p521( mbedtls_mpi * );
 #if defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED)
 static int ecp_mod_p255( mbedtls_mpi * );
 #endif
+#if defined(MBEDTLS_ECP_DP_CURVE448_ENABLED)
+static int ecp_mod_p448( mbedtls_mpi * );
+#endif
 #if defined(MBEDTLS_ECP_DP_SECP192K1_ENABLED)
 static int ecp_mod_p192k1( mbedtls_mpi * );
 #endif
@@ -643,7 +3996,8 @@ static int ecp_mod_p256k1( mbedtls_mpi * );
                             G ## _b,  sizeof( G ## _b  ),   \
                             G ## _gx, sizeof( G ## _gx ),   \
                             G ## _gy, sizeof( G ## _gy ),   \
-                            G ## _n,  sizeof( G ## _n  ) )
+                            G ## _n,  sizeof( G ## _n  ),   \
+                            ECP_COMB_TABLE( G ) )
 
 #define LOAD_GROUP( G )     ecp_group_load( grp,            \
                             G ## _p,  sizeof( G ## _p  ),   \
@@ -651,7 +4005,8 @@ static int ecp_mod_p256k1( mbedtls_mpi * );
                             G ## _b,  sizeof( G ## _b  ),   \
                             G ## _gx, sizeof( G ## _gx ),   \
                             G ## _gy, sizeof( G ## _gy ),   \
-                            G ## _n,  sizeof( G ## _n  ) )
+                            G ## _n,  sizeof( G ## _n  ),   \
+                            ECP_NIST_TABLE( G ) )
 
 #if defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED)
 /*
@@ -687,6 +4042,42 @@ cleanup:
 }
 #endif /* MBEDTLS_ECP_DP_CURVE25519_ENABLED */
 
+#if defined(MBEDTLS_ECP_DP_CURVE448_ENABLED)
+/*
+ * Specialized function for creating the Curve448 group
+ */
+static int ecp_use_curve448( mbedtls_ecp_group *grp )
+{
+    int ret;
+
+    /* Actually ( A + 2 ) / 4 */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_read_string( &grp->A, 16, "98AA" ) );
+
+    /* P = 2^448 - 2^224 - 1 */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &grp->P, 1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &grp->P, 224 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_int( &grp->P, &grp->P, 1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &grp->P, 224 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_sub_int( &grp->P, &grp->P, 1 ) );
+    grp->pbits = mbedtls_mpi_bitlen( &grp->P );
+
+    /* Y intentionaly not set, since we use x/z coordinates.
+     * This is used as a marker to identify Montgomery curves! */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &grp->G.X, 5 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &grp->G.Z, 1 ) );
+    mbedtls_mpi_free( &grp->G.Y );
+
+    /* Actually, the required msb for private keys */
+    grp->nbits = 447;
+
+cleanup:
+    if( ret != 0 )
+        mbedtls_ecp_group_free( grp );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECP_DP_CURVE448_ENABLED */
+
 /*
  * Set a group using well-known domain parameters
  */
@@ -767,6 +4158,12 @@ int mbedtls_ecp_group_load( mbedtls_ecp_group *grp, mbedtls_ecp_group_id id )
             return( ecp_use_curve25519( grp ) );
 #endif /* MBEDTLS_ECP_DP_CURVE25519_ENABLED */
 
+#if defined(MBEDTLS_ECP_DP_CURVE448_ENABLED)
+        case MBEDTLS_ECP_DP_CURVE448:
+            grp->modp = ecp_mod_p448;
+            return( ecp_use_curve448( grp ) );
+#endif /* MBEDTLS_ECP_DP_CURVE448_ENABLED */
+
         default:
             mbedtls_ecp_group_free( grp );
             return( MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE );
@@ -1197,6 +4594,75 @@ cleanup:
 }
 #endif /* MBEDTLS_ECP_DP_CURVE25519_ENABLED */
 
+#if defined(MBEDTLS_ECP_DP_CURVE448_ENABLED)
+
+/* Size of p448 in terms of mbedtls_mpi_uint */
+#define P448_WIDTH      ( 448 / 8 / sizeof( mbedtls_mpi_uint ) )
+
+/* Limbs spanned by 224 bits, and bits used in the last of them (0 = all) */
+#define P448_HALF_WIDTH ( ( 224 / 8 + sizeof( mbedtls_mpi_uint ) - 1 ) /    \
+                          sizeof( mbedtls_mpi_uint ) )
+#define P448_HALF_BITS  ( 224 % ( 8 * sizeof( mbedtls_mpi_uint ) ) )
+
+/*
+ * Fast quasi-reduction modulo p448 = 2^448 - 2^224 - 1
+ * Write N as A0 + 2^448 A1 and A1 as B0 + 2^224 B1, return
+ * A0 + A1 + B1 + 2^224 (B0 + B1), using 2^448 = 2^224 + 1 twice.
+ */
+static int ecp_mod_p448( mbedtls_mpi *N )
+{
+    int ret;
+    size_t i;
+    mbedtls_mpi M, Q;
+    mbedtls_mpi_uint Mp[P448_WIDTH + 1], Qp[P448_WIDTH];
+
+    if( N->n <= P448_WIDTH )
+        return( 0 );
+
+    /* M = A1 (N is at most 896 bits, upper limbs are zero) */
+    M.s = 1;
+    M.n = N->n - P448_WIDTH;
+    if( M.n > P448_WIDTH )
+        M.n = P448_WIDTH;
+    M.p = Mp;
+    memset( Mp, 0, sizeof Mp );
+    memcpy( Mp, N->p + P448_WIDTH, M.n * sizeof( mbedtls_mpi_uint ) );
+
+    /* N = A0 */
+    for( i = P448_WIDTH; i < N->n; i++ )
+        N->p[i] = 0;
+
+    /* N = A0 + A1 */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_abs( N, N, &M ) );
+
+    /* Q = B1, N = A0 + A1 + B1 */
+    Q = M;
+    Q.p = Qp;
+    memcpy( Qp, Mp, sizeof Qp );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &Q, 224 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_abs( N, N, &Q ) );
+
+    /* M = B0 + B1, below 2^225 */
+    for( i = P448_HALF_WIDTH; i < M.n; i++ )
+        Mp[i] = 0;
+    if( P448_HALF_BITS != 0 )
+        Mp[P448_HALF_WIDTH - 1] &= ( (mbedtls_mpi_uint) 1 << P448_HALF_BITS ) - 1;
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_abs( &M, &M, &Q ) );
+
+    /* N += 2^224 M */
+    M.n = P448_WIDTH + 1; /* Make room for the shift */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( &M, 224 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_abs( N, N, &M ) );
+
+cleanup:
+    return( ret );
+}
+
+#undef P448_WIDTH
+#undef P448_HALF_WIDTH
+#undef P448_HALF_BITS
+#endif /* MBEDTLS_ECP_DP_CURVE448_ENABLED */
+
 #if defined(MBEDTLS_ECP_DP_SECP192K1_ENABLED) ||   \
     defined(MBEDTLS_ECP_DP_SECP224K1_ENABLED) ||   \
     defined(MBEDTLS_ECP_DP_SECP256K1_ENABLED)
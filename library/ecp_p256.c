@@ -0,0 +1,993 @@
+/*
+ *  Elliptic curves over GF(p): dedicated secp256r1 arithmetic
+ *
+ *  Copyright (C) 2006-2017, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+
+/*
+ * References:
+ *
+ * FIPS 186-3 D.1.2.3 (curve parameters)
+ * S. Gueron, V. Krasnov, Fast prime field elliptic-curve cryptography with
+ *     256-bit primes, J. Cryptographic Engineering 5 (2015) 141-151
+ * Explicit-Formulas Database, http://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ECP_C) && defined(MBEDTLS_ECP_P256_FAST) && \
+    defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED) && \
+    !defined(MBEDTLS_ECP_ALT)
+
+#include "mbedtls/ecp_p256.h"
+
+#include <string.h>
+
+#if defined(MBEDTLS_PLATFORM_C)
+#include "mbedtls/platform.h"
+#else
+#include <stdlib.h>
+#define mbedtls_calloc    calloc
+#define mbedtls_free       free
+#endif
+
+#if ( defined(__ARMCC_VERSION) || defined(_MSC_VER) ) && \
+    !defined(inline) && !defined(__cplusplus)
+#define inline __inline
+#endif
+
+/* Implementation that should never be optimized out by the compiler */
+static void mbedtls_zeroize( void *v, size_t n ) {
+    volatile unsigned char *p = v; while( n-- ) *p++ = 0;
+}
+
+#if defined(_MSC_VER) || defined(__WATCOMC__)
+  #define UL64(x) x##ui64
+#else
+  #define UL64(x) x##ULL
+#endif
+
+/*
+ * Field elements are four 64-bit limbs, least significant first, always
+ * fully reduced and kept in the Montgomery domain (a stands for a * 2^256
+ * mod p). Points are in Jacobian coordinates, with Z = 0 for the point at
+ * infinity. Nothing below branches on, or indexes memory with, secret data,
+ * except the doubling case of p256_point_add() (see there).
+ */
+typedef uint64_t p256_fe[4];
+
+typedef struct
+{
+    p256_fe X, Y, Z;
+}
+p256_point;
+
+typedef struct
+{
+    p256_fe x, y;
+}
+p256_affine;
+
+static const p256_fe p256_p = {
+    UL64(0xFFFFFFFFFFFFFFFF), UL64(0x00000000FFFFFFFF),
+    UL64(0x0000000000000000), UL64(0xFFFFFFFF00000001) };
+
+/* 2^512 mod p, to enter the Montgomery domain */
+static const p256_fe p256_rr = { UL64(0x0000000000000003), UL64(0xFFFFFFFBFFFFFFFF), UL64(0xFFFFFFFFFFFFFFFE), UL64(0x00000004FFFFFFFD) };
+
+/* 2^256 mod p, that is 1 in the Montgomery domain */
+static const p256_fe p256_one = { UL64(0x0000000000000001), UL64(0xFFFFFFFF00000000), UL64(0xFFFFFFFFFFFFFFFF), UL64(0x00000000FFFFFFFE) };
+
+/*
+ * Comb tables for the generator: entry i - 1 of p256_g_table[t] is
+ * sum( b_j * 2^(64 j + 32 t) * G ) over the bits b_j of i, 0 <= j < 4,
+ * in affine coordinates
+ */
+static const p256_affine p256_g_table[2][15] = {
+  {
+    { { UL64(0x79E730D418A9143C), UL64(0x75BA95FC5FEDB601), UL64(0x79FB732B77622510), UL64(0x18905F76A53755C6) },
+      { UL64(0xDDF25357CE95560A), UL64(0x8B4AB8E4BA19E45C), UL64(0xD2E88688DD21F325), UL64(0x8571FF1825885D85) } },
+    { { UL64(0x4F922FC516A0D2BB), UL64(0x0D5CC16C1A623499), UL64(0x9241CF3A57C62C8B), UL64(0x2F5E6961FD1B667F) },
+      { UL64(0x5C15C70BF5A01797), UL64(0x3D20B44D60956192), UL64(0x04911B37071FDB52), UL64(0xF648F9168D6F0F7B) } },
+    { { UL64(0x9E566847E137BBBC), UL64(0xE434469E8A6A0BEC), UL64(0xB1C4276179D73463), UL64(0x5ABE0285133D0015) },
+      { UL64(0x92AA837CC04C7DAB), UL64(0x573D9F4C43260C07), UL64(0x0C93156278E6CC37), UL64(0x94BB725B6B6F7383) } },
+    { { UL64(0x62A8C244BFE20925), UL64(0x91C19AC38FDCE867), UL64(0x5A96A5D5DD387063), UL64(0x61D587D421D324F6) },
+      { UL64(0xE87673A2A37173EA), UL64(0x2384800853778B65), UL64(0x10F8441E05BAB43E), UL64(0xFA11FE124621EFBE) } },
+    { { UL64(0x1C891F2B2CB19FFD), UL64(0x01BA8D5BB1923C23), UL64(0xB6D03D678AC5CA8E), UL64(0x586EB04C1F13BEDC) },
+      { UL64(0x0C35C6E527E8ED09), UL64(0x1E81A33C1819EDE2), UL64(0x278FD6C056C652FA), UL64(0x19D5AC0870864F11) } },
+    { { UL64(0x62577734D2B533D5), UL64(0x673B8AF6A1BDDDC0), UL64(0x577E7C9AA79EC293), UL64(0xBB6DE651C3B266B1) },
+      { UL64(0xE7E9303AB65259B3), UL64(0xD6A0AFD3D03A7480), UL64(0xC5AC83D19B3CFC27), UL64(0x60B4619A5D18B99B) } },
+    { { UL64(0xBD6A38E11AE5AA1C), UL64(0xB8B7652B49E73658), UL64(0x0B130014EE5F87ED), UL64(0x9D0F27B2AEEBFFCD) },
+      { UL64(0xCA9246317A730A55), UL64(0x9C955B2FDDBBC83A), UL64(0x07C1DFE0AC019A71), UL64(0x244A566D356EC48D) } },
+    { { UL64(0x56F8410EF4F8B16A), UL64(0x97241AFEC47B266A), UL64(0x0A406B8E6D9C87C1), UL64(0x803F3E02CD42AB1B) },
+      { UL64(0x7F0309A804DBEC69), UL64(0xA83B85F73BBAD05F), UL64(0xC6097273AD8E197F), UL64(0xC097440E5067ADC1) } },
+    { { UL64(0x846A56F2C379AB34), UL64(0xA8EE068B841DF8D1), UL64(0x20314459176C68EF), UL64(0xF1AF32D5915F1F30) },
+      { UL64(0x99C375315D75BD50), UL64(0x837CFFBAF72F67BC), UL64(0x0613A41848D7723F), UL64(0x23D0F130E2D41C8B) } },
+    { { UL64(0xED93E225D5BE5A2B), UL64(0x6FE799835934F3C6), UL64(0x4314092622626FFC), UL64(0x50BBB4D97990216A) },
+      { UL64(0x378191C6E57EC63E), UL64(0x65422C40181DCDB2), UL64(0x41A8099B0236E0F6), UL64(0x2B10011801FE49C3) } },
+    { { UL64(0xFC68B5C59B391593), UL64(0xC385F5A2598270FC), UL64(0x7144F3AAD19ADCBB), UL64(0xDD55899983FBAE0C) },
+      { UL64(0x93B88B8E74B82FF4), UL64(0xD2E03C4071E734C9), UL64(0x9A7A9EAF43C0322A), UL64(0xE6E4C551149D6041) } },
+    { { UL64(0x5FE14BFE80EC21FE), UL64(0xF6CE116AC255BE82), UL64(0x98BC5A072F4A5D67), UL64(0xFAD27148DB7E63AF) },
+      { UL64(0x90C0B6AC29AB05B3), UL64(0x37A9A83C4E251AE6), UL64(0x0A7DC875C2AADE7D), UL64(0x77387DE39F0E1A84) } },
+    { { UL64(0x1E9ECC49A56C0DD7), UL64(0xA5CFFCD846086C74), UL64(0x8F7A1408F505AECE), UL64(0xB37B85C0BEF0C47E) },
+      { UL64(0x3596B6E4CC0E6A8F), UL64(0xFD6D4BBF6B388F23), UL64(0xABA453FAC39CEF4E), UL64(0x9C135AC8F9F628D5) } },
+    { { UL64(0x0A1C729495C8F8BE), UL64(0x2961C4803BF362BF), UL64(0x9E418403DF63D4AC), UL64(0xC109F9CB91ECE900) },
+      { UL64(0xC2D095D058945705), UL64(0xB9083D96DDEB85C0), UL64(0x84692B8D7A40449B), UL64(0x9BC3344F2EEE1EE1) } },
+    { { UL64(0x0D5AE35642913074), UL64(0x55491B2748A542B1), UL64(0x469CA665B310732A), UL64(0x29591D525F1A4CC1) },
+      { UL64(0xE76F5B6BB84F983F), UL64(0xBE7EEF419F5F84E1), UL64(0x1200D49680BAA189), UL64(0x6376551F18EF332C) } }
+  },
+  {
+    { { UL64(0x202886024147519A), UL64(0xD0981EAC26B372F0), UL64(0xA9D4A7CAA785EBC8), UL64(0xD953C50DDBDF58E9) },
+      { UL64(0x9D6361CCFD590F8F), UL64(0x72E9626B44E6C917), UL64(0x7FD9611022EB64CF), UL64(0x863EBB7E9EB288F3) } },
+    { { UL64(0x4FE7EE31B0E63D34), UL64(0xF4600572A9E54FAB), UL64(0xC0493334D5E7B5A4), UL64(0x8589FB9206D54831) },
+      { UL64(0xAA70F5CC6583553A), UL64(0x0879094AE25649E5), UL64(0xCC90450710044652), UL64(0xEBB0696D02541C4F) } },
+    { { UL64(0xABBAA0C03B89DA99), UL64(0xA6F2D79EB8284022), UL64(0x27847862B81C05E8), UL64(0x337A4B5905E54D63) },
+      { UL64(0x3C67500D21F7794A), UL64(0x207005B77D6D7F61), UL64(0x0A5A378104CFD6E8), UL64(0x0D65E0D5F4C2FBD6) } },
+    { { UL64(0xD433E50F6D3549CF), UL64(0x6F33696FFACD665E), UL64(0x695BFDACCE11FCB4), UL64(0x810EE252AF7C9860) },
+      { UL64(0x65450FE17159BB2C), UL64(0xF7DFBEBE758B357B), UL64(0x2B057E74D69FEA72), UL64(0xD485717A92731745) } },
+    { { UL64(0xCE1F69BBE83F7669), UL64(0x09F8AE8272877D6B), UL64(0x9548AE543244278D), UL64(0x207755DEE3C2C19C) },
+      { UL64(0x87BD61D96FEF1945), UL64(0x18813CEFB12D28C3), UL64(0x9FBCD1D672DF64AA), UL64(0x48DC5EE57154B00D) } },
+    { { UL64(0xEF0F469EF49A3154), UL64(0x3E85A5956E2B2E9A), UL64(0x45AAEC1EAA924A9C), UL64(0xAA12DFC8A09E4719) },
+      { UL64(0x26F272274DF69F1D), UL64(0xE0E4C82CA2FF5E73), UL64(0xB9D8CE73B7A9DD44), UL64(0x6C036E73E48CA901) } },
+    { { UL64(0xE1E421E1A47153F0), UL64(0xB86C3B79920418C9), UL64(0x93BDCE87705D7672), UL64(0xF25AE793CAB79A77) },
+      { UL64(0x1F3194A36D869D0C), UL64(0x9D55C8824986C264), UL64(0x49FB5EA3096E945E), UL64(0x39B8E65313DB0A3E) } },
+    { { UL64(0xE3417BC035D0B34A), UL64(0x440B386B8327C0A7), UL64(0x8FB7262DAC0362D1), UL64(0x2C41114CE0CDF943) },
+      { UL64(0x2BA5CEF1AD95A0B1), UL64(0xC09B37A867D54362), UL64(0x26D6CDD201E486C9), UL64(0x20477ABF42FF9297) } },
+    { { UL64(0x0F121B41BC0A67D2), UL64(0x62D4760A444D248A), UL64(0x0E044F1D659B4737), UL64(0x08FDE365250BB4A8) },
+      { UL64(0xACEEC3DA848BF287), UL64(0xC2A62182D3369D6E), UL64(0x3582DFDC92449482), UL64(0x2F7E2FD2565D6CD7) } },
+    { { UL64(0x0A0122B5178A876B), UL64(0x51FF96FF085104B4), UL64(0x050B31AB14F29F76), UL64(0x84ABB28B5F87D4E6) },
+      { UL64(0xD5ED439F8270790A), UL64(0x2D6CB59D85E3F46B), UL64(0x75F55C1B6C1E2212), UL64(0xE5436F6717655640) } },
+    { { UL64(0xC2965ECC9AEB596D), UL64(0x01EA03E7023C92B4), UL64(0x4704B4B62E013961), UL64(0x0CA8FD3F905EA367) },
+      { UL64(0x92523A42551B2B61), UL64(0x1EB7A89C390FCD06), UL64(0xE7F1D2BE0392A63E), UL64(0x96DCA2644DDB0C33) } },
+    { { UL64(0x231C210E15339848), UL64(0xE87A28E870778C8D), UL64(0x9D1DE6616956E170), UL64(0x4AC3C9382BB09C0B) },
+      { UL64(0x19BE05516998987D), UL64(0x8B2376C4AE09F4D6), UL64(0x1DE0B7651A3F933D), UL64(0x380D94C7E39705F4) } },
+    { { UL64(0x3685954B8C31C31D), UL64(0x68533D005BF21A0C), UL64(0x0BD7626E75C79EC9), UL64(0xCA17754742C69D54) },
+      { UL64(0xCC6EDAFFF6D2DBB2), UL64(0xFD0D8CBD174A9D18), UL64(0x875E8793AA4578E8), UL64(0xA976A7139CAB2CE6) } },
+    { { UL64(0xCE37AB11B43EA1DB), UL64(0x0A7FF1A95259D292), UL64(0x851B02218F84F186), UL64(0xA7222BEADEFAAD13) },
+      { UL64(0xA2AC78EC2B0A9144), UL64(0x5A024051F2FA59C5), UL64(0x91D1ECA56147CE38), UL64(0xBE94D523BC2AC690) } },
+    { { UL64(0x2D8DAEFD79EC1A0F), UL64(0x3BBCD6FDCEB39C97), UL64(0xF5575FFC58F61A95), UL64(0xDBD986C4ADF7B420) },
+      { UL64(0x81AA881415F39EB7), UL64(0x6EE2FCF5B98D976C), UL64(0x5465475DCF2F717D), UL64(0x8E24D3C46860BBD0) } }
+  }
+};
+
+/*
+ * 64 x 64 -> 128-bit multiplication
+ */
+#if defined(MBEDTLS_HAVE_INT64) && defined(MBEDTLS_HAVE_UDBL)
+static inline void p256_mul64( uint64_t a, uint64_t b,
+                               uint64_t *lo, uint64_t *hi )
+{
+    mbedtls_t_udbl r = (mbedtls_t_udbl) a * b;
+
+    *lo = (uint64_t) r;
+    *hi = (uint64_t)( r >> 64 );
+}
+#else
+static inline void p256_mul64( uint64_t a, uint64_t b,
+                               uint64_t *lo, uint64_t *hi )
+{
+    uint64_t a0 = a & 0xFFFFFFFF, a1 = a >> 32;
+    uint64_t b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+    uint64_t t, u, v;
+
+    t = a0 * b0;
+    u = a1 * b0 + ( t >> 32 );
+    v = a0 * b1 + ( u & 0xFFFFFFFF );
+
+    *lo = ( v << 32 ) | ( t & 0xFFFFFFFF );
+    *hi = a1 * b1 + ( u >> 32 ) + ( v >> 32 );
+}
+#endif
+
+/*
+ * r = t - p if t >= p, else t, where t = t[0..3] + 2^256 * c and t < 2p
+ */
+static void p256_reduce_once( p256_fe r, const uint64_t t[4], uint64_t c )
+{
+    uint64_t d[4], b = 0, x, mask;
+    size_t i;
+
+    for( i = 0; i < 4; i++ )
+    {
+        x = t[i] - p256_p[i];
+        d[i] = x - b;
+        b = ( t[i] < p256_p[i] ) | ( x < b );
+    }
+
+    /* t < p exactly when the borrow is not absorbed by c */
+    mask = (uint64_t) 0 - ( b & ( c ^ 1 ) );
+
+    for( i = 0; i < 4; i++ )
+        r[i] = ( t[i] & mask ) | ( d[i] & ~mask );
+}
+
+static void p256_add( p256_fe r, const p256_fe a, const p256_fe b )
+{
+    uint64_t t[4], c = 0, x;
+    size_t i;
+
+    for( i = 0; i < 4; i++ )
+    {
+        x = a[i] + c;
+        c = ( x < c );
+        t[i] = x + b[i];
+        c += ( t[i] < x );
+    }
+
+    p256_reduce_once( r, t, c );
+}
+
+static void p256_sub( p256_fe r, const p256_fe a, const p256_fe b )
+{
+    uint64_t t[4], br = 0, c = 0, x, mask;
+    size_t i;
+
+    for( i = 0; i < 4; i++ )
+    {
+        x = a[i] - b[i];
+        t[i] = x - br;
+        br = ( a[i] < b[i] ) | ( x < br );
+    }
+
+    /* Add p back if the result went negative */
+    mask = (uint64_t) 0 - br;
+
+    for( i = 0; i < 4; i++ )
+    {
+        x = t[i] + c;
+        c = ( x < c );
+        r[i] = x + ( p256_p[i] & mask );
+        c += ( r[i] < x );
+    }
+}
+
+/*
+ * Montgomery multiplication: r = a * b / 2^256 mod p (CIOS).
+ * -p^-1 mod 2^64 is 1, so the reduction factor of each round is t[0].
+ */
+static void p256_mul( p256_fe r, const p256_fe a, const p256_fe b )
+{
+    uint64_t t[6] = { 0, 0, 0, 0, 0, 0 };
+    uint64_t lo, hi, c, m;
+    size_t i, j;
+
+    for( i = 0; i < 4; i++ )
+    {
+        /* t += a * b[i] */
+        c = 0;
+        for( j = 0; j < 4; j++ )
+        {
+            p256_mul64( a[j], b[i], &lo, &hi );
+            lo += c;    hi += ( lo < c );
+            lo += t[j]; hi += ( lo < t[j] );
+            t[j] = lo;
+            c = hi;
+        }
+        t[4] += c;
+        t[5] = ( t[4] < c );
+
+        /* t = ( t + m * p ) / 2^64 */
+        m = t[0];
+        p256_mul64( m, p256_p[0], &lo, &hi );
+        lo += t[0];
+        c = hi + ( lo < t[0] );
+        for( j = 1; j < 4; j++ )
+        {
+            p256_mul64( m, p256_p[j], &lo, &hi );
+            lo += c;    hi += ( lo < c );
+            lo += t[j]; hi += ( lo < t[j] );
+            t[j - 1] = lo;
+            c = hi;
+        }
+        t[3] = t[4] + c;
+        t[4] = t[5] + ( t[3] < c );
+    }
+
+    p256_reduce_once( r, t, t[4] );
+}
+
+static void p256_sqr( p256_fe r, const p256_fe a )
+{
+    p256_mul( r, a, a );
+}
+
+/*
+ * r = a^(2^n), n >= 1
+ */
+static void p256_sqr_n( p256_fe r, const p256_fe a, size_t n )
+{
+    p256_sqr( r, a );
+    while( --n > 0 )
+        p256_sqr( r, r );
+}
+
+/*
+ * r = a^-1 = a^(p - 2), with the exponent
+ * p - 2 = 2^256 - 2^224 + 2^192 + 2^96 - 3 processed as
+ * [32 ones] [31 zeros, 1] [96 zeros] [64 ones] [30 ones] [0, 1]
+ */
+static void p256_inv( p256_fe r, const p256_fe a )
+{
+    p256_fe x2, x3, x6, x12, x15, x30, x32, t;
+
+    p256_sqr( x2, a );            p256_mul( x2, x2, a );
+    p256_sqr( x3, x2 );           p256_mul( x3, x3, a );
+    p256_sqr_n( x6, x3, 3 );      p256_mul( x6, x6, x3 );
+    p256_sqr_n( x12, x6, 6 );     p256_mul( x12, x12, x6 );
+    p256_sqr_n( x15, x12, 3 );    p256_mul( x15, x15, x3 );
+    p256_sqr_n( x30, x15, 15 );   p256_mul( x30, x30, x15 );
+    p256_sqr_n( x32, x30, 2 );    p256_mul( x32, x32, x2 );
+
+    p256_sqr_n( t, x32, 32 );     p256_mul( t, t, a );
+    p256_sqr_n( t, t, 128 );      p256_mul( t, t, x32 );
+    p256_sqr_n( t, t, 32 );       p256_mul( t, t, x32 );
+    p256_sqr_n( t, t, 30 );       p256_mul( t, t, x30 );
+    p256_sqr_n( t, t, 2 );        p256_mul( r, t, a );
+}
+
+/*
+ * All-ones if a == 0, zero otherwise
+ */
+static uint64_t p256_is_zero( const p256_fe a )
+{
+    uint64_t x = a[0] | a[1] | a[2] | a[3];
+
+    return( ( ( x | ( (uint64_t) 0 - x ) ) >> 63 ) - 1 );
+}
+
+/*
+ * r = a if mask is all-ones, unchanged if mask is zero
+ */
+static void p256_cmov( p256_fe r, const p256_fe a, uint64_t mask )
+{
+    size_t i;
+
+    for( i = 0; i < 4; i++ )
+        r[i] = ( r[i] & ~mask ) | ( a[i] & mask );
+}
+
+/*
+ * Conversions from and to MPIs, in and out of the Montgomery domain
+ */
+static int p256_from_mpi( p256_fe r, const mbedtls_mpi *X )
+{
+    int ret;
+    unsigned char buf[32];
+    size_t i;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( X, buf, sizeof( buf ) ) );
+
+    for( i = 0; i < 4; i++ )
+    {
+        r[i] = ( (uint64_t) buf[31 - 8 * i    ]       ) |
+               ( (uint64_t) buf[31 - 8 * i - 1] <<  8 ) |
+               ( (uint64_t) buf[31 - 8 * i - 2] << 16 ) |
+               ( (uint64_t) buf[31 - 8 * i - 3] << 24 ) |
+               ( (uint64_t) buf[31 - 8 * i - 4] << 32 ) |
+               ( (uint64_t) buf[31 - 8 * i - 5] << 40 ) |
+               ( (uint64_t) buf[31 - 8 * i - 6] << 48 ) |
+               ( (uint64_t) buf[31 - 8 * i - 7] << 56 );
+    }
+
+cleanup:
+    return( ret );
+}
+
+static int p256_to_mpi( mbedtls_mpi *X, const p256_fe a )
+{
+    unsigned char buf[32];
+    size_t i, j;
+
+    for( i = 0; i < 4; i++ )
+        for( j = 0; j < 8; j++ )
+            buf[31 - 8 * i - j] = (unsigned char)( a[i] >> ( 8 * j ) );
+
+    return( mbedtls_mpi_read_binary( X, buf, sizeof( buf ) ) );
+}
+
+static int p256_point_from_ecp( p256_point *R, const mbedtls_ecp_point *P )
+{
+    int ret;
+
+    MBEDTLS_MPI_CHK( p256_from_mpi( R->X, &P->X ) );
+    MBEDTLS_MPI_CHK( p256_from_mpi( R->Y, &P->Y ) );
+    p256_mul( R->X, R->X, p256_rr );
+    p256_mul( R->Y, R->Y, p256_rr );
+    memcpy( R->Z, p256_one, sizeof( p256_fe ) );
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * Write out P, given zi = 1 / Z (in the Montgomery domain)
+ */
+static int p256_point_to_ecp_zi( mbedtls_ecp_point *R, const p256_point *P,
+                                 const p256_fe zi )
+{
+    int ret;
+    p256_fe zz, x, y;
+    static const p256_fe one = { 1, 0, 0, 0 };
+
+    p256_sqr( zz, zi );
+    p256_mul( x, P->X, zz );
+    p256_mul( zz, zz, zi );
+    p256_mul( y, P->Y, zz );
+
+    /* Leave the Montgomery domain */
+    p256_mul( x, x, one );
+    p256_mul( y, y, one );
+
+    MBEDTLS_MPI_CHK( p256_to_mpi( &R->X, x ) );
+    MBEDTLS_MPI_CHK( p256_to_mpi( &R->Y, y ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R->Z, 1 ) );
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * Normalize and write out R, which may be the point at infinity
+ */
+static int p256_point_to_ecp( mbedtls_ecp_point *R, const p256_point *P )
+{
+    p256_fe zi;
+
+    if( p256_is_zero( P->Z ) )
+        return( mbedtls_ecp_set_zero( R ) );
+
+    p256_inv( zi, P->Z );
+
+    return( p256_point_to_ecp_zi( R, P, zi ) );
+}
+
+/*
+ * Point doubling R = 2 P, "dbl-2001-b" for a = -3: 3M + 5S.
+ * The point at infinity (Z = 0) is mapped to itself. R may alias P.
+ */
+static void p256_point_double( p256_point *R, const p256_point *P )
+{
+    p256_fe delta, gamma, beta, alpha, t1, t2;
+
+    p256_sqr( delta, P->Z );
+    p256_sqr( gamma, P->Y );
+    p256_mul( beta, P->X, gamma );
+
+    /* alpha = 3 * ( X1 - delta ) * ( X1 + delta ) */
+    p256_sub( t1, P->X, delta );
+    p256_add( t2, P->X, delta );
+    p256_mul( alpha, t1, t2 );
+    p256_add( t1, alpha, alpha );
+    p256_add( alpha, alpha, t1 );
+
+    /* Z3 = ( Y1 + Z1 )^2 - gamma - delta */
+    p256_add( t1, P->Y, P->Z );
+    p256_sqr( t1, t1 );
+    p256_sub( t1, t1, gamma );
+    p256_sub( R->Z, t1, delta );
+
+    /* X3 = alpha^2 - 8 * beta */
+    p256_add( beta, beta, beta );
+    p256_add( beta, beta, beta );
+    p256_add( t2, beta, beta );
+    p256_sqr( t1, alpha );
+    p256_sub( R->X, t1, t2 );
+
+    /* Y3 = alpha * ( 4 * beta - X3 ) - 8 * gamma^2 */
+    p256_sub( t1, beta, R->X );
+    p256_mul( t1, t1, alpha );
+    p256_sqr( gamma, gamma );
+    p256_add( gamma, gamma, gamma );
+    p256_add( gamma, gamma, gamma );
+    p256_add( gamma, gamma, gamma );
+    p256_sub( R->Y, t1, gamma );
+}
+
+static void p256_point_cmov( p256_point *R, const p256_point *P,
+                             uint64_t mask )
+{
+    p256_cmov( R->X, P->X, mask );
+    p256_cmov( R->Y, P->Y, mask );
+    p256_cmov( R->Z, P->Z, mask );
+}
+
+/*
+ * Point addition R = P + Q, "add-2007-bl": 11M + 5S.
+ *
+ * Either input may be the point at infinity, and P = -Q gives Z3 = 0;
+ * these cases are handled without branches. P = Q is detected and
+ * branches to doubling: in the scalar multiplications below this can
+ * only happen with negligible probability, as in other implementations
+ * of this kind. R may alias P or Q.
+ */
+static void p256_point_add( p256_point *R, const p256_point *P,
+                            const p256_point *Q )
+{
+    p256_fe z1z1, z2z2, u1, u2, s1, s2, h, r, i, j, v, t;
+    p256_point S;
+    uint64_t p_inf, q_inf;
+
+    p_inf = p256_is_zero( P->Z );
+    q_inf = p256_is_zero( Q->Z );
+
+    p256_sqr( z1z1, P->Z );
+    p256_sqr( z2z2, Q->Z );
+    p256_mul( u1, P->X, z2z2 );
+    p256_mul( u2, Q->X, z1z1 );
+    p256_mul( s1, P->Y, Q->Z );
+    p256_mul( s1, s1, z2z2 );
+    p256_mul( s2, Q->Y, P->Z );
+    p256_mul( s2, s2, z1z1 );
+    p256_sub( h, u2, u1 );
+    p256_sub( r, s2, s1 );
+
+    if( ( p256_is_zero( h ) & p256_is_zero( r ) & ~p_inf & ~q_inf ) != 0 )
+    {
+        p256_point_double( R, P );
+        return;
+    }
+
+    p256_add( r, r, r );
+    p256_add( i, h, h );
+    p256_sqr( i, i );
+    p256_mul( j, h, i );
+    p256_mul( v, u1, i );
+
+    /* X3 = r^2 - J - 2 * V */
+    p256_sqr( S.X, r );
+    p256_sub( S.X, S.X, j );
+    p256_sub( S.X, S.X, v );
+    p256_sub( S.X, S.X, v );
+
+    /* Y3 = r * ( V - X3 ) - 2 * S1 * J */
+    p256_sub( t, v, S.X );
+    p256_mul( S.Y, r, t );
+    p256_mul( t, s1, j );
+    p256_add( t, t, t );
+    p256_sub( S.Y, S.Y, t );
+
+    /* Z3 = ( ( Z1 + Z2 )^2 - Z1Z1 - Z2Z2 ) * H */
+    p256_add( t, P->Z, Q->Z );
+    p256_sqr( t, t );
+    p256_sub( t, t, z1z1 );
+    p256_sub( t, t, z2z2 );
+    p256_mul( S.Z, t, h );
+
+    p256_point_cmov( &S, Q, p_inf );
+    p256_point_cmov( &S, P, q_inf );
+
+    *R = S;
+}
+
+/*
+ * Mixed addition R = P + Q with Q affine, "madd-2007-bl": 7M + 4S.
+ * q_inf is all-ones if Q is to be taken as the point at infinity.
+ * Same exceptional cases as p256_point_add(). R may alias P.
+ */
+static void p256_point_add_affine( p256_point *R, const p256_point *P,
+                                   const p256_affine *Q, uint64_t q_inf )
+{
+    p256_fe z1z1, u2, s2, h, r, i, j, v, t;
+    p256_point S;
+    uint64_t p_inf;
+
+    p_inf = p256_is_zero( P->Z );
+
+    p256_sqr( z1z1, P->Z );
+    p256_mul( u2, Q->x, z1z1 );
+    p256_mul( s2, Q->y, P->Z );
+    p256_mul( s2, s2, z1z1 );
+    p256_sub( h, u2, P->X );
+    p256_sub( r, s2, P->Y );
+
+    if( ( p256_is_zero( h ) & p256_is_zero( r ) & ~p_inf & ~q_inf ) != 0 )
+    {
+        p256_point_double( R, P );
+        return;
+    }
+
+    p256_add( r, r, r );
+    p256_add( i, h, h );
+    p256_sqr( i, i );
+    p256_mul( j, h, i );
+    p256_mul( v, P->X, i );
+
+    /* X3 = r^2 - J - 2 * V */
+    p256_sqr( S.X, r );
+    p256_sub( S.X, S.X, j );
+    p256_sub( S.X, S.X, v );
+    p256_sub( S.X, S.X, v );
+
+    /* Y3 = r * ( V - X3 ) - 2 * Y1 * J */
+    p256_sub( t, v, S.X );
+    p256_mul( S.Y, r, t );
+    p256_mul( t, P->Y, j );
+    p256_add( t, t, t );
+    p256_sub( S.Y, S.Y, t );
+
+    /* Z3 = 2 * Z1 * H */
+    p256_mul( t, P->Z, h );
+    p256_add( S.Z, t, t );
+
+    /* P at infinity: R = ( x2, y2, 1 ) */
+    p256_cmov( S.X, Q->x, p_inf );
+    p256_cmov( S.Y, Q->y, p_inf );
+    p256_cmov( S.Z, p256_one, p_inf );
+
+    p256_point_cmov( &S, P, q_inf );
+
+    *R = S;
+}
+
+/*
+ * All-ones if a == b, zero otherwise
+ */
+static uint64_t p256_ct_eq( uint64_t a, uint64_t b )
+{
+    uint64_t x = a ^ b;
+
+    return( ( ( x | ( (uint64_t) 0 - x ) ) >> 63 ) - 1 );
+}
+
+/*
+ * R = table[idx - 1], reading the whole table; returns all-ones if idx is 0
+ */
+static uint64_t p256_select_affine( p256_affine *R, const p256_affine table[15],
+                                    uint64_t idx )
+{
+    uint64_t i, mask;
+
+    memset( R, 0, sizeof( p256_affine ) );
+
+    for( i = 0; i < 15; i++ )
+    {
+        mask = p256_ct_eq( idx, i + 1 );
+        p256_cmov( R->x, table[i].x, mask );
+        p256_cmov( R->y, table[i].y, mask );
+    }
+
+    return( p256_ct_eq( idx, 0 ) );
+}
+
+/*
+ * R = table[idx], reading the whole table
+ */
+static void p256_select( p256_point *R, const p256_point table[16],
+                         uint64_t idx )
+{
+    uint64_t i;
+
+    memset( R, 0, sizeof( p256_point ) );
+
+    for( i = 0; i < 16; i++ )
+        p256_point_cmov( R, &table[i], p256_ct_eq( idx, i ) );
+}
+
+#define P256_BIT( k, i )    ( ( (k)[(i) >> 6] >> ( (i) & 63 ) ) & 1 )
+
+/*
+ * R = k * G with the comb tables: 31 doublings and 64 mixed additions
+ */
+static void p256_mul_g( p256_point *R, const uint64_t k[4] )
+{
+    p256_affine A;
+    uint64_t idx, inf;
+    size_t i, j, t;
+
+    memset( R, 0, sizeof( p256_point ) );
+
+    for( i = 32; i > 0; i-- )
+    {
+        j = i - 1;
+
+        if( j != 31 )
+            p256_point_double( R, R );
+
+        for( t = 0; t < 2; t++ )
+        {
+            idx = ( P256_BIT( k, j + 32 * t       )      ) |
+                  ( P256_BIT( k, j + 32 * t +  64 ) << 1 ) |
+                  ( P256_BIT( k, j + 32 * t + 128 ) << 2 ) |
+                  ( P256_BIT( k, j + 32 * t + 192 ) << 3 );
+
+            inf = p256_select_affine( &A, p256_g_table[t], idx );
+            p256_point_add_affine( R, R, &A, inf );
+        }
+    }
+
+    mbedtls_zeroize( &A, sizeof( A ) );
+}
+
+/*
+ * R = k * P with a fixed 4-bit window: 252 doublings and 64 additions
+ */
+static void p256_mul_var( p256_point *R, const uint64_t k[4],
+                          const p256_point *P )
+{
+    p256_point T[16], A;
+    uint64_t idx;
+    size_t i, j;
+
+    memset( &T[0], 0, sizeof( p256_point ) );
+    T[1] = *P;
+    p256_point_double( &T[2], P );
+    for( i = 3; i < 16; i++ )
+        p256_point_add( &T[i], &T[i - 1], P );
+
+    memset( R, 0, sizeof( p256_point ) );
+
+    for( i = 64; i > 0; i-- )
+    {
+        if( i != 64 )
+            for( j = 0; j < 4; j++ )
+                p256_point_double( R, R );
+
+        idx = ( k[( i - 1 ) >> 4] >> ( 4 * ( ( i - 1 ) & 15 ) ) ) & 15;
+
+        p256_select( &A, T, idx );
+        p256_point_add( R, R, &A );
+    }
+
+    mbedtls_zeroize( T, sizeof( T ) );
+    mbedtls_zeroize( &A, sizeof( A ) );
+}
+
+/*
+ * R = k * P, with the comb if P is the generator
+ */
+static int p256_mul_point( p256_point *R, const mbedtls_mpi *k,
+                           const mbedtls_ecp_point *P )
+{
+    int ret;
+    uint64_t kl[4];
+    p256_point Pj;
+
+    MBEDTLS_MPI_CHK( p256_from_mpi( kl, k ) );
+    MBEDTLS_MPI_CHK( p256_point_from_ecp( &Pj, P ) );
+
+    /* Comparing with the generator only involves public data */
+    if( memcmp( Pj.X, p256_g_table[0][0].x, sizeof( p256_fe ) ) == 0 &&
+        memcmp( Pj.Y, p256_g_table[0][0].y, sizeof( p256_fe ) ) == 0 )
+        p256_mul_g( R, kl );
+    else
+        p256_mul_var( R, kl, &Pj );
+
+cleanup:
+    mbedtls_zeroize( kl, sizeof( kl ) );
+
+    return( ret );
+}
+
+/*
+ * R = m * P
+ */
+int mbedtls_ecp_p256_mul( mbedtls_ecp_point *R, const mbedtls_mpi *m,
+                          const mbedtls_ecp_point *P )
+{
+    int ret;
+    p256_point Rj;
+
+    MBEDTLS_MPI_CHK( p256_mul_point( &Rj, m, P ) );
+    MBEDTLS_MPI_CHK( p256_point_to_ecp( R, &Rj ) );
+
+cleanup:
+    mbedtls_zeroize( &Rj, sizeof( Rj ) );
+
+    return( ret );
+}
+
+/*
+ * R[i] = Rj[i] in affine coordinates, the conversions sharing one inversion
+ * with Montgomery's trick, as in ecp_normalize_jac_many()
+ */
+static int p256_points_to_ecp( mbedtls_ecp_point R[], const p256_point Rj[],
+                               size_t count )
+{
+    int ret = 0;
+    size_t i;
+    p256_fe *c, u, zi;
+
+    c = mbedtls_calloc( count, sizeof( p256_fe ) );
+    if( c == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    /*
+     * c[i] = product of the non-zero Z_j for j < i, u = that of all of them
+     */
+    memcpy( u, p256_one, sizeof( p256_fe ) );
+    for( i = 0; i < count; i++ )
+    {
+        memcpy( c[i], u, sizeof( p256_fe ) );
+        if( ! p256_is_zero( Rj[i].Z ) )
+            p256_mul( u, u, Rj[i].Z );
+    }
+
+    p256_inv( u, u );
+
+    /*
+     * Walking back, u = 1 / (product of the non-zero Z_j for j <= i)
+     */
+    for( i = count; i-- > 0; )
+    {
+        if( p256_is_zero( Rj[i].Z ) )
+        {
+            MBEDTLS_MPI_CHK( mbedtls_ecp_set_zero( &R[i] ) );
+            continue;
+        }
+
+        p256_mul( zi, u, c[i] );
+        p256_mul( u, u, Rj[i].Z );
+        MBEDTLS_MPI_CHK( p256_point_to_ecp_zi( &R[i], &Rj[i], zi ) );
+    }
+
+cleanup:
+    mbedtls_zeroize( c, count * sizeof( p256_fe ) );
+    mbedtls_free( c );
+    mbedtls_zeroize( u, sizeof( u ) );
+    mbedtls_zeroize( zi, sizeof( zi ) );
+
+    return( ret );
+}
+
+/*
+ * R[i] = m[i] * P[i], with a single inversion for all the results
+ */
+int mbedtls_ecp_p256_mul_batch( mbedtls_ecp_point R[], const mbedtls_mpi m[],
+                                const mbedtls_ecp_point *P[], size_t count )
+{
+    int ret;
+    size_t i;
+    p256_point *Rj;
+
+    if( count == 0 )
+        return( 0 );
+
+    Rj = mbedtls_calloc( count, sizeof( p256_point ) );
+    if( Rj == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    for( i = 0; i < count; i++ )
+        MBEDTLS_MPI_CHK( p256_mul_point( &Rj[i], &m[i], P[i] ) );
+
+    MBEDTLS_MPI_CHK( p256_points_to_ecp( R, Rj, count ) );
+
+cleanup:
+    mbedtls_zeroize( Rj, count * sizeof( p256_point ) );
+    mbedtls_free( Rj );
+
+    return( ret );
+}
+
+/*
+ * R = m * P + n * Q
+ */
+int mbedtls_ecp_p256_muladd( mbedtls_ecp_point *R,
+                             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                             const mbedtls_mpi *n, const mbedtls_ecp_point *Q )
+{
+    int ret;
+    p256_point A, B;
+
+    MBEDTLS_MPI_CHK( p256_mul_point( &A, m, P ) );
+    MBEDTLS_MPI_CHK( p256_mul_point( &B, n, Q ) );
+
+    p256_point_add( &A, &A, &B );
+
+    MBEDTLS_MPI_CHK( p256_point_to_ecp( R, &A ) );
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * R[i] = m[i] * P[i] + n[i] * Q[i], with a single inversion for all the
+ * results
+ */
+int mbedtls_ecp_p256_muladd_batch( mbedtls_ecp_point R[],
+                                   const mbedtls_mpi m[],
+                                   const mbedtls_ecp_point *P[],
+                                   const mbedtls_mpi n[],
+                                   const mbedtls_ecp_point *Q[],
+                                   size_t count )
+{
+    int ret;
+    size_t i;
+    p256_point *Rj, B;
+
+    if( count == 0 )
+        return( 0 );
+
+    Rj = mbedtls_calloc( count, sizeof( p256_point ) );
+    if( Rj == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    for( i = 0; i < count; i++ )
+    {
+        MBEDTLS_MPI_CHK( p256_mul_point( &Rj[i], &m[i], P[i] ) );
+        MBEDTLS_MPI_CHK( p256_mul_point( &B, &n[i], Q[i] ) );
+
+        p256_point_add( &Rj[i], &Rj[i], &B );
+    }
+
+    MBEDTLS_MPI_CHK( p256_points_to_ecp( R, Rj, count ) );
+
+cleanup:
+    mbedtls_free( Rj );
+
+    return( ret );
+}
+
+/*
+ * R = m * P + sum( +- T[|k[i]| / 2] 2^i ), the second part being the
+ * comb method of ecp_mul_comb(): d doublings and d + 1 mixed additions
+ */
+int mbedtls_ecp_p256_muladd_comb( mbedtls_ecp_point *R,
+                                  const mbedtls_mpi *m,
+                                  const mbedtls_ecp_point *P,
+                                  const mbedtls_ecp_point T[], size_t T_size,
+                                  const unsigned char k[], size_t d, int neg )
+{
+    int ret;
+    size_t i;
+    p256_point A, B;
+    p256_affine *tab, S;
+    static const p256_fe zero = { 0, 0, 0, 0 };
+
+    tab = mbedtls_calloc( T_size, sizeof( p256_affine ) );
+    if( tab == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    /* The points of T are normalized, but their Z may have been freed */
+    for( i = 0; i < T_size; i++ )
+    {
+        MBEDTLS_MPI_CHK( p256_from_mpi( tab[i].x, &T[i].X ) );
+        MBEDTLS_MPI_CHK( p256_from_mpi( tab[i].y, &T[i].Y ) );
+        p256_mul( tab[i].x, tab[i].x, p256_rr );
+        p256_mul( tab[i].y, tab[i].y, p256_rr );
+    }
+
+    MBEDTLS_MPI_CHK( p256_mul_point( &A, m, P ) );
+
+    memset( &B, 0, sizeof( p256_point ) );
+
+    for( i = d + 1; i-- > 0; )
+    {
+        p256_point_double( &B, &B );
+
+        S = tab[( k[i] & 0x7F ) >> 1];
+        if( ( ( k[i] >> 7 ) ^ neg ) != 0 )
+            p256_sub( S.y, zero, S.y );
+
+        p256_point_add_affine( &B, &B, &S, 0 );
+    }
+
+    p256_point_add( &A, &A, &B );
+
+    MBEDTLS_MPI_CHK( p256_point_to_ecp( R, &A ) );
+
+cleanup:
+    mbedtls_free( tab );
+
+    return( ret );
+}
+
+#endif /* MBEDTLS_ECP_C && MBEDTLS_ECP_P256_FAST && ... */
@@ -0,0 +1,1059 @@
+/*
+ *  Elliptic curves over GF(p): dedicated secp384r1 arithmetic
+ *
+ *  Copyright (C) 2006-2017, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+
+/*
+ * References:
+ *
+ * FIPS 186-3 D.1.2.4 (curve parameters)
+ * NSA, Commercial National Security Algorithm Suite (CNSA), 2016
+ * Explicit-Formulas Database, http://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html
+ *
+ * The structure follows ecp_p256.c; only the field size, the constants and
+ * the shape of the generator tables differ.
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ECP_C) && defined(MBEDTLS_ECP_P384_FAST) && \
+    defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED) && \
+    !defined(MBEDTLS_ECP_ALT)
+
+#include "mbedtls/ecp_p384.h"
+
+#include <string.h>
+
+#if defined(MBEDTLS_PLATFORM_C)
+#include "mbedtls/platform.h"
+#else
+#include <stdlib.h>
+#define mbedtls_calloc    calloc
+#define mbedtls_free       free
+#endif
+
+#if ( defined(__ARMCC_VERSION) || defined(_MSC_VER) ) && \
+    !defined(inline) && !defined(__cplusplus)
+#define inline __inline
+#endif
+
+/* Implementation that should never be optimized out by the compiler */
+static void mbedtls_zeroize( void *v, size_t n ) {
+    volatile unsigned char *p = v; while( n-- ) *p++ = 0;
+}
+
+#if defined(_MSC_VER) || defined(__WATCOMC__)
+  #define UL64(x) x##ui64
+#else
+  #define UL64(x) x##ULL
+#endif
+
+/*
+ * Field elements are six 64-bit limbs, least significant first, always
+ * fully reduced and kept in the Montgomery domain (a stands for a * 2^384
+ * mod p). Points are in Jacobian coordinates, with Z = 0 for the point at
+ * infinity. Nothing below branches on, or indexes memory with, secret data,
+ * except the doubling case of p384_point_add() (see there).
+ */
+typedef uint64_t p384_fe[6];
+
+typedef struct
+{
+    p384_fe X, Y, Z;
+}
+p384_point;
+
+typedef struct
+{
+    p384_fe x, y;
+}
+p384_affine;
+
+static const p384_fe p384_p = {
+    UL64(0x00000000FFFFFFFF), UL64(0xFFFFFFFF00000000), UL64(0xFFFFFFFFFFFFFFFE),
+    UL64(0xFFFFFFFFFFFFFFFF), UL64(0xFFFFFFFFFFFFFFFF), UL64(0xFFFFFFFFFFFFFFFF) };
+
+/* -p^-1 mod 2^64 */
+#define P384_N0     UL64(0x0000000100000001)
+
+/* 2^768 mod p, to enter the Montgomery domain */
+static const p384_fe p384_rr = {
+    UL64(0xFFFFFFFE00000001), UL64(0x0000000200000000), UL64(0xFFFFFFFE00000000),
+    UL64(0x0000000200000000), UL64(0x0000000000000001), UL64(0x0000000000000000) };
+
+/* 2^384 mod p, that is 1 in the Montgomery domain */
+static const p384_fe p384_one = {
+    UL64(0xFFFFFFFF00000001), UL64(0x00000000FFFFFFFF), UL64(0x0000000000000001),
+    UL64(0x0000000000000000), UL64(0x0000000000000000), UL64(0x0000000000000000) };
+
+/*
+ * Comb tables for the generator: entry i - 1 of p384_g_table[t] is
+ * sum( b_j * 2^(96 j + 48 t) * G ) over the bits b_j of i, 0 <= j < 4,
+ * in affine coordinates
+ */
+static const p384_affine p384_g_table[2][15] = {
+  {
+    { { UL64(0x3DD0756649C0B528), UL64(0x20E378E2A0D6CE38), UL64(0x879C3AFC541B4D6E),
+        UL64(0x6454868459A30EFF), UL64(0x812FF723614EDE2B), UL64(0x4D3AADC2299E1513) },
+      { UL64(0x23043DAD4B03A4FE), UL64(0xA1BFA8BF7BB4A9AC), UL64(0x8BADE7562E83B050),
+        UL64(0xC6C3521968F4FFD9), UL64(0xDD8002263969A840), UL64(0x2B78ABC25A15C5E9) } },
+    { { UL64(0x24480C57F26FEEF9), UL64(0xC31A26943A0E1240), UL64(0x735002C3273E2BC7),
+        UL64(0x8C42E9C53EF1ED4C), UL64(0x028BABF67F4948E8), UL64(0x6A502F438A978632) },
+      { UL64(0xF5F13A46B74536FE), UL64(0x1D218BABD8A9F0EB), UL64(0x30F36BCC37232768),
+        UL64(0xC5317B31576E8C18), UL64(0xEF1D57A69BBCB766), UL64(0x917C4930B3E3D4DC) } },
+    { { UL64(0x11426E2EE349DDD0), UL64(0x9F117EF99B2FC250), UL64(0xFF36B480EC0174A6),
+        UL64(0x4F4BDE7618458466), UL64(0x2F2EDB6D05806049), UL64(0x8ADC75D119DFCA92) },
+      { UL64(0xA619D097B7D5A7CE), UL64(0x874275E5A34411E9), UL64(0x5403E0470DA4B4EF),
+        UL64(0x2EBAAFD977901D8F), UL64(0x5E63EBCEA747170F), UL64(0x12A369447F9D8036) } },
+    { { UL64(0x378205DE2F9FBE67), UL64(0xC4AFCB837F728E44), UL64(0xDBCEC06C682E00F1),
+        UL64(0xF2A145C3114D5423), UL64(0xA01D98747A52463E), UL64(0xFC0935B17D717B0A) },
+      { UL64(0x9653BC4FD4D01F95), UL64(0x9AA83EA89560AD34), UL64(0xF77943DCAF8E3F3F),
+        UL64(0x70774A10E86FE16E), UL64(0x6B62E6F1BF9FFDCF), UL64(0x8A72F39E588745C9) } },
+    { { UL64(0x73ADE4DA2341C342), UL64(0xDD326E54EA704422), UL64(0x336C7D983741CEF3),
+        UL64(0x1EAFA00D59E61549), UL64(0xCD3ED892BD9A3EFD), UL64(0x03FAF26CC5C6C7E4) },
+      { UL64(0x087E2FCF3045F8AC), UL64(0x14A65532174F1E73), UL64(0x2CF84F28FE0AF9A7),
+        UL64(0xDDFD7A842CDC935B), UL64(0x4C0F117B6929C895), UL64(0x356572D64C8BCFCC) } },
+    { { UL64(0xFAB086073F3B236F), UL64(0x19E9D41D81E221DA), UL64(0xF3F6571E3927B428),
+        UL64(0x4348A9337550F1F6), UL64(0x7167B996A85E62F0), UL64(0x62D437597F5452BF) },
+      { UL64(0xD85FEB9EF2955926), UL64(0x440A561F6DF78353), UL64(0x389668EC9CA36B59),
+        UL64(0x052BF1A1A22DA016), UL64(0xBDFBFF72F6093254), UL64(0x94E50F28E22209F3) } },
+    { { UL64(0x90B2E5B33062E8AF), UL64(0xA8572375E8A3D369), UL64(0x3FE1B00B201DB7B1),
+        UL64(0xE926DEF0EE651AA2), UL64(0x6542C9BEB9B10AD7), UL64(0x098E309BA2FCBE74) },
+      { UL64(0x779DEEB3FFF1D63F), UL64(0x23D0E80A20BFD374), UL64(0x8452BB3B8768F797),
+        UL64(0xCF75BB4D1F952856), UL64(0x8FE6B40029EA3FAA), UL64(0x12BD3E4081373A53) } },
+    { { UL64(0x070D34E116973CF4), UL64(0x20AEE08B7E4F34F7), UL64(0x269AF9B95EB8AD29),
+        UL64(0xDDE0A036A6A45DDA), UL64(0xA18B528E63DF41E0), UL64(0x03CC71B2A260DF2A) },
+      { UL64(0x24A6770AA06B1DD7), UL64(0x5BFA9C119D2675D3), UL64(0x73C1E2A196844432),
+        UL64(0x3660558D131A6CF0), UL64(0xB0289C832EE79454), UL64(0xA6AEFB01C6D8DDCD) } },
+    { { UL64(0xBA1464B401AB5245), UL64(0x9B8D0B6DC48D93FF), UL64(0x939867DC93AD272C),
+        UL64(0xBEBE085EAE9FDC77), UL64(0x73AE5103894EA8BD), UL64(0x740FC89A39AC22E1) },
+      { UL64(0x5E28B0A328E23B23), UL64(0x2352722EE13104D0), UL64(0xF4667A18B0A2640D),
+        UL64(0xAC74A72E49BB37C3), UL64(0x79F734F0E81E183A), UL64(0xBFFE5B6C3FD9C0EB) } },
+    { { UL64(0x03CF292200623F3B), UL64(0x095C71115F29EBFF), UL64(0x42D7224780AA6823),
+        UL64(0x044C7BA17458C0B0), UL64(0xCA62F7EF0959EC20), UL64(0x40AE2AB7F8CA929F) },
+      { UL64(0xB8C5377AA927B102), UL64(0x398A86A0DC031771), UL64(0x04908F9DC216A406),
+        UL64(0xB423A73A918D3300), UL64(0x634B0FF1E0B94739), UL64(0xE29DE7252D69F697) } },
+    { { UL64(0x744D14008435AF04), UL64(0x5F255B1DFEC192DA), UL64(0x1F17DC12336DC542),
+        UL64(0x5C90C2A7636A68A8), UL64(0x960C9EB77704CA1E), UL64(0x9DE8CF1E6FB3D65A) },
+      { UL64(0xC60FEE0D511D3D06), UL64(0x466E2313F9EB52C7), UL64(0x743C0F5F206B0914),
+        UL64(0x42F55BAC2191AA4D), UL64(0xCEFC7C8FFFEBDBC2), UL64(0xD4FA6081E6E8ED1C) } },
+    { { UL64(0x867DB63998683186), UL64(0xFB5CF424DDCC4EA9), UL64(0xCC9A7FFED4F0E7BD),
+        UL64(0x7C57F71C7A779F7E), UL64(0x90774079D6B25EF2), UL64(0x90EAE903B4081680) },
+      { UL64(0xDF2AAE5E0EE1FCEB), UL64(0x3FF1DA24E86C1A1F), UL64(0x80F587D6CA193EDF),
+        UL64(0xA5695523DC9B9D6A), UL64(0x7B84090085920303), UL64(0x1EFA4DFCBA6DBDEF) } },
+    { { UL64(0xFBD838F9E0540015), UL64(0x2C323946C39077DC), UL64(0x8B1FB9E6AD619124),
+        UL64(0x9612440C0CA62EA8), UL64(0x9AD9B52C2DBE00FF), UL64(0xF52ABAA1AE197643) },
+      { UL64(0xD0E898942CAC32AD), UL64(0xDFB79E4262A98F91), UL64(0x65452ECF276F55CB),
+        UL64(0xDB1AC0D27AD23E12), UL64(0xF68C5F6ADE4986F0), UL64(0x389AC37B82CE327D) } },
+    { { UL64(0xCD96866DB8A9E8C9), UL64(0xA11963B85BB8091E), UL64(0xC7F90D53045B3CD2),
+        UL64(0x755A72B580F36504), UL64(0x46F8B39921D3751C), UL64(0x4BFFDC9153C193DE) },
+      { UL64(0xCD15C049B89554E7), UL64(0x353C6754F7A26BE6), UL64(0x79602370BD41D970),
+        UL64(0xDE16470B12B176C0), UL64(0x56BA117540C8809D), UL64(0xE2DB35C3E435FB1E) } },
+    { { UL64(0xD71E4AAB6328E33F), UL64(0x5486782BAF8136D1), UL64(0x07A4995F86D57231),
+        UL64(0xF1F0A5BD1651A968), UL64(0xA5DC5B2476803B6D), UL64(0x5C587CBC42DDA935) },
+      { UL64(0x2B6CDB32BAE8B4C0), UL64(0x66D1598BB1331138), UL64(0x4A23B2D25D7E9614),
+        UL64(0x93E402A674A8C05D), UL64(0x45AC94E6DA7CE82E), UL64(0xEB9F8281E463D465) } }
+  },
+  {
+    { { UL64(0x298647532B0C535B), UL64(0x90DD695370506296), UL64(0x038CD6B4216AB9AC),
+        UL64(0x3DF9B7B7BE12D76A), UL64(0x13F4D9785F347BDB), UL64(0x222C5C9C13E94489) },
+      { UL64(0x5F8E796F2680DC64), UL64(0x120E7CB758352417), UL64(0x254B5D8AD10740B8),
+        UL64(0xC38B8EFB5337DEE6), UL64(0xF688C2E194F02247), UL64(0x7B5C75F36C25BC4C) } },
+    { { UL64(0x5584CBB3893B9A2D), UL64(0x820C660B00850C5D), UL64(0x4126D8267DF2D43D),
+        UL64(0xDD5BBBF00109E801), UL64(0x85B92EE338172F1C), UL64(0x609D4F93F31430D9) },
+      { UL64(0x1E059A07EADAF9D6), UL64(0x70E6536C0F125FB0), UL64(0xD6220751560F20E7),
+        UL64(0xA59489AE7AAF3A9A), UL64(0x7B70E2F664BAE14E), UL64(0x0DD0370176D08249) } },
+    { { UL64(0xC07611F4DF5BDF53), UL64(0x45D331A758B11A6D), UL64(0x58965DAF1C4EE394),
+        UL64(0xBA8BEBE75A5878D1), UL64(0xAECC0A1882DD3025), UL64(0xCF2A3899A923EB8B) },
+      { UL64(0xF98C9281D24FD048), UL64(0x841BFB598BBB025D), UL64(0xB8DDF8CEC9AB9D53),
+        UL64(0x538A4CB67FEF044E), UL64(0x092AC21F23236662), UL64(0xA919D3850B66F065) } },
+    { { UL64(0xC0426B775E3C647B), UL64(0xBFCBD9398CF05348), UL64(0x31D312E3172C0D3D),
+        UL64(0x5F49FDE6EE754737), UL64(0x895530F06DA7EE61), UL64(0xCF281B0AE8B3A5FB) },
+      { UL64(0xFD14973541B8A543), UL64(0x41A625A73080DD30), UL64(0xE2BAAE07653908CF),
+        UL64(0xC3D01436BA02A278), UL64(0xA0D0222E7B21B8F8), UL64(0xFDC270E9D7EC1297) } },
+    { { UL64(0x4E50430EFC14AB48), UL64(0x195B7F4F26706A74), UL64(0x2FE8A228CC881FF6),
+        UL64(0xB1B968E2D945013D), UL64(0x936AA5794B92162B), UL64(0x4FB766B7364E754A) },
+      { UL64(0x13F93BCA31E1FF7F), UL64(0x696EB5CACE4F2691), UL64(0xFF754BF8A2B09E02),
+        UL64(0x58F13C9CE58E3FF8), UL64(0xB757346F1678C0B0), UL64(0xD54200DBA86692B3) } },
+    { { UL64(0x5CD9F5A87237CAC0), UL64(0x93F0B59D43586794), UL64(0x4384A764E94F6C4E),
+        UL64(0x8304ED2BB62782D3), UL64(0x0B8DB8B3CDE06015), UL64(0x4336DD535DBE190F) },
+      { UL64(0x5744355392AB473A), UL64(0x031C7275BE5ED046), UL64(0x3E78678C21909AA4),
+        UL64(0x4AB7E04F99202DDB), UL64(0x2648D2066977E635), UL64(0xD427D184093198BE) } },
+    { { UL64(0x8E74DC3579EFDC58), UL64(0x456BD3694FF68DDB), UL64(0x724E74CCD32096A5),
+        UL64(0xE41CFF42386783D0), UL64(0xA04C7F217C70D8A4), UL64(0x41199D2FE61A19A2) },
+      { UL64(0xD389A3E029C05DD2), UL64(0x535F2A6BE7E3FDA9), UL64(0x26ECF72D7C2B4DF8),
+        UL64(0x678275F4FE745294), UL64(0x6319C9CC9D23F519), UL64(0x1E05A02D88048FC4) } },
+    { { UL64(0x87C7DD7D139B3239), UL64(0x8B57824E4D833BAE), UL64(0xBCBC48789FFF0015),
+        UL64(0x8FFCEF8B909EAF1A), UL64(0x9905F4EEF1443A78), UL64(0x020DD4A2E15CBFED) },
+      { UL64(0xCA2969ECA306D695), UL64(0xDF940CADB93CAF60), UL64(0x67F7FAB787EA6E39),
+        UL64(0x0D0EE10FF98C4FE5), UL64(0xC646879AC19CB91E), UL64(0x4B4EA50C7D1D7AB4) } },
+    { { UL64(0xD6D9AEC823E4712C), UL64(0x7CA8376CC3C198EE), UL64(0xE6D8318731BEBD8A),
+        UL64(0xED57AFF3D88BFEF3), UL64(0x72A645EECF44EDC7), UL64(0xD4E63D0B5CBB1517) },
+      { UL64(0x98CE7A1CCEEE0ECF), UL64(0x8F0126335383EE8E), UL64(0x3B879078A6B455E8),
+        UL64(0xCBCD3D96C7658C06), UL64(0x721D6FE70783336A), UL64(0xF21A72635A677136) } },
+    { { UL64(0x18482CEC9B3F5034), UL64(0x962D445ACD9E68FD), UL64(0x266FB1D695746F23),
+        UL64(0xC66ADE5A58C94A4B), UL64(0xDBBDA826ED68A5B6), UL64(0x05664A4D7AB0D6AE) },
+      { UL64(0xBCD4FE51025E32FC), UL64(0x61A5AEBFA96DF252), UL64(0xD88A07E231592A31),
+        UL64(0x5D9D94DE98905517), UL64(0x96BB40105FD440E7), UL64(0x1B0C47A2E807DB4C) } },
+    { { UL64(0xC1004CFF44B2E045), UL64(0x91B5E1364B1C05D4), UL64(0x53AE409088A48A07),
+        UL64(0x73FB2995EA11BB1A), UL64(0x320485703D93A4EA), UL64(0xCCE45DE83BFC8A5F) },
+      { UL64(0xAFF4A97EC2B3106E), UL64(0x9069C630B6848B4F), UL64(0xEDA837A6ED76241C),
+        UL64(0x8A0DAF136CC3F6CF), UL64(0x199D049D3DA018A8), UL64(0xF867C6B1D9093BA3) } },
+    { { UL64(0x5285D116141D161C), UL64(0x67CD2E0E93C4ED17), UL64(0x12C62A647C36187E),
+        UL64(0xF5329539ED2584CA), UL64(0xC4C777C442FBBD69), UL64(0x107DE7761BDFC50A) },
+      { UL64(0x9976DCC5E96BEEBD), UL64(0xBE2AFF95A865A151), UL64(0x0E0A9DA19D8872AF),
+        UL64(0x5E357A3DA63C17CC), UL64(0xD31FDFD8E15CC67C), UL64(0xC44BBEFD7970C6D8) } },
+    { { UL64(0x1A60D1522CA8F2FE), UL64(0x61640948491BD41F), UL64(0x6DAE29A558DFE035),
+        UL64(0x9A615BEA278E4863), UL64(0xBBDB44779AD7C8E5), UL64(0x1C7066302CEAC2FC) },
+      { UL64(0x5E2B54C699699B4B), UL64(0xB509CA6D239E17E8), UL64(0x728165FEEA063A82),
+        UL64(0x6B5E609DB6A22E02), UL64(0x12813905B26EE1DF), UL64(0x07B9F722439491FA) } },
+    { { UL64(0xAA9DA167B8153A9D), UL64(0xA49FE3AC9E83ECF0), UL64(0x14C18F8E1B661384),
+        UL64(0x61C24DAB38434DE1), UL64(0x3D973C3A283DAE96), UL64(0xC99BAA0182754FC9) },
+      { UL64(0x477D198F4C26B1E3), UL64(0x12E8E186A7516202), UL64(0x386E52F6362ADDFA),
+        UL64(0x31E8F695C3962853), UL64(0xDEC2AF136AAEDB60), UL64(0xFCFDB4C629CF74AC) } },
+    { { UL64(0xE361A1987FFA0A5F), UL64(0xF4B26102C63FE109), UL64(0x264ACBC56C74E111),
+        UL64(0x4AF445FA77ABEBAF), UL64(0x448C4FDD24CDDB75), UL64(0x0B13157D44506EEA) },
+      { UL64(0x22A6B15972E9993D), UL64(0x2C3C57E485E5ECBE), UL64(0xA673560BFD83E1A1),
+        UL64(0x6BE23F82C3B8C83B), UL64(0x40B13A9640BBE38E), UL64(0x66EEA033AD17399B) } }
+  }
+};
+
+/*
+ * 64 x 64 -> 128-bit multiplication
+ */
+#if defined(MBEDTLS_HAVE_INT64) && defined(MBEDTLS_HAVE_UDBL)
+static inline void p384_mul64( uint64_t a, uint64_t b,
+                               uint64_t *lo, uint64_t *hi )
+{
+    mbedtls_t_udbl r = (mbedtls_t_udbl) a * b;
+
+    *lo = (uint64_t) r;
+    *hi = (uint64_t)( r >> 64 );
+}
+#else
+static inline void p384_mul64( uint64_t a, uint64_t b,
+                               uint64_t *lo, uint64_t *hi )
+{
+    uint64_t a0 = a & 0xFFFFFFFF, a1 = a >> 32;
+    uint64_t b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+    uint64_t t, u, v;
+
+    t = a0 * b0;
+    u = a1 * b0 + ( t >> 32 );
+    v = a0 * b1 + ( u & 0xFFFFFFFF );
+
+    *lo = ( v << 32 ) | ( t & 0xFFFFFFFF );
+    *hi = a1 * b1 + ( u >> 32 ) + ( v >> 32 );
+}
+#endif
+
+/*
+ * r = t - p if t >= p, else t, where t = t[0..5] + 2^384 * c and t < 2p
+ */
+static void p384_reduce_once( p384_fe r, const uint64_t t[6], uint64_t c )
+{
+    uint64_t d[6], b = 0, x, mask;
+    size_t i;
+
+    for( i = 0; i < 6; i++ )
+    {
+        x = t[i] - p384_p[i];
+        d[i] = x - b;
+        b = ( t[i] < p384_p[i] ) | ( x < b );
+    }
+
+    /* t < p exactly when the borrow is not absorbed by c */
+    mask = (uint64_t) 0 - ( b & ( c ^ 1 ) );
+
+    for( i = 0; i < 6; i++ )
+        r[i] = ( t[i] & mask ) | ( d[i] & ~mask );
+}
+
+static void p384_add( p384_fe r, const p384_fe a, const p384_fe b )
+{
+    uint64_t t[6], c = 0, x;
+    size_t i;
+
+    for( i = 0; i < 6; i++ )
+    {
+        x = a[i] + c;
+        c = ( x < c );
+        t[i] = x + b[i];
+        c += ( t[i] < x );
+    }
+
+    p384_reduce_once( r, t, c );
+}
+
+static void p384_sub( p384_fe r, const p384_fe a, const p384_fe b )
+{
+    uint64_t t[6], br = 0, c = 0, x, mask;
+    size_t i;
+
+    for( i = 0; i < 6; i++ )
+    {
+        x = a[i] - b[i];
+        t[i] = x - br;
+        br = ( a[i] < b[i] ) | ( x < br );
+    }
+
+    /* Add p back if the result went negative */
+    mask = (uint64_t) 0 - br;
+
+    for( i = 0; i < 6; i++ )
+    {
+        x = t[i] + c;
+        c = ( x < c );
+        r[i] = x + ( p384_p[i] & mask );
+        c += ( r[i] < x );
+    }
+}
+
+/*
+ * Montgomery multiplication: r = a * b / 2^384 mod p (CIOS)
+ */
+static void p384_mul( p384_fe r, const p384_fe a, const p384_fe b )
+{
+    uint64_t t[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    uint64_t lo, hi, c, m;
+    size_t i, j;
+
+    for( i = 0; i < 6; i++ )
+    {
+        /* t += a * b[i] */
+        c = 0;
+        for( j = 0; j < 6; j++ )
+        {
+            p384_mul64( a[j], b[i], &lo, &hi );
+            lo += c;    hi += ( lo < c );
+            lo += t[j]; hi += ( lo < t[j] );
+            t[j] = lo;
+            c = hi;
+        }
+        t[6] += c;
+        t[7] = ( t[6] < c );
+
+        /* t = ( t + m * p ) / 2^64 */
+        m = t[0] * P384_N0;
+        p384_mul64( m, p384_p[0], &lo, &hi );
+        lo += t[0];
+        c = hi + ( lo < t[0] );
+        for( j = 1; j < 6; j++ )
+        {
+            p384_mul64( m, p384_p[j], &lo, &hi );
+            lo += c;    hi += ( lo < c );
+            lo += t[j]; hi += ( lo < t[j] );
+            t[j - 1] = lo;
+            c = hi;
+        }
+        t[5] = t[6] + c;
+        t[6] = t[7] + ( t[5] < c );
+    }
+
+    p384_reduce_once( r, t, t[6] );
+}
+
+static void p384_sqr( p384_fe r, const p384_fe a )
+{
+    p384_mul( r, a, a );
+}
+
+/*
+ * r = a^(2^n), n >= 1
+ */
+static void p384_sqr_n( p384_fe r, const p384_fe a, size_t n )
+{
+    p384_sqr( r, a );
+    while( --n > 0 )
+        p384_sqr( r, r );
+}
+
+/*
+ * r = a^-1 = a^(p - 2), with the exponent
+ * p - 2 = 2^384 - 2^128 - 2^96 + 2^32 - 3 processed as
+ * [255 ones] [0] [32 ones] [64 zeros] [30 ones] [0, 1]
+ */
+static void p384_inv( p384_fe r, const p384_fe a )
+{
+    p384_fe x2, x3, x6, x12, x15, x30, x32, x60, x120, t;
+
+    p384_sqr( x2, a );              p384_mul( x2, x2, a );
+    p384_sqr( x3, x2 );             p384_mul( x3, x3, a );
+    p384_sqr_n( x6, x3, 3 );        p384_mul( x6, x6, x3 );
+    p384_sqr_n( x12, x6, 6 );       p384_mul( x12, x12, x6 );
+    p384_sqr_n( x15, x12, 3 );      p384_mul( x15, x15, x3 );
+    p384_sqr_n( x30, x15, 15 );     p384_mul( x30, x30, x15 );
+    p384_sqr_n( x32, x30, 2 );      p384_mul( x32, x32, x2 );
+    p384_sqr_n( x60, x30, 30 );     p384_mul( x60, x60, x30 );
+    p384_sqr_n( x120, x60, 60 );    p384_mul( x120, x120, x60 );
+
+    p384_sqr_n( t, x120, 120 );     p384_mul( t, t, x120 );
+    p384_sqr_n( t, t, 15 );         p384_mul( t, t, x15 );
+    p384_sqr_n( t, t, 33 );         p384_mul( t, t, x32 );
+    p384_sqr_n( t, t, 94 );         p384_mul( t, t, x30 );
+    p384_sqr_n( t, t, 2 );          p384_mul( r, t, a );
+}
+
+/*
+ * All-ones if a == 0, zero otherwise
+ */
+static uint64_t p384_is_zero( const p384_fe a )
+{
+    uint64_t x = a[0] | a[1] | a[2] | a[3] | a[4] | a[5];
+
+    return( ( ( x | ( (uint64_t) 0 - x ) ) >> 63 ) - 1 );
+}
+
+/*
+ * r = a if mask is all-ones, unchanged if mask is zero
+ */
+static void p384_cmov( p384_fe r, const p384_fe a, uint64_t mask )
+{
+    size_t i;
+
+    for( i = 0; i < 6; i++ )
+        r[i] = ( r[i] & ~mask ) | ( a[i] & mask );
+}
+
+/*
+ * Conversions from and to MPIs, in and out of the Montgomery domain
+ */
+static int p384_from_mpi( p384_fe r, const mbedtls_mpi *X )
+{
+    int ret;
+    unsigned char buf[48];
+    size_t i, j;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( X, buf, sizeof( buf ) ) );
+
+    for( i = 0; i < 6; i++ )
+    {
+        r[i] = 0;
+        for( j = 0; j < 8; j++ )
+            r[i] |= (uint64_t) buf[47 - 8 * i - j] << ( 8 * j );
+    }
+
+cleanup:
+    mbedtls_zeroize( buf, sizeof( buf ) );
+
+    return( ret );
+}
+
+static int p384_to_mpi( mbedtls_mpi *X, const p384_fe a )
+{
+    unsigned char buf[48];
+    size_t i, j;
+
+    for( i = 0; i < 6; i++ )
+        for( j = 0; j < 8; j++ )
+            buf[47 - 8 * i - j] = (unsigned char)( a[i] >> ( 8 * j ) );
+
+    return( mbedtls_mpi_read_binary( X, buf, sizeof( buf ) ) );
+}
+
+static int p384_point_from_ecp( p384_point *R, const mbedtls_ecp_point *P )
+{
+    int ret;
+
+    MBEDTLS_MPI_CHK( p384_from_mpi( R->X, &P->X ) );
+    MBEDTLS_MPI_CHK( p384_from_mpi( R->Y, &P->Y ) );
+    p384_mul( R->X, R->X, p384_rr );
+    p384_mul( R->Y, R->Y, p384_rr );
+    memcpy( R->Z, p384_one, sizeof( p384_fe ) );
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * Write out P, given zi = 1 / Z (in the Montgomery domain)
+ */
+static int p384_point_to_ecp_zi( mbedtls_ecp_point *R, const p384_point *P,
+                                 const p384_fe zi )
+{
+    int ret;
+    p384_fe zz, x, y;
+    static const p384_fe one = { 1, 0, 0, 0, 0, 0 };
+
+    p384_sqr( zz, zi );
+    p384_mul( x, P->X, zz );
+    p384_mul( zz, zz, zi );
+    p384_mul( y, P->Y, zz );
+
+    /* Leave the Montgomery domain */
+    p384_mul( x, x, one );
+    p384_mul( y, y, one );
+
+    MBEDTLS_MPI_CHK( p384_to_mpi( &R->X, x ) );
+    MBEDTLS_MPI_CHK( p384_to_mpi( &R->Y, y ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R->Z, 1 ) );
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * Normalize and write out R, which may be the point at infinity
+ */
+static int p384_point_to_ecp( mbedtls_ecp_point *R, const p384_point *P )
+{
+    p384_fe zi;
+
+    if( p384_is_zero( P->Z ) )
+        return( mbedtls_ecp_set_zero( R ) );
+
+    p384_inv( zi, P->Z );
+
+    return( p384_point_to_ecp_zi( R, P, zi ) );
+}
+
+/*
+ * Point doubling R = 2 P, "dbl-2001-b" for a = -3: 3M + 5S.
+ * The point at infinity (Z = 0) is mapped to itself. R may alias P.
+ */
+static void p384_point_double( p384_point *R, const p384_point *P )
+{
+    p384_fe delta, gamma, beta, alpha, t1, t2;
+
+    p384_sqr( delta, P->Z );
+    p384_sqr( gamma, P->Y );
+    p384_mul( beta, P->X, gamma );
+
+    /* alpha = 3 * ( X1 - delta ) * ( X1 + delta ) */
+    p384_sub( t1, P->X, delta );
+    p384_add( t2, P->X, delta );
+    p384_mul( alpha, t1, t2 );
+    p384_add( t1, alpha, alpha );
+    p384_add( alpha, alpha, t1 );
+
+    /* Z3 = ( Y1 + Z1 )^2 - gamma - delta */
+    p384_add( t1, P->Y, P->Z );
+    p384_sqr( t1, t1 );
+    p384_sub( t1, t1, gamma );
+    p384_sub( R->Z, t1, delta );
+
+    /* X3 = alpha^2 - 8 * beta */
+    p384_add( beta, beta, beta );
+    p384_add( beta, beta, beta );
+    p384_add( t2, beta, beta );
+    p384_sqr( t1, alpha );
+    p384_sub( R->X, t1, t2 );
+
+    /* Y3 = alpha * ( 4 * beta - X3 ) - 8 * gamma^2 */
+    p384_sub( t1, beta, R->X );
+    p384_mul( t1, t1, alpha );
+    p384_sqr( gamma, gamma );
+    p384_add( gamma, gamma, gamma );
+    p384_add( gamma, gamma, gamma );
+    p384_add( gamma, gamma, gamma );
+    p384_sub( R->Y, t1, gamma );
+}
+
+static void p384_point_cmov( p384_point *R, const p384_point *P,
+                             uint64_t mask )
+{
+    p384_cmov( R->X, P->X, mask );
+    p384_cmov( R->Y, P->Y, mask );
+    p384_cmov( R->Z, P->Z, mask );
+}
+
+/*
+ * Point addition R = P + Q, "add-2007-bl": 11M + 5S.
+ *
+ * Either input may be the point at infinity, and P = -Q gives Z3 = 0;
+ * these cases are handled without branches. P = Q is detected and
+ * branches to doubling, which in the scalar multiplications below only
+ * happens with negligible probability. R may alias P or Q.
+ */
+static void p384_point_add( p384_point *R, const p384_point *P,
+                            const p384_point *Q )
+{
+    p384_fe z1z1, z2z2, u1, u2, s1, s2, h, r, i, j, v, t;
+    p384_point S;
+    uint64_t p_inf, q_inf;
+
+    p_inf = p384_is_zero( P->Z );
+    q_inf = p384_is_zero( Q->Z );
+
+    p384_sqr( z1z1, P->Z );
+    p384_sqr( z2z2, Q->Z );
+    p384_mul( u1, P->X, z2z2 );
+    p384_mul( u2, Q->X, z1z1 );
+    p384_mul( s1, P->Y, Q->Z );
+    p384_mul( s1, s1, z2z2 );
+    p384_mul( s2, Q->Y, P->Z );
+    p384_mul( s2, s2, z1z1 );
+    p384_sub( h, u2, u1 );
+    p384_sub( r, s2, s1 );
+
+    if( ( p384_is_zero( h ) & p384_is_zero( r ) & ~p_inf & ~q_inf ) != 0 )
+    {
+        p384_point_double( R, P );
+        return;
+    }
+
+    p384_add( r, r, r );
+    p384_add( i, h, h );
+    p384_sqr( i, i );
+    p384_mul( j, h, i );
+    p384_mul( v, u1, i );
+
+    /* X3 = r^2 - J - 2 * V */
+    p384_sqr( S.X, r );
+    p384_sub( S.X, S.X, j );
+    p384_sub( S.X, S.X, v );
+    p384_sub( S.X, S.X, v );
+
+    /* Y3 = r * ( V - X3 ) - 2 * S1 * J */
+    p384_sub( t, v, S.X );
+    p384_mul( S.Y, r, t );
+    p384_mul( t, s1, j );
+    p384_add( t, t, t );
+    p384_sub( S.Y, S.Y, t );
+
+    /* Z3 = ( ( Z1 + Z2 )^2 - Z1Z1 - Z2Z2 ) * H */
+    p384_add( t, P->Z, Q->Z );
+    p384_sqr( t, t );
+    p384_sub( t, t, z1z1 );
+    p384_sub( t, t, z2z2 );
+    p384_mul( S.Z, t, h );
+
+    p384_point_cmov( &S, Q, p_inf );
+    p384_point_cmov( &S, P, q_inf );
+
+    *R = S;
+}
+
+/*
+ * Mixed addition R = P + Q with Q affine, "madd-2007-bl": 7M + 4S.
+ * q_inf is all-ones if Q is to be taken as the point at infinity.
+ * Same exceptional cases as p384_point_add(). R may alias P.
+ */
+static void p384_point_add_affine( p384_point *R, const p384_point *P,
+                                   const p384_affine *Q, uint64_t q_inf )
+{
+    p384_fe z1z1, u2, s2, h, r, i, j, v, t;
+    p384_point S;
+    uint64_t p_inf;
+
+    p_inf = p384_is_zero( P->Z );
+
+    p384_sqr( z1z1, P->Z );
+    p384_mul( u2, Q->x, z1z1 );
+    p384_mul( s2, Q->y, P->Z );
+    p384_mul( s2, s2, z1z1 );
+    p384_sub( h, u2, P->X );
+    p384_sub( r, s2, P->Y );
+
+    if( ( p384_is_zero( h ) & p384_is_zero( r ) & ~p_inf & ~q_inf ) != 0 )
+    {
+        p384_point_double( R, P );
+        return;
+    }
+
+    p384_add( r, r, r );
+    p384_add( i, h, h );
+    p384_sqr( i, i );
+    p384_mul( j, h, i );
+    p384_mul( v, P->X, i );
+
+    /* X3 = r^2 - J - 2 * V */
+    p384_sqr( S.X, r );
+    p384_sub( S.X, S.X, j );
+    p384_sub( S.X, S.X, v );
+    p384_sub( S.X, S.X, v );
+
+    /* Y3 = r * ( V - X3 ) - 2 * Y1 * J */
+    p384_sub( t, v, S.X );
+    p384_mul( S.Y, r, t );
+    p384_mul( t, P->Y, j );
+    p384_add( t, t, t );
+    p384_sub( S.Y, S.Y, t );
+
+    /* Z3 = 2 * Z1 * H */
+    p384_mul( t, P->Z, h );
+    p384_add( S.Z, t, t );
+
+    /* P at infinity: R = ( x2, y2, 1 ) */
+    p384_cmov( S.X, Q->x, p_inf );
+    p384_cmov( S.Y, Q->y, p_inf );
+    p384_cmov( S.Z, p384_one, p_inf );
+
+    p384_point_cmov( &S, P, q_inf );
+
+    *R = S;
+}
+
+/*
+ * All-ones if a == b, zero otherwise
+ */
+static uint64_t p384_ct_eq( uint64_t a, uint64_t b )
+{
+    uint64_t x = a ^ b;
+
+    return( ( ( x | ( (uint64_t) 0 - x ) ) >> 63 ) - 1 );
+}
+
+/*
+ * R = table[idx - 1], reading the whole table; returns all-ones if idx is 0
+ */
+static uint64_t p384_select_affine( p384_affine *R, const p384_affine table[15],
+                                    uint64_t idx )
+{
+    uint64_t i, mask;
+
+    memset( R, 0, sizeof( p384_affine ) );
+
+    for( i = 0; i < 15; i++ )
+    {
+        mask = p384_ct_eq( idx, i + 1 );
+        p384_cmov( R->x, table[i].x, mask );
+        p384_cmov( R->y, table[i].y, mask );
+    }
+
+    return( p384_ct_eq( idx, 0 ) );
+}
+
+/*
+ * R = table[idx], reading the whole table
+ */
+static void p384_select( p384_point *R, const p384_point table[16],
+                         uint64_t idx )
+{
+    uint64_t i;
+
+    memset( R, 0, sizeof( p384_point ) );
+
+    for( i = 0; i < 16; i++ )
+        p384_point_cmov( R, &table[i], p384_ct_eq( idx, i ) );
+}
+
+#define P384_BIT( k, i )    ( ( (k)[(i) >> 6] >> ( (i) & 63 ) ) & 1 )
+
+/*
+ * R = k * G with the comb tables: 47 doublings and 96 mixed additions
+ */
+static void p384_mul_g( p384_point *R, const uint64_t k[6] )
+{
+    p384_affine A;
+    uint64_t idx, inf;
+    size_t i, j, t;
+
+    memset( R, 0, sizeof( p384_point ) );
+
+    for( i = 48; i > 0; i-- )
+    {
+        j = i - 1;
+
+        if( j != 47 )
+            p384_point_double( R, R );
+
+        for( t = 0; t < 2; t++ )
+        {
+            idx = ( P384_BIT( k, j + 48 * t       )      ) |
+                  ( P384_BIT( k, j + 48 * t +  96 ) << 1 ) |
+                  ( P384_BIT( k, j + 48 * t + 192 ) << 2 ) |
+                  ( P384_BIT( k, j + 48 * t + 288 ) << 3 );
+
+            inf = p384_select_affine( &A, p384_g_table[t], idx );
+            p384_point_add_affine( R, R, &A, inf );
+        }
+    }
+
+    mbedtls_zeroize( &A, sizeof( A ) );
+}
+
+/*
+ * R = k * P with a fixed 4-bit window: 380 doublings and 96 additions
+ */
+static void p384_mul_var( p384_point *R, const uint64_t k[6],
+                          const p384_point *P )
+{
+    p384_point T[16], A;
+    uint64_t idx;
+    size_t i, j;
+
+    memset( &T[0], 0, sizeof( p384_point ) );
+    T[1] = *P;
+    p384_point_double( &T[2], P );
+    for( i = 3; i < 16; i++ )
+        p384_point_add( &T[i], &T[i - 1], P );
+
+    memset( R, 0, sizeof( p384_point ) );
+
+    for( i = 96; i > 0; i-- )
+    {
+        if( i != 96 )
+            for( j = 0; j < 4; j++ )
+                p384_point_double( R, R );
+
+        idx = ( k[( i - 1 ) >> 4] >> ( 4 * ( ( i - 1 ) & 15 ) ) ) & 15;
+
+        p384_select( &A, T, idx );
+        p384_point_add( R, R, &A );
+    }
+
+    mbedtls_zeroize( T, sizeof( T ) );
+    mbedtls_zeroize( &A, sizeof( A ) );
+}
+
+/*
+ * R = k * P, with the comb if P is the generator
+ */
+static int p384_mul_point( p384_point *R, const mbedtls_mpi *k,
+                           const mbedtls_ecp_point *P )
+{
+    int ret;
+    uint64_t kl[6];
+    p384_point Pj;
+
+    MBEDTLS_MPI_CHK( p384_from_mpi( kl, k ) );
+    MBEDTLS_MPI_CHK( p384_point_from_ecp( &Pj, P ) );
+
+    /* Comparing with the generator only involves public data */
+    if( memcmp( Pj.X, p384_g_table[0][0].x, sizeof( p384_fe ) ) == 0 &&
+        memcmp( Pj.Y, p384_g_table[0][0].y, sizeof( p384_fe ) ) == 0 )
+        p384_mul_g( R, kl );
+    else
+        p384_mul_var( R, kl, &Pj );
+
+cleanup:
+    mbedtls_zeroize( kl, sizeof( kl ) );
+
+    return( ret );
+}
+
+/*
+ * R = m * P
+ */
+int mbedtls_ecp_p384_mul( mbedtls_ecp_point *R, const mbedtls_mpi *m,
+                          const mbedtls_ecp_point *P )
+{
+    int ret;
+    p384_point Rj;
+
+    MBEDTLS_MPI_CHK( p384_mul_point( &Rj, m, P ) );
+    MBEDTLS_MPI_CHK( p384_point_to_ecp( R, &Rj ) );
+
+cleanup:
+    mbedtls_zeroize( &Rj, sizeof( Rj ) );
+
+    return( ret );
+}
+
+/*
+ * R[i] = Rj[i] in affine coordinates, the conversions sharing one inversion
+ * with Montgomery's trick, as in ecp_normalize_jac_many()
+ */
+static int p384_points_to_ecp( mbedtls_ecp_point R[], const p384_point Rj[],
+                               size_t count )
+{
+    int ret = 0;
+    size_t i;
+    p384_fe *c, u, zi;
+
+    c = mbedtls_calloc( count, sizeof( p384_fe ) );
+    if( c == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    /*
+     * c[i] = product of the non-zero Z_j for j < i, u = that of all of them
+     */
+    memcpy( u, p384_one, sizeof( p384_fe ) );
+    for( i = 0; i < count; i++ )
+    {
+        memcpy( c[i], u, sizeof( p384_fe ) );
+        if( ! p384_is_zero( Rj[i].Z ) )
+            p384_mul( u, u, Rj[i].Z );
+    }
+
+    p384_inv( u, u );
+
+    /*
+     * Walking back, u = 1 / (product of the non-zero Z_j for j <= i)
+     */
+    for( i = count; i-- > 0; )
+    {
+        if( p384_is_zero( Rj[i].Z ) )
+        {
+            MBEDTLS_MPI_CHK( mbedtls_ecp_set_zero( &R[i] ) );
+            continue;
+        }
+
+        p384_mul( zi, u, c[i] );
+        p384_mul( u, u, Rj[i].Z );
+        MBEDTLS_MPI_CHK( p384_point_to_ecp_zi( &R[i], &Rj[i], zi ) );
+    }
+
+cleanup:
+    mbedtls_zeroize( c, count * sizeof( p384_fe ) );
+    mbedtls_free( c );
+    mbedtls_zeroize( u, sizeof( u ) );
+    mbedtls_zeroize( zi, sizeof( zi ) );
+
+    return( ret );
+}
+
+/*
+ * R[i] = m[i] * P[i], with a single inversion for all the results
+ */
+int mbedtls_ecp_p384_mul_batch( mbedtls_ecp_point R[], const mbedtls_mpi m[],
+                                const mbedtls_ecp_point *P[], size_t count )
+{
+    int ret;
+    size_t i;
+    p384_point *Rj;
+
+    if( count == 0 )
+        return( 0 );
+
+    Rj = mbedtls_calloc( count, sizeof( p384_point ) );
+    if( Rj == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    for( i = 0; i < count; i++ )
+        MBEDTLS_MPI_CHK( p384_mul_point( &Rj[i], &m[i], P[i] ) );
+
+    MBEDTLS_MPI_CHK( p384_points_to_ecp( R, Rj, count ) );
+
+cleanup:
+    mbedtls_zeroize( Rj, count * sizeof( p384_point ) );
+    mbedtls_free( Rj );
+
+    return( ret );
+}
+
+/*
+ * R = m * P + n * Q
+ */
+int mbedtls_ecp_p384_muladd( mbedtls_ecp_point *R,
+                             const mbedtls_mpi *m, const mbedtls_ecp_point *P,
+                             const mbedtls_mpi *n, const mbedtls_ecp_point *Q )
+{
+    int ret;
+    p384_point A, B;
+
+    MBEDTLS_MPI_CHK( p384_mul_point( &A, m, P ) );
+    MBEDTLS_MPI_CHK( p384_mul_point( &B, n, Q ) );
+
+    p384_point_add( &A, &A, &B );
+
+    MBEDTLS_MPI_CHK( p384_point_to_ecp( R, &A ) );
+
+cleanup:
+    return( ret );
+}
+
+/*
+ * R[i] = m[i] * P[i] + n[i] * Q[i], with a single inversion for all the
+ * results
+ */
+int mbedtls_ecp_p384_muladd_batch( mbedtls_ecp_point R[],
+                                   const mbedtls_mpi m[],
+                                   const mbedtls_ecp_point *P[],
+                                   const mbedtls_mpi n[],
+                                   const mbedtls_ecp_point *Q[],
+                                   size_t count )
+{
+    int ret;
+    size_t i;
+    p384_point *Rj, B;
+
+    if( count == 0 )
+        return( 0 );
+
+    Rj = mbedtls_calloc( count, sizeof( p384_point ) );
+    if( Rj == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    for( i = 0; i < count; i++ )
+    {
+        MBEDTLS_MPI_CHK( p384_mul_point( &Rj[i], &m[i], P[i] ) );
+        MBEDTLS_MPI_CHK( p384_mul_point( &B, &n[i], Q[i] ) );
+
+        p384_point_add( &Rj[i], &Rj[i], &B );
+    }
+
+    MBEDTLS_MPI_CHK( p384_points_to_ecp( R, Rj, count ) );
+
+cleanup:
+    mbedtls_free( Rj );
+
+    return( ret );
+}
+
+/*
+ * R = m * P + sum( +- T[|k[i]| / 2] 2^i ), the second part being the
+ * comb method of ecp_mul_comb(): d doublings and d + 1 mixed additions
+ */
+int mbedtls_ecp_p384_muladd_comb( mbedtls_ecp_point *R,
+                                  const mbedtls_mpi *m,
+                                  const mbedtls_ecp_point *P,
+                                  const mbedtls_ecp_point T[], size_t T_size,
+                                  const unsigned char k[], size_t d, int neg )
+{
+    int ret;
+    size_t i;
+    p384_point A, B;
+    p384_affine *tab, S;
+    static const p384_fe zero = { 0, 0, 0, 0, 0, 0 };
+
+    tab = mbedtls_calloc( T_size, sizeof( p384_affine ) );
+    if( tab == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    /* The points of T are normalized, but their Z may have been freed */
+    for( i = 0; i < T_size; i++ )
+    {
+        MBEDTLS_MPI_CHK( p384_from_mpi( tab[i].x, &T[i].X ) );
+        MBEDTLS_MPI_CHK( p384_from_mpi( tab[i].y, &T[i].Y ) );
+        p384_mul( tab[i].x, tab[i].x, p384_rr );
+        p384_mul( tab[i].y, tab[i].y, p384_rr );
+    }
+
+    MBEDTLS_MPI_CHK( p384_mul_point( &A, m, P ) );
+
+    memset( &B, 0, sizeof( p384_point ) );
+
+    for( i = d + 1; i-- > 0; )
+    {
+        p384_point_double( &B, &B );
+
+        S = tab[( k[i] & 0x7F ) >> 1];
+        if( ( ( k[i] >> 7 ) ^ neg ) != 0 )
+            p384_sub( S.y, zero, S.y );
+
+        p384_point_add_affine( &B, &B, &S, 0 );
+    }
+
+    p384_point_add( &A, &A, &B );
+
+    MBEDTLS_MPI_CHK( p384_point_to_ecp( R, &A ) );
+
+cleanup:
+    mbedtls_free( tab );
+
+    return( ret );
+}
+
+#endif /* MBEDTLS_ECP_C && MBEDTLS_ECP_P384_FAST && ... */
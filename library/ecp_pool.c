@@ -0,0 +1,383 @@
+/*
+ *  Pool of precomputed ephemeral EC values
+ *
+ *  Copyright (C) 2006-2017, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+/*
+ * Entries are kept in a flat array, used ones first; taking an entry moves
+ * the last used one into its slot. Values are generated without holding the
+ * lock and only inserted under it.
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ECP_POOL_C)
+
+#include "mbedtls/ecp_pool.h"
+
+#include <string.h>
+
+#if defined(MBEDTLS_PLATFORM_C)
+#include "mbedtls/platform.h"
+#else
+#include <stdlib.h>
+#define mbedtls_calloc    calloc
+#define mbedtls_free      free
+#endif
+
+static void ecp_pool_entry_init( mbedtls_ecp_pool_entry *e )
+{
+    e->type = MBEDTLS_ECP_POOL_NONE;
+    e->grp_id = MBEDTLS_ECP_DP_NONE;
+    mbedtls_mpi_init( &e->d );
+    mbedtls_ecp_point_init( &e->Q );
+    mbedtls_mpi_init( &e->r );
+}
+
+/* mbedtls_mpi_free() wipes the limbs before releasing them */
+static void ecp_pool_entry_free( mbedtls_ecp_pool_entry *e )
+{
+    mbedtls_mpi_free( &e->d );
+    mbedtls_ecp_point_free( &e->Q );
+    mbedtls_mpi_free( &e->r );
+    ecp_pool_entry_init( e );
+}
+
+void mbedtls_ecp_pool_init( mbedtls_ecp_pool_context *ctx )
+{
+    memset( ctx, 0, sizeof( mbedtls_ecp_pool_context ) );
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_init( &ctx->mutex );
+#endif
+}
+
+int mbedtls_ecp_pool_setup( mbedtls_ecp_pool_context *ctx, size_t capacity )
+{
+    size_t i;
+
+    if( ctx == NULL || capacity == 0 || ctx->entries != NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    ctx->entries = mbedtls_calloc( capacity, sizeof( mbedtls_ecp_pool_entry ) );
+    if( ctx->entries == NULL )
+        return( MBEDTLS_ERR_ECP_ALLOC_FAILED );
+
+    for( i = 0; i < capacity; i++ )
+        ecp_pool_entry_init( &ctx->entries[i] );
+
+    ctx->capacity = capacity;
+    ctx->used = 0;
+
+    return( 0 );
+}
+
+void mbedtls_ecp_pool_free( mbedtls_ecp_pool_context *ctx )
+{
+    size_t i;
+
+    if( ctx == NULL )
+        return;
+
+    if( ctx->entries != NULL )
+    {
+        for( i = 0; i < ctx->used; i++ )
+            ecp_pool_entry_free( &ctx->entries[i] );
+
+        mbedtls_free( ctx->entries );
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_free( &ctx->mutex );
+#endif
+
+    ctx->entries = NULL;
+    ctx->capacity = 0;
+    ctx->used = 0;
+}
+
+/*
+ * Generate an ECDSA nonce: r = x(kG) mod n != 0 and k^-1 mod n,
+ * following steps 1-3 and the inversion of SEC1 4.1.3
+ */
+static int ecp_pool_gen_nonce( mbedtls_ecp_group *grp,
+                               mbedtls_mpi *k_inv, mbedtls_mpi *r,
+                               int (*f_rng)(void *, unsigned char *, size_t),
+                               void *p_rng )
+{
+    int ret, key_tries = 0, blind_tries = 0;
+    size_t n_size = ( grp->nbits + 7 ) / 8;
+    mbedtls_ecp_point R;
+    mbedtls_mpi k, t;
+
+    mbedtls_ecp_point_init( &R );
+    mbedtls_mpi_init( &k ); mbedtls_mpi_init( &t );
+
+    do
+    {
+        MBEDTLS_MPI_CHK( mbedtls_ecp_gen_keypair( grp, &k, &R, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( r, &R.X, &grp->N ) );
+
+        if( ++key_tries > 10 )
+        {
+            ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+            goto cleanup;
+        }
+    }
+    while( mbedtls_mpi_cmp_int( r, 0 ) == 0 );
+
+    /* Blind the inversion as mbedtls_ecdsa_sign() does */
+    do
+    {
+        MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( &t, n_size, f_rng, p_rng ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_r( &t, 8 * n_size - grp->nbits ) );
+
+        if( ++blind_tries > 30 )
+        {
+            ret = MBEDTLS_ERR_ECP_RANDOM_FAILED;
+            goto cleanup;
+        }
+    }
+    while( mbedtls_mpi_cmp_int( &t, 1 ) < 0 ||
+           mbedtls_mpi_cmp_mpi( &t, &grp->N ) >= 0 );
+
+    /* k^-1 = t / (kt) mod n */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &k, &k, &t ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( k_inv, &k, &grp->N ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( k_inv, k_inv, &t ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( k_inv, k_inv, &grp->N ) );
+
+cleanup:
+    mbedtls_ecp_point_free( &R );
+    mbedtls_mpi_free( &k ); mbedtls_mpi_free( &t );
+
+    return( ret );
+}
+
+static int ecp_pool_lock( mbedtls_ecp_pool_context *ctx )
+{
+#if defined(MBEDTLS_THREADING_C)
+    return( mbedtls_mutex_lock( &ctx->mutex ) );
+#else
+    (void) ctx;
+    return( 0 );
+#endif
+}
+
+static int ecp_pool_unlock( mbedtls_ecp_pool_context *ctx )
+{
+#if defined(MBEDTLS_THREADING_C)
+    return( mbedtls_mutex_unlock( &ctx->mutex ) );
+#else
+    (void) ctx;
+    return( 0 );
+#endif
+}
+
+/*
+ * Move *e into the pool if there is room, otherwise leave it untouched.
+ * Sets *full if the pool has no room left afterwards.
+ */
+static int ecp_pool_add( mbedtls_ecp_pool_context *ctx,
+                         mbedtls_ecp_pool_entry *e, int *full )
+{
+    int ret;
+
+    if( ( ret = ecp_pool_lock( ctx ) ) != 0 )
+        return( ret );
+
+    if( e != NULL && ctx->used < ctx->capacity )
+    {
+        ctx->entries[ctx->used++] = *e;
+        ecp_pool_entry_init( e );
+    }
+
+    *full = ( ctx->used == ctx->capacity );
+
+    return( ecp_pool_unlock( ctx ) );
+}
+
+int mbedtls_ecp_pool_fill( mbedtls_ecp_pool_context *ctx,
+                           mbedtls_ecp_pool_type type,
+                           mbedtls_ecp_group_id grp_id, size_t count,
+                           int (*f_rng)(void *, unsigned char *, size_t),
+                           void *p_rng )
+{
+    int ret, full = 0;
+    size_t i;
+    mbedtls_ecp_group grp;
+    mbedtls_ecp_pool_entry e;
+
+    if( ctx == NULL || ctx->entries == NULL || f_rng == NULL ||
+        ( type != MBEDTLS_ECP_POOL_KEYPAIR && type != MBEDTLS_ECP_POOL_NONCE ) )
+    {
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+    }
+
+    mbedtls_ecp_group_init( &grp );
+    ecp_pool_entry_init( &e );
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_group_load( &grp, grp_id ) );
+
+    /* Fail cleanly on curves such as Curve25519 that can't be used for ECDSA */
+    if( type == MBEDTLS_ECP_POOL_NONCE && grp.N.p == NULL )
+    {
+        ret = MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
+        goto cleanup;
+    }
+
+    for( i = 0; i < count; i++ )
+    {
+        /* Don't spend a multiplication on a value we can't store */
+        MBEDTLS_MPI_CHK( ecp_pool_add( ctx, NULL, &full ) );
+        if( full )
+            break;
+
+        e.type = type;
+        e.grp_id = grp_id;
+
+        if( type == MBEDTLS_ECP_POOL_KEYPAIR )
+            MBEDTLS_MPI_CHK( mbedtls_ecp_gen_keypair( &grp, &e.d, &e.Q,
+                                                      f_rng, p_rng ) );
+        else
+            MBEDTLS_MPI_CHK( ecp_pool_gen_nonce( &grp, &e.d, &e.r,
+                                                 f_rng, p_rng ) );
+
+        MBEDTLS_MPI_CHK( ecp_pool_add( ctx, &e, &full ) );
+
+        /* Lost a race against another filler */
+        if( e.type != MBEDTLS_ECP_POOL_NONE )
+            break;
+    }
+
+cleanup:
+    ecp_pool_entry_free( &e );
+    mbedtls_ecp_group_free( &grp );
+
+    return( ret );
+}
+
+size_t mbedtls_ecp_pool_count( mbedtls_ecp_pool_context *ctx,
+                               mbedtls_ecp_pool_type type,
+                               mbedtls_ecp_group_id grp_id )
+{
+    size_t i, n = 0;
+
+    if( ctx == NULL || ecp_pool_lock( ctx ) != 0 )
+        return( 0 );
+
+    for( i = 0; i < ctx->used; i++ )
+    {
+        if( ctx->entries[i].type == type &&
+            ( grp_id == MBEDTLS_ECP_DP_NONE ||
+              ctx->entries[i].grp_id == grp_id ) )
+        {
+            n++;
+        }
+    }
+
+    if( ecp_pool_unlock( ctx ) != 0 )
+        return( 0 );
+
+    return( n );
+}
+
+/*
+ * Remove a matching entry from the pool and move it to *e
+ */
+static int ecp_pool_take( mbedtls_ecp_pool_context *ctx,
+                          mbedtls_ecp_pool_type type,
+                          mbedtls_ecp_group_id grp_id,
+                          mbedtls_ecp_pool_entry *e )
+{
+    int ret, unlock_ret;
+    size_t i;
+
+    if( ctx == NULL || ctx->entries == NULL )
+        return( MBEDTLS_ERR_ECP_BAD_INPUT_DATA );
+
+    if( ( ret = ecp_pool_lock( ctx ) ) != 0 )
+        return( ret );
+
+    ret = MBEDTLS_ERR_ECP_POOL_EMPTY;
+
+    for( i = ctx->used; i > 0; i-- )
+    {
+        if( ctx->entries[i - 1].type == type &&
+            ctx->entries[i - 1].grp_id == grp_id )
+        {
+            *e = ctx->entries[i - 1];
+            ctx->entries[i - 1] = ctx->entries[ctx->used - 1];
+            ecp_pool_entry_init( &ctx->entries[--ctx->used] );
+            ret = 0;
+            break;
+        }
+    }
+
+    if( ( unlock_ret = ecp_pool_unlock( ctx ) ) != 0 && ret == 0 )
+    {
+        ecp_pool_entry_free( e );
+        ret = unlock_ret;
+    }
+
+    return( ret );
+}
+
+int mbedtls_ecp_pool_take_keypair( mbedtls_ecp_pool_context *ctx,
+                                   mbedtls_ecp_group_id grp_id,
+                                   mbedtls_mpi *d, mbedtls_ecp_point *Q )
+{
+    int ret;
+    mbedtls_ecp_pool_entry e;
+
+    ecp_pool_entry_init( &e );
+
+    MBEDTLS_MPI_CHK( ecp_pool_take( ctx, MBEDTLS_ECP_POOL_KEYPAIR, grp_id, &e ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( d, &e.d ) );
+    MBEDTLS_MPI_CHK( mbedtls_ecp_copy( Q, &e.Q ) );
+
+cleanup:
+    ecp_pool_entry_free( &e );
+
+    return( ret );
+}
+
+int mbedtls_ecp_pool_take_nonce( mbedtls_ecp_pool_context *ctx,
+                                 mbedtls_ecp_group_id grp_id,
+                                 mbedtls_mpi *k_inv, mbedtls_mpi *r )
+{
+    int ret;
+    mbedtls_ecp_pool_entry e;
+
+    ecp_pool_entry_init( &e );
+
+    MBEDTLS_MPI_CHK( ecp_pool_take( ctx, MBEDTLS_ECP_POOL_NONCE, grp_id, &e ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( k_inv, &e.d ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( r, &e.r ) );
+
+cleanup:
+    ecp_pool_entry_free( &e );
+
+    return( ret );
+}
+
+#endif /* MBEDTLS_ECP_POOL_C */
@@ -0,0 +1,653 @@
+/*
+ *  Elliptic curves over GF(p): dedicated Curve25519 arithmetic
+ *
+ *  Copyright (C) 2006-2017, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+
+/*
+ * References:
+ *
+ * RFC 7748 Elliptic Curves for Security, section 5 (the X25519 ladder)
+ * D. J. Bernstein, Curve25519: new Diffie-Hellman speed records, PKC 2006
+ * A. Langley, curve25519-donna, https://github.com/agl/curve25519-donna
+ *     (radix 2^51 representation)
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ECP_C) && defined(MBEDTLS_ECP_X25519_FAST) && \
+    defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED) && \
+    !defined(MBEDTLS_ECP_ALT)
+#define X25519_LADDER
+#endif
+
+#if defined(X25519_LADDER) || defined(MBEDTLS_ED25519_C)
+
+#include "mbedtls/ecp_x25519.h"
+#include "ecp_x25519_fe.h"
+
+#include <string.h>
+
+#if ( defined(__ARMCC_VERSION) || defined(_MSC_VER) ) && \
+    !defined(inline) && !defined(__cplusplus)
+#define inline __inline
+#endif
+
+/* Implementation that should never be optimized out by the compiler */
+static void mbedtls_zeroize( void *v, size_t n ) {
+    volatile unsigned char *p = v; while( n-- ) *p++ = 0;
+}
+
+#if defined(_MSC_VER) || defined(__WATCOMC__)
+  #define UL64(x) x##ui64
+#else
+  #define UL64(x) x##ULL
+#endif
+
+#define X25519_MASK51   UL64(0x0007FFFFFFFFFFFF)
+
+/*
+ * Field elements are five 51-bit limbs, least significant first. Limbs are
+ * allowed to grow a few bits past 51 between multiplications; only
+ * x25519_fe_reduce() produces the canonical value. Nothing below branches
+ * on, or indexes memory with, secret data.
+ */
+typedef mbedtls_x25519_fe x25519_fe;
+
+/*
+ * Accumulators for sums of 64 x 64-bit products. With inputs below 2^54
+ * every sum stays under 2^115.
+ */
+#if defined(MBEDTLS_HAVE_INT64) && defined(MBEDTLS_HAVE_UDBL)
+typedef mbedtls_t_udbl x25519_acc;
+
+static inline void x25519_acc_mul( x25519_acc *r, uint64_t a, uint64_t b )
+{
+    *r = (mbedtls_t_udbl) a * b;
+}
+
+static inline void x25519_acc_mla( x25519_acc *r, uint64_t a, uint64_t b )
+{
+    *r += (mbedtls_t_udbl) a * b;
+}
+
+static inline void x25519_acc_add( x25519_acc *r, uint64_t a )
+{
+    *r += a;
+}
+
+static inline uint64_t x25519_acc_lo( const x25519_acc *r )
+{
+    return( (uint64_t) *r & X25519_MASK51 );
+}
+
+static inline uint64_t x25519_acc_hi( const x25519_acc *r )
+{
+    return( (uint64_t)( *r >> 51 ) );
+}
+#else
+typedef struct
+{
+    uint64_t lo, hi;
+}
+x25519_acc;
+
+static inline void x25519_acc_mul( x25519_acc *r, uint64_t a, uint64_t b )
+{
+    uint64_t a0 = a & 0xFFFFFFFF, a1 = a >> 32;
+    uint64_t b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+    uint64_t t, u, v;
+
+    t = a0 * b0;
+    u = a1 * b0 + ( t >> 32 );
+    v = a0 * b1 + ( u & 0xFFFFFFFF );
+
+    r->lo = ( v << 32 ) | ( t & 0xFFFFFFFF );
+    r->hi = a1 * b1 + ( u >> 32 ) + ( v >> 32 );
+}
+
+static inline void x25519_acc_mla( x25519_acc *r, uint64_t a, uint64_t b )
+{
+    x25519_acc t;
+
+    x25519_acc_mul( &t, a, b );
+    r->lo += t.lo;
+    r->hi += t.hi + ( r->lo < t.lo );
+}
+
+static inline void x25519_acc_add( x25519_acc *r, uint64_t a )
+{
+    r->lo += a;
+    r->hi += ( r->lo < a );
+}
+
+static inline uint64_t x25519_acc_lo( const x25519_acc *r )
+{
+    return( r->lo & X25519_MASK51 );
+}
+
+static inline uint64_t x25519_acc_hi( const x25519_acc *r )
+{
+    return( ( r->lo >> 51 ) | ( r->hi << 13 ) );
+}
+#endif /* MBEDTLS_HAVE_INT64 && MBEDTLS_HAVE_UDBL */
+
+/*
+ * h = r[0] + 2^51 r[1] + ... + 2^204 r[4] mod p, with limbs below
+ * 2^51 + 2^18
+ */
+static void x25519_carry( x25519_fe h, x25519_acc r[5] )
+{
+    x25519_acc t;
+    uint64_t c;
+
+    x25519_acc_add( &r[1], x25519_acc_hi( &r[0] ) ); h[0] = x25519_acc_lo( &r[0] );
+    x25519_acc_add( &r[2], x25519_acc_hi( &r[1] ) ); h[1] = x25519_acc_lo( &r[1] );
+    x25519_acc_add( &r[3], x25519_acc_hi( &r[2] ) ); h[2] = x25519_acc_lo( &r[2] );
+    x25519_acc_add( &r[4], x25519_acc_hi( &r[3] ) ); h[3] = x25519_acc_lo( &r[3] );
+    c = x25519_acc_hi( &r[4] );                      h[4] = x25519_acc_lo( &r[4] );
+
+    /* 2^255 = 19 mod p; c can be close to 2^64 so fold it with a product */
+    x25519_acc_mul( &t, c, 19 );
+    x25519_acc_add( &t, h[0] );
+    h[0] = x25519_acc_lo( &t );
+    h[1] += x25519_acc_hi( &t );
+}
+
+/*
+ * r = a + b, inputs below 2^53
+ */
+static void x25519_add( x25519_fe r, const x25519_fe a, const x25519_fe b )
+{
+    size_t i;
+
+    for( i = 0; i < 5; i++ )
+        r[i] = a[i] + b[i];
+}
+
+/*
+ * r = a - b + 2p, with b a product (limbs below 2^51 + 2^18)
+ */
+static void x25519_sub( x25519_fe r, const x25519_fe a, const x25519_fe b )
+{
+    r[0] = a[0] + UL64(0x000FFFFFFFFFFFDA) - b[0];
+    r[1] = a[1] + UL64(0x000FFFFFFFFFFFFE) - b[1];
+    r[2] = a[2] + UL64(0x000FFFFFFFFFFFFE) - b[2];
+    r[3] = a[3] + UL64(0x000FFFFFFFFFFFFE) - b[3];
+    r[4] = a[4] + UL64(0x000FFFFFFFFFFFFE) - b[4];
+}
+
+/*
+ * r = a * b, inputs below 2^54
+ */
+static void x25519_mul( x25519_fe h, const x25519_fe a, const x25519_fe b )
+{
+    x25519_acc r[5];
+    uint64_t b1 = 19 * b[1], b2 = 19 * b[2], b3 = 19 * b[3], b4 = 19 * b[4];
+
+    x25519_acc_mul( &r[0], a[0], b[0] );
+    x25519_acc_mla( &r[0], a[1], b4 );
+    x25519_acc_mla( &r[0], a[2], b3 );
+    x25519_acc_mla( &r[0], a[3], b2 );
+    x25519_acc_mla( &r[0], a[4], b1 );
+
+    x25519_acc_mul( &r[1], a[0], b[1] );
+    x25519_acc_mla( &r[1], a[1], b[0] );
+    x25519_acc_mla( &r[1], a[2], b4 );
+    x25519_acc_mla( &r[1], a[3], b3 );
+    x25519_acc_mla( &r[1], a[4], b2 );
+
+    x25519_acc_mul( &r[2], a[0], b[2] );
+    x25519_acc_mla( &r[2], a[1], b[1] );
+    x25519_acc_mla( &r[2], a[2], b[0] );
+    x25519_acc_mla( &r[2], a[3], b4 );
+    x25519_acc_mla( &r[2], a[4], b3 );
+
+    x25519_acc_mul( &r[3], a[0], b[3] );
+    x25519_acc_mla( &r[3], a[1], b[2] );
+    x25519_acc_mla( &r[3], a[2], b[1] );
+    x25519_acc_mla( &r[3], a[3], b[0] );
+    x25519_acc_mla( &r[3], a[4], b4 );
+
+    x25519_acc_mul( &r[4], a[0], b[4] );
+    x25519_acc_mla( &r[4], a[1], b[3] );
+    x25519_acc_mla( &r[4], a[2], b[2] );
+    x25519_acc_mla( &r[4], a[3], b[1] );
+    x25519_acc_mla( &r[4], a[4], b[0] );
+
+    x25519_carry( h, r );
+}
+
+/*
+ * r = a^2, input below 2^54
+ */
+static void x25519_sqr( x25519_fe h, const x25519_fe a )
+{
+    x25519_acc r[5];
+    uint64_t d0 = 2 * a[0], d1 = 2 * a[1], d2 = 2 * a[2], d3 = 2 * a[3];
+    uint64_t a3_19 = 19 * a[3], a4_19 = 19 * a[4];
+
+    x25519_acc_mul( &r[0], a[0], a[0] );
+    x25519_acc_mla( &r[0], d1, a4_19 );
+    x25519_acc_mla( &r[0], d2, a3_19 );
+
+    x25519_acc_mul( &r[1], d0, a[1] );
+    x25519_acc_mla( &r[1], d2, a4_19 );
+    x25519_acc_mla( &r[1], a[3], a3_19 );
+
+    x25519_acc_mul( &r[2], d0, a[2] );
+    x25519_acc_mla( &r[2], a[1], a[1] );
+    x25519_acc_mla( &r[2], d3, a4_19 );
+
+    x25519_acc_mul( &r[3], d0, a[3] );
+    x25519_acc_mla( &r[3], d1, a[2] );
+    x25519_acc_mla( &r[3], a[4], a4_19 );
+
+    x25519_acc_mul( &r[4], d0, a[4] );
+    x25519_acc_mla( &r[4], d1, a[3] );
+    x25519_acc_mla( &r[4], a[2], a[2] );
+
+    x25519_carry( h, r );
+}
+
+static void x25519_sqr_n( x25519_fe r, const x25519_fe a, unsigned n )
+{
+    x25519_sqr( r, a );
+    while( --n > 0 )
+        x25519_sqr( r, r );
+}
+
+/*
+ * r = a^(p - 2) = 1 / a, or 0 if a = 0
+ * with p - 2 = 2^255 - 21 (same addition chain as the reference code)
+ */
+static void x25519_inv( x25519_fe r, const x25519_fe a )
+{
+    x25519_fe z2, z9, z11, z2_5_0, z2_10_0, z2_20_0, z2_50_0, z2_100_0, t;
+
+    x25519_sqr( z2, a );                                /* 2 */
+    x25519_sqr_n( t, z2, 2 );                           /* 8 */
+    x25519_mul( z9, t, a );                             /* 9 */
+    x25519_mul( z11, z9, z2 );                          /* 11 */
+    x25519_sqr( t, z11 );                               /* 22 */
+    x25519_mul( z2_5_0, t, z9 );                        /* 2^5 - 1 */
+    x25519_sqr_n( t, z2_5_0, 5 );
+    x25519_mul( z2_10_0, t, z2_5_0 );                   /* 2^10 - 1 */
+    x25519_sqr_n( t, z2_10_0, 10 );
+    x25519_mul( z2_20_0, t, z2_10_0 );                  /* 2^20 - 1 */
+    x25519_sqr_n( t, z2_20_0, 20 );
+    x25519_mul( t, t, z2_20_0 );                        /* 2^40 - 1 */
+    x25519_sqr_n( t, t, 10 );
+    x25519_mul( z2_50_0, t, z2_10_0 );                  /* 2^50 - 1 */
+    x25519_sqr_n( t, z2_50_0, 50 );
+    x25519_mul( z2_100_0, t, z2_50_0 );                 /* 2^100 - 1 */
+    x25519_sqr_n( t, z2_100_0, 100 );
+    x25519_mul( t, t, z2_100_0 );                       /* 2^200 - 1 */
+    x25519_sqr_n( t, t, 50 );
+    x25519_mul( t, t, z2_50_0 );                        /* 2^250 - 1 */
+    x25519_sqr_n( t, t, 5 );
+    x25519_mul( r, t, z11 );                            /* 2^255 - 21 */
+}
+
+/*
+ * Fully reduce h modulo p, input limbs below 2^51 + 2^18
+ */
+static void x25519_fe_reduce( x25519_fe h )
+{
+    uint64_t q;
+
+    /* h < 2p, so q = 1 exactly when h >= p */
+    q = ( h[0] + 19 ) >> 51;
+    q = ( h[1] + q ) >> 51;
+    q = ( h[2] + q ) >> 51;
+    q = ( h[3] + q ) >> 51;
+    q = ( h[4] + q ) >> 51;
+
+    /* h - q p = h + 19 q - 2^255 q */
+    h[0] += 19 * q;
+    h[1] += h[0] >> 51; h[0] &= X25519_MASK51;
+    h[2] += h[1] >> 51; h[1] &= X25519_MASK51;
+    h[3] += h[2] >> 51; h[2] &= X25519_MASK51;
+    h[4] += h[3] >> 51; h[3] &= X25519_MASK51;
+                        h[4] &= X25519_MASK51;
+}
+
+/*
+ * Load a 256-bit little-endian value, reduced modulo p
+ */
+static void x25519_fe_load( x25519_fe h, const unsigned char s[32] )
+{
+    uint64_t w[4];
+    size_t i, j;
+
+    for( i = 0; i < 4; i++ )
+    {
+        w[i] = 0;
+        for( j = 0; j < 8; j++ )
+            w[i] |= (uint64_t) s[8 * i + j] << ( 8 * j );
+    }
+
+    h[0] =   w[0]                          & X25519_MASK51;
+    h[1] = ( ( w[0] >> 51 ) | ( w[1] << 13 ) ) & X25519_MASK51;
+    h[2] = ( ( w[1] >> 38 ) | ( w[2] << 26 ) ) & X25519_MASK51;
+    h[3] = ( ( w[2] >> 25 ) | ( w[3] << 39 ) ) & X25519_MASK51;
+    h[4] =   ( w[3] >> 12 )                & X25519_MASK51;
+
+    /* Bit 255 stands for 2^255 = 19 mod p */
+    h[0] += 19 * ( w[3] >> 63 );
+
+    x25519_fe_reduce( h );
+
+    mbedtls_zeroize( w, sizeof( w ) );
+}
+
+/*
+ * Store a fully reduced value as 32 little-endian bytes
+ */
+static void x25519_fe_store( unsigned char s[32], const x25519_fe h )
+{
+    uint64_t w[4];
+    size_t i, j;
+
+    w[0] =   h[0]         | ( h[1] << 51 );
+    w[1] = ( h[1] >> 13 ) | ( h[2] << 38 );
+    w[2] = ( h[2] >> 26 ) | ( h[3] << 25 );
+    w[3] = ( h[3] >> 39 ) | ( h[4] << 12 );
+
+    for( i = 0; i < 4; i++ )
+        for( j = 0; j < 8; j++ )
+            s[8 * i + j] = (unsigned char)( w[i] >> ( 8 * j ) );
+
+    mbedtls_zeroize( w, sizeof( w ) );
+}
+
+#if defined(MBEDTLS_ED25519_C)
+/*
+ * Carry h so that its limbs are below 2^51 + 2^8
+ */
+static void x25519_fe_carry( x25519_fe h )
+{
+    uint64_t c;
+
+    c = h[0] >> 51; h[0] &= X25519_MASK51; h[1] += c;
+    c = h[1] >> 51; h[1] &= X25519_MASK51; h[2] += c;
+    c = h[2] >> 51; h[2] &= X25519_MASK51; h[3] += c;
+    c = h[3] >> 51; h[3] &= X25519_MASK51; h[4] += c;
+    c = h[4] >> 51; h[4] &= X25519_MASK51; h[0] += 19 * c;
+}
+
+/*
+ * Entry points for the Ed25519 module: unlike the ladder, these keep every
+ * output carried so that the callers need not track limb bounds.
+ */
+void mbedtls_x25519_fe_frombytes( mbedtls_x25519_fe h,
+                                  const unsigned char s[32] )
+{
+    x25519_fe_load( h, s );
+}
+
+void mbedtls_x25519_fe_tobytes( unsigned char s[32],
+                                const mbedtls_x25519_fe h )
+{
+    x25519_fe t;
+
+    memcpy( t, h, sizeof( x25519_fe ) );
+    x25519_fe_reduce( t );
+    x25519_fe_store( s, t );
+
+    mbedtls_zeroize( t, sizeof( t ) );
+}
+
+void mbedtls_x25519_fe_add( mbedtls_x25519_fe h, const mbedtls_x25519_fe a,
+                            const mbedtls_x25519_fe b )
+{
+    x25519_add( h, a, b );
+    x25519_fe_carry( h );
+}
+
+void mbedtls_x25519_fe_sub( mbedtls_x25519_fe h, const mbedtls_x25519_fe a,
+                            const mbedtls_x25519_fe b )
+{
+    x25519_sub( h, a, b );
+    x25519_fe_carry( h );
+}
+
+void mbedtls_x25519_fe_mul( mbedtls_x25519_fe h, const mbedtls_x25519_fe a,
+                            const mbedtls_x25519_fe b )
+{
+    x25519_mul( h, a, b );
+}
+
+void mbedtls_x25519_fe_sqr( mbedtls_x25519_fe h, const mbedtls_x25519_fe a )
+{
+    x25519_sqr( h, a );
+}
+
+void mbedtls_x25519_fe_inv( mbedtls_x25519_fe h, const mbedtls_x25519_fe a )
+{
+    x25519_inv( h, a );
+}
+
+/*
+ * r = a^((p - 5) / 8) = a^(2^252 - 3), for square roots
+ */
+void mbedtls_x25519_fe_pow22523( mbedtls_x25519_fe r,
+                                 const mbedtls_x25519_fe a )
+{
+    x25519_fe t0, t1, t2;
+
+    x25519_sqr( t0, a );                                /* 2 */
+    x25519_sqr_n( t1, t0, 2 );                          /* 8 */
+    x25519_mul( t1, a, t1 );                            /* 9 */
+    x25519_mul( t0, t0, t1 );                           /* 11 */
+    x25519_sqr( t0, t0 );                               /* 22 */
+    x25519_mul( t0, t1, t0 );                           /* 2^5 - 1 */
+    x25519_sqr_n( t1, t0, 5 );
+    x25519_mul( t0, t1, t0 );                           /* 2^10 - 1 */
+    x25519_sqr_n( t1, t0, 10 );
+    x25519_mul( t1, t1, t0 );                           /* 2^20 - 1 */
+    x25519_sqr_n( t2, t1, 20 );
+    x25519_mul( t1, t2, t1 );                           /* 2^40 - 1 */
+    x25519_sqr_n( t1, t1, 10 );
+    x25519_mul( t0, t1, t0 );                           /* 2^50 - 1 */
+    x25519_sqr_n( t1, t0, 50 );
+    x25519_mul( t1, t1, t0 );                           /* 2^100 - 1 */
+    x25519_sqr_n( t2, t1, 100 );
+    x25519_mul( t1, t2, t1 );                           /* 2^200 - 1 */
+    x25519_sqr_n( t1, t1, 50 );
+    x25519_mul( t0, t1, t0 );                           /* 2^250 - 1 */
+    x25519_sqr_n( t0, t0, 2 );                          /* 2^252 - 4 */
+    x25519_mul( r, t0, a );                             /* 2^252 - 3 */
+}
+#endif /* MBEDTLS_ED25519_C */
+
+#if defined(X25519_LADDER)
+/*
+ * r = a * 121665 = a * (A - 2) / 4, input below 2^54
+ */
+static void x25519_mul_a24( x25519_fe h, const x25519_fe a )
+{
+    x25519_acc r[5];
+    size_t i;
+
+    for( i = 0; i < 5; i++ )
+        x25519_acc_mul( &r[i], a[i], 121665 );
+
+    x25519_carry( h, r );
+}
+
+/*
+ * Swap a and b if swap is 1, leave them alone if swap is 0
+ */
+static void x25519_cswap( x25519_fe a, x25519_fe b, uint64_t swap )
+{
+    uint64_t mask = (uint64_t) 0 - swap, x;
+    size_t i;
+
+    for( i = 0; i < 5; i++ )
+    {
+        x = mask & ( a[i] ^ b[i] );
+        a[i] ^= x;
+        b[i] ^= x;
+    }
+}
+
+/*
+ * Convert between MPIs and 32-byte little-endian strings
+ */
+static int x25519_read_mpi( unsigned char s[32], const mbedtls_mpi *X )
+{
+    int ret;
+    unsigned char be[32];
+    size_t i;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( X, be, sizeof( be ) ) );
+
+    for( i = 0; i < 32; i++ )
+        s[i] = be[31 - i];
+
+cleanup:
+    mbedtls_zeroize( be, sizeof( be ) );
+
+    return( ret );
+}
+
+static int x25519_write_mpi( mbedtls_mpi *X, const unsigned char s[32] )
+{
+    unsigned char be[32];
+    size_t i;
+
+    for( i = 0; i < 32; i++ )
+        be[i] = s[31 - i];
+
+    return( mbedtls_mpi_read_binary( X, be, sizeof( be ) ) );
+}
+
+/*
+ * X25519 Montgomery ladder (RFC 7748 section 5): out = X(k * u)
+ * k and u are 32-byte little-endian strings, k is used as is (the caller
+ * already checked that it is a valid private key).
+ */
+static void x25519_ladder( unsigned char out[32], const unsigned char k[32],
+                           const unsigned char u[32] )
+{
+    x25519_fe x1, x2, z2, x3, z3;
+    x25519_fe A, AA, B, BB, E, C, D, DA, CB;
+    uint64_t swap = 0, bit;
+    int t;
+
+    x25519_fe_load( x1, u );
+    memset( x2, 0, sizeof( x25519_fe ) ); x2[0] = 1;
+    memset( z2, 0, sizeof( x25519_fe ) );
+    memcpy( x3, x1, sizeof( x25519_fe ) );
+    memset( z3, 0, sizeof( x25519_fe ) ); z3[0] = 1;
+
+    for( t = 254; t >= 0; t-- )
+    {
+        bit = ( k[t >> 3] >> ( t & 7 ) ) & 1;
+        swap ^= bit;
+        x25519_cswap( x2, x3, swap );
+        x25519_cswap( z2, z3, swap );
+        swap = bit;
+
+        x25519_add( A, x2, z2 );
+        x25519_sqr( AA, A );
+        x25519_sub( B, x2, z2 );
+        x25519_sqr( BB, B );
+        x25519_sub( E, AA, BB );
+        x25519_add( C, x3, z3 );
+        x25519_sub( D, x3, z3 );
+        x25519_mul( DA, D, A );
+        x25519_mul( CB, C, B );
+
+        x25519_add( x3, DA, CB );
+        x25519_sqr( x3, x3 );
+        x25519_sub( z3, DA, CB );
+        x25519_sqr( z3, z3 );
+        x25519_mul( z3, z3, x1 );
+        x25519_mul( x2, AA, BB );
+        x25519_mul_a24( z2, E );
+        x25519_add( z2, z2, AA );
+        x25519_mul( z2, z2, E );
+    }
+
+    x25519_cswap( x2, x3, swap );
+    x25519_cswap( z2, z3, swap );
+
+    /* Zero for the point at infinity, since 0^(p - 2) = 0 */
+    x25519_inv( z2, z2 );
+    x25519_mul( x2, x2, z2 );
+    x25519_fe_reduce( x2 );
+    x25519_fe_store( out, x2 );
+
+    mbedtls_zeroize( x2, sizeof( x2 ) ); mbedtls_zeroize( z2, sizeof( z2 ) );
+    mbedtls_zeroize( x3, sizeof( x3 ) ); mbedtls_zeroize( z3, sizeof( z3 ) );
+    mbedtls_zeroize( A, sizeof( A ) );   mbedtls_zeroize( AA, sizeof( AA ) );
+    mbedtls_zeroize( B, sizeof( B ) );   mbedtls_zeroize( BB, sizeof( BB ) );
+    mbedtls_zeroize( E, sizeof( E ) );   mbedtls_zeroize( C, sizeof( C ) );
+    mbedtls_zeroize( D, sizeof( D ) );   mbedtls_zeroize( DA, sizeof( DA ) );
+    mbedtls_zeroize( CB, sizeof( CB ) );
+}
+
+/*
+ * R = m * P
+ */
+int mbedtls_ecp_x25519_mul( mbedtls_ecp_point *R, const mbedtls_mpi *m,
+                            const mbedtls_ecp_point *P )
+{
+    int ret;
+    unsigned char k[32], u[32], out[32], acc = 0;
+    size_t i;
+
+    MBEDTLS_MPI_CHK( x25519_read_mpi( k, m ) );
+    MBEDTLS_MPI_CHK( x25519_read_mpi( u, &P->X ) );
+
+    x25519_ladder( out, k, u );
+
+    /*
+     * With a valid private key the result is zero only when P has small
+     * order. The generic code fails to normalize the point at infinity in
+     * that case, so report the same error.
+     */
+    for( i = 0; i < 32; i++ )
+        acc |= out[i];
+
+    if( acc == 0 )
+    {
+        ret = MBEDTLS_ERR_MPI_NOT_ACCEPTABLE;
+        goto cleanup;
+    }
+
+    MBEDTLS_MPI_CHK( x25519_write_mpi( &R->X, out ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R->Z, 1 ) );
+    mbedtls_mpi_free( &R->Y );
+
+cleanup:
+    mbedtls_zeroize( k, sizeof( k ) );
+    mbedtls_zeroize( out, sizeof( out ) );
+
+    return( ret );
+}
+
+#endif /* X25519_LADDER */
+
+#endif /* X25519_LADDER || MBEDTLS_ED25519_C */
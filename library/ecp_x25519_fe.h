@@ -0,0 +1,76 @@
+/**
+ * \file ecp_x25519_fe.h
+ *
+ * \brief Field arithmetic modulo 2^255 - 19 (internal)
+ *
+ *  Copyright (C) 2006-2017, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ *
+ *
+ *  This header is internal to the library: it shares the field arithmetic
+ *  of the Curve25519 backend (library/ecp_x25519.c) with the Ed25519
+ *  module (library/ed25519.c), which works modulo the same prime.
+ */
+#ifndef MBEDTLS_ECP_X25519_FE_H
+#define MBEDTLS_ECP_X25519_FE_H
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include <stdint.h>
+
+/**
+ * \brief           Element of GF(2^255 - 19): five 51-bit limbs, least
+ *                  significant first
+ */
+typedef uint64_t mbedtls_x25519_fe[5];
+
+#if defined(MBEDTLS_ED25519_C)
+/*
+ * Field arithmetic for Ed25519. Outputs are carried (limbs below 2^52) but
+ * not canonical; only mbedtls_x25519_fe_tobytes() fully reduces. Inputs may
+ * alias outputs. All functions run in constant time.
+ */
+
+/** h = s mod p, s is 32 bytes little-endian (bit 255 included) */
+void mbedtls_x25519_fe_frombytes( mbedtls_x25519_fe h,
+                                  const unsigned char s[32] );
+/** s = canonical 32-byte little-endian encoding of h */
+void mbedtls_x25519_fe_tobytes( unsigned char s[32],
+                                const mbedtls_x25519_fe h );
+/** h = a + b */
+void mbedtls_x25519_fe_add( mbedtls_x25519_fe h, const mbedtls_x25519_fe a,
+                            const mbedtls_x25519_fe b );
+/** h = a - b */
+void mbedtls_x25519_fe_sub( mbedtls_x25519_fe h, const mbedtls_x25519_fe a,
+                            const mbedtls_x25519_fe b );
+/** h = a * b */
+void mbedtls_x25519_fe_mul( mbedtls_x25519_fe h, const mbedtls_x25519_fe a,
+                            const mbedtls_x25519_fe b );
+/** h = a^2 */
+void mbedtls_x25519_fe_sqr( mbedtls_x25519_fe h, const mbedtls_x25519_fe a );
+/** h = 1 / a (0 if a is 0) */
+void mbedtls_x25519_fe_inv( mbedtls_x25519_fe h, const mbedtls_x25519_fe a );
+/** h = a^(2^252 - 3) */
+void mbedtls_x25519_fe_pow22523( mbedtls_x25519_fe h,
+                                 const mbedtls_x25519_fe a );
+#endif /* MBEDTLS_ED25519_C */
+
+#endif /* ecp_x25519_fe.h */
@@ -0,0 +1,528 @@
+/*
+ *  Elliptic curves over GF(p): dedicated Curve448 arithmetic
+ *
+ *  Copyright (C) 2006-2017, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+
+/*
+ * References:
+ *
+ * RFC 7748 Elliptic Curves for Security, section 5 (the X448 ladder)
+ * M. Hamburg, Ed448-Goldilocks, a new elliptic curve, ePrint 2015/625
+ *     (radix 2^56 representation of the "golden" prime)
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ECP_C) && defined(MBEDTLS_ECP_X448_FAST) && \
+    defined(MBEDTLS_ECP_DP_CURVE448_ENABLED) && \
+    !defined(MBEDTLS_ECP_ALT)
+
+#include "mbedtls/ecp_x448.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if ( defined(__ARMCC_VERSION) || defined(_MSC_VER) ) && \
+    !defined(inline) && !defined(__cplusplus)
+#define inline __inline
+#endif
+
+/* Implementation that should never be optimized out by the compiler */
+static void mbedtls_zeroize( void *v, size_t n ) {
+    volatile unsigned char *p = v; while( n-- ) *p++ = 0;
+}
+
+#if defined(_MSC_VER) || defined(__WATCOMC__)
+  #define UL64(x) x##ui64
+#else
+  #define UL64(x) x##ULL
+#endif
+
+#define X448_MASK56     UL64(0x00FFFFFFFFFFFFFF)
+
+/*
+ * Field elements are eight 56-bit limbs, least significant first. With
+ * p = 2^448 - 2^224 - 1, limb 4 has weight 2^224 and 2^448 = 2^224 + 1,
+ * so reduction only needs additions. "Carried" values have limbs below
+ * 2^56 + 2^8; sums and differences of two of them stay below 2^58, which
+ * is what the multiplication accepts. Only x448_fe_reduce() produces the
+ * canonical value. Nothing below branches on, or indexes memory with,
+ * secret data.
+ */
+typedef uint64_t x448_fe[8];
+
+/*
+ * Accumulators for sums of 64 x 64-bit products. With inputs below 2^58
+ * every sum, folded high half included, stays under 2^121.
+ */
+#if defined(MBEDTLS_HAVE_INT64) && defined(MBEDTLS_HAVE_UDBL)
+typedef mbedtls_t_udbl x448_acc;
+
+static inline void x448_acc_zero( x448_acc *r )
+{
+    *r = 0;
+}
+
+static inline void x448_acc_mla( x448_acc *r, uint64_t a, uint64_t b )
+{
+    *r += (mbedtls_t_udbl) a * b;
+}
+
+static inline void x448_acc_add( x448_acc *r, const x448_acc *a )
+{
+    *r += *a;
+}
+
+/* r += a >> 56 */
+static inline void x448_acc_carry( x448_acc *r, const x448_acc *a )
+{
+    *r += *a >> 56;
+}
+
+static inline uint64_t x448_acc_lo( const x448_acc *r )
+{
+    return( (uint64_t) *r & X448_MASK56 );
+}
+
+/* r >> 56, which the caller knows to fit in 64 bits */
+static inline uint64_t x448_acc_hi( const x448_acc *r )
+{
+    return( (uint64_t)( *r >> 56 ) );
+}
+#else
+typedef struct
+{
+    uint64_t lo, hi;
+}
+x448_acc;
+
+static inline void x448_acc_zero( x448_acc *r )
+{
+    r->lo = 0;
+    r->hi = 0;
+}
+
+static inline void x448_acc_mla( x448_acc *r, uint64_t a, uint64_t b )
+{
+    uint64_t a0 = a & 0xFFFFFFFF, a1 = a >> 32;
+    uint64_t b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+    uint64_t t, u, v, lo, hi;
+
+    t = a0 * b0;
+    u = a1 * b0 + ( t >> 32 );
+    v = a0 * b1 + ( u & 0xFFFFFFFF );
+
+    lo = ( v << 32 ) | ( t & 0xFFFFFFFF );
+    hi = a1 * b1 + ( u >> 32 ) + ( v >> 32 );
+
+    r->lo += lo;
+    r->hi += hi + ( r->lo < lo );
+}
+
+static inline void x448_acc_add( x448_acc *r, const x448_acc *a )
+{
+    r->lo += a->lo;
+    r->hi += a->hi + ( r->lo < a->lo );
+}
+
+static inline void x448_acc_carry( x448_acc *r, const x448_acc *a )
+{
+    uint64_t lo = ( a->lo >> 56 ) | ( a->hi << 8 );
+
+    r->lo += lo;
+    r->hi += ( a->hi >> 56 ) + ( r->lo < lo );
+}
+
+static inline uint64_t x448_acc_lo( const x448_acc *r )
+{
+    return( r->lo & X448_MASK56 );
+}
+
+static inline uint64_t x448_acc_hi( const x448_acc *r )
+{
+    return( ( r->lo >> 56 ) | ( r->hi << 8 ) );
+}
+#endif /* MBEDTLS_HAVE_INT64 && MBEDTLS_HAVE_UDBL */
+
+/*
+ * h = r[0] + 2^56 r[1] + ... + 2^392 r[7] mod p, carried
+ */
+static void x448_carry( x448_fe h, x448_acc r[8] )
+{
+    uint64_t c;
+    size_t i;
+
+    for( i = 0; i < 7; i++ )
+    {
+        x448_acc_carry( &r[i + 1], &r[i] );
+        h[i] = x448_acc_lo( &r[i] );
+    }
+    c = x448_acc_hi( &r[7] );
+    h[7] = x448_acc_lo( &r[7] );
+
+    /* 2^448 = 2^224 + 1 mod p; c is below 3 * 2^62 so nothing overflows */
+    h[0] += c;
+    h[4] += c;
+    h[1] += h[0] >> 56; h[0] &= X448_MASK56;
+    h[5] += h[4] >> 56; h[4] &= X448_MASK56;
+}
+
+/*
+ * Fold the 15 coefficients of a product into 8 and carry them.
+ * Coefficient i >= 8 has weight 2^(56 i) = 2^(56 (i - 4)) + 2^(56 (i - 8)),
+ * going from the top so that what lands in 8..10 is folded again.
+ */
+static void x448_fold( x448_fe h, x448_acc c[15] )
+{
+    size_t i;
+
+    for( i = 14; i >= 8; i-- )
+    {
+        x448_acc_add( &c[i - 4], &c[i] );
+        x448_acc_add( &c[i - 8], &c[i] );
+    }
+
+    x448_carry( h, c );
+}
+
+/*
+ * r = a + b
+ */
+static void x448_add( x448_fe r, const x448_fe a, const x448_fe b )
+{
+    size_t i;
+
+    for( i = 0; i < 8; i++ )
+        r[i] = a[i] + b[i];
+}
+
+/*
+ * r = a - b + 2p, with a and b carried
+ */
+static void x448_sub( x448_fe r, const x448_fe a, const x448_fe b )
+{
+    size_t i;
+
+    for( i = 0; i < 8; i++ )
+        r[i] = a[i] + UL64(0x01FFFFFFFFFFFFFE) - b[i];
+
+    /* Limb 4 of p is 2^56 - 2 */
+    r[4] -= 2;
+}
+
+/*
+ * r = a * b, inputs below 2^58
+ */
+static void x448_mul( x448_fe h, const x448_fe a, const x448_fe b )
+{
+    x448_acc c[15];
+    size_t i, j;
+
+    for( i = 0; i < 15; i++ )
+        x448_acc_zero( &c[i] );
+
+    for( i = 0; i < 8; i++ )
+        for( j = 0; j < 8; j++ )
+            x448_acc_mla( &c[i + j], a[i], b[j] );
+
+    x448_fold( h, c );
+}
+
+/*
+ * r = a^2, input below 2^58
+ */
+static void x448_sqr( x448_fe h, const x448_fe a )
+{
+    x448_acc c[15];
+    size_t i, j;
+
+    for( i = 0; i < 15; i++ )
+        x448_acc_zero( &c[i] );
+
+    for( i = 0; i < 8; i++ )
+    {
+        x448_acc_mla( &c[2 * i], a[i], a[i] );
+        for( j = i + 1; j < 8; j++ )
+            x448_acc_mla( &c[i + j], 2 * a[i], a[j] );
+    }
+
+    x448_fold( h, c );
+}
+
+static void x448_sqr_n( x448_fe r, const x448_fe a, unsigned n )
+{
+    x448_sqr( r, a );
+    while( --n > 0 )
+        x448_sqr( r, r );
+}
+
+/*
+ * r = a^(p - 2) = 1 / a, or 0 if a = 0
+ * with p - 2 = 2^448 - 2^224 - 3: 223 ones, a zero, 222 ones, 0, 1
+ */
+static void x448_inv( x448_fe r, const x448_fe a )
+{
+    x448_fe x3, x6, x24, x222, t;
+
+    x448_sqr( t, a );
+    x448_mul( t, t, a );                                /* 2^2 - 1 */
+    x448_sqr( t, t );
+    x448_mul( x3, t, a );                               /* 2^3 - 1 */
+    x448_sqr_n( t, x3, 3 );
+    x448_mul( x6, t, x3 );                              /* 2^6 - 1 */
+    x448_sqr_n( t, x6, 6 );
+    x448_mul( t, t, x6 );                               /* 2^12 - 1 */
+    x448_sqr_n( x24, t, 12 );
+    x448_mul( x24, x24, t );                            /* 2^24 - 1 */
+    x448_sqr_n( t, x24, 24 );
+    x448_mul( t, t, x24 );                              /* 2^48 - 1 */
+    x448_sqr_n( x222, t, 48 );
+    x448_mul( t, x222, t );                             /* 2^96 - 1 */
+    x448_sqr_n( x222, t, 96 );
+    x448_mul( t, x222, t );                             /* 2^192 - 1 */
+    x448_sqr_n( t, t, 24 );
+    x448_mul( t, t, x24 );                              /* 2^216 - 1 */
+    x448_sqr_n( t, t, 6 );
+    x448_mul( x222, t, x6 );                            /* 2^222 - 1 */
+    x448_sqr( t, x222 );
+    x448_mul( t, t, a );                                /* 2^223 - 1 */
+    x448_sqr_n( t, t, 223 );
+    x448_mul( t, t, x222 );                     /* 2^446 - 2^222 - 1 */
+    x448_sqr_n( t, t, 2 );
+    x448_mul( r, t, a );                        /* 2^448 - 2^224 - 3 */
+}
+
+/*
+ * Fully reduce h modulo p, input carried
+ */
+static void x448_fe_reduce( x448_fe h )
+{
+    static const uint64_t p[8] = {
+        X448_MASK56, X448_MASK56, X448_MASK56, X448_MASK56,
+        X448_MASK56 - 1, X448_MASK56, X448_MASK56, X448_MASK56 };
+    uint64_t c, mask;
+    size_t i;
+
+    /* Bring all limbs below 2^56 but the first and fifth, h is now < 2p */
+    for( i = 0; i < 7; i++ )
+    {
+        h[i + 1] += h[i] >> 56;
+        h[i] &= X448_MASK56;
+    }
+    c = h[7] >> 56;
+    h[7] &= X448_MASK56;
+    h[0] += c;
+    h[4] += c;
+
+    /*
+     * h -= p, with a signed carry kept in two's complement: the final
+     * carry is 0 if h was >= p and all ones (-1) otherwise
+     */
+    c = 0;
+    for( i = 0; i < 8; i++ )
+    {
+        c += h[i] - p[i];
+        h[i] = c & X448_MASK56;
+        c = ( c >> 56 ) | ( ( (uint64_t) 0 - ( c >> 63 ) ) << 8 );
+    }
+
+    /* Add p back if the subtraction went below zero */
+    mask = c;
+    c = 0;
+    for( i = 0; i < 8; i++ )
+    {
+        c += h[i] + ( p[i] & mask );
+        h[i] = c & X448_MASK56;
+        c >>= 56;
+    }
+}
+
+/*
+ * Load a 448-bit little-endian value, reduced modulo p
+ */
+static void x448_fe_load( x448_fe h, const unsigned char s[56] )
+{
+    size_t i, j;
+
+    for( i = 0; i < 8; i++ )
+    {
+        h[i] = 0;
+        for( j = 0; j < 7; j++ )
+            h[i] |= (uint64_t) s[7 * i + j] << ( 8 * j );
+    }
+
+    x448_fe_reduce( h );
+}
+
+/*
+ * Store a fully reduced value as 56 little-endian bytes
+ */
+static void x448_fe_store( unsigned char s[56], const x448_fe h )
+{
+    size_t i, j;
+
+    for( i = 0; i < 8; i++ )
+        for( j = 0; j < 7; j++ )
+            s[7 * i + j] = (unsigned char)( h[i] >> ( 8 * j ) );
+}
+
+/*
+ * r = a * 39081 = a * (A - 2) / 4, input below 2^58
+ */
+static void x448_mul_a24( x448_fe h, const x448_fe a )
+{
+    x448_acc r[8];
+    size_t i;
+
+    for( i = 0; i < 8; i++ )
+    {
+        x448_acc_zero( &r[i] );
+        x448_acc_mla( &r[i], a[i], 39081 );
+    }
+
+    x448_carry( h, r );
+}
+
+/*
+ * Swap a and b if swap is 1, leave them alone if swap is 0
+ */
+static void x448_cswap( x448_fe a, x448_fe b, uint64_t swap )
+{
+    uint64_t mask = (uint64_t) 0 - swap, x;
+    size_t i;
+
+    for( i = 0; i < 8; i++ )
+    {
+        x = mask & ( a[i] ^ b[i] );
+        a[i] ^= x;
+        b[i] ^= x;
+    }
+}
+
+/*
+ * X448 Montgomery ladder (RFC 7748 section 5): out = X(k * u)
+ * k and u are 56-byte little-endian strings, k is used as is (the caller
+ * already checked that it is a valid private key).
+ */
+static void x448_ladder( unsigned char out[56], const unsigned char k[56],
+                         const unsigned char u[56] )
+{
+    x448_fe x1, x2, z2, x3, z3;
+    x448_fe A, AA, B, BB, E, C, D, DA, CB;
+    uint64_t swap = 0, bit;
+    int t;
+
+    x448_fe_load( x1, u );
+    memset( x2, 0, sizeof( x448_fe ) ); x2[0] = 1;
+    memset( z2, 0, sizeof( x448_fe ) );
+    memcpy( x3, x1, sizeof( x448_fe ) );
+    memset( z3, 0, sizeof( x448_fe ) ); z3[0] = 1;
+
+    for( t = 447; t >= 0; t-- )
+    {
+        bit = ( k[t >> 3] >> ( t & 7 ) ) & 1;
+        swap ^= bit;
+        x448_cswap( x2, x3, swap );
+        x448_cswap( z2, z3, swap );
+        swap = bit;
+
+        x448_add( A, x2, z2 );
+        x448_sqr( AA, A );
+        x448_sub( B, x2, z2 );
+        x448_sqr( BB, B );
+        x448_sub( E, AA, BB );
+        x448_add( C, x3, z3 );
+        x448_sub( D, x3, z3 );
+        x448_mul( DA, D, A );
+        x448_mul( CB, C, B );
+
+        x448_add( x3, DA, CB );
+        x448_sqr( x3, x3 );
+        x448_sub( z3, DA, CB );
+        x448_sqr( z3, z3 );
+        x448_mul( z3, z3, x1 );
+        x448_mul( x2, AA, BB );
+        x448_mul_a24( z2, E );
+        x448_add( z2, z2, AA );
+        x448_mul( z2, z2, E );
+    }
+
+    x448_cswap( x2, x3, swap );
+    x448_cswap( z2, z3, swap );
+
+    /* Zero for the point at infinity, since 0^(p - 2) = 0 */
+    x448_inv( z2, z2 );
+    x448_mul( x2, x2, z2 );
+    x448_fe_reduce( x2 );
+    x448_fe_store( out, x2 );
+
+    mbedtls_zeroize( x2, sizeof( x2 ) ); mbedtls_zeroize( z2, sizeof( z2 ) );
+    mbedtls_zeroize( x3, sizeof( x3 ) ); mbedtls_zeroize( z3, sizeof( z3 ) );
+    mbedtls_zeroize( A, sizeof( A ) );   mbedtls_zeroize( AA, sizeof( AA ) );
+    mbedtls_zeroize( B, sizeof( B ) );   mbedtls_zeroize( BB, sizeof( BB ) );
+    mbedtls_zeroize( E, sizeof( E ) );   mbedtls_zeroize( C, sizeof( C ) );
+    mbedtls_zeroize( D, sizeof( D ) );   mbedtls_zeroize( DA, sizeof( DA ) );
+    mbedtls_zeroize( CB, sizeof( CB ) );
+}
+
+/*
+ * R = m * P
+ */
+int mbedtls_ecp_x448_mul( mbedtls_ecp_point *R, const mbedtls_mpi *m,
+                          const mbedtls_ecp_point *P )
+{
+    int ret;
+    unsigned char k[56], u[56], out[56], acc = 0;
+    size_t i;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary_le( m, k, sizeof( k ) ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary_le( &P->X, u, sizeof( u ) ) );
+
+    x448_ladder( out, k, u );
+
+    /*
+     * With a valid private key the result is zero only when P has small
+     * order. The generic code fails to normalize the point at infinity in
+     * that case, so report the same error.
+     */
+    for( i = 0; i < 56; i++ )
+        acc |= out[i];
+
+    if( acc == 0 )
+    {
+        ret = MBEDTLS_ERR_MPI_NOT_ACCEPTABLE;
+        goto cleanup;
+    }
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary_le( &R->X, out, sizeof( out ) ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( &R->Z, 1 ) );
+    mbedtls_mpi_free( &R->Y );
+
+cleanup:
+    mbedtls_zeroize( k, sizeof( k ) );
+    mbedtls_zeroize( out, sizeof( out ) );
+
+    return( ret );
+}
+
+#endif /* MBEDTLS_ECP_C && MBEDTLS_ECP_X448_FAST && ... */
@@ -0,0 +1,1447 @@
+/*
+ *  Ed25519 signatures
+ *
+ *  Copyright (C) 2006-2017, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+
+/*
+ * References:
+ *
+ * RFC 8032: Edwards-Curve Digital Signature Algorithm (EdDSA)
+ * Bernstein, Duif, Lange, Schwabe, Yang: High-speed high-security
+ * signatures, https://ed25519.cr.yp.to/ed25519-20110926.pdf
+ *
+ * Points live on -x^2 + y^2 = 1 + d x^2 y^2 over GF(2^255 - 19), using the
+ * field arithmetic of ecp_x25519.c and the extended coordinates and
+ * formulas of the paper above (Hisil, Wong, Carter, Dawson).
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_ED25519_C)
+
+#include "mbedtls/ed25519.h"
+#include "ecp_x25519_fe.h"
+#include "mbedtls/bignum.h"
+#include "mbedtls/sha512.h"
+
+#include <string.h>
+
+#if defined(MBEDTLS_SELF_TEST)
+#if defined(MBEDTLS_PLATFORM_C)
+#include "mbedtls/platform.h"
+#else
+#include <stdio.h>
+#define mbedtls_printf printf
+#endif /* MBEDTLS_PLATFORM_C */
+#endif /* MBEDTLS_SELF_TEST */
+
+/* Implementation that should never be optimized out by the compiler */
+static void mbedtls_zeroize( void *v, size_t n ) {
+    volatile unsigned char *p = v; while( n-- ) *p++ = 0;
+}
+
+#if defined(_MSC_VER) || defined(__WATCOMC__)
+  #define UL64(x) x##ui64
+#else
+  #define UL64(x) x##ULL
+#endif
+
+#define fe_add      mbedtls_x25519_fe_add
+#define fe_sub      mbedtls_x25519_fe_sub
+#define fe_mul      mbedtls_x25519_fe_mul
+#define fe_sqr      mbedtls_x25519_fe_sqr
+
+typedef mbedtls_x25519_fe ed25519_fe;
+
+/*
+ * Point representations:
+ * p2:      (X:Y:Z), x = X/Z, y = Y/Z
+ * p3:      (X:Y:Z:T), additionally XY = ZT
+ * p1p1:    ((X:Z),(Y:T)), x = X/Z, y = Y/T, the output of additions
+ * precomp: (y+x, y-x, 2dxy), affine, for constant tables
+ * cached:  (Y+X, Y-X, Z, 2dT), for run-time tables
+ */
+typedef struct { ed25519_fe X, Y, Z; } ed25519_p2;
+typedef struct { ed25519_fe X, Y, Z, T; } ed25519_p3;
+typedef struct { ed25519_fe X, Y, Z, T; } ed25519_p1p1;
+typedef struct { ed25519_fe ypx, ymx, xy2d; } ed25519_precomp;
+typedef struct { ed25519_fe YpX, YmX, Z, T2d; } ed25519_cached;
+
+/* d = -121665 / 121666 */
+static const mbedtls_x25519_fe ed25519_d =
+    { UL64(0x00034DCA135978A3), UL64(0x0001A8283B156EBD), UL64(0x0005E7A26001C029),
+      UL64(0x000739C663A03CBB), UL64(0x00052036CEE2B6FF) };
+
+/* 2 * d */
+static const mbedtls_x25519_fe ed25519_d2 =
+    { UL64(0x00069B9426B2F159), UL64(0x00035050762ADD7A), UL64(0x0003CF44C0038052),
+      UL64(0x0006738CC7407977), UL64(0x0002406D9DC56DFF) };
+
+/* sqrt(-1) = 2^((p - 1) / 4) */
+static const mbedtls_x25519_fe ed25519_sqrtm1 =
+    { UL64(0x00061B274A0EA0B0), UL64(0x0000D5A5FC8F189D), UL64(0x0007EF5E9CBD0C60),
+      UL64(0x00078595A6804C9E), UL64(0x0002B8324804FC1D) };
+
+/*
+ * Fixed-base comb tables for ed25519_mul_base(), generated offline
+ */
+static const ed25519_precomp ed25519_comb[2][15] =
+{
+    {
+        {
+            { UL64(0x000493C6F58C3B85), UL64(0x0000DF7181C325F7), UL64(0x0000F50B0B3E4CB7),
+              UL64(0x0005329385A44C32), UL64(0x00007CF9D3A33D4B) },
+            { UL64(0x00003905D740913E), UL64(0x0000BA2817D673A2), UL64(0x00023E2827F4E67C),
+              UL64(0x000133D2E0C21A34), UL64(0x00044FD2F9298F81) },
+            { UL64(0x00011205877AAA68), UL64(0x000479955893D579), UL64(0x00050D66309B67A0),
+              UL64(0x0002D42D0DBEE5EE), UL64(0x0006F117B689F0C6) }
+        },
+        {
+            { UL64(0x000265E777D1F515), UL64(0x0000F1F54C1E39A5), UL64(0x0002F01B95522646),
+              UL64(0x0004FDD8DB9DDE6D), UL64(0x000654878CBA97CC) },
+            { UL64(0x00038EC78DF6B0FE), UL64(0x00013CAEBEA36A22), UL64(0x0005EBC6E54E5F6A),
+              UL64(0x00032804903D0EB8), UL64(0x0002102FDBA2B20D) },
+            { UL64(0x0006E405055CE6A1), UL64(0x0005024A35A532D3), UL64(0x0001F69054DAF29D),
+              UL64(0x00015D1D0D7A8BD5), UL64(0x0000AD725DB29ECB) }
+        },
+        {
+            { UL64(0x0005C585601E59E8), UL64(0x00056CC901CC000A), UL64(0x00011791321E4CD0),
+              UL64(0x0007959F0A55687F), UL64(0x00026EAD8E64813C) },
+            { UL64(0x0005B8B69C8462A4), UL64(0x0000ACFA639AF96E), UL64(0x00004D0BD8B761BF),
+              UL64(0x000797E68CB97644), UL64(0x0000975B5970FC12) },
+            { UL64(0x00072303DA5BA743), UL64(0x00002A5E374DCC79), UL64(0x0001CD9F6812FE76),
+              UL64(0x0002F5199BC86855), UL64(0x000534670479DF6C) }
+        },
+        {
+            { UL64(0x000304BFACAD8EA2), UL64(0x000502917D108B07), UL64(0x000043176CA6DD0F),
+              UL64(0x0005D5158F2C1D84), UL64(0x0002B5449E58EB3B) },
+            { UL64(0x00027562EB3DBE47), UL64(0x000291D7B4170BE7), UL64(0x0005D1CA67DFA8E1),
+              UL64(0x0002A88061F298A2), UL64(0x0001304E9E71627D) },
+            { UL64(0x000014D26ADC9CFE), UL64(0x0007F1691BA16F13), UL64(0x0005E71828F06EAC),
+              UL64(0x000349ED07F0FFFC), UL64(0x0004468DE2D7C2DD) }
+        },
+        {
+            { UL64(0x0000278DE3BC6748), UL64(0x00041A1641DEE423), UL64(0x0001EEC6639C7FF5),
+              UL64(0x0006A6FAA8DF28E3), UL64(0x00026A13664D0543) },
+            { UL64(0x00022D3B13A339EE), UL64(0x00020D9B12A5252A), UL64(0x0003D3C3C6154895),
+              UL64(0x0002176FF51D6A56), UL64(0x00049D76BBA79427) },
+            { UL64(0x000242338D56E61D), UL64(0x0000D86A2533429F), UL64(0x0006B6C6146474E5),
+              UL64(0x0006E1123EABB6D3), UL64(0x0004E1FAFE3A8FCE) }
+        },
+        {
+            { UL64(0x0007053D236A044C), UL64(0x00062771B0FC62BC), UL64(0x000486A0A0F376F2),
+              UL64(0x0005D228CCB06969), UL64(0x0004E559A0F0FC5B) },
+            { UL64(0x0000E8769C12701C), UL64(0x00014073876BFFC0), UL64(0x00000BAC6E577370),
+              UL64(0x00018660B4A2A586), UL64(0x000727021D35F875) },
+            { UL64(0x0001040727DF241E), UL64(0x0005565201A6D4AE), UL64(0x00029A6B7B7D17BE),
+              UL64(0x00000EFF376DAE30), UL64(0x00064FCB73007BBC) }
+        },
+        {
+            { UL64(0x000758CC6FD390CA), UL64(0x0006A2E3531F871D), UL64(0x00010B597FBDE195),
+              UL64(0x000377C4285BC7E2), UL64(0x0006F34C66D6FD08) },
+            { UL64(0x0003CBB43898DC04), UL64(0x00064860F6E4F27E), UL64(0x0000D260741E47FE),
+              UL64(0x0007B6EBDEC04B67), UL64(0x0000B598B8E8B849) },
+            { UL64(0x0007C18A0CC2F689), UL64(0x0000F6A539C54239), UL64(0x00002D6502044518),
+              UL64(0x000364054DE02360), UL64(0x000412128B0B1AC6) }
+        },
+        {
+            { UL64(0x0005CC9DC80C1AC0), UL64(0x000683671486D4CD), UL64(0x00076F5F1A5E8173),
+              UL64(0x0006D5D3F5F9DF4A), UL64(0x0007DA0B8F68D7E7) },
+            { UL64(0x00002014385675A6), UL64(0x0006155FB53D1DEF), UL64(0x00037EA32E89927C),
+              UL64(0x000059A668F5A82E), UL64(0x00046115ABA1D4DC) },
+            { UL64(0x00071953C3B5DA76), UL64(0x0006642233D37A81), UL64(0x0002C9658076B1BD),
+              UL64(0x0005A581E63010FF), UL64(0x0005A5F887E83674) }
+        },
+        {
+            { UL64(0x000560180CA2C1F4), UL64(0x0003798D1BE80151), UL64(0x0000BD3A66057AC3),
+              UL64(0x0002E06BF33D23DC), UL64(0x00045A02890607F1) },
+            { UL64(0x000366D1FD41F184), UL64(0x00022039FC23DFDE), UL64(0x0005429D362DA528),
+              UL64(0x0000DD259CF0AF00), UL64(0x0004013F03D6AD35) },
+            { UL64(0x000282DC6EE065CC), UL64(0x0007A4495CC8D7A0), UL64(0x0002F3A1D0DAE653),
+              UL64(0x000727A9A74D6C7F), UL64(0x000482255C1D9F06) }
+        },
+        {
+            { UL64(0x0003EACF71CEF800), UL64(0x000099515FD76780), UL64(0x0000A711DE40D9D5),
+              UL64(0x0002311C1FF51435), UL64(0x0004E8593B0BC655) },
+            { UL64(0x0006114AA3E5638C), UL64(0x000525389E41A25B), UL64(0x00062C4E8EE8A92A),
+              UL64(0x0004A22B58694EBD), UL64(0x0006BB91A497B9B7) },
+            { UL64(0x0001E646C5E7D206), UL64(0x0001B24C7888A549), UL64(0x0006AD4A7AC4FBE7),
+              UL64(0x0001CDA855B67476), UL64(0x00020CF7D79B0EBE) }
+        },
+        {
+            { UL64(0x00028F4E8AE75C48), UL64(0x00022880016C197A), UL64(0x0002F085C0F3780A),
+              UL64(0x0004431B9DDCE44C), UL64(0x0007C1188539F570) },
+            { UL64(0x0004939DF0FE7DCA), UL64(0x0001F9752A39CFB6), UL64(0x0005F87477D43AE4),
+              UL64(0x00034E84C5F30E1A), UL64(0x0000235623788994) },
+            { UL64(0x0006EFFAE15A4C03), UL64(0x0002878EF1C0A41E), UL64(0x000267799CBD1C2A),
+              UL64(0x000241BCFA8501FE), UL64(0x00038D20188D1061) }
+        },
+        {
+            { UL64(0x000011AD0E6315DF), UL64(0x0000BC55D652047D), UL64(0x00057561B02D9434),
+              UL64(0x0006F75BDD07ACD3), UL64(0x000043EEDD45E1F4) },
+            { UL64(0x000147F2C7073217), UL64(0x00033E75FA419ED8), UL64(0x000107E00B1946E4),
+              UL64(0x00039F12C7EDFEB8), UL64(0x000173C4FA94F450) },
+            { UL64(0x0001EA60928DF9C4), UL64(0x0000C66E6AC5A7AE), UL64(0x0002554AC96DF9E0),
+              UL64(0x0002396CD828A651), UL64(0x0001E2A7024993CC) }
+        },
+        {
+            { UL64(0x00020FBCD45C811F), UL64(0x0007B25D81006C03), UL64(0x00074901FC92DEF1),
+              UL64(0x000593506573158B), UL64(0x0005FCB43EE06225) },
+            { UL64(0x000509B93509FBA4), UL64(0x0006C0AC636EA620), UL64(0x000100721C3636CD),
+              UL64(0x0003B9CBEF665D29), UL64(0x000044649F411B2E) },
+            { UL64(0x000524AD9598215F), UL64(0x0004D986CC518181), UL64(0x00005B73A86DFE40),
+              UL64(0x0002C799C717AAB8), UL64(0x0000C8A1BFA5CC0E) }
+        },
+        {
+            { UL64(0x000703B5681D104C), UL64(0x0003224C7968B1BC), UL64(0x000395B18CF4BDE9),
+              UL64(0x0003655738860B8E), UL64(0x0006B857C7EFCC3E) },
+            { UL64(0x000256B48B2801C0), UL64(0x0005878801F88F3A), UL64(0x0004CEE905FA7EFA),
+              UL64(0x00056553A8D58EA3), UL64(0x00009DE2BF5DD418) },
+            { UL64(0x00010FF3EFF0687F), UL64(0x00069E3C6F74477E), UL64(0x0005980D357AEBA8),
+              UL64(0x000165724F30930E), UL64(0x0005B466E2AC3B24) }
+        },
+        {
+            { UL64(0x0006EB6747FBB842), UL64(0x0006AC102351626F), UL64(0x0007E32269E77D71),
+              UL64(0x0007E12D15D3B7B8), UL64(0x00009952A563BC8F) },
+            { UL64(0x0000CB4BDC7EF83C), UL64(0x00074BF27844D455), UL64(0x0001938E965AD71B),
+              UL64(0x000797EA75F58D83), UL64(0x000409B4ADCE5C6C) },
+            { UL64(0x00053DB9834350C4), UL64(0x0000B4BEA0B6889A), UL64(0x000527FCBE24A64C),
+              UL64(0x0006B27D917D512C), UL64(0x00069B968A704657) }
+        }
+    },
+    {
+        {
+            { UL64(0x0005B69F7B85C5E8), UL64(0x00017A2D175650EC), UL64(0x0004CC3E6DBFC19E),
+              UL64(0x00073E1D3873BE0E), UL64(0x0003A5F6D51B0AF8) },
+            { UL64(0x00068756A60DAC5F), UL64(0x00055D757B8AEC26), UL64(0x0003383DF45F80BD),
+              UL64(0x0006783F8C9F96A6), UL64(0x00020234A7789ECD) },
+            { UL64(0x00020DB67178B252), UL64(0x00073AA3DA2C0EDA), UL64(0x00079045C01C70D3),
+              UL64(0x0001B37B15251059), UL64(0x0007CD682353CFFE) }
+        },
+        {
+            { UL64(0x0000639C12DDB0A4), UL64(0x0006180490CD7AB3), UL64(0x0003F3918297467C),
+              UL64(0x00074568BE1781AC), UL64(0x00007A195152E095) },
+            { UL64(0x0007A9C59C2EC4DE), UL64(0x0007E9F09E79652D), UL64(0x0006A3E422F22D86),
+              UL64(0x0002AE8E3B836C8B), UL64(0x00063B795FC7AD32) },
+            { UL64(0x00068F02389E5FC8), UL64(0x000059F1BC877506), UL64(0x000504990E410CEC),
+              UL64(0x00009BD7D0FEAEE2), UL64(0x0003E8FE83D032F0) }
+        },
+        {
+            { UL64(0x0000EA4159DC4791), UL64(0x00057167540B1F95), UL64(0x0003A65BAC3EB8F6),
+              UL64(0x000637DF099CB7A7), UL64(0x000379D09BB51936) },
+            { UL64(0x00001A1BF614AFFB), UL64(0x0000C420725D56CC), UL64(0x0000D246620D8322),
+              UL64(0x0002162433999E2B), UL64(0x00003224A6FF049C) },
+            { UL64(0x00067A306FB88974), UL64(0x000049F1F7320BC4), UL64(0x000315EC36FAE13E),
+              UL64(0x0006F8B014DBDC8C), UL64(0x00060670BBEA2357) }
+        },
+        {
+            { UL64(0x0006BFFB305B2F51), UL64(0x0005B112B2D712DD), UL64(0x00035774974FE4E2),
+              UL64(0x00004AF87A96E3A3), UL64(0x00057968290BB3A0) },
+            { UL64(0x0007974E8C58AEDC), UL64(0x0007757E083488C6), UL64(0x000601C62AE7BC8B),
+              UL64(0x00045370C2ECAB74), UL64(0x0002F1B78FAB143A) },
+            { UL64(0x0002B8430A20E101), UL64(0x0001A49E1D88FEE3), UL64(0x00038BBB47CE4D96),
+              UL64(0x0001F0E7BA84D437), UL64(0x0007DC43E35DC2AA) }
+        },
+        {
+            { UL64(0x00045FDE06BAAFDA), UL64(0x00041F6B4882D780), UL64(0x0004BB92991DCE6B),
+              UL64(0x0005693E4231EC2E), UL64(0x0002203EAC504374) },
+            { UL64(0x000792FEA05C01E7), UL64(0x0003912BF6F981DF), UL64(0x00001383E1D7DC0E),
+              UL64(0x0001BD46B5410BCA), UL64(0x000573560A58A9A7) },
+            { UL64(0x00002D1959DD3897), UL64(0x0004EE1B06EA10CF), UL64(0x000380D30D8048D9),
+              UL64(0x0002C1CD92EC427E), UL64(0x0003E1460C501E23) }
+        },
+        {
+            { UL64(0x000004C975E3FB78), UL64(0x0004A536229C073A), UL64(0x0005B0C65062DBA1),
+              UL64(0x0002E79C75F12FE8), UL64(0x000607D23449E79F) },
+            { UL64(0x00040F2C2338841D), UL64(0x0006B0C63CBA39C4), UL64(0x00062954B7C3B335),
+              UL64(0x000119D2BF72F8F8), UL64(0x0007AB87BC81C9B3) },
+            { UL64(0x000771501B17760E), UL64(0x0000DC2B144DCFCF), UL64(0x00002B0756D98CAA),
+              UL64(0x0004889CF529CC5F), UL64(0x00068A56D9D503BA) }
+        },
+        {
+            { UL64(0x00005716C8A5BC9B), UL64(0x000488CBD3E87FFC), UL64(0x0002475CA419AA67),
+              UL64(0x00059DAF8FBE45A5), UL64(0x00024102BD91C435) },
+            { UL64(0x00038F9EF4CA0F68), UL64(0x0000DC15DE6B7E41), UL64(0x00054C7A6B7017CC),
+              UL64(0x000774DA33378216), UL64(0x000383FF5D31B535) },
+            { UL64(0x0004D7CB442B19AA), UL64(0x0003FCD6B309B09B), UL64(0x00069F7B0504636D),
+              UL64(0x0003A7A7F2EEA310), UL64(0x0001CC49092D86EF) }
+        },
+        {
+            { UL64(0x000600C9193B877F), UL64(0x00021C1B8A0D7765), UL64(0x000379927FB38EA2),
+              UL64(0x00070D7679DBE01B), UL64(0x0005F46040898DE9) },
+            { UL64(0x00058845832FCEDB), UL64(0x000135CD7F0C6E73), UL64(0x00053FFBDFE8E35B),
+              UL64(0x00022F195E06E55B), UL64(0x00073937E8814BCE) },
+            { UL64(0x00037116297BF48D), UL64(0x00045A9E0D069720), UL64(0x00025AF71AA744EC),
+              UL64(0x00041AF0CB8AABA3), UL64(0x0002CF8A4E891D5E) }
+        },
+        {
+            { UL64(0x0001A87740B81EDC), UL64(0x000438A14DC6F626), UL64(0x00061B7D0094A733),
+              UL64(0x00040A7C38BC621E), UL64(0x0003AA294B972690) },
+            { UL64(0x00046C23083AC1C0), UL64(0x00022387B685E62E), UL64(0x00022A7E00F6B1ED),
+              UL64(0x0006056A78958B11), UL64(0x00040730AB9B1806) },
+            { UL64(0x000402F20552A87D), UL64(0x0006A8C6A40102A4), UL64(0x00069D61CF9A7CB1),
+              UL64(0x0003D584EA8D289E), UL64(0x0004E71CD0842867) }
+        },
+        {
+            { UL64(0x0002BC56D78789AC), UL64(0x000209869506E109), UL64(0x00038CB5ED5966A5),
+              UL64(0x0002A97E5E14E664), UL64(0x000490BAD9213A35) },
+            { UL64(0x00079942E038D4E9), UL64(0x00058D9B2D54B367), UL64(0x0002C7607FB69957),
+              UL64(0x0004A55954A441F8), UL64(0x00038639CCF3A65A) },
+            { UL64(0x00007C80A7817C8B), UL64(0x000179A63803255F), UL64(0x0006F89D2CCA40C2),
+              UL64(0x000444E1C4E7D753), UL64(0x0006A125AEB10BFE) }
+        },
+        {
+            { UL64(0x000641423BA3C672), UL64(0x00069D26D12ADEAD), UL64(0x000696DECD5CF8E5),
+              UL64(0x00054BEB516FC773), UL64(0x0003147F8664A134) },
+            { UL64(0x0004D0528C5FB918), UL64(0x00052C8BD79012C3), UL64(0x000479804E04829E),
+              UL64(0x0005266A24229507), UL64(0x00005D53ACA06AA1) },
+            { UL64(0x00034026DAED85E1), UL64(0x0002D65A963C18D8), UL64(0x00042E1F2CF3EC2F),
+              UL64(0x000509878920B61B), UL64(0x0000224A2EBAA945) }
+        },
+        {
+            { UL64(0x00002749F3FDDFE3), UL64(0x0002EF37D58A4EE2), UL64(0x0002E9531C24EC4C),
+              UL64(0x00007C960D2E60DD), UL64(0x0007CC2EFFD82ED2) },
+            { UL64(0x000630FE627C7B1C), UL64(0x0001B1B05F85FFCB), UL64(0x00006FCE51F5B78C),
+              UL64(0x000077B5BCC0D88E), UL64(0x0006EF7953795569) },
+            { UL64(0x0003D4C938AC1D9D), UL64(0x00057A874919062F), UL64(0x0006E91F1C482C8A),
+              UL64(0x000716E9B9B48D12), UL64(0x000444F44EBDDE79) }
+        },
+        {
+            { UL64(0x000150EA2BF4376A), UL64(0x0006CB70DB694DFF), UL64(0x0003B8FAC65C34C3),
+              UL64(0x0001267E827884E9), UL64(0x00023654DEDB4B89) },
+            { UL64(0x0004631DAA496A92), UL64(0x00054AC1EB71D764), UL64(0x00034B491E693732),
+              UL64(0x0006354B2630ADFD), UL64(0x0000CF07C2D65681) },
+            { UL64(0x00066C89D9512BC6), UL64(0x0006B8F3255C0D63), UL64(0x000188185BFCC1CC),
+              UL64(0x0006180F20DA1CBC), UL64(0x0005F5527F073477) }
+        },
+        {
+            { UL64(0x000193936BD68F25), UL64(0x00067F8D2554F470), UL64(0x0000B154AE486991),
+              UL64(0x0004B6FDD55AB808), UL64(0x00022260E700DA1E) },
+            { UL64(0x000561E7DBC441A8), UL64(0x00036600941E3A5B), UL64(0x000414133BD6844F),
+              UL64(0x0004D024F82F227B), UL64(0x0002A59CD573B07B) },
+            { UL64(0x00005536E116AB23), UL64(0x00051C7FDD040FAF), UL64(0x0000BDD738B4BFE8),
+              UL64(0x0007A1FC6C7FFC63), UL64(0x0007626171B15C34) }
+        },
+        {
+            { UL64(0x00033E1C2C8CDC4A), UL64(0x000367252571E5D3), UL64(0x000516D123CC06F7),
+              UL64(0x0006FFC84031EDB7), UL64(0x00003D2A9B125C80) },
+            { UL64(0x0002DB0A72684FB0), UL64(0x0005A3189ED047D9), UL64(0x0006EEEBBDB77EE7),
+              UL64(0x0002B154A123F236), UL64(0x0002C63DF06ADB3D) },
+            { UL64(0x00008E43BA8DD8FC), UL64(0x00004BD69C42FFAF), UL64(0x00015A1544C3EB87),
+              UL64(0x0001B25EB0600F00), UL64(0x000066F5248F35C4) }
+        }
+    }
+};
+
+/*
+ * B, 3B, 5B, ..., 63B for verification, generated offline
+ */
+static const ed25519_precomp ed25519_base_odd[32] =
+{
+    {
+        { UL64(0x000493C6F58C3B85), UL64(0x0000DF7181C325F7), UL64(0x0000F50B0B3E4CB7),
+          UL64(0x0005329385A44C32), UL64(0x00007CF9D3A33D4B) },
+        { UL64(0x00003905D740913E), UL64(0x0000BA2817D673A2), UL64(0x00023E2827F4E67C),
+          UL64(0x000133D2E0C21A34), UL64(0x00044FD2F9298F81) },
+        { UL64(0x00011205877AAA68), UL64(0x000479955893D579), UL64(0x00050D66309B67A0),
+          UL64(0x0002D42D0DBEE5EE), UL64(0x0006F117B689F0C6) }
+    },
+    {
+        { UL64(0x0005B0A84CEE9730), UL64(0x00061D10C97155E4), UL64(0x0004059CC8096A10),
+          UL64(0x00047A608DA8014F), UL64(0x0007A164E1B9A80F) },
+        { UL64(0x00011FE8A4FCD265), UL64(0x0007BCB8374FAACC), UL64(0x00052F5AF4EF4D4F),
+          UL64(0x0005314098F98D10), UL64(0x0002AB91587555BD) },
+        { UL64(0x0006933F0DD0D889), UL64(0x00044386BB4C4295), UL64(0x0003CB6D3162508C),
+          UL64(0x00026368B872A2C6), UL64(0x0005A2826AF12B9B) }
+    },
+    {
+        { UL64(0x0002BC4408A5BB33), UL64(0x000078EBDDA05442), UL64(0x0002FFB112354123),
+          UL64(0x000375EE8DF5862D), UL64(0x0002945CCF146E20) },
+        { UL64(0x000182C3A447D6BA), UL64(0x00022964E536EFF2), UL64(0x000192821F540053),
+          UL64(0x0002F9F19E788E5C), UL64(0x000154A7E73EB1B5) },
+        { UL64(0x0003DBF1812A8285), UL64(0x0000FA17BA3F9797), UL64(0x0006F69CB49C3820),
+          UL64(0x00034D5A0DB3858D), UL64(0x00043AABE696B3BB) }
+    },
+    {
+        { UL64(0x00025CD0944EA3BF), UL64(0x00075673B81A4D63), UL64(0x000150B925D1C0D4),
+          UL64(0x00013F38D9294114), UL64(0x000461BEA69283C9) },
+        { UL64(0x00072C9AAA3221B1), UL64(0x000267774474F74D), UL64(0x000064B0E9B28085),
+          UL64(0x0003F04EF53B27C9), UL64(0x0001D6EDD5D2E531) },
+        { UL64(0x00036DC801B8B3A2), UL64(0x0000E0A7D4935E30), UL64(0x0001DEB7CECC0D7D),
+          UL64(0x000053A94E20DD2C), UL64(0x0007A9FBB1C6A0F9) }
+    },
+    {
+        { UL64(0x0006678AA6A8632F), UL64(0x0005EA3788D8B365), UL64(0x00021BD6D6994279),
+          UL64(0x0007ACE75919E4E3), UL64(0x00034B9ED338ADD7) },
+        { UL64(0x0006217E039D8064), UL64(0x0006DEA408337E6D), UL64(0x00057AC112628206),
+          UL64(0x000647CB65E30473), UL64(0x00049C05A51FADC9) },
+        { UL64(0x0004E8BF9045AF1B), UL64(0x000514E33A45E0D6), UL64(0x0007533C5B8BFE0F),
+          UL64(0x000583557B7E14C9), UL64(0x00073C172021B008) }
+    },
+    {
+        { UL64(0x000700848A802ADE), UL64(0x0001E04605C4E5F7), UL64(0x0005C0D01B9767FB),
+          UL64(0x0007D7889F42388B), UL64(0x0004275AAE2546D8) },
+        { UL64(0x00075B0249864348), UL64(0x00052EE11070262B), UL64(0x000237AE54FB5ACD),
+          UL64(0x0003BFD1D03AAAB5), UL64(0x00018AB598029D5C) },
+        { UL64(0x00032CC5FD6089E9), UL64(0x000426505C949B05), UL64(0x00046A18880C7AD2),
+          UL64(0x0004A4221888CCDA), UL64(0x0003DC65522B53DF) }
+    },
+    {
+        { UL64(0x0000C222A2007F6D), UL64(0x000356B79BDB77EE), UL64(0x00041EE81EFE12CE),
+          UL64(0x000120A9BD07097D), UL64(0x000234FD7EEC346F) },
+        { UL64(0x0007013B327FBF93), UL64(0x0001336EEDED6A0D), UL64(0x0002B565A2BBF3AF),
+          UL64(0x000253CE89591955), UL64(0x0000267882D17602) },
+        { UL64(0x0000A119732EA378), UL64(0x00063BF1BA8E2A6C), UL64(0x00069F94CC90DF9A),
+          UL64(0x000431D1779BFC48), UL64(0x000497BA6FDAA097) }
+    },
+    {
+        { UL64(0x0006CC0313CFEAA0), UL64(0x0001A313848DA499), UL64(0x0007CB534219230A),
+          UL64(0x00039596DEDEFD60), UL64(0x00061E22917F12DE) },
+        { UL64(0x0003CD86468CCF0B), UL64(0x00048553221AC081), UL64(0x0006C9464B4E0A6E),
+          UL64(0x00075FBA84180403), UL64(0x00043B5CD4218D05) },
+        { UL64(0x0002762F9BD0B516), UL64(0x0001C6E7FBDDCBB3), UL64(0x00075909C3ACE2BD),
+          UL64(0x00042101972D3EC9), UL64(0x000511D61210AE4D) }
+    },
+    {
+        { UL64(0x000676EF950E9D81), UL64(0x0001B81AE089F258), UL64(0x00063C4922951883),
+          UL64(0x0002F1D54D9B3237), UL64(0x0006D325924DDB85) },
+        { UL64(0x000386484420DE87), UL64(0x0002D6B25DB68102), UL64(0x000650B4962873C0),
+          UL64(0x0004081CFD271394), UL64(0x00071A7FE6FE2482) },
+        { UL64(0x000182B8A5C8C854), UL64(0x00073FCBE5406D8E), UL64(0x0005DE3430CFF451),
+          UL64(0x000554B967AC8C41), UL64(0x0004746C4B6559EE) }
+    },
+    {
+        { UL64(0x00077B3C6DC69A2B), UL64(0x0004EDF13EC2FA6E), UL64(0x0004E85AD77BEAC8),
+          UL64(0x0007DBA2B28E7BDA), UL64(0x0005C9A51DE34FE9) },
+        { UL64(0x000546C864741147), UL64(0x0003A1DF99092690), UL64(0x0001CA8CC9F4D6BB),
+          UL64(0x00036B7FC9CD3B03), UL64(0x000219663497DB5E) },
+        { UL64(0x0000F1CF79F10E67), UL64(0x00043CCB0A2B7EA2), UL64(0x00005089DFFF776A),
+          UL64(0x0001DD84E1D38B88), UL64(0x0004804503C60822) }
+    },
+    {
+        { UL64(0x00049ED02CA37FC7), UL64(0x000474C2B5957884), UL64(0x0005B8388E816683),
+          UL64(0x0004B6C454B76BE4), UL64(0x000553398A516506) },
+        { UL64(0x000021D23A36D175), UL64(0x0004FD3373C6476D), UL64(0x00020E291EEED02A),
+          UL64(0x00062F2ECF2E7210), UL64(0x000771E098858DE4) },
+        { UL64(0x0002F5D278451EDF), UL64(0x000730B133997342), UL64(0x0006965420EB6975),
+          UL64(0x000308A3BFA516CF), UL64(0x0005A5ED1D68FF5A) }
+    },
+    {
+        { UL64(0x0005122AFE150E83), UL64(0x0004AFC966BB0232), UL64(0x0001C478833C8268),
+          UL64(0x00017839C3FC148F), UL64(0x00044ACB897D8BF9) },
+        { UL64(0x0005E0C558527359), UL64(0x0003395B73AFD75C), UL64(0x000072AFA4E4B970),
+          UL64(0x00062214329E0F6D), UL64(0x000019B60135FEFD) },
+        { UL64(0x000068145E134B83), UL64(0x0001E4860982C3CC), UL64(0x000068FB5F13D799),
+          UL64(0x0007C9283744547E), UL64(0x000150C49FDE6AD2) }
+    },
+    {
+        { UL64(0x0003F29509471138), UL64(0x000729EEB4CA31CF), UL64(0x00069C22B575BFBC),
+          UL64(0x0004910857BCE212), UL64(0x0006B2B5A075BB99) },
+        { UL64(0x0001863C9CDCA868), UL64(0x0003770E295A1709), UL64(0x0000D85A3720FD13),
+          UL64(0x0005E0FF1F71AB06), UL64(0x00078A6D7791E05F) },
+        { UL64(0x0007704B47A0B976), UL64(0x0002AE82E91AAB17), UL64(0x00050BD6429806CD),
+          UL64(0x00068055158FD8EA), UL64(0x000725C7FFC4AD55) }
+    },
+    {
+        { UL64(0x00026715D1CF99B2), UL64(0x0002205441A69C88), UL64(0x000448427DCD4B54),
+          UL64(0x0001D191E88ABDC5), UL64(0x000794CC9277CB1F) },
+        { UL64(0x00002BF71CD098C0), UL64(0x00049DABCC6CD230), UL64(0x00040A6533F905B2),
+          UL64(0x000573EFAC2EB8A4), UL64(0x0004CD54625F855F) },
+        { UL64(0x0006C426C2AC5053), UL64(0x0005A65ECE4B095E), UL64(0x0000C44086F26BB6),
+          UL64(0x0007429568197885), UL64(0x0007008357B6FCC8) }
+    },
+    {
+        { UL64(0x0000672738773F01), UL64(0x000752BF799F6171), UL64(0x0006B4A6DAE33323),
+          UL64(0x0007B54696EAD1DC), UL64(0x00006EF7E9851AD0) },
+        { UL64(0x00039FBB82584A34), UL64(0x00047A568F257A03), UL64(0x00014D88091EAD91),
+          UL64(0x0002145B18B1CE24), UL64(0x00013A92A3669D6D) },
+        { UL64(0x0003771CC0577DE5), UL64(0x0003CA06BB8B9952), UL64(0x00000B81C5D50390),
+          UL64(0x00043512340780EC), UL64(0x0003C296DDF8A2AF) }
+    },
+    {
+        { UL64(0x000515F9D914A713), UL64(0x00073191FF2255D5), UL64(0x00054F5CC2A4BDEF),
+          UL64(0x0003DD57FC118BCF), UL64(0x0007A99D393490C7) },
+        { UL64(0x00034D2EBB1F2541), UL64(0x0000E815B723FF9D), UL64(0x000286B416E25443),
+          UL64(0x0000BDFE38D1BEE8), UL64(0x0000A892C7007477) },
+        { UL64(0x0002ED2436BDA3E8), UL64(0x00002AFD00F291EA), UL64(0x0000BE7381DEA321),
+          UL64(0x0003E952D4B2B193), UL64(0x000286762D28302F) }
+    },
+    {
+        { UL64(0x000036093CE35B25), UL64(0x0003B64D7552E9CF), UL64(0x00071EE0FE0B8460),
+          UL64(0x00069D0660C969E5), UL64(0x00032F1DA046A9D9) },
+        { UL64(0x00058E2BCE2EF5BD), UL64(0x00068CE8F78C6F8A), UL64(0x0006EE26E39261B2),
+          UL64(0x00033D0AA50BCF9D), UL64(0x0007686F2A3D6F17) },
+        { UL64(0x000512A66D597C6A), UL64(0x0000609A70A57551), UL64(0x000026C08A3C464C),
+          UL64(0x0004531FC8EE39E1), UL64(0x000561305F8A9AD2) }
+    },
+    {
+        { UL64(0x0004978DEC92AED1), UL64(0x000069ADAE7CA201), UL64(0x00011EE923290F55),
+          UL64(0x00069641898D916C), UL64(0x00000AAEC53E35D4) },
+        { UL64(0x0002CC28E7B0C0D5), UL64(0x00077B60EB8A6CE4), UL64(0x0004042985C277A6),
+          UL64(0x000636657B46D3EB), UL64(0x000030A1AEF2C57C) },
+        { UL64(0x0001F773003AD2AA), UL64(0x000005642CC10F76), UL64(0x00003B48F82CFCA6),
+          UL64(0x0002403C10EE4329), UL64(0x00020BE9C1C24065) }
+    },
+    {
+        { UL64(0x000387D8249673A6), UL64(0x0005BEA8DC927C2A), UL64(0x0005BD8ED5650EF0),
+          UL64(0x0000EF0E3FCD40E1), UL64(0x000750AB3361F0AC) },
+        { UL64(0x0000E44AE2025E60), UL64(0x0005F97B9727041C), UL64(0x0005683472C0ECEC),
+          UL64(0x000188882EB1CE7C), UL64(0x00069764C545067E) },
+        { UL64(0x00023283A2F81037), UL64(0x000477AFF97E23D1), UL64(0x0000B8958DBCBB68),
+          UL64(0x0000205B97E8ADD6), UL64(0x00054F96B3FB7075) }
+    },
+    {
+        { UL64(0x0005F20429669279), UL64(0x00008FAFAE4941F5), UL64(0x00015D83C4EB7688),
+          UL64(0x0001CF379ECA4146), UL64(0x0003D7FE9C52BB75) },
+        { UL64(0x0005AFC616B11ECD), UL64(0x00039F4AEC8F22EF), UL64(0x0003B39E1625D92E),
+          UL64(0x0005F85BD4508873), UL64(0x00078E6839FBE85D) },
+        { UL64(0x00032DF737B8856B), UL64(0x0000608342F14E06), UL64(0x0003967889D74175),
+          UL64(0x0001211907FBA550), UL64(0x00070F268F350088) }
+    },
+    {
+        { UL64(0x00064583B1805F47), UL64(0x00022C1BAF832CD0), UL64(0x000132C01BD4D717),
+          UL64(0x0004ECF4C3A75B8F), UL64(0x0007C0D345CFAD88) },
+        { UL64(0x0004112070DCF355), UL64(0x0007DCFF9C22E464), UL64(0x00054ADA60E03325),
+          UL64(0x00025CD98EEF769A), UL64(0x000404E56C039B8C) },
+        { UL64(0x00071F4B8C78338A), UL64(0x00062CFC16BC2B23), UL64(0x00017CF51280D9AA),
+          UL64(0x0003BBAE5E20A95A), UL64(0x00020D754762AAEC) }
+    },
+    {
+        { UL64(0x0007C36FC73BB758), UL64(0x0004A6C797734BD1), UL64(0x0000EF248AB3950E),
+          UL64(0x00063154C9A53EC8), UL64(0x0002B8F1E46F3CEE) },
+        { UL64(0x0004FEB135B9F543), UL64(0x00063BD192AD93AE), UL64(0x00044E2EA612CDF7),
+          UL64(0x000670F4991583AB), UL64(0x00038B8ADA8790B4) },
+        { UL64(0x00004A9CDF51F95D), UL64(0x0005D963FBD596B8), UL64(0x00022D9B68ACE54A),
+          UL64(0x0004A98E8836C599), UL64(0x000049AEB32CEBA1) }
+    },
+    {
+        { UL64(0x00007D0B75FC7931), UL64(0x00016F4CE4BA754A), UL64(0x0005ACE4C03FBE49),
+          UL64(0x00027E0EC12A159C), UL64(0x000795EE17530F67) },
+        { UL64(0x00067D3C63DCFE7E), UL64(0x000112F0ADC81AEE), UL64(0x00053DF04C827165),
+          UL64(0x0002FE5B33B430F0), UL64(0x00051C665E0C8D62) },
+        { UL64(0x00025B0A52ECBD81), UL64(0x0005DC0695FCE4A9), UL64(0x0003B928C575047D),
+          UL64(0x00023BF3512686E5), UL64(0x0006CD19BF49DC54) }
+    },
+    {
+        { UL64(0x0006612165AFC386), UL64(0x0001171AA36203FF), UL64(0x0002642EA820A8AA),
+          UL64(0x0001F3BB7B313F10), UL64(0x0005E01B3A7429E4) },
+        { UL64(0x0007619052179CA3), UL64(0x0000C16593F0AFD0), UL64(0x000265C4795C7428),
+          UL64(0x00031C40515D5442), UL64(0x0007520F3DB40B2E) },
+        { UL64(0x00050BE3D39357A1), UL64(0x0003AB33D294A7B6), UL64(0x0004C479BA59EDB3),
+          UL64(0x0004C30D184D326F), UL64(0x00071092C9CCEF3C) }
+    },
+    {
+        { UL64(0x0003D8AC74051DCF), UL64(0x00010AB6F543D0AD), UL64(0x0005D0F3AC0FDA90),
+          UL64(0x0005EF1D2573E5E4), UL64(0x0004173A5BB7137A) },
+        { UL64(0x0000523F0364918C), UL64(0x000687F56D638A7B), UL64(0x00020796928AD013),
+          UL64(0x0005D38405A54F33), UL64(0x0000EA15B03D0257) },
+        { UL64(0x00056E31F0F9218A), UL64(0x0005635F88E102F8), UL64(0x0002CBC5D969A5B8),
+          UL64(0x000533FBC98B347A), UL64(0x0005FC565614A4E3) }
+    },
+    {
+        { UL64(0x0002E1E67790988E), UL64(0x0001E38B9AE44912), UL64(0x000648FBB4075654),
+          UL64(0x00028DF1D840CD72), UL64(0x0003214C7409D466) },
+        { UL64(0x0006570DC46D7AE5), UL64(0x00018A9F1B91E26D), UL64(0x000436B6183F42AB),
+          UL64(0x000550ACAA4F8198), UL64(0x00062711C414C454) },
+        { UL64(0x0001827406651770), UL64(0x0004D144F286C265), UL64(0x00017488F0EE9281),
+          UL64(0x00019E6CDB5C760C), UL64(0x0005BEA94073ECB8) }
+    },
+    {
+        { UL64(0x0000CE63F343D2F8), UL64(0x0001E0A87D1E368E), UL64(0x000045EDBC019EEA),
+          UL64(0x0006979AED28D0D1), UL64(0x0004AD0785944F1B) },
+        { UL64(0x0005BF0912C89BE4), UL64(0x00062FADCAF38C83), UL64(0x00025EC196B3CE2C),
+          UL64(0x00077655FF4F017B), UL64(0x0003AACD5C148F61) },
+        { UL64(0x00063B34C3318301), UL64(0x0000E0E62D04D0B1), UL64(0x000676A233726701),
+          UL64(0x00029E9A042D9769), UL64(0x0003AFF0CB1D9028) }
+    },
+    {
+        { UL64(0x0006430BF4C53505), UL64(0x000264C3E4507244), UL64(0x00074C9F19A39270),
+          UL64(0x00073F84F799BC47), UL64(0x0002CCF9F732BD99) },
+        { UL64(0x0005C7EB3A20405E), UL64(0x0005FDB5AAD930F8), UL64(0x0004A757E63B8C47),
+          UL64(0x00028E9492972456), UL64(0x000110E7E86F4CD2) },
+        { UL64(0x0000D89ED603F5E4), UL64(0x00051E1604018AF8), UL64(0x0000B8EEDC4A2218),
+          UL64(0x00051BA98B9384D0), UL64(0x00005C557E0B9693) }
+    },
+    {
+        { UL64(0x0006BBB089C20EB0), UL64(0x0006DF41FB0B9EEE), UL64(0x00051087ED87E16F),
+          UL64(0x000102DB5C9FA731), UL64(0x000289FEF0841861) },
+        { UL64(0x0001CE311FC97E6F), UL64(0x0006023F3FB5DB1F), UL64(0x0007B49775E8FC98),
+          UL64(0x0003AD70ADBF5045), UL64(0x0006E154C178FE98) },
+        { UL64(0x00016336FED69ABF), UL64(0x0004F066B929F9EC), UL64(0x0004E9FF9E6C5B93),
+          UL64(0x00018C89BC4BB2BA), UL64(0x0006AFBF642A95CA) }
+    },
+    {
+        { UL64(0x00055070F913A8CC), UL64(0x000765619EAC2BBC), UL64(0x0003AB5225F47459),
+          UL64(0x00076CED14AB5B48), UL64(0x00012C093CEDB801) },
+        { UL64(0x0000DE0C62F5D2C1), UL64(0x00049601CF734FB5), UL64(0x0006B5C38263F0F6),
+          UL64(0x0004623EF5B56D06), UL64(0x0000DB4B851B9503) },
+        { UL64(0x00047F9308B8190F), UL64(0x000414235C621F82), UL64(0x00031F5FF41A5A76),
+          UL64(0x0006736773AAB96D), UL64(0x00033AA8799C6635) }
+    },
+    {
+        { UL64(0x0000F588FC156CB1), UL64(0x000363414DA4F069), UL64(0x0007296AD9B68AEA),
+          UL64(0x0004D3711316AE43), UL64(0x000212CD0C1C8D58) },
+        { UL64(0x0007F51EBD085CF2), UL64(0x00012CFA67E3F5E1), UL64(0x0001800CF1E3D46A),
+          UL64(0x00054337615FF0A8), UL64(0x000233C6F29E8E21) },
+        { UL64(0x0004D5107F18C781), UL64(0x00064A4FD3A51A5E), UL64(0x0004F4CD0448BB37),
+          UL64(0x000671D38543151E), UL64(0x0001DB7778911914) }
+    },
+    {
+        { UL64(0x00014769DD701AB6), UL64(0x00028339F1B4B667), UL64(0x0004AB214B8AE37B),
+          UL64(0x00025F0AEFA0B0FE), UL64(0x0007AE2CA8A017D2) },
+        { UL64(0x000352397C6BC26F), UL64(0x00018A7AA0227BBE), UL64(0x0005E68CC1EA5F8B),
+          UL64(0x0006FE3E3A7A1D5F), UL64(0x00031AD97AD26E2A) },
+        { UL64(0x000017ED0920B962), UL64(0x000187E33B53B6FD), UL64(0x00055829907A1463),
+          UL64(0x000641F248E0A792), UL64(0x0001ED1FC53A6622) }
+    }
+};
+
+/*
+ * Group order L = 2^252 + 27742317777372353535851937790883648493,
+ * big-endian
+ */
+static const unsigned char ed25519_order[32] = {
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0xDE, 0xF9, 0xDE, 0xA2, 0xF7, 0x9C, 0xD6,
+    0x58, 0x12, 0x63, 0x1A, 0x5C, 0xF5, 0xD3, 0xED,
+};
+
+/*
+ * Field helpers
+ */
+static void fe_0( ed25519_fe h )
+{
+    memset( h, 0, sizeof( ed25519_fe ) );
+}
+
+static void fe_1( ed25519_fe h )
+{
+    memset( h, 0, sizeof( ed25519_fe ) );
+    h[0] = 1;
+}
+
+static void fe_copy( ed25519_fe h, const ed25519_fe f )
+{
+    memcpy( h, f, sizeof( ed25519_fe ) );
+}
+
+static void fe_neg( ed25519_fe h, const ed25519_fe f )
+{
+    ed25519_fe zero;
+
+    fe_0( zero );
+    fe_sub( h, zero, f );
+}
+
+/* h = f if b == 1, unchanged if b == 0, in constant time */
+static void fe_cmov( ed25519_fe h, const ed25519_fe f, uint64_t b )
+{
+    uint64_t mask = (uint64_t) 0 - b;
+    size_t i;
+
+    for( i = 0; i < 5; i++ )
+        h[i] ^= mask & ( h[i] ^ f[i] );
+}
+
+static int fe_isnegative( const ed25519_fe f )
+{
+    unsigned char s[32];
+
+    mbedtls_x25519_fe_tobytes( s, f );
+
+    return( s[0] & 1 );
+}
+
+static int fe_iszero( const ed25519_fe f )
+{
+    unsigned char s[32], acc = 0;
+    size_t i;
+
+    mbedtls_x25519_fe_tobytes( s, f );
+    for( i = 0; i < 32; i++ )
+        acc |= s[i];
+
+    return( acc == 0 );
+}
+
+/*
+ * Point conversions
+ */
+static void ed25519_p1p1_to_p2( ed25519_p2 *r, const ed25519_p1p1 *p )
+{
+    fe_mul( r->X, p->X, p->T );
+    fe_mul( r->Y, p->Y, p->Z );
+    fe_mul( r->Z, p->Z, p->T );
+}
+
+static void ed25519_p1p1_to_p3( ed25519_p3 *r, const ed25519_p1p1 *p )
+{
+    fe_mul( r->X, p->X, p->T );
+    fe_mul( r->Y, p->Y, p->Z );
+    fe_mul( r->Z, p->Z, p->T );
+    fe_mul( r->T, p->X, p->Y );
+}
+
+static void ed25519_p3_to_cached( ed25519_cached *r, const ed25519_p3 *p )
+{
+    fe_add( r->YpX, p->Y, p->X );
+    fe_sub( r->YmX, p->Y, p->X );
+    fe_copy( r->Z, p->Z );
+    fe_mul( r->T2d, p->T, ed25519_d2 );
+}
+
+static void ed25519_p3_0( ed25519_p3 *r )
+{
+    fe_0( r->X );
+    fe_1( r->Y );
+    fe_1( r->Z );
+    fe_0( r->T );
+}
+
+static void ed25519_p2_0( ed25519_p2 *r )
+{
+    fe_0( r->X );
+    fe_1( r->Y );
+    fe_1( r->Z );
+}
+
+/*
+ * r = 2 * p, "dbl-2008-hwcd"
+ */
+static void ed25519_p2_dbl( ed25519_p1p1 *r, const ed25519_p2 *p )
+{
+    ed25519_fe t0;
+
+    fe_sqr( r->X, p->X );
+    fe_sqr( r->Z, p->Y );
+    fe_sqr( r->T, p->Z );
+    fe_add( r->T, r->T, r->T );
+    fe_add( r->Y, p->X, p->Y );
+    fe_sqr( t0, r->Y );
+    fe_add( r->Y, r->Z, r->X );
+    fe_sub( r->Z, r->Z, r->X );
+    fe_sub( r->X, t0, r->Y );
+    fe_sub( r->T, r->T, r->Z );
+}
+
+static void ed25519_p3_dbl( ed25519_p1p1 *r, const ed25519_p3 *p )
+{
+    ed25519_p2 q;
+
+    fe_copy( q.X, p->X );
+    fe_copy( q.Y, p->Y );
+    fe_copy( q.Z, p->Z );
+    ed25519_p2_dbl( r, &q );
+}
+
+/*
+ * r = p + q or p - q (neg = 1), "madd-2008-hwcd-3" for an affine q
+ */
+static void ed25519_madd( ed25519_p1p1 *r, const ed25519_p3 *p,
+                          const ed25519_precomp *q, int neg )
+{
+    ed25519_fe t0;
+
+    fe_add( r->X, p->Y, p->X );
+    fe_sub( r->Y, p->Y, p->X );
+    fe_mul( r->Z, r->X, neg ? q->ymx : q->ypx );
+    fe_mul( r->Y, r->Y, neg ? q->ypx : q->ymx );
+    fe_mul( r->T, q->xy2d, p->T );
+    fe_add( t0, p->Z, p->Z );
+    fe_sub( r->X, r->Z, r->Y );
+    fe_add( r->Y, r->Z, r->Y );
+    if( neg )
+    {
+        fe_sub( r->Z, t0, r->T );
+        fe_add( r->T, t0, r->T );
+    }
+    else
+    {
+        fe_add( r->Z, t0, r->T );
+        fe_sub( r->T, t0, r->T );
+    }
+}
+
+/*
+ * r = p + q or p - q (neg = 1), "add-2008-hwcd-3"
+ */
+static void ed25519_add( ed25519_p1p1 *r, const ed25519_p3 *p,
+                         const ed25519_cached *q, int neg )
+{
+    ed25519_fe t0;
+
+    fe_add( r->X, p->Y, p->X );
+    fe_sub( r->Y, p->Y, p->X );
+    fe_mul( r->Z, r->X, neg ? q->YmX : q->YpX );
+    fe_mul( r->Y, r->Y, neg ? q->YpX : q->YmX );
+    fe_mul( r->T, q->T2d, p->T );
+    fe_mul( r->X, p->Z, q->Z );
+    fe_add( t0, r->X, r->X );
+    fe_sub( r->X, r->Z, r->Y );
+    fe_add( r->Y, r->Z, r->Y );
+    if( neg )
+    {
+        fe_sub( r->Z, t0, r->T );
+        fe_add( r->T, t0, r->T );
+    }
+    else
+    {
+        fe_add( r->Z, t0, r->T );
+        fe_sub( r->T, t0, r->T );
+    }
+}
+
+/*
+ * Encode a point (RFC 8032 5.1.2)
+ */
+static void ed25519_p2_tobytes( unsigned char s[32], const ed25519_p2 *p )
+{
+    ed25519_fe recip, x, y;
+
+    mbedtls_x25519_fe_inv( recip, p->Z );
+    fe_mul( x, p->X, recip );
+    fe_mul( y, p->Y, recip );
+    mbedtls_x25519_fe_tobytes( s, y );
+    s[31] ^= (unsigned char) ( fe_isnegative( x ) << 7 );
+}
+
+static void ed25519_p3_tobytes( unsigned char s[32], const ed25519_p3 *p )
+{
+    ed25519_p2 q;
+
+    fe_copy( q.X, p->X );
+    fe_copy( q.Y, p->Y );
+    fe_copy( q.Z, p->Z );
+    ed25519_p2_tobytes( s, &q );
+}
+
+/*
+ * Decode a point (RFC 8032 5.1.3) and negate it. Public data only.
+ */
+static int ed25519_frombytes_negate( ed25519_p3 *r, const unsigned char s[32] )
+{
+    unsigned char y[32], chk[32];
+    ed25519_fe u, v, v3, vxx, t;
+    int sign = s[31] >> 7;
+
+    /* y must be canonical */
+    memcpy( y, s, 32 );
+    y[31] &= 0x7F;
+    mbedtls_x25519_fe_frombytes( r->Y, y );
+    mbedtls_x25519_fe_tobytes( chk, r->Y );
+    if( memcmp( chk, y, 32 ) != 0 )
+        return( MBEDTLS_ERR_ED25519_INVALID_KEY );
+
+    /* x^2 = u / v = (y^2 - 1) / (d y^2 + 1) */
+    fe_1( r->Z );
+    fe_sqr( u, r->Y );
+    fe_mul( v, u, ed25519_d );
+    fe_sub( u, u, r->Z );
+    fe_add( v, v, r->Z );
+
+    /* x = u v^3 (u v^7)^((p - 5) / 8) */
+    fe_sqr( v3, v );
+    fe_mul( v3, v3, v );
+    fe_sqr( r->X, v3 );
+    fe_mul( r->X, r->X, v );
+    fe_mul( r->X, r->X, u );
+    mbedtls_x25519_fe_pow22523( r->X, r->X );
+    fe_mul( r->X, r->X, v3 );
+    fe_mul( r->X, r->X, u );
+
+    /* Either x or x * sqrt(-1) is a square root, or there is none */
+    fe_sqr( vxx, r->X );
+    fe_mul( vxx, vxx, v );
+    fe_sub( t, vxx, u );
+    if( ! fe_iszero( t ) )
+    {
+        fe_add( t, vxx, u );
+        if( ! fe_iszero( t ) )
+            return( MBEDTLS_ERR_ED25519_INVALID_KEY );
+
+        fe_mul( r->X, r->X, ed25519_sqrtm1 );
+    }
+
+    if( fe_iszero( r->X ) && sign )
+        return( MBEDTLS_ERR_ED25519_INVALID_KEY );
+
+    if( fe_isnegative( r->X ) == sign )
+        fe_neg( r->X, r->X );
+
+    fe_mul( r->T, r->X, r->Y );
+
+    return( 0 );
+}
+
+/*
+ * r = a * B, for a secret a below 2^256.
+ *
+ * Comb method with 8 teeth split over two 15-entry tables: the entry
+ * ed25519_comb[t][i - 1] is sum_j i_j 2^(64 j + 32 t) B, where i_j is bit j
+ * of i. That leaves 32 iterations of one doubling and two additions, with
+ * each table read in full so that the access pattern does not depend on a.
+ */
+static void ed25519_select( ed25519_precomp *r, const ed25519_precomp t[15],
+                            unsigned char i )
+{
+    unsigned char j;
+    uint64_t eq;
+
+    fe_1( r->ypx );
+    fe_1( r->ymx );
+    fe_0( r->xy2d );
+
+    for( j = 1; j <= 15; j++ )
+    {
+        eq = ( (uint64_t) ( i ^ j ) - 1 ) >> 63;
+        fe_cmov( r->ypx, t[j - 1].ypx, eq );
+        fe_cmov( r->ymx, t[j - 1].ymx, eq );
+        fe_cmov( r->xy2d, t[j - 1].xy2d, eq );
+    }
+}
+
+static void ed25519_mul_base( ed25519_p3 *r, const unsigned char a[32] )
+{
+    ed25519_p1p1 s;
+    ed25519_precomp q;
+    unsigned char idx;
+    int i, t, j, b;
+
+    ed25519_p3_0( r );
+
+    for( i = 31; i >= 0; i-- )
+    {
+        ed25519_p3_dbl( &s, r );
+        ed25519_p1p1_to_p3( r, &s );
+
+        for( t = 0; t < 2; t++ )
+        {
+            idx = 0;
+            for( j = 0; j < 4; j++ )
+            {
+                b = i + 32 * t + 64 * j;
+                idx |= ( ( a[b >> 3] >> ( b & 7 ) ) & 1 ) << j;
+            }
+
+            ed25519_select( &q, ed25519_comb[t], idx );
+            ed25519_madd( &s, r, &q, 0 );
+            ed25519_p1p1_to_p3( r, &s );
+        }
+    }
+
+    mbedtls_zeroize( &q, sizeof( q ) );
+    mbedtls_zeroize( &s, sizeof( s ) );
+}
+
+/*
+ * Width-w NAF of a 253-bit scalar: odd digits of absolute value below
+ * 2^(w-1), at least w - 1 zeros after each nonzero digit.
+ */
+static void ed25519_wnaf( signed char r[256], const unsigned char a[32],
+                          int w )
+{
+    const int max = ( 1 << ( w - 1 ) ) - 1;
+    int i, b, k;
+
+    for( i = 0; i < 256; i++ )
+        r[i] = ( a[i >> 3] >> ( i & 7 ) ) & 1;
+
+    for( i = 0; i < 256; i++ )
+    {
+        if( r[i] == 0 )
+            continue;
+
+        for( b = 1; b <= w + 1 && i + b < 256; b++ )
+        {
+            if( r[i + b] == 0 )
+                continue;
+
+            if( r[i] + ( r[i + b] << b ) <= max )
+            {
+                r[i] += r[i + b] << b;
+                r[i + b] = 0;
+            }
+            else if( r[i] - ( r[i + b] << b ) >= -max )
+            {
+                r[i] -= r[i + b] << b;
+                for( k = i + b; k < 256; k++ )
+                {
+                    if( r[k] == 0 )
+                    {
+                        r[k] = 1;
+                        break;
+                    }
+                    r[k] = 0;
+                }
+            }
+            else
+                break;
+        }
+    }
+}
+
+/*
+ * r = a * B + b * A (Straus), in variable time, for public a and b.
+ * A is given as its eight odd multiples A, 3A, ..., 15A.
+ */
+static void ed25519_double_mul( ed25519_p2 *r, const unsigned char a[32],
+                                const unsigned char b[32],
+                                const ed25519_cached tA[8] )
+{
+    signed char na[256], nb[256];
+    ed25519_p1p1 s;
+    ed25519_p3 u;
+    int i;
+
+    ed25519_wnaf( na, a, 7 );
+    ed25519_wnaf( nb, b, 5 );
+
+    ed25519_p2_0( r );
+
+    for( i = 255; i >= 0; i-- )
+        if( na[i] != 0 || nb[i] != 0 )
+            break;
+
+    for( ; i >= 0; i-- )
+    {
+        ed25519_p2_dbl( &s, r );
+
+        if( na[i] != 0 )
+        {
+            ed25519_p1p1_to_p3( &u, &s );
+            if( na[i] > 0 )
+                ed25519_madd( &s, &u, &ed25519_base_odd[na[i] / 2], 0 );
+            else
+                ed25519_madd( &s, &u, &ed25519_base_odd[-na[i] / 2], 1 );
+        }
+
+        if( nb[i] != 0 )
+        {
+            ed25519_p1p1_to_p3( &u, &s );
+            if( nb[i] > 0 )
+                ed25519_add( &s, &u, &tA[nb[i] / 2], 0 );
+            else
+                ed25519_add( &s, &u, &tA[-nb[i] / 2], 1 );
+        }
+
+        ed25519_p1p1_to_p2( r, &s );
+    }
+}
+
+/*
+ * Fill tA with A, 3A, ..., 15A
+ */
+static void ed25519_odd_multiples( ed25519_cached tA[8], const ed25519_p3 *A )
+{
+    ed25519_p1p1 s;
+    ed25519_p3 A2, u;
+    int i;
+
+    ed25519_p3_dbl( &s, A );
+    ed25519_p1p1_to_p3( &A2, &s );
+
+    ed25519_p3_to_cached( &tA[0], A );
+    for( i = 1; i < 8; i++ )
+    {
+        ed25519_add( &s, &A2, &tA[i - 1], 0 );
+        ed25519_p1p1_to_p3( &u, &s );
+        ed25519_p3_to_cached( &tA[i], &u );
+    }
+}
+
+/*
+ * Scalars modulo L, stored as 32 little-endian bytes
+ */
+static int ed25519_read_scalar( mbedtls_mpi *X, const unsigned char *s,
+                                size_t len )
+{
+    unsigned char be[64];
+    size_t i;
+    int ret;
+
+    for( i = 0; i < len; i++ )
+        be[i] = s[len - 1 - i];
+
+    ret = mbedtls_mpi_read_binary( X, be, len );
+
+    mbedtls_zeroize( be, sizeof( be ) );
+    return( ret );
+}
+
+static int ed25519_write_scalar( unsigned char s[32], const mbedtls_mpi *X )
+{
+    unsigned char be[32];
+    size_t i;
+    int ret;
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( X, be, 32 ) );
+    for( i = 0; i < 32; i++ )
+        s[i] = be[31 - i];
+
+cleanup:
+    mbedtls_zeroize( be, sizeof( be ) );
+    return( ret );
+}
+
+/*
+ * X = SHA-512( p1 || p2 || msg ) mod L
+ */
+static int ed25519_hash_scalar( mbedtls_mpi *X, const mbedtls_mpi *L,
+                                const unsigned char *p1, size_t len1,
+                                const unsigned char *p2, size_t len2,
+                                const unsigned char *msg, size_t len )
+{
+    int ret;
+    mbedtls_sha512_context sha;
+    unsigned char h[64];
+
+    mbedtls_sha512_init( &sha );
+    mbedtls_sha512_starts( &sha, 0 );
+    mbedtls_sha512_update( &sha, p1, len1 );
+    mbedtls_sha512_update( &sha, p2, len2 );
+    mbedtls_sha512_update( &sha, msg, len );
+    mbedtls_sha512_finish( &sha, h );
+
+    MBEDTLS_MPI_CHK( ed25519_read_scalar( X, h, 64 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( X, X, L ) );
+
+cleanup:
+    mbedtls_sha512_free( &sha );
+    mbedtls_zeroize( h, sizeof( h ) );
+    return( ret );
+}
+
+/*
+ * Initialize context
+ */
+void mbedtls_ed25519_init( mbedtls_ed25519_context *ctx )
+{
+    memset( ctx, 0, sizeof( mbedtls_ed25519_context ) );
+}
+
+/*
+ * Free context
+ */
+void mbedtls_ed25519_free( mbedtls_ed25519_context *ctx )
+{
+    if( ctx == NULL )
+        return;
+
+    mbedtls_zeroize( ctx, sizeof( mbedtls_ed25519_context ) );
+}
+
+/*
+ * Store A and its odd multiples, negated for verification
+ */
+static int ed25519_set_public( mbedtls_ed25519_context *ctx,
+                               const unsigned char key[32] )
+{
+    int ret;
+    ed25519_p3 A;
+    ed25519_cached tA[8];
+
+    ctx->has_public = 0;
+
+    if( ( ret = ed25519_frombytes_negate( &A, key ) ) != 0 )
+        return( ret );
+
+    ed25519_odd_multiples( tA, &A );
+
+    memcpy( ctx->pub, key, 32 );
+    memcpy( ctx->table, tA, sizeof( ctx->table ) );
+    ctx->has_public = 1;
+
+    return( 0 );
+}
+
+int mbedtls_ed25519_set_public( mbedtls_ed25519_context *ctx,
+                                const unsigned char key[32] )
+{
+    mbedtls_ed25519_free( ctx );
+
+    return( ed25519_set_public( ctx, key ) );
+}
+
+/*
+ * RFC 8032 5.1.5
+ */
+int mbedtls_ed25519_set_private( mbedtls_ed25519_context *ctx,
+                                 const unsigned char key[32] )
+{
+    unsigned char h[64], pub[32];
+    ed25519_p3 A;
+    int ret;
+
+    mbedtls_ed25519_free( ctx );
+
+    mbedtls_sha512( key, 32, h, 0 );
+    h[0] &= 0xF8;
+    h[31] &= 0x7F;
+    h[31] |= 0x40;
+
+    memcpy( ctx->seed, key, 32 );
+    memcpy( ctx->scalar, h, 32 );
+    memcpy( ctx->prefix, h + 32, 32 );
+    ctx->has_private = 1;
+
+    ed25519_mul_base( &A, ctx->scalar );
+    ed25519_p3_tobytes( pub, &A );
+
+    ret = ed25519_set_public( ctx, pub );
+
+    mbedtls_zeroize( h, sizeof( h ) );
+    mbedtls_zeroize( &A, sizeof( A ) );
+    return( ret );
+}
+
+/*
+ * Generate a key pair
+ */
+int mbedtls_ed25519_genkey( mbedtls_ed25519_context *ctx,
+                    int (*f_rng)(void *, unsigned char *, size_t),
+                    void *p_rng )
+{
+    unsigned char seed[32];
+    int ret;
+
+    if( ( ret = f_rng( p_rng, seed, sizeof( seed ) ) ) == 0 )
+        ret = mbedtls_ed25519_set_private( ctx, seed );
+
+    mbedtls_zeroize( seed, sizeof( seed ) );
+    return( ret );
+}
+
+/*
+ * Check a public-private key pair
+ */
+int mbedtls_ed25519_check_pub_priv( const mbedtls_ed25519_context *pub,
+                                    const mbedtls_ed25519_context *prv )
+{
+    if( ! pub->has_public || ! prv->has_private || ! prv->has_public ||
+        memcmp( pub->pub, prv->pub, 32 ) != 0 )
+    {
+        return( MBEDTLS_ERR_ED25519_INVALID_KEY );
+    }
+
+    return( 0 );
+}
+
+/*
+ * RFC 8032 5.1.6
+ */
+int mbedtls_ed25519_sign( const mbedtls_ed25519_context *ctx,
+                          const unsigned char *msg, size_t len,
+                          unsigned char sig[64] )
+{
+    int ret;
+    mbedtls_mpi L, r, k, s;
+    unsigned char rb[32];
+    ed25519_p3 R;
+
+    if( ! ctx->has_private )
+        return( MBEDTLS_ERR_ED25519_INVALID_KEY );
+
+    mbedtls_mpi_init( &L ); mbedtls_mpi_init( &r );
+    mbedtls_mpi_init( &k ); mbedtls_mpi_init( &s );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &L, ed25519_order, 32 ) );
+
+    /* r = H(prefix || M), R = r B */
+    MBEDTLS_MPI_CHK( ed25519_hash_scalar( &r, &L, ctx->prefix, 32,
+                                          NULL, 0, msg, len ) );
+    MBEDTLS_MPI_CHK( ed25519_write_scalar( rb, &r ) );
+    ed25519_mul_base( &R, rb );
+    ed25519_p3_tobytes( sig, &R );
+
+    /* k = H(R || A || M), S = r + k s mod L */
+    MBEDTLS_MPI_CHK( ed25519_hash_scalar( &k, &L, sig, 32,
+                                          ctx->pub, 32, msg, len ) );
+    MBEDTLS_MPI_CHK( ed25519_read_scalar( &s, ctx->scalar, 32 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &k, &k, &s ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( &k, &k, &r ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &k, &k, &L ) );
+    MBEDTLS_MPI_CHK( ed25519_write_scalar( sig + 32, &k ) );
+
+cleanup:
+    mbedtls_mpi_free( &L ); mbedtls_mpi_free( &r );
+    mbedtls_mpi_free( &k ); mbedtls_mpi_free( &s );
+    mbedtls_zeroize( rb, sizeof( rb ) );
+    mbedtls_zeroize( &R, sizeof( R ) );
+    return( ret );
+}
+
+/*
+ * RFC 8032 5.1.7, without the cofactor
+ */
+int mbedtls_ed25519_verify( const mbedtls_ed25519_context *ctx,
+                            const unsigned char *msg, size_t len,
+                            const unsigned char sig[64] )
+{
+    int ret;
+    mbedtls_mpi L, S, k;
+    unsigned char kb[32], chk[32], diff = 0;
+    ed25519_cached tA[8];
+    ed25519_p2 R;
+    size_t i;
+
+    if( ! ctx->has_public )
+        return( MBEDTLS_ERR_ED25519_INVALID_KEY );
+
+    mbedtls_mpi_init( &L ); mbedtls_mpi_init( &S ); mbedtls_mpi_init( &k );
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &L, ed25519_order, 32 ) );
+    MBEDTLS_MPI_CHK( ed25519_read_scalar( &S, sig + 32, 32 ) );
+    if( mbedtls_mpi_cmp_mpi( &S, &L ) >= 0 )
+    {
+        ret = MBEDTLS_ERR_ED25519_VERIFY_FAILED;
+        goto cleanup;
+    }
+
+    MBEDTLS_MPI_CHK( ed25519_hash_scalar( &k, &L, sig, 32,
+                                          ctx->pub, 32, msg, len ) );
+    MBEDTLS_MPI_CHK( ed25519_write_scalar( kb, &k ) );
+
+    /* R' = S B - k A, the table holding multiples of -A */
+    memcpy( tA, ctx->table, sizeof( tA ) );
+    ed25519_double_mul( &R, sig + 32, kb, tA );
+    ed25519_p2_tobytes( chk, &R );
+
+    for( i = 0; i < 32; i++ )
+        diff |= chk[i] ^ sig[i];
+
+    ret = diff == 0 ? 0 : MBEDTLS_ERR_ED25519_VERIFY_FAILED;
+
+cleanup:
+    mbedtls_mpi_free( &L ); mbedtls_mpi_free( &S ); mbedtls_mpi_free( &k );
+    return( ret );
+}
+
+#if defined(MBEDTLS_SELF_TEST)
+
+/*
+ * RFC 8032 7.1, tests 1 and 2
+ */
+static const unsigned char ed25519_test_sk[2][32] =
+{
+    { 0x9d, 0x61, 0xb1, 0x9d, 0xef, 0xfd, 0x5a, 0x60,
+      0xba, 0x84, 0x4a, 0xf4, 0x92, 0xec, 0x2c, 0xc4,
+      0x44, 0x49, 0xc5, 0x69, 0x7b, 0x32, 0x69, 0x19,
+      0x70, 0x3b, 0xac, 0x03, 0x1c, 0xae, 0x7f, 0x60 },
+    { 0x4c, 0xcd, 0x08, 0x9b, 0x28, 0xff, 0x96, 0xda,
+      0x9d, 0xb6, 0xc3, 0x46, 0xec, 0x11, 0x4e, 0x0f,
+      0x5b, 0x8a, 0x31, 0x9f, 0x35, 0xab, 0xa6, 0x24,
+      0xda, 0x8c, 0xf6, 0xed, 0x4f, 0xb8, 0xa6, 0xfb },
+};
+
+static const unsigned char ed25519_test_pk[2][32] =
+{
+    { 0xd7, 0x5a, 0x98, 0x01, 0x82, 0xb1, 0x0a, 0xb7,
+      0xd5, 0x4b, 0xfe, 0xd3, 0xc9, 0x64, 0x07, 0x3a,
+      0x0e, 0xe1, 0x72, 0xf3, 0xda, 0xa6, 0x23, 0x25,
+      0xaf, 0x02, 0x1a, 0x68, 0xf7, 0x07, 0x51, 0x1a },
+    { 0x3d, 0x40, 0x17, 0xc3, 0xe8, 0x43, 0x89, 0x5a,
+      0x92, 0xb7, 0x0a, 0xa7, 0x4d, 0x1b, 0x7e, 0xbc,
+      0x9c, 0x98, 0x2c, 0xcf, 0x2e, 0xc4, 0x96, 0x8c,
+      0xc0, 0xcd, 0x55, 0xf1, 0x2a, 0xf4, 0x66, 0x0c },
+};
+
+static const unsigned char ed25519_test_msg[1] = { 0x72 };
+
+static const unsigned char ed25519_test_sig[2][64] =
+{
+    { 0xe5, 0x56, 0x43, 0x00, 0xc3, 0x60, 0xac, 0x72,
+      0x90, 0x86, 0xe2, 0xcc, 0x80, 0x6e, 0x82, 0x8a,
+      0x84, 0x87, 0x7f, 0x1e, 0xb8, 0xe5, 0xd9, 0x74,
+      0xd8, 0x73, 0xe0, 0x65, 0x22, 0x49, 0x01, 0x55,
+      0x5f, 0xb8, 0x82, 0x15, 0x90, 0xa3, 0x3b, 0xac,
+      0xc6, 0x1e, 0x39, 0x70, 0x1c, 0xf9, 0xb4, 0x6b,
+      0xd2, 0x5b, 0xf5, 0xf0, 0x59, 0x5b, 0xbe, 0x24,
+      0x65, 0x51, 0x41, 0x43, 0x8e, 0x7a, 0x10, 0x0b },
+    { 0x92, 0xa0, 0x09, 0xa9, 0xf0, 0xd4, 0xca, 0xb8,
+      0x72, 0x0e, 0x82, 0x0b, 0x5f, 0x64, 0x25, 0x40,
+      0xa2, 0xb2, 0x7b, 0x54, 0x16, 0x50, 0x3f, 0x8f,
+      0xb3, 0x76, 0x22, 0x23, 0xeb, 0xdb, 0x69, 0xda,
+      0x08, 0x5a, 0xc1, 0xe4, 0x3e, 0x15, 0x99, 0x6e,
+      0x45, 0x8f, 0x36, 0x13, 0xd0, 0xf1, 0x1d, 0x8c,
+      0x38, 0x7b, 0x2e, 0xae, 0xb4, 0x30, 0x2a, 0xee,
+      0xb0, 0x0d, 0x29, 0x16, 0x12, 0xbb, 0x0c, 0x00 },
+};
+
+/*
+ * Checkup routine
+ */
+int mbedtls_ed25519_self_test( int verbose )
+{
+    int ret = 0, i;
+    mbedtls_ed25519_context ctx;
+    unsigned char sig[64];
+
+    mbedtls_ed25519_init( &ctx );
+
+    for( i = 0; i < 2; i++ )
+    {
+        if( verbose != 0 )
+            mbedtls_printf( "  Ed25519 test #%d: ", i + 1 );
+
+        if( mbedtls_ed25519_set_private( &ctx, ed25519_test_sk[i] ) != 0 ||
+            memcmp( ctx.pub, ed25519_test_pk[i], 32 ) != 0 ||
+            mbedtls_ed25519_sign( &ctx, ed25519_test_msg, i, sig ) != 0 ||
+            memcmp( sig, ed25519_test_sig[i], 64 ) != 0 ||
+            mbedtls_ed25519_set_public( &ctx, ed25519_test_pk[i] ) != 0 ||
+            mbedtls_ed25519_verify( &ctx, ed25519_test_msg, i, sig ) != 0 )
+        {
+            if( verbose != 0 )
+                mbedtls_printf( "failed\n" );
+
+            ret = 1;
+            goto cleanup;
+        }
+
+        sig[i] ^= 0x01;
+        if( mbedtls_ed25519_verify( &ctx, ed25519_test_msg, i, sig ) !=
+            MBEDTLS_ERR_ED25519_VERIFY_FAILED )
+        {
+            if( verbose != 0 )
+                mbedtls_printf( "failed\n" );
+
+            ret = 1;
+            goto cleanup;
+        }
+
+        if( verbose != 0 )
+            mbedtls_printf( "passed\n" );
+    }
+
+    if( verbose != 0 )
+        mbedtls_printf( "\n" );
+
+cleanup:
+    mbedtls_ed25519_free( &ctx );
+
+    return( ret );
+}
+
+#endif /* MBEDTLS_SELF_TEST */
+
+#endif /* MBEDTLS_ED25519_C */
@@ -85,6 +85,10 @@
 #include "mbedtls/ecp.h"
 #endif
 
+#if defined(MBEDTLS_ED25519_C)
+#include "mbedtls/ed25519.h"
+#endif
+
 #if defined(MBEDTLS_ENTROPY_C)
 #include "mbedtls/entropy.h"
 #endif
@@ -225,6 +229,10 @@ void mbedtls_strerror( int ret, char *buf, size_t buflen )
             mbedtls_snprintf( buf, buflen, "ECP - Invalid private or public key" );
         if( use_ret == -(MBEDTLS_ERR_ECP_SIG_LEN_MISMATCH) )
             mbedtls_snprintf( buf, buflen, "ECP - Signature is valid but shorter than the user-supplied length" );
+        if( use_ret == -(MBEDTLS_ERR_ECP_POOL_EMPTY) )
+            mbedtls_snprintf( buf, buflen, "ECP - No precomputed value of the requested kind is available" );
+        if( use_ret == -(MBEDTLS_ERR_ECP_IN_PROGRESS) )
+            mbedtls_snprintf( buf, buflen, "ECP - Operation in progress, call again with the same parameters to continue" );
 #endif /* MBEDTLS_ECP_C */
 
 #if defined(MBEDTLS_MD_C)
@@ -441,6 +449,8 @@ void mbedtls_strerror( int ret, char *buf, size_t buflen )
             mbedtls_snprintf( buf, buflen, "SSL - The alert message received indicates a non-fatal error" );
         if( use_ret == -(MBEDTLS_ERR_SSL_INVALID_VERIFY_HASH) )
             mbedtls_snprintf( buf, buflen, "SSL - Couldn't set the hash for verifying CertificateVerify" );
+        if( use_ret == -(MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS) )
+            mbedtls_snprintf( buf, buflen, "SSL - A cryptographic operation is in progress. Try again later" );
 #endif /* MBEDTLS_SSL_TLS_C */
 
 #if defined(MBEDTLS_X509_USE_C) || defined(MBEDTLS_X509_CREATE_C)
@@ -521,7 +531,7 @@ void mbedtls_strerror( int ret, char *buf, size_t buflen )
     if( use_ret == -(MBEDTLS_ERR_AES_INVALID_INPUT_LENGTH) )
         mbedtls_snprintf( buf, buflen, "AES - Invalid data input length" );
     if( use_ret == -(MBEDTLS_ERR_AES_FEATURE_UNAVAILABLE) )
-        mbedtls_snprintf( buf, buflen, "AES - Feature not available, e.g. unsupported AES key size" );
+        mbedtls_snprintf( buf, buflen, "AES - Feature not available. For example, unsupported AES key size" );
 #endif /* MBEDTLS_AES_C */
 
 #if defined(MBEDTLS_ASN1_PARSE_C)
@@ -604,6 +614,13 @@ void mbedtls_strerror( int ret, char *buf, size_t buflen )
         mbedtls_snprintf( buf, buflen, "DES - The data input has an invalid length" );
 #endif /* MBEDTLS_DES_C */
 
+#if defined(MBEDTLS_ED25519_C)
+    if( use_ret == -(MBEDTLS_ERR_ED25519_VERIFY_FAILED) )
+        mbedtls_snprintf( buf, buflen, "ED25519 - The signature is not valid" );
+    if( use_ret == -(MBEDTLS_ERR_ED25519_INVALID_KEY) )
+        mbedtls_snprintf( buf, buflen, "ED25519 - Invalid key: not a point on the curve, or no key set" );
+#endif /* MBEDTLS_ED25519_C */
+
 #if defined(MBEDTLS_ENTROPY_C)
     if( use_ret == -(MBEDTLS_ERR_ENTROPY_SOURCE_FAILED) )
         mbedtls_snprintf( buf, buflen, "ENTROPY - Critical entropy source failure" );
@@ -34,6 +34,7 @@
 #if defined(MBEDTLS_HMAC_DRBG_C)
 
 #include "mbedtls/hmac_drbg.h"
+#include "mbedtls/md_internal.h"
 
 #include <string.h>
 
@@ -41,6 +42,12 @@
 #include <stdio.h>
 #endif
 
+#if defined(MBEDTLS_DRBG_FORK_SAFETY)
+#include <sys/types.h>
+#include <unistd.h>
+#include <time.h>
+#endif
+
 #if defined(MBEDTLS_SELF_TEST)
 #if defined(MBEDTLS_PLATFORM_C)
 #include "mbedtls/platform.h"
@@ -55,6 +62,12 @@ static void mbedtls_zeroize( void *v, size_t n ) {
     volatile unsigned char *p = v; while( n-- ) *p++ = 0;
 }
 
+#if defined(MBEDTLS_SHA512_C)
+#define HMAC_DRBG_MAX_BLOCK_SIZE    128
+#else
+#define HMAC_DRBG_MAX_BLOCK_SIZE    64
+#endif
+
 /*
  * HMAC_DRBG context initialization
  */
@@ -67,6 +80,85 @@ void mbedtls_hmac_drbg_init( mbedtls_hmac_drbg_context *ctx )
 #endif
 }
 
+/*
+ * Set up the working MD context and the two midstate contexts.
+ * The HMAC pad buffer of the MD layer is not needed, since the keyed
+ * midstates are computed here directly.
+ */
+static int hmac_drbg_setup( mbedtls_hmac_drbg_context *ctx,
+                            const mbedtls_md_info_t *md_info )
+{
+    int ret;
+
+    if( ( ret = mbedtls_md_setup( &ctx->md_ctx, md_info, 0 ) ) != 0 ||
+        ( ret = mbedtls_md_setup( &ctx->ipad_ctx, md_info, 0 ) ) != 0 ||
+        ( ret = mbedtls_md_setup( &ctx->opad_ctx, md_info, 0 ) ) != 0 )
+    {
+        return( ret );
+    }
+
+    return( 0 );
+}
+
+/*
+ * Change the HMAC key: absorb K ^ ipad and K ^ opad once and keep the
+ * resulting midstates, so that every subsequent HMAC only pays for the
+ * message blocks and one outer block.
+ * A NULL key of length 0 is the all-zero key used at instantiation.
+ */
+static void hmac_drbg_set_key( mbedtls_hmac_drbg_context *ctx,
+                               const unsigned char *key, size_t keylen )
+{
+    const mbedtls_md_info_t *md_info = ctx->md_ctx.md_info;
+    size_t block_size = (size_t) md_info->block_size;
+    unsigned char pad[HMAC_DRBG_MAX_BLOCK_SIZE];
+    size_t i;
+
+    memset( pad, 0x36, block_size );
+    for( i = 0; i < keylen; i++ )
+        pad[i] = (unsigned char)( pad[i] ^ key[i] );
+
+    md_info->starts_func( ctx->ipad_ctx.md_ctx );
+    md_info->update_func( ctx->ipad_ctx.md_ctx, pad, block_size );
+
+    /* 0x36 ^ 0x5C: turn K ^ ipad into K ^ opad */
+    for( i = 0; i < block_size; i++ )
+        pad[i] = (unsigned char)( pad[i] ^ 0x6A );
+
+    md_info->starts_func( ctx->opad_ctx.md_ctx );
+    md_info->update_func( ctx->opad_ctx.md_ctx, pad, block_size );
+
+    mbedtls_zeroize( pad, sizeof( pad ) );
+}
+
+/*
+ * output = HMAC( K, V || [sep] || [additional] ), starting from the cached
+ * midstates. output may be ctx->V.
+ */
+static void hmac_drbg_hmac( mbedtls_hmac_drbg_context *ctx,
+                            const unsigned char *sep,
+                            const unsigned char *additional, size_t add_len,
+                            unsigned char *output )
+{
+    const mbedtls_md_info_t *md_info = ctx->md_ctx.md_info;
+    size_t md_len = (size_t) md_info->size;
+    unsigned char tmp[MBEDTLS_MD_MAX_SIZE];
+
+    md_info->clone_func( ctx->md_ctx.md_ctx, ctx->ipad_ctx.md_ctx );
+    md_info->update_func( ctx->md_ctx.md_ctx, ctx->V, md_len );
+    if( sep != NULL )
+        md_info->update_func( ctx->md_ctx.md_ctx, sep, 1 );
+    if( additional != NULL && add_len != 0 )
+        md_info->update_func( ctx->md_ctx.md_ctx, additional, add_len );
+    md_info->finish_func( ctx->md_ctx.md_ctx, tmp );
+
+    md_info->clone_func( ctx->md_ctx.md_ctx, ctx->opad_ctx.md_ctx );
+    md_info->update_func( ctx->md_ctx.md_ctx, tmp, md_len );
+    md_info->finish_func( ctx->md_ctx.md_ctx, output );
+
+    mbedtls_zeroize( tmp, sizeof( tmp ) );
+}
+
 /*
  * HMAC_DRBG update, using optional additional data (10.1.2.2)
  */
@@ -81,18 +173,14 @@ void mbedtls_hmac_drbg_update( mbedtls_hmac_drbg_context *ctx,
     for( sep[0] = 0; sep[0] < rounds; sep[0]++ )
     {
         /* Step 1 or 4 */
-        mbedtls_md_hmac_reset( &ctx->md_ctx );
-        mbedtls_md_hmac_update( &ctx->md_ctx, ctx->V, md_len );
-        mbedtls_md_hmac_update( &ctx->md_ctx, sep, 1 );
-        if( rounds == 2 )
-            mbedtls_md_hmac_update( &ctx->md_ctx, additional, add_len );
-        mbedtls_md_hmac_finish( &ctx->md_ctx, K );
+        hmac_drbg_hmac( ctx, sep, additional, add_len, K );
 
         /* Step 2 or 5 */
-        mbedtls_md_hmac_starts( &ctx->md_ctx, K, md_len );
-        mbedtls_md_hmac_update( &ctx->md_ctx, ctx->V, md_len );
-        mbedtls_md_hmac_finish( &ctx->md_ctx, ctx->V );
+        hmac_drbg_set_key( ctx, K, md_len );
+        hmac_drbg_hmac( ctx, NULL, NULL, 0, ctx->V );
     }
+
+    mbedtls_zeroize( K, sizeof( K ) );
 }
 
 /*
@@ -104,15 +192,13 @@ int mbedtls_hmac_drbg_seed_buf( mbedtls_hmac_drbg_context *ctx,
 {
     int ret;
 
-    if( ( ret = mbedtls_md_setup( &ctx->md_ctx, md_info, 1 ) ) != 0 )
+    if( ( ret = hmac_drbg_setup( ctx, md_info ) ) != 0 )
         return( ret );
 
     /*
-     * Set initial working state.
-     * Use the V memory location, which is currently all 0, to initialize the
-     * MD context with an all-zero key. Then set V to its initial value.
+     * Set initial working state: all-zero key, V = 0x01 0x01 ... 0x01
      */
-    mbedtls_md_hmac_starts( &ctx->md_ctx, ctx->V, mbedtls_md_get_size( md_info ) );
+    hmac_drbg_set_key( ctx, NULL, 0 );
     memset( ctx->V, 0x01, mbedtls_md_get_size( md_info ) );
 
     mbedtls_hmac_drbg_update( ctx, data, data_len );
@@ -120,6 +206,42 @@ int mbedtls_hmac_drbg_seed_buf( mbedtls_hmac_drbg_context *ctx,
     return( 0 );
 }
 
+#if defined(MBEDTLS_DRBG_FORK_SAFETY)
+/*
+ * Fork detection: if this context was last used by another process, we are
+ * running in a child that inherited a copy of the parent's state. Make the
+ * state diverge by mixing in data that is unique to this child (pid, parent
+ * pid and timestamps, the latter guarding against pid reuse), which is much
+ * cheaper than a full reseed from the entropy source.
+ */
+static void hmac_drbg_fork_check( mbedtls_hmac_drbg_context *ctx )
+{
+    struct
+    {
+        long pid, ppid;
+        struct timespec mono, real;
+    } pers;
+
+    if( (long) getpid() == ctx->pid )
+        return;
+
+    memset( &pers, 0, sizeof( pers ) );
+    pers.pid = (long) getpid();
+    pers.ppid = (long) getppid();
+    (void) clock_gettime( CLOCK_MONOTONIC, &pers.mono );
+    (void) clock_gettime( CLOCK_REALTIME, &pers.real );
+
+    mbedtls_hmac_drbg_update( ctx, (const unsigned char *) &pers, sizeof( pers ) );
+
+    /* Only this request relies on the mix, the next one reseeds */
+    if( ctx->reseed_counter < ctx->reseed_interval )
+        ctx->reseed_counter = ctx->reseed_interval;
+    ctx->pid = pers.pid;
+
+    mbedtls_zeroize( &pers, sizeof( pers ) );
+}
+#endif /* MBEDTLS_DRBG_FORK_SAFETY */
+
 /*
  * HMAC_DRBG reseeding: 10.1.2.4 (arabic) + 9.2 (Roman)
  */
@@ -157,6 +279,10 @@ int mbedtls_hmac_drbg_reseed( mbedtls_hmac_drbg_context *ctx,
     /* 3. Reset reseed_counter */
     ctx->reseed_counter = 1;
 
+#if defined(MBEDTLS_DRBG_FORK_SAFETY)
+    ctx->pid = (long) getpid();
+#endif
+
     /* 4. Done */
     return( 0 );
 }
@@ -174,17 +300,15 @@ int mbedtls_hmac_drbg_seed( mbedtls_hmac_drbg_context *ctx,
     int ret;
     size_t entropy_len, md_size;
 
-    if( ( ret = mbedtls_md_setup( &ctx->md_ctx, md_info, 1 ) ) != 0 )
+    if( ( ret = hmac_drbg_setup( ctx, md_info ) ) != 0 )
         return( ret );
 
     md_size = mbedtls_md_get_size( md_info );
 
     /*
-     * Set initial working state.
-     * Use the V memory location, which is currently all 0, to initialize the
-     * MD context with an all-zero key. Then set V to its initial value.
+     * Set initial working state: all-zero key, V = 0x01 0x01 ... 0x01
      */
-    mbedtls_md_hmac_starts( &ctx->md_ctx, ctx->V, md_size );
+    hmac_drbg_set_key( ctx, NULL, 0 );
     memset( ctx->V, 0x01, md_size );
 
     ctx->f_entropy = f_entropy;
@@ -264,6 +388,12 @@ int mbedtls_hmac_drbg_random_with_add( void *p_rng,
     if( add_len > MBEDTLS_HMAC_DRBG_MAX_INPUT )
         return( MBEDTLS_ERR_HMAC_DRBG_INPUT_TOO_BIG );
 
+#if defined(MBEDTLS_DRBG_FORK_SAFETY)
+    /* Deterministic (no-reseeding) instances must not diverge */
+    if( ctx->f_entropy != NULL )
+        hmac_drbg_fork_check( ctx );
+#endif
+
     /* 1. (aka VII and IX) Check reseed counter and PR */
     if( ctx->f_entropy != NULL && /* For no-reseeding instances */
         ( ctx->prediction_resistance == MBEDTLS_HMAC_DRBG_PR_ON ||
@@ -284,9 +414,7 @@ int mbedtls_hmac_drbg_random_with_add( void *p_rng,
     {
         size_t use_len = left > md_len ? md_len : left;
 
-        mbedtls_md_hmac_reset( &ctx->md_ctx );
-        mbedtls_md_hmac_update( &ctx->md_ctx, ctx->V, md_len );
-        mbedtls_md_hmac_finish( &ctx->md_ctx, ctx->V );
+        hmac_drbg_hmac( ctx, NULL, NULL, 0, ctx->V );
 
         memcpy( out, ctx->V, use_len );
         out += use_len;
@@ -338,6 +466,8 @@ void mbedtls_hmac_drbg_free( mbedtls_hmac_drbg_context *ctx )
     mbedtls_mutex_free( &ctx->mutex );
 #endif
     mbedtls_md_free( &ctx->md_ctx );
+    mbedtls_md_free( &ctx->ipad_ctx );
+    mbedtls_md_free( &ctx->opad_ctx );
     mbedtls_zeroize( ctx, sizeof( mbedtls_hmac_drbg_context ) );
 }
 
@@ -434,6 +434,10 @@ static const oid_pk_alg_t oid_pk_alg[] =
         { ADD_LEN( MBEDTLS_OID_EC_ALG_ECDH ),          "id-ecDH",          "EC key for ECDH" },
         MBEDTLS_PK_ECKEY_DH,
     },
+    {
+        { ADD_LEN( MBEDTLS_OID_ED25519 ),               "id-Ed25519",       "Ed25519 key" },
+        MBEDTLS_PK_ED25519,
+    },
     {
         { NULL, 0, NULL, NULL },
         MBEDTLS_PK_NONE,
@@ -42,6 +42,9 @@
 #if defined(MBEDTLS_ECDSA_C)
 #include "mbedtls/ecdsa.h"
 #endif
+#if defined(MBEDTLS_ED25519_C)
+#include "mbedtls/ed25519.h"
+#endif
 #if defined(MBEDTLS_PEM_PARSE_C)
 #include "mbedtls/pem.h"
 #endif
@@ -501,6 +504,28 @@ static int pk_get_ecpubkey( unsigned char **p, const unsigned char *end,
 }
 #endif /* MBEDTLS_ECP_C */
 
+#if defined(MBEDTLS_ED25519_C)
+/*
+ * Ed25519 public key (RFC 8410): the 32-byte encoding is the whole content
+ * of the subjectPublicKey BIT STRING
+ */
+static int pk_get_ed25519pubkey( unsigned char **p, const unsigned char *end,
+                                 mbedtls_ed25519_context *ed )
+{
+    int ret;
+
+    if( end - *p != MBEDTLS_ED25519_KEY_SIZE )
+        return( MBEDTLS_ERR_PK_INVALID_PUBKEY +
+                MBEDTLS_ERR_ASN1_INVALID_LENGTH );
+
+    ret = mbedtls_ed25519_set_public( ed, *p );
+
+    *p = (unsigned char *) end;
+
+    return( ret );
+}
+#endif /* MBEDTLS_ED25519_C */
+
 #if defined(MBEDTLS_RSA_C)
 /*
  *  RSAPublicKey ::= SEQUENCE {
@@ -588,6 +613,15 @@ static int pk_get_pk_alg( unsigned char **p,
         return( MBEDTLS_ERR_PK_INVALID_ALG );
     }
 
+    /*
+     * Parameters must be absent with Ed25519 (RFC 8410)
+     */
+    if( *pk_alg == MBEDTLS_PK_ED25519 &&
+            ( params->tag != 0 || params->len != 0 ) )
+    {
+        return( MBEDTLS_ERR_PK_INVALID_ALG );
+    }
+
     return( 0 );
 }
 
@@ -643,6 +677,12 @@ int mbedtls_pk_parse_subpubkey( unsigned char **p, const unsigned char *end,
             ret = pk_get_ecpubkey( p, end, mbedtls_pk_ec( *pk ) );
     } else
 #endif /* MBEDTLS_ECP_C */
+#if defined(MBEDTLS_ED25519_C)
+    if( pk_alg == MBEDTLS_PK_ED25519 )
+    {
+        ret = pk_get_ed25519pubkey( p, end, mbedtls_pk_ed25519( *pk ) );
+    } else
+#endif /* MBEDTLS_ED25519_C */
         ret = MBEDTLS_ERR_PK_UNKNOWN_PK_ALG;
 
     if( ret == 0 && *p != end )
@@ -908,6 +948,37 @@ static int pk_parse_key_sec1_der( mbedtls_ecp_keypair *eck,
 }
 #endif /* MBEDTLS_ECP_C */
 
+#if defined(MBEDTLS_ED25519_C)
+/*
+ * Parse an Ed25519 private key (RFC 8410)
+ *
+ *    CurvePrivateKey ::= OCTET STRING
+ */
+static int pk_parse_key_ed25519_der( mbedtls_ed25519_context *ed,
+                                     const unsigned char *key,
+                                     size_t keylen )
+{
+    int ret;
+    size_t len;
+    unsigned char *p = (unsigned char *) key;
+    unsigned char *end = p + keylen;
+
+    if( ( ret = mbedtls_asn1_get_tag( &p, end, &len,
+                                      MBEDTLS_ASN1_OCTET_STRING ) ) != 0 )
+        return( MBEDTLS_ERR_PK_KEY_INVALID_FORMAT + ret );
+
+    if( p + len != end )
+        return( MBEDTLS_ERR_PK_KEY_INVALID_FORMAT +
+                MBEDTLS_ERR_ASN1_LENGTH_MISMATCH );
+
+    if( len != MBEDTLS_ED25519_KEY_SIZE )
+        return( MBEDTLS_ERR_PK_KEY_INVALID_FORMAT +
+                MBEDTLS_ERR_ASN1_INVALID_LENGTH );
+
+    return( mbedtls_ed25519_set_private( ed, p ) );
+}
+#endif /* MBEDTLS_ED25519_C */
+
 /*
  * Parse an unencrypted PKCS#8 encoded private key
  *
@@ -948,6 +1019,7 @@ static int pk_parse_key_pkcs8_unencrypted_der(
      *    PrivateKey ::= OCTET STRING
      *
      *  The PrivateKey OCTET STRING is a SEC1 ECPrivateKey
+     *  (or, for Ed25519, a CurvePrivateKey from RFC 8410)
      */
 
     if( ( ret = mbedtls_asn1_get_tag( &p, end, &len,
@@ -1001,6 +1073,17 @@ static int pk_parse_key_pkcs8_unencrypted_der(
         }
     } else
 #endif /* MBEDTLS_ECP_C */
+#if defined(MBEDTLS_ED25519_C)
+    if( pk_alg == MBEDTLS_PK_ED25519 )
+    {
+        if( ( ret = pk_parse_key_ed25519_der( mbedtls_pk_ed25519( *pk ),
+                                              p, len ) ) != 0 )
+        {
+            mbedtls_pk_free( pk );
+            return( ret );
+        }
+    } else
+#endif /* MBEDTLS_ED25519_C */
         return( MBEDTLS_ERR_PK_UNKNOWN_PK_ALG );
 
     return( 0 );
@@ -654,6 +654,18 @@ int mbedtls_rsa_check_pub_priv( const mbedtls_rsa_context *pub,
     return( 0 );
 }
 
+/*
+ * Set up the cached reduction constants for M, on first use or if the key
+ * has changed since. Called with the context locked.
+ */
+static int rsa_mod_check( mbedtls_mpi_mod_ctx *mod, const mbedtls_mpi *M )
+{
+    if( mbedtls_mpi_cmp_mpi( &mod->N, M ) == 0 )
+        return( 0 );
+
+    return( mbedtls_mpi_mod_setup( mod, M ) );
+}
+
 /*
  * Do an RSA public key operation
  */
@@ -684,7 +696,8 @@ int mbedtls_rsa_public( mbedtls_rsa_context *ctx,
     }
 
     olen = ctx->len;
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &T, &T, &ctx->E, &ctx->N, &ctx->RN ) );
+    MBEDTLS_MPI_CHK( rsa_mod_check( &ctx->N_mod, &ctx->N ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_exp( &T, &T, &ctx->E, &ctx->N_mod ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_write_binary( &T, output, olen ) );
 
 cleanup:
@@ -716,25 +729,31 @@ static int rsa_prepare_blinding( mbedtls_rsa_context *ctx,
     {
         /* We already have blinding values, just update them by squaring */
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ctx->Vi, &ctx->Vi, &ctx->Vi ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &ctx->Vi, &ctx->Vi, &ctx->N ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_reduce( &ctx->Vi, &ctx->Vi, &ctx->N_mod ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &ctx->Vf, &ctx->Vf, &ctx->Vf ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &ctx->Vf, &ctx->Vf, &ctx->N ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_reduce( &ctx->Vf, &ctx->Vf, &ctx->N_mod ) );
 
         goto cleanup;
     }
 
-    /* Unblinding value: Vf = random number, invertible mod N */
+    /*
+     * Unblinding value: Vf = random number, invertible mod N.
+     * Invertibility is checked by the (constant-time) inversion itself
+     * rather than by a separate gcd computation.
+     */
     do {
         if( count++ > 10 )
             return( MBEDTLS_ERR_RSA_RNG_FAILED );
 
         MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( &ctx->Vf, ctx->len - 1, f_rng, p_rng ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_gcd( &ctx->Vi, &ctx->Vf, &ctx->N ) );
-    } while( mbedtls_mpi_cmp_int( &ctx->Vi, 1 ) != 0 );
+
+        ret = mbedtls_mpi_inv_mod_odd( &ctx->Vi, &ctx->Vf, &ctx->N );
+        if( ret != 0 && ret != MBEDTLS_ERR_MPI_NOT_ACCEPTABLE )
+            goto cleanup;
+    } while( ret != 0 );
 
     /* Blinding value: Vi =  Vf^(-e) mod N */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_inv_mod( &ctx->Vi, &ctx->Vf, &ctx->N ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &ctx->Vi, &ctx->Vi, &ctx->E, &ctx->N, &ctx->RN ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_exp( &ctx->Vi, &ctx->Vi, &ctx->E, &ctx->N_mod ) );
 
 
 cleanup:
@@ -809,6 +828,15 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
         return( ret );
 #endif
 
+    /*
+     * Reserve the temporaries up front: T and T1 end up holding products
+     * of two values the size of N, so size them for it once instead of
+     * letting them be regrown along the way.
+     */
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &T,  2 * ctx->N.n + 1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &T1, 2 * ctx->N.n + 1 ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_grow( &T2, ctx->N.n + 1 ) );
+
     MBEDTLS_MPI_CHK( mbedtls_mpi_read_binary( &T, input, ctx->len ) );
     if( mbedtls_mpi_cmp_mpi( &T, &ctx->N ) >= 0 )
     {
@@ -816,6 +844,12 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
         goto cleanup;
     }
 
+    MBEDTLS_MPI_CHK( rsa_mod_check( &ctx->N_mod, &ctx->N ) );
+#if !defined(MBEDTLS_RSA_NO_CRT)
+    MBEDTLS_MPI_CHK( rsa_mod_check( &ctx->P_mod, &ctx->P ) );
+    MBEDTLS_MPI_CHK( rsa_mod_check( &ctx->Q_mod, &ctx->Q ) );
+#endif
+
     if( f_rng != NULL )
     {
         /*
@@ -824,7 +858,7 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
          */
         MBEDTLS_MPI_CHK( rsa_prepare_blinding( ctx, f_rng, p_rng ) );
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T, &T, &ctx->Vi ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &T, &T, &ctx->N ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_reduce( &T, &T, &ctx->N_mod ) );
 
         /*
          * Exponent blinding
@@ -869,7 +903,7 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
     }
 
 #if defined(MBEDTLS_RSA_NO_CRT)
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &T, &T, D, &ctx->N, &ctx->RN ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_exp( &T, &T, D, &ctx->N_mod ) );
 #else
     /*
      * Faster decryption using the CRT
@@ -877,15 +911,15 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
      * T1 = input ^ dP mod P
      * T2 = input ^ dQ mod Q
      */
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &T1, &T, DP, &ctx->P, &ctx->RP ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_exp_mod( &T2, &T, DQ, &ctx->Q, &ctx->RQ ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_exp( &T1, &T, DP, &ctx->P_mod ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_exp( &T2, &T, DQ, &ctx->Q_mod ) );
 
     /*
      * T = (T1 - T2) * (Q^-1 mod P) mod P
      */
     MBEDTLS_MPI_CHK( mbedtls_mpi_sub_mpi( &T, &T1, &T2 ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T1, &T, &ctx->QP ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &T, &T1, &ctx->P ) );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_mod_reduce( &T, &T1, &ctx->P_mod ) );
 
     /*
      * T = T2 + T * Q
@@ -901,7 +935,7 @@ int mbedtls_rsa_private( mbedtls_rsa_context *ctx,
          * T = T * Vf mod N
          */
         MBEDTLS_MPI_CHK( mbedtls_mpi_mul_mpi( &T, &T, &ctx->Vf ) );
-        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_mpi( &T, &T, &ctx->N ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_mod_reduce( &T, &T, &ctx->N_mod ) );
     }
 
     olen = ctx->len;
@@ -2033,11 +2067,9 @@ int mbedtls_rsa_copy( mbedtls_rsa_context *dst, const mbedtls_rsa_context *src )
     MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &dst->DP, &src->DP ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &dst->DQ, &src->DQ ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &dst->QP, &src->QP ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &dst->RP, &src->RP ) );
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &dst->RQ, &src->RQ ) );
 #endif
 
-    MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &dst->RN, &src->RN ) );
+    /* The reduction constants are set up again in dst on first use */
 
     MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &dst->Vi, &src->Vi ) );
     MBEDTLS_MPI_CHK( mbedtls_mpi_copy( &dst->Vf, &src->Vf ) );
@@ -2058,12 +2090,12 @@ cleanup:
 void mbedtls_rsa_free( mbedtls_rsa_context *ctx )
 {
     mbedtls_mpi_free( &ctx->Vi ); mbedtls_mpi_free( &ctx->Vf );
-    mbedtls_mpi_free( &ctx->RN ); mbedtls_mpi_free( &ctx->D  );
+    mbedtls_mpi_mod_free( &ctx->N_mod ); mbedtls_mpi_free( &ctx->D  );
     mbedtls_mpi_free( &ctx->Q  ); mbedtls_mpi_free( &ctx->P  );
     mbedtls_mpi_free( &ctx->E  ); mbedtls_mpi_free( &ctx->N  );
 
 #if !defined(MBEDTLS_RSA_NO_CRT)
-    mbedtls_mpi_free( &ctx->RQ ); mbedtls_mpi_free( &ctx->RP );
+    mbedtls_mpi_mod_free( &ctx->Q_mod ); mbedtls_mpi_mod_free( &ctx->P_mod );
     mbedtls_mpi_free( &ctx->QP ); mbedtls_mpi_free( &ctx->DQ );
     mbedtls_mpi_free( &ctx->DP );
 #endif /* MBEDTLS_RSA_NO_CRT */
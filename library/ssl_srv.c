@@ -2826,6 +2826,60 @@ static int ssl_get_ecdh_params_from_cert( mbedtls_ssl_context *ssl )
 #endif /* MBEDTLS_KEY_EXCHANGE_ECDH_RSA_ENABLED) ||
           MBEDTLS_KEY_EXCHANGE_ECDH_ECDSA_ENABLED */
 
+#if defined(MBEDTLS_ECP_POOL_C) && \
+    defined(MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED)
+/*
+ * Sign the ServerKeyExchange using an ECDSA nonce from the configured pool.
+ * Returns 0 if done, non-zero if the caller should sign as usual.
+ */
+static int ssl_sign_with_pool_nonce( mbedtls_ssl_context *ssl,
+                                     mbedtls_md_type_t md_alg,
+                                     const unsigned char *hash, size_t hashlen,
+                                     unsigned char *sig, size_t *sig_len )
+{
+    int ret;
+    mbedtls_pk_context *own_key = mbedtls_ssl_own_key( ssl );
+    mbedtls_ecdsa_context *ecdsa;
+    mbedtls_mpi k_inv, r;
+
+    if( ssl->conf->ecp_pool == NULL ||
+        ( mbedtls_pk_get_type( own_key ) != MBEDTLS_PK_ECKEY &&
+          mbedtls_pk_get_type( own_key ) != MBEDTLS_PK_ECDSA ) )
+    {
+        return( -1 );
+    }
+
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+    /* Don't abandon a signature started on a previous call */
+    if( ssl->handshake->ecrs_ctx.pk_info != NULL )
+        return( -1 );
+#endif
+
+    if( hashlen == 0 )
+        hashlen = mbedtls_md_get_size( mbedtls_md_info_from_type( md_alg ) );
+
+    ecdsa = mbedtls_pk_ec( *own_key );
+
+    mbedtls_mpi_init( &k_inv );
+    mbedtls_mpi_init( &r );
+
+    ret = mbedtls_ecp_pool_take_nonce( ssl->conf->ecp_pool, ecdsa->grp.id,
+                                       &k_inv, &r );
+    if( ret == 0 )
+        ret = mbedtls_ecdsa_write_signature_with_nonce( ecdsa, hash, hashlen,
+                                                        &k_inv, &r,
+                                                        sig, sig_len );
+
+    if( ret == 0 )
+        MBEDTLS_SSL_DEBUG_MSG( 3, ( "ECDSA nonce taken from pool" ) );
+
+    mbedtls_mpi_free( &k_inv );
+    mbedtls_mpi_free( &r );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECP_POOL_C && MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED */
+
 static int ssl_write_server_key_exchange( mbedtls_ssl_context *ssl )
 {
     int ret;
@@ -2983,6 +3037,21 @@ static int ssl_write_server_key_exchange( mbedtls_ssl_context *ssl )
          */
         const mbedtls_ecp_curve_info **curve = NULL;
         const mbedtls_ecp_group_id *gid;
+#if defined(MBEDTLS_ECP_POOL_C)
+        int key_from_pool = 0;
+#endif
+
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+        /* Resume an operation started on a previous call */
+        if( ssl->handshake->ecrs_state == ssl_ecrs_ske_sign )
+        {
+            len = ssl->handshake->ecrs_n;
+            goto ecdh_params_written;
+        }
+
+        if( ssl->handshake->ecrs_state == ssl_ecrs_ske_ecdh_make_params )
+            goto ecdh_make_params;
+#endif /* MBEDTLS_SSL__ECP_RESTARTABLE */
 
         /* Match our preference list against the offered curves */
         for( gid = ssl->conf->curve_list; *gid != MBEDTLS_ECP_DP_NONE; gid++ )
@@ -3006,14 +3075,59 @@ curve_matching_done:
             return( ret );
         }
 
-        if( ( ret = mbedtls_ecdh_make_params( &ssl->handshake->ecdh_ctx, &len,
+#if defined(MBEDTLS_ECP_POOL_C)
+        if( ssl->conf->ecp_pool != NULL &&
+            mbedtls_ecp_pool_take_keypair( ssl->conf->ecp_pool,
+                                           (*curve)->grp_id,
+                                           &ssl->handshake->ecdh_ctx.d,
+                                           &ssl->handshake->ecdh_ctx.Q ) == 0 )
+        {
+            MBEDTLS_SSL_DEBUG_MSG( 3, ( "ECDHE key taken from pool" ) );
+            key_from_pool = 1;
+        }
+#endif
+
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+        /* With ECDHE-PSK, the second ECDH step is done while deriving the
+         * premaster secret, which does not support restarting */
+        if( ssl->handshake->ecrs_enabled &&
+            mbedtls_ssl_ciphersuite_uses_server_signature( ciphersuite_info ) )
+        {
+            mbedtls_ecdh_enable_restart( &ssl->handshake->ecdh_ctx );
+            ssl->handshake->ecrs_state = ssl_ecrs_ske_ecdh_make_params;
+        }
+
+ecdh_make_params:
+#endif /* MBEDTLS_SSL__ECP_RESTARTABLE */
+#if defined(MBEDTLS_ECP_POOL_C)
+        if( key_from_pool )
+            ret = mbedtls_ecdh_write_params( &ssl->handshake->ecdh_ctx, &len,
+                                      p, MBEDTLS_SSL_MAX_CONTENT_LEN - n );
+        else
+#endif
+            ret = mbedtls_ecdh_make_params( &ssl->handshake->ecdh_ctx, &len,
                                       p, MBEDTLS_SSL_MAX_CONTENT_LEN - n,
-                                      ssl->conf->f_rng, ssl->conf->p_rng ) ) != 0 )
+                                      ssl->conf->f_rng, ssl->conf->p_rng );
+        if( ret != 0 )
         {
             MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ecdh_make_params", ret );
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+            if( ret == MBEDTLS_ERR_ECP_IN_PROGRESS )
+                ret = MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS;
+#endif
             return( ret );
         }
 
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+        if( ssl->handshake->ecrs_state == ssl_ecrs_ske_ecdh_make_params )
+        {
+            ssl->handshake->ecrs_n = len;
+            ssl->handshake->ecrs_state = ssl_ecrs_ske_sign;
+        }
+
+ecdh_params_written:
+#endif /* MBEDTLS_SSL__ECP_RESTARTABLE */
+
 #if defined(MBEDTLS_KEY_EXCHANGE__WITH_SERVER_SIGNATURE__ENABLED)
         dig_signed     = p;
         dig_signed_len = len;
@@ -3038,6 +3152,7 @@ curve_matching_done:
         size_t signature_len = 0;
         unsigned int hashlen = 0;
         unsigned char hash[64];
+        mbedtls_pk_restart_ctx *rs_ctx = NULL;
 
         /*
          * 3.1: Choose hash algorithm:
@@ -3208,10 +3323,28 @@ curve_matching_done:
         }
 #endif /* MBEDTLS_SSL_PROTO_TLS1_2 */
 
-        if( ( ret = mbedtls_pk_sign( mbedtls_ssl_own_key( ssl ), md_alg, hash, hashlen,
-                        p + 2 , &signature_len, ssl->conf->f_rng, ssl->conf->p_rng ) ) != 0 )
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+        if( ssl->handshake->ecrs_state == ssl_ecrs_ske_sign )
+            rs_ctx = &ssl->handshake->ecrs_ctx;
+#endif
+
+#if defined(MBEDTLS_ECP_POOL_C) && \
+    defined(MBEDTLS_KEY_EXCHANGE_ECDHE_ECDSA_ENABLED)
+        if( ssl_sign_with_pool_nonce( ssl, md_alg, hash, hashlen,
+                                      p + 2, &signature_len ) == 0 )
+            ret = 0;
+        else
+#endif
+            ret = mbedtls_pk_sign_restartable( mbedtls_ssl_own_key( ssl ),
+                        md_alg, hash, hashlen, p + 2 , &signature_len,
+                        ssl->conf->f_rng, ssl->conf->p_rng, rs_ctx );
+        if( ret != 0 )
         {
             MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_pk_sign", ret );
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+            if( ret == MBEDTLS_ERR_ECP_IN_PROGRESS )
+                ret = MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS;
+#endif
             return( ret );
         }
 
@@ -3225,6 +3358,10 @@ curve_matching_done:
     }
 #endif /* MBEDTLS_KEY_EXCHANGE__WITH_SERVER_SIGNATURE__ENABLED */
 
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+    ssl->handshake->ecrs_state = ssl_ecrs_none;
+#endif
+
     /* Done with actual work; add header and send. */
 
     ssl->out_msglen  = 4 + n;
@@ -3488,6 +3625,12 @@ static int ssl_parse_client_key_exchange( mbedtls_ssl_context *ssl )
 
     MBEDTLS_SSL_DEBUG_MSG( 2, ( "=> parse client key exchange" ) );
 
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+    /* The message was read and parsed on a previous call */
+    if( ssl->handshake->ecrs_state == ssl_ecrs_cke_ecdh_calc_secret )
+        goto ecdh_calc_secret;
+#endif
+
     if( ( ret = mbedtls_ssl_read_record( ssl ) ) != 0 )
     {
         MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ssl_read_record", ret );
@@ -3556,6 +3699,15 @@ static int ssl_parse_client_key_exchange( mbedtls_ssl_context *ssl )
 
         MBEDTLS_SSL_DEBUG_ECP( 3, "ECDH: Qp ", &ssl->handshake->ecdh_ctx.Qp );
 
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+        if( ssl->handshake->ecrs_enabled )
+        {
+            mbedtls_ecdh_enable_restart( &ssl->handshake->ecdh_ctx );
+            ssl->handshake->ecrs_state = ssl_ecrs_cke_ecdh_calc_secret;
+        }
+
+ecdh_calc_secret:
+#endif /* MBEDTLS_SSL__ECP_RESTARTABLE */
         if( ( ret = mbedtls_ecdh_calc_secret( &ssl->handshake->ecdh_ctx,
                                       &ssl->handshake->pmslen,
                                        ssl->handshake->premaster,
@@ -3563,9 +3715,17 @@ static int ssl_parse_client_key_exchange( mbedtls_ssl_context *ssl )
                                        ssl->conf->f_rng, ssl->conf->p_rng ) ) != 0 )
         {
             MBEDTLS_SSL_DEBUG_RET( 1, "mbedtls_ecdh_calc_secret", ret );
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+            if( ret == MBEDTLS_ERR_ECP_IN_PROGRESS )
+                return( MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS );
+#endif
             return( MBEDTLS_ERR_SSL_BAD_HS_CLIENT_KEY_EXCHANGE_CS );
         }
 
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+        ssl->handshake->ecrs_state = ssl_ecrs_none;
+#endif
+
         MBEDTLS_SSL_DEBUG_MPI( 3, "ECDH: z  ", &ssl->handshake->ecdh_ctx.z );
     }
     else
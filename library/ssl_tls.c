@@ -5471,6 +5471,10 @@ static void ssl_handshake_params_init( mbedtls_ssl_handshake_params *handshake )
 #if defined(MBEDTLS_ECDH_C)
     mbedtls_ecdh_init( &handshake->ecdh_ctx );
 #endif
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+    mbedtls_pk_restart_init( &handshake->ecrs_ctx );
+    handshake->ecrs_enabled = mbedtls_ecp_restart_is_enabled();
+#endif
 #if defined(MBEDTLS_KEY_EXCHANGE_ECJPAKE_ENABLED)
     mbedtls_ecjpake_init( &handshake->ecjpake_ctx );
 #if defined(MBEDTLS_SSL_CLI_C)
@@ -6179,6 +6183,17 @@ void mbedtls_ssl_conf_curves( mbedtls_ssl_config *conf,
 }
 #endif /* MBEDTLS_ECP_C */
 
+#if defined(MBEDTLS_ECP_POOL_C) && defined(MBEDTLS_SSL_SRV_C)
+/*
+ * Set the pool of precomputed ECDHE keys and ECDSA nonces
+ */
+void mbedtls_ssl_conf_ecp_pool( mbedtls_ssl_config *conf,
+                                mbedtls_ecp_pool_context *pool )
+{
+    conf->ecp_pool = pool;
+}
+#endif /* MBEDTLS_ECP_POOL_C && MBEDTLS_SSL_SRV_C */
+
 #if defined(MBEDTLS_X509_CRT_PARSE_C)
 int mbedtls_ssl_set_hostname( mbedtls_ssl_context *ssl, const char *hostname )
 {
@@ -7288,6 +7303,9 @@ void mbedtls_ssl_handshake_free( mbedtls_ssl_handshake_params *handshake )
 #if defined(MBEDTLS_ECDH_C)
     mbedtls_ecdh_free( &handshake->ecdh_ctx );
 #endif
+#if defined(MBEDTLS_SSL__ECP_RESTARTABLE)
+    mbedtls_pk_restart_free( &handshake->ecrs_ctx );
+#endif
 #if defined(MBEDTLS_KEY_EXCHANGE_ECJPAKE_ENABLED)
     mbedtls_ecjpake_free( &handshake->ecjpake_ctx );
 #if defined(MBEDTLS_SSL_CLI_C)
@@ -300,9 +300,30 @@ static const char *features[] = {
 #if defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED)
     "MBEDTLS_ECP_DP_CURVE25519_ENABLED",
 #endif /* MBEDTLS_ECP_DP_CURVE25519_ENABLED */
+#if defined(MBEDTLS_ECP_DP_CURVE448_ENABLED)
+    "MBEDTLS_ECP_DP_CURVE448_ENABLED",
+#endif /* MBEDTLS_ECP_DP_CURVE448_ENABLED */
 #if defined(MBEDTLS_ECP_NIST_OPTIM)
     "MBEDTLS_ECP_NIST_OPTIM",
 #endif /* MBEDTLS_ECP_NIST_OPTIM */
+#if defined(MBEDTLS_ECP_P256_FAST)
+    "MBEDTLS_ECP_P256_FAST",
+#endif /* MBEDTLS_ECP_P256_FAST */
+#if defined(MBEDTLS_ECP_P384_FAST)
+    "MBEDTLS_ECP_P384_FAST",
+#endif /* MBEDTLS_ECP_P384_FAST */
+#if defined(MBEDTLS_ECP_X25519_FAST)
+    "MBEDTLS_ECP_X25519_FAST",
+#endif /* MBEDTLS_ECP_X25519_FAST */
+#if defined(MBEDTLS_ECP_X448_FAST)
+    "MBEDTLS_ECP_X448_FAST",
+#endif /* MBEDTLS_ECP_X448_FAST */
+#if defined(MBEDTLS_ECP_SECP256K1_GLV)
+    "MBEDTLS_ECP_SECP256K1_GLV",
+#endif /* MBEDTLS_ECP_SECP256K1_GLV */
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    "MBEDTLS_ECP_RESTARTABLE",
+#endif /* MBEDTLS_ECP_RESTARTABLE */
 #if defined(MBEDTLS_ECDSA_DETERMINISTIC)
     "MBEDTLS_ECDSA_DETERMINISTIC",
 #endif /* MBEDTLS_ECDSA_DETERMINISTIC */
@@ -348,6 +369,9 @@ static const char *features[] = {
 #if defined(MBEDTLS_GENPRIME)
     "MBEDTLS_GENPRIME",
 #endif /* MBEDTLS_GENPRIME */
+#if defined(MBEDTLS_MPI_MONTMUL_UNROLLED)
+    "MBEDTLS_MPI_MONTMUL_UNROLLED",
+#endif /* MBEDTLS_MPI_MONTMUL_UNROLLED */
 #if defined(MBEDTLS_FS_IO)
     "MBEDTLS_FS_IO",
 #endif /* MBEDTLS_FS_IO */
@@ -363,6 +387,9 @@ static const char *features[] = {
 #if defined(MBEDTLS_ENTROPY_NV_SEED)
     "MBEDTLS_ENTROPY_NV_SEED",
 #endif /* MBEDTLS_ENTROPY_NV_SEED */
+#if defined(MBEDTLS_DRBG_FORK_SAFETY)
+    "MBEDTLS_DRBG_FORK_SAFETY",
+#endif /* MBEDTLS_DRBG_FORK_SAFETY */
 #if defined(MBEDTLS_MEMORY_DEBUG)
     "MBEDTLS_MEMORY_DEBUG",
 #endif /* MBEDTLS_MEMORY_DEBUG */
@@ -552,6 +579,12 @@ static const char *features[] = {
 #if defined(MBEDTLS_ECP_C)
     "MBEDTLS_ECP_C",
 #endif /* MBEDTLS_ECP_C */
+#if defined(MBEDTLS_ECP_POOL_C)
+    "MBEDTLS_ECP_POOL_C",
+#endif /* MBEDTLS_ECP_POOL_C */
+#if defined(MBEDTLS_ED25519_C)
+    "MBEDTLS_ED25519_C",
+#endif /* MBEDTLS_ED25519_C */
 #if defined(MBEDTLS_ENTROPY_C)
     "MBEDTLS_ENTROPY_C",
 #endif /* MBEDTLS_ENTROPY_C */
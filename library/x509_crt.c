@@ -2332,6 +2332,26 @@ exit:
     return( 0 );
 }
 
+/*
+ * Pre-compute data for the keys of a certificate chain
+ */
+int mbedtls_x509_crt_precompute( mbedtls_x509_crt *chain )
+{
+    int ret;
+    mbedtls_x509_crt *cur;
+
+    for( cur = chain; cur != NULL; cur = cur->next )
+    {
+        if( cur->version == 0 )
+            continue;
+
+        if( ( ret = mbedtls_pk_precompute( &cur->pk ) ) != 0 )
+            return( ret );
+    }
+
+    return( 0 );
+}
+
 /*
  * Initialize a certificate chain
  */
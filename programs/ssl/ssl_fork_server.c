@@ -249,6 +249,7 @@ int main( void )
         {
             mbedtls_printf( " ok\n" );
 
+#if !defined(MBEDTLS_DRBG_FORK_SAFETY)
             if( ( ret = mbedtls_ctr_drbg_reseed( &ctr_drbg,
                                          (const unsigned char *) "parent",
                                          6 ) ) != 0 )
@@ -256,6 +257,7 @@ int main( void )
                 mbedtls_printf( " failed!  mbedtls_ctr_drbg_reseed returned %d\n\n", ret );
                 goto exit;
             }
+#endif
 
             continue;
         }
@@ -270,6 +272,13 @@ int main( void )
         mbedtls_printf( "pid %d: Setting up the SSL data.\n", pid );
         fflush( stdout );
 
+        /*
+         * With MBEDTLS_DRBG_FORK_SAFETY, the DRBG notices by itself that it
+         * is running in a new process and forks off its own state, then
+         * reseeds through the entropy source on its second request, so no
+         * explicit reseed is needed here.
+         */
+#if !defined(MBEDTLS_DRBG_FORK_SAFETY)
         if( ( ret = mbedtls_ctr_drbg_reseed( &ctr_drbg,
                                      (const unsigned char *) "child",
                                      5 ) ) != 0 )
@@ -279,6 +288,7 @@ int main( void )
                     pid, ret );
             goto exit;
         }
+#endif
 
         if( ( ret = mbedtls_ssl_setup( &ssl, &conf ) ) != 0 )
         {
@@ -135,6 +135,8 @@ int main( void )
 #define DFL_SNI                 NULL
 #define DFL_ALPN_STRING         NULL
 #define DFL_CURVES              NULL
+#define DFL_EC_MAX_OPS          -1
+#define DFL_ECP_POOL            0
 #define DFL_DHM_FILE            NULL
 #define DFL_TRANSPORT           MBEDTLS_SSL_TRANSPORT_STREAM
 #define DFL_COOKIES             1
@@ -323,6 +325,22 @@ int main( void )
 #define USAGE_CURVES ""
 #endif
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+#define USAGE_ECRESTART \
+    "    ec_max_ops=%%d       default: library default (restart disabled)\n"
+#else
+#define USAGE_ECRESTART ""
+#endif
+
+#if defined(MBEDTLS_ECP_POOL_C)
+#define USAGE_ECP_POOL \
+    "    ecp_pool=%%d         default: 0 (no pool)\n"                   \
+    "                        size of the pool of ECDHE keys and ECDSA\n" \
+    "                        nonces, refilled between connections\n"
+#else
+#define USAGE_ECP_POOL ""
+#endif
+
 #define USAGE \
     "\n usage: ssl_server2 param=<>...\n"                   \
     "\n acceptable parameters:\n"                           \
@@ -360,6 +378,8 @@ int main( void )
     USAGE_EMS                                               \
     USAGE_ETM                                               \
     USAGE_CURVES                                            \
+    USAGE_ECRESTART                                         \
+    USAGE_ECP_POOL                                          \
     "\n"                                                    \
     "    arc4=%%d             default: (library default: 0)\n" \
     "    allow_sha1=%%d       default: 0\n"                             \
@@ -432,6 +452,8 @@ struct options
     int cache_timeout;          /* expiration delay of session cache entries */
     char *sni;                  /* string describing sni information        */
     const char *curves;         /* list of supported elliptic curves        */
+    int ec_max_ops;             /* EC restart: max number of basic ops      */
+    int ecp_pool;               /* size of the pool of precomputed values   */
     const char *alpn_string;    /* ALPN supported protocols                 */
     const char *dhm_file;       /* the file with the DH parameters          */
     int extended_ms;            /* allow negotiation of extended MS?        */
@@ -522,6 +544,26 @@ static int get_auth_mode( const char *s )
             goto error;         \
     *p++ = '\0';
 
+#if defined(MBEDTLS_ECP_POOL_C)
+/*
+ * Add values of the given type and curve to the pool until there are target
+ * of them, as a real server would do when idle or from a separate thread.
+ */
+static int ecp_pool_top_up( mbedtls_ecp_pool_context *pool,
+                            mbedtls_ecp_pool_type type,
+                            mbedtls_ecp_group_id grp_id, size_t target,
+                            const mbedtls_ssl_config *conf )
+{
+    size_t have = mbedtls_ecp_pool_count( pool, type, grp_id );
+
+    if( grp_id == MBEDTLS_ECP_DP_NONE || have >= target )
+        return( 0 );
+
+    return( mbedtls_ecp_pool_fill( pool, type, grp_id, target - have,
+                                   conf->f_rng, conf->p_rng ) );
+}
+#endif /* MBEDTLS_ECP_POOL_C */
+
 #if defined(SNI_OPTION)
 typedef struct _sni_entry sni_entry;
 
@@ -885,6 +927,9 @@ int main( int argc, char *argv[] )
 #if defined(MBEDTLS_SSL_SESSION_TICKETS)
     mbedtls_ssl_ticket_context ticket_ctx;
 #endif
+#if defined(MBEDTLS_ECP_POOL_C)
+    mbedtls_ecp_pool_context ecp_pool;
+#endif
 #if defined(SNI_OPTION)
     sni_entry *sni_info = NULL;
 #endif
@@ -931,6 +976,9 @@ int main( int argc, char *argv[] )
 #if defined(MBEDTLS_SSL_SESSION_TICKETS)
     mbedtls_ssl_ticket_init( &ticket_ctx );
 #endif
+#if defined(MBEDTLS_ECP_POOL_C)
+    mbedtls_ecp_pool_init( &ecp_pool );
+#endif
 #if defined(MBEDTLS_SSL_ALPN)
     memset( (void *) alpn_list, 0, sizeof( alpn_list ) );
 #endif
@@ -1004,6 +1052,8 @@ int main( int argc, char *argv[] )
     opt.sni                 = DFL_SNI;
     opt.alpn_string         = DFL_ALPN_STRING;
     opt.curves              = DFL_CURVES;
+    opt.ec_max_ops          = DFL_EC_MAX_OPS;
+    opt.ecp_pool            = DFL_ECP_POOL;
     opt.dhm_file            = DFL_DHM_FILE;
     opt.transport           = DFL_TRANSPORT;
     opt.cookies             = DFL_COOKIES;
@@ -1084,6 +1134,14 @@ int main( int argc, char *argv[] )
         }
         else if( strcmp( p, "curves" ) == 0 )
             opt.curves = q;
+        else if( strcmp( p, "ec_max_ops" ) == 0 )
+            opt.ec_max_ops = atoi( q );
+        else if( strcmp( p, "ecp_pool" ) == 0 )
+        {
+            opt.ecp_pool = atoi( q );
+            if( opt.ecp_pool < 0 )
+                goto usage;
+        }
         else if( strcmp( p, "version_suites" ) == 0 )
             opt.version_suites = q;
         else if( strcmp( p, "renegotiation" ) == 0 )
@@ -1958,6 +2016,24 @@ int main( int argc, char *argv[] )
     }
 #endif
 
+#if defined(MBEDTLS_ECP_RESTARTABLE)
+    if( opt.ec_max_ops != DFL_EC_MAX_OPS )
+        mbedtls_ecp_set_max_ops( opt.ec_max_ops );
+#endif
+
+#if defined(MBEDTLS_ECP_POOL_C)
+    if( opt.ecp_pool != DFL_ECP_POOL )
+    {
+        if( ( ret = mbedtls_ecp_pool_setup( &ecp_pool, opt.ecp_pool ) ) != 0 )
+        {
+            mbedtls_printf( " failed\n  ! mbedtls_ecp_pool_setup returned -0x%x\n\n", -ret );
+            goto exit;
+        }
+
+        mbedtls_ssl_conf_ecp_pool( &conf, &ecp_pool );
+    }
+#endif
+
 #if defined(MBEDTLS_KEY_EXCHANGE__SOME__PSK_ENABLED)
     if( strlen( opt.psk ) != 0 && strlen( opt.psk_identity ) != 0 )
     {
@@ -2044,6 +2120,43 @@ reset:
 
     mbedtls_ssl_session_reset( &ssl );
 
+#if defined(MBEDTLS_ECP_POOL_C)
+    /*
+     * Refill the pool while no client is waiting: keypairs for our preferred
+     * ECDHE curve in one half, nonces for our ECDSA key(s) in the other
+     */
+    if( opt.ecp_pool != DFL_ECP_POOL )
+    {
+        mbedtls_printf( "  . Refilling the ECP pool..." );
+        fflush( stdout );
+
+        ret = ecp_pool_top_up( &ecp_pool, MBEDTLS_ECP_POOL_KEYPAIR,
+                               conf.curve_list[0], ( opt.ecp_pool + 1 ) / 2,
+                               &conf );
+#if defined(MBEDTLS_X509_CRT_PARSE_C) && defined(MBEDTLS_ECDSA_C)
+        if( ret == 0 && mbedtls_pk_can_do( &pkey, MBEDTLS_PK_ECDSA ) )
+            ret = ecp_pool_top_up( &ecp_pool, MBEDTLS_ECP_POOL_NONCE,
+                                   mbedtls_pk_ec( pkey )->grp.id,
+                                   opt.ecp_pool / 2, &conf );
+        if( ret == 0 && mbedtls_pk_can_do( &pkey2, MBEDTLS_PK_ECDSA ) )
+            ret = ecp_pool_top_up( &ecp_pool, MBEDTLS_ECP_POOL_NONCE,
+                                   mbedtls_pk_ec( pkey2 )->grp.id,
+                                   opt.ecp_pool / 2, &conf );
+#endif
+        if( ret != 0 )
+        {
+            mbedtls_printf( " failed\n  ! ecp_pool_top_up returned -0x%x\n\n", -ret );
+            goto exit;
+        }
+
+        mbedtls_printf( " ok (%u keys, %u nonces)\n",
+            (unsigned int) mbedtls_ecp_pool_count( &ecp_pool,
+                                MBEDTLS_ECP_POOL_KEYPAIR, MBEDTLS_ECP_DP_NONE ),
+            (unsigned int) mbedtls_ecp_pool_count( &ecp_pool,
+                                MBEDTLS_ECP_POOL_NONCE, MBEDTLS_ECP_DP_NONE ) );
+    }
+#endif
+
     /*
      * 3. Wait until a client connects
      */
@@ -2115,7 +2228,8 @@ handshake:
 
     do ret = mbedtls_ssl_handshake( &ssl );
     while( ret == MBEDTLS_ERR_SSL_WANT_READ ||
-           ret == MBEDTLS_ERR_SSL_WANT_WRITE );
+           ret == MBEDTLS_ERR_SSL_WANT_WRITE ||
+           ret == MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS );
 
     if( ret == MBEDTLS_ERR_SSL_HELLO_VERIFY_REQUIRED )
     {
@@ -2347,7 +2461,8 @@ data_exchange:
         while( ( ret = mbedtls_ssl_renegotiate( &ssl ) ) != 0 )
         {
             if( ret != MBEDTLS_ERR_SSL_WANT_READ &&
-                ret != MBEDTLS_ERR_SSL_WANT_WRITE )
+                ret != MBEDTLS_ERR_SSL_WANT_WRITE &&
+                ret != MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS )
             {
                 mbedtls_printf( " failed\n  ! mbedtls_ssl_renegotiate returned %d\n\n", ret );
                 goto reset;
@@ -2480,6 +2595,9 @@ exit:
 #if defined(MBEDTLS_SSL_SESSION_TICKETS)
     mbedtls_ssl_ticket_free( &ticket_ctx );
 #endif
+#if defined(MBEDTLS_ECP_POOL_C)
+    mbedtls_ecp_pool_free( &ecp_pool );
+#endif
 #if defined(MBEDTLS_SSL_COOKIE_C)
     mbedtls_ssl_cookie_free( &cookie_ctx );
 #endif
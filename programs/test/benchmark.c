@@ -65,16 +65,28 @@ int main( void )
 #include "mbedtls/havege.h"
 #include "mbedtls/ctr_drbg.h"
 #include "mbedtls/hmac_drbg.h"
+#include "mbedtls/entropy.h"
+#include "mbedtls/bignum.h"
 #include "mbedtls/rsa.h"
 #include "mbedtls/dhm.h"
 #include "mbedtls/ecdsa.h"
 #include "mbedtls/ecdh.h"
+#include "mbedtls/ed25519.h"
 #include "mbedtls/error.h"
 
 #if defined(MBEDTLS_MEMORY_BUFFER_ALLOC_C)
 #include "mbedtls/memory_buffer_alloc.h"
 #endif
 
+#if defined(MBEDTLS_CTR_DRBG_C) && defined(MBEDTLS_ENTROPY_C) && \
+    defined(MBEDTLS_DRBG_FORK_SAFETY)
+#define BENCHMARK_DRBG_FORK
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 /*
  * For heap usage estimates, we need an estimate of the overhead per allocated
  * block. ptmalloc2/3 (used in gnu libc for instance) uses 2 size_t per block,
@@ -82,6 +94,18 @@ int main( void )
  */
 #define MEM_BLOCK_OVERHEAD  ( 2 * sizeof( size_t ) )
 
+/*
+ * To count heap allocations per operation, we need to hook into the
+ * platform layer's calloc().
+ */
+#if defined(MBEDTLS_PLATFORM_MEMORY) &&             \
+    !defined(MBEDTLS_PLATFORM_CALLOC_MACRO) &&      \
+    !defined(MBEDTLS_PLATFORM_FREE_MACRO) &&        \
+    !defined(MBEDTLS_MEMORY_BUFFER_ALLOC_C)
+#define BENCHMARK_COUNT_ALLOCS
+#include <stdlib.h>
+#endif
+
 /*
  * Size to use for the alloc buffer if MEMORY_BUFFER_ALLOC_C is defined.
  */
@@ -89,14 +113,20 @@ int main( void )
 
 #define BUFSIZE         1024
 #define HEADER_FORMAT   "  %-24s :  "
-#define TITLE_LEN       25
+#define TITLE_LEN       32
+
+/* largest batch for ecdsa_batch, measured in steps of 4 from 1 */
+#define ECDSA_BATCH_MAX 64
+
+/* largest batch for ecdh_batch, measured in steps of 4 from 1 */
+#define ECDH_BATCH_MAX  256
 
 #define OPTIONS                                                         \
     "md4, md5, ripemd160, sha1, sha256, sha512,\n"                      \
     "arc4, des3, des, camellia, blowfish,\n"                            \
     "aes_cbc, aes_gcm, aes_ccm, aes_cmac, des3_cmac,\n"                 \
     "havege, ctr_drbg, hmac_drbg\n"                                     \
-    "rsa, dhm, ecdsa, ecdh.\n"
+    "mpi, rsa, dhm, ecdsa, ecdsa_batch, ecdh, ecdh_batch.\n"
 
 #if defined(MBEDTLS_ERROR_C)
 #define PRINT_ERROR                                                     \
@@ -161,10 +191,36 @@ do {                                                                    \
 #define MEMORY_MEASURE_PRINT( title_len )
 #endif
 
-#define TIME_PUBLIC( TITLE, TYPE, CODE )                                \
+#if defined(BENCHMARK_COUNT_ALLOCS)
+
+static unsigned long alloc_count;
+
+static void *counting_calloc( size_t n, size_t size )
+{
+    alloc_count++;
+    return( calloc( n, size ) );
+}
+
+#define ALLOC_COUNT_INIT                                                \
+    unsigned long prv_allocs = alloc_count;
+
+#define ALLOC_COUNT_PRINT                                               \
+    mbedtls_printf( "  %6lu allocs/op",                                  \
+                    ( alloc_count - prv_allocs ) / ( ii > 1 ? ii - 1 : 1 ) )
+
+#else
+#define ALLOC_COUNT_INIT
+#define ALLOC_COUNT_PRINT
+#endif /* BENCHMARK_COUNT_ALLOCS */
+
+/*
+ * Each run of CODE performs COUNT operations
+ */
+#define TIME_PUBLIC_BATCH( TITLE, TYPE, COUNT, CODE )                   \
 do {                                                                    \
     unsigned long ii;                                                   \
     int ret;                                                            \
+    ALLOC_COUNT_INIT                                                    \
     MEMORY_MEASURE_INIT;                                                \
                                                                         \
     mbedtls_printf( HEADER_FORMAT, TITLE );                             \
@@ -183,12 +239,16 @@ do {                                                                    \
     }                                                                   \
     else                                                                \
     {                                                                   \
-        mbedtls_printf( "%6lu " TYPE "/s", ii / 3 );                    \
+        mbedtls_printf( "%6lu " TYPE "/s", ii * ( COUNT ) / 3 );        \
         MEMORY_MEASURE_PRINT( sizeof( TYPE ) + 1 );                     \
+        ALLOC_COUNT_PRINT;                                              \
         mbedtls_printf( "\n" );                                         \
     }                                                                   \
 } while( 0 )
 
+#define TIME_PUBLIC( TITLE, TYPE, CODE )                                \
+    TIME_PUBLIC_BATCH( TITLE, TYPE, 1, CODE )
+
 static int myrand( void *rng_state, unsigned char *output, size_t len )
 {
     size_t use_len;
@@ -212,12 +272,49 @@ static int myrand( void *rng_state, unsigned char *output, size_t len )
     return( 0 );
 }
 
+#if defined(MBEDTLS_BIGNUM_C)
+/*
+ * Random MPI of exactly the given number of bits, built from chunks of at
+ * most MBEDTLS_MPI_MAX_SIZE bytes
+ */
+static int mpi_fill_bits( mbedtls_mpi *X, int bits )
+{
+    int ret, left;
+    size_t len;
+    mbedtls_mpi R;
+
+    mbedtls_mpi_init( &R );
+    MBEDTLS_MPI_CHK( mbedtls_mpi_lset( X, 0 ) );
+
+    for( left = bits; left > 0; left -= (int) len * 8 )
+    {
+        len = ( left + 7 ) / 8;
+        if( len > MBEDTLS_MPI_MAX_SIZE )
+            len = MBEDTLS_MPI_MAX_SIZE;
+
+        MBEDTLS_MPI_CHK( mbedtls_mpi_fill_random( &R, len, myrand, NULL ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_shift_l( X, len * 8 ) );
+        MBEDTLS_MPI_CHK( mbedtls_mpi_add_mpi( X, X, &R ) );
+    }
+
+    MBEDTLS_MPI_CHK( mbedtls_mpi_set_bit( X, bits - 1, 1 ) );
+
+cleanup:
+    mbedtls_mpi_free( &R );
+    return( ret );
+}
+#endif /* MBEDTLS_BIGNUM_C */
+
 /*
  * Clear some memory that was used to prepare the context
  */
 #if defined(MBEDTLS_ECP_C)
 void ecp_clear_precomputed( mbedtls_ecp_group *grp )
 {
+    /* Static tables (T_size == 0) are never computed at run time */
+    if( grp->T_size == 0 )
+        return;
+
     if( grp->T != NULL )
     {
         size_t i;
@@ -232,6 +329,64 @@ void ecp_clear_precomputed( mbedtls_ecp_group *grp )
 #define ecp_clear_precomputed( g )
 #endif
 
+#if defined(MBEDTLS_ECDSA_C) && defined(MBEDTLS_SHA256_C)
+/*
+ * Can ECDSA be done on this curve? Montgomery curves only do key exchange.
+ */
+static int ecdsa_curve_ok( mbedtls_ecp_group_id id )
+{
+    mbedtls_ecp_group grp;
+    int ok;
+
+    mbedtls_ecp_group_init( &grp );
+    ok = mbedtls_ecp_group_load( &grp, id ) == 0 &&
+         mbedtls_ecp_get_type( &grp ) == MBEDTLS_ECP_TYPE_SHORT_WEIERSTRASS;
+    mbedtls_ecp_group_free( &grp );
+
+    return( ok );
+}
+#endif
+
+#if defined(BENCHMARK_DRBG_FORK)
+/*
+ * Simulate the startup of a pre-fork server child: draw a ServerHello random
+ * and exit. With manual_reseed, do what ssl_fork_server does without fork
+ * detection: reseed from the entropy source in both the child and the parent.
+ */
+static int drbg_fork_child( mbedtls_ctr_drbg_context *ctr_drbg, int manual_reseed )
+{
+    pid_t pid;
+    int status;
+    unsigned char rnd[32];
+
+    if( ( pid = fork() ) < 0 )
+        return( -1 );
+
+    if( pid == 0 )
+    {
+        if( manual_reseed &&
+            mbedtls_ctr_drbg_reseed( ctr_drbg, (const unsigned char *) "child", 5 ) != 0 )
+        {
+            _exit( 1 );
+        }
+
+        _exit( mbedtls_ctr_drbg_random( ctr_drbg, rnd, sizeof( rnd ) ) != 0 );
+    }
+
+    while( waitpid( pid, &status, 0 ) != pid )
+        if( errno != EINTR )
+            return( -1 );
+
+    if( ! WIFEXITED( status ) || WEXITSTATUS( status ) != 0 )
+        return( -1 );
+
+    if( manual_reseed )
+        return( mbedtls_ctr_drbg_reseed( ctr_drbg, (const unsigned char *) "parent", 6 ) );
+
+    return( 0 );
+}
+#endif /* BENCHMARK_DRBG_FORK */
+
 unsigned char buf[BUFSIZE];
 
 typedef struct {
@@ -240,7 +395,7 @@ typedef struct {
          aes_cbc, aes_gcm, aes_ccm, aes_cmac, des3_cmac,
          camellia, blowfish,
          havege, ctr_drbg, hmac_drbg,
-         rsa, dhm, ecdsa, ecdh;
+         mpi, rsa, dhm, ecdsa, ecdsa_batch, ecdh, ecdh_batch;
 } todo_list;
 
 int main( int argc, char *argv[] )
@@ -301,14 +456,20 @@ int main( int argc, char *argv[] )
                 todo.ctr_drbg = 1;
             else if( strcmp( argv[i], "hmac_drbg" ) == 0 )
                 todo.hmac_drbg = 1;
+            else if( strcmp( argv[i], "mpi" ) == 0 )
+                todo.mpi = 1;
             else if( strcmp( argv[i], "rsa" ) == 0 )
                 todo.rsa = 1;
             else if( strcmp( argv[i], "dhm" ) == 0 )
                 todo.dhm = 1;
             else if( strcmp( argv[i], "ecdsa" ) == 0 )
                 todo.ecdsa = 1;
+            else if( strcmp( argv[i], "ecdsa_batch" ) == 0 )
+                todo.ecdsa_batch = 1;
             else if( strcmp( argv[i], "ecdh" ) == 0 )
                 todo.ecdh = 1;
+            else if( strcmp( argv[i], "ecdh_batch" ) == 0 )
+                todo.ecdh_batch = 1;
             else
             {
                 mbedtls_printf( "Unrecognized option: %s\n", argv[i] );
@@ -321,6 +482,9 @@ int main( int argc, char *argv[] )
 
 #if defined(MBEDTLS_MEMORY_BUFFER_ALLOC_C)
     mbedtls_memory_buffer_alloc_init( alloc_buf, sizeof( alloc_buf ) );
+#endif
+#if defined(BENCHMARK_COUNT_ALLOCS)
+    mbedtls_platform_set_calloc_free( counting_calloc, free );
 #endif
     memset( buf, 0xAA, sizeof( buf ) );
     memset( tmp, 0xBB, sizeof( tmp ) );
@@ -583,6 +747,27 @@ int main( int argc, char *argv[] )
                 if( mbedtls_ctr_drbg_random( &ctr_drbg, buf, BUFSIZE ) != 0 )
                 mbedtls_exit(1) );
         mbedtls_ctr_drbg_free( &ctr_drbg );
+
+#if defined(BENCHMARK_DRBG_FORK)
+        {
+            mbedtls_entropy_context entropy;
+
+            mbedtls_entropy_init( &entropy );
+            mbedtls_ctr_drbg_init( &ctr_drbg );
+
+            if( mbedtls_ctr_drbg_seed( &ctr_drbg, mbedtls_entropy_func, &entropy,
+                                       NULL, 0 ) != 0 )
+                mbedtls_exit(1);
+
+            TIME_PUBLIC( "CTR_DRBG fork (reseed)", "child",
+                    ret = drbg_fork_child( &ctr_drbg, 1 ) );
+            TIME_PUBLIC( "CTR_DRBG fork (auto)", "child",
+                    ret = drbg_fork_child( &ctr_drbg, 0 ) );
+
+            mbedtls_ctr_drbg_free( &ctr_drbg );
+            mbedtls_entropy_free( &entropy );
+        }
+#endif /* BENCHMARK_DRBG_FORK */
     }
 #endif
 
@@ -638,12 +823,39 @@ int main( int argc, char *argv[] )
     }
 #endif
 
+#if defined(MBEDTLS_BIGNUM_C)
+    if( todo.mpi )
+    {
+        int bits;
+        mbedtls_mpi A, B, X;
+
+        mbedtls_mpi_init( &A ); mbedtls_mpi_init( &B ); mbedtls_mpi_init( &X );
+
+        for( bits = 1024; bits <= 16384; bits *= 2 )
+        {
+            /* mbedtls_mpi_fill_random() is limited to MBEDTLS_MPI_MAX_SIZE */
+            if( mpi_fill_bits( &A, bits ) != 0 || mpi_fill_bits( &B, bits ) != 0 )
+                mbedtls_exit( 1 );
+
+            mbedtls_snprintf( title, sizeof( title ), "MPI-%d", bits );
+
+            TIME_PUBLIC( title, "mul",
+                    ret = mbedtls_mpi_mul_mpi( &X, &A, &B ) );
+
+            TIME_PUBLIC( title, "sqr",
+                    ret = mbedtls_mpi_mul_mpi( &X, &A, &A ) );
+        }
+
+        mbedtls_mpi_free( &A ); mbedtls_mpi_free( &B ); mbedtls_mpi_free( &X );
+    }
+#endif
+
 #if defined(MBEDTLS_RSA_C) && defined(MBEDTLS_GENPRIME)
     if( todo.rsa )
     {
         int keysize;
         mbedtls_rsa_context rsa;
-        for( keysize = 2048; keysize <= 4096; keysize *= 2 )
+        for( keysize = 2048; keysize <= 4096; keysize += 1024 )
         {
             mbedtls_snprintf( title, sizeof( title ), "RSA-%d", keysize );
 
@@ -666,14 +878,16 @@ int main( int argc, char *argv[] )
 #if defined(MBEDTLS_DHM_C) && defined(MBEDTLS_BIGNUM_C)
     if( todo.dhm )
     {
-        int dhm_sizes[] = { 2048, 3072 };
+        int dhm_sizes[] = { 2048, 3072, 4096 };
         const char *dhm_P[] = {
             MBEDTLS_DHM_RFC3526_MODP_2048_P,
             MBEDTLS_DHM_RFC3526_MODP_3072_P,
+            MBEDTLS_DHM_RFC3526_MODP_4096_P,
         };
         const char *dhm_G[] = {
             MBEDTLS_DHM_RFC3526_MODP_2048_G,
             MBEDTLS_DHM_RFC3526_MODP_3072_G,
+            MBEDTLS_DHM_RFC3526_MODP_4096_G,
         };
 
         mbedtls_dhm_context dhm;
@@ -721,6 +935,9 @@ int main( int argc, char *argv[] )
              curve_info->grp_id != MBEDTLS_ECP_DP_NONE;
              curve_info++ )
         {
+            if( ! ecdsa_curve_ok( curve_info->grp_id ) )
+                continue;
+
             mbedtls_ecdsa_init( &ecdsa );
 
             if( mbedtls_ecdsa_genkey( &ecdsa, curve_info->grp_id, myrand, NULL ) != 0 )
@@ -740,6 +957,9 @@ int main( int argc, char *argv[] )
              curve_info->grp_id != MBEDTLS_ECP_DP_NONE;
              curve_info++ )
         {
+            if( ! ecdsa_curve_ok( curve_info->grp_id ) )
+                continue;
+
             mbedtls_ecdsa_init( &ecdsa );
 
             if( mbedtls_ecdsa_genkey( &ecdsa, curve_info->grp_id, myrand, NULL ) != 0 ||
@@ -756,18 +976,101 @@ int main( int argc, char *argv[] )
                     ret = mbedtls_ecdsa_read_signature( &ecdsa, buf, curve_info->bit_size,
                                                 tmp, sig_len ) );
 
+            if( mbedtls_ecp_keypair_precompute( &ecdsa ) == 0 )
+            {
+                mbedtls_snprintf( title, sizeof( title ), "ECDSA-%s key table",
+                                                  curve_info->name );
+                TIME_PUBLIC( title, "verify",
+                        ret = mbedtls_ecdsa_read_signature( &ecdsa, buf, curve_info->bit_size,
+                                                    tmp, sig_len ) );
+            }
+
             mbedtls_ecdsa_free( &ecdsa );
         }
     }
+
+    if( todo.ecdsa_batch )
+    {
+        mbedtls_ecdsa_context ecdsa[ECDSA_BATCH_MAX];
+        const unsigned char *hash[ECDSA_BATCH_MAX];
+        size_t hlen[ECDSA_BATCH_MAX];
+        const mbedtls_ecp_point *Q[ECDSA_BATCH_MAX];
+        mbedtls_mpi r[ECDSA_BATCH_MAX], s[ECDSA_BATCH_MAX];
+        const mbedtls_ecp_curve_info *curve_info;
+        size_t n;
+
+        memset( buf, 0x2A, sizeof( buf ) );
+
+        for( curve_info = mbedtls_ecp_curve_list();
+             curve_info->grp_id != MBEDTLS_ECP_DP_NONE;
+             curve_info++ )
+        {
+            if( ! ecdsa_curve_ok( curve_info->grp_id ) )
+                continue;
+
+            /* one signer per signature, as when checking a chain */
+            for( i = 0; i < ECDSA_BATCH_MAX; i++ )
+            {
+                mbedtls_ecdsa_init( &ecdsa[i] );
+                mbedtls_mpi_init( &r[i] );
+                mbedtls_mpi_init( &s[i] );
+
+                if( mbedtls_ecdsa_genkey( &ecdsa[i], curve_info->grp_id, myrand, NULL ) != 0 ||
+                    mbedtls_ecdsa_sign( &ecdsa[i].grp, &r[i], &s[i], &ecdsa[i].d,
+                                        buf, 32, myrand, NULL ) != 0 )
+                {
+                    mbedtls_exit( 1 );
+                }
+
+                hash[i] = buf;
+                hlen[i] = 32;
+                Q[i] = &ecdsa[i].Q;
+            }
+            ecp_clear_precomputed( &ecdsa[0].grp );
+
+            for( n = 1; n <= ECDSA_BATCH_MAX; n *= 4 )
+            {
+                mbedtls_snprintf( title, sizeof( title ), "ECDSA-%s x%d",
+                                  curve_info->name, (int) n );
+                TIME_PUBLIC_BATCH( title, "verify", n,
+                        ret = mbedtls_ecdsa_verify_batch( &ecdsa[0].grp, n,
+                                            hash, hlen, Q, r, s, NULL ) );
+            }
+
+            for( i = 0; i < ECDSA_BATCH_MAX; i++ )
+            {
+                mbedtls_ecdsa_free( &ecdsa[i] );
+                mbedtls_mpi_free( &r[i] );
+                mbedtls_mpi_free( &s[i] );
+            }
+        }
+    }
+#endif
+
+#if defined(MBEDTLS_ED25519_C)
+    if( todo.ecdsa )
+    {
+        mbedtls_ed25519_context ed25519;
+
+        memset( buf, 0x2A, sizeof( buf ) );
+        mbedtls_ed25519_init( &ed25519 );
+
+        if( mbedtls_ed25519_genkey( &ed25519, myrand, NULL ) != 0 )
+            mbedtls_exit( 1 );
+
+        TIME_PUBLIC( "Ed25519", "sign",
+                ret = mbedtls_ed25519_sign( &ed25519, buf, 32, tmp ) );
+        TIME_PUBLIC( "Ed25519", "verify",
+                ret = mbedtls_ed25519_verify( &ed25519, buf, 32, tmp ) );
+
+        mbedtls_ed25519_free( &ed25519 );
+    }
 #endif
 
 #if defined(MBEDTLS_ECDH_C)
     if( todo.ecdh )
     {
         mbedtls_ecdh_context ecdh;
-#if defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED)
-        mbedtls_mpi z;
-#endif
         const mbedtls_ecp_curve_info *curve_info;
         size_t olen;
 
@@ -796,27 +1099,6 @@ int main( int argc, char *argv[] )
             mbedtls_ecdh_free( &ecdh );
         }
 
-        /* Curve25519 needs to be handled separately */
-#if defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED)
-        mbedtls_ecdh_init( &ecdh );
-        mbedtls_mpi_init( &z );
-
-        if( mbedtls_ecp_group_load( &ecdh.grp, MBEDTLS_ECP_DP_CURVE25519 ) != 0 ||
-            mbedtls_ecdh_gen_public( &ecdh.grp, &ecdh.d, &ecdh.Qp, myrand, NULL ) != 0 )
-        {
-            mbedtls_exit( 1 );
-        }
-
-        TIME_PUBLIC(  "ECDHE-Curve25519", "handshake",
-                ret |= mbedtls_ecdh_gen_public( &ecdh.grp, &ecdh.d, &ecdh.Q,
-                                        myrand, NULL );
-                ret |= mbedtls_ecdh_compute_shared( &ecdh.grp, &z, &ecdh.Qp, &ecdh.d,
-                                            myrand, NULL ) );
-
-        mbedtls_ecdh_free( &ecdh );
-        mbedtls_mpi_free( &z );
-#endif
-
         for( curve_info = mbedtls_ecp_curve_list();
              curve_info->grp_id != MBEDTLS_ECP_DP_NONE;
              curve_info++ )
@@ -841,27 +1123,70 @@ int main( int argc, char *argv[] )
                                              myrand, NULL ) );
             mbedtls_ecdh_free( &ecdh );
         }
+    }
 
-        /* Curve25519 needs to be handled separately */
-#if defined(MBEDTLS_ECP_DP_CURVE25519_ENABLED)
-        mbedtls_ecdh_init( &ecdh );
-        mbedtls_mpi_init( &z );
+    if( todo.ecdh_batch )
+    {
+        mbedtls_ecp_group grp;
+        mbedtls_ecp_point R[ECDH_BATCH_MAX], Qp[ECDH_BATCH_MAX];
+        const mbedtls_ecp_point *G[ECDH_BATCH_MAX], *P[ECDH_BATCH_MAX];
+        mbedtls_mpi d[ECDH_BATCH_MAX];
+        const mbedtls_ecp_curve_info *curve_info;
+        size_t n;
 
-        if( mbedtls_ecp_group_load( &ecdh.grp, MBEDTLS_ECP_DP_CURVE25519 ) != 0 ||
-            mbedtls_ecdh_gen_public( &ecdh.grp, &ecdh.d, &ecdh.Qp,
-                             myrand, NULL ) != 0 ||
-            mbedtls_ecdh_gen_public( &ecdh.grp, &ecdh.d, &ecdh.Q, myrand, NULL ) != 0 )
+        for( curve_info = mbedtls_ecp_curve_list();
+             curve_info->grp_id != MBEDTLS_ECP_DP_NONE;
+             curve_info++ )
         {
-            mbedtls_exit( 1 );
-        }
+            mbedtls_ecp_group_init( &grp );
 
-        TIME_PUBLIC(  "ECDH-Curve25519", "handshake",
-                ret |= mbedtls_ecdh_compute_shared( &ecdh.grp, &z, &ecdh.Qp, &ecdh.d,
-                                            myrand, NULL ) );
+            if( mbedtls_ecp_group_load( &grp, curve_info->grp_id ) != 0 )
+                mbedtls_exit( 1 );
 
-        mbedtls_ecdh_free( &ecdh );
-        mbedtls_mpi_free( &z );
-#endif
+            /* one peer per exchange, as for a burst of handshakes */
+            for( i = 0; i < ECDH_BATCH_MAX; i++ )
+            {
+                mbedtls_ecp_point_init( &R[i] );
+                mbedtls_ecp_point_init( &Qp[i] );
+                mbedtls_mpi_init( &d[i] );
+
+                if( mbedtls_ecp_gen_keypair( &grp, &d[i], &Qp[i],
+                                             myrand, NULL ) != 0 )
+                {
+                    mbedtls_exit( 1 );
+                }
+
+                G[i] = &grp.G;
+                P[i] = &Qp[i];
+            }
+            ecp_clear_precomputed( &grp );
+
+            for( n = 1; n <= ECDH_BATCH_MAX; n *= 4 )
+            {
+                mbedtls_snprintf( title, sizeof( title ), "ECDHE-%s x%d",
+                                  curve_info->name, (int) n );
+                TIME_PUBLIC_BATCH( title, "keygen", n,
+                        ret = mbedtls_ecp_mul_batch( &grp, R, d, G, n,
+                                                     myrand, NULL ) );
+            }
+
+            for( n = 1; n <= ECDH_BATCH_MAX; n *= 4 )
+            {
+                mbedtls_snprintf( title, sizeof( title ), "ECDH-%s x%d",
+                                  curve_info->name, (int) n );
+                TIME_PUBLIC_BATCH( title, "handshake", n,
+                        ret = mbedtls_ecp_mul_batch( &grp, R, d, P, n,
+                                                     myrand, NULL ) );
+            }
+
+            for( i = 0; i < ECDH_BATCH_MAX; i++ )
+            {
+                mbedtls_ecp_point_free( &R[i] );
+                mbedtls_ecp_point_free( &Qp[i] );
+                mbedtls_mpi_free( &d[i] );
+            }
+            mbedtls_ecp_group_free( &grp );
+        }
     }
 #endif
 
@@ -51,6 +51,7 @@
 #include "mbedtls/xtea.h"
 #include "mbedtls/pkcs5.h"
 #include "mbedtls/ecp.h"
+#include "mbedtls/ed25519.h"
 #include "mbedtls/ecjpake.h"
 #include "mbedtls/timing.h"
 
@@ -234,6 +235,9 @@ const selftest_t selftests[] =
 #if defined(MBEDTLS_ECP_C)
     {"ecp", mbedtls_ecp_self_test},
 #endif
+#if defined(MBEDTLS_ED25519_C)
+    {"ed25519", mbedtls_ed25519_self_test},
+#endif
 #if defined(MBEDTLS_ECJPAKE_C)
     {"ecjpake", mbedtls_ecjpake_self_test},
 #endif
@@ -102,6 +102,7 @@ MBEDTLS_NET_C
 MBEDTLS_TIMING_C
 MBEDTLS_FS_IO
 MBEDTLS_ENTROPY_NV_SEED
+MBEDTLS_DRBG_FORK_SAFETY
 MBEDTLS_HAVE_TIME
 MBEDTLS_HAVE_TIME_DATE
 MBEDTLS_DEPRECATED_WARNING
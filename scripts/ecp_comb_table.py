@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+#
+# Generate the static comb tables of library/ecp_curves.c
+#
+# Copyright (C) 2017, ARM Limited, All Rights Reserved
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may
+# not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# This file is part of mbed TLS (https://tls.mbed.org)
+#
+# Purpose
+#
+# Reads the domain parameters of the short Weierstrass curves from
+# library/ecp_curves.c and prints, for each of them, the table of
+# precomputed multiples of the generator that ecp_mul_comb() would
+# otherwise build at run time (see ecp_precompute_comb() in library/ecp.c).
+# The output is meant to be pasted into library/ecp_curves.c.
+#
+# The window size must match ECP_COMB_STATIC_W() in library/ecp.c:
+# 6 for curves of 384 bits or more, 5 otherwise.
+#
+# The curves without a fast reduction (the Brainpool ones) compute in
+# Montgomery form, so their tables hold x R mod p and y R mod p. R is a
+# power of 2 of as many limbs as p, which for these curves is 2^(8 * size
+# of p in bytes) with either 32-bit or 64-bit limbs.
+#
+# Usage: scripts/ecp_comb_table.py [curve ...]
+
+import re
+import sys
+
+CURVES = [ 'secp192r1', 'secp224r1', 'secp256r1', 'secp384r1', 'secp521r1',
+           'secp192k1', 'secp224k1', 'secp256k1',
+           'brainpoolP256r1', 'brainpoolP384r1', 'brainpoolP512r1' ]
+
+MONTGOMERY = [ 'brainpoolP256r1', 'brainpoolP384r1', 'brainpoolP512r1' ]
+
+def read_constants( path ):
+    """Return { name: (value, byte length) } for all mbedtls_mpi_uint arrays"""
+    src = open( path ).read()
+    consts = {}
+    for m in re.finditer( r'static const mbedtls_mpi_uint (\w+)\[\] = \{(.*?)\};',
+                          src, re.S ):
+        data = bytes( int( b, 16 ) for b in
+                      re.findall( r'0x([0-9A-Fa-f]{2})', m.group( 2 ) ) )
+        consts[m.group( 1 )] = ( int.from_bytes( data, 'little' ), len( data ) )
+    return consts
+
+def add( P, Q, a, p ):
+    if P is None:
+        return Q
+    if Q is None:
+        return P
+    if P[0] == Q[0]:
+        if ( P[1] + Q[1] ) % p == 0:
+            return None
+        l = ( 3 * P[0] * P[0] + a ) * pow( 2 * P[1], p - 2, p ) % p
+    else:
+        l = ( Q[1] - P[1] ) * pow( Q[0] - P[0], p - 2, p ) % p
+    x = ( l * l - P[0] - Q[0] ) % p
+    return ( x, ( l * ( P[0] - x ) - P[1] ) % p )
+
+def mul( k, P, a, p ):
+    R = None
+    while k:
+        if k & 1:
+            R = add( R, P, a, p )
+        P = add( P, P, a, p )
+        k >>= 1
+    return R
+
+def comb_table( G, a, p, nbits ):
+    """T[i] = i_{w-1} 2^{(w-1)d} G + ... + i_1 2^d G + G"""
+    w = 6 if nbits >= 384 else 5
+    d = ( nbits + w - 1 ) // w
+    T = []
+    for i in range( 1 << ( w - 1 ) ):
+        k = 1
+        for j in range( w - 1 ):
+            if i >> j & 1:
+                k += 1 << ( d * ( j + 1 ) )
+        T.append( mul( k, G, a, p ) )
+    return T
+
+def limbs( x, blen ):
+    """Format x as the curve's other constants: groups of 8, then 4 or 2"""
+    data = x.to_bytes( blen, 'little' )
+    out = []
+    while data:
+        n = 8 if len( data ) >= 8 else len( data )
+        args = ', '.join( '0x%02X' % b for b in data[:n] )
+        out.append( '    BYTES_TO_T_UINT_%d( %s ),' % ( n, args ) )
+        data = data[n:]
+    return out
+
+def print_curve( name, consts ):
+    p, plen = consts[name + '_p']
+    n, _ = consts[name + '_n']
+    a = consts[name + '_a'][0] if name + '_a' in consts else p - 3
+    gx, blen = consts[name + '_gx']
+    gy, _ = consts[name + '_gy']
+    T = comb_table( ( gx, gy ), a, p, n.bit_length() )
+    if name in MONTGOMERY:
+        R = 1 << ( 8 * plen )
+        T = [ ( x * R % p, y * R % p ) for ( x, y ) in T ]
+
+    print( 'static const mbedtls_mpi_uint %s_T_xy[] = {' % name )
+    for i, ( x, y ) in enumerate( T ):
+        print( '    /* T[%d].X, T[%d].Y */' % ( i, i ) )
+        print( '\n'.join( limbs( x, blen ) ) )
+        print( '\n'.join( limbs( y, blen ) ) )
+    print( '};' )
+    print( 'static const mbedtls_ecp_point %s_T[%d] = {' % ( name, len( T ) ) )
+    for i in range( len( T ) ):
+        print( '    ECP_COMB_POINT( %s, %d ),' % ( name, i ) )
+    print( '};' )
+
+def main():
+    consts = read_constants( 'library/ecp_curves.c' )
+    for name in sys.argv[1:] or CURVES:
+        print_curve( name, consts )
+
+if __name__ == '__main__':
+    main()
@@ -530,6 +530,19 @@ make test
 msg "test: !MBEDTLS_SSL_RENEGOTIATION - ssl-opt.sh (ASan build)" # ~ 6 min
 if_build_succeeded tests/ssl-opt.sh
 
+msg "build: Default + MBEDTLS_ECP_RESTARTABLE (ASan build)" # ~ 6 min
+cleanup
+cp "$CONFIG_H" "$CONFIG_BAK"
+scripts/config.pl set MBEDTLS_ECP_RESTARTABLE
+CC=gcc cmake -D CMAKE_BUILD_TYPE:String=Asan .
+make
+
+msg "test: MBEDTLS_ECP_RESTARTABLE - main suites (inc. selftests) (ASan build)" # ~ 50s
+make test
+
+msg "test: MBEDTLS_ECP_RESTARTABLE - ssl-opt.sh EC restart (ASan build)" # ~ 10s
+if_build_succeeded tests/ssl-opt.sh -f 'EC restart'
+
 msg "build: cmake, full config, clang, C99" # ~ 50s
 cleanup
 cp "$CONFIG_H" "$CONFIG_BAK"
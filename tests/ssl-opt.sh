@@ -144,6 +144,13 @@ requires_openssl_with_fallback_scsv() {
     fi
 }
 
+# skip next test if OpenSSL can't use the given curve (e.g. X25519)
+requires_openssl_with_curve() {
+    if ! $OPENSSL_CMD genpkey -algorithm "$1" >/dev/null 2>&1; then
+        SKIP_NEXT="YES"
+    fi
+}
+
 # skip next test if GnuTLS isn't available
 requires_gnutls() {
     if [ -z "${GNUTLS_AVAILABLE:-}" ]; then
@@ -3288,6 +3295,217 @@ run_test    "ECJPAKE: working, DTLS, nolog" \
              force_ciphersuite=TLS-ECJPAKE-WITH-AES-128-CCM-8" \
             0
 
+# Tests for the pool of precomputed ECDHE keys and ECDSA nonces
+
+requires_config_enabled MBEDTLS_ECP_POOL_C
+run_test    "ECP pool: ECDHE-ECDSA, key and nonce from pool" \
+            "$P_SRV ecp_pool=4 debug_level=3" \
+            "$P_CLI force_ciphersuite=TLS-ECDHE-ECDSA-WITH-AES-128-GCM-SHA256" \
+            0 \
+            -s "ECDHE key taken from pool" \
+            -s "ECDSA nonce taken from pool"
+
+requires_config_enabled MBEDTLS_ECP_POOL_C
+run_test    "ECP pool: ECDHE-ECDSA, TLS 1.0" \
+            "$P_SRV ecp_pool=4 debug_level=3" \
+            "$P_CLI force_version=tls1 \
+             force_ciphersuite=TLS-ECDHE-ECDSA-WITH-AES-128-CBC-SHA" \
+            0 \
+            -s "ECDHE key taken from pool" \
+            -s "ECDSA nonce taken from pool"
+
+requires_config_enabled MBEDTLS_ECP_POOL_C
+run_test    "ECP pool: ECDHE-RSA, key from pool" \
+            "$P_SRV ecp_pool=4 debug_level=3" \
+            "$P_CLI force_ciphersuite=TLS-ECDHE-RSA-WITH-AES-128-GCM-SHA256" \
+            0 \
+            -s "ECDHE key taken from pool" \
+            -S "ECDSA nonce taken from pool"
+
+requires_config_enabled MBEDTLS_ECP_POOL_C
+run_test    "ECP pool: no key for the negotiated curve" \
+            "$P_SRV ecp_pool=4 debug_level=3 curves=secp384r1,secp256r1" \
+            "$P_CLI curves=secp256r1 \
+             force_ciphersuite=TLS-ECDHE-ECDSA-WITH-AES-128-GCM-SHA256" \
+            0 \
+            -S "ECDHE key taken from pool" \
+            -s "ECDSA nonce taken from pool"
+
+requires_config_enabled MBEDTLS_ECP_POOL_C
+run_test    "ECP pool: not configured" \
+            "$P_SRV debug_level=3" \
+            "$P_CLI force_ciphersuite=TLS-ECDHE-ECDSA-WITH-AES-128-GCM-SHA256" \
+            0 \
+            -S "ECDHE key taken from pool" \
+            -S "ECDSA nonce taken from pool"
+
+# Tests for restartable ECC in the handshake: ECDHE and ECDSA on secp521r1,
+# which has no dedicated backend that would complete the operations in one
+# call. An operation that returns early is logged as "... returned -19200
+# (-0x4b00)" (MBEDTLS_ERR_ECP_IN_PROGRESS).
+
+requires_config_enabled MBEDTLS_ECP_RESTARTABLE
+requires_config_enabled MBEDTLS_ECP_DP_SECP521R1_ENABLED
+run_test    "EC restart: client, max_ops=1000" \
+            "$P_SRV auth_mode=required \
+             crt_file=data_files/server11.crt key_file=data_files/ec_521_prv.pem" \
+            "$P_CLI force_ciphersuite=TLS-ECDHE-ECDSA-WITH-AES-128-GCM-SHA256 \
+             curves=secp521r1 ec_max_ops=1000 debug_level=2 \
+             crt_file=data_files/server11.crt key_file=data_files/ec_521_prv.pem" \
+            0 \
+            -c "mbedtls_pk_verify.*4b00" \
+            -c "mbedtls_ecdh_make_public.*4b00" \
+            -c "mbedtls_ecdh_calc_secret.*4b00" \
+            -c "mbedtls_pk_sign.*4b00" \
+            -C "mbedtls_ssl_handshake returned" \
+            -c "HTTP/1.0 200 OK"
+
+requires_config_enabled MBEDTLS_ECP_RESTARTABLE
+requires_config_enabled MBEDTLS_ECP_DP_SECP521R1_ENABLED
+run_test    "EC restart: server, max_ops=1000" \
+            "$P_SRV auth_mode=required ec_max_ops=1000 debug_level=1 \
+             crt_file=data_files/server11.crt key_file=data_files/ec_521_prv.pem" \
+            "$P_CLI force_ciphersuite=TLS-ECDHE-ECDSA-WITH-AES-128-GCM-SHA256 \
+             curves=secp521r1 \
+             crt_file=data_files/server11.crt key_file=data_files/ec_521_prv.pem" \
+            0 \
+            -s "mbedtls_ecdh_make_params.*4b00" \
+            -s "mbedtls_pk_sign.*4b00" \
+            -s "mbedtls_ecdh_calc_secret.*4b00" \
+            -S "mbedtls_ssl_handshake returned" \
+            -c "HTTP/1.0 200 OK"
+
+requires_config_enabled MBEDTLS_ECP_RESTARTABLE
+requires_config_enabled MBEDTLS_ECP_DP_SECP521R1_ENABLED
+run_test    "EC restart: client and server, nbio, max_ops=1000" \
+            "$P_SRV auth_mode=required ec_max_ops=1000 nbio=2 debug_level=1 \
+             crt_file=data_files/server11.crt key_file=data_files/ec_521_prv.pem" \
+            "$P_CLI force_ciphersuite=TLS-ECDHE-ECDSA-WITH-AES-128-GCM-SHA256 \
+             curves=secp521r1 ec_max_ops=1000 nbio=2 debug_level=2 \
+             crt_file=data_files/server11.crt key_file=data_files/ec_521_prv.pem" \
+            0 \
+            -c "mbedtls_pk_verify.*4b00" \
+            -c "mbedtls_ecdh_make_public.*4b00" \
+            -c "mbedtls_pk_sign.*4b00" \
+            -s "mbedtls_ecdh_make_params.*4b00" \
+            -s "mbedtls_ecdh_calc_secret.*4b00" \
+            -c "HTTP/1.0 200 OK"
+
+requires_config_enabled MBEDTLS_ECP_RESTARTABLE
+requires_config_enabled MBEDTLS_ECP_DP_SECP521R1_ENABLED
+run_test    "EC restart: no restart, max_ops=0" \
+            "$P_SRV auth_mode=required ec_max_ops=0 debug_level=1 \
+             crt_file=data_files/server11.crt key_file=data_files/ec_521_prv.pem" \
+            "$P_CLI force_ciphersuite=TLS-ECDHE-ECDSA-WITH-AES-128-GCM-SHA256 \
+             curves=secp521r1 ec_max_ops=0 debug_level=2 \
+             crt_file=data_files/server11.crt key_file=data_files/ec_521_prv.pem" \
+            0 \
+            -S "4b00" \
+            -C "4b00" \
+            -c "HTTP/1.0 200 OK"
+
+# Tests for ECDHE with the Montgomery curves X25519 and X448 (RFC 8422)
+
+requires_config_enabled MBEDTLS_ECP_DP_CURVE25519_ENABLED
+run_test    "ECDHE curve: x25519" \
+            "$P_SRV debug_level=3" \
+            "$P_CLI debug_level=3 curves=x25519" \
+            0 \
+            -s "ECDHE curve: x25519" \
+            -c "ECDH curve: x25519" \
+            -S "error" \
+            -C "error"
+
+requires_config_enabled MBEDTLS_ECP_DP_CURVE25519_ENABLED
+requires_config_enabled MBEDTLS_ECP_DP_SECP256R1_ENABLED
+run_test    "ECDHE curve: x25519 preferred to secp256r1 by default" \
+            "$P_SRV debug_level=3" \
+            "$P_CLI curves=secp256r1,x25519" \
+            0 \
+            -s "ECDHE curve: x25519"
+
+requires_config_enabled MBEDTLS_ECP_DP_CURVE25519_ENABLED
+requires_config_enabled MBEDTLS_ECP_DP_SECP256R1_ENABLED
+run_test    "ECDHE curve: x25519 not supported by server" \
+            "$P_SRV debug_level=3 curves=secp256r1" \
+            "$P_CLI curves=x25519,secp256r1" \
+            0 \
+            -s "ECDHE curve: secp256r1"
+
+requires_config_enabled MBEDTLS_ECP_DP_CURVE25519_ENABLED
+run_test    "ECDHE curve: x25519, ECDHE-RSA" \
+            "$P_SRV debug_level=3 curves=x25519" \
+            "$P_CLI debug_level=3 \
+             force_ciphersuite=TLS-ECDHE-RSA-WITH-AES-128-GCM-SHA256" \
+            0 \
+            -s "ECDHE curve: x25519" \
+            -c "ECDH curve: x25519" \
+            -c "Ciphersuite is TLS-ECDHE-RSA-WITH-AES-128-GCM-SHA256"
+
+requires_config_enabled MBEDTLS_ECP_DP_CURVE25519_ENABLED
+requires_config_enabled MBEDTLS_KEY_EXCHANGE_ECDHE_PSK_ENABLED
+run_test    "ECDHE curve: x25519, ECDHE-PSK" \
+            "$P_SRV debug_level=3 psk=abc123 curves=x25519" \
+            "$P_CLI psk=abc123 \
+             force_ciphersuite=TLS-ECDHE-PSK-WITH-AES-128-CBC-SHA256" \
+            0 \
+            -s "ECDHE curve: x25519" \
+            -c "Ciphersuite is TLS-ECDHE-PSK-WITH-AES-128-CBC-SHA256"
+
+requires_config_enabled MBEDTLS_ECP_DP_CURVE25519_ENABLED
+run_test    "ECDHE curve: x25519, DTLS" \
+            "$P_SRV debug_level=3 dtls=1 curves=x25519" \
+            "$P_CLI dtls=1" \
+            0 \
+            -s "ECDHE curve: x25519" \
+            -s "Protocol is DTLSv1.2"
+
+requires_config_enabled MBEDTLS_ECP_DP_CURVE448_ENABLED
+run_test    "ECDHE curve: x448" \
+            "$P_SRV debug_level=3" \
+            "$P_CLI debug_level=3 curves=x448" \
+            0 \
+            -s "ECDHE curve: x448" \
+            -c "ECDH curve: x448" \
+            -S "error" \
+            -C "error"
+
+requires_config_enabled MBEDTLS_ECP_DP_CURVE25519_ENABLED
+requires_openssl_with_curve X25519
+run_test    "ECDHE curve: x25519, openssl server" \
+            "$O_SRV -curves X25519" \
+            "$P_CLI debug_level=3 curves=x25519,secp256r1" \
+            0 \
+            -c "ECDH curve: x25519" \
+            -c "Ciphersuite is TLS-ECDHE-ECDSA-"
+
+requires_config_enabled MBEDTLS_ECP_DP_CURVE25519_ENABLED
+requires_openssl_with_curve X25519
+run_test    "ECDHE curve: x25519, openssl client" \
+            "$P_SRV debug_level=3" \
+            "$O_CLI -curves X25519:P-256" \
+            0 \
+            -s "ECDHE curve: x25519" \
+            -s "Ciphersuite is TLS-ECDHE-ECDSA-"
+
+requires_config_enabled MBEDTLS_ECP_DP_CURVE448_ENABLED
+requires_openssl_with_curve X448
+run_test    "ECDHE curve: x448, openssl server" \
+            "$O_SRV -curves X448" \
+            "$P_CLI debug_level=3 curves=x448,secp256r1" \
+            0 \
+            -c "ECDH curve: x448" \
+            -c "Ciphersuite is TLS-ECDHE-ECDSA-"
+
+requires_config_enabled MBEDTLS_ECP_DP_CURVE448_ENABLED
+requires_openssl_with_curve X448
+run_test    "ECDHE curve: x448, openssl client" \
+            "$P_SRV debug_level=3" \
+            "$O_CLI -curves X448:P-256" \
+            0 \
+            -s "ECDHE curve: x448" \
+            -s "Ciphersuite is TLS-ECDHE-ECDSA-"
+
 # Tests for ciphersuites per version
 
 requires_config_enabled MBEDTLS_SSL_PROTO_SSL3